@@ -125,6 +125,7 @@ namespace blaze {}
 //                <li> \ref openmp_parallelization </li>
 //                <li> \ref cpp_threads_parallelization </li>
 //                <li> \ref boost_threads_parallelization </li>
+//                <li> \ref tbb_parallelization </li>
 //                <li> \ref serial_execution </li>
 //             </ul>
 //          </li>
@@ -5306,6 +5307,28 @@ namespace blaze {}
 // standard for the current CPU generation.
 //
 //
+// \n \section openmp_deterministic_reductions Deterministic Reductions
+// <hr>
+//
+// Due to the non-associativity of floating point additions, the result of a parallel reduction
+// (as for instance the inner product of two dense vectors or the residual norms within the CG
+// and CPG solvers) in general depends on the number of threads. In case reproducible results
+// are required, the \c BLAZE_SMP_DETERMINISTIC_REDUCTION switch in the configuration file
+// <em>./blaze/config/SMP.h</em> can be set to 1, either in the configuration file or on the
+// command line:
+
+   \code
+   g++ ... -DBLAZE_SMP_DETERMINISTIC_REDUCTION=1 ...
+   \endcode
+
+// In this mode, all reductions are split into blocks of \c SMP_REDUCTION_BLOCK_SIZE elements,
+// independent of the number of threads, and the partial results of the blocks are combined via
+// a fixed binary tree. Thus the results are identical bit for bit for any number of threads and
+// for all parallelization techniques. Additionally, the \c SMP_REDUCTION_ACCUMULATION setting
+// allows to select a pairwise or compensated summation within the blocks in order to reduce the
+// rounding errors of long reductions.
+//
+//
 // \n \section openmp_first_touch First Touch Policy
 // <hr>
 //
@@ -5549,6 +5572,31 @@ namespace blaze {}
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_async Asynchronous Evaluation
+// <hr>
+//
+// Each assignment is parallelized on its own and only returns after all threads have finished.
+// Several small, independent assignments can therefore not keep all threads busy. In this case
+// the assignments can be evaluated asynchronously via the \c async() function:
+
+   \code
+   blaze::AsyncHandle h1 = blaze::async( y1, A * x1 );
+   blaze::AsyncHandle h2 = blaze::async( y2, B * x2 );  // Evaluated concurrently to y1
+   blaze::AsyncHandle h3 = blaze::async( z, C * y1 );   // Deferred until y1 has been computed
+
+   h2.wait();
+   h3.wait();
+   \endcode
+
+// Each asynchronous assignment is evaluated by a single thread. Assignments that read or write
+// the target of a pending assignment or write an operand of a pending assignment are deferred
+// until the according assignment has been completed. The target vector or matrix must not be
+// accessed and the operands must not be modified until the assignment has been completed, i.e.
+// until the wait() function of its handle has returned. Note that the target of an asynchronous
+// assignment cannot be a view. In case the OpenMP-based parallelization is used, or in case the
+// parallelization is deactivated, the async() function performs the assignment immediately.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -5582,7 +5630,7 @@ namespace blaze {}
 //**Boost Thread Parallelization*******************************************************************
 /*!\page boost_threads_parallelization Boost Thread Parallelization
 //
-// <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref serial_execution </center> \n
+// <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref tbb_parallelization </center> \n
 //
 // The third available shared memory parallelization provided with \b Blaze is based on Boost
 // threads.
@@ -5649,7 +5697,82 @@ namespace blaze {}
 // have been determined using the OpenMP parallelization and require individual adaption for
 // the Boost thread parallelization.
 //
-// \n <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref serial_execution </center>
+// \n <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref tbb_parallelization </center>
+*/
+//*************************************************************************************************
+
+
+//**TBB Parallelization****************************************************************************
+/*!\page tbb_parallelization TBB Parallelization
+//
+// <center> Previous: \ref boost_threads_parallelization &nbsp; &nbsp; Next: \ref serial_execution </center> \n
+//
+// The fourth available shared memory parallelization provided with \b Blaze is based on the task
+// scheduler of the Intel Threading Building Blocks (TBB). In contrast to the C++11 and Boost
+// thread parallelizations, \b Blaze does not create any threads of its own, but submits the
+// parallel operations as tasks to the TBB task arena of the calling thread. Therefore this
+// parallelization is the preferred choice for applications that already use TBB.
+//
+//
+// \n \section tbb_setup TBB Setup
+// <hr>
+//
+// In order to enable the TBB-based parallelization, two steps have to be taken: First, the
+// \c BLAZE_USE_TBB_THREADS command line argument has to be explicitly specified during
+// compilation:
+
+   \code
+   ... -DBLAZE_USE_TBB_THREADS -std=c++11 ...
+   \endcode
+
+// Second, the TBB library has to be linked (for instance via \c -ltbb). Note that the OpenMP-based,
+// the C++11 thread-based, and the Boost thread-based parallelizations have priority, i.e. are
+// preferred in case either is enabled in combination with the TBB parallelization.
+//
+// The number of threads is determined by the application: \b Blaze uses the concurrency of the
+// task arena of the calling thread, which can be controlled via \c tbb::task_arena or
+// \c tbb::global_control:
+
+   \code
+   tbb::task_arena arena( 4 );
+
+   arena.execute( [&]() {
+      y = A * x;  // Executed by (at most) 4 threads
+   } );
+   \endcode
+
+// Via the \c setNumThreads() function the number of threads a single operation is split for can
+// be further limited, but not increased beyond the concurrency of the current arena. The
+// \c getNumThreads() function returns the number of threads available to the calling thread.
+//
+//
+// \n \section tbb_nested_parallelism Nested Parallelism
+// <hr>
+//
+// Each operation is split into several tasks per thread, which are recursively distributed by
+// the TBB task scheduler. The operations are executed in isolation, i.e. a thread waiting for the
+// completion of a \b Blaze operation does not pick up unrelated tasks of the application. Thus
+// \b Blaze operations can be safely started from within the tasks of the application, for
+// instance within the body of a \c tbb::parallel_for(). In this case the operation is executed
+// by all threads of the arena that are currently idle:
+
+   \code
+   tbb::parallel_for( size_t(0), systems.size(), [&]( size_t i ) {
+      systems[i].x = systems[i].A * systems[i].b;  // Parallelized by Blaze if threads are idle
+   } );
+   \endcode
+
+// \n \section tbb_configuration TBB Configuration
+// <hr>
+//
+// As in case of the other shared memory parallelizations \b Blaze is not unconditionally running
+// an operation in parallel (see \ref openmp_parallelization or \ref cpp_threads_parallelization).
+// All thresholds related to the TBB parallelization are also contained within the configuration
+// file <em>./blaze/config/Thresholds.h</em>. Note that the asynchronous evaluation via the
+// \c async() function (see \ref cpp_threads_async) is not supported by the TBB parallelization,
+// i.e. the assignments are performed immediately.
+//
+// \n <center> Previous: \ref boost_threads_parallelization &nbsp; &nbsp; Next: \ref serial_execution </center>
 */
 //*************************************************************************************************
 
@@ -5657,7 +5780,7 @@ namespace blaze {}
 //**Serial Execution*******************************************************************************
 /*!\page serial_execution Serial Execution
 //
-// <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref vector_serialization </center> \n
+// <center> Previous: \ref tbb_parallelization &nbsp; &nbsp; Next: \ref vector_serialization </center> \n
 //
 // Sometimes it may be necessary to enforce the serial execution of specific operations. For this
 // purpose, the \b Blaze library offers three possible options: the serialization of a single
@@ -5734,7 +5857,7 @@ namespace blaze {}
 // In case the \c BLAZE_USE_SHARED_MEMORY_PARALLELIZATION switch is set to 0, the shared-memory
 // parallelization is deactivated altogether.
 //
-// \n <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref vector_serialization </center>
+// \n <center> Previous: \ref tbb_parallelization &nbsp; &nbsp; Next: \ref vector_serialization </center>
 */
 //*************************************************************************************************
 
@@ -6119,7 +6242,28 @@ namespace blaze {}
 // application of the custom Blaze kernels for small dense matrix/dense vector multiplications
 // and the BLAS kernels for large multiplications. All thresholds, including the thresholds for
 // the OpenMP-based parallelization, are contained within the configuration file
-// <em>./blaze/config/Thresholds.h</em>.
+// <em>./blaze/config/Thresholds.h</em>. Each threshold can alternatively be specified on the
+// command line of the compiler, as for instance in
+
+   \code
+   g++ ... -DBLAZE_SMP_DVECASSIGN_THRESHOLD=76000UL ...
+   \endcode
+
+// By default, all thresholds are compile time constants. In case the \a BLAZE_USE_RUNTIME_THRESHOLDS
+// switch is set to 1, the thresholds can be adapted at runtime without recompiling:
+
+   \code
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 76000UL );  // Setting a single threshold
+   blaze::loadThresholds( "Thresholds.h" );                     // Loading a threshold file
+   const size_t threshold( blaze::getThreshold( "DMATDVECMULT_THRESHOLD" ) );
+   \endcode
+
+// Additionally, the thresholds are initialized at program start from the threshold file named
+// by the \c BLAZE_THRESHOLD_FILE environment variable and from the environment variables of the
+// same name as the threshold macros (e.g. \c BLAZE_SMP_DVECASSIGN_THRESHOLD). A threshold file
+// for the target platform can be created by the \c calibration binary of the \b Blazemark,
+// which measures the crossover points of the dense SMP and BLAS thresholds. The resulting file
+// can either be loaded at runtime or be used to replace <em>./blaze/config/Thresholds.h</em>.
 //
 //
 // \n \section streaming Streaming (Non-Temporal Stores)
@@ -6142,6 +6286,29 @@ namespace blaze {}
 // whether streaming is beneficial or hurtful for performance.
 //
 //
+// \n \section scratch_arena Scratch Arena
+//
+// Several expressions (as for instance the multiplication of two dense matrices or the transpose
+// of a dense matrix expression) have to evaluate their operands into temporary vectors and
+// matrices. By default, the elements of these temporaries are not dynamically allocated, but are
+// taken from a thread-local, stack-like memory block (the scratch arena) in case they are of
+// built-in data type. The arena grows to the largest demand of a thread and is then reused, such
+// that repeated evaluations of the same expressions don't perform any dynamic memory allocation.
+// Since the arena is thread-local, this also holds for the threads of the shared-memory
+// parallelization. The configuration file <em>./blaze/config/ScratchArena.h</em> provides a
+// compile time switch to (de-)activate the scratch arena and the maximum size of the arena of a
+// single thread:
+
+   \code
+   const bool useScratchArena = true;
+   const size_t scratchArenaLimit = 16777216UL;
+   \endcode
+
+// Temporaries that don't fit into the remaining memory of the arena are dynamically allocated.
+// Note that the scratch arena requires compiler support for thread-local storage and is
+// deactivated otherwise.
+//
+//
 // \n <center> Previous: \ref intra_statement_optimization </center>
 */
 //*************************************************************************************************
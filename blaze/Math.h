@@ -42,6 +42,7 @@
 
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
@@ -55,6 +56,7 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/Quaternion.h>
+#include <blaze/math/Reordering.h>
 #include <blaze/math/RotationMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
@@ -65,6 +67,7 @@
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/SymmetricMatrix.h>
 #include <blaze/math/Traits.h>
+#include <blaze/math/TriangularSolve.h>
 #include <blaze/math/TransposeFlag.h>
 #include <blaze/math/TypeTraits.h>
 #include <blaze/math/UpperMatrix.h>
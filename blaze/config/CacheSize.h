@@ -48,4 +48,16 @@ namespace blaze {
 const size_t cacheSize = 3145728UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Cache line size of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of a single cache line in Byte of the used target architecture.
+// It is for instance used to align the blocks of shared-memory parallel operations to cache line
+// boundaries in order to avoid false sharing between threads.
+*/
+const size_t cacheLineSize = 64UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -51,4 +51,116 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Spin duration of waiting threads of the thread-based parallelization.
+// \ingroup config
+//
+// This setting specifies the time (in microseconds) a thread of the C++11/Boost thread-based
+// parallelization actively spins before it starts to yield its time slice. The setting applies
+// to idle threads of the thread pool waiting for a new task, to threads waiting for the
+// completion of a parallel operation, and to threads waiting at a barrier. Spinning avoids the
+// latency of putting a thread to sleep and waking it up again for back-to-back parallel
+// operations, but occupies the according core. A value of 0 disables spinning.
+*/
+const size_t SMP_SPIN_TIME = 50UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Yield duration of waiting threads of the thread-based parallelization.
+// \ingroup config
+//
+// This setting specifies the time (in microseconds) a waiting thread of the C++11/Boost
+// thread-based parallelization repeatedly yields its time slice after the spin phase (see
+// \c SMP_SPIN_TIME) before it blocks on a condition variable. A value of 0 disables yielding.
+*/
+const size_t SMP_YIELD_TIME = 50UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the parallel first-touch initialization of dense containers.
+// \ingroup config
+//
+// On NUMA systems the physical memory of a page is allocated on the memory node of the thread
+// that first writes to it. In case this switch is set to \a true, large DynamicVector and
+// DynamicMatrix instances of numeric element type are initialized in parallel (see
+// \c SMP_FIRST_TOUCH_THRESHOLD), using the same static partition into one contiguous block of
+// elements/rows/columns per thread as the SMP assignment. Thus each block preferably resides on
+// the memory node of a thread working on it, in particular if the threads are pinned (see
+// blaze::setAffinity()). In case the switch is set to \a false, all elements are initialized
+// by the constructing thread.
+//
+// Possible settings for the first-touch switch:
+//  - Deactivated: \b false (default)
+//  - Activated  : \b true
+*/
+const bool SMP_FIRST_TOUCH = false;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Minimum capacity of a dense container for the parallel first-touch initialization.
+// \ingroup config
+//
+// This setting specifies the minimum capacity (i.e. the number of elements including padding)
+// of a DynamicVector or DynamicMatrix for the parallel first-touch initialization (see
+// \c SMP_FIRST_TOUCH). Below this threshold the elements are initialized by the constructing
+// thread, since the block of each thread would only span a few pages.
+*/
+const size_t SMP_FIRST_TOUCH_THRESHOLD = 262144UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for deterministic reductions.
+// \ingroup config
+// In case this switch is set to 1, the inner products of dense vectors, the dense vector
+// norms, and the reductions of the CG and CPG solvers are computed such that the result is
+// reproducible bit for bit, independent of the number of threads and of whether the reduction
+// is executed in parallel at all. For that purpose, the elements are split into blocks of fixed
+// size (see \c SMP_REDUCTION_BLOCK_SIZE), the partial results of the blocks are computed in
+// parallel, and the partial results are combined via a fixed binary tree. In case the switch is
+// set to 0, these reductions are computed by a single thread.
+// Possible settings for the deterministic reduction switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// Note that this switch can also be specified on the command line (e.g.
+// \c -DBLAZE_SMP_DETERMINISTIC_REDUCTION=1). However, the same setting has to be used in all
+// compilation units of a program.
+*/
+#ifndef BLAZE_SMP_DETERMINISTIC_REDUCTION
+#define BLAZE_SMP_DETERMINISTIC_REDUCTION 0
+#endif
+
+const bool SMP_DETERMINISTIC_REDUCTION = BLAZE_SMP_DETERMINISTIC_REDUCTION;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of elements per block of a deterministic reduction.
+// \ingroup config
+// This setting specifies the number of elements per block of a deterministic reduction (see
+// \c SMP_DETERMINISTIC_REDUCTION). The blocks are independent of the number of threads, i.e.
+// changing this setting changes the rounding of the results. The block size must be a multiple
+// of 64 in order to keep the blocks aligned for all SIMD widths.
+*/
+const size_t SMP_REDUCTION_BLOCK_SIZE = 2048UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Accumulation scheme within the blocks of a deterministic reduction.
+// \ingroup config
+// This setting specifies the summation scheme within a single block of a deterministic reduction
+// (see \c SMP_DETERMINISTIC_REDUCTION):
+//  - Plain (vectorized) summation         : \b blaze::plainAccumulation (default)
+//  - Pairwise summation                   : \b blaze::pairwiseAccumulation
+//  - Compensated (Kahan-Babuska) summation: \b blaze::compensatedAccumulation
+*/
+const Accumulation SMP_REDUCTION_ACCUMULATION = plainAccumulation;
+//*************************************************************************************************
+
 } // namespace blaze
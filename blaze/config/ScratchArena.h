@@ -0,0 +1,71 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/ScratchArena.h
+//  \brief Configuration of the scratch arena for expression temporaries
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Configuration of the scratch arena for expression temporaries.
+// \ingroup config
+//
+// Several expressions (as for instance nested matrix multiplications or the assignment of a
+// multiplication to a sparse target) have to evaluate their operands into temporary dense vectors
+// and matrices. In order to avoid a dynamic memory allocation for every single temporary, these
+// temporaries are placed in a thread-local, stack-like scratch arena, which is reused by all
+// subsequent evaluations of the same thread. After a short warm-up phase the repeated evaluation
+// of an expression therefore does not perform any dynamic memory allocation for its temporaries.
+//
+// Via this compilation switch the scratch arena can be (de-)activated. If set to \a true, the
+// temporaries are placed in the scratch arena, if set to \a false all temporaries are allocated
+// dynamically.
+*/
+const bool useScratchArena = true;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maximum size of the scratch arena of a single thread.
+// \ingroup config
+//
+// This setting specifies the maximum size in Byte of the scratch arena of a single thread. The
+// scratch arena of a thread grows to the size required by the temporaries of the evaluated
+// expressions, but not beyond this limit. Temporaries exceeding the limit are allocated
+// dynamically. Since the cost of the dynamic allocation is negligible in comparison to the
+// computation of large temporaries, this limit bounds the memory held by each thread without
+// affecting the performance. The limit must be a multiple of 64.
+*/
+const size_t scratchArenaLimit = 16777216UL;
+//*************************************************************************************************
+
+} // namespace blaze
@@ -33,7 +33,41 @@
 //=================================================================================================
 
 
-namespace blaze {
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for runtime-adjustable thresholds.
+// \ingroup config
+//
+// This compilation switch specifies whether the thresholds are fixed at compile time or whether
+// they can be adjusted at runtime. In case the switch is set to 0 (the default), all thresholds
+// are compile time constants and there is no overhead for the threshold checks. In case the
+// switch is set to 1, the values given in this file are only used as initial values, which can
+// be overwritten by environment variables (e.g. \c BLAZE_SMP_DMATDVECMULT_THRESHOLD), by a
+// threshold file specified via the \c BLAZE_THRESHOLD_FILE environment variable, or via the
+// setThreshold() and loadThresholds() functions.
+//
+// Possible settings for the runtime threshold switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// Note that this switch and all thresholds in this file can also be specified on the command
+// line (e.g. \c -DBLAZE_USE_RUNTIME_THRESHOLDS=1 or \c -DBLAZE_DMATDMATMULT_THRESHOLD=4900UL)
+// or by including a threshold file generated by the calibration tool of the Blaze benchmark
+// suite before any Blaze header. However, the same setting has to be used in all compilation
+// units of a program.
+*/
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 0
+#endif
+//*************************************************************************************************
+
+
+
 
 //=================================================================================================
 //
@@ -54,7 +88,9 @@ namespace blaze {
 // The default setting for this threshold is 4000000 (which for instance corresponds to a matrix
 // size of \f$ 2000 \times 2000 \f$).
 */
-const size_t DMATDVECMULT_THRESHOLD = 4000000UL;
+#ifndef BLAZE_DMATDVECMULT_THRESHOLD
+#define BLAZE_DMATDVECMULT_THRESHOLD 4000000UL
+#endif
 //*************************************************************************************************
 
 
@@ -71,7 +107,9 @@ const size_t DMATDVECMULT_THRESHOLD = 4000000UL;
 // The default setting for this threshold is 62500 (which for instance corresponds to a matrix
 // size of \f$ 250 \times 250 \f$).
 */
-const size_t TDMATDVECMULT_THRESHOLD = 62500UL;
+#ifndef BLAZE_TDMATDVECMULT_THRESHOLD
+#define BLAZE_TDMATDVECMULT_THRESHOLD 62500UL
+#endif
 //*************************************************************************************************
 
 
@@ -88,7 +126,9 @@ const size_t TDMATDVECMULT_THRESHOLD = 62500UL;
 // The default setting for this threshold is 62500 (which for instance corresponds to a matrix
 // size of \f$ 250 \times 250 \f$).
 */
-const size_t TDVECDMATMULT_THRESHOLD = 62500UL;
+#ifndef BLAZE_TDVECDMATMULT_THRESHOLD
+#define BLAZE_TDVECDMATMULT_THRESHOLD 62500UL
+#endif
 //*************************************************************************************************
 
 
@@ -105,7 +145,9 @@ const size_t TDVECDMATMULT_THRESHOLD = 62500UL;
 // The default setting for this threshold is 4000000 (which for instance corresponds to a matrix
 // size of \f$ 2000 \times 2000 \f$).
 */
-const size_t TDVECTDMATMULT_THRESHOLD = 4000000UL;
+#ifndef BLAZE_TDVECTDMATMULT_THRESHOLD
+#define BLAZE_TDVECTDMATMULT_THRESHOLD 4000000UL
+#endif
 //*************************************************************************************************
 
 
@@ -122,7 +164,9 @@ const size_t TDVECTDMATMULT_THRESHOLD = 4000000UL;
 // The default setting for this threshold is 10000 (which for instance corresponds to a matrix
 // size of \f$ 100 \times 100 \f$).
 */
-const size_t DMATDMATMULT_THRESHOLD = 10000UL;
+#ifndef BLAZE_DMATDMATMULT_THRESHOLD
+#define BLAZE_DMATDMATMULT_THRESHOLD 10000UL
+#endif
 //*************************************************************************************************
 
 
@@ -139,7 +183,9 @@ const size_t DMATDMATMULT_THRESHOLD = 10000UL;
 // The default setting for this threshold is 10000 (which for instance corresponds to a matrix
 // size of \f$ 100 \times 100 \f$).
 */
-const size_t DMATTDMATMULT_THRESHOLD = 10000UL;
+#ifndef BLAZE_DMATTDMATMULT_THRESHOLD
+#define BLAZE_DMATTDMATMULT_THRESHOLD 10000UL
+#endif
 //*************************************************************************************************
 
 
@@ -156,7 +202,9 @@ const size_t DMATTDMATMULT_THRESHOLD = 10000UL;
 // The default setting for this threshold is 10000 (which for instance corresponds to a matrix
 // size of \f$ 100 \times 100 \f$).
 */
-const size_t TDMATDMATMULT_THRESHOLD = 10000UL;
+#ifndef BLAZE_TDMATDMATMULT_THRESHOLD
+#define BLAZE_TDMATDMATMULT_THRESHOLD 10000UL
+#endif
 //*************************************************************************************************
 
 
@@ -173,7 +221,9 @@ const size_t TDMATDMATMULT_THRESHOLD = 10000UL;
 // The default setting for this threshold is 10000 (which for instance corresponds to a matrix
 // size of \f$ 100 \times 100 \f$).
 */
-const size_t TDMATTDMATMULT_THRESHOLD = 10000UL;
+#ifndef BLAZE_TDMATTDMATMULT_THRESHOLD
+#define BLAZE_TDMATTDMATMULT_THRESHOLD 10000UL
+#endif
 //*************************************************************************************************
 
 
@@ -204,7 +254,9 @@ const size_t TDMATTDMATMULT_THRESHOLD = 10000UL;
 // The default setting for this threshold is 38000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECASSIGN_THRESHOLD = 38000UL;
+#ifndef BLAZE_SMP_DVECASSIGN_THRESHOLD
+#define BLAZE_SMP_DVECASSIGN_THRESHOLD 38000UL
+#endif
 //*************************************************************************************************
 
 
@@ -227,7 +279,9 @@ const size_t SMP_DVECASSIGN_THRESHOLD = 38000UL;
 // The default setting for this threshold is 38000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECDVECADD_THRESHOLD = 38000UL;
+#ifndef BLAZE_SMP_DVECDVECADD_THRESHOLD
+#define BLAZE_SMP_DVECDVECADD_THRESHOLD 38000UL
+#endif
 //*************************************************************************************************
 
 
@@ -250,7 +304,9 @@ const size_t SMP_DVECDVECADD_THRESHOLD = 38000UL;
 // The default setting for this threshold is 38000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECDVECSUB_THRESHOLD = 38000UL;
+#ifndef BLAZE_SMP_DVECDVECSUB_THRESHOLD
+#define BLAZE_SMP_DVECDVECSUB_THRESHOLD 38000UL
+#endif
 //*************************************************************************************************
 
 
@@ -273,7 +329,9 @@ const size_t SMP_DVECDVECSUB_THRESHOLD = 38000UL;
 // The default setting for this threshold is 38000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECDVECMULT_THRESHOLD = 38000UL;
+#ifndef BLAZE_SMP_DVECDVECMULT_THRESHOLD
+#define BLAZE_SMP_DVECDVECMULT_THRESHOLD 38000UL
+#endif
 //*************************************************************************************************
 
 
@@ -296,7 +354,9 @@ const size_t SMP_DVECDVECMULT_THRESHOLD = 38000UL;
 // The default setting for this threshold is 51000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECSCALARMULT_THRESHOLD = 51000UL;
+#ifndef BLAZE_SMP_DVECSCALARMULT_THRESHOLD
+#define BLAZE_SMP_DVECSCALARMULT_THRESHOLD 51000UL
+#endif
 //*************************************************************************************************
 
 
@@ -319,7 +379,9 @@ const size_t SMP_DVECSCALARMULT_THRESHOLD = 51000UL;
 // The default setting for this threshold is 330. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATDVECMULT_THRESHOLD = 330UL;
+#ifndef BLAZE_SMP_DMATDVECMULT_THRESHOLD
+#define BLAZE_SMP_DMATDVECMULT_THRESHOLD 330UL
+#endif
 //*************************************************************************************************
 
 
@@ -342,7 +404,9 @@ const size_t SMP_DMATDVECMULT_THRESHOLD = 330UL;
 // The default setting for this threshold is 360. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATDVECMULT_THRESHOLD = 360UL;
+#ifndef BLAZE_SMP_TDMATDVECMULT_THRESHOLD
+#define BLAZE_SMP_TDMATDVECMULT_THRESHOLD 360UL
+#endif
 //*************************************************************************************************
 
 
@@ -365,7 +429,9 @@ const size_t SMP_TDMATDVECMULT_THRESHOLD = 360UL;
 // The default setting for this threshold is 370. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDVECDMATMULT_THRESHOLD = 370UL;
+#ifndef BLAZE_SMP_TDVECDMATMULT_THRESHOLD
+#define BLAZE_SMP_TDVECDMATMULT_THRESHOLD 370UL
+#endif
 //*************************************************************************************************
 
 
@@ -388,7 +454,9 @@ const size_t SMP_TDVECDMATMULT_THRESHOLD = 370UL;
 // The default setting for this threshold is 340. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDVECTDMATMULT_THRESHOLD = 340UL;
+#ifndef BLAZE_SMP_TDVECTDMATMULT_THRESHOLD
+#define BLAZE_SMP_TDVECTDMATMULT_THRESHOLD 340UL
+#endif
 //*************************************************************************************************
 
 
@@ -411,7 +479,9 @@ const size_t SMP_TDVECTDMATMULT_THRESHOLD = 340UL;
 // The default setting for this threshold is 480. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATSVECMULT_THRESHOLD = 480UL;
+#ifndef BLAZE_SMP_DMATSVECMULT_THRESHOLD
+#define BLAZE_SMP_DMATSVECMULT_THRESHOLD 480UL
+#endif
 //*************************************************************************************************
 
 
@@ -434,7 +504,9 @@ const size_t SMP_DMATSVECMULT_THRESHOLD = 480UL;
 // The default setting for this threshold is 910. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATSVECMULT_THRESHOLD = 910UL;
+#ifndef BLAZE_SMP_TDMATSVECMULT_THRESHOLD
+#define BLAZE_SMP_TDMATSVECMULT_THRESHOLD 910UL
+#endif
 //*************************************************************************************************
 
 
@@ -457,7 +529,9 @@ const size_t SMP_TDMATSVECMULT_THRESHOLD = 910UL;
 // The default setting for this threshold is 910. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSVECDMATMULT_THRESHOLD = 910UL;
+#ifndef BLAZE_SMP_TSVECDMATMULT_THRESHOLD
+#define BLAZE_SMP_TSVECDMATMULT_THRESHOLD 910UL
+#endif
 //*************************************************************************************************
 
 
@@ -480,7 +554,9 @@ const size_t SMP_TSVECDMATMULT_THRESHOLD = 910UL;
 // The default setting for this threshold is 480. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSVECTDMATMULT_THRESHOLD = 480UL;
+#ifndef BLAZE_SMP_TSVECTDMATMULT_THRESHOLD
+#define BLAZE_SMP_TSVECTDMATMULT_THRESHOLD 480UL
+#endif
 //*************************************************************************************************
 
 
@@ -503,7 +579,9 @@ const size_t SMP_TSVECTDMATMULT_THRESHOLD = 480UL;
 // The default setting for this threshold is 600. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATDVECMULT_THRESHOLD = 600UL;
+#ifndef BLAZE_SMP_SMATDVECMULT_THRESHOLD
+#define BLAZE_SMP_SMATDVECMULT_THRESHOLD 600UL
+#endif
 //*************************************************************************************************
 
 
@@ -526,7 +604,32 @@ const size_t SMP_SMATDVECMULT_THRESHOLD = 600UL;
 // The default setting for this threshold is 1250. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATDVECMULT_THRESHOLD = 1250UL;
+#ifndef BLAZE_SMP_TSMATDVECMULT_THRESHOLD
+#define BLAZE_SMP_TSMATDVECMULT_THRESHOLD 1250UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP block-compressed sparse matrix/dense vector multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a block-compressed sparse matrix/dense vector multiplication can
+// be executed in parallel. In case the number of elements of the target vector is larger or equal
+// to this threshold, the operation is executed in parallel. If the number of elements is below
+// this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 600. In case the threshold is set to 0, the operation
+// is unconditionally executed in parallel.
+*/
+#ifndef BLAZE_SMP_BSMATDVECMULT_THRESHOLD
+#define BLAZE_SMP_BSMATDVECMULT_THRESHOLD 600UL
+#endif
 //*************************************************************************************************
 
 
@@ -549,7 +652,9 @@ const size_t SMP_TSMATDVECMULT_THRESHOLD = 1250UL;
 // The default setting for this threshold is 1190. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDVECSMATMULT_THRESHOLD = 1190UL;
+#ifndef BLAZE_SMP_TDVECSMATMULT_THRESHOLD
+#define BLAZE_SMP_TDVECSMATMULT_THRESHOLD 1190UL
+#endif
 //*************************************************************************************************
 
 
@@ -572,7 +677,9 @@ const size_t SMP_TDVECSMATMULT_THRESHOLD = 1190UL;
 // The default setting for this threshold is 530. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDVECTSMATMULT_THRESHOLD = 530UL;
+#ifndef BLAZE_SMP_TDVECTSMATMULT_THRESHOLD
+#define BLAZE_SMP_TDVECTSMATMULT_THRESHOLD 530UL
+#endif
 //*************************************************************************************************
 
 
@@ -595,7 +702,9 @@ const size_t SMP_TDVECTSMATMULT_THRESHOLD = 530UL;
 // The default setting for this threshold is 260. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATSVECMULT_THRESHOLD = 260UL;
+#ifndef BLAZE_SMP_SMATSVECMULT_THRESHOLD
+#define BLAZE_SMP_SMATSVECMULT_THRESHOLD 260UL
+#endif
 //*************************************************************************************************
 
 
@@ -618,7 +727,9 @@ const size_t SMP_SMATSVECMULT_THRESHOLD = 260UL;
 // The default setting for this threshold is 2160. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATSVECMULT_THRESHOLD = 2160UL;
+#ifndef BLAZE_SMP_TSMATSVECMULT_THRESHOLD
+#define BLAZE_SMP_TSMATSVECMULT_THRESHOLD 2160UL
+#endif
 //*************************************************************************************************
 
 
@@ -641,7 +752,9 @@ const size_t SMP_TSMATSVECMULT_THRESHOLD = 2160UL;
 // The default setting for this threshold is 2160. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSVECSMATMULT_THRESHOLD = 2160UL;
+#ifndef BLAZE_SMP_TSVECSMATMULT_THRESHOLD
+#define BLAZE_SMP_TSVECSMATMULT_THRESHOLD 2160UL
+#endif
 //*************************************************************************************************
 
 
@@ -664,7 +777,9 @@ const size_t SMP_TSVECSMATMULT_THRESHOLD = 2160UL;
 // The default setting for this threshold is 260. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSVECTSMATMULT_THRESHOLD = 260UL;
+#ifndef BLAZE_SMP_TSVECTSMATMULT_THRESHOLD
+#define BLAZE_SMP_TSVECTSMATMULT_THRESHOLD 260UL
+#endif
 //*************************************************************************************************
 
 
@@ -687,7 +802,9 @@ const size_t SMP_TSVECTSMATMULT_THRESHOLD = 260UL;
 // The default setting for this threshold is 220. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATASSIGN_THRESHOLD = 220UL;
+#ifndef BLAZE_SMP_DMATASSIGN_THRESHOLD
+#define BLAZE_SMP_DMATASSIGN_THRESHOLD 220UL
+#endif
 //*************************************************************************************************
 
 
@@ -711,7 +828,9 @@ const size_t SMP_DMATASSIGN_THRESHOLD = 220UL;
 // The default setting for this threshold is 190. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATDMATADD_THRESHOLD = 190UL;
+#ifndef BLAZE_SMP_DMATDMATADD_THRESHOLD
+#define BLAZE_SMP_DMATDMATADD_THRESHOLD 190UL
+#endif
 //*************************************************************************************************
 
 
@@ -736,7 +855,9 @@ const size_t SMP_DMATDMATADD_THRESHOLD = 190UL;
 // The default setting for this threshold is 175. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATTDMATADD_THRESHOLD = 175UL;
+#ifndef BLAZE_SMP_DMATTDMATADD_THRESHOLD
+#define BLAZE_SMP_DMATTDMATADD_THRESHOLD 175UL
+#endif
 //*************************************************************************************************
 
 
@@ -760,7 +881,9 @@ const size_t SMP_DMATTDMATADD_THRESHOLD = 175UL;
 // The default setting for this threshold is 190. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATDMATSUB_THRESHOLD = 190UL;
+#ifndef BLAZE_SMP_DMATDMATSUB_THRESHOLD
+#define BLAZE_SMP_DMATDMATSUB_THRESHOLD 190UL
+#endif
 //*************************************************************************************************
 
 
@@ -785,7 +908,9 @@ const size_t SMP_DMATDMATSUB_THRESHOLD = 190UL;
 // The default setting for this threshold is 175. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATTDMATSUB_THRESHOLD = 175UL;
+#ifndef BLAZE_SMP_DMATTDMATSUB_THRESHOLD
+#define BLAZE_SMP_DMATTDMATSUB_THRESHOLD 175UL
+#endif
 //*************************************************************************************************
 
 
@@ -808,7 +933,9 @@ const size_t SMP_DMATTDMATSUB_THRESHOLD = 175UL;
 // The default setting for this threshold is 220. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATSCALARMULT_THRESHOLD = 220UL;
+#ifndef BLAZE_SMP_DMATSCALARMULT_THRESHOLD
+#define BLAZE_SMP_DMATSCALARMULT_THRESHOLD 220UL
+#endif
 //*************************************************************************************************
 
 
@@ -831,7 +958,9 @@ const size_t SMP_DMATSCALARMULT_THRESHOLD = 220UL;
 // The default setting for this threshold is 55. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATDMATMULT_THRESHOLD = 55UL;
+#ifndef BLAZE_SMP_DMATDMATMULT_THRESHOLD
+#define BLAZE_SMP_DMATDMATMULT_THRESHOLD 55UL
+#endif
 //*************************************************************************************************
 
 
@@ -854,7 +983,9 @@ const size_t SMP_DMATDMATMULT_THRESHOLD = 55UL;
 // The default setting for this threshold is 55. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATTDMATMULT_THRESHOLD = 55UL;
+#ifndef BLAZE_SMP_DMATTDMATMULT_THRESHOLD
+#define BLAZE_SMP_DMATTDMATMULT_THRESHOLD 55UL
+#endif
 //*************************************************************************************************
 
 
@@ -877,7 +1008,9 @@ const size_t SMP_DMATTDMATMULT_THRESHOLD = 55UL;
 // The default setting for this threshold is 55. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATDMATMULT_THRESHOLD = 55UL;
+#ifndef BLAZE_SMP_TDMATDMATMULT_THRESHOLD
+#define BLAZE_SMP_TDMATDMATMULT_THRESHOLD 55UL
+#endif
 //*************************************************************************************************
 
 
@@ -900,7 +1033,9 @@ const size_t SMP_TDMATDMATMULT_THRESHOLD = 55UL;
 // The default setting for this threshold is 55. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATTDMATMULT_THRESHOLD = 55UL;
+#ifndef BLAZE_SMP_TDMATTDMATMULT_THRESHOLD
+#define BLAZE_SMP_TDMATTDMATMULT_THRESHOLD 55UL
+#endif
 //*************************************************************************************************
 
 
@@ -923,7 +1058,9 @@ const size_t SMP_TDMATTDMATMULT_THRESHOLD = 55UL;
 // The default setting for this threshold is 64. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATSMATMULT_THRESHOLD = 64UL;
+#ifndef BLAZE_SMP_DMATSMATMULT_THRESHOLD
+#define BLAZE_SMP_DMATSMATMULT_THRESHOLD 64UL
+#endif
 //*************************************************************************************************
 
 
@@ -946,7 +1083,9 @@ const size_t SMP_DMATSMATMULT_THRESHOLD = 64UL;
 // The default setting for this threshold is 68. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATTSMATMULT_THRESHOLD = 68UL;
+#ifndef BLAZE_SMP_DMATTSMATMULT_THRESHOLD
+#define BLAZE_SMP_DMATTSMATMULT_THRESHOLD 68UL
+#endif
 //*************************************************************************************************
 
 
@@ -969,7 +1108,9 @@ const size_t SMP_DMATTSMATMULT_THRESHOLD = 68UL;
 // The default setting for this threshold is 90. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATSMATMULT_THRESHOLD = 90UL;
+#ifndef BLAZE_SMP_TDMATSMATMULT_THRESHOLD
+#define BLAZE_SMP_TDMATSMATMULT_THRESHOLD 90UL
+#endif
 //*************************************************************************************************
 
 
@@ -992,7 +1133,9 @@ const size_t SMP_TDMATSMATMULT_THRESHOLD = 90UL;
 // The default setting for this threshold is 90. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATTSMATMULT_THRESHOLD = 90UL;
+#ifndef BLAZE_SMP_TDMATTSMATMULT_THRESHOLD
+#define BLAZE_SMP_TDMATTSMATMULT_THRESHOLD 90UL
+#endif
 //*************************************************************************************************
 
 
@@ -1015,7 +1158,32 @@ const size_t SMP_TDMATTSMATMULT_THRESHOLD = 90UL;
 // The default setting for this threshold is 88. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATDMATMULT_THRESHOLD = 88UL;
+#ifndef BLAZE_SMP_SMATDMATMULT_THRESHOLD
+#define BLAZE_SMP_SMATDMATMULT_THRESHOLD 88UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP block-compressed sparse matrix/row-major dense matrix multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a block-compressed sparse matrix/row-major dense matrix
+// multiplication can be executed in parallel. In case the number of rows of the target matrix
+// is larger or equal to this threshold, the operation is executed in parallel. If the number of
+// rows is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 88. In case the threshold is set to 0, the operation
+// is unconditionally executed in parallel.
+*/
+#ifndef BLAZE_SMP_BSMATDMATMULT_THRESHOLD
+#define BLAZE_SMP_BSMATDMATMULT_THRESHOLD 88UL
+#endif
 //*************************************************************************************************
 
 
@@ -1038,7 +1206,9 @@ const size_t SMP_SMATDMATMULT_THRESHOLD = 88UL;
 // The default setting for this threshold is 72. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATTDMATMULT_THRESHOLD = 72UL;
+#ifndef BLAZE_SMP_SMATTDMATMULT_THRESHOLD
+#define BLAZE_SMP_SMATTDMATMULT_THRESHOLD 72UL
+#endif
 //*************************************************************************************************
 
 
@@ -1061,7 +1231,9 @@ const size_t SMP_SMATTDMATMULT_THRESHOLD = 72UL;
 // The default setting for this threshold is 66. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATDMATMULT_THRESHOLD = 66UL;
+#ifndef BLAZE_SMP_TSMATDMATMULT_THRESHOLD
+#define BLAZE_SMP_TSMATDMATMULT_THRESHOLD 66UL
+#endif
 //*************************************************************************************************
 
 
@@ -1084,7 +1256,9 @@ const size_t SMP_TSMATDMATMULT_THRESHOLD = 66UL;
 // The default setting for this threshold is 66. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATTDMATMULT_THRESHOLD = 66UL;
+#ifndef BLAZE_SMP_TSMATTDMATMULT_THRESHOLD
+#define BLAZE_SMP_TSMATTDMATMULT_THRESHOLD 66UL
+#endif
 //*************************************************************************************************
 
 
@@ -1107,7 +1281,9 @@ const size_t SMP_TSMATTDMATMULT_THRESHOLD = 66UL;
 // The default setting for this threshold is 150. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATSMATMULT_THRESHOLD = 150UL;
+#ifndef BLAZE_SMP_SMATSMATMULT_THRESHOLD
+#define BLAZE_SMP_SMATSMATMULT_THRESHOLD 150UL
+#endif
 //*************************************************************************************************
 
 
@@ -1130,7 +1306,9 @@ const size_t SMP_SMATSMATMULT_THRESHOLD = 150UL;
 // The default setting for this threshold is 140. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATTSMATMULT_THRESHOLD = 140UL;
+#ifndef BLAZE_SMP_SMATTSMATMULT_THRESHOLD
+#define BLAZE_SMP_SMATTSMATMULT_THRESHOLD 140UL
+#endif
 //*************************************************************************************************
 
 
@@ -1153,7 +1331,9 @@ const size_t SMP_SMATTSMATMULT_THRESHOLD = 140UL;
 // The default setting for this threshold is 140. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATSMATMULT_THRESHOLD = 140UL;
+#ifndef BLAZE_SMP_TSMATSMATMULT_THRESHOLD
+#define BLAZE_SMP_TSMATSMATMULT_THRESHOLD 140UL
+#endif
 //*************************************************************************************************
 
 
@@ -1176,7 +1356,9 @@ const size_t SMP_TSMATSMATMULT_THRESHOLD = 140UL;
 // The default setting for this threshold is 150. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
+#ifndef BLAZE_SMP_TSMATTSMATMULT_THRESHOLD
+#define BLAZE_SMP_TSMATTSMATMULT_THRESHOLD 150UL
+#endif
 //*************************************************************************************************
 
 
@@ -1199,7 +1381,111 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 // The default setting for this threshold is 290. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DVECTDVECMULT_THRESHOLD = 290UL;
+#ifndef BLAZE_SMP_DVECTDVECMULT_THRESHOLD
+#define BLAZE_SMP_DVECTDVECMULT_THRESHOLD 290UL
+#endif
 //*************************************************************************************************
 
-} // namespace blaze
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix storage order conversion threshold.
+// \ingroup config
+//
+// This threshold specifies when the conversion of a sparse matrix to a CompressedMatrix with
+// opposite storage order (as for instance in the assignment of a column-major sparse matrix to
+// a row-major compressed matrix or in the evaluation of a transpose operation) can be executed
+// in parallel. In contrast to the other thresholds, this threshold refers to the number of
+// non-zero elements of the sparse matrix to be converted. In case the number of non-zero
+// elements is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of non-zero elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 100000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+#ifndef BLAZE_SMP_SMATCONVERSION_THRESHOLD
+#define BLAZE_SMP_SMATCONVERSION_THRESHOLD 100000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP projected Gauss-Seidel sweep threshold.
+// \ingroup config
+//
+// This threshold specifies when the sweeps of the colored and the Jacobi variants of the
+// projected Gauss-Seidel solver (see the PGS class) can be executed in parallel. The threshold
+// refers to the number of unknowns that are updated concurrently, i.e. the number of unknowns
+// of a single color or of the entire problem, respectively. In case the number of unknowns is
+// larger or equal to this threshold, the sweep is executed in parallel. If the number of unknowns
+// is below this threshold the sweep is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 4000. In case the threshold is set to 0, the sweep
+// is unconditionally executed in parallel.
+*/
+#ifndef BLAZE_SMP_PGS_THRESHOLD
+#define BLAZE_SMP_PGS_THRESHOLD 4000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular substitution threshold.
+// \ingroup config
+//
+// This threshold specifies when a level-scheduled sparse triangular substitution (see the
+// LevelSchedule class) is executed in parallel. The threshold refers to the number of unknowns
+// that can be computed concurrently, i.e. the number of rows of the widest level times the
+// number of right-hand sides. In case the number of unknowns is larger or equal to this
+// threshold, the rows are processed by several threads that synchronize via per-row dependency
+// counters. If the number of unknowns is below this threshold the substitution is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 4000. In case the threshold is set to 0, every
+// level-scheduled substitution is unconditionally executed in parallel.
+*/
+#ifndef BLAZE_SMP_TRSV_THRESHOLD
+#define BLAZE_SMP_TRSV_THRESHOLD 4000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP supernodal Cholesky factorization threshold.
+// \ingroup config
+//
+// This threshold specifies when the supernodes of a single level of the supernodal elimination
+// tree of a sparse Cholesky factorization (see the SparseCholesky class) are processed in
+// parallel. The threshold refers to the number of stored elements of the factor within the
+// level, which for the forward and backward substitutions is multiplied by the number of
+// right-hand sides. In case this number is larger or equal to the threshold, the supernodes of
+// the level are processed in parallel. If the number is below this threshold the supernodes are
+// processed single-threaded, which allows the dense operations within the supernodes to be
+// executed in parallel.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 20000. In case the threshold is set to 0, every
+// level is unconditionally processed in parallel.
+*/
+#ifndef BLAZE_SMP_CHOLESKY_THRESHOLD
+#define BLAZE_SMP_CHOLESKY_THRESHOLD 20000UL
+#endif
+//*************************************************************************************************
@@ -0,0 +1,75 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/Accumulation.h
+//  \brief Header file for the accumulation schemes of deterministic reductions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ACCUMULATION_H_
+#define _BLAZE_MATH_ACCUMULATION_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ACCUMULATION TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Accumulation schemes for the summation within deterministic reductions.
+//
+// The Accumulation enumeration lists the available schemes for the summation of the elements
+// within a single block of a deterministic reduction (see \c SMP_DETERMINISTIC_REDUCTION):
+//
+//  - \a plainAccumulation: The elements are summed up in sequential (or vectorized) order. This
+//    is the fastest scheme, the error bound grows linearly with the number of elements.
+//  - \a pairwiseAccumulation: The elements are summed up in a binary tree. The error bound grows
+//    logarithmically with the number of elements.
+//  - \a compensatedAccumulation: The elements are summed up with a running compensation of the
+//    rounding error (Kahan-Babuska-Neumaier summation). The error bound is independent of the
+//    number of elements, but the summation is about four times as expensive.
+//
+// Note that the pairwise and the compensated scheme are applied element by element, i.e. they
+// are not vectorized. Also note that both schemes only apply to numeric element types, for all
+// other element types the plain scheme is used.
+*/
+enum Accumulation
+{
+   plainAccumulation       = 0,  //!< Sequential (or vectorized) summation.
+   pairwiseAccumulation    = 1,  //!< Pairwise (cascade) summation.
+   compensatedAccumulation = 2   //!< Compensated (Kahan-Babuska-Neumaier) summation.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,9 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/smp/Async.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/DenseVector.h>
 #include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/smp/SparseVector.h>
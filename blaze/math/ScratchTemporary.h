@@ -0,0 +1,114 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ScratchTemporary.h
+//  \brief Header file for the ScratchTemporary class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SCRATCHTEMPORARY_H_
+#define _BLAZE_MATH_SCRATCHTEMPORARY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/typetraits/IsScratchAllocatable.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/ScratchArena.h>
+#include <blaze/util/typetraits/IsConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Placement of the next temporary in the thread-local scratch arena.
+// \ingroup math
+//
+// The ScratchTemporary class template requests the elements of the next temporary of type \a T
+// constructed by the calling thread to be placed in the thread-local scratch arena (see the
+// ScratchArena class template) instead of dynamically allocated memory. It has to be declared
+// directly in front of the temporary:
+
+   \code
+   const ScratchTemporary<LT> scratchA;
+   LT A( serial( rhs.lhs_ ) );  // Placed in the scratch arena in case LT is a temporary
+   \endcode
+
+// The request only affects the memory allocated by the constructor of the temporary itself, not
+// the memory of any other object constructed during its evaluation. In case \a T cannot be
+// allocated from the scratch arena (see the IsScratchAllocatable type trait) or in case \a T is
+// not a const type, i.e. the temporary might be resized or swapped, the class has no effect.
+// Since the temporaries of a function are destroyed in reverse order of their construction,
+// the arena is used in a strictly stack-like fashion.
+*/
+template< typename T >  // Type of the temporary
+class ScratchTemporary : private NonCopyable
+{
+ private:
+   //**********************************************************************************************
+   /*! Compilation switch for the placement in the scratch arena. */
+   enum { useArena = IsScratchAllocatable<T>::value && IsConst<T>::value };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Requests the placement of the next temporary in the scratch arena.
+   */
+   explicit inline ScratchTemporary()
+   {
+      if( useArena )
+         TheScratchArena::arm();
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Withdraws an unconsumed request (for instance in case of an exception).
+   */
+   inline ~ScratchTemporary()
+   {
+      if( useArena )
+         TheScratchArena::disarm();
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
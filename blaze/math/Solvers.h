@@ -40,10 +40,19 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/solvers/BasisFactorization.h>
+#include <blaze/math/solvers/BatchSolver.h>
 #include <blaze/math/solvers/CG.h>
 #include <blaze/math/solvers/CPG.h>
 #include <blaze/math/solvers/GaussianElimination.h>
+#include <blaze/math/solvers/IC0Preconditioner.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/ILU0Preconditioner.h>
+#include <blaze/math/solvers/ILUTPreconditioner.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
 #include <blaze/math/solvers/Lemke.h>
 #include <blaze/math/solvers/PGS.h>
+#include <blaze/math/solvers/SparseCholesky.h>
+#include <blaze/math/solvers/SSORPreconditioner.h>
 
 #endif
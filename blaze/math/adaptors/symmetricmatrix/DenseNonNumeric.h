@@ -2169,19 +2169,19 @@ inline void SymmetricMatrix<MT,SO,true,false>::assign( const SparseMatrix<MT2,SO
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   typedef typename MT2::ConstIterator  ConstIterator;
+   typedef typename MT2::ConstIterator  RhsIterator;
 
    if( SO ) {
       for( size_t j=0UL; j<columns(); ++j ) {
-         const ConstIterator last( (~rhs).upperBound(j,j) );
-         for( ConstIterator element=(~rhs).begin(j); element!=last; ++element )
+         const RhsIterator last( (~rhs).upperBound(j,j) );
+         for( RhsIterator element=(~rhs).begin(j); element!=last; ++element )
             matrix_(element->index(),j) = element->value();
       }
    }
    else {
       for( size_t i=0UL; i<rows(); ++i ) {
-         const ConstIterator last( (~rhs).upperBound(i,i) );
-         for( ConstIterator element=(~rhs).begin(i); element!=last; ++element )
+         const RhsIterator last( (~rhs).upperBound(i,i) );
+         for( RhsIterator element=(~rhs).begin(i); element!=last; ++element )
             matrix_(i,element->index()) = element->value();
       }
    }
@@ -2245,19 +2245,19 @@ inline void SymmetricMatrix<MT,SO,true,false>::addAssign( const SparseMatrix<MT2
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   typedef typename MT2::ConstIterator  ConstIterator;
+   typedef typename MT2::ConstIterator  RhsIterator;
 
    if( SO ) {
       for( size_t j=0UL; j<columns(); ++j ) {
-         const ConstIterator last( (~rhs).upperBound(j,j) );
-         for( ConstIterator element=(~rhs).begin(j); element!=last; ++element )
+         const RhsIterator last( (~rhs).upperBound(j,j) );
+         for( RhsIterator element=(~rhs).begin(j); element!=last; ++element )
             matrix_(element->index(),j) += element->value();
       }
    }
    else {
       for( size_t i=0UL; i<rows(); ++i ) {
-         const ConstIterator last( (~rhs).upperBound(i,i) );
-         for( ConstIterator element=(~rhs).begin(i); element!=last; ++element )
+         const RhsIterator last( (~rhs).upperBound(i,i) );
+         for( RhsIterator element=(~rhs).begin(i); element!=last; ++element )
             matrix_(i,element->index()) += element->value();
       }
    }
@@ -2321,19 +2321,19 @@ inline void SymmetricMatrix<MT,SO,true,false>::subAssign( const SparseMatrix<MT2
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   typedef typename MT2::ConstIterator  ConstIterator;
+   typedef typename MT2::ConstIterator  RhsIterator;
 
    if( SO ) {
       for( size_t j=0UL; j<columns(); ++j ) {
-         const ConstIterator last( (~rhs).upperBound(j,j) );
-         for( ConstIterator element=(~rhs).begin(j); element!=last; ++element )
+         const RhsIterator last( (~rhs).upperBound(j,j) );
+         for( RhsIterator element=(~rhs).begin(j); element!=last; ++element )
             matrix_(element->index(),j) -= element->value();
       }
    }
    else {
       for( size_t i=0UL; i<rows(); ++i ) {
-         const ConstIterator last( (~rhs).upperBound(i,i) );
-         for( ConstIterator element=(~rhs).begin(i); element!=last; ++element )
+         const RhsIterator last( (~rhs).upperBound(i,i) );
+         for( RhsIterator element=(~rhs).begin(i); element!=last; ++element )
             matrix_(i,element->index()) -= element->value();
       }
    }
@@ -89,7 +89,7 @@ template<> struct CONSTRAINT_MUST_HAVE_EQUAL_NUMBER_OF_COLUMNS_FAILED<true> { en
                      , blaze::Equal< blaze::Columns<T2>, blaze::SizeT<0UL> > \
                      , blaze::Equal< blaze::Columns<T1>, blaze::Columns<T2> > \
                      >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_EQUAL_NUMBER_OF_COLUMNS_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_EQUAL_NUMBER_OF_COLUMNS_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -134,7 +134,7 @@ template<> struct CONSTRAINT_MUST_NOT_HAVE_EQUAL_NUMBER_OF_COLUMNS_FAILED<true>
                      , blaze::Equal< blaze::Columns<T2>, blaze::SizeT<0UL> > \
                      , blaze::Not< blaze::Equal< blaze::Columns<T1>, blaze::Columns<T2> > > \
                      >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_HAVE_EQUAL_NUMBER_OF_COLUMNS_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_HAVE_EQUAL_NUMBER_OF_COLUMNS_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -80,7 +80,7 @@ template<> struct CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE_FAILED<true> { enum { val
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE_FAILED< blaze::IsDenseVector<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -119,7 +119,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_DENSE_VECTOR_TYPE_FAILED<true> { enum {
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_BE_DENSE_VECTOR_TYPE_FAILED< !blaze::IsDenseVector<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_DENSE_VECTOR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_DENSE_VECTOR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -88,7 +88,7 @@ template<> struct CONSTRAINT_MUST_BE_MATMATADDEXPR_TYPE_FAILED<true> { enum { va
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_BE_MATMATADDEXPR_TYPE_FAILED< blaze::IsMatMatAddExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_MATMATADDEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_MATMATADDEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -127,7 +127,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_MATMATADDEXPR_TYPE_FAILED<true> { enum
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_BE_MATMATADDEXPR_TYPE_FAILED< !blaze::IsMatMatAddExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_MATMATADDEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_MATMATADDEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -175,7 +175,7 @@ template<> struct CONSTRAINT_MUST_FORM_VALID_MATMATADDEXPR_FAILED<true> { enum {
                                  , blaze::Equal< blaze::Columns<T2>, blaze::SizeT<0UL> > \
                                  , blaze::Equal< blaze::Columns<T1>, blaze::Columns<T2> > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_MATMATADDEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_MATMATADDEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -223,7 +223,7 @@ template<> struct CONSTRAINT_MUST_NOT_FORM_VALID_MATMATADDEXPR_FAILED<true> { en
                                              , blaze::Equal< blaze::Columns<T2>, blaze::SizeT<0UL> > \
                                              , blaze::Equal< blaze::Columns<T1>, blaze::Columns<T2> > > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_MATMATADDEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_MATMATADDEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
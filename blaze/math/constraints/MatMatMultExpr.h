@@ -88,7 +88,7 @@ template<> struct CONSTRAINT_MUST_BE_MATMATMULTEXPR_TYPE_FAILED<true> { enum { v
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_BE_MATMATMULTEXPR_TYPE_FAILED< blaze::IsMatMatMultExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_MATMATMULTEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_MATMATMULTEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -127,7 +127,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_MATMATMULTEXPR_TYPE_FAILED<true> { enum
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_BE_MATMATMULTEXPR_TYPE_FAILED< !blaze::IsMatMatMultExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_MATMATMULTEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_MATMATMULTEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -172,7 +172,7 @@ template<> struct CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR_FAILED<true> { enum
                                  , blaze::Equal< blaze::Rows<T2>, blaze::SizeT<0UL> > \
                                  , blaze::Equal< blaze::Columns<T1>, blaze::Rows<T2> > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -217,7 +217,7 @@ template<> struct CONSTRAINT_MUST_NOT_FORM_VALID_MATMATMULTEXPR_FAILED<true> { e
                                              , blaze::Equal< blaze::Rows<T2>, blaze::SizeT<0UL> > \
                                              , blaze::Equal< blaze::Columns<T1>, blaze::Rows<T2> > > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_MATMATMULTEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_MATMATMULTEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
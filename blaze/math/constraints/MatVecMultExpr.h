@@ -89,7 +89,7 @@ template<> struct CONSTRAINT_MUST_BE_MATVECMULTEXPR_TYPE_FAILED<true> { enum { v
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_BE_MATVECMULTEXPR_TYPE_FAILED< blaze::IsMatVecMultExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_MATVECMULTEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_MATVECMULTEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -128,7 +128,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_MATVECMULTEXPR_TYPE_FAILED<true> { enum
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_BE_MATVECMULTEXPR_TYPE_FAILED< !blaze::IsMatVecMultExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_MATVECMULTEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_MATVECMULTEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -173,7 +173,7 @@ template<> struct CONSTRAINT_MUST_FORM_VALID_MATVECMULTEXPR_FAILED<true> { enum
                                  , blaze::Equal< blaze::Size<T2>, blaze::SizeT<0UL> > \
                                  , blaze::Equal< blaze::Columns<T1>, blaze::Size<T2> > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_MATVECMULTEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_MATVECMULTEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -218,7 +218,7 @@ template<> struct CONSTRAINT_MUST_NOT_FORM_VALID_MATVECMULTEXPR_FAILED<true> { e
                                              , blaze::Equal< blaze::Size<T2>, blaze::SizeT<0UL> > \
                                              , blaze::Equal< blaze::Columns<T1>, blaze::Size<T2> > > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_MATVECMULTEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_MATVECMULTEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -80,7 +80,7 @@ template<> struct CONSTRAINT_MUST_REQUIRE_EVALUATION_FAILED<true> { enum { value
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_REQUIRE_EVALUATION_FAILED< blaze::RequiresEvaluation<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_REQUIRE_EVALUATION_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_REQUIRE_EVALUATION_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -119,7 +119,7 @@ template<> struct CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION_FAILED<true> { enum { v
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION_FAILED< !blaze::RequiresEvaluation<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
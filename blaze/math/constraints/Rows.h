@@ -89,7 +89,7 @@ template<> struct CONSTRAINT_MUST_HAVE_EQUAL_NUMBER_OF_ROWS_FAILED<true> { enum
                      , blaze::Equal< blaze::Rows<T2>, blaze::SizeT<0UL> > \
                      , blaze::Equal< blaze::Rows<T1>, blaze::Rows<T2> > \
                      >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_EQUAL_NUMBER_OF_ROWS_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_EQUAL_NUMBER_OF_ROWS_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -134,7 +134,7 @@ template<> struct CONSTRAINT_MUST_NOT_HAVE_EQUAL_NUMBER_OF_ROWS_FAILED<true> { e
                      , blaze::Equal< blaze::Rows<T2>, blaze::SizeT<0UL> > \
                      , blaze::Not< blaze::Equal< blaze::Rows<T1>, blaze::Rows<T2> > > \
                      >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_HAVE_EQUAL_NUMBER_OF_ROWS_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_HAVE_EQUAL_NUMBER_OF_ROWS_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -90,7 +90,7 @@ template<> struct CONSTRAINT_MUST_HAVE_EQUAL_SIZE_FAILED<true> { enum { value =
                      , blaze::Equal< blaze::Size<T2>, blaze::SizeT<0UL> > \
                      , blaze::Equal< blaze::Size<T1>, blaze::Size<T2> > \
                      >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_EQUAL_SIZE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_EQUAL_SIZE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -135,7 +135,7 @@ template<> struct CONSTRAINT_MUST_NOT_HAVE_EQUAL_SIZE_FAILED<true> { enum { valu
                      , blaze::Equal< blaze::Size<T2>, blaze::SizeT<0UL> > \
                      , blaze::Not< blaze::Equal< blaze::Size<T1>, blaze::Size<T2> > > \
                      >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_EQUAL_SIZE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_EQUAL_SIZE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -79,7 +79,7 @@ template<> struct CONSTRAINT_MUST_BE_SYMMETRIC_MATRIX_TYPE_FAILED<true> { enum {
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_BE_SYMMETRIC_MATRIX_TYPE_FAILED< blaze::IsSymmetric<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_SYMMETRIC_MATRIX_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_SYMMETRIC_MATRIX_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -117,7 +117,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE_FAILED<true> { en
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE_FAILED< !blaze::IsSymmetric<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
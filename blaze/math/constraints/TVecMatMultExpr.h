@@ -89,7 +89,7 @@ template<> struct CONSTRAINT_MUST_BE_TVECMATMULTEXPR_TYPE_FAILED<true> { enum {
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_BE_TVECMATMULTEXPR_TYPE_FAILED< blaze::IsTVecMatMultExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_TVECMATMULTEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_TVECMATMULTEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -128,7 +128,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_TVECMATMULTEXPR_TYPE_FAILED<true> { enu
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_BE_TVECMATMULTEXPR_TYPE_FAILED< !blaze::IsTVecMatMultExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_TVECMATMULTEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_TVECMATMULTEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -173,7 +173,7 @@ template<> struct CONSTRAINT_MUST_FORM_VALID_TVECMATMULTEXPR_FAILED<true> { enum
                                  , blaze::Equal< blaze::Rows<T2>, blaze::SizeT<0UL> > \
                                  , blaze::Equal< blaze::Size<T1>, blaze::Rows<T2> > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_TVECMATMULTEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_TVECMATMULTEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -218,7 +218,7 @@ template<> struct CONSTRAINT_MUST_NOT_FORM_VALID_TVECMATMULTEXPR_FAILED<true> {
                                              , blaze::Equal< blaze::Rows<T2>, blaze::SizeT<0UL> > \
                                              , blaze::Equal< blaze::Size<T1>, blaze::Rows<T2> > > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_TVECMATMULTEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_TVECMATMULTEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -84,7 +84,7 @@ template<> struct CONSTRAINT_MUST_BE_VECTVECMULTEXPR_TYPE_FAILED<true> { enum {
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_BE_VECTVECMULTEXPR_TYPE_FAILED< blaze::IsVecTVecMultExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_VECTVECMULTEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_VECTVECMULTEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -123,7 +123,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_VECTVECMULTEXPR_TYPE_FAILED<true> { enu
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_BE_VECTVECMULTEXPR_TYPE_FAILED< !blaze::IsVecTVecMultExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_VECTVECMULTEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_VECTVECMULTEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -165,7 +165,7 @@ template<> struct CONSTRAINT_MUST_FORM_VALID_VECTVECMULTEXPR_FAILED<true> { enum
             blaze::And< blaze::IsColumnVector<T1> \
                       , blaze::IsRowVector<T2> \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_VECTVECMULTEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_VECTVECMULTEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -207,7 +207,7 @@ template<> struct CONSTRAINT_MUST_NOT_FORM_VALID_VECTVECMULTEXPR_FAILED<true> {
             blaze::Not< blaze::And< blaze::IsColumnVector<T1> \
                                   , blaze::IsRowVector<T2> > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_VECTVECMULTEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_VECTVECMULTEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
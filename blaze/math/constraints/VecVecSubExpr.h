@@ -88,7 +88,7 @@ template<> struct CONSTRAINT_MUST_BE_VECVECSUBEXPR_TYPE_FAILED<true> { enum { va
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_BE_VECVECSUBEXPR_TYPE_FAILED< blaze::IsVecVecSubExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_VECVECSUBEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_VECVECSUBEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -127,7 +127,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_VECVECSUBEXPR_TYPE_FAILED<true> { enum
    typedef \
       blaze::CONSTRAINT_TEST< \
          blaze::CONSTRAINT_MUST_NOT_BE_VECVECSUBEXPR_TYPE_FAILED< !blaze::IsVecVecSubExpr<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_VECVECSUBEXPR_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_VECVECSUBEXPR_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -174,7 +174,7 @@ template<> struct CONSTRAINT_MUST_FORM_VALID_VECVECSUBEXPR_FAILED<true> { enum {
                                  , blaze::Equal< blaze::Size<T2>, blaze::SizeT<0UL> > \
                                  , blaze::Equal< blaze::Size<T1>, blaze::Size<T2> > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_VECVECSUBEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_FORM_VALID_VECVECSUBEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -221,7 +221,7 @@ template<> struct CONSTRAINT_MUST_NOT_FORM_VALID_VECVECSUBEXPR_FAILED<true> { en
                                              , blaze::Equal< blaze::Size<T2>, blaze::SizeT<0UL> > \
                                              , blaze::Equal< blaze::Size<T1>, blaze::Size<T2> > > > \
                       >::value ) >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_VECVECSUBEXPR_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_FORM_VALID_VECVECSUBEXPR_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -48,8 +48,10 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/Square.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/CMathTrait.h>
 #include <blaze/math/TransposeFlag.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Numeric.h>
 #include <blaze/util/EnableIf.h>
@@ -368,6 +370,52 @@ inline typename EnableIf< IsNumeric<T1>, bool >::Type
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the square length of a range of a dense vector.
+// \ingroup dense_vector
+//
+// The DVecSqrLengthKernel class template computes the sum of the squares of the elements
+// \f$[begin..end)\f$ of a dense vector. The squares are summed up according to the accumulation
+// scheme for reductions of type \a RT (see the ReductionAccumulation class template).
+*/
+template< typename VT    // Type of the dense vector
+        , typename RT >  // Result type of the square length
+struct DVecSqrLengthKernel
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecSqrLengthKernel class template.
+   //
+   // \param dv The dense vector.
+   */
+   explicit inline DVecSqrLengthKernel( const VT& dv )
+      : dv_( dv )  // The dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the square length of the given range.
+   //
+   // \param begin The first index of the range.
+   // \param end The index one past the last index of the range.
+   // \return The square length of the given range.
+   */
+   inline const RT operator()( size_t begin, size_t end ) const {
+      Accumulator< RT, ReductionAccumulation<RT>::value > sum;
+      for( size_t i=begin; i<end; ++i )
+         sum += sq( dv_[i] );
+      return sum.result();
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const VT& dv_;  //!< The dense vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\name DenseVector functions */
 //@{
@@ -467,10 +515,10 @@ typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   LengthType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return std::sqrt( sum );
+   const DVecSqrLengthKernel<VT,LengthType> kernel( ~dv );
+   const size_t n( (~dv).size() );
+
+   return std::sqrt( smpReduce<LengthType>( n, kernel, n > SMP_DVECDVECMULT_THRESHOLD ) );
 }
 //*************************************************************************************************
 
@@ -496,10 +544,10 @@ const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv )
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   ElementType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return sum;
+   const DVecSqrLengthKernel<VT,ElementType> kernel( ~dv );
+   const size_t n( (~dv).size() );
+
+   return smpReduce<ElementType>( n, kernel, n > SMP_DVECDVECMULT_THRESHOLD );
 }
 //*************************************************************************************************
 
@@ -51,6 +51,8 @@
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -60,11 +62,13 @@
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsScratchAllocatable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
@@ -79,8 +83,10 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/Null.h>
+#include <blaze/util/ScratchArena.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -403,10 +409,69 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    //**********************************************************************************************
 
  private:
+   //**Private class Initializer*******************************************************************
+   /*!\brief Auxiliary functor for the parallel initialization of blocks of rows.
+   */
+   struct Initializer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Initializer class.
+      //
+      // \param matrix The matrix to be initialized.
+      // \param first The index of the first column to be initialized with the given value.
+      // \param value The initial value of the matrix elements.
+      // \param source The elements to be copied (\c NULL in case no elements are copied).
+      // \param rowsPerThread The number of rows of each block.
+      */
+      explicit inline Initializer( DynamicMatrix& matrix, size_t first, const Type& value,
+                                   const Type* source, size_t rowsPerThread )
+         : matrix_       ( &matrix )       // The matrix to be initialized
+         , first_        ( first )         // The index of the first initialized column
+         , value_        ( &value )        // The initial value of the matrix elements
+         , source_       ( source )        // The elements to be copied
+         , rowsPerThread_( rowsPerThread )  // The number of rows of each block
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Initializes the rows of the given range of blocks.
+      //
+      // \param begin The index of the first block.
+      // \param end The index one past the last block.
+      // \return void
+      */
+      inline void operator()( size_t begin, size_t end ) const {
+         const size_t m( matrix_->m_ );
+         matrix_->initializeRows( min( begin*rowsPerThread_, m ), min( end*rowsPerThread_, m ),
+                                  first_, *value_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      DynamicMatrix* matrix_;  //!< The matrix to be initialized.
+      size_t first_;           //!< The index of the first initialized column.
+      const Type* value_;      //!< The initial value of the matrix elements.
+      const Type* source_;     //!< The elements to be copied.
+      size_t rowsPerThread_;   //!< The number of rows of each block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   inline size_t adjustColumns( size_t minColumns ) const;
+   inline size_t adjustColumns    ( size_t minColumns ) const;
+   inline void   initialize       ( size_t first, const Type& value, const Type* source );
+   inline void   initializeRows   ( size_t ibegin, size_t iend, size_t first,
+                                    const Type& value, const Type* source );
+
+   template< typename T >
+   static inline typename EnableIf< IsBuiltin<T>, T* >::Type allocateElements( size_t n );
+
+   template< typename T >
+   static inline typename DisableIf< IsBuiltin<T>, T* >::Type allocateElements( size_t n );
+
+   static inline void deallocateElements( Type* elements );
    //@}
    //**********************************************************************************************
 
@@ -477,17 +542,14 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix()
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                    // The current number of rows of the matrix
+   , n_       ( n )                                    // The current number of columns of the matrix
+   , nn_      ( adjustColumns( n ) )                   // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
-      }
+      initialize( n_, Type(), NULL );
    }
 }
 //*************************************************************************************************
@@ -505,21 +567,13 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                    // The current number of rows of the matrix
+   , n_       ( n )                                    // The current number of columns of the matrix
+   , nn_      ( adjustColumns( n ) )                   // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
-
-      if( IsVectorizable<Type>::value ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
-      }
-   }
+   initialize( 0UL, init, NULL );
 }
 //*************************************************************************************************
 
@@ -551,11 +605,11 @@ template< typename Type     // Data type of the matrix
         , bool SO >         // Storage order
 template< typename Other >  // Data type of the initialization array
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* array )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                    // The current number of rows of the matrix
+   , n_       ( n )                                    // The current number of columns of the matrix
+   , nn_      ( adjustColumns( n ) )                   // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
    for( size_t i=0UL; i<m; ++i ) {
       for( size_t j=0UL; j<n; ++j )
@@ -597,11 +651,11 @@ template< typename Other  // Data type of the initialization array
         , size_t M        // Number of rows of the initialization array
         , size_t N >      // Number of columns of the initialization array
 inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[M][N] )
-   : m_       ( M )                            // The current number of rows of the matrix
-   , n_       ( N )                            // The current number of columns of the matrix
-   , nn_      ( adjustColumns( N ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( M )                                    // The current number of rows of the matrix
+   , n_       ( N )                                    // The current number of columns of the matrix
+   , nn_      ( adjustColumns( N ) )                   // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
    for( size_t i=0UL; i<M; ++i ) {
       for( size_t j=0UL; j<N; ++j )
@@ -627,16 +681,15 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[M][N] )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
-   : m_       ( m.m_  )                        // The current number of rows of the matrix
-   , n_       ( m.n_  )                        // The current number of columns of the matrix
-   , nn_      ( m.nn_ )                        // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m.m_  )                                // The current number of rows of the matrix
+   , n_       ( m.n_  )                                // The current number of columns of the matrix
+   , nn_      ( m.nn_ )                                // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   initialize( 0UL, Type(), m.v_ );
 }
 //*************************************************************************************************
 
@@ -651,17 +704,14 @@ template< typename Type  // Data type of the matrix
 template< typename MT    // Type of the foreign matrix
         , bool SO2 >     // Storage order of the foreign matrix
 inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
-   : m_       ( (~m).rows() )                  // The current number of rows of the matrix
-   , n_       ( (~m).columns() )               // The current number of columns of the matrix
-   , nn_      ( adjustColumns( n_ ) )          // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
-{
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
-                  j<( IsVectorizable<Type>::value ? nn_ : n_ ); ++j ) {
-         v_[i*nn_+j] = Type();
-      }
+   : m_       ( (~m).rows() )                          // The current number of rows of the matrix
+   , n_       ( (~m).columns() )                       // The current number of columns of the matrix
+   , nn_      ( adjustColumns( n_ ) )                  // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
+{
+   if( IsSparseMatrix<MT>::value || IsVectorizable<Type>::value ) {
+      initialize( ( IsSparseMatrix<MT>::value ? 0UL : n_ ), Type(), NULL );
    }
 
    smpAssign( *this, ~m );
@@ -684,7 +734,7 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::~DynamicMatrix()
 {
-   deallocate( v_ );
+   deallocateElements( v_ );
 }
 //*************************************************************************************************
 
@@ -1450,13 +1500,13 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
             v[i*nn+j] = v_[i*nn_+j];
 
       std::swap( v_, v );
-      deallocate( v );
+      deallocateElements( v );
       capacity_ = m*nn;
    }
    else if( m*nn > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
       std::swap( v_, v );
-      deallocate( v );
+      deallocateElements( v );
       capacity_ = m*nn;
    }
 
@@ -1524,7 +1574,7 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 
       // Replacing the old array
       std::swap( tmp, v_ );
-      deallocate( tmp );
+      deallocateElements( tmp );
       capacity_ = elements;
    }
 }
@@ -1604,6 +1654,135 @@ inline size_t DynamicMatrix<Type,SO>::adjustColumns( size_t minColumns ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Allocation of the elements of a matrix with built-in element type.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// In case the matrix is constructed as temporary of an expression (see the ScratchTemporary
+// class template), the elements are taken from the thread-local scratch arena. Otherwise they
+// are dynamically allocated.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename T >     // Data type of the elements
+inline typename EnableIf< IsBuiltin<T>, T* >::Type DynamicMatrix<Type,SO>::allocateElements( size_t n )
+{
+   if( TheScratchArena::consume() )
+      return TheScratchArena::allocate<T>( n );
+   else return allocate<T>( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of the elements of a matrix with non-built-in element type.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename T >     // Data type of the elements
+inline typename DisableIf< IsBuiltin<T>, T* >::Type DynamicMatrix<Type,SO>::allocateElements( size_t n )
+{
+   return allocate<T>( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of the elements of the matrix.
+//
+// \param elements The first element of the array to be deallocated.
+// \return void
+//
+// This function releases the given elements either to the thread-local scratch arena or to the
+// free store, depending on where they have been allocated (see the allocateElements() function).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicMatrix<Type,SO>::deallocateElements( Type* elements )
+{
+   if( IsBuiltin<Type>::value && TheScratchArena::owns( elements ) )
+      TheScratchArena::deallocate( elements );
+   else deallocate( elements );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the matrix elements.
+//
+// \param first The index of the first column to be initialized with the given value.
+// \param value The initial value of the matrix elements.
+// \param source The elements to be copied (\c NULL in case no elements are copied).
+// \return void
+//
+// This function initializes the columns \f$[first..N)\f$ of all rows with the given \a value
+// and resets the padding elements or, in case a \a source is given, copies all elements of
+// the source. In case the parallel first-touch initialization is enabled (see
+// \c SMP_FIRST_TOUCH), the rows of large matrices of numeric element type are initialized in
+// parallel, using the same static partition into blocks of rows as the SMP assignment.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicMatrix<Type,SO>::initialize( size_t first, const Type& value, const Type* source )
+{
+   if( !SMP_FIRST_TOUCH || !IsNumeric<Type>::value || capacity_ < SMP_FIRST_TOUCH_THRESHOLD ) {
+      initializeRows( 0UL, m_, first, value, source );
+      return;
+   }
+
+   const size_t threads      ( getNumThreads() );
+   const size_t addon        ( ( ( m_ % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( m_ / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   smpFor( 0UL, threads, Initializer( *this, first, value, source, rowsPerThread ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the elements of the given range of rows.
+//
+// \param ibegin The index of the first row.
+// \param iend The index one past the last row.
+// \param first The index of the first column to be initialized with the given value.
+// \param value The initial value of the matrix elements.
+// \param source The elements to be copied (\c NULL in case no elements are copied).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicMatrix<Type,SO>::initializeRows( size_t ibegin, size_t iend, size_t first,
+                                                    const Type& value, const Type* source )
+{
+   for( size_t i=ibegin; i<iend; ++i )
+   {
+      if( source != NULL ) {
+         for( size_t j=0UL; j<nn_; ++j )
+            v_[i*nn_+j] = source[i*nn_+j];
+         continue;
+      }
+
+      for( size_t j=first; j<n_; ++j )
+         v_[i*nn_+j] = value;
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t j=n_; j<nn_; ++j )
+            v_[i*nn_+j] = Type();
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2627,10 +2806,69 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    //**********************************************************************************************
 
  private:
+   //**Private class Initializer*******************************************************************
+   /*!\brief Auxiliary functor for the parallel initialization of blocks of columns.
+   */
+   struct Initializer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Initializer class.
+      //
+      // \param matrix The matrix to be initialized.
+      // \param first The index of the first row to be initialized with the given value.
+      // \param value The initial value of the matrix elements.
+      // \param source The elements to be copied (\c NULL in case no elements are copied).
+      // \param colsPerThread The number of columns of each block.
+      */
+      explicit inline Initializer( DynamicMatrix& matrix, size_t first, const Type& value,
+                                   const Type* source, size_t colsPerThread )
+         : matrix_       ( &matrix )       // The matrix to be initialized
+         , first_        ( first )         // The index of the first initialized row
+         , value_        ( &value )        // The initial value of the matrix elements
+         , source_       ( source )        // The elements to be copied
+         , colsPerThread_( colsPerThread )  // The number of columns of each block
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Initializes the columns of the given range of blocks.
+      //
+      // \param begin The index of the first block.
+      // \param end The index one past the last block.
+      // \return void
+      */
+      inline void operator()( size_t begin, size_t end ) const {
+         const size_t n( matrix_->n_ );
+         matrix_->initializeColumns( min( begin*colsPerThread_, n ), min( end*colsPerThread_, n ),
+                                     first_, *value_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      DynamicMatrix* matrix_;  //!< The matrix to be initialized.
+      size_t first_;           //!< The index of the first initialized row.
+      const Type* value_;      //!< The initial value of the matrix elements.
+      const Type* source_;     //!< The elements to be copied.
+      size_t colsPerThread_;   //!< The number of columns of each block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   inline size_t adjustRows( size_t minRows ) const;
+   inline size_t adjustRows       ( size_t minRows ) const;
+   inline void   initialize       ( size_t first, const Type& value, const Type* source );
+   inline void   initializeColumns( size_t jbegin, size_t jend, size_t first,
+                                    const Type& value, const Type* source );
+
+   template< typename T >
+   static inline typename EnableIf< IsBuiltin<T>, T* >::Type allocateElements( size_t n );
+
+   template< typename T >
+   static inline typename DisableIf< IsBuiltin<T>, T* >::Type allocateElements( size_t n );
+
+   static inline void deallocateElements( Type* elements );
    //@}
    //**********************************************************************************************
 
@@ -2701,17 +2939,14 @@ inline DynamicMatrix<Type,true>::DynamicMatrix()
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( adjustRows( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                    // The current number of rows of the matrix
+   , mm_      ( adjustRows( m ) )                      // The alignment adjusted number of rows
+   , n_       ( n )                                    // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
-      for( size_t j=0UL; j<n_; ++j )
-         for( size_t i=m_; i<mm_; ++i ) {
-            v_[i+j*mm_] = Type();
-      }
+      initialize( m_, Type(), NULL );
    }
 }
 /*! \endcond */
@@ -2730,21 +2965,13 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( adjustRows( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                    // The current number of rows of the matrix
+   , mm_      ( adjustRows( m ) )                      // The alignment adjusted number of rows
+   , n_       ( n )                                    // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
-
-      if( IsVectorizable<Type>::value ) {
-         for( size_t i=m_; i<mm_; ++i )
-            v_[i+j*mm_] = Type();
-      }
-   }
+   initialize( 0UL, init, NULL );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -2777,11 +3004,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
 template< typename Type >   // Data type of the matrix
 template< typename Other >  // Data type of the initialization array
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other* array )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( adjustRows( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                    // The current number of rows of the matrix
+   , mm_      ( adjustRows( m ) )                      // The alignment adjusted number of rows
+   , n_       ( n )                                    // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
    for( size_t j=0UL; j<n; ++j ) {
       for( size_t i=0UL; i<m; ++i )
@@ -2824,11 +3051,11 @@ template< typename Other   // Data type of the initialization array
         , size_t M         // Number of rows of the initialization array
         , size_t N >       // Number of columns of the initialization array
 inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[M][N] )
-   : m_       ( M )                            // The current number of rows of the matrix
-   , mm_      ( adjustRows( M ) )              // The alignment adjusted number of rows
-   , n_       ( N )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( M )                                    // The current number of rows of the matrix
+   , mm_      ( adjustRows( M ) )                      // The alignment adjusted number of rows
+   , n_       ( N )                                    // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
    for( size_t j=0UL; j<N; ++j ) {
       for( size_t i=0UL; i<M; ++i )
@@ -2855,16 +3082,15 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[M][N] )
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
-   : m_       ( m.m_  )                        // The current number of rows of the matrix
-   , mm_      ( m.mm_ )                        // The alignment adjusted number of rows
-   , n_       ( m.n_  )                        // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m.m_  )                                // The current number of rows of the matrix
+   , mm_      ( m.mm_ )                                // The alignment adjusted number of rows
+   , n_       ( m.n_  )                                // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   initialize( 0UL, Type(), m.v_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -2880,17 +3106,14 @@ template< typename Type >  // Data type of the matrix
 template< typename MT      // Type of the foreign matrix
         , bool SO >        // Storage order of the foreign matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
-   : m_       ( (~m).rows() )                  // The current number of rows of the matrix
-   , mm_      ( adjustRows( m_ ) )             // The alignment adjusted number of rows
-   , n_       ( (~m).columns() )               // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
-{
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
-                  i<( IsVectorizable<Type>::value ? mm_ : m_ ); ++i ) {
-         v_[i+j*mm_] = Type();
-      }
+   : m_       ( (~m).rows() )                          // The current number of rows of the matrix
+   , mm_      ( adjustRows( m_ ) )                     // The alignment adjusted number of rows
+   , n_       ( (~m).columns() )                       // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                               // The maximum capacity of the matrix
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The matrix elements
+{
+   if( IsSparseMatrix<MT>::value || IsVectorizable<Type>::value ) {
+      initialize( ( IsSparseMatrix<MT>::value ? 0UL : m_ ), Type(), NULL );
    }
 
    smpAssign( *this, ~m );
@@ -2914,7 +3137,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::~DynamicMatrix()
 {
-   deallocate( v_ );
+   deallocateElements( v_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3666,13 +3889,13 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
             v[i+j*mm] = v_[i+j*mm_];
 
       std::swap( v_, v );
-      deallocate( v );
+      deallocateElements( v );
       capacity_ = mm*n;
    }
    else if( mm*n > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
       std::swap( v_, v );
-      deallocate( v );
+      deallocateElements( v );
       capacity_ = mm*n;
    }
 
@@ -3742,7 +3965,7 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 
       // Replacing the old array
       std::swap( tmp, v_ );
-      deallocate( tmp );
+      deallocateElements( tmp );
       capacity_ = elements;
    }
 }
@@ -3827,6 +4050,140 @@ inline size_t DynamicMatrix<Type,true>::adjustRows( size_t minRows ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Allocation of the elements of a matrix with built-in element type.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// In case the matrix is constructed as temporary of an expression (see the ScratchTemporary
+// class template), the elements are taken from the thread-local scratch arena. Otherwise they
+// are dynamically allocated.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename T >     // Data type of the elements
+inline typename EnableIf< IsBuiltin<T>, T* >::Type DynamicMatrix<Type,true>::allocateElements( size_t n )
+{
+   if( TheScratchArena::consume() )
+      return TheScratchArena::allocate<T>( n );
+   else return allocate<T>( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Allocation of the elements of a matrix with non-built-in element type.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename T >     // Data type of the elements
+inline typename DisableIf< IsBuiltin<T>, T* >::Type DynamicMatrix<Type,true>::allocateElements( size_t n )
+{
+   return allocate<T>( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deallocation of the elements of the matrix.
+//
+// \param elements The first element of the array to be deallocated.
+// \return void
+//
+// This function releases the given elements either to the thread-local scratch arena or to the
+// free store, depending on where they have been allocated (see the allocateElements() function).
+*/
+template< typename Type >  // Data type of the matrix
+inline void DynamicMatrix<Type,true>::deallocateElements( Type* elements )
+{
+   if( IsBuiltin<Type>::value && TheScratchArena::owns( elements ) )
+      TheScratchArena::deallocate( elements );
+   else deallocate( elements );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the matrix elements.
+//
+// \param first The index of the first row to be initialized with the given value.
+// \param value The initial value of the matrix elements.
+// \param source The elements to be copied (\c NULL in case no elements are copied).
+// \return void
+//
+// This function initializes the rows \f$[first..M)\f$ of all columns with the given \a value
+// and resets the padding elements or, in case a \a source is given, copies all elements of
+// the source. In case the parallel first-touch initialization is enabled (see
+// \c SMP_FIRST_TOUCH), the columns of large matrices of numeric element type are initialized
+// in parallel, using the same static partition into blocks of columns as the SMP assignment.
+*/
+template< typename Type >  // Data type of the matrix
+inline void DynamicMatrix<Type,true>::initialize( size_t first, const Type& value, const Type* source )
+{
+   if( !SMP_FIRST_TOUCH || !IsNumeric<Type>::value || capacity_ < SMP_FIRST_TOUCH_THRESHOLD ) {
+      initializeColumns( 0UL, n_, first, value, source );
+      return;
+   }
+
+   const size_t threads      ( getNumThreads() );
+   const size_t addon        ( ( ( n_ % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( n_ / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   smpFor( 0UL, threads, Initializer( *this, first, value, source, colsPerThread ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the elements of the given range of columns.
+//
+// \param jbegin The index of the first column.
+// \param jend The index one past the last column.
+// \param first The index of the first row to be initialized with the given value.
+// \param value The initial value of the matrix elements.
+// \param source The elements to be copied (\c NULL in case no elements are copied).
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void DynamicMatrix<Type,true>::initializeColumns( size_t jbegin, size_t jend, size_t first,
+                                                         const Type& value, const Type* source )
+{
+   for( size_t j=jbegin; j<jend; ++j )
+   {
+      if( source != NULL ) {
+         for( size_t i=0UL; i<mm_; ++i )
+            v_[i+j*mm_] = source[i+j*mm_];
+         continue;
+      }
+
+      for( size_t i=first; i<m_; ++i )
+         v_[i+j*mm_] = value;
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t i=m_; i<mm_; ++i )
+            v_[i+j*mm_] = Type();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -4804,6 +5161,26 @@ struct IsResizable< DynamicMatrix<T,SO> > : public TrueType
 
 
 
+//=================================================================================================
+//
+//  ISSCRATCHALLOCATABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsScratchAllocatable< DynamicMatrix<T,SO> > : public IsBuiltin<T>::Type
+{
+   enum { value = IsBuiltin<T>::value };
+   typedef typename IsBuiltin<T>::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ADDTRAIT SPECIALIZATIONS
@@ -46,10 +46,13 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -58,11 +61,13 @@
 #include <blaze/math/traits/SubTrait.h>
 #include <blaze/math/traits/SubvectorTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsScratchAllocatable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
@@ -77,8 +82,10 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/Null.h>
+#include <blaze/util/ScratchArena.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -392,10 +399,65 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    //**********************************************************************************************
 
  private:
+   //**Private class Initializer*******************************************************************
+   /*!\brief Auxiliary functor for the parallel initialization of blocks of elements.
+   */
+   struct Initializer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Initializer class.
+      //
+      // \param vector The vector to be initialized.
+      // \param value The initial value of the vector elements.
+      // \param source The elements to be copied (\c NULL in case no elements are copied).
+      // \param sizePerThread The number of elements of each block.
+      */
+      explicit inline Initializer( DynamicVector& vector, const Type& value,
+                                   const Type* source, size_t sizePerThread )
+         : vector_       ( &vector )       // The vector to be initialized
+         , value_        ( &value )        // The initial value of the vector elements
+         , source_       ( source )        // The elements to be copied
+         , sizePerThread_( sizePerThread )  // The number of elements of each block
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Initializes the elements of the given range of blocks.
+      //
+      // \param begin The index of the first block.
+      // \param end The index one past the last block.
+      // \return void
+      */
+      inline void operator()( size_t begin, size_t end ) const {
+         const size_t n( vector_->size_ );
+         vector_->initializeRange( min( begin*sizePerThread_, n ), min( end*sizePerThread_, n ),
+                                   *value_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      DynamicVector* vector_;  //!< The vector to be initialized.
+      const Type* value_;      //!< The initial value of the vector elements.
+      const Type* source_;     //!< The elements to be copied.
+      size_t sizePerThread_;   //!< The number of elements of each block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   inline size_t adjustCapacity( size_t minCapacity ) const;
+   inline size_t adjustCapacity ( size_t minCapacity ) const;
+   inline void   initialize     ( const Type& value, const Type* source );
+   inline void   initializeRange( size_t begin, size_t end, const Type& value, const Type* source );
+
+   template< typename T >
+   static inline typename EnableIf< IsBuiltin<T>, T* >::Type allocateElements( size_t n );
+
+   template< typename T >
+   static inline typename DisableIf< IsBuiltin<T>, T* >::Type allocateElements( size_t n );
+
+   static inline void deallocateElements( Type* elements );
    //@}
    //**********************************************************************************************
 
@@ -457,9 +519,9 @@ inline DynamicVector<Type,TF>::DynamicVector()
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( size_t n )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( n )                                    // The current size/dimension of the vector
+   , capacity_( adjustCapacity( n ) )                  // The maximum capacity of the vector
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The vector elements
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -480,17 +542,11 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( n )                                    // The current size/dimension of the vector
+   , capacity_( adjustCapacity( n ) )                  // The maximum capacity of the vector
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
-
-   if( IsVectorizable<Type>::value ) {
-      for( size_t i=size_; i<capacity_; ++i )
-         v_[i] = Type();
-   }
+   initialize( init, NULL );
 }
 //*************************************************************************************************
 
@@ -519,9 +575,9 @@ template< typename Type     // Data type of the vector
         , bool TF >         // Transpose flag
 template< typename Other >  // Data type of the initialization array
 inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( n )                                    // The current size/dimension of the vector
+   , capacity_( adjustCapacity( n ) )                  // The maximum capacity of the vector
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The vector elements
 {
    for( size_t i=0UL; i<n; ++i )
       v_[i] = array[i];
@@ -556,9 +612,9 @@ template< typename Type   // Data type of the vector
 template< typename Other  // Data type of the initialization array
         , size_t N >      // Dimension of the initialization array
 inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[N] )
-   : size_    ( N )                            // The current size/dimension of the vector
-   , capacity_( adjustCapacity( N ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( N )                                    // The current size/dimension of the vector
+   , capacity_( adjustCapacity( N ) )                  // The maximum capacity of the vector
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The vector elements
 {
    for( size_t i=0UL; i<N; ++i )
       v_[i] = array[i];
@@ -582,14 +638,13 @@ inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[N] )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
-   : size_    ( v.size_ )                      // The current size/dimension of the vector
-   , capacity_( adjustCapacity( v.size_ ) )    // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( v.size_ )                              // The current size/dimension of the vector
+   , capacity_( adjustCapacity( v.size_ ) )            // The maximum capacity of the vector
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The vector elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = v.v_[i];
+   initialize( Type(), v.v_ );
 }
 //*************************************************************************************************
 
@@ -603,13 +658,16 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the foreign vector
 inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
-   : size_    ( (~v).size() )                  // The current size/dimension of the vector
-   , capacity_( adjustCapacity( size_ ) )      // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( (~v).size() )                          // The current size/dimension of the vector
+   , capacity_( adjustCapacity( size_ ) )              // The maximum capacity of the vector
+   , v_       ( allocateElements<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=( IsSparseVector<VT>::value   ? 0UL       : size_ );
-               i<( IsVectorizable<Type>::value ? capacity_ : size_ ); ++i ) {
-      v_[i] = Type();
+   if( IsSparseVector<VT>::value ) {
+      initialize( Type(), NULL );
+   }
+   else if( IsVectorizable<Type>::value ) {
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = Type();
    }
 
    smpAssign( *this, ~v );
@@ -632,7 +690,7 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::~DynamicVector()
 {
-   deallocate( v_ );
+   deallocateElements( v_ );
 }
 //*************************************************************************************************
 
@@ -1168,6 +1226,8 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 {
+   if( n == size_ ) return;
+
    if( n > capacity_ )
    {
       // Allocating a new array
@@ -1186,7 +1246,7 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 
       // Replacing the old array
       std::swap( v_, tmp );
-      deallocate( tmp );
+      deallocateElements( tmp );
       capacity_ = newCapacity;
    }
    else if( IsVectorizable<Type>::value && n < size_ )
@@ -1250,7 +1310,7 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
 
       // Replacing the old array
       std::swap( tmp, v_ );
-      deallocate( tmp );
+      deallocateElements( tmp );
       capacity_ = newCapacity;
    }
 }
@@ -1310,6 +1370,130 @@ inline size_t DynamicVector<Type,TF>::adjustCapacity( size_t minCapacity ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Allocation of the elements of a vector with built-in element type.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// In case the vector is constructed as temporary of an expression (see the ScratchTemporary
+// class template), the elements are taken from the thread-local scratch arena. Otherwise they
+// are dynamically allocated.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF >         // Transpose flag
+template< typename T >     // Data type of the elements
+inline typename EnableIf< IsBuiltin<T>, T* >::Type DynamicVector<Type,TF>::allocateElements( size_t n )
+{
+   if( TheScratchArena::consume() )
+      return TheScratchArena::allocate<T>( n );
+   else return allocate<T>( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of the elements of a vector with non-built-in element type.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF >         // Transpose flag
+template< typename T >     // Data type of the elements
+inline typename DisableIf< IsBuiltin<T>, T* >::Type DynamicVector<Type,TF>::allocateElements( size_t n )
+{
+   return allocate<T>( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of the elements of the vector.
+//
+// \param elements The first element of the array to be deallocated.
+// \return void
+//
+// This function releases the given elements either to the thread-local scratch arena or to the
+// free store, depending on where they have been allocated (see the allocateElements() function).
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void DynamicVector<Type,TF>::deallocateElements( Type* elements )
+{
+   if( IsBuiltin<Type>::value && TheScratchArena::owns( elements ) )
+      TheScratchArena::deallocate( elements );
+   else deallocate( elements );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the vector elements.
+//
+// \param value The initial value of the vector elements.
+// \param source The elements to be copied (\c NULL in case no elements are copied).
+// \return void
+//
+// This function initializes all elements with the given \a value or, in case a \a source is
+// given, copies all elements of the source. The padding elements are reset. In case the
+// parallel first-touch initialization is enabled (see \c SMP_FIRST_TOUCH), the elements of
+// large vectors of numeric element type are initialized in parallel, using the same static
+// partition into blocks of elements as the SMP assignment.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void DynamicVector<Type,TF>::initialize( const Type& value, const Type* source )
+{
+   if( !SMP_FIRST_TOUCH || !IsNumeric<Type>::value || capacity_ < SMP_FIRST_TOUCH_THRESHOLD ) {
+      initializeRange( 0UL, size_, value, source );
+   }
+   else {
+      const size_t threads      ( getNumThreads() );
+      const size_t addon        ( ( ( size_ % threads ) != 0UL )? 1UL : 0UL );
+      const size_t equalShare   ( size_ / threads + addon );
+      const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+      const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+      smpFor( 0UL, threads, Initializer( *this, value, source, sizePerThread ) );
+   }
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = Type();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given range of vector elements.
+//
+// \param begin The index of the first element.
+// \param end The index one past the last element.
+// \param value The initial value of the vector elements.
+// \param source The elements to be copied (\c NULL in case no elements are copied).
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void DynamicVector<Type,TF>::initializeRange( size_t begin, size_t end,
+                                                     const Type& value, const Type* source )
+{
+   if( source != NULL ) {
+      for( size_t i=begin; i<end; ++i )
+         v_[i] = source[i];
+   }
+   else {
+      for( size_t i=begin; i<end; ++i )
+         v_[i] = value;
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2094,6 +2278,26 @@ struct IsResizable< DynamicVector<T,TF> > : public TrueType
 
 
 
+//=================================================================================================
+//
+//  ISSCRATCHALLOCATABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF >
+struct IsScratchAllocatable< DynamicVector<T,TF> > : public IsBuiltin<T>::Type
+{
+   enum { value = IsBuiltin<T>::value };
+   typedef typename IsBuiltin<T>::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ADDTRAIT SPECIALIZATIONS
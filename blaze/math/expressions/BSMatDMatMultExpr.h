@@ -0,0 +1,858 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/BSMatDMatMultExpr.h
+//  \brief Header file for the block sparse matrix/dense matrix multiplication expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_BSMATDMATMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_BSMATDMATMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/MatMatMultExpr.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/BlockCompressedMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BSMATDMATMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for block sparse matrix-dense matrix multiplications.
+// \ingroup dense_matrix_expression
+//
+// The BSMatDMatMultExpr class represents the compile time expression for multiplications
+// between block-compressed sparse matrices and row-major dense matrices. The multiplication
+// is evaluated block row by block row. In case the target matrix and the dense matrix operand
+// are suited for a vectorized computation, each block row is computed in register-sized column
+// panels: the \a M rows of a panel are accumulated in \a M intrinsic registers, and each loaded
+// panel of the dense matrix operand is reused for all \a M rows of the current block. In case
+// a shared memory parallelization is active, the block rows are distributed among the available
+// threads.
+*/
+template< typename MT1    // Type of the left-hand side block sparse matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+class BSMatDMatMultExpr : public DenseMatrix< BSMatDMatMultExpr<MT1,MT2>, false >
+                        , private MatMatMultExpr
+                        , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ResultType     RT1;  //!< Result type of the left-hand side block sparse matrix.
+   typedef typename MT2::ResultType     RT2;  //!< Result type of the right-hand side dense matrix expression.
+   typedef typename RT1::ElementType    ET1;  //!< Element type of the left-hand side block sparse matrix.
+   typedef typename RT2::ElementType    ET2;  //!< Element type of the right-hand side dense matrix expression.
+   typedef typename MT2::CompositeType  CT2;  //!< Composite type of the right-hand side dense matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side dense matrix expression.
+   enum { evaluateRight = IsComputation<MT2>::value || RequiresEvaluation<MT2>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Number of rows of the blocks of the left-hand side block sparse matrix.
+   enum { M = MT1::rowsPerBlock };
+
+   //! Number of columns of the blocks of the left-hand side block sparse matrix.
+   enum { N = MT1::columnsPerBlock };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef BSMatDMatMultExpr<MT1,MT2>                  This;           //!< Type of this BSMatDMatMultExpr instance.
+   typedef typename MultTrait<RT1,RT2>::Type           ResultType;     //!< Result type for expression template evaluations.
+   typedef typename ResultType::OppositeType           OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef typename ResultType::TransposeType          TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename ResultType::ElementType            ElementType;    //!< Resulting element type.
+   typedef typename IntrinsicTrait<ElementType>::Type  IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const ElementType                           ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType                            CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side block sparse matrix.
+   typedef const MT1&  LeftOperand;
+
+   //! Composite type of the right-hand side dense matrix expression.
+   typedef typename SelectType< IsExpression<MT2>::value, const MT2, const MT2& >::Type  RightOperand;
+
+   //! Type for the assignment of the right-hand side dense matrix operand.
+   typedef typename SelectType< evaluateRight, const RT2, CT2 >::Type  RT;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum { vectorizable = 0 };
+
+   //! Compilation switch for the expression template assignment strategy.
+   /*! The expression is evaluated in parallel by means of its own block row partitioning. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the target matrix and the right-hand side dense matrix operand are suited for a
+       vectorized computation of the matrix multiplication, the nested \value will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseVectorizedKernel {
+      enum { value = T1::vectorizable && T2::vectorizable &&
+                     IsRowMajorMatrix<T1>::value &&
+                     IsSame<ET1,ElementType>::value &&
+                     IsSame<typename T1::ElementType,ElementType>::value &&
+                     IsSame<typename T2::ElementType,ElementType>::value &&
+                     IntrinsicTrait<ElementType>::addition &&
+                     IntrinsicTrait<ElementType>::subtraction &&
+                     IntrinsicTrait<ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Kernel class definition*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block row kernel of the block sparse matrix-dense matrix multiplication.
+   //
+   // The Kernel class computes the results of the block rows \f$[begin..end)\f$ and assigns
+   // (\a OP == 0), adds (\a OP == 1), or subtracts (\a OP == 2) them to/from the target matrix.
+   // It is used both for the serial and for the parallel evaluation via smpFor().
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , typename MT4  // Type of the right-hand side dense matrix operand
+           , int OP >      // Type of the assignment operation
+   class Kernel
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Kernel class.
+      //
+      // \param C The target dense matrix.
+      // \param A The left-hand side block sparse matrix operand.
+      // \param B The right-hand side dense matrix operand.
+      */
+      explicit inline Kernel( MT3& C, const MT1& A, const MT4& B )
+         : C_( C )  // The target dense matrix
+         , A_( A )  // The left-hand side block sparse matrix operand
+         , B_( B )  // The right-hand side dense matrix operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Computation of the block rows \f$[begin..end)\f$.
+      //
+      // \param begin The first block row to be computed.
+      // \param end The block row one past the last block row to be computed.
+      // \return void
+      */
+      inline void operator()( size_t begin, size_t end ) const {
+         BSMatDMatMultExpr::template selectKernel<OP>( C_, A_, B_, begin, end );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MT3&       C_;  //!< The target dense matrix.
+      const MT1& A_;  //!< The left-hand side block sparse matrix operand.
+      const MT4& B_;  //!< The right-hand side dense matrix operand.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BSMatDMatMultExpr class.
+   //
+   // \param lhs The left-hand side block sparse matrix operand of the multiplication expression.
+   // \param rhs The right-hand side dense matrix operand of the multiplication expression.
+   */
+   explicit inline BSMatDMatMultExpr( const MT1& lhs, const MT2& rhs )
+      : lhs_( lhs )  // Left-hand side block sparse matrix of the multiplication expression
+      , rhs_( rhs )  // Right-hand side dense matrix of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.rows(), "Invalid matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < rhs_.columns(), "Invalid column access index" );
+
+      typedef typename MT1::ConstBlockIterator  ConstBlockIterator;
+
+      const size_t ib( i / M );
+      const size_t k ( i % M );
+
+      ElementType tmp = ElementType();
+
+      const ConstBlockIterator last( lhs_.blockEnd(ib) );
+      for( ConstBlockIterator block=lhs_.blockBegin(ib); block!=last; ++block ) {
+         const size_t lbegin( block->index()*N );
+         for( size_t l=0UL; l<N; ++l )
+            tmp += block->value()(k,l) * rhs_(lbegin+l,j);
+      }
+
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const {
+      return rhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side block sparse matrix operand.
+   //
+   // \return The left-hand side block sparse matrix operand.
+   */
+   inline LeftOperand leftOperand() const {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense matrix operand.
+   //
+   // \return The right-hand side dense matrix operand.
+   */
+   inline RightOperand rightOperand() const {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const {
+      return rhs_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( rows() > SMP_BSMATDMATMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side block sparse matrix of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side dense matrix of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Default block row kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default block row kernel of the block sparse matrix-dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \param C The target dense matrix.
+   // \param A The left-hand side block sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param begin The first block row to be computed.
+   // \param end The block row one past the last block row to be computed.
+   // \return void
+   //
+   // This function implements the default kernel for the block sparse matrix-dense matrix
+   // multiplication, which is used for all target matrices and element types that are not
+   // suited for a vectorized computation.
+   */
+   template< int OP          // Type of the assignment operation
+           , typename MT3    // Type of the target dense matrix
+           , typename MT4 >  // Type of the right-hand side dense matrix operand
+   static inline typename DisableIf< UseVectorizedKernel<MT3,MT4> >::Type
+      selectKernel( MT3& C, const MT1& A, const MT4& B, size_t begin, size_t end )
+   {
+      typedef typename MT1::ConstBlockIterator  ConstBlockIterator;
+
+      ElementType tmp[M];
+
+      for( size_t i=begin; i<end; ++i )
+      {
+         const ConstBlockIterator last( A.blockEnd(i) );
+
+         for( size_t j=0UL; j<B.columns(); ++j )
+         {
+            for( size_t k=0UL; k<M; ++k )
+               tmp[k] = ElementType();
+
+            for( ConstBlockIterator block=A.blockBegin(i); block!=last; ++block ) {
+               const size_t lbegin( block->index()*N );
+               for( size_t l=0UL; l<N; ++l ) {
+                  const ET2 b( B(lbegin+l,j) );
+                  for( size_t k=0UL; k<M; ++k )
+                     tmp[k] += block->value()(k,l) * b;
+               }
+            }
+
+            for( size_t k=0UL; k<M; ++k ) {
+               if( OP == 0 )      C(i*M+k,j)  = tmp[k];
+               else if( OP == 1 ) C(i*M+k,j) += tmp[k];
+               else               C(i*M+k,j) -= tmp[k];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized block row kernel*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized block row kernel of the block sparse matrix-dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \param C The target dense matrix.
+   // \param A The left-hand side block sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param begin The first block row to be computed.
+   // \param end The block row one past the last block row to be computed.
+   // \return void
+   //
+   // This function implements the vectorized kernel for the block sparse matrix-dense matrix
+   // multiplication. Each block row is computed in column panels of the width of an intrinsic
+   // register. The \a M result rows of a panel are accumulated in \a M registers and stored
+   // exactly once.
+   */
+   template< int OP          // Type of the assignment operation
+           , typename MT3    // Type of the target dense matrix
+           , typename MT4 >  // Type of the right-hand side dense matrix operand
+   static inline typename EnableIf< UseVectorizedKernel<MT3,MT4> >::Type
+      selectKernel( MT3& C, const MT1& A, const MT4& B, size_t begin, size_t end )
+   {
+      typedef IntrinsicTrait<ElementType>        IT;
+      typedef typename MT1::ConstBlockIterator  ConstBlockIterator;
+
+      for( size_t i=begin; i<end; ++i )
+      {
+         const ConstBlockIterator last( A.blockEnd(i) );
+
+         for( size_t j=0UL; j<B.columns(); j+=IT::size )
+         {
+            IntrinsicType xmm[M];
+
+            for( ConstBlockIterator block=A.blockBegin(i); block!=last; ++block ) {
+               const size_t lbegin( block->index()*N );
+               for( size_t l=0UL; l<N; ++l ) {
+                  const IntrinsicType b( B.load(lbegin+l,j) );
+                  for( size_t k=0UL; k<M; ++k )
+                     xmm[k] = xmm[k] + set( block->value()(k,l) ) * b;
+               }
+            }
+
+            for( size_t k=0UL; k<M; ++k ) {
+               if( OP == 0 )      C.store( i*M+k, j, xmm[k] );
+               else if( OP == 1 ) C.store( i*M+k, j, C.load(i*M+k,j) + xmm[k] );
+               else               C.store( i*M+k, j, C.load(i*M+k,j) - xmm[k] );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block sparse matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a block sparse matrix-
+   // dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT,SO>& lhs, const BSMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef typename RemoveReference<RT>::Type  MT4;
+
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const Kernel<MT,MT4,0> kernel( ~lhs, rhs.lhs_, B );
+      kernel( 0UL, rhs.lhs_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block sparse matrix-dense matrix multiplication to a sparse matrix
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a block sparse matrix-
+   // dense matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO >    // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT,SO>& lhs, const BSMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      typedef typename SelectType< SO, OppositeType, ResultType >::Type  TmpType;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename TmpType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a block sparse matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a block sparse
+   // matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT,SO>& lhs, const BSMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef typename RemoveReference<RT>::Type  MT4;
+
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const Kernel<MT,MT4,1> kernel( ~lhs, rhs.lhs_, B );
+      kernel( 0UL, rhs.lhs_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a block sparse matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a block
+   // sparse matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT,SO>& lhs, const BSMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef typename RemoveReference<RT>::Type  MT4;
+
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const Kernel<MT,MT4,2> kernel( ~lhs, rhs.lhs_, B );
+      kernel( 0UL, rhs.lhs_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a block sparse matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a block sparse matrix-
+   // dense matrix multiplication expression to a dense matrix. In case the number of rows exceeds
+   // the SMP_BSMATDMATMULT_THRESHOLD, the block rows are distributed among the available threads.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT,SO>& lhs, const BSMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef typename RemoveReference<RT>::Type  MT4;
+
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const Kernel<MT,MT4,0> kernel( ~lhs, rhs.lhs_, B );
+
+      if( rhs.canSMPAssign() )
+         smpFor( 0UL, rhs.lhs_.blockRows(), kernel );
+      else
+         kernel( 0UL, rhs.lhs_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a block sparse matrix-dense matrix multiplication to a sparse
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a block sparse matrix-
+   // dense matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO >    // Storage order of the target sparse matrix
+   friend inline void smpAssign( SparseMatrix<MT,SO>& lhs, const BSMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      typedef typename SelectType< SO, OppositeType, ResultType >::Type  TmpType;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename TmpType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a block sparse matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a block
+   // sparse matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void smpAddAssign( DenseMatrix<MT,SO>& lhs, const BSMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef typename RemoveReference<RT>::Type  MT4;
+
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const Kernel<MT,MT4,1> kernel( ~lhs, rhs.lhs_, B );
+
+      if( rhs.canSMPAssign() )
+         smpFor( 0UL, rhs.lhs_.blockRows(), kernel );
+      else
+         kernel( 0UL, rhs.lhs_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a block sparse matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a block
+   // sparse matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void smpSubAssign( DenseMatrix<MT,SO>& lhs, const BSMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef typename RemoveReference<RT>::Type  MT4;
+
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const Kernel<MT,MT4,2> kernel( ~lhs, rhs.lhs_, B );
+
+      if( rhs.canSMPAssign() )
+         smpFor( 0UL, rhs.lhs_.blockRows(), kernel );
+      else
+         kernel( 0UL, rhs.lhs_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense matrices*********************************************
+   // No special implementation for the SMP multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse matrices********************************************
+   // No special implementation for the SMP multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR( MT1, MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block-compressed sparse matrix and
+//        a row-major dense matrix (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side block-compressed sparse matrix for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a block-compressed sparse matrix and a
+// row-major dense matrix:
+
+   \code
+   typedef blaze::StaticMatrix<double,3UL,3UL>  Block;
+
+   blaze::BlockCompressedMatrix<Block> A;
+   blaze::DynamicMatrix<double,blaze::rowMajor> B, C;
+   // ... Resizing and initialization
+   C = A * B;
+   \endcode
+
+// The operator returns an expression representing a dense matrix of the higher-order element
+// type of the two involved matrix element types. In case the current sizes of the two given
+// matrices don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename BT    // Type of the blocks of the left-hand side matrix
+        , typename T2 >  // Type of the right-hand side dense matrix
+inline const BSMatDMatMultExpr<BlockCompressedMatrix<BT>,T2>
+   operator*( const BlockCompressedMatrix<BT>& lhs, const DenseMatrix<T2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.columns() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   return BSMatDMatMultExpr<BlockCompressedMatrix<BT>,T2>( lhs, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,980 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/BSMatDVecMultExpr.h
+//  \brief Header file for the block sparse matrix/dense vector multiplication expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_BSMATDVECMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_BSMATDVECMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/MatVecMultExpr.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/BlockCompressedMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BSMATDVECMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for block sparse matrix-dense vector multiplications.
+// \ingroup dense_vector_expression
+//
+// The BSMatDVecMultExpr class represents the compile time expression for multiplications
+// between block-compressed sparse matrices and dense vectors. The multiplication is always
+// evaluated block row by block row: the \a M results of a block row are accumulated in a local
+// array, each non-zero block is multiplied with the according \a N elements of the dense vector
+// by means of a fixed-size kernel (only a single index is loaded per block), and the accumulated
+// results are written to the target vector exactly once. In case the element type is suited for
+// a vectorized computation, the block kernel is vectorized along the storage order of the blocks. In case a shared memory
+// parallelization is active, the block rows are distributed among the available threads.
+*/
+template< typename MT    // Type of the left-hand side block sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+class BSMatDVecMultExpr : public DenseVector< BSMatDVecMultExpr<MT,VT>, false >
+                        , private MatVecMultExpr
+                        , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ResultType     MRT;  //!< Result type of the left-hand side block sparse matrix.
+   typedef typename VT::ResultType     VRT;  //!< Result type of the right-hand side dense vector expression.
+   typedef typename MT::BlockType      MBT;  //!< Block type of the left-hand side block sparse matrix.
+   typedef typename MBT::ElementType   MET;  //!< Element type of the left-hand side block sparse matrix.
+   typedef typename VT::CompositeType  VCT;  //!< Composite type of the right-hand side dense vector expression.
+   typedef typename VRT::ElementType   VET;  //!< Element type of the right-hand side dense vector expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side dense vector expression.
+   enum { evaluateVector = IsComputation<VT>::value || RequiresEvaluation<VT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Number of rows of the blocks of the left-hand side block sparse matrix.
+   enum { M = MT::rowsPerBlock };
+
+   //! Number of columns of the blocks of the left-hand side block sparse matrix.
+   enum { N = MT::columnsPerBlock };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The block sparse matrix-dense vector multiplication is always evaluated via the \a assign
+       function family, since the block row kernel is considerably more efficient than the
+       element-wise evaluation via the subscript operator. */
+   template< typename VT2 >
+   struct UseAssign {
+      enum { value = 1 };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the blocks of the left-hand side block sparse matrix and the right-hand side dense
+       vector operand are suited for a vectorized computation of the multiplication, the nested
+       \value will be set to 1, otherwise it will be 0. */
+   template< typename T >
+   struct UseVectorizedKernel {
+      enum { value = MBT::vectorizable &&
+                     IsSame<MET,VET>::value &&
+                     IsSame<typename T::ElementType,MET>::value &&
+                     IsSame<typename MultTrait<MET,VET>::Type,MET>::value &&
+                     IntrinsicTrait<MET>::addition &&
+                     IntrinsicTrait<MET>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the multiplication can be vectorized and the blocks of the left-hand side block
+       sparse matrix are row-major matrices, the nested \value will be set to 1, otherwise it
+       will be 0. */
+   template< typename T >
+   struct UseRowMajorBlockKernel {
+      enum { value = UseVectorizedKernel<T>::value && IsRowMajorMatrix<MBT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the multiplication can be vectorized and the blocks of the left-hand side block
+       sparse matrix are column-major matrices, the nested \value will be set to 1, otherwise it
+       will be 0. */
+   template< typename T >
+   struct UseColumnMajorBlockKernel {
+      enum { value = UseVectorizedKernel<T>::value && IsColumnMajorMatrix<MBT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef BSMatDVecMultExpr<MT,VT>                    This;           //!< Type of this BSMatDVecMultExpr instance.
+   typedef typename MultTrait<MRT,VRT>::Type           ResultType;     //!< Result type for expression template evaluations.
+   typedef typename ResultType::TransposeType          TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename ResultType::ElementType            ElementType;    //!< Resulting element type.
+   typedef typename IntrinsicTrait<ElementType>::Type  IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const ElementType                           ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType                            CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side block sparse matrix.
+   typedef const MT&  LeftOperand;
+
+   //! Composite type of the right-hand side dense vector expression.
+   typedef typename SelectType< IsExpression<VT>::value, const VT, const VT& >::Type  RightOperand;
+
+   //! Type for the assignment of the right-hand side dense vector operand.
+   typedef typename SelectType< evaluateVector, const VRT, VCT >::Type  RT;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum { vectorizable = 0 };
+
+   //! Compilation switch for the expression template assignment strategy.
+   /*! The expression is evaluated in parallel by means of its own block row partitioning. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+ private:
+   //**Kernel class definition*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block row kernel of the block sparse matrix-dense vector multiplication.
+   //
+   // The Kernel class computes the results of the block rows \f$[begin..end)\f$ and assigns
+   // (\a OP == 0), adds (\a OP == 1), or subtracts (\a OP == 2) them to/from the target vector.
+   // It is used both for the serial and for the parallel evaluation via smpFor().
+   */
+   template< typename VT1  // Type of the target dense vector
+           , typename VT2  // Type of the right-hand side dense vector operand
+           , int OP >      // Type of the assignment operation
+   class Kernel
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Kernel class.
+      //
+      // \param y The target dense vector.
+      // \param A The left-hand side block sparse matrix operand.
+      // \param x The right-hand side dense vector operand.
+      */
+      explicit inline Kernel( VT1& y, const MT& A, const VT2& x )
+         : y_( y )  // The target dense vector
+         , A_( A )  // The left-hand side block sparse matrix operand
+         , x_( x )  // The right-hand side dense vector operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Computation of the block rows \f$[begin..end)\f$.
+      //
+      // \param begin The first block row to be computed.
+      // \param end The block row one past the last block row to be computed.
+      // \return void
+      */
+      inline void operator()( size_t begin, size_t end ) const {
+         BSMatDVecMultExpr::template selectKernel<OP>( y_, A_, x_, begin, end );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT1&       y_;  //!< The target dense vector.
+      const MT&  A_;  //!< The left-hand side block sparse matrix operand.
+      const VT2& x_;  //!< The right-hand side dense vector operand.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default block row kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default block row kernel of the block sparse matrix-dense vector multiplication.
+   // \ingroup dense_vector
+   //
+   // \param y The target dense vector.
+   // \param A The left-hand side block sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param begin The first block row to be computed.
+   // \param end The block row one past the last block row to be computed.
+   // \return void
+   //
+   // This function implements the default kernel for the block sparse matrix-dense vector
+   // multiplication, which is used for all element types that are not suited for a vectorized
+   // computation.
+   */
+   template< int OP          // Type of the assignment operation
+           , typename VT1    // Type of the target dense vector
+           , typename VT2 >  // Type of the right-hand side dense vector operand
+   static inline typename DisableIf< UseVectorizedKernel<VT2> >::Type
+      selectKernel( VT1& y, const MT& A, const VT2& x, size_t begin, size_t end )
+   {
+      typedef typename MT::ConstBlockIterator  ConstBlockIterator;
+
+      ElementType acc[M];
+      VET xb[N];
+
+      for( size_t i=begin; i<end; ++i )
+      {
+         for( size_t k=0UL; k<M; ++k )
+            acc[k] = ElementType();
+
+         const ConstBlockIterator last( A.blockEnd(i) );
+         for( ConstBlockIterator block=A.blockBegin(i); block!=last; ++block ) {
+            const size_t jbegin( block->index()*N );
+            for( size_t j=0UL; j<N; ++j )
+               xb[j] = x[jbegin+j];
+            for( size_t k=0UL; k<M; ++k )
+               for( size_t j=0UL; j<N; ++j )
+                  acc[k] += block->value()(k,j) * xb[j];
+         }
+
+         const size_t ibegin( i*M );
+         for( size_t k=0UL; k<M; ++k ) {
+            if( OP == 0 )      y[ibegin+k]  = acc[k];
+            else if( OP == 1 ) y[ibegin+k] += acc[k];
+            else               y[ibegin+k] -= acc[k];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized block row kernel for row-major blocks********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized block row kernel of the block sparse matrix-dense vector multiplication
+   //        for row-major blocks.
+   // \ingroup dense_vector
+   //
+   // \param y The target dense vector.
+   // \param A The left-hand side block sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param begin The first block row to be computed.
+   // \param end The block row one past the last block row to be computed.
+   // \return void
+   //
+   // This function implements the vectorized kernel for row-major blocks. The \a N elements of
+   // the vector segment of a block are gathered into an aligned, zero-padded array. Each of the
+   // \a M rows of a block row is accumulated in an intrinsic register across all blocks, and
+   // the registers are reduced only once per block row.
+   */
+   template< int OP          // Type of the assignment operation
+           , typename VT1    // Type of the target dense vector
+           , typename VT2 >  // Type of the right-hand side dense vector operand
+   static inline typename EnableIf< UseRowMajorBlockKernel<VT2> >::Type
+      selectKernel( VT1& y, const MT& A, const VT2& x, size_t begin, size_t end )
+   {
+      typedef IntrinsicTrait<ElementType>       IT;
+      typedef typename MT::ConstBlockIterator  ConstBlockIterator;
+
+      enum { NN = N + ( IT::size - N % IT::size ) % IT::size };
+
+      AlignedArray<ElementType,NN> xb;
+      for( size_t j=N; j<NN; ++j )
+         xb[j] = ElementType();
+
+      for( size_t i=begin; i<end; ++i )
+      {
+         IntrinsicType xmm[M];
+
+         const ConstBlockIterator last( A.blockEnd(i) );
+         for( ConstBlockIterator block=A.blockBegin(i); block!=last; ++block ) {
+            const size_t jbegin( block->index()*N );
+            for( size_t j=0UL; j<N; ++j )
+               xb[j] = x[jbegin+j];
+            for( size_t j=0UL; j<N; j+=IT::size ) {
+               const IntrinsicType x1( load( xb.data()+j ) );
+               for( size_t k=0UL; k<M; ++k )
+                  xmm[k] = xmm[k] + block->value().load(k,j) * x1;
+            }
+         }
+
+         const size_t ibegin( i*M );
+         for( size_t k=0UL; k<M; ++k ) {
+            if( OP == 0 )      y[ibegin+k]  = sum( xmm[k] );
+            else if( OP == 1 ) y[ibegin+k] += sum( xmm[k] );
+            else               y[ibegin+k] -= sum( xmm[k] );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized block row kernel for column-major blocks*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized block row kernel of the block sparse matrix-dense vector multiplication
+   //        for column-major blocks.
+   // \ingroup dense_vector
+   //
+   // \param y The target dense vector.
+   // \param A The left-hand side block sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param begin The first block row to be computed.
+   // \param end The block row one past the last block row to be computed.
+   // \return void
+   //
+   // This function implements the vectorized kernel for column-major blocks. The \a M results
+   // of a block row are accumulated in a set of intrinsic registers, to which each column of a
+   // block is added after a multiplication with the according broadcast vector element.
+   */
+   template< int OP          // Type of the assignment operation
+           , typename VT1    // Type of the target dense vector
+           , typename VT2 >  // Type of the right-hand side dense vector operand
+   static inline typename EnableIf< UseColumnMajorBlockKernel<VT2> >::Type
+      selectKernel( VT1& y, const MT& A, const VT2& x, size_t begin, size_t end )
+   {
+      typedef IntrinsicTrait<ElementType>       IT;
+      typedef typename MT::ConstBlockIterator  ConstBlockIterator;
+
+      enum { MM = M + ( IT::size - M % IT::size ) % IT::size };
+
+      AlignedArray<ElementType,MM> acc;
+
+      for( size_t i=begin; i<end; ++i )
+      {
+         IntrinsicType xmm[MM/IT::size];
+
+         const ConstBlockIterator last( A.blockEnd(i) );
+         for( ConstBlockIterator block=A.blockBegin(i); block!=last; ++block ) {
+            const size_t jbegin( block->index()*N );
+            for( size_t j=0UL; j<N; ++j ) {
+               const IntrinsicType x1( set( x[jbegin+j] ) );
+               for( size_t k=0UL; k<M; k+=IT::size )
+                  xmm[k/IT::size] = xmm[k/IT::size] + block->value().load(k,j) * x1;
+            }
+         }
+
+         for( size_t k=0UL; k<M; k+=IT::size )
+            store( acc.data()+k, xmm[k/IT::size] );
+
+         const size_t ibegin( i*M );
+         for( size_t k=0UL; k<M; ++k ) {
+            if( OP == 0 )      y[ibegin+k]  = acc[k];
+            else if( OP == 1 ) y[ibegin+k] += acc[k];
+            else               y[ibegin+k] -= acc[k];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BSMatDVecMultExpr class.
+   //
+   // \param mat The left-hand side block sparse matrix operand of the multiplication expression.
+   // \param vec The right-hand side dense vector operand of the multiplication expression.
+   */
+   explicit inline BSMatDVecMultExpr( const MT& mat, const VT& vec )
+      : mat_( mat )  // Left-hand side block sparse matrix of the multiplication expression
+      , vec_( vec )  // Right-hand side dense vector of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( mat_.columns() == vec_.size(), "Invalid matrix and vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
+
+      typedef typename MT::ConstBlockIterator  ConstBlockIterator;
+
+      const size_t i( index / M );
+      const size_t k( index % M );
+
+      ElementType tmp = ElementType();
+
+      const ConstBlockIterator last( mat_.blockEnd(i) );
+      for( ConstBlockIterator block=mat_.blockBegin(i); block!=last; ++block ) {
+         const size_t jbegin( block->index()*N );
+         for( size_t j=0UL; j<N; ++j )
+            tmp += block->value()(k,j) * vec_[jbegin+j];
+      }
+
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const {
+      return mat_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side block sparse matrix operand.
+   //
+   // \return The left-hand side block sparse matrix operand.
+   */
+   inline LeftOperand leftOperand() const {
+      return mat_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense vector operand.
+   //
+   // \return The right-hand side dense vector operand.
+   */
+   inline RightOperand rightOperand() const {
+      return vec_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const {
+      return vec_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( size() > SMP_BSMATDVECMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  mat_;  //!< Left-hand side block sparse matrix of the multiplication expression.
+   RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a block sparse matrix-
+   // dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      assign( DenseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<RT>::Type  VT2;
+
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      const Kernel<VT1,VT2,0> kernel( ~lhs, rhs.mat_, x );
+      kernel( 0UL, rhs.mat_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block sparse matrix-dense vector multiplication to a sparse vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a block sparse matrix-
+   // dense vector multiplication expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      assign( SparseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a block sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a block sparse
+   // matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      addAssign( DenseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<RT>::Type  VT2;
+
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      const Kernel<VT1,VT2,1> kernel( ~lhs, rhs.mat_, x );
+      kernel( 0UL, rhs.mat_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a block sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a block
+   // sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      subAssign( DenseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<RT>::Type  VT2;
+
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      const Kernel<VT1,VT2,2> kernel( ~lhs, rhs.mat_, x );
+      kernel( 0UL, rhs.mat_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a block sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}*=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a block
+   // sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      multAssign( DenseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a block sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a block sparse matrix-
+   // dense vector multiplication expression to a dense vector. In case the size of the vector
+   // exceeds the SMP_BSMATDVECMULT_THRESHOLD, the block rows are distributed among the available
+   // threads.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      smpAssign( DenseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<RT>::Type  VT2;
+
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      const Kernel<VT1,VT2,0> kernel( ~lhs, rhs.mat_, x );
+
+      if( rhs.canSMPAssign() )
+         smpFor( 0UL, rhs.mat_.blockRows(), kernel );
+      else
+         kernel( 0UL, rhs.mat_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a block sparse matrix-dense vector multiplication to a sparse
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a block sparse matrix-
+   // dense vector multiplication expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      smpAssign( SparseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a block sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a block
+   // sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      smpAddAssign( DenseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<RT>::Type  VT2;
+
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      const Kernel<VT1,VT2,1> kernel( ~lhs, rhs.mat_, x );
+
+      if( rhs.canSMPAssign() )
+         smpFor( 0UL, rhs.mat_.blockRows(), kernel );
+      else
+         kernel( 0UL, rhs.mat_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a block sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a block
+   // sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      smpSubAssign( DenseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<RT>::Type  VT2;
+
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      const Kernel<VT1,VT2,2> kernel( ~lhs, rhs.mat_, x );
+
+      if( rhs.canSMPAssign() )
+         smpFor( 0UL, rhs.mat_.blockRows(), kernel );
+      else
+         kernel( 0UL, rhs.mat_.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a block sparse matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}*=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // block sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      smpMultAssign( DenseVector<VT1,false>& lhs, const BSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( VT );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATVECMULTEXPR( MT, VT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block-compressed sparse matrix
+//        and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side block-compressed sparse matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication between a block-compressed sparse matrix and a
+// dense vector:
+
+   \code
+   typedef blaze::StaticMatrix<double,3UL,3UL>  Block;
+
+   blaze::BlockCompressedMatrix<Block> A;
+   blaze::DynamicVector<double,blaze::columnVector> x, y;
+   // ... Resizing and initialization
+   y = A * x;
+   \endcode
+
+// The operator returns an expression representing a dense vector of the higher-order element
+// type of the two involved element types. In case the current size of the vector \a vec
+// doesn't match the current number of columns of the matrix \a mat, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename BT    // Type of the blocks of the left-hand side matrix
+        , typename T2 >  // Type of the right-hand side dense vector
+inline const BSMatDVecMultExpr<BlockCompressedMatrix<BT>,T2>
+   operator*( const BlockCompressedMatrix<BT>& mat, const DenseVector<T2,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (~vec).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   return BSMatDVecMultExpr<BlockCompressedMatrix<BT>,T2>( mat, ~vec );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
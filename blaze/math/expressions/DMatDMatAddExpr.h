@@ -476,11 +476,10 @@ class DMatDMatAddExpr : public DenseMatrix< DMatDMatAddExpr<MT1,MT2,SO>, SO >
    // \return Reference to the accessed values.
    */
    BLAZE_ALWAYS_INLINE IntrinsicType load( size_t i, size_t j ) const {
-      typedef IntrinsicTrait<ElementType>  IT;
       BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
       BLAZE_INTERNAL_ASSERT( j < lhs_.columns(), "Invalid column access index" );
-      BLAZE_INTERNAL_ASSERT( !SO || ( i % IT::size == 0UL ), "Invalid row access index"    );
-      BLAZE_INTERNAL_ASSERT( SO  || ( j % IT::size == 0UL ), "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( !SO || ( i % IntrinsicTrait<ElementType>::size == 0UL ), "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( SO  || ( j % IntrinsicTrait<ElementType>::size == 0UL ), "Invalid column access index" );
       return lhs_.load(i,j) + rhs_.load(i,j);
    }
    //**********************************************************************************************
@@ -54,6 +54,7 @@
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/Intrinsics.h>
+#include <blaze/math/ScratchTemporary.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
@@ -483,7 +484,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
@@ -818,18 +821,22 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
       BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( typename MT5::OppositeType );
 
       if( !IsResizable<MT4>::value && IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          assign( ~C, tmp * B );
       }
       else if( IsResizable<MT4>::value && !IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          assign( ~C, A * tmp );
       }
       else if( A.rows() * A.columns() <= B.rows() * B.columns() ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          assign( ~C, tmp * B );
       }
       else {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          assign( ~C, A * tmp );
       }
@@ -1049,6 +1056,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      const ScratchTemporary<const TmpType> scratch;
       const TmpType tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
@@ -1118,7 +1126,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
@@ -1468,18 +1478,22 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
       BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( typename MT5::OppositeType );
 
       if( !IsResizable<MT4>::value && IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          addAssign( ~C, tmp * B );
       }
       else if( IsResizable<MT4>::value && !IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          addAssign( ~C, A * tmp );
       }
       else if( A.rows() * A.columns() <= B.rows() * B.columns() ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          addAssign( ~C, tmp * B );
       }
       else {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          addAssign( ~C, A * tmp );
       }
@@ -1743,7 +1757,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
@@ -2093,18 +2109,22 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
       BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( typename MT5::OppositeType );
 
       if( !IsResizable<MT4>::value && IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          subAssign( ~C, tmp * B );
       }
       else if( IsResizable<MT4>::value && !IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          subAssign( ~C, A * tmp );
       }
       else if( A.rows() * A.columns() <= B.rows() * B.columns() ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          subAssign( ~C, tmp * B );
       }
       else {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          subAssign( ~C, A * tmp );
       }
@@ -2382,7 +2402,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
@@ -2431,6 +2453,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      const ScratchTemporary<const TmpType> scratch;
       const TmpType tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
@@ -2503,7 +2526,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
@@ -2588,7 +2613,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
@@ -3018,7 +3045,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == left.rows()     , "Invalid number of rows"    );
@@ -3364,18 +3393,22 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
       BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( typename MT5::OppositeType );
 
       if( !IsResizable<MT4>::value && IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          assign( ~C, tmp * B * scalar );
       }
       else if( IsResizable<MT4>::value && !IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          assign( ~C, A * tmp * scalar );
       }
       else if( A.rows() * A.columns() <= B.rows() * B.columns() ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          assign( ~C, tmp * B * scalar );
       }
       else {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          assign( ~C, A * tmp * scalar );
       }
@@ -3594,6 +3627,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      const ScratchTemporary<const TmpType> scratch;
       const TmpType tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
@@ -3665,7 +3699,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == left.rows()     , "Invalid number of rows"    );
@@ -3724,6 +3760,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename DisableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      const ScratchTemporary<const ResultType> scratch;
       const ResultType tmp( serial( A * B * scalar ) );
       addAssign( C, tmp );
    }
@@ -3968,18 +4005,22 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
       BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( typename MT5::OppositeType );
 
       if( !IsResizable<MT4>::value && IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          addAssign( ~C, tmp * B * scalar );
       }
       else if( IsResizable<MT4>::value && !IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          addAssign( ~C, A * tmp * scalar );
       }
       else if( A.rows() * A.columns() <= B.rows() * B.columns() ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          addAssign( ~C, tmp * B * scalar );
       }
       else {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          addAssign( ~C, A * tmp * scalar );
       }
@@ -4245,7 +4286,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == left.rows()     , "Invalid number of rows"    );
@@ -4304,6 +4347,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename DisableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      const ScratchTemporary<const ResultType> scratch;
       const ResultType tmp( serial( A * B * scalar ) );
       subAssign( C, tmp );
    }
@@ -4549,18 +4593,22 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
       BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( typename MT5::OppositeType );
 
       if( !IsResizable<MT4>::value && IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          subAssign( ~C, tmp * B * scalar );
       }
       else if( IsResizable<MT4>::value && !IsResizable<MT5>::value ) {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          subAssign( ~C, A * tmp * scalar );
       }
       else if( A.rows() * A.columns() <= B.rows() * B.columns() ) {
+         const ScratchTemporary<const typename MT4::OppositeType> scratch;
          const typename MT4::OppositeType tmp( serial( A ) );
          subAssign( ~C, tmp * B * scalar );
       }
       else {
+         const ScratchTemporary<const typename MT5::OppositeType> scratch;
          const typename MT5::OppositeType tmp( serial( B ) );
          subAssign( ~C, A * tmp * scalar );
       }
@@ -4841,7 +4889,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == left.rows()     , "Invalid number of rows"    );
@@ -4889,6 +4939,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      const ScratchTemporary<const TmpType> scratch;
       const TmpType tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
@@ -4963,7 +5014,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == left.rows()     , "Invalid number of rows"    );
@@ -5050,7 +5103,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
+      const ScratchTemporary<RT> scratchB;
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == left.rows()     , "Invalid number of rows"    );
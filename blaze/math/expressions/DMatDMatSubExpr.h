@@ -476,11 +476,10 @@ class DMatDMatSubExpr : public DenseMatrix< DMatDMatSubExpr<MT1,MT2,SO>, SO >
    // \return Reference to the accessed values.
    */
    BLAZE_ALWAYS_INLINE IntrinsicType load( size_t i, size_t j ) const {
-      typedef IntrinsicTrait<ElementType>  IT;
       BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
       BLAZE_INTERNAL_ASSERT( j < lhs_.columns(), "Invalid column access index" );
-      BLAZE_INTERNAL_ASSERT( !SO || ( i % IT::size == 0UL ), "Invalid row access index"    );
-      BLAZE_INTERNAL_ASSERT( SO  || ( j % IT::size == 0UL ), "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( !SO || ( i % IntrinsicTrait<ElementType>::size == 0UL ), "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( SO  || ( j % IntrinsicTrait<ElementType>::size == 0UL ), "Invalid column access index" );
       const IntrinsicType xmm1( lhs_.load(i,j) );
       const IntrinsicType xmm2( rhs_.load(i,j) );
       return xmm1 - xmm2;
@@ -465,9 +465,8 @@ class DVecDVecMultExpr : public DenseVector< DVecDVecMultExpr<VT1,VT2,TF>, TF >
    // \return Reference to the accessed values.
    */
    BLAZE_ALWAYS_INLINE IntrinsicType load( size_t index ) const {
-      typedef IntrinsicTrait<ElementType>  IT;
       BLAZE_INTERNAL_ASSERT( index < lhs_.size()    , "Invalid vector access index" );
-      BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL, "Invalid vector access index" );
+      BLAZE_INTERNAL_ASSERT( index % IntrinsicTrait<ElementType>::size == 0UL, "Invalid vector access index" );
       const IntrinsicType xmm1( lhs_.load( index ) );
       const IntrinsicType xmm2( rhs_.load( index ) );
       return xmm1 * xmm2;
@@ -463,9 +463,8 @@ class DVecScalarDivExpr : public DenseVector< DVecScalarDivExpr<VT,ST,TF>, TF >
    // \return Reference to the accessed values.
    */
    BLAZE_ALWAYS_INLINE IntrinsicType load( size_t index ) const {
-      typedef IntrinsicTrait<ElementType>  IT;
       BLAZE_INTERNAL_ASSERT( index < vector_.size() , "Invalid vector access index" );
-      BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL, "Invalid vector access index" );
+      BLAZE_INTERNAL_ASSERT( index % IntrinsicTrait<ElementType>::size == 0UL, "Invalid vector access index" );
       const IntrinsicType xmm1( vector_.load( index ) );
       const IntrinsicType xmm2( set( scalar_ ) );
       return xmm1 / xmm2;
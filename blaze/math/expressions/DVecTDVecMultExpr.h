@@ -509,10 +509,9 @@ class DVecTDVecMultExpr : public DenseMatrix< DVecTDVecMultExpr<VT1,VT2>, false
    // \return Reference to the accessed values.
    */
    BLAZE_ALWAYS_INLINE IntrinsicType load( size_t i, size_t j ) const {
-      typedef IntrinsicTrait<ElementType>  IT;
       BLAZE_INTERNAL_ASSERT( i < lhs_.size()    , "Invalid row access index"    );
       BLAZE_INTERNAL_ASSERT( j < rhs_.size()    , "Invalid column access index" );
-      BLAZE_INTERNAL_ASSERT( j % IT::size == 0UL, "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( j % IntrinsicTrait<ElementType>::size == 0UL, "Invalid column access index" );
       const IntrinsicType xmm1( set( lhs_[i] ) );
       const IntrinsicType xmm2( rhs_.load( j ) );
       return xmm1 * xmm2;
@@ -418,9 +418,8 @@ class DVecTransExpr : public DenseVector< DVecTransExpr<VT,TF>, TF >
    // \return Reference to the accessed values.
    */
    BLAZE_ALWAYS_INLINE IntrinsicType load( size_t index ) const {
-      typedef IntrinsicTrait<ElementType>  IT;
       BLAZE_INTERNAL_ASSERT( index < dv_.size()      , "Invalid vector access index" );
-      BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL , "Invalid vector access index" );
+      BLAZE_INTERNAL_ASSERT( index % IntrinsicTrait<ElementType>::size == 0UL , "Invalid vector access index" );
       return dv_.load( index );
    }
    //**********************************************************************************************
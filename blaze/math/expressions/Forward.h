@@ -44,6 +44,8 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, typename > class BSMatDMatMultExpr;
+template< typename, typename > class BSMatDVecMultExpr;
 template< typename, bool > struct DenseMatrix;
 template< typename, bool > struct DenseVector;
 template< typename, bool > class DMatAbsExpr;
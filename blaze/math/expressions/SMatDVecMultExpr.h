@@ -51,6 +51,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/ScratchTemporary.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/MultExprTrait.h>
@@ -373,14 +374,14 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
-
       if( rhs.mat_.columns() == 0UL ) {
          reset( ~lhs );
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      const ScratchTemporary<RT> scratchX;
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
@@ -421,6 +422,7 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
+      const ScratchTemporary<const ResultType> scratch;
       const ResultType tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
@@ -451,13 +453,13 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
-
       if( rhs.mat_.columns() == 0UL ) {
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      const ScratchTemporary<RT> scratchX;
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
@@ -498,13 +500,13 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
-
       if( rhs.mat_.columns() == 0UL ) {
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      const ScratchTemporary<RT> scratchX;
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
@@ -549,6 +551,7 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
+      const ScratchTemporary<const ResultType> scratch;
       const ResultType tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
@@ -582,14 +585,14 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
-
       if( rhs.mat_.columns() == 0UL ) {
          reset( ~lhs );
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      const ScratchTemporary<RT> scratchX;
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
@@ -629,6 +632,7 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
+      const ScratchTemporary<const ResultType> scratch;
       const ResultType tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
@@ -658,13 +662,13 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
-
       if( rhs.mat_.columns() == 0UL ) {
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      const ScratchTemporary<RT> scratchX;
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
@@ -704,13 +708,13 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
-
       if( rhs.mat_.columns() == 0UL ) {
          return;
       }
 
+      const ScratchTemporary<LT> scratchA;
       LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      const ScratchTemporary<RT> scratchX;
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
       BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
@@ -754,6 +758,7 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
+      const ScratchTemporary<const ResultType> scratch;
       const ResultType tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
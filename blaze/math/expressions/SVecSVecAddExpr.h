@@ -51,6 +51,7 @@
 #include <blaze/math/Functions.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SetOperations.h>
 #include <blaze/math/traits/AddExprTrait.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
@@ -361,9 +362,6 @@ class SVecSVecAddExpr : public SparseVector< SVecSVecAddExpr<VT1,VT2,TF>, TF >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<CT1>::Type::ConstIterator  LeftIterator;
-      typedef typename RemoveReference<CT2>::Type::ConstIterator  RightIterator;
-
       CT1 x( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse vector operand
       CT2 y( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse vector operand
 
@@ -371,38 +369,7 @@ class SVecSVecAddExpr : public SparseVector< SVecSVecAddExpr<VT1,VT2,TF>, TF >
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const LeftIterator  lend( x.end() );
-      const RightIterator rend( y.end() );
-
-      LeftIterator  l( x.begin() );
-      RightIterator r( y.begin() );
-
-      while( l != lend && r != rend )
-      {
-         if( l->index() < r->index() ) {
-            (~lhs).append( l->index(), l->value() );
-            ++l;
-         }
-         else if( l->index() > r->index() ) {
-            (~lhs).append( r->index(), r->value() );
-            ++r;
-         }
-         else {
-            (~lhs).append( l->index(), l->value() + r->value() );
-            ++l;
-            ++r;
-         }
-      }
-
-      while( l != lend ) {
-         (~lhs).append( l->index(), l->value() );
-         ++l;
-      }
-
-      while( r != rend ) {
-         (~lhs).append( r->index(), r->value() );
-         ++r;
-      }
+      sparseMergeAdd( ~lhs, x.begin(), x.end(), y.begin(), y.end() );
    }
    /*! \endcond */
    //**********************************************************************************************
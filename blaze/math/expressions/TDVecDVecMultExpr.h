@@ -41,9 +41,12 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/math/Accumulation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -89,6 +92,175 @@ struct TDVecDVecMultExprHelper
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the default inner product of a range of two dense vectors.
+// \ingroup dense_vector
+//
+// The TDVecDVecMultKernel class template computes the inner product of the elements
+// \f$[begin..end)\f$ of two dense vectors. The partial products are summed up according to the
+// given accumulation scheme \a A.
+*/
+template< typename CT1         // Composite type of the left-hand side dense vector
+        , typename CT2         // Composite type of the right-hand side dense vector
+        , typename RT          // Result type of the inner product
+        , Accumulation A >     // Accumulation scheme
+struct TDVecDVecMultKernel
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TDVecDVecMultKernel class template.
+   //
+   // \param lhs The left-hand side dense vector for the inner product.
+   // \param rhs The right-hand side dense vector for the inner product.
+   */
+   explicit inline TDVecDVecMultKernel( const CT1& lhs, const CT2& rhs )
+      : lhs_( lhs )  // Left-hand side dense vector of the inner product
+      , rhs_( rhs )  // Right-hand side dense vector of the inner product
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the inner product of the given range.
+   //
+   // \param begin The first index of the range.
+   // \param end The index one past the last index of the range.
+   // \return The inner product of the given range.
+   */
+   inline const RT operator()( size_t begin, size_t end ) const {
+      Accumulator<RT,A> sp;
+      for( size_t i=begin; i<end; ++i )
+         sp += lhs_[i] * rhs_[i];
+      return sp.result();
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const CT1& lhs_;  //!< Left-hand side dense vector of the inner product.
+   const CT2& rhs_;  //!< Right-hand side dense vector of the inner product.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TDVecDVecMultKernel class template for plain accumulation.
+// \ingroup dense_vector
+*/
+template< typename CT1  // Composite type of the left-hand side dense vector
+        , typename CT2  // Composite type of the right-hand side dense vector
+        , typename RT > // Result type of the inner product
+struct TDVecDVecMultKernel<CT1,CT2,RT,plainAccumulation>
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TDVecDVecMultKernel class template.
+   //
+   // \param lhs The left-hand side dense vector for the inner product.
+   // \param rhs The right-hand side dense vector for the inner product.
+   */
+   explicit inline TDVecDVecMultKernel( const CT1& lhs, const CT2& rhs )
+      : lhs_( lhs )  // Left-hand side dense vector of the inner product
+      , rhs_( rhs )  // Right-hand side dense vector of the inner product
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the inner product of the given (non-empty) range.
+   //
+   // \param begin The first index of the range.
+   // \param end The index one past the last index of the range.
+   // \return The inner product of the given range.
+   */
+   inline const RT operator()( size_t begin, size_t end ) const {
+      BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range detected" );
+
+      RT sp( lhs_[begin] * rhs_[begin] );
+
+      for( size_t i=begin+1UL; i<end; ++i )
+         sp += lhs_[i] * rhs_[i];
+
+      return sp;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const CT1& lhs_;  //!< Left-hand side dense vector of the inner product.
+   const CT2& rhs_;  //!< Right-hand side dense vector of the inner product.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the intrinsic optimized inner product of a range of two dense
+//        vectors.
+// \ingroup dense_vector
+//
+// The given range has to start at a multiple of the number of elements per intrinsic element.
+*/
+template< typename CT1  // Composite type of the left-hand side dense vector
+        , typename CT2  // Composite type of the right-hand side dense vector
+        , typename RT > // Result type of the inner product
+struct TDVecDVecMultIntrinsicKernel
+{
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<RT>  IT;  //!< Intrinsic trait for the result type.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TDVecDVecMultIntrinsicKernel class template.
+   //
+   // \param lhs The left-hand side dense vector for the inner product.
+   // \param rhs The right-hand side dense vector for the inner product.
+   */
+   explicit inline TDVecDVecMultIntrinsicKernel( const CT1& lhs, const CT2& rhs )
+      : lhs_( lhs )  // Left-hand side dense vector of the inner product
+      , rhs_( rhs )  // Right-hand side dense vector of the inner product
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the inner product of the given range.
+   //
+   // \param begin The first index of the range.
+   // \param end The index one past the last index of the range.
+   // \return The inner product of the given range.
+   */
+   inline const RT operator()( size_t begin, size_t end ) const {
+      BLAZE_INTERNAL_ASSERT( begin % IT::size == 0UL, "Invalid range detected" );
+
+      typename IT::Type xmm1, xmm2, xmm3, xmm4;
+
+      const size_t iend( end - ( end - begin ) % (IT::size*4UL) );
+
+      for( size_t i=begin; i<iend; i+=IT::size*4UL ) {
+         xmm1 = xmm1 + ( lhs_.load(i             ) * rhs_.load(i             ) );
+         xmm2 = xmm2 + ( lhs_.load(i+IT::size    ) * rhs_.load(i+IT::size    ) );
+         xmm3 = xmm3 + ( lhs_.load(i+IT::size*2UL) * rhs_.load(i+IT::size*2UL) );
+         xmm4 = xmm4 + ( lhs_.load(i+IT::size*3UL) * rhs_.load(i+IT::size*3UL) );
+      }
+
+      RT sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+
+      for( size_t i=iend; i<end; ++i )
+         sp += lhs_[i] * rhs_[i];
+
+      return sp;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const CT1& lhs_;  //!< Left-hand side dense vector of the inner product.
+   const CT2& rhs_;  //!< Right-hand side dense vector of the inner product.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -140,17 +312,17 @@ inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
    typedef typename T2::ElementType           ET2;
    typedef typename MultTrait<ET1,ET2>::Type  MultType;
 
+   typedef typename RemoveReference<Lhs>::Type  CT1;
+   typedef typename RemoveReference<Rhs>::Type  CT2;
+
    if( (~lhs).size() == 0UL ) return MultType();
 
    Lhs left ( ~lhs );
    Rhs right( ~rhs );
 
-   MultType sp( left[0UL] * right[0UL] );
+   const TDVecDVecMultKernel<CT1,CT2,MultType,ReductionAccumulation<MultType>::value> kernel( left, right );
 
-   for( size_t i=1UL; i<left.size(); ++i )
-      sp += left[i] * right[i];
-
-   return sp;
+   return smpReduce<MultType>( left.size(), kernel, left.size() > SMP_DVECDVECMULT_THRESHOLD );
 }
 //*************************************************************************************************
 
@@ -199,31 +371,25 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
    typedef typename T1::ElementType           ET1;
    typedef typename T2::ElementType           ET2;
    typedef typename MultTrait<ET1,ET2>::Type  MultType;
-   typedef IntrinsicTrait<MultType>           IT;
+   typedef typename RemoveReference<Lhs>::Type  CT1;
+   typedef typename RemoveReference<Rhs>::Type  CT2;
 
    if( (~lhs).size() == 0UL ) return MultType();
 
    Lhs left ( ~lhs );
    Rhs right( ~rhs );
 
-   typename IT::Type xmm1, xmm2, xmm3, xmm4;
-
-   const size_t N  ( left.size() );
-   const size_t end( N - N % (IT::size*4UL) );
+   const size_t N( left.size() );
+   const bool parallel( N > SMP_DVECDVECMULT_THRESHOLD );
 
-   for( size_t i=0UL; i<end; i+=IT::size*4UL ) {
-      xmm1 = xmm1 + ( left.load(i             ) * right.load(i             ) );
-      xmm2 = xmm2 + ( left.load(i+IT::size    ) * right.load(i+IT::size    ) );
-      xmm3 = xmm3 + ( left.load(i+IT::size*2UL) * right.load(i+IT::size*2UL) );
-      xmm4 = xmm4 + ( left.load(i+IT::size*3UL) * right.load(i+IT::size*3UL) );
+   if( ReductionAccumulation<MultType>::value == plainAccumulation ) {
+      const TDVecDVecMultIntrinsicKernel<CT1,CT2,MultType> kernel( left, right );
+      return smpReduce<MultType>( N, kernel, parallel );
+   }
+   else {
+      const TDVecDVecMultKernel<CT1,CT2,MultType,ReductionAccumulation<MultType>::value> kernel( left, right );
+      return smpReduce<MultType>( N, kernel, parallel );
    }
-
-   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
-
-   for( size_t i=end; i<N; ++i )
-      sp += left[i] * right[i];
-
-   return sp;
 }
 //*************************************************************************************************
 
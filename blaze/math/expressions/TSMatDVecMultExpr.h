@@ -477,8 +477,6 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
-
       if( rhs.mat_.columns() == 0UL ) return;
 
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
@@ -704,8 +702,6 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
-
       if( rhs.mat_.columns() == 0UL ) return;
 
       LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
@@ -179,7 +179,6 @@ class TSMatSVecMultExpr : public SparseVector< TSMatSVecMultExpr<MT,VT>, false >
    inline ReturnType operator[]( size_t index ) const {
       BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
 
-      typedef typename RemoveReference<MCT>::Type::ConstIterator  MatrixIterator;
       typedef typename RemoveReference<VCT>::Type::ConstIterator  VectorIterator;
 
       MCT A( mat_ );  // Evaluation of the left-hand side sparse matrix operand
@@ -44,6 +44,7 @@
 #include <blaze/math/constraints/SparseVector.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/sparse/SetOperations.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/Types.h>
@@ -100,8 +101,6 @@ inline const typename MultTrait<typename T1::ElementType,typename T2::ElementTyp
    typedef typename X1::ElementType             E1;             // Element type of the left-hand side sparse vector expression
    typedef typename X2::ElementType             E2;             // Element type of the right-hand side sparse vector expression
    typedef typename MultTrait<E1,E2>::Type      MultType;       // Multiplication result type
-   typedef typename X1::ConstIterator           LeftIterator;   // Iterator type of the left-hand sparse vector expression
-   typedef typename X2::ConstIterator           RightIterator;  // Iterator type of the right-hand sparse vector expression
 
    BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( T1 );
    BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( T2 );
@@ -115,30 +114,7 @@ inline const typename MultTrait<typename T1::ElementType,typename T2::ElementTyp
 
    Lhs left ( ~lhs );
    Rhs right( ~rhs );
-   const LeftIterator  lend( left.end()  );
-   const RightIterator rend( right.end() );
-   LeftIterator  l( left.begin()  );
-   RightIterator r( right.begin() );
-   MultType sp = MultType();
-
-   for( ; l!=lend && r!=rend; ++l ) {
-      while( r->index() < l->index() && ++r != rend ) {}
-      if( r!=rend && l->index() == r->index() ) {
-         sp = l->value() * r->value();
-         ++r;
-         break;
-      }
-   }
-
-   for( ; l!=lend && r!=rend; ++l ) {
-      while( r->index() < l->index() && ++r != rend ) {}
-      if( r!=rend && l->index() == r->index() ) {
-         sp += l->value() * r->value();
-         ++r;
-      }
-   }
-
-   return sp;
+   return sparseDot<MultType>( left.begin(), left.end(), right.begin(), right.end() );
 }
 //*************************************************************************************************
 
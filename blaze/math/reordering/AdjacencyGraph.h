@@ -0,0 +1,348 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/reordering/AdjacencyGraph.h
+//  \brief Header file for the AdjacencyGraph class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REORDERING_ADJACENCYGRAPH_H_
+#define _BLAZE_MATH_REORDERING_ADJACENCYGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adjacency graph of the sparsity pattern of a square sparse matrix.
+// \ingroup reordering
+//
+// The AdjacencyGraph class stores the undirected graph of the symmetrized sparsity pattern
+// \f$ A + A^T \f$ of a square sparse matrix without self-loops. It provides the breadth-first
+// level structures that are the basis of the reordering algorithms. Note that the level
+// structure functions are not thread-safe, since they share an internal marker array.
+*/
+class AdjacencyGraph
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::vector<size_t>::const_iterator  ConstIterator;  //!< Iterator over the neighbors of a vertex.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename Type, bool SO >
+   explicit inline AdjacencyGraph( const CompressedMatrix<Type,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Graph functions*****************************************************************************
+   /*!\name Graph functions */
+   //@{
+   inline size_t        size  () const;
+   inline size_t        degree( size_t v ) const;
+   inline ConstIterator begin ( size_t v ) const;
+   inline ConstIterator end   ( size_t v ) const;
+
+   inline size_t levelStructure( size_t root, const size_t* mask, size_t label,
+                                 std::vector<size_t>& order, std::vector<size_t>& levels ) const;
+
+   inline size_t pseudoPeripheralNode( size_t start, const size_t* mask, size_t label,
+                                       std::vector<size_t>& order, std::vector<size_t>& levels ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t>         offsets_;    //!< The start of the adjacency list of each vertex.
+   std::vector<size_t>         adjacency_;  //!< The concatenated adjacency lists.
+   mutable std::vector<size_t> marker_;     //!< Visit marker of the level structure functions.
+   mutable size_t              stamp_;      //!< The current visit stamp.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the adjacency graph of the given square sparse matrix.
+//
+// \param A The square sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline AdjacencyGraph::AdjacencyGraph( const CompressedMatrix<Type,SO>& A )
+   : offsets_  ( A.rows()+1UL, 0UL )  // The start of the adjacency list of each vertex
+   , adjacency_()                     // The concatenated adjacency lists
+   , marker_   ( A.rows(), 0UL )      // Visit marker of the level structure functions
+   , stamp_    ( 0UL )                // The current visit stamp
+{
+   typedef typename CompressedMatrix<Type,SO>::ConstIterator  MatrixIterator;
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( A.rows() );
+
+   // Counting the edges of both the pattern and the transposed pattern
+   for( size_t i=0UL; i<n; ++i ) {
+      for( MatrixIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         if( element->index() == i ) continue;
+         ++offsets_[i+1UL];
+         ++offsets_[element->index()+1UL];
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      offsets_[i+1UL] += offsets_[i];
+   }
+
+   // Scattering the edges
+   adjacency_.resize( offsets_[n] );
+   std::vector<size_t> pos( offsets_.begin(), offsets_.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( MatrixIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         if( element->index() == i ) continue;
+         adjacency_[pos[i]++] = element->index();
+         adjacency_[pos[element->index()]++] = i;
+      }
+   }
+
+   // Removing duplicate edges of structurally symmetric entries
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      const std::vector<size_t>::iterator first( adjacency_.begin()+offsets_[i] );
+      const std::vector<size_t>::iterator last ( adjacency_.begin()+offsets_[i+1UL] );
+      std::sort( first, last );
+      const std::vector<size_t>::iterator unique( std::unique( first, last ) );
+      offsets_[i] = nonzeros;
+      nonzeros = std::copy( first, unique, adjacency_.begin()+nonzeros ) - adjacency_.begin();
+   }
+   offsets_[n] = nonzeros;
+   adjacency_.resize( nonzeros );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GRAPH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of vertices of the graph.
+//
+// \return The number of vertices.
+*/
+inline size_t AdjacencyGraph::size() const
+{
+   return offsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of neighbors of vertex \a v.
+//
+// \param v The vertex \f$[0..N-1]\f$.
+// \return The number of neighbors of vertex \a v.
+*/
+inline size_t AdjacencyGraph::degree( size_t v ) const
+{
+   BLAZE_USER_ASSERT( v < size(), "Invalid vertex access index" );
+   return offsets_[v+1UL] - offsets_[v];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first neighbor of vertex \a v.
+//
+// \param v The vertex \f$[0..N-1]\f$.
+// \return Iterator to the first neighbor of vertex \a v.
+*/
+inline AdjacencyGraph::ConstIterator AdjacencyGraph::begin( size_t v ) const
+{
+   BLAZE_USER_ASSERT( v < size(), "Invalid vertex access index" );
+   return adjacency_.begin() + offsets_[v];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last neighbor of vertex \a v.
+//
+// \param v The vertex \f$[0..N-1]\f$.
+// \return Iterator just past the last neighbor of vertex \a v.
+*/
+inline AdjacencyGraph::ConstIterator AdjacencyGraph::end( size_t v ) const
+{
+   BLAZE_USER_ASSERT( v < size(), "Invalid vertex access index" );
+   return adjacency_.begin() + offsets_[v+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the breadth-first level structure rooted at the given vertex.
+//
+// \param root The root vertex of the level structure.
+// \param mask Optional vertex labels restricting the traversal (may be \a NULL).
+// \param label The label of the vertices of the traversed subgraph.
+// \param order The vertices of the level structure in breadth-first order.
+// \param levels The start of each level within \a order followed by the total number of vertices.
+// \return The number of levels of the level structure.
+//
+// In case a \a mask is given, only the vertices \a v with \f$ mask[v] = label \f$ are traversed.
+*/
+inline size_t AdjacencyGraph::levelStructure( size_t root, const size_t* mask, size_t label,
+                                              std::vector<size_t>& order,
+                                              std::vector<size_t>& levels ) const
+{
+   BLAZE_USER_ASSERT( root < size(), "Invalid root vertex" );
+   BLAZE_USER_ASSERT( mask == NULL || mask[root] == label, "Invalid root vertex" );
+
+   const size_t stamp( ++stamp_ );
+
+   order.clear();
+   levels.clear();
+
+   order.push_back( root );
+   marker_[root] = stamp;
+
+   size_t first( 0UL );
+
+   while( first < order.size() )
+   {
+      const size_t last( order.size() );
+      levels.push_back( first );
+
+      for( size_t k=first; k<last; ++k ) {
+         for( ConstIterator w=begin( order[k] ); w!=end( order[k] ); ++w ) {
+            if( marker_[*w] == stamp || ( mask != NULL && mask[*w] != label ) ) continue;
+            marker_[*w] = stamp;
+            order.push_back( *w );
+         }
+      }
+
+      first = last;
+   }
+
+   levels.push_back( order.size() );
+
+   return levels.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a pseudo-peripheral vertex of the connected component of the given vertex.
+//
+// \param start The start vertex of the search.
+// \param mask Optional vertex labels restricting the search (may be \a NULL).
+// \param label The label of the vertices of the searched subgraph.
+// \param order The vertices of the level structure of the returned vertex in breadth-first order.
+// \param levels The start of each level within \a order followed by the total number of vertices.
+// \return The pseudo-peripheral vertex.
+//
+// This function implements the algorithm by Gibbs, Poole and Stockmeyer in the variant by George
+// and Liu: Starting from \a start, the vertex of minimum degree of the last level of the current
+// level structure is selected as new root as long as this increases the number of levels. On
+// return, \a order and \a levels contain the level structure rooted at the returned vertex.
+*/
+inline size_t AdjacencyGraph::pseudoPeripheralNode( size_t start, const size_t* mask, size_t label,
+                                                    std::vector<size_t>& order,
+                                                    std::vector<size_t>& levels ) const
+{
+   size_t root( start );
+   size_t height( levelStructure( root, mask, label, order, levels ) );
+
+   while( true )
+   {
+      size_t candidate( order[levels[height-1UL]] );
+      for( size_t k=levels[height-1UL]+1UL; k<levels[height]; ++k ) {
+         if( degree( order[k] ) < degree( candidate ) )
+            candidate = order[k];
+      }
+
+      std::vector<size_t> candidateOrder, candidateLevels;
+      const size_t candidateHeight( levelStructure( candidate, mask, label, candidateOrder, candidateLevels ) );
+
+      if( candidateHeight <= height )
+         break;
+
+      root   = candidate;
+      height = candidateHeight;
+      order.swap( candidateOrder );
+      levels.swap( candidateLevels );
+   }
+
+   return root;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
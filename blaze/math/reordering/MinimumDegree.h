@@ -0,0 +1,413 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/reordering/MinimumDegree.h
+//  \brief Header file for the approximate minimum degree ordering
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REORDERING_MINIMUMDEGREE_H_
+#define _BLAZE_MATH_REORDERING_MINIMUMDEGREE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <blaze/math/Functions.h>
+#include <blaze/math/reordering/AdjacencyGraph.h>
+#include <blaze/math/reordering/PermutationVector.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Doubly linked lists of the vertices of a quotient graph sorted by their degree.
+// \ingroup reordering
+//
+// The DegreeLists class provides constant time insertion and removal of vertices and the
+// selection of a vertex of minimum degree as required by minimum degree orderings.
+*/
+class DegreeLists
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DegreeLists( size_t n )
+      : head_( n+1UL, n )  // The first vertex of each degree list
+      , next_( n, n )      // The successor of each vertex
+      , prev_( n, n )      // The predecessor of each vertex
+      , min_ ( 0UL )       // The lower bound for the minimum degree
+   {}
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void insert( size_t v, size_t degree ) {
+      BLAZE_INTERNAL_ASSERT( degree < head_.size(), "Invalid vertex degree" );
+      const size_t n( next_.size() );
+      next_[v] = head_[degree];
+      prev_[v] = n;
+      if( head_[degree] != n ) prev_[head_[degree]] = v;
+      head_[degree] = v;
+      min_ = min( min_, degree );
+   }
+
+   inline void remove( size_t v, size_t degree ) {
+      const size_t n( next_.size() );
+      if( next_[v] != n ) prev_[next_[v]] = prev_[v];
+      if( prev_[v] != n ) next_[prev_[v]] = next_[v];
+      else head_[degree] = next_[v];
+   }
+
+   inline size_t minimum() {
+      const size_t n( next_.size() );
+      while( head_[min_] == n ) ++min_;
+      return head_[min_];
+   }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> head_;  //!< The first vertex of each degree list.
+   std::vector<size_t> next_;  //!< The successor of each vertex within its degree list.
+   std::vector<size_t> prev_;  //!< The predecessor of each vertex within its degree list.
+   size_t min_;                //!< The lower bound for the minimum degree.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPROXIMATE MINIMUM DEGREE ORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the fill reducing approximate minimum degree ordering of a square sparse matrix.
+// \ingroup reordering
+//
+// \param A The square sparse matrix.
+// \return The new-to-old mapping of the approximate minimum degree ordering.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the approximate minimum degree (AMD) ordering by Amestoy, Davis and
+// Duff of the symmetrized sparsity pattern \f$ A + A^T \f$ of the given square sparse matrix.
+// The elimination is simulated on a quotient graph, in which each eliminated vertex becomes an
+// element that represents the clique of its neighbors. Instead of the exact external degree,
+// the vertex of minimum approximate degree
+
+      \f[ \bar{d}_i = \min \left( n-k, \bar{d}_i^{old} + |L_p \setminus i|, |A_i \setminus i|
+                      + |L_p \setminus i| + \sum_{e \in E_i \setminus p} |L_e \setminus L_p| \right) \f]
+
+// is eliminated in each step, which can be computed in time proportional to the size of the
+// quotient graph. Elements that are covered by the new element are absorbed and vertices with
+// identical adjacency are merged into supervariables, which are eliminated at once. Vertices
+// with more than \f$ \max(16,10\sqrt{n}) \f$ neighbors are considered dense and are ordered last.
+// For the Cholesky factorization of sparse matrices the AMD ordering usually results in less
+// fill-in than the nestedDissection() ordering for small and medium problem sizes:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Initialization
+
+   const blaze::PermutationMatrix P( blaze::approximateMinimumDegree( A ) );
+   const blaze::CompressedMatrix<double> B( permute( A, P ) );
+   \endcode
+
+// In case the given matrix is not square, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+const PermutationVector approximateMinimumDegree( const CompressedMatrix<Type,SO>& A )
+{
+   typedef std::vector<size_t>        Indices;
+   typedef std::pair<size_t,size_t>  HashEntry;
+
+   enum { variable, element, absorbed, merged, dense };
+
+   const AdjacencyGraph graph( A );
+   const size_t n( graph.size() );
+   const size_t npos( n );
+
+   std::vector<Indices> elements ( n );        // The adjacent elements of each variable
+   std::vector<Indices> variables( n );        // The adjacent variables of each variable or element
+   std::vector<int>     state    ( n, variable );
+   std::vector<size_t>  weight   ( n, 1UL );   // The number of vertices of each supervariable
+   std::vector<size_t>  degree   ( n, 0UL );   // The approximate degree of each variable
+   std::vector<size_t>  external ( n, npos );  // The value |Le \ Lp| of each element
+   std::vector<size_t>  marker   ( n, 0UL );
+   std::vector<size_t>  first    ( n, npos );  // The first merged vertex of each vertex
+   std::vector<size_t>  last     ( n, npos );  // The last merged vertex of each vertex
+   std::vector<size_t>  next     ( n, npos );  // The next merged vertex of each merged vertex
+   Indices pivots, front, touched;
+   std::vector<HashEntry> hashes;
+   size_t stamp( 0UL );
+
+   DegreeLists lists( n );
+
+   // Setting up the quotient graph without dense vertices
+   const size_t threshold( max( 16UL, static_cast<size_t>( 10.0*std::sqrt( static_cast<double>( n ) ) ) ) );
+   size_t remaining( 0UL );
+
+   for( size_t v=0UL; v<n; ++v ) {
+      if( graph.degree( v ) > threshold ) state[v] = dense;
+      else ++remaining;
+   }
+
+   for( size_t v=0UL; v<n; ++v ) {
+      if( state[v] == dense ) continue;
+      for( AdjacencyGraph::ConstIterator w=graph.begin( v ); w!=graph.end( v ); ++w ) {
+         if( state[*w] != dense ) variables[v].push_back( *w );
+      }
+      degree[v] = variables[v].size();
+      lists.insert( v, degree[v] );
+   }
+
+   while( remaining > 0UL )
+   {
+      // Selecting the pivot of minimum approximate degree
+      const size_t p( lists.minimum() );
+      lists.remove( p, degree[p] );
+      remaining -= weight[p];
+      pivots.push_back( p );
+
+      // Constructing the new element Lp as union of the adjacent variables and elements of p
+      marker[p] = ++stamp;
+      front.clear();
+
+      for( size_t k=0UL; k<variables[p].size(); ++k ) {
+         const size_t i( variables[p][k] );
+         if( state[i] != variable || marker[i] == stamp ) continue;
+         marker[i] = stamp;
+         front.push_back( i );
+      }
+
+      for( size_t k=0UL; k<elements[p].size(); ++k ) {
+         const size_t e( elements[p][k] );
+         if( state[e] != element ) continue;
+         for( size_t l=0UL; l<variables[e].size(); ++l ) {
+            const size_t i( variables[e][l] );
+            if( state[i] != variable || marker[i] == stamp ) continue;
+            marker[i] = stamp;
+            front.push_back( i );
+         }
+         state[e] = absorbed;
+         Indices().swap( variables[e] );
+      }
+
+      state[p] = element;
+      Indices().swap( elements[p] );
+      Indices().swap( variables[p] );
+
+      size_t size( 0UL );
+      for( size_t k=0UL; k<front.size(); ++k ) {
+         lists.remove( front[k], degree[front[k]] );
+         size += weight[front[k]];
+      }
+
+      // Computing |Le \ Lp| for all elements adjacent to Lp
+      touched.clear();
+      for( size_t k=0UL; k<front.size(); ++k ) {
+         const size_t i( front[k] );
+         for( size_t l=0UL; l<elements[i].size(); ++l ) {
+            const size_t e( elements[i][l] );
+            if( state[e] != element ) continue;
+            if( external[e] == npos ) {
+               external[e] = degree[e];
+               touched.push_back( e );
+            }
+            external[e] -= weight[i];
+         }
+      }
+
+      // Pruning the adjacency of the variables of Lp and computing the degree bounds
+      hashes.clear();
+      for( size_t k=0UL; k<front.size(); ++k )
+      {
+         const size_t i( front[k] );
+         size_t bound( 0UL ), hash( 0UL ), count( 0UL );
+
+         for( size_t l=0UL; l<elements[i].size(); ++l ) {
+            const size_t e( elements[i][l] );
+            if( state[e] != element ) continue;
+            if( external[e] == 0UL ) {  // Aggressive absorption of elements covered by Lp
+               state[e] = absorbed;
+               Indices().swap( variables[e] );
+               continue;
+            }
+            bound += external[e];
+            hash  += e;
+            elements[i][count++] = e;
+         }
+         elements[i].resize( count );
+
+         count = 0UL;
+         for( size_t l=0UL; l<variables[i].size(); ++l ) {
+            const size_t j( variables[i][l] );
+            if( state[j] != variable || marker[j] == stamp ) continue;
+            bound += weight[j];
+            hash  += j;
+            variables[i][count++] = j;
+         }
+         variables[i].resize( count );
+
+         // Mass elimination of variables that are only adjacent to the new element
+         if( elements[i].empty() && variables[i].empty() ) {
+            remaining -= weight[i];
+            weight[p] += weight[i];
+            weight[i] = 0UL;
+            state[i] = merged;
+            Indices().swap( variables[i] );
+            next[i] = first[i];
+            if( last[p] == npos ) first[p] = i;
+            else next[last[p]] = i;
+            last[p] = ( last[i] != npos )?( last[i] ):( i );
+            continue;
+         }
+
+         elements[i].push_back( p );
+         hashes.push_back( HashEntry( ( hash + p ) % n, i ) );
+         external[i] = bound;
+      }
+
+      // Merging indistinguishable variables into supervariables
+      std::sort( hashes.begin(), hashes.end() );
+
+      for( size_t k=0UL; k<hashes.size(); ++k )
+      {
+         const size_t i( hashes[k].second );
+         if( state[i] != variable ) continue;
+
+         bool flagged( false );
+
+         for( size_t l=k+1UL; l<hashes.size() && hashes[l].first == hashes[k].first; ++l )
+         {
+            const size_t j( hashes[l].second );
+            if( state[j] != variable ||
+                elements[i].size() != elements[j].size() ||
+                variables[i].size() != variables[j].size() ) continue;
+
+            if( !flagged ) {
+               ++stamp;
+               for( size_t m=0UL; m<elements[i].size(); ++m )  marker[elements[i][m]]  = stamp;
+               for( size_t m=0UL; m<variables[i].size(); ++m ) marker[variables[i][m]] = stamp;
+               flagged = true;
+            }
+
+            bool identical( true );
+            for( size_t m=0UL; identical && m<elements[j].size(); ++m )  identical = ( marker[elements[j][m]]  == stamp );
+            for( size_t m=0UL; identical && m<variables[j].size(); ++m ) identical = ( marker[variables[j][m]] == stamp );
+            if( !identical ) continue;
+
+            weight[i] += weight[j];
+            weight[j] = 0UL;
+            state[j] = merged;
+            Indices().swap( elements[j] );
+            Indices().swap( variables[j] );
+            next[j] = first[j];
+            if( last[i] == npos ) first[i] = j;
+            else next[last[i]] = j;
+            last[i] = ( last[j] != npos )?( last[j] ):( j );
+         }
+      }
+
+      // Finalizing the new element and the approximate degrees of its variables
+      size = 0UL;
+      size_t count( 0UL );
+      for( size_t k=0UL; k<front.size(); ++k ) {
+         if( state[front[k]] != variable ) continue;
+         size += weight[front[k]];
+         front[count++] = front[k];
+      }
+      front.resize( count );
+
+      for( size_t k=0UL; k<front.size(); ++k ) {
+         const size_t i( front[k] );
+         const size_t others( size - weight[i] );
+         degree[i] = min( remaining - weight[i], min( degree[i], external[i] ) + others );
+         external[i] = npos;
+         lists.insert( i, degree[i] );
+      }
+
+      degree[p] = size;
+      variables[p] = front;
+
+      for( size_t k=0UL; k<touched.size(); ++k ) {
+         external[touched[k]] = npos;
+      }
+   }
+
+   // Assembling the ordering from the pivots and their merged vertices
+   Indices order;
+   order.reserve( n );
+
+   for( size_t k=0UL; k<pivots.size(); ++k ) {
+      order.push_back( pivots[k] );
+      for( size_t v=first[pivots[k]]; v!=npos; v=next[v] ) {
+         order.push_back( v );
+      }
+   }
+
+   for( size_t v=0UL; v<n; ++v ) {
+      if( state[v] == dense ) order.push_back( v );
+   }
+
+   return PermutationVector( order.begin(), order.end() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,169 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/reordering/NestedDissection.h
+//  \brief Header file for the nested dissection ordering
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REORDERING_NESTEDDISSECTION_H_
+#define _BLAZE_MATH_REORDERING_NESTEDDISSECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/reordering/AdjacencyGraph.h>
+#include <blaze/math/reordering/PermutationVector.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NESTED DISSECTION ORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the fill reducing nested dissection ordering of a square sparse matrix.
+// \ingroup reordering
+//
+// \param A The square sparse matrix.
+// \param minSize The size of the subgraphs that are not dissected any further.
+// \return The new-to-old mapping of the nested dissection ordering.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a nested dissection ordering of the symmetrized sparsity pattern
+// \f$ A + A^T \f$ of the given square sparse matrix. The graph is recursively split by the level
+// of the breadth-first level structure rooted at a pseudo-peripheral vertex that divides the
+// vertices into two halves. The vertices of each separator are ordered after the vertices of
+// the two parts they separate, such that a subsequent factorization of the permuted matrix
+// \f$ P A P^T \f$ (as for instance an incomplete Cholesky factorization) does not create fill-in
+// between the two parts. Connected components are ordered separately and subgraphs with at most
+// \a minSize vertices or without a proper separator are kept in breadth-first order.
+//
+// In case the given matrix is not square, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+const PermutationVector nestedDissection( const CompressedMatrix<Type,SO>& A, size_t minSize = 64UL )
+{
+   typedef std::pair<size_t,size_t>  Range;
+
+   const AdjacencyGraph graph( A );
+   const size_t n( graph.size() );
+
+   // The vertices of each pending subgraph are stored in a contiguous range of the final order
+   std::vector<size_t> order( n ), mask( n, 0UL ), bfs, levels;
+   for( size_t v=0UL; v<n; ++v ) {
+      order[v] = v;
+   }
+
+   std::vector<Range> ranges;
+   size_t label( 0UL );
+
+   if( n > 0UL )
+      ranges.push_back( Range( 0UL, n ) );
+
+   while( !ranges.empty() )
+   {
+      const size_t first( ranges.back().first  );
+      const size_t last ( ranges.back().second );
+      const size_t size ( last - first );
+      ranges.pop_back();
+
+      if( size <= minSize || size < 3UL )
+         continue;
+
+      ++label;
+      for( size_t k=first; k<last; ++k ) {
+         mask[order[k]] = label;
+      }
+
+      graph.pseudoPeripheralNode( order[first], &mask[0], label, bfs, levels );
+
+      const size_t height ( levels.size() - 1UL );
+      const size_t reached( bfs.size() );
+
+      // Splitting off the connected component of the pseudo-peripheral vertex
+      if( reached < size ) {
+         std::vector<size_t> rest;
+         rest.reserve( size - reached );
+         ++label;
+         for( size_t k=0UL; k<reached; ++k ) {
+            mask[bfs[k]] = label;
+         }
+         for( size_t k=first; k<last; ++k ) {
+            if( mask[order[k]] != label ) rest.push_back( order[k] );
+         }
+         std::copy( bfs.begin(), bfs.end(), order.begin()+first );
+         std::copy( rest.begin(), rest.end(), order.begin()+first+reached );
+         ranges.push_back( Range( first+reached, last ) );
+         ranges.push_back( Range( first, first+reached ) );
+         continue;
+      }
+
+      // Subgraphs without a proper separator are kept in breadth-first order
+      if( height < 3UL ) {
+         std::copy( bfs.begin(), bfs.end(), order.begin()+first );
+         continue;
+      }
+
+      // Selecting the separating level that divides the vertices into two halves
+      size_t separator( 1UL );
+      while( separator+2UL < height && levels[separator+1UL] <= size/2UL ) {
+         ++separator;
+      }
+
+      // Ordering the first part, the second part, and the separator
+      const size_t lower( levels[separator] );
+      const size_t upper( levels[separator+1UL] );
+
+      std::copy( bfs.begin(), bfs.begin()+lower, order.begin()+first );
+      std::copy( bfs.begin()+upper, bfs.end(), order.begin()+first+lower );
+      std::copy( bfs.begin()+lower, bfs.begin()+upper, order.begin()+first+lower+(size-upper) );
+
+      ranges.push_back( Range( first+lower, first+lower+(size-upper) ) );
+      ranges.push_back( Range( first, first+lower ) );
+   }
+
+   return PermutationVector( order.begin(), order.end() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
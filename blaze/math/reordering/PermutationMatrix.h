@@ -0,0 +1,468 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/reordering/PermutationMatrix.h
+//  \brief Header file for the PermutationMatrix class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REORDERING_PERMUTATIONMATRIX_H_
+#define _BLAZE_MATH_REORDERING_PERMUTATIONMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/reordering/PermutationVector.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Square permutation matrix.
+// \ingroup reordering
+//
+// The PermutationMatrix class represents the \f$ N \times N \f$ permutation matrix \f$ P \f$
+// belonging to a given PermutationVector \f$ p \f$, i.e. the matrix with \f$ P(i,p[i]) = 1 \f$
+// and zeros elsewhere. The matrix is never stored explicitly. Instead, it is applied to vectors
+// and matrices in a single pass over their elements:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A;
+   DynamicVector<double> x;
+   // ... Initialization
+
+   const blaze::PermutationMatrix P( blaze::reverseCuthillMcKee( A ) );
+
+   DynamicVector<double> y( P * x );                     // y[i] = x[p[i]]
+   DynamicVector<double> z( trans( P ) * y );            // Restores x
+   CompressedMatrix<double> B( permute( A, P ) );        // B = P * A * trans(P)
+   \endcode
+
+// Note that the symmetric permutation \f$ P A P^T \f$ of a sparse matrix is provided by the
+// permute() function in order to avoid the two intermediate temporaries of the corresponding
+// matrix products.
+*/
+class PermutationMatrix
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PermutationMatrix( size_t n = 0UL );
+   explicit inline PermutationMatrix( const PermutationVector& p );
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline bool                     operator()( size_t i, size_t j ) const;
+   inline const PermutationVector& permutation() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows      () const;
+   inline size_t columns   () const;
+   inline size_t nonZeros  () const;
+   inline void   transpose ();
+   inline void   swap      ( PermutationMatrix& P ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   PermutationVector p_;  //!< The permutation represented by the matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the \f$ N \times N \f$ identity matrix.
+//
+// \param n The number of rows and columns of the matrix.
+*/
+inline PermutationMatrix::PermutationMatrix( size_t n )
+   : p_( n )  // The permutation represented by the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the permutation matrix of the given permutation.
+//
+// \param p The new-to-old mapping of the indices.
+*/
+inline PermutationMatrix::PermutationMatrix( const PermutationVector& p )
+   : p_( p )  // The permutation represented by the matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return \a true for the non-zero elements, \a false for the zero elements.
+*/
+inline bool PermutationMatrix::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < p_.size(), "Invalid column access index" );
+   return p_[i] == j;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the permutation represented by the matrix.
+//
+// \return The new-to-old mapping of the indices.
+*/
+inline const PermutationVector& PermutationMatrix::permutation() const
+{
+   return p_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+inline size_t PermutationMatrix::rows() const
+{
+   return p_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+inline size_t PermutationMatrix::columns() const
+{
+   return p_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the matrix.
+//
+// \return The number of non-zero elements of the matrix.
+*/
+inline size_t PermutationMatrix::nonZeros() const
+{
+   return p_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return void
+//
+// Since the transpose of a permutation matrix is its inverse, this function has constant
+// complexity.
+*/
+inline void PermutationMatrix::transpose()
+{
+   p_.invert();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two permutation matrices.
+//
+// \param P The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void PermutationMatrix::swap( PermutationMatrix& P ) /* throw() */
+{
+   p_.swap( P.p_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PermutationMatrix functions */
+//@{
+inline const PermutationMatrix trans( const PermutationMatrix& P );
+
+inline void swap( PermutationMatrix& a, PermutationMatrix& b ) /* throw() */;
+
+template< typename Type, bool SO >
+inline const CompressedMatrix<Type,SO>
+   permute( const CompressedMatrix<Type,SO>& A, const PermutationMatrix& P );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the transpose of the given permutation matrix.
+// \ingroup reordering
+//
+// \param P The permutation matrix to be transposed.
+// \return The transpose (i.e. the inverse) of the permutation matrix.
+*/
+inline const PermutationMatrix trans( const PermutationMatrix& P )
+{
+   PermutationMatrix tmp( P );
+   tmp.transpose();
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two permutation matrices.
+// \ingroup reordering
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void swap( PermutationMatrix& a, PermutationMatrix& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Helper class for the sorting of the permuted elements of a row/column.
+// \ingroup reordering
+*/
+struct PermutationLess
+{
+   template< typename T >
+   inline bool operator()( const T& a, const T& b ) const {
+      return a.first < b.first;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of a square sparse matrix (\f$ B = P A P^T \f$).
+// \ingroup reordering
+//
+// \param A The square sparse matrix to be permuted.
+// \param P The permutation matrix.
+// \return The permuted matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the symmetric permutation \f$ P A P^T \f$ of the given matrix, i.e.
+// the element \f$ B(i,j) \f$ of the result is the element \f$ A(p[i],p[j]) \f$. The result is
+// created in a single pass over the non-zero elements of \a A without any intermediate matrix.
+// In case the matrix is not square or its size doesn't match the size of the permutation, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline const CompressedMatrix<Type,SO>
+   permute( const CompressedMatrix<Type,SO>& A, const PermutationMatrix& P )
+{
+   typedef typename CompressedMatrix<Type,SO>::ConstIterator  ConstIterator;
+
+   if( A.rows() != A.columns() || A.rows() != P.rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   const PermutationVector& p( P.permutation() );
+   const size_t n( A.rows() );
+
+   CompressedMatrix<Type,SO> B( n, n, A.nonZeros() );
+   std::vector< std::pair<size_t,Type> > elements;
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      elements.clear();
+      for( ConstIterator element=A.begin( p[i] ); element!=A.end( p[i] ); ++element )
+         elements.push_back( std::make_pair( p.inverse( element->index() ), element->value() ) );
+
+      std::sort( elements.begin(), elements.end(), PermutationLess() );
+
+      for( size_t k=0UL; k<elements.size(); ++k ) {
+         if( SO ) B.append( elements[k].first, i, elements[k].second );
+         else     B.append( i, elements[k].first, elements[k].second );
+      }
+      B.finalize( i );
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a permutation matrix and a dense
+//        column vector (\f$ \vec{y}=P*\vec{x} \f$).
+// \ingroup reordering
+//
+// \param P The left-hand side permutation matrix.
+// \param x The right-hand side dense column vector.
+// \return The permuted vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator gathers the elements of the given vector, i.e. \f$ y[i] = x[p[i]] \f$. In case
+// the current size of the vector doesn't match the number of columns of the permutation matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT >  // Type of the right-hand side dense vector
+inline const DynamicVector<typename VT::ElementType,columnVector>
+   operator*( const PermutationMatrix& P, const DenseVector<VT,columnVector>& x )
+{
+   if( P.columns() != (~x).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   const PermutationVector& p( P.permutation() );
+   const size_t n( p.size() );
+
+   DynamicVector<typename VT::ElementType,columnVector> y( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      y[i] = (~x)[p[i]];
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense row vector and a
+//        permutation matrix (\f$ \vec{y}^T=\vec{x}^T*P \f$).
+// \ingroup reordering
+//
+// \param x The left-hand side dense row vector.
+// \param P The right-hand side permutation matrix.
+// \return The permuted vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// This operator scatters the elements of the given vector, i.e. \f$ y[p[i]] = x[i] \f$. In case
+// the current size of the vector doesn't match the number of rows of the permutation matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT >  // Type of the left-hand side dense vector
+inline const DynamicVector<typename VT::ElementType,rowVector>
+   operator*( const DenseVector<VT,rowVector>& x, const PermutationMatrix& P )
+{
+   if( (~x).size() != P.rows() )
+      throw std::invalid_argument( "Vector and matrix sizes do not match" );
+
+   const PermutationVector& p( P.permutation() );
+   const size_t n( p.size() );
+
+   DynamicVector<typename VT::ElementType,rowVector> y( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      y[p[i]] = (~x)[i];
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,338 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/reordering/PermutationVector.h
+//  \brief Header file for the PermutationVector class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REORDERING_PERMUTATIONVECTOR_H_
+#define _BLAZE_MATH_REORDERING_PERMUTATIONVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Storage of a permutation of the index range \f$[0..N-1]\f$.
+// \ingroup reordering
+//
+// The PermutationVector class stores a permutation \f$ p \f$ of the indices \f$[0..N-1]\f$ in
+// the form of a new-to-old mapping, i.e. the element at the new position \a i originates from
+// the old position \f$ p[i] \f$. Additionally the inverse (old-to-new) mapping is stored such
+// that both directions can be queried in constant time:
+
+   \code
+   const size_t order[] = { 2UL, 0UL, 1UL };
+   blaze::PermutationVector p( order, order+3UL );
+
+   p[0];          // Returns 2 (the new position 0 is taken by the old index 2)
+   p.inverse(0);  // Returns 1 (the old index 0 is moved to the new position 1)
+   \endcode
+
+// Permutation vectors are usually computed by a reordering function as for instance
+// reverseCuthillMcKee() and applied to matrices and vectors via the PermutationMatrix class.
+*/
+class PermutationVector
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::vector<size_t>::const_iterator  ConstIterator;  //!< Iterator over the new-to-old mapping.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PermutationVector( size_t n = 0UL );
+
+   template< typename Iterator >
+   inline PermutationVector( Iterator first, Iterator last );
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline size_t        operator[]( size_t i ) const;
+   inline size_t        inverse   ( size_t i ) const;
+   inline ConstIterator begin     () const;
+   inline ConstIterator end       () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size      () const;
+   inline bool   isIdentity() const;
+   inline void   invert    ();
+   inline void   swap      ( PermutationVector& p ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> perm_;  //!< The new-to-old mapping of the indices.
+   std::vector<size_t> inv_;   //!< The old-to-new mapping of the indices.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the identity permutation of the index range \f$[0..N-1]\f$.
+//
+// \param n The number of indices of the permutation.
+*/
+inline PermutationVector::PermutationVector( size_t n )
+   : perm_( n )  // The new-to-old mapping of the indices
+   , inv_ ( n )  // The old-to-new mapping of the indices
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      perm_[i] = inv_[i] = i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a permutation from the given new-to-old mapping.
+//
+// \param first Iterator to the first index of the new-to-old mapping.
+// \param last Iterator one past the last index of the new-to-old mapping.
+// \exception std::invalid_argument Invalid permutation.
+//
+// This constructor creates a permutation from the given range of indices. The element at the
+// \a i-th position of the range specifies the old index of the new position \a i. In case the
+// given range is not a permutation of the indices \f$[0..N-1]\f$, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Iterator >  // Type of the index iterator
+inline PermutationVector::PermutationVector( Iterator first, Iterator last )
+   : perm_( first, last )  // The new-to-old mapping of the indices
+   , inv_ ()               // The old-to-new mapping of the indices
+{
+   const size_t n( perm_.size() );
+
+   inv_.resize( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( perm_[i] >= n || inv_[perm_[i]] != n )
+         throw std::invalid_argument( "Invalid permutation" );
+      inv_[perm_[i]] = i;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the old index of the new position \a i.
+//
+// \param i The new position \f$[0..N-1]\f$.
+// \return The old index that is moved to position \a i.
+*/
+inline size_t PermutationVector::operator[]( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < perm_.size(), "Invalid permutation access index" );
+   return perm_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the new position of the old index \a i.
+//
+// \param i The old index \f$[0..N-1]\f$.
+// \return The new position of the old index \a i.
+*/
+inline size_t PermutationVector::inverse( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < inv_.size(), "Invalid permutation access index" );
+   return inv_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index of the new-to-old mapping.
+//
+// \return Iterator to the first index of the new-to-old mapping.
+*/
+inline PermutationVector::ConstIterator PermutationVector::begin() const
+{
+   return perm_.begin();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last index of the new-to-old mapping.
+//
+// \return Iterator just past the last index of the new-to-old mapping.
+*/
+inline PermutationVector::ConstIterator PermutationVector::end() const
+{
+   return perm_.end();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of indices of the permutation.
+//
+// \return The number of indices of the permutation.
+*/
+inline size_t PermutationVector::size() const
+{
+   return perm_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the permutation is the identity.
+//
+// \return \a true in case the permutation is the identity, \a false if not.
+*/
+inline bool PermutationVector::isIdentity() const
+{
+   for( size_t i=0UL; i<perm_.size(); ++i ) {
+      if( perm_[i] != i ) return false;
+   }
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the permutation.
+//
+// \return void
+//
+// This function inverts the permutation by exchanging the new-to-old and the old-to-new
+// mapping. The inversion has constant complexity.
+*/
+inline void PermutationVector::invert()
+{
+   perm_.swap( inv_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two permutations.
+//
+// \param p The permutation to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void PermutationVector::swap( PermutationVector& p ) /* throw() */
+{
+   perm_.swap( p.perm_ );
+   inv_.swap( p.inv_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PermutationVector operators */
+//@{
+inline void swap( PermutationVector& a, PermutationVector& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two permutations.
+// \ingroup reordering
+//
+// \param a The first permutation to be swapped.
+// \param b The second permutation to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void swap( PermutationVector& a, PermutationVector& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
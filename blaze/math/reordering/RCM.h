@@ -0,0 +1,156 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/reordering/RCM.h
+//  \brief Header file for the reverse Cuthill-McKee ordering
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REORDERING_RCM_H_
+#define _BLAZE_MATH_REORDERING_RCM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/reordering/AdjacencyGraph.h>
+#include <blaze/math/reordering/PermutationVector.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REVERSE CUTHILL-MCKEE ORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Helper class for the sorting of vertices by increasing degree.
+// \ingroup reordering
+*/
+struct DegreeLess
+{
+   explicit inline DegreeLess( const AdjacencyGraph& graph ) : graph_( graph ) {}
+
+   inline bool operator()( size_t v, size_t w ) const {
+      return graph_.degree( v ) < graph_.degree( w );
+   }
+
+   const AdjacencyGraph& graph_;  //!< The graph of the sorted vertices.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth reducing reverse Cuthill-McKee ordering of a square sparse matrix.
+// \ingroup reordering
+//
+// \param A The square sparse matrix.
+// \return The new-to-old mapping of the reverse Cuthill-McKee ordering.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the reverse Cuthill-McKee ordering of the symmetrized sparsity pattern
+// \f$ A + A^T \f$ of the given square sparse matrix. Each connected component is traversed in
+// breadth-first order starting from a pseudo-peripheral vertex, visiting the neighbors of each
+// vertex in the order of increasing degree. The reversal of the resulting sequence clusters the
+// non-zero elements of the permuted matrix \f$ P A P^T \f$ around the diagonal:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Initialization
+
+   const blaze::PermutationMatrix P( blaze::reverseCuthillMcKee( A ) );
+   const blaze::CompressedMatrix<double> B( permute( A, P ) );
+   \endcode
+
+// In case the given matrix is not square, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+const PermutationVector reverseCuthillMcKee( const CompressedMatrix<Type,SO>& A )
+{
+   const AdjacencyGraph graph( A );
+   const size_t n( graph.size() );
+
+   // Determining the order in which the connected components are started
+   std::vector<size_t> vertices( n );
+   for( size_t v=0UL; v<n; ++v ) {
+      vertices[v] = v;
+   }
+   std::stable_sort( vertices.begin(), vertices.end(), DegreeLess( graph ) );
+
+   std::vector<size_t> order;
+   std::vector<bool> visited( n, false );
+   std::vector<size_t> levels, neighbors;
+
+   order.reserve( n );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      if( visited[vertices[k]] ) continue;
+
+      // Cuthill-McKee traversal of the connected component
+      const size_t root( graph.pseudoPeripheralNode( vertices[k], NULL, 0UL, neighbors, levels ) );
+
+      size_t first( order.size() );
+      order.push_back( root );
+      visited[root] = true;
+
+      for( ; first<order.size(); ++first )
+      {
+         neighbors.clear();
+         for( AdjacencyGraph::ConstIterator w=graph.begin( order[first] ); w!=graph.end( order[first] ); ++w ) {
+            if( visited[*w] ) continue;
+            visited[*w] = true;
+            neighbors.push_back( *w );
+         }
+
+         std::stable_sort( neighbors.begin(), neighbors.end(), DegreeLess( graph ) );
+         order.insert( order.end(), neighbors.begin(), neighbors.end() );
+      }
+   }
+
+   std::reverse( order.begin(), order.end() );
+
+   return PermutationVector( order.begin(), order.end() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
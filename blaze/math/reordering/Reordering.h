@@ -0,0 +1,67 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/reordering/Reordering.h
+//  \brief Header file for the reordering module documentation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REORDERING_REORDERING_H_
+#define _BLAZE_MATH_REORDERING_REORDERING_H_
+
+
+//=================================================================================================
+//
+//  DOXYGEN DOCUMENTATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup reordering Reordering
+// \ingroup math
+//
+// The reordering module provides fill- and bandwidth-reducing orderings for square sparse
+// matrices (see reverseCuthillMcKee(), nestedDissection() and approximateMinimumDegree()) as
+// well as the PermutationVector and PermutationMatrix classes to apply the computed orderings
+// to matrices and vectors:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::DynamicVector<double,blaze::columnVector> b;
+   // ... Initialization of the linear system
+
+   const blaze::PermutationMatrix P( blaze::reverseCuthillMcKee( A ) );
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> B( permute( A, P ) );  // B = P * A * trans(P)
+   const blaze::DynamicVector<double,blaze::columnVector> c( P * b );           // c = P * b
+   \endcode
+*/
+//*************************************************************************************************
+
+#endif
@@ -46,6 +46,8 @@
 #include <blaze/math/smp/openmp/DenseVector.h>
 #elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
 #include <blaze/math/smp/threads/DenseVector.h>
+#elif BLAZE_TBB_PARALLEL_MODE
+#include <blaze/math/smp/tbb/DenseVector.h>
 #else
 #include <blaze/math/smp/default/DenseVector.h>
 #endif
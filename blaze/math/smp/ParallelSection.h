@@ -41,6 +41,10 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/system/SMP.h>
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +93,13 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_THREAD_LOCAL bool active_;  //!< Activity flag for the parallel section.
+                                            /*!< In case a parallel section is active (i.e. the
+                                                 currently executed code is inside a parallel
+                                                 section), the flag is set to \a true, otherwise
+                                                 it is \a false. The flag is thread-local, i.e.
+                                                 each thread of execution tracks its own parallel
+                                                 sections. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +123,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+BLAZE_THREAD_LOCAL bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -208,10 +215,19 @@ inline bool isParallelSectionActive();
 // \ingroup smp
 //
 // \return \a true if a parallel section is active, \a false if not.
+//
+// The state of the parallel section is tracked per thread of execution. The tasks of a parallel
+// operation executed by the C++11/Boost thread backend or the TBB backend activate their own
+// parallel section. In case of the OpenMP parallelization, all threads of an active OpenMP
+// parallel region are considered to be inside a parallel section.
 */
 inline bool isParallelSectionActive()
 {
+#if BLAZE_OPENMP_PARALLEL_MODE
+   return ParallelSection<int>::active_ || omp_in_parallel();
+#else
    return ParallelSection<int>::active_;
+#endif
 }
 //*************************************************************************************************
 
@@ -0,0 +1,471 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Reduction.h
+//  \brief Header file for the deterministic reduction functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_REDUCTION_H_
+#define _BLAZE_MATH_SMP_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Accumulation.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ACCUMULATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Streaming summation of a sequence of values.
+// \ingroup smp
+//
+// The Accumulator class template sums up a sequence of values according to the given
+// accumulation scheme \a A (see the Accumulation enumeration). The values are added via the
+// addition assignment operator, the sum is returned by the result() function:
+
+   \code
+   blaze::Accumulator<double,blaze::compensatedAccumulation> sum;
+   for( size_t i=0UL; i<n; ++i )
+      sum += a[i] * b[i];
+   const double dot( sum.result() );
+   \endcode
+
+// The result only depends on the sequence of added values, i.e. it is reproducible for all
+// accumulation schemes.
+*/
+template< typename T                              // Type of the summed values
+        , Accumulation A=plainAccumulation >  // Accumulation scheme
+class Accumulator
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The default constructor of the Accumulator class template.
+   */
+   explicit inline Accumulator()
+      : sum_()  // The current sum
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Adding a value to the sum.
+   //
+   // \param value The value to be added.
+   // \return Reference to the accumulator.
+   */
+   inline Accumulator& operator+=( const T& value ) {
+      sum_ += value;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the sum of all added values.
+   //
+   // \return The sum of all added values.
+   */
+   inline const T result() const {
+      return sum_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T sum_;  //!< The current sum.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR PAIRWISE ACCUMULATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Accumulator class template for pairwise summation.
+// \ingroup smp
+//
+// This specialization sums up the values in a binary tree. Chunks of \a chunkSize consecutive
+// values are summed up sequentially, the chunk sums are combined pairwise in a cascade: the
+// partial sum of each tree level is kept until a second partial sum of the same level arrives,
+// which requires only logarithmic memory in the number of values.
+*/
+template< typename T >  // Type of the summed values
+class Accumulator<T,pairwiseAccumulation>
+{
+ private:
+   //**********************************************************************************************
+   enum { chunkSize = 32 };  //!< Number of values summed up sequentially.
+   enum { levels    = 64 };  //!< Maximum number of tree levels.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The default constructor of the Accumulator class template.
+   */
+   explicit inline Accumulator()
+      : chunk_   ()       // The sum of the current chunk
+      , count_   ( 0UL )  // The number of values of the current chunk
+      , occupied_( 0UL )  // Bit mask of the occupied tree levels
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Adding a value to the sum.
+   //
+   // \param value The value to be added.
+   // \return Reference to the accumulator.
+   */
+   inline Accumulator& operator+=( const T& value ) {
+      chunk_ += value;
+      if( ++count_ == size_t( chunkSize ) ) {
+         push( chunk_ );
+         chunk_ = T();
+         count_ = 0UL;
+      }
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the sum of all added values.
+   //
+   // \return The sum of all added values.
+   */
+   inline const T result() const {
+      T sum( chunk_ );
+      for( size_t level=0UL; level<size_t( levels ); ++level ) {
+         if( occupied_ & ( size_t(1) << level ) )
+            sum = partials_[level] + sum;
+      }
+      return sum;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Push function*******************************************************************************
+   /*!\brief Combining a chunk sum with the partial sums of the tree.
+   //
+   // \param sum The chunk sum.
+   // \return void
+   */
+   inline void push( T sum ) {
+      size_t level( 0UL );
+      while( occupied_ & ( size_t(1) << level ) ) {
+         sum = partials_[level] + sum;
+         occupied_ &= ~( size_t(1) << level );
+         ++level;
+      }
+      BLAZE_INTERNAL_ASSERT( level < size_t( levels ), "Invalid tree level detected" );
+      partials_[level] = sum;
+      occupied_ |= ( size_t(1) << level );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T      chunk_;             //!< The sum of the current chunk.
+   size_t count_;             //!< The number of values of the current chunk.
+   size_t occupied_;          //!< Bit mask of the occupied tree levels.
+   T      partials_[levels];  //!< The partial sums of the tree levels.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR COMPENSATED ACCUMULATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Accumulator class template for compensated summation.
+// \ingroup smp
+//
+// This specialization sums up the values with a running compensation of the rounding errors.
+// The rounding error of each addition is computed exactly via the branch-free TwoSum algorithm
+// (Knuth), which yields the same accuracy as the Kahan-Babuska-Neumaier summation. Note that the
+// compensation requires IEEE conforming floating point arithmetic, i.e. it is ineffective in
+// case value-unsafe optimizations (e.g. \c -ffast-math) are enabled.
+*/
+template< typename T >  // Type of the summed values
+class Accumulator<T,compensatedAccumulation>
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The default constructor of the Accumulator class template.
+   */
+   explicit inline Accumulator()
+      : sum_         ()  // The current sum
+      , compensation_()  // The accumulated rounding errors
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Adding a value to the sum.
+   //
+   // \param value The value to be added.
+   // \return Reference to the accumulator.
+   */
+   inline Accumulator& operator+=( const T& value ) {
+      const T sum( sum_ + value );
+      const T tmp( sum - sum_ );
+      compensation_ += ( sum_ - ( sum - tmp ) ) + ( value - tmp );
+      sum_ = sum;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the sum of all added values.
+   //
+   // \return The sum of all added values.
+   */
+   inline const T result() const {
+      return sum_ + compensation_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T sum_;           //!< The current sum.
+   T compensation_;  //!< The accumulated rounding errors.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS REDUCTIONACCUMULATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluation of the accumulation scheme of a reduction.
+// \ingroup smp
+//
+// The ReductionAccumulation class template evaluates the accumulation scheme for a reduction
+// of values of type \a T. In case deterministic reductions are enabled (see the
+// \c SMP_DETERMINISTIC_REDUCTION switch) and \a T is a numeric type, the nested \a value
+// corresponds to the configured accumulation scheme \c SMP_REDUCTION_ACCUMULATION. Otherwise
+// \a value is set to \a plainAccumulation.
+*/
+template< typename T >  // Type of the reduced values
+struct ReductionAccumulation
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static const Accumulation value = ( SMP_DETERMINISTIC_REDUCTION && IsNumeric<T>::value )
+                                     ?( SMP_REDUCTION_ACCUMULATION )
+                                     :( plainAccumulation );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Reduction functions */
+//@{
+template< typename T >
+inline const T treeReduction( const T* partials, size_t n );
+
+inline size_t reductionBlocks( size_t n );
+
+template< typename T, typename OP >
+inline const T smpReduce( size_t n, const OP& op, bool parallel );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Combination of partial results via a fixed binary tree.
+// \ingroup smp
+//
+// \param partials The partial results.
+// \param n The number of partial results.
+// \return The sum of all partial results.
+//
+// This function sums up the given partial results by recursively splitting them into two
+// halves. The order of the additions only depends on the number of partial results.
+*/
+template< typename T >  // Type of the partial results
+inline const T treeReduction( const T* partials, size_t n )
+{
+   if( n == 0UL ) return T();
+   if( n == 1UL ) return partials[0];
+
+   const size_t half( n / 2UL );
+   return treeReduction( partials, half ) + treeReduction( partials+half, n-half );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of blocks of a deterministic reduction.
+// \ingroup smp
+//
+// \param n The number of reduced elements.
+// \return The number of blocks of size \c SMP_REDUCTION_BLOCK_SIZE (at least 1).
+*/
+inline size_t reductionBlocks( size_t n )
+{
+   return max( ( n + SMP_REDUCTION_BLOCK_SIZE - 1UL ) / SMP_REDUCTION_BLOCK_SIZE, size_t( 1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the computation of the partial results of a blocked reduction.
+// \ingroup smp
+*/
+template< typename T     // Type of the partial results
+        , typename OP >  // Type of the block reduction
+struct BlockReduction
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BlockReduction class template.
+   //
+   // \param op The block reduction.
+   // \param partials The partial results of the blocks.
+   // \param n The number of reduced elements.
+   */
+   explicit inline BlockReduction( const OP& op, T* partials, size_t n )
+      : op_      ( op       )  // The block reduction
+      , partials_( partials )  // The partial results of the blocks
+      , n_       ( n        )  // The number of reduced elements
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the partial results of the given range of blocks.
+   //
+   // \param first The first block.
+   // \param last The block one past the last block.
+   // \return void
+   */
+   inline void operator()( size_t first, size_t last ) const {
+      for( size_t b=first; b<last; ++b ) {
+         const size_t begin( b*SMP_REDUCTION_BLOCK_SIZE );
+         partials_[b] = op_( begin, min( begin+SMP_REDUCTION_BLOCK_SIZE, n_ ) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const OP& op_;        //!< The block reduction.
+   T*        partials_;  //!< The partial results of the blocks.
+   size_t    n_;         //!< The number of reduced elements.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduction of a range of elements.
+// \ingroup smp
+//
+// \param n The number of reduced elements.
+// \param op The block reduction.
+// \param parallel \a true in case the reduction may be executed in parallel, \a false if not.
+// \return The result of the reduction.
+//
+// This function reduces the elements \f$[0..n)\f$ via the given block reduction \a op, which has
+// to provide a constant function call operator that returns the partial result for the given
+// first and one-past-the-last index. In case deterministic reductions are disabled (see
+// \c SMP_DETERMINISTIC_REDUCTION), the function returns the result of a single call of \a op
+// for the complete range. Otherwise the range is split into blocks of \c SMP_REDUCTION_BLOCK_SIZE
+// elements, the partial results of the blocks are computed (in parallel in case \a parallel is
+// \a true) and combined via treeReduction(). Thus the result is independent of the number of
+// threads and of whether the reduction is executed in parallel.
+*/
+template< typename T     // Type of the result
+        , typename OP >  // Type of the block reduction
+inline const T smpReduce( size_t n, const OP& op, bool parallel )
+{
+   if( !SMP_DETERMINISTIC_REDUCTION || n <= SMP_REDUCTION_BLOCK_SIZE )
+      return op( 0UL, n );
+
+   const size_t blocks( reductionBlocks( n ) );
+
+   std::vector<T> partials( blocks );
+   BlockReduction<T,OP> reduction( op, &partials[0], n );
+
+   if( parallel )
+      smpFor( 0UL, blocks, reduction );
+   else
+      reduction( 0UL, blocks );
+
+   return treeReduction( &partials[0], blocks );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +90,13 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the serial section.
-                         /*!< In case a serial section is active (i.e. the currently executed
-                              code is inside a serial section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_THREAD_LOCAL bool active_;  //!< Activity flag for the serial section.
+                                            /*!< In case a serial section is active (i.e. the
+                                                 currently executed code is inside a serial
+                                                 section), the flag is set to \a true, otherwise
+                                                 it is \a false. The flag is thread-local, i.e.
+                                                 each thread of execution tracks its own serial
+                                                 sections. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +120,7 @@ class SerialSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool SerialSection<T>::active_ = false;
+BLAZE_THREAD_LOCAL bool SerialSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -0,0 +1,351 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ThreadMapping.h
+//  \brief Header file for the 2D tile partition of the SMP assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADMAPPING_H_
+#define _BLAZE_MATH_SMP_THREADMAPPING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partition of a matrix into a 2D grid of tiles for the SMP assignment.
+// \ingroup smp
+//
+// The ThreadMapping class partitions an \f$ M \times N \f$ matrix into a grid of
+// \f$ rows() \times columns() \f$ tiles of at most \f$ rowsPerThread() \times colsPerThread() \f$
+// elements, one tile per thread. The grid is chosen based on the shape of the matrix and the
+// number of threads:
+//
+//  -# The number of (non-empty) tiles is maximized, i.e. as many threads as possible are used.
+//  -# Among all grids with the maximum number of tiles, the grid with the smallest tile
+//     perimeter \f$ rowsPerThread() + colsPerThread() \f$ is selected. For a matrix product
+//     \f$ C = A \cdot B \f$ the perimeter is proportional to the number of elements of \a A and
+//     \a B a single thread has to read, i.e. tall-skinny targets are split by rows, short-wide
+//     targets by columns, and square targets into square tiles.
+//
+// The number of rows and columns per tile is a multiple of the given row and column alignment,
+// respectively. This way tiles start at SIMD and cache line boundaries.
+*/
+class ThreadMapping
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ThreadMapping( size_t threads, size_t m, size_t n,
+                                  size_t rowAlignment, size_t columnAlignment );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size         () const;
+   inline size_t rows         () const;
+   inline size_t columns      () const;
+   inline size_t rowsPerThread() const;
+   inline size_t colsPerThread() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t ceilDiv( size_t a, size_t b );
+   static inline size_t ceilTo ( size_t a, size_t alignment );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t rows_;           //!< The number of tile rows.
+   size_t columns_;        //!< The number of tile columns.
+   size_t rowsPerThread_;  //!< The number of rows per tile.
+   size_t colsPerThread_;  //!< The number of columns per tile.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the ThreadMapping class.
+//
+// \param threads The number of available threads \f$[1..\infty)\f$.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param rowAlignment The alignment of the number of rows per tile \f$[1..\infty)\f$.
+// \param columnAlignment The alignment of the number of columns per tile \f$[1..\infty)\f$.
+*/
+inline ThreadMapping::ThreadMapping( size_t threads, size_t m, size_t n,
+                                     size_t rowAlignment, size_t columnAlignment )
+   : rows_         ( 1UL )                           // The number of tile rows
+   , columns_      ( 1UL )                           // The number of tile columns
+   , rowsPerThread_( ceilTo( m, rowAlignment    ) )  // The number of rows per tile
+   , colsPerThread_( ceilTo( n, columnAlignment ) )  // The number of columns per tile
+{
+   BLAZE_INTERNAL_ASSERT( threads         > 0UL, "Invalid number of threads" );
+   BLAZE_INTERNAL_ASSERT( rowAlignment    > 0UL, "Invalid row alignment"     );
+   BLAZE_INTERNAL_ASSERT( columnAlignment > 0UL, "Invalid column alignment"  );
+
+   if( m == 0UL || n == 0UL ) {
+      rows_ = columns_ = 0UL;
+      return;
+   }
+
+   const size_t maxRows( ceilDiv( m, rowAlignment    ) );
+   const size_t maxCols( ceilDiv( n, columnAlignment ) );
+
+   for( size_t p=1UL; p<=threads && p<=maxRows; ++p )
+   {
+      const size_t q( ( threads/p < maxCols )?( threads/p ):( maxCols ) );
+
+      const size_t rowsPerTile( ceilTo( ceilDiv( m, p ), rowAlignment    ) );
+      const size_t colsPerTile( ceilTo( ceilDiv( n, q ), columnAlignment ) );
+      const size_t rowTiles   ( ceilDiv( m, rowsPerTile ) );
+      const size_t columnTiles( ceilDiv( n, colsPerTile ) );
+
+      if( rowTiles*columnTiles > size() ||
+          ( rowTiles*columnTiles == size() && rowsPerTile+colsPerTile < rowsPerThread_+colsPerThread_ ) ) {
+         rows_          = rowTiles;
+         columns_       = columnTiles;
+         rowsPerThread_ = rowsPerTile;
+         colsPerThread_ = colsPerTile;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( size() <= threads, "Invalid number of tiles" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of tiles.
+//
+// \return The total number of tiles.
+*/
+inline size_t ThreadMapping::size() const
+{
+   return rows_ * columns_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of tile rows.
+//
+// \return The number of tile rows.
+*/
+inline size_t ThreadMapping::rows() const
+{
+   return rows_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of tile columns.
+//
+// \return The number of tile columns.
+*/
+inline size_t ThreadMapping::columns() const
+{
+   return columns_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows per tile.
+//
+// \return The number of rows per tile.
+//
+// Note that the tiles of the last tile row may contain less rows.
+*/
+inline size_t ThreadMapping::rowsPerThread() const
+{
+   return rowsPerThread_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns per tile.
+//
+// \return The number of columns per tile.
+//
+// Note that the tiles of the last tile column may contain less columns.
+*/
+inline size_t ThreadMapping::colsPerThread() const
+{
+   return colsPerThread_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Integer division rounding towards infinity.
+//
+// \param a The dividend.
+// \param b The divisor \f$[1..\infty)\f$.
+// \return The rounded quotient.
+*/
+inline size_t ThreadMapping::ceilDiv( size_t a, size_t b )
+{
+   return ( a + b - 1UL ) / b;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding up to the next multiple of the given alignment.
+//
+// \param a The value to be rounded.
+// \param alignment The alignment \f$[1..\infty)\f$.
+// \return The rounded value.
+*/
+inline size_t ThreadMapping::ceilTo( size_t a, size_t alignment )
+{
+   return ceilDiv( a, alignment ) * alignment;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the 2D tile partition of the given target matrix for the SMP assignment.
+// \ingroup smp
+//
+// \param threads The number of available threads \f$[1..\infty)\f$.
+// \param A The target matrix of the SMP assignment.
+// \param vectorizable \a true in case the assignment is vectorized, \a false if not.
+// \return The tile partition of the target matrix.
+//
+// In case of a vectorized assignment both the number of rows and columns per tile are a
+// multiple of the SIMD width of the element type. Additionally, the tiles are aligned to cache
+// line boundaries along the storage order of \a A (i.e. the columns of a row-major matrix and
+// the rows of a column-major matrix), such that no two threads write to the same cache line.
+*/
+template< typename MT  // Type of the target matrix
+        , bool SO >    // Storage order of the target matrix
+inline ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A, bool vectorizable )
+{
+   typedef typename MT::ElementType  ET;
+   typedef IntrinsicTrait<ET>        IT;
+
+   const size_t simd( vectorizable ? size_t( IT::size ) : 1UL );
+   const size_t line( ( sizeof(ET) < cacheLineSize )?( cacheLineSize / sizeof(ET) ):( 1UL ) );
+   const size_t contiguous( ( line > simd )?( line ):( simd ) );
+
+   if( SO == rowMajor )
+      return ThreadMapping( threads, (~A).rows(), (~A).columns(), simd, contiguous );
+   else
+      return ThreadMapping( threads, (~A).rows(), (~A).columns(), contiguous, simd );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
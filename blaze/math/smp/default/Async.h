@@ -0,0 +1,284 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Async.h
+//  \brief Header file for the default implementation of the asynchronous evaluation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_ASYNC_H_
+#define _BLAZE_MATH_SMP_DEFAULT_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ASYNCHANDLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Completion handle for an asynchronously evaluated statement.
+// \ingroup smp
+//
+// The AsyncHandle class represents the completion handle of a statement submitted via the
+// async() function. Since the default implementation evaluates all statements immediately,
+// the handle always refers to a completed statement. In accordance with the thread-based
+// implementation, errors that occurred during the evaluation are reported by the wait()
+// function.
+*/
+class AsyncHandle
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline AsyncHandle();
+   explicit inline AsyncHandle( const std::string& error );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool done() const;
+   inline void wait() const;
+   inline void swap( AsyncHandle& handle ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   bool        failed_;  //!< Failure flag of the statement.
+   std::string error_;   //!< The error message of a failed evaluation.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor for AsyncHandle.
+*/
+inline AsyncHandle::AsyncHandle()
+   : failed_( false )  // Failure flag of the statement
+   , error_ ()         // The error message of a failed evaluation
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a handle of a failed statement.
+//
+// \param error The error message of the failed evaluation.
+*/
+inline AsyncHandle::AsyncHandle( const std::string& error )
+   : failed_( true  )  // Failure flag of the statement
+   , error_ ( error )  // The error message of a failed evaluation
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the referenced statement has been completed.
+//
+// \return \a true.
+*/
+inline bool AsyncHandle::done() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the referenced statement to be completed.
+//
+// \return void
+// \exception std::runtime_error Asynchronous evaluation failed.
+//
+// In case an exception has been thrown during the evaluation of the statement, a
+// \a std::runtime_error exception with the according error message is thrown.
+*/
+inline void AsyncHandle::wait() const
+{
+   if( failed_ )
+      throw std::runtime_error( error_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two handles.
+//
+// \param handle The handle to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void AsyncHandle::swap( AsyncHandle& handle ) /* throw() */
+{
+   std::swap( failed_, handle.failed_ );
+   error_.swap( handle.error_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS EVALUATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the default asynchronous assignment of a vector or matrix.
+// \ingroup smp
+//
+// \param lhs The target vector or matrix.
+// \param rhs The vector or matrix expression to be assigned.
+// \return The completion handle of the assignment.
+//
+// This function performs the assignment of \a rhs to \a lhs. Any exception thrown during the
+// assignment is caught and stored in the returned handle.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+inline AsyncHandle async_backend( T1& lhs, const T2& rhs )
+{
+   try {
+      lhs = rhs;
+   }
+   catch( std::exception& ex ) {
+      return AsyncHandle( ex.what() );
+   }
+   catch( ... ) {
+      return AsyncHandle( "Unknown error during asynchronous evaluation" );
+   }
+
+   return AsyncHandle();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous assignment of a vector.
+// \ingroup smp
+//
+// \param lhs The target vector.
+// \param rhs The vector or vector expression to be assigned.
+// \return The completion handle of the assignment.
+//
+// This function assigns the vector or vector expression \a rhs to the vector \a lhs. Since no
+// thread-based parallelization is active, the default implementation performs the assignment
+// immediately (including a possible OpenMP-based parallelization of the assignment itself) and
+// returns a completed handle. Errors that occur during the assignment are reported by the wait()
+// function of the handle via a \a std::runtime_error exception.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of the vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline AsyncHandle async( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return async_backend( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous assignment of a matrix.
+// \ingroup smp
+//
+// \param lhs The target matrix.
+// \param rhs The matrix or matrix expression to be assigned.
+// \return The completion handle of the assignment.
+//
+// This function assigns the matrix or matrix expression \a rhs to the matrix \a lhs. Since no
+// thread-based parallelization is active, the default implementation performs the assignment
+// immediately (including a possible OpenMP-based parallelization of the assignment itself) and
+// returns a completed handle. Errors that occur during the assignment are reported by the wait()
+// function of the handle via a \a std::runtime_error exception.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline AsyncHandle async( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return async_backend( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( !BLAZE_CPP_THREADS_PARALLEL_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
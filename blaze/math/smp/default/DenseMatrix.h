@@ -183,6 +183,7 @@ namespace {
 
 BLAZE_STATIC_ASSERT( !BLAZE_OPENMP_PARALLEL_MODE      );
 BLAZE_STATIC_ASSERT( !BLAZE_CPP_THREADS_PARALLEL_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_TBB_PARALLEL_MODE         );
 
 }
 /*! \endcond */
@@ -40,9 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/Unused.h>
 
@@ -60,6 +62,7 @@ namespace blaze {
 //@{
 BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
 BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
+BLAZE_ALWAYS_INLINE void   setAffinity    ( const std::string& spec );
 BLAZE_ALWAYS_INLINE void   shutDownThreads();
 //@}
 //*************************************************************************************************
@@ -101,6 +104,26 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Sets the placement of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \param spec The affinity specification (\c "compact", \c "scatter", \c "none", or a CPU list).
+// \return void
+// \exception std::invalid_argument Invalid affinity specification.
+//
+// Via this function the threads used for thread parallel operations can be pinned to specific
+// CPUs. In case an invalid specification is given, a \a std::invalid_argument exception is
+// thrown. Also note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setAffinity( const std::string& spec )
+{
+   threadpool::Affinity affinity( spec );
+   UNUSED_PARAMETER( affinity );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
 // \ingroup smp
@@ -144,6 +167,7 @@ namespace {
 
 BLAZE_STATIC_ASSERT( !BLAZE_OPENMP_PARALLEL_MODE      );
 BLAZE_STATIC_ASSERT( !BLAZE_CPP_THREADS_PARALLEL_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_TBB_PARALLEL_MODE         );
 
 }
 /*! \endcond */
@@ -0,0 +1,107 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/ParallelFor.h
+//  \brief Header file for the default implementation of the SMP parallel range loop
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_DEFAULT_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL RANGE LOOP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP parallel range loop.
+// \ingroup smp
+//
+// \param first The first index of the index range.
+// \param last The index one past the last index of the index range.
+// \param op The range operation to be executed.
+// \return void
+//
+// This function executes the given range operation \a op for the index range \f$[first..last)\f$.
+// The range operation has to provide a constant function call operator that accepts the first
+// and one-past-the-last index of a subrange. Since no parallelization is active, the default
+// implementation executes the complete range by a single call of \a op.
+*/
+template< typename OP >  // Type of the range operation
+inline void smpFor( size_t first, size_t last, const OP& op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_USER_ASSERT( first <= last, "Invalid index range detected" );
+
+   if( first < last )
+      op( first, last );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( !BLAZE_OPENMP_PARALLEL_MODE      );
+BLAZE_STATIC_ASSERT( !BLAZE_CPP_THREADS_PARALLEL_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_TBB_PARALLEL_MODE         );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -46,9 +46,9 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
@@ -76,97 +76,26 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP assignment of a row-major dense matrix to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP assignment of a dense matrix to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be assigned.
+// \param rhs The right-hand side dense matrix to be assigned.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP assignment of a row-major
-// dense matrix to a dense matrix.\n
+// This function is the backend implementation of the OpenMP-based SMP assignment of a dense matrix
+// to a dense matrix. The target matrix is partitioned into a 2D grid of tiles (see the
+// ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP assignment of a column-major dense matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be assigned.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP assignment of a column-major
-// dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -174,7 +103,6 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -182,37 +110,34 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~lhs, vectorizable ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int index=0; index<int( threads.size() ); ++index )
    {
-      const size_t column( i*colsPerThread );
+      const size_t i( size_t( index ) / threads.columns() );
+      const size_t j( size_t( index ) % threads.columns() );
 
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t row   ( i*threads.rowsPerThread() );
+      const size_t column( j*threads.colsPerThread() );
+      const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+      const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -222,98 +147,48 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP assignment of a row-major sparse matrix to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP assignment of a sparse matrix to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major sparse matrix to be assigned.
+// \param rhs The right-hand side sparse matrix to be assigned.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP assignment of a row-major
-// sparse matrix to a dense matrix.\n
+// This function is the backend implementation of the OpenMP-based SMP assignment of a sparse
+// matrix to a dense matrix. The target matrix is partitioned into a 2D grid of tiles (see the
+// ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP assignment of a column-major sparse matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major sparse matrix to be assigned.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP assignment of a column-major
-// sparse matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~lhs, false ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int index=0; index<int( threads.size() ); ++index )
    {
-      const size_t column( i*colsPerThread );
+      const size_t i( size_t( index ) / threads.columns() );
+      const size_t j( size_t( index ) % threads.columns() );
 
-      if( column >= (~lhs).columns() )
-         continue;
+      const size_t row   ( i*threads.rowsPerThread() );
+      const size_t column( j*threads.colsPerThread() );
+      const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+      const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 }
 /*! \endcond */
@@ -393,7 +268,10 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      assign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
@@ -418,99 +296,26 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP addition assignment of a row-major dense matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be added.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
-// row-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP addition assignment of a column-major dense matrix
-//        to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a dense matrix to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be added.
+// \param rhs The right-hand side dense matrix to be added.
 // \return void
 //
 // This function is the backend implementation of the OpenMP-based SMP addition assignment of a
-// column-major dense matrix to a dense matrix.\n
+// dense matrix to a dense matrix. The target matrix is partitioned into a 2D grid of tiles (see
+// the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -518,7 +323,6 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -526,37 +330,34 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~lhs, vectorizable ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int index=0; index<int( threads.size() ); ++index )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
+      const size_t i( size_t( index ) / threads.columns() );
+      const size_t j( size_t( index ) % threads.columns() );
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t row   ( i*threads.rowsPerThread() );
+      const size_t column( j*threads.colsPerThread() );
+      const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+      const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -566,100 +367,48 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP addition assignment of a row-major sparse matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major sparse matrix to be added.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
-// row-major sparse matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP addition assignment of a column-major sparse matrix
-//        to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a sparse matrix to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major sparse matrix to be added.
+// \param rhs The right-hand side sparse matrix to be added.
 // \return void
 //
 // This function is the backend implementation of the OpenMP-based SMP addition assignment of a
-// column-major sparse matrix to a dense matrix.\n
+// sparse matrix to a dense matrix. The target matrix is partitioned into a 2D grid of tiles (see
+// the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~lhs, false ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int index=0; index<int( threads.size() ); ++index )
    {
-      const size_t column( i*colsPerThread );
+      const size_t i( size_t( index ) / threads.columns() );
+      const size_t j( size_t( index ) % threads.columns() );
 
-      if( column >= (~lhs).columns() )
-         continue;
+      const size_t row   ( i*threads.rowsPerThread() );
+      const size_t column( j*threads.colsPerThread() );
+      const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+      const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 }
 /*! \endcond */
@@ -739,7 +488,10 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      addAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
@@ -764,99 +516,27 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a row-major dense matrix
-//        to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a dense matrix to a dense
+//        matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be subtracted.
+// \param rhs The right-hand side dense matrix to be subtracted.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP subtraction assignment
-// of a row-major dense matrix to a dense matrix.\n
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// dense matrix to a dense matrix. The target matrix is partitioned into a 2D grid of tiles (see
+// the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a column-major dense matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be subtracted.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP subtraction assignment
-// of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -864,7 +544,6 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -872,37 +551,34 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~lhs, vectorizable ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int index=0; index<int( threads.size() ); ++index )
    {
-      const size_t column( i*colsPerThread );
+      const size_t i( size_t( index ) / threads.columns() );
+      const size_t j( size_t( index ) % threads.columns() );
 
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t row   ( i*threads.rowsPerThread() );
+      const size_t column( j*threads.colsPerThread() );
+      const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+      const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -912,100 +588,49 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a row-major sparse matrix
-//        to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a sparse matrix to a dense
+//        matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major sparse matrix to be subtracted.
+// \param rhs The right-hand side sparse matrix to be subtracted.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP subtraction assignment
-// of a row-major sparse matrix to a dense matrix.\n
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// sparse matrix to a dense matrix. The target matrix is partitioned into a 2D grid of tiles (see
+// the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a column-major sparse matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major sparse matrix to be subtracted.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP subtraction assignment
-// of a column-major sparse matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~lhs, false ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int index=0; index<int( threads.size() ); ++index )
    {
-      const size_t column( i*colsPerThread );
+      const size_t i( size_t( index ) / threads.columns() );
+      const size_t j( size_t( index ) % threads.columns() );
 
-      if( column >= (~lhs).columns() )
-         continue;
+      const size_t row   ( i*threads.rowsPerThread() );
+      const size_t column( j*threads.colsPerThread() );
+      const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+      const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 }
 /*! \endcond */
@@ -1085,7 +710,10 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      subAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
@@ -173,8 +173,6 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
    const int    threads      ( omp_get_num_threads() );
@@ -269,7 +267,10 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      assign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
@@ -392,8 +393,6 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
    const int    threads      ( omp_get_num_threads() );
@@ -488,7 +487,10 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      addAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
@@ -611,8 +613,6 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
    const int    threads      ( omp_get_num_threads() );
@@ -707,7 +707,10 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      subAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
@@ -832,8 +835,6 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
    const int    threads      ( omp_get_num_threads() );
@@ -928,7 +929,10 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      multAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          multAssign( ~lhs, ~rhs );
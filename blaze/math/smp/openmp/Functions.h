@@ -41,10 +41,12 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <string>
 #include <omp.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/Types.h>
 
 
@@ -88,7 +90,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL )
       throw std::invalid_argument( "Invalid number of threads" );
@@ -99,6 +101,36 @@ BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the placement of the threads used for OpenMP parallel operations.
+// \ingroup smp
+//
+// \param spec The affinity specification (\c "compact", \c "scatter", \c "none", or a CPU list).
+// \return void
+// \exception std::invalid_argument Invalid affinity specification.
+//
+// Via this function the threads of the OpenMP thread team are pinned to specific CPUs (see
+// threadpool::Affinity). Note that this includes the calling thread, which is the master thread
+// of the team, and that the placement is only preserved as long as the OpenMP runtime reuses
+// its threads. Preferably, the placement is specified via the \c OMP_PROC_BIND and
+// \c OMP_PLACES environment variables. In case an invalid specification is given, a
+// \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setAffinity( const std::string& spec )
+{
+   const threadpool::Affinity affinity( spec );
+
+   if( affinity.isEmpty() )
+      return;
+
+#pragma omp parallel shared( affinity )
+   affinity.pin( static_cast<size_t>( omp_get_thread_num() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,675 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/tbb/DenseMatrix.h
+//  \brief Header file for the TBB-based dense matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TBB_DENSEMATRIX_H_
+#define _BLAZE_MATH_SMP_TBB_DENSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/tbb/TBBBackend.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tile operation of the TBB-based SMP assignment of a dense matrix to a dense matrix.
+// \ingroup smp
+//
+// The DMatDMatTBBAssigner class template represents the operation of the TBB-based SMP
+// assignment on a 2D range of tiles of the target dense matrix (see the ThreadMapping class).
+// All tiles of the range are processed as a single submatrix. The type of the assignment
+// (plain assignment, addition assignment, ...) is specified by the \a OP template parameter.
+*/
+template< typename OP     // Type of the assignment operation
+        , typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+class DMatDMatTBBAssigner
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;    //!< Type of an aligned target submatrix.
+   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;  //!< Type of an unaligned target submatrix.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatDMatTBBAssigner class template.
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side dense matrix.
+   // \param tiles The tile partition of the target matrix.
+   // \param vectorizable \a true in case the assignment is vectorized, \a false if not.
+   */
+   explicit inline DMatDMatTBBAssigner( MT1& lhs, const MT2& rhs,
+                                        const ThreadMapping& tiles, bool vectorizable )
+      : lhs_       ( lhs )                              // The target left-hand side dense matrix
+      , rhs_       ( rhs )                              // The right-hand side dense matrix
+      , tiles_     ( tiles )                            // The tile partition of the target matrix
+      , lhsAligned_( vectorizable && lhs.isAligned() )  // Flag for an aligned target matrix
+      , rhsAligned_( vectorizable && rhs.isAligned() )  // Flag for an aligned source matrix
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment for the given 2D range of tiles.
+   //
+   // \param firstRow The first tile row.
+   // \param lastRow The tile row one past the last tile row.
+   // \param firstColumn The first tile column.
+   // \param lastColumn The tile column one past the last tile column.
+   // \return void
+   */
+   inline void operator()( size_t firstRow, size_t lastRow, size_t firstColumn, size_t lastColumn ) const {
+      const size_t row   ( firstRow   *tiles_.rowsPerThread() );
+      const size_t column( firstColumn*tiles_.colsPerThread() );
+      const size_t m( min( ( lastRow    - firstRow    )*tiles_.rowsPerThread(), lhs_.rows()    - row    ) );
+      const size_t n( min( ( lastColumn - firstColumn )*tiles_.colsPerThread(), lhs_.columns() - column ) );
+
+      if( lhsAligned_ && rhsAligned_ ) {
+         AlignedTarget target( submatrix<aligned>( lhs_, row, column, m, n ) );
+         OP::apply( target, submatrix<aligned>( rhs_, row, column, m, n ) );
+      }
+      else if( lhsAligned_ ) {
+         AlignedTarget target( submatrix<aligned>( lhs_, row, column, m, n ) );
+         OP::apply( target, submatrix<unaligned>( rhs_, row, column, m, n ) );
+      }
+      else if( rhsAligned_ ) {
+         UnalignedTarget target( submatrix<unaligned>( lhs_, row, column, m, n ) );
+         OP::apply( target, submatrix<aligned>( rhs_, row, column, m, n ) );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( lhs_, row, column, m, n ) );
+         OP::apply( target, submatrix<unaligned>( rhs_, row, column, m, n ) );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   MT1&                 lhs_;         //!< The target left-hand side dense matrix.
+   const MT2&           rhs_;         //!< The right-hand side dense matrix.
+   const ThreadMapping& tiles_;       //!< The tile partition of the target matrix.
+   const bool           lhsAligned_;  //!< Flag for an aligned, vectorized access to the target matrix.
+   const bool           rhsAligned_;  //!< Flag for an aligned, vectorized access to the source matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tile operation of the TBB-based SMP assignment of a sparse matrix to a dense matrix.
+// \ingroup smp
+//
+// The DMatSMatTBBAssigner class template represents the operation of the TBB-based SMP
+// assignment on a 2D range of tiles of the target dense matrix (see the ThreadMapping class).
+// All tiles of the range are processed as a single submatrix. The type of the assignment
+// (plain assignment, addition assignment, ...) is specified by the \a OP template parameter.
+*/
+template< typename OP     // Type of the assignment operation
+        , typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+class DMatSMatTBBAssigner
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;  //!< Type of an unaligned target submatrix.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatSMatTBBAssigner class template.
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side sparse matrix.
+   // \param tiles The tile partition of the target matrix.
+   */
+   explicit inline DMatSMatTBBAssigner( MT1& lhs, const MT2& rhs, const ThreadMapping& tiles )
+      : lhs_  ( lhs )    // The target left-hand side dense matrix
+      , rhs_  ( rhs )    // The right-hand side sparse matrix
+      , tiles_( tiles )  // The tile partition of the target matrix
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment for the given 2D range of tiles.
+   //
+   // \param firstRow The first tile row.
+   // \param lastRow The tile row one past the last tile row.
+   // \param firstColumn The first tile column.
+   // \param lastColumn The tile column one past the last tile column.
+   // \return void
+   */
+   inline void operator()( size_t firstRow, size_t lastRow, size_t firstColumn, size_t lastColumn ) const {
+      const size_t row   ( firstRow   *tiles_.rowsPerThread() );
+      const size_t column( firstColumn*tiles_.colsPerThread() );
+      const size_t m( min( ( lastRow    - firstRow    )*tiles_.rowsPerThread(), lhs_.rows()    - row    ) );
+      const size_t n( min( ( lastColumn - firstColumn )*tiles_.colsPerThread(), lhs_.columns() - column ) );
+
+      UnalignedTarget target( submatrix<unaligned>( lhs_, row, column, m, n ) );
+      OP::apply( target, submatrix<unaligned>( rhs_, row, column, m, n ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   MT1&                 lhs_;    //!< The target left-hand side dense matrix.
+   const MT2&           rhs_;    //!< The right-hand side sparse matrix.
+   const ThreadMapping& tiles_;  //!< The tile partition of the target matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BACKEND FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the TBB-based SMP assignment of a dense matrix to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix.
+// \return void
+//
+// This function is the backend implementation of the TBB-based SMP assignment of a dense matrix
+// to a dense matrix. The type of the assignment is specified by the \a OP template parameter.
+// The target matrix is partitioned into a 2D grid of \a TBBBackend::tasksPerThread tiles per
+// thread (see the ThreadMapping class), which are distributed among the threads of the current
+// TBB task arena.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename OP   // Type of the assignment operation
+        , typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename MT1::ElementType  ET1;
+   typedef typename MT2::ElementType  ET2;
+
+   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
+
+   const ThreadMapping tiles( createThreadMapping( TheTBBBackend::size() * TheTBBBackend::tasksPerThread,
+                                                   ~lhs, vectorizable ) );
+
+   const DMatDMatTBBAssigner<OP,MT1,MT2> op( ~lhs, ~rhs, tiles, vectorizable );
+   TheTBBBackend::parallelFor2D( tiles.rows(), tiles.columns(), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the TBB-based SMP assignment of a sparse matrix to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side sparse matrix.
+// \return void
+//
+// This function is the backend implementation of the TBB-based SMP assignment of a sparse matrix
+// to a dense matrix. The type of the assignment is specified by the \a OP template parameter.
+// The target matrix is partitioned into a 2D grid of \a TBBBackend::tasksPerThread tiles per
+// thread (see the ThreadMapping class), which are distributed among the threads of the current
+// TBB task arena.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename OP   // Type of the assignment operation
+        , typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const ThreadMapping tiles( createThreadMapping( TheTBBBackend::size() * TheTBBBackend::tasksPerThread,
+                                                   ~lhs, false ) );
+
+   const DMatSMatTBBAssigner<OP,MT1,MT2> op( ~lhs, ~rhs, tiles );
+   TheTBBBackend::parallelFor2D( tiles.rows(), tiles.columns(), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the TBB-based SMP assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default TBB-based SMP assignment to a dense matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsDenseMatrix<MT1>
+                             , Or< Not< IsSMPAssignable<MT1> >
+                                 , Not< IsSMPAssignable<MT2> > > > >::Type
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the TBB-based SMP assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the TBB-based SMP assignment to a dense matrix. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in case
+// both operands are SMP-assignable and the element types of both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsDenseMatrix<MT1>
+                             , IsSMPAssignable<MT1>
+                             , IsSMPAssignable<MT2> > >::Type
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() ) {
+      assign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend<TBBAssign>( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the TBB-based SMP addition assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the default TBB-based SMP addition assignment to a dense matrix. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsDenseMatrix<MT1>
+                             , Or< Not< IsSMPAssignable<MT1> >
+                                 , Not< IsSMPAssignable<MT2> > > > >::Type
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the TBB-based SMP addition assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the TBB-based SMP addition assignment to a dense matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsDenseMatrix<MT1>
+                             , IsSMPAssignable<MT1>
+                             , IsSMPAssignable<MT2> > >::Type
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() ) {
+      addAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         addAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend<TBBAddAssign>( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the TBB-based SMP subtraction assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the default TBB-based SMP subtraction assignment to a dense matrix. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsDenseMatrix<MT1>
+                             , Or< Not< IsSMPAssignable<MT1> >
+                                 , Not< IsSMPAssignable<MT2> > > > >::Type
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the TBB-based SMP subtraction assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the TBB-based SMP subtraction assignment to a dense matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsDenseMatrix<MT1>
+                             , IsSMPAssignable<MT1>
+                             , IsSMPAssignable<MT2> > >::Type
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() ) {
+      subAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         subAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend<TBBSubAssign>( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the TBB-based SMP multiplication assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be multiplied.
+// \return void
+//
+// This function implements the default TBB-based SMP multiplication assignment to a dense
+// matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< IsDenseMatrix<MT1> >::Type
+   smpMultAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   multAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_TBB_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
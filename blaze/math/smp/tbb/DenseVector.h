@@ -0,0 +1,729 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/tbb/DenseVector.h
+//  \brief Header file for the TBB-based dense vector SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TBB_DENSEVECTOR_H_
+#define _BLAZE_MATH_SMP_TBB_DENSEVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/tbb/TBBBackend.h>
+#include <blaze/math/SparseSubvector.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Range operation of the TBB-based SMP assignment of a dense vector to a dense vector.
+// \ingroup smp
+//
+// The DVecDVecTBBAssigner class template represents the operation of the TBB-based SMP
+// assignment on a range of chunks of the target dense vector. All chunks of the range are
+// processed as a single contiguous subvector. The type of the assignment (plain assignment,
+// addition assignment, ...) is specified by the \a OP template parameter.
+*/
+template< typename OP     // Type of the assignment operation
+        , typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+class DVecDVecTBBAssigner
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;    //!< Type of an aligned target subvector.
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;  //!< Type of an unaligned target subvector.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecDVecTBBAssigner class template.
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side dense vector.
+   // \param sizePerTask The number of elements per chunk.
+   // \param vectorizable \a true in case the assignment is vectorized, \a false if not.
+   */
+   explicit inline DVecDVecTBBAssigner( VT1& lhs, const VT2& rhs, size_t sizePerTask, bool vectorizable )
+      : lhs_         ( lhs )                                 // The target left-hand side dense vector
+      , rhs_         ( rhs )                                 // The right-hand side dense vector
+      , sizePerTask_ ( sizePerTask )                         // The number of elements per chunk
+      , lhsAligned_  ( vectorizable && lhs.isAligned() )     // Flag for an aligned target vector
+      , rhsAligned_  ( vectorizable && rhs.isAligned() )     // Flag for an aligned source vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment for the given range of chunks.
+   //
+   // \param first The index of the first chunk.
+   // \param last The index one past the last chunk.
+   // \return void
+   */
+   inline void operator()( size_t first, size_t last ) const {
+      const size_t index( first*sizePerTask_ );
+
+      if( index >= lhs_.size() )
+         return;
+
+      const size_t size( min( ( last - first )*sizePerTask_, lhs_.size() - index ) );
+
+      if( lhsAligned_ && rhsAligned_ ) {
+         AlignedTarget target( subvector<aligned>( lhs_, index, size ) );
+         OP::apply( target, subvector<aligned>( rhs_, index, size ) );
+      }
+      else if( lhsAligned_ ) {
+         AlignedTarget target( subvector<aligned>( lhs_, index, size ) );
+         OP::apply( target, subvector<unaligned>( rhs_, index, size ) );
+      }
+      else if( rhsAligned_ ) {
+         UnalignedTarget target( subvector<unaligned>( lhs_, index, size ) );
+         OP::apply( target, subvector<aligned>( rhs_, index, size ) );
+      }
+      else {
+         UnalignedTarget target( subvector<unaligned>( lhs_, index, size ) );
+         OP::apply( target, subvector<unaligned>( rhs_, index, size ) );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&         lhs_;          //!< The target left-hand side dense vector.
+   const VT2&   rhs_;          //!< The right-hand side dense vector.
+   const size_t sizePerTask_;  //!< The number of elements per chunk.
+   const bool   lhsAligned_;   //!< Flag for an aligned, vectorized access to the target vector.
+   const bool   rhsAligned_;   //!< Flag for an aligned, vectorized access to the source vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Range operation of the TBB-based SMP assignment of a sparse vector to a dense vector.
+// \ingroup smp
+//
+// The DVecSVecTBBAssigner class template represents the operation of the TBB-based SMP
+// assignment on a range of chunks of the target dense vector. All chunks of the range are
+// processed as a single contiguous subvector. The type of the assignment (plain assignment,
+// addition assignment, ...) is specified by the \a OP template parameter.
+*/
+template< typename OP     // Type of the assignment operation
+        , typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side sparse vector
+class DVecSVecTBBAssigner
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;  //!< Type of an unaligned target subvector.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecSVecTBBAssigner class template.
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side sparse vector.
+   // \param sizePerTask The number of elements per chunk.
+   */
+   explicit inline DVecSVecTBBAssigner( VT1& lhs, const VT2& rhs, size_t sizePerTask )
+      : lhs_        ( lhs )          // The target left-hand side dense vector
+      , rhs_        ( rhs )          // The right-hand side sparse vector
+      , sizePerTask_( sizePerTask )  // The number of elements per chunk
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment for the given range of chunks.
+   //
+   // \param first The index of the first chunk.
+   // \param last The index one past the last chunk.
+   // \return void
+   */
+   inline void operator()( size_t first, size_t last ) const {
+      const size_t index( first*sizePerTask_ );
+
+      if( index >= lhs_.size() )
+         return;
+
+      const size_t size( min( ( last - first )*sizePerTask_, lhs_.size() - index ) );
+
+      UnalignedTarget target( subvector<unaligned>( lhs_, index, size ) );
+      OP::apply( target, subvector<unaligned>( rhs_, index, size ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&         lhs_;          //!< The target left-hand side dense vector.
+   const VT2&   rhs_;          //!< The right-hand side sparse vector.
+   const size_t sizePerTask_;  //!< The number of elements per chunk.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BACKEND FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the TBB-based SMP assignment of a dense vector to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the TBB-based SMP assignment of a dense vector
+// to a dense vector. The type of the assignment is specified by the \a OP template parameter.
+// The target vector is split into \a TBBBackend::tasksPerThread chunks per thread, which are
+// distributed among the threads of the current TBB task arena.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename OP   // Type of the assignment operation
+        , typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   if( (~lhs).size() == 0UL )
+      return;
+
+   typedef typename VT1::ElementType                  ET1;
+   typedef typename VT2::ElementType                  ET2;
+   typedef IntrinsicTrait<typename VT1::ElementType>  IT;
+
+   const bool vectorizable( VT1::vectorizable && VT2::vectorizable && IsSame<ET1,ET2>::value );
+
+   const size_t tasks      ( TheTBBBackend::size() * TheTBBBackend::tasksPerThread );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   const DVecDVecTBBAssigner<OP,VT1,VT2> op( ~lhs, ~rhs, sizePerTask, vectorizable );
+   TheTBBBackend::parallelFor( 0UL, ( (~lhs).size() + sizePerTask - 1UL ) / sizePerTask, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the TBB-based SMP assignment of a sparse vector to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector.
+// \return void
+//
+// This function is the backend implementation of the TBB-based SMP assignment of a sparse vector
+// to a dense vector. The type of the assignment is specified by the \a OP template parameter.
+// The target vector is split into \a TBBBackend::tasksPerThread chunks per thread, which are
+// distributed among the threads of the current TBB task arena.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename OP   // Type of the assignment operation
+        , typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side sparse vector
+        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
+void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   if( (~lhs).size() == 0UL )
+      return;
+
+   const size_t tasks      ( TheTBBBackend::size() * TheTBBBackend::tasksPerThread );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
+
+   const DVecSVecTBBAssigner<OP,VT1,VT2> op( ~lhs, ~rhs, sizePerTask );
+   TheTBBBackend::parallelFor( 0UL, ( (~lhs).size() + sizePerTask - 1UL ) / sizePerTask, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the TBB-based SMP assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function implements the default TBB-based SMP assignment to a dense vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , Or< Not< IsSMPAssignable<VT1> >
+                                 , Not< IsSMPAssignable<VT2> > > > >::Type
+   smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the TBB-based SMP assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function performs the TBB-based SMP assignment to a dense vector. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in case
+// both operands are SMP-assignable and the element types of both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , IsSMPAssignable<VT1>
+                             , IsSMPAssignable<VT2> > >::Type
+   smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isParallelSectionActive() ) {
+      assign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend<TBBAssign>( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the TBB-based SMP addition assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be added.
+// \return void
+//
+// This function implements the default TBB-based SMP addition assignment to a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , Or< Not< IsSMPAssignable<VT1> >
+                                 , Not< IsSMPAssignable<VT2> > > > >::Type
+   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the TBB-based SMP addition assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be added.
+// \return void
+//
+// This function performs the TBB-based SMP addition assignment to a dense vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , IsSMPAssignable<VT1>
+                             , IsSMPAssignable<VT2> > >::Type
+   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isParallelSectionActive() ) {
+      addAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         addAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend<TBBAddAssign>( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the TBB-based SMP subtraction assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+//
+// This function implements the default TBB-based SMP subtraction assignment to a dense vector. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , Or< Not< IsSMPAssignable<VT1> >
+                                 , Not< IsSMPAssignable<VT2> > > > >::Type
+   smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the TBB-based SMP subtraction assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+//
+// This function performs the TBB-based SMP subtraction assignment to a dense vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , IsSMPAssignable<VT1>
+                             , IsSMPAssignable<VT2> > >::Type
+   smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isParallelSectionActive() ) {
+      subAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         subAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend<TBBSubAssign>( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the TBB-based SMP multiplication assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be multiplied.
+// \return void
+//
+// This function implements the default TBB-based SMP multiplication assignment to a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , Or< Not< IsSMPAssignable<VT1> >
+                                 , Not< IsSMPAssignable<VT2> > > > >::Type
+   smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   multAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the TBB-based SMP multiplication assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be multiplied.
+// \return void
+//
+// This function performs the TBB-based SMP multiplication assignment to a dense vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , IsSMPAssignable<VT1>
+                             , IsSMPAssignable<VT2> > >::Type
+   smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isParallelSectionActive() ) {
+      multAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         multAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend<TBBMultAssign>( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_TBB_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
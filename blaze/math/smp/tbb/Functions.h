@@ -0,0 +1,178 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/tbb/Functions.h
+//  \brief Header file for the TBB-based SMP utility functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TBB_FUNCTIONS_H_
+#define _BLAZE_MATH_SMP_TBB_FUNCTIONS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <string>
+#include <blaze/math/smp/tbb/TBBBackend.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads used for TBB parallel operations.
+// \ingroup smp
+//
+// \return The number of threads used for TBB parallel operations.
+//
+// Via this function the number of threads used for TBB parallel operations can be queried.
+// The number of threads corresponds to the concurrency of the TBB task arena of the calling
+// thread, bounded by the limit specified via the blaze::setNumThreads() function.
+*/
+BLAZE_ALWAYS_INLINE size_t getNumThreads()
+{
+   return TheTBBBackend::size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the number of threads to be used for TBB parallel operations.
+// \ingroup smp
+//
+// \param number The given number of threads \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// Via this function the maximum number of threads for TBB parallel operations can be specified.
+// Note that the worker threads are owned by the application: the function limits the number of
+// threads a single operation is split for, but cannot exceed the concurrency of the current TBB
+// task arena (see \c tbb::task_arena and \c tbb::global_control). The given \a number must be
+// in the range \f$[1..\infty)\f$. In case an invalid number of threads is specified, a
+// \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
+{
+   if( number == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+
+   TheTBBBackend::resize( number );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the placement of the threads used for TBB parallel operations.
+// \ingroup smp
+//
+// \param spec The affinity specification (\c "compact", \c "scatter", \c "none", or a CPU list).
+// \return void
+// \exception std::invalid_argument Invalid affinity specification.
+//
+// Since the worker threads of the TBB task scheduler are owned by the application, Blaze does
+// not change their placement. The function only validates the given specification (see
+// threadpool::Affinity) and throws a \a std::invalid_argument exception in case it is invalid.
+// The placement of the threads has to be specified via the constraints of the application's
+// \c tbb::task_arena.
+*/
+BLAZE_ALWAYS_INLINE void setAffinity( const std::string& spec )
+{
+   const threadpool::Affinity affinity( spec );
+   UNUSED_PARAMETER( affinity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
+// \ingroup smp
+//
+// \return void
+//
+// This function has no effect for the TBB-based parallelization, since the worker threads are
+// managed by the TBB task scheduler of the application. It is provided for compatibility with
+// the C++11 thread-based parallelization:
+
+   \code
+   int main()
+   {
+      // ... Using the TBB parallelization of Blaze
+
+      shutDownThreads();
+   }
+   \endcode
+*/
+BLAZE_ALWAYS_INLINE void shutDownThreads()
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_TBB_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
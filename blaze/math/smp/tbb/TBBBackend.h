@@ -0,0 +1,488 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/tbb/TBBBackend.h
+//  \brief Header file for the TBB backend system
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TBB_TBBBACKEND_H_
+#define _BLAZE_MATH_SMP_TBB_TBBBACKEND_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <tbb/blocked_range.h>
+#include <tbb/blocked_range2d.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend system for the Intel TBB-based parallelization.
+// \ingroup smp
+//
+// The TBBBackend class template represents the backend system for the parallelization based on
+// the task scheduler of the Intel Threading Building Blocks (TBB). In contrast to the C++11 and
+// Boost thread-based parallelization it does not manage any threads. Instead, all parallel
+// operations are submitted to the TBB task arena of the calling thread, i.e. Blaze shares the
+// worker threads of the application and respects the concurrency limits of its arenas.\n
+// The index range of a parallel operation is split into \c tasksPerThread tasks per thread,
+// which are recursively split and distributed by the TBB scheduler. This over-decomposition
+// enables the scheduler to balance the load in case some of the worker threads are busy with
+// other tasks of the application. Parallel operations are executed in isolation, i.e. a thread
+// waiting for the completion of a Blaze operation only executes tasks of this operation. Thus
+// nested parallelism composes: parallel Blaze operations can be started from within the tasks
+// of the application (and vice versa), in which case the nested operations are simply executed
+// on the available worker threads.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only. Using
+// this class explicitly might result in erroneous results and/or in undefined behavior.
+*/
+template< typename T >  // Dummy type for the static member initialization
+class TBBBackend
+{
+ public:
+   //**********************************************************************************************
+   enum { tasksPerThread = 4 };  //!< Number of tasks per thread of a parallel operation.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t size  ();
+   static inline void   resize( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Task execution functions********************************************************************
+   /*!\name Task execution functions */
+   //@{
+   template< typename OP >
+   static inline void parallelFor( size_t first, size_t last, const OP& op );
+
+   template< typename OP >
+   static inline void parallelFor2D( size_t m, size_t n, const OP& op );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class RangeBody*********************************************************************
+   /*!\brief Auxiliary body for the execution of a range operation on a TBB range.
+   */
+   template< typename OP >  // Type of the range operation
+   struct RangeBody
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the RangeBody class template.
+      //
+      // \param op The range operation to be executed.
+      */
+      explicit inline RangeBody( const OP& op )
+         : op_( op )  // The range operation
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the range operation for the given subrange.
+      //
+      // \param range The subrange to be processed.
+      // \return void
+      */
+      inline void operator()( const tbb::blocked_range<size_t>& range ) const {
+         if( isParallelSectionActive() ) {
+            op_( range.begin(), range.end() );
+         }
+         else BLAZE_PARALLEL_SECTION {
+            op_( range.begin(), range.end() );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const OP& op_;  //!< The range operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class TileBody**********************************************************************
+   /*!\brief Auxiliary body for the execution of a tile operation on a 2D TBB range.
+   */
+   template< typename OP >  // Type of the tile operation
+   struct TileBody
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the TileBody class template.
+      //
+      // \param op The tile operation to be executed.
+      */
+      explicit inline TileBody( const OP& op )
+         : op_( op )  // The tile operation
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the tile operation for the given 2D subrange.
+      //
+      // \param range The 2D subrange to be processed.
+      // \return void
+      */
+      inline void operator()( const tbb::blocked_range2d<size_t>& range ) const {
+         if( isParallelSectionActive() ) {
+            op_( range.rows().begin(), range.rows().end(), range.cols().begin(), range.cols().end() );
+         }
+         else BLAZE_PARALLEL_SECTION {
+            op_( range.rows().begin(), range.rows().end(), range.cols().begin(), range.cols().end() );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const OP& op_;  //!< The tile operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class IsolatedLoop******************************************************************
+   /*!\brief Auxiliary functor for the isolated execution of a TBB parallel loop.
+   */
+   template< typename Range    // Type of the TBB range
+           , typename Body >   // Type of the loop body
+   struct IsolatedLoop
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the IsolatedLoop class template.
+      //
+      // \param range The range of the parallel loop.
+      // \param body The body of the parallel loop.
+      */
+      explicit inline IsolatedLoop( const Range& range, const Body& body )
+         : range_( range )  // The range of the parallel loop
+         , body_ ( body  )  // The body of the parallel loop
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the parallel loop.
+      //
+      // \return void
+      */
+      inline void operator()() const {
+         tbb::parallel_for( range_, body_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const Range& range_;  //!< The range of the parallel loop.
+      const Body&  body_;   //!< The body of the parallel loop.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static size_t limit_;  //!< The maximum number of threads of a parallel operation.
+                          /*!< In case the limit is 0, the number of threads is only bounded
+                               by the concurrency of the current TBB task arena. */
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+size_t TBBBackend<T>::limit_ = 0UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads available for parallel operations.
+//
+// \return The number of threads available for parallel operations.
+//
+// This function returns the concurrency of the TBB task arena of the calling thread, bounded
+// by the limit specified via the resize() function.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline size_t TBBBackend<T>::size()
+{
+   const size_t concurrency( static_cast<size_t>( tbb::this_task_arena::max_concurrency() ) );
+   return ( limit_ != 0UL && limit_ < concurrency )?( limit_ ):( concurrency );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Limits the number of threads used for parallel operations.
+//
+// \param n The maximum number of threads \f$[1..\infty)\f$.
+// \return void
+//
+// This function limits the number of threads a single parallel operation is decomposed for.
+// Note that the number of worker threads is controlled by the application (for instance via
+// \c tbb::task_arena or \c tbb::global_control) and cannot be increased via this function.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline void TBBBackend<T>::resize( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of threads" );
+
+   limit_ = n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASK EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given range operation in parallel.
+//
+// \param first The first index of the index range.
+// \param last The index one past the last index of the index range.
+// \param op The range operation to be executed.
+// \return void
+//
+// This function executes the given range operation for disjoint subranges of the index range
+// \f$[first..last)\f$, which are recursively split by the TBB scheduler down to a minimum of
+// \f$ (last-first)/(size() \cdot tasksPerThread) \f$ indices. Each subrange is executed inside
+// a parallel section. The function returns after all subranges have been
+// processed. Exceptions thrown by the range operation are propagated to the calling thread.
+*/
+template< typename T >   // Dummy type for the static member initialization
+template< typename OP >  // Type of the range operation
+inline void TBBBackend<T>::parallelFor( size_t first, size_t last, const OP& op )
+{
+   typedef tbb::blocked_range<size_t>  Range;
+   typedef RangeBody<OP>               Body;
+
+   const size_t tasks( size() * tasksPerThread );
+   const size_t grain( ( last - first > tasks )?( ( last - first ) / tasks ):( 1UL ) );
+
+   const Range range( first, last, grain );
+   const Body  body ( op );
+
+   tbb::this_task_arena::isolate( IsolatedLoop<Range,Body>( range, body ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given tile operation in parallel.
+//
+// \param m The number of tile rows.
+// \param n The number of tile columns.
+// \param op The tile operation to be executed.
+// \return void
+//
+// This function executes the given tile operation for disjoint 2D subranges of the grid of
+// \f$ m \times n \f$ tiles, which are recursively split by the TBB scheduler. The tile operation
+// is called with the first and one-past-the-last tile row and tile column of the subrange. Each
+// subrange is executed inside a parallel section. The function returns after all subranges
+// have been processed. Exceptions thrown by the tile operation are propagated to the calling
+// thread.
+*/
+template< typename T >   // Dummy type for the static member initialization
+template< typename OP >  // Type of the tile operation
+inline void TBBBackend<T>::parallelFor2D( size_t m, size_t n, const OP& op )
+{
+   typedef tbb::blocked_range2d<size_t>  Range;
+   typedef TileBody<OP>                  Body;
+
+   const Range range( 0UL, m, 1UL, 0UL, n, 1UL );
+   const Body  body ( op );
+
+   tbb::this_task_arena::isolate( IsolatedLoop<Range,Body>( range, body ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The type of the active TBB backend system.
+// \ingroup smp
+//
+// This type represents the active TBB backend system. This backend system must be used to
+// query the number of threads used to execute operations and to execute parallel operations.
+*/
+typedef TBBBackend<int>  TheTBBBackend;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Plain assignment operation of the TBB-based parallelization.
+// \ingroup smp
+*/
+struct TBBAssign
+{
+   template< typename Target, typename Source >
+   static inline void apply( Target& target, const Source& source ) {
+      assign( target, source );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operation of the TBB-based parallelization.
+// \ingroup smp
+*/
+struct TBBAddAssign
+{
+   template< typename Target, typename Source >
+   static inline void apply( Target& target, const Source& source ) {
+      addAssign( target, source );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operation of the TBB-based parallelization.
+// \ingroup smp
+*/
+struct TBBSubAssign
+{
+   template< typename Target, typename Source >
+   static inline void apply( Target& target, const Source& source ) {
+      subAssign( target, source );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operation of the TBB-based parallelization.
+// \ingroup smp
+*/
+struct TBBMultAssign
+{
+   template< typename Target, typename Source >
+   static inline void apply( Target& target, const Source& source ) {
+      multAssign( target, source );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_TBB_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1013 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Async.h
+//  \brief Header file for the C++11/Boost thread-based asynchronous evaluation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNC_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <condition_variable>
+#  include <mutex>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/thread/condition.hpp>
+#  include <boost/thread/mutex.hpp>
+#endif
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Backoff.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ASYNCSTATEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base class for all asynchronously evaluated statements.
+// \ingroup smp
+//
+// The AsyncStatement class represents a single asynchronously evaluated statement within the
+// task graph of the thread backend. It provides the information about the operands written and
+// read by the statement and stores the dependencies of the statement on previously submitted
+// statements as well as the statements depending on it. Additionally, each pending statement
+// is linked to the pending statements with the same target operand, which enables the task
+// graph to add and remove pending statements in constant time. The lifetime of a statement is
+// managed by reference counting: both the task graph and all AsyncHandle instances referring
+// to the statement hold a reference.
+*/
+class AsyncStatement : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline AsyncStatement( const void* target );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   virtual ~AsyncStatement() {}
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const void* target() const;
+
+   virtual bool writes( const void* alias ) const = 0;
+   virtual bool reads ( const void* alias ) const = 0;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   virtual void execute() = 0;
+
+   inline void run    ();
+   inline void acquire();
+   inline void release();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const void* const            target_;        //!< The address of the target operand.
+   boost::atomic<size_t>        references_;    //!< The number of references to the statement.
+   boost::atomic<size_t>        handles_;       //!< The number of handles referring to the statement.
+   boost::atomic<bool>          done_;          //!< Completion flag of the statement.
+   size_t                       dependencies_;  //!< The number of pending predecessors.
+   std::vector<AsyncStatement*> successors_;    //!< The statements depending on this statement.
+   AsyncStatement*              older_;         //!< The previous pending statement with the same target.
+   AsyncStatement*              newer_;         //!< The next pending statement with the same target.
+   AsyncStatement*              prev_;          //!< The previous target in the list of pending targets.
+   AsyncStatement*              next_;          //!< The next target in the list of pending targets.
+   bool                         failed_;        //!< Failure flag of the statement.
+   std::string                  error_;         //!< The error message of a failed evaluation.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename TB, typename MT, typename LT, typename CT > friend class AsyncGraph;
+   friend class AsyncHandle;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the AsyncStatement class.
+//
+// \param target The address of the target operand of the statement.
+*/
+inline AsyncStatement::AsyncStatement( const void* target )
+   : target_      ( target )  // The address of the target operand
+   , references_  ( 0UL    )  // The number of references to the statement
+   , handles_     ( 0UL    )  // The number of handles referring to the statement
+   , done_        ( false  )  // Completion flag of the statement
+   , dependencies_( 0UL    )  // The number of pending statements this statement depends on
+   , successors_  ()          // The statements depending on this statement
+   , older_       ( NULL   )  // The previous pending statement with the same target
+   , newer_       ( NULL   )  // The next pending statement with the same target
+   , prev_        ( NULL   )  // The previous target in the list of pending targets
+   , next_        ( NULL   )  // The next target in the list of pending targets
+   , failed_      ( false  )  // Failure flag of the statement
+   , error_       ()          // The error message in case the evaluation failed
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the address of the target operand of the statement.
+//
+// \return The address of the target operand.
+*/
+inline const void* AsyncStatement::target() const
+{
+   return target_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the statement.
+//
+// \return void
+//
+// This function evaluates the statement. Any exception thrown during the evaluation is caught
+// and stored in order to be reported by the AsyncHandle::wait() function.
+*/
+inline void AsyncStatement::run()
+{
+   try {
+      execute();
+   }
+   catch( std::exception& ex ) {
+      failed_ = true;
+      error_  = ex.what();
+   }
+   catch( ... ) {
+      failed_ = true;
+      error_  = "Unknown error during asynchronous evaluation";
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Acquiring a reference to the statement.
+//
+// \return void
+*/
+inline void AsyncStatement::acquire()
+{
+   references_.fetch_add( 1UL, boost::memory_order_relaxed );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Releasing a reference to the statement.
+//
+// \return void
+//
+// This function releases a reference to the statement. In case the last reference is released,
+// the statement is destroyed.
+*/
+inline void AsyncStatement::release()
+{
+   if( references_.fetch_sub( 1UL, boost::memory_order_acq_rel ) == 1UL )
+      delete this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Asynchronously evaluated assignment of a vector or matrix expression.
+// \ingroup smp
+//
+// The AsyncAssignment class template represents the asynchronous assignment of the given source
+// operand to the given target operand. The target operand is stored by reference, the source
+// operand is stored by value in case it is an expression and by reference otherwise. The data
+// dependencies to other statements are determined via the isAliased() functions of the operands.
+*/
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+class AsyncAssignment : public AsyncStatement
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the source operand.
+   typedef typename SelectType< IsExpression<Source>::value, const Source, const Source& >::Type  Operand;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssignment class template.
+   //
+   // \param target The target operand to be assigned to.
+   // \param source The source operand to be assigned to the target.
+   */
+   explicit inline AsyncAssignment( Target& target, const Source& source )
+      : AsyncStatement( &target )  // Initialization of the base class
+      , target_( target )          // The target operand
+      , source_( source )          // The source operand
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns whether the statement writes to the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the statement writes to the alias, \a false if not.
+   */
+   virtual bool writes( const void* alias ) const {
+      return target_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the statement reads from the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the statement reads from the alias, \a false if not.
+   */
+   virtual bool reads( const void* alias ) const {
+      return source_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\brief Performs the assignment of the source operand to the target operand.
+   //
+   // \return void
+   */
+   virtual void execute() {
+      target_ = source_;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Target& target_;  //!< The target operand.
+   Operand source_;  //!< The source operand.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( Target );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCGRAPH
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task graph for the asynchronous evaluation of statements.
+// \ingroup smp
+//
+// The AsyncGraph class template manages all pending asynchronously evaluated statements. The
+// pending statements writing the same target operand form a chain in the order of submission,
+// in which each statement depends on its predecessor. The most recently submitted statement of
+// each chain is stored in an intrusive list of pending targets. On submission, a statement is
+// checked against the pending targets for data dependencies. In case it depends on at least one
+// pending statement, it is deferred until all of them have been completed, otherwise it is
+// immediately scheduled for execution on the given thread backend.
+// Each statement is evaluated by a single thread within a serial section, i.e. independent
+// statements are evaluated concurrently, whereas dependent statements are serialized in the
+// order of their submission.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only. Using
+// this class explicitly might result in erroneous results and/or in undefined behavior.
+*/
+template< typename TB    // Type of the thread backend
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class AsyncGraph
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void submit( AsyncStatement* statement );
+   static inline void wait  ( AsyncStatement* statement );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class Executor**********************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a statement.
+   */
+   struct Executor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Executor class.
+      //
+      // \param statement The statement to be executed.
+      */
+      explicit inline Executor( AsyncStatement* statement )
+         : statement_( statement )  // The statement to be executed
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the statement and releases its successors.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         statement_->run();
+         complete( statement_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      AsyncStatement* statement_;  //!< The statement to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void complete( AsyncStatement* statement );
+   static inline void depend  ( AsyncStatement* statement, AsyncStatement* predecessor );
+   static inline void replace ( AsyncStatement* oldTarget, AsyncStatement* newTarget );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static MT              mutex_;       //!< Synchronization mutex.
+   static CT              completion_;  //!< Wait condition for completed statements.
+   static AsyncStatement* pending_;     //!< The head of the list of pending targets.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TB, typename MT, typename LT, typename CT >
+MT AsyncGraph<TB,MT,LT,CT>::mutex_;
+
+template< typename TB, typename MT, typename LT, typename CT >
+CT AsyncGraph<TB,MT,LT,CT>::completion_;
+
+template< typename TB, typename MT, typename LT, typename CT >
+AsyncStatement* AsyncGraph<TB,MT,LT,CT>::pending_ = NULL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Submitting a statement for asynchronous evaluation.
+//
+// \param statement The statement to be evaluated.
+// \return void
+//
+// This function adds the given statement to the task graph. In case the statement depends on
+// any pending statement, its evaluation is deferred until all these statements have been
+// completed. Otherwise the statement is immediately scheduled for execution. The statement
+// depends on a pending statement in case it reads the target of the pending statement (read
+// after write), in case it writes an operand read by the pending statement (write after read),
+// or in case both statements write the same target (write after write). Since the statements
+// of a chain are evaluated in order, it suffices to check the read and written operands of the
+// statement once per pending target and to depend on the most recent conflicting statement of
+// each chain.
+*/
+template< typename TB    // Type of the thread backend
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void AsyncGraph<TB,MT,LT,CT>::submit( AsyncStatement* statement )
+{
+   BLAZE_INTERNAL_ASSERT( statement != NULL, "Invalid statement detected" );
+
+   {
+      LT lock( mutex_ );
+
+      AsyncStatement* chain( NULL );
+
+      for( AsyncStatement* last=pending_; last!=NULL; last=last->next_ )
+      {
+         if( last->target() == statement->target() )
+            chain = last;
+
+         if( last == chain || statement->reads( last->target() ) || statement->writes( last->target() ) ) {
+            depend( statement, last );
+            continue;
+         }
+
+         for( AsyncStatement* pred=last; pred!=NULL; pred=pred->older_ ) {
+            if( pred->reads( statement->target() ) ) {
+               depend( statement, pred );
+               break;
+            }
+         }
+      }
+
+      statement->acquire();
+
+      if( chain != NULL ) {
+         replace( chain, statement );
+         chain->newer_ = statement;
+         statement->older_ = chain;
+      }
+      else {
+         statement->next_ = pending_;
+         if( pending_ != NULL )
+            pending_->prev_ = statement;
+         pending_ = statement;
+      }
+
+      if( statement->dependencies_ != 0UL )
+         return;
+   }
+
+   TB::scheduleTask( Executor( statement ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for the given statement to be completed.
+//
+// \param statement The statement to wait for.
+// \return void
+//
+// The waiting thread follows the hybrid wait policy of the threadpool::Backoff class: it polls
+// the completion flag of the statement for \c SMP_SPIN_TIME microseconds, yields its time slice
+// for \c SMP_YIELD_TIME microseconds and only then blocks on a condition variable.
+*/
+template< typename TB    // Type of the thread backend
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void AsyncGraph<TB,MT,LT,CT>::wait( AsyncStatement* statement )
+{
+   threadpool::Backoff backoff;
+
+   while( !statement->done_.load( boost::memory_order_acquire ) ) {
+      if( !backoff.wait() ) {
+         LT lock( mutex_ );
+         while( !statement->done_.load( boost::memory_order_acquire ) ) {
+            completion_.wait( lock );
+         }
+         return;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Notification about the completion of a statement.
+//
+// \param statement The completed statement.
+// \return void
+//
+// This function removes the given statement from the task graph, schedules all successors
+// that have no further pending dependencies, and wakes up all threads waiting for a statement.
+// Since the statements of a chain are evaluated in order, the completed statement is always
+// the oldest statement of its chain and can be removed in constant time. The successors are
+// scheduled after the mutex has been released, since scheduling might block in case the task
+// queue of the thread backend is full. The statement must not be accessed afterwards since the
+// reference of the task graph is released.
+*/
+template< typename TB    // Type of the thread backend
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void AsyncGraph<TB,MT,LT,CT>::complete( AsyncStatement* statement )
+{
+   std::vector<AsyncStatement*> ready;
+
+   {
+      LT lock( mutex_ );
+
+      BLAZE_INTERNAL_ASSERT( statement->older_ == NULL, "Invalid completion order detected" );
+
+      if( statement->newer_ != NULL ) {
+         statement->newer_->older_ = NULL;
+         statement->newer_ = NULL;
+      }
+      else {
+         replace( statement, NULL );
+      }
+
+      ready.swap( statement->successors_ );
+
+      size_t count( 0UL );
+      for( size_t i=0UL; i<ready.size(); ++i ) {
+         if( --ready[i]->dependencies_ == 0UL )
+            ready[count++] = ready[i];
+      }
+      ready.resize( count );
+
+      statement->done_.store( true, boost::memory_order_release );
+      completion_.notify_all();
+   }
+
+   for( size_t i=0UL; i<ready.size(); ++i )
+      TB::scheduleTask( Executor( ready[i] ) );
+
+   statement->release();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Registering a data dependency between two statements.
+//
+// \param statement The newly submitted statement.
+// \param predecessor The pending statement the new statement depends on.
+// \return void
+*/
+template< typename TB    // Type of the thread backend
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void AsyncGraph<TB,MT,LT,CT>::depend( AsyncStatement* statement, AsyncStatement* predecessor )
+{
+   predecessor->successors_.push_back( statement );
+   ++statement->dependencies_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Replacing a statement in the list of pending targets.
+//
+// \param oldTarget The statement to be removed from the list of pending targets.
+// \param newTarget The statement taking its place (\c NULL to remove the target).
+// \return void
+*/
+template< typename TB    // Type of the thread backend
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void AsyncGraph<TB,MT,LT,CT>::replace( AsyncStatement* oldTarget, AsyncStatement* newTarget )
+{
+   AsyncStatement* const prev( oldTarget->prev_ );
+   AsyncStatement* const next( oldTarget->next_ );
+
+   if( newTarget != NULL ) {
+      newTarget->prev_ = prev;
+      newTarget->next_ = next;
+      if( prev != NULL ) prev->next_ = newTarget; else pending_ = newTarget;
+      if( next != NULL ) next->prev_ = newTarget;
+   }
+   else {
+      if( prev != NULL ) prev->next_ = next; else pending_ = next;
+      if( next != NULL ) next->prev_ = prev;
+   }
+
+   oldTarget->prev_ = NULL;
+   oldTarget->next_ = NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The type of the active task graph.
+// \ingroup smp
+*/
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+typedef AsyncGraph< TheThreadBackend
+                  , std::mutex
+                  , std::unique_lock< std::mutex >
+                  , std::condition_variable
+                  >  TheAsyncGraph;
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+typedef AsyncGraph< TheThreadBackend
+                  , boost::mutex
+                  , boost::unique_lock< boost::mutex >
+                  , boost::condition_variable
+                  >  TheAsyncGraph;
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCHANDLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Completion handle for an asynchronously evaluated statement.
+// \ingroup smp
+//
+// The AsyncHandle class represents the completion handle of a statement submitted via the
+// async() function. The wait() function blocks until the statement has been evaluated, the
+// done() function queries the state of the statement without blocking. Handles can be copied
+// freely; the destructor of the last handle referring to a statement implicitly waits for the
+// completion of the statement.
+*/
+class AsyncHandle
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline AsyncHandle( AsyncStatement* statement=NULL );
+            inline AsyncHandle( const AsyncHandle& handle );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~AsyncHandle();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline AsyncHandle& operator=( const AsyncHandle& handle );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool done() const;
+   inline void wait() const;
+   inline void swap( AsyncHandle& handle ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   AsyncStatement* statement_;  //!< The referenced statement.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the AsyncHandle class.
+//
+// \param statement The referenced statement (\c NULL for an empty handle).
+//
+// An empty handle doesn't refer to any statement and is always completed. Note that this
+// constructor is reserved for internal use by the async() functions.
+*/
+inline AsyncHandle::AsyncHandle( AsyncStatement* statement )
+   : statement_( statement )  // The referenced statement
+{
+   if( statement_ != NULL ) {
+      statement_->acquire();
+      statement_->handles_.fetch_add( 1UL, boost::memory_order_relaxed );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for AsyncHandle.
+//
+// \param handle The handle to be copied.
+*/
+inline AsyncHandle::AsyncHandle( const AsyncHandle& handle )
+   : statement_( handle.statement_ )  // The referenced statement
+{
+   if( statement_ != NULL ) {
+      statement_->acquire();
+      statement_->handles_.fetch_add( 1UL, boost::memory_order_relaxed );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for AsyncHandle.
+//
+// In case this is the last handle referring to the statement, the destructor waits for the
+// completion of the statement. Errors that occurred during the evaluation are not reported.
+*/
+inline AsyncHandle::~AsyncHandle()
+{
+   if( statement_ != NULL ) {
+      if( statement_->handles_.fetch_sub( 1UL, boost::memory_order_acq_rel ) == 1UL )
+         TheAsyncGraph::wait( statement_ );
+      statement_->release();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for AsyncHandle.
+//
+// \param handle The handle to be copied.
+// \return Reference to the assigned handle.
+*/
+inline AsyncHandle& AsyncHandle::operator=( const AsyncHandle& handle )
+{
+   AsyncHandle tmp( handle );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the referenced statement has been completed.
+//
+// \return \a true in case the statement has been completed, \a false if not.
+*/
+inline bool AsyncHandle::done() const
+{
+   return statement_ == NULL || statement_->done_.load( boost::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the referenced statement to be completed.
+//
+// \return void
+// \exception std::runtime_error Asynchronous evaluation failed.
+//
+// This function blocks until the referenced statement has been evaluated. In case an exception
+// has been thrown during the evaluation of the statement, a \a std::runtime_error exception with
+// the according error message is thrown.
+*/
+inline void AsyncHandle::wait() const
+{
+   if( statement_ == NULL )
+      return;
+
+   TheAsyncGraph::wait( statement_ );
+
+   if( statement_->failed_ )
+      throw std::runtime_error( statement_->error_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two handles.
+//
+// \param handle The handle to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void AsyncHandle::swap( AsyncHandle& handle ) /* throw() */
+{
+   std::swap( statement_, handle.statement_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS EVALUATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the asynchronous assignment of a vector or matrix.
+// \ingroup smp
+//
+// \param lhs The target vector or matrix.
+// \param rhs The vector or matrix expression to be assigned.
+// \return The completion handle of the assignment.
+//
+// This function submits the assignment of \a rhs to \a lhs to the task graph. Within a parallel
+// section the assignment is performed immediately, since waiting for other statements from
+// within a thread of the backend system could deadlock. Within a serial section the function
+// waits for the completion of the assignment.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+inline AsyncHandle async_backend( T1& lhs, const T2& rhs )
+{
+   if( isParallelSectionActive() ) {
+      lhs = rhs;
+      return AsyncHandle();
+   }
+
+   AsyncStatement* statement( new AsyncAssignment<T1,T2>( lhs, rhs ) );
+   AsyncHandle handle( statement );
+   TheAsyncGraph::submit( statement );
+
+   if( isSerialSectionActive() )
+      handle.wait();
+
+   return handle;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector.
+// \ingroup smp
+//
+// \param lhs The target vector.
+// \param rhs The vector or vector expression to be assigned.
+// \return The completion handle of the assignment.
+//
+// This function assigns the vector or vector expression \a rhs to the vector \a lhs without
+// waiting for the completion of the assignment:
+
+   \code
+   blaze::AsyncHandle h1 = blaze::async( y1, A * x1 );
+   blaze::AsyncHandle h2 = blaze::async( y2, B * x2 );  // Evaluated concurrently to y1
+   blaze::AsyncHandle h3 = blaze::async( z, C * y1 );   // Deferred until y1 has been computed
+   h3.wait();
+   \endcode
+
+// The assignment is evaluated by a single thread of the backend system. Statements without
+// data dependencies are evaluated concurrently, whereas an assignment that reads or writes an
+// operand written by a pending statement, or that writes an operand read by a pending statement,
+// is deferred until the according statements have been completed. The data dependencies are
+// determined via the isAliased() functions of the operands, i.e. views can be used as operands
+// of the right-hand side expression, but not as target of the assignment.
+//
+// Until the assignment has been completed, the target vector must not be accessed and the
+// operands of the expression must neither be modified nor destroyed, except by subsequent
+// calls to async(). Since the sizes of the operands are already queried when the expression
+// is created, a target that is read by a subsequent statement must not be resized by its
+// assignment, i.e. it must already have the correct size. The destructor of the last handle
+// referring to the assignment waits for its completion. Errors that occur during the evaluation
+// are reported by the wait() function of the handle via a \a std::runtime_error exception.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of the vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline AsyncHandle async( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return async_backend( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix.
+// \ingroup smp
+//
+// \param lhs The target matrix.
+// \param rhs The matrix or matrix expression to be assigned.
+// \return The completion handle of the assignment.
+//
+// This function assigns the matrix or matrix expression \a rhs to the matrix \a lhs without
+// waiting for the completion of the assignment. See the async() function for vectors for a
+// detailed description of the dependency tracking and the restrictions on the operands.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline AsyncHandle async( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return async_backend( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,10 +45,10 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
@@ -76,25 +76,27 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a row-major dense matrix to a
-//        dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a dense matrix to a dense
+//        matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be assigned.
+// \param rhs The right-hand side dense matrix to be assigned.
 // \return void
 //
-// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a row-major dense matrix to a dense matrix.\n
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// dense matrix to a dense matrix. The target matrix is partitioned into a 2D grid of tiles (see
+// the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -102,7 +104,6 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -110,115 +111,39 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a column-major dense matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be assigned.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs, vectorizable ) );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   TheThreadBackend::TaskGroup group;
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<threads.rows(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<threads.columns(); ++j )
+      {
+         const size_t row   ( i*threads.rowsPerThread() );
+         const size_t column( j*threads.colsPerThread() );
+         const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+         const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( group, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( group, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -226,103 +151,53 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a row-major sparse matrix
-//        to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sparse matrix to a dense
+//        matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major sparse matrix to be assigned.
+// \param rhs The right-hand side sparse matrix to be assigned.
 // \return void
 //
-// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a row-major sparse matrix to a dense matrix.\n
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// sparse matrix to a dense matrix. The target matrix is partitioned into a 2D grid of tiles (see
+// the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs, false ) );
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
+   TheThreadBackend::TaskGroup group;
 
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a column-major sparse matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major sparse matrix to be assigned.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a column-major sparse matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
-
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<threads.rows(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<threads.columns(); ++j )
+      {
+         const size_t row   ( i*threads.rowsPerThread() );
+         const size_t column( j*threads.colsPerThread() );
+         const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+         const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
+
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+      }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -401,7 +276,10 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      assign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
@@ -425,25 +303,27 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a row-major dense
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a dense matrix to a
+//        dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be added.
+// \param rhs The right-hand side dense matrix to be added.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP addition
-// assignment of a row-major dense matrix to a dense matrix.\n
+// assignment of a dense matrix to a dense matrix. The target matrix is partitioned into a 2D grid
+// of tiles (see the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -451,7 +331,6 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -459,115 +338,39 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs, vectorizable ) );
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a column-major dense
-//        matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be added.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP addition
-// assignment of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
+   TheThreadBackend::TaskGroup group;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<threads.rows(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<threads.columns(); ++j )
+      {
+         const size_t row   ( i*threads.rowsPerThread() );
+         const size_t column( j*threads.colsPerThread() );
+         const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+         const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( group, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( group, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -575,103 +378,53 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a row-major sparse
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a sparse matrix to a
+//        dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major sparse matrix to be added.
+// \param rhs The right-hand side sparse matrix to be added.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP addition
-// assignment of a row-major sparse matrix to a dense matrix.\n
+// assignment of a sparse matrix to a dense matrix. The target matrix is partitioned into a 2D grid
+// of tiles (see the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs, false ) );
 
+   TheThreadBackend::TaskGroup group;
 
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a column-major sparse
-//        matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major sparse matrix to be added.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP addition
-// assignment of a column-major sparse matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
-
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<threads.rows(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<threads.columns(); ++j )
+      {
+         const size_t row   ( i*threads.rowsPerThread() );
+         const size_t column( j*threads.colsPerThread() );
+         const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+         const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
+
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+      }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -751,7 +504,10 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      addAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
@@ -775,25 +531,27 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a row-major dense
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a dense matrix to a
+//        dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be subtracted.
+// \param rhs The right-hand side dense matrix to be subtracted.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a row-major dense matrix to a dense matrix.\n
+// assignment of a dense matrix to a dense matrix. The target matrix is partitioned into a 2D grid
+// of tiles (see the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -801,7 +559,6 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -809,115 +566,39 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a column-major
-//        dense matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be subtracted.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs, vectorizable ) );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   TheThreadBackend::TaskGroup group;
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<threads.rows(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<threads.columns(); ++j )
+      {
+         const size_t row   ( i*threads.rowsPerThread() );
+         const size_t column( j*threads.colsPerThread() );
+         const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+         const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( group, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( group, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -925,103 +606,53 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a row-major sparse
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a sparse matrix to
+//        a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major sparse matrix to be subtracted.
+// \param rhs The right-hand side sparse matrix to be subtracted.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a row-major sparse matrix to a dense matrix.\n
+// assignment of a sparse matrix to a dense matrix. The target matrix is partitioned into a 2D grid
+// of tiles (see the ThreadMapping class), which are processed in parallel.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs, false ) );
 
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
+   TheThreadBackend::TaskGroup group;
 
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a column-major
-//        sparse matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major sparse matrix to be subtracted.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a column-major sparse matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
-
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<threads.rows(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<threads.columns(); ++j )
+      {
+         const size_t row   ( i*threads.rowsPerThread() );
+         const size_t column( j*threads.colsPerThread() );
+         const size_t m( min( threads.rowsPerThread(), (~lhs).rows()    - row    ) );
+         const size_t n( min( threads.colsPerThread(), (~lhs).columns() - column ) );
+
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( group, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+      }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -1102,7 +733,10 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      subAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
@@ -115,6 +115,8 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const size_t rest         ( equalShare & ( IT::size - 1UL ) );
    const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
+   TheThreadBackend::TaskGroup group;
+
    for( size_t i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -126,23 +128,23 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( group, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( group, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -175,14 +177,14 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
    const size_t threads      ( TheThreadBackend::size() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
+   TheThreadBackend::TaskGroup group;
+
    for( size_t i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -192,10 +194,10 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -272,7 +274,10 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      assign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
@@ -337,6 +342,8 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( IT::size - 1UL ) );
    const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
+   TheThreadBackend::TaskGroup group;
+
    for( size_t i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -348,23 +355,23 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( group, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( group, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -397,14 +404,14 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
    const size_t threads      ( TheThreadBackend::size() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
+   TheThreadBackend::TaskGroup group;
+
    for( size_t i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -414,10 +421,10 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleAddAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -495,7 +502,10 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      addAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
@@ -560,6 +570,8 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( IT::size - 1UL ) );
    const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
+   TheThreadBackend::TaskGroup group;
+
    for( size_t i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -571,23 +583,23 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( group, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( group, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -620,14 +632,14 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
    const size_t threads      ( TheThreadBackend::size() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
+   TheThreadBackend::TaskGroup group;
+
    for( size_t i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -637,10 +649,10 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleSubAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -719,7 +731,10 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      subAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
@@ -784,6 +799,8 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const size_t rest         ( equalShare & ( IT::size - 1UL ) );
    const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
+   TheThreadBackend::TaskGroup group;
+
    for( size_t i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -795,23 +812,23 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( group, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( group, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -844,14 +861,14 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
    const size_t threads      ( TheThreadBackend::size() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
+   TheThreadBackend::TaskGroup group;
+
    for( size_t i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -861,10 +878,10 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleMultAssign( group, target, subvector<unaligned>( ~rhs, index, size ) );
    }
 
-   TheThreadBackend::wait();
+   group.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -943,7 +960,10 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
+   if( isParallelSectionActive() ) {
+      multAssign( ~lhs, ~rhs );
+   }
+   else BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          multAssign( ~lhs, ~rhs );
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <string>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
@@ -86,7 +87,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..\infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL )
       throw std::invalid_argument( "Invalid number of threads" );
@@ -97,6 +98,30 @@ BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the placement of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \param spec The affinity specification (\c "compact", \c "scatter", \c "none", or a CPU list).
+// \return void
+// \exception std::invalid_argument Invalid affinity specification.
+//
+// Via this function the threads used for thread parallel operations can be pinned to specific
+// CPUs. The specification \c "compact" fills up the cores of one socket before using the next
+// socket, \c "scatter" distributes the threads round-robin over all sockets, and an explicit
+// CPU list such as \c "0,2,4-7" assigns the \a i-th thread to the \a i-th listed CPU. The
+// initial placement is given by the \c BLAZE_AFFINITY environment variable. In case an invalid
+// specification is given, a \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setAffinity( const std::string& spec )
+{
+   TheThreadBackend::setAffinity( spec );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,171 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ParallelFor.h
+//  \brief Header file for the C++11/Boost thread-based implementation of the SMP parallel range loop
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_THREADS_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL RANGE LOOP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP parallel range loop.
+// \ingroup smp
+//
+// \param first The first index of the index range.
+// \param last The index one past the last index of the index range.
+// \param op The range operation to be executed.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP parallel
+// range loop. It splits the given index range into one contiguous subrange per thread and
+// schedules the range operation for each subrange.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of range operations.
+*/
+template< typename OP >  // Type of the range operation
+void smpFor_backend( size_t first, size_t last, const OP& op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const size_t size         ( last - first );
+   const size_t threads      ( min( TheThreadBackend::size(), size ) );
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( size / threads + addon );
+
+   TheThreadBackend::TaskGroup group;
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t begin( first + i*sizePerThread );
+
+      if( begin >= last )
+         continue;
+
+      TheThreadBackend::scheduleRange( group, op, begin, min( begin+sizePerThread, last ) );
+   }
+
+   group.wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief C++11/Boost thread-based SMP parallel range loop.
+// \ingroup smp
+//
+// \param first The first index of the index range.
+// \param last The index one past the last index of the index range.
+// \param op The range operation to be executed.
+// \return void
+//
+// This function executes the given range operation \a op for the index range \f$[first..last)\f$
+// in parallel. The range operation has to provide a constant function call operator that accepts
+// the first and one-past-the-last index of a subrange. Each subrange is processed by exactly one
+// thread, i.e. the operation is required to only modify data that is exclusively associated with
+// the given subrange. The range operation is copied into each scheduled task and should therefore
+// only hold pointers or references to the data it operates on.\n
+// In case the function is called from within a serial section or from within an active parallel
+// section, or in case only a single thread is available, the complete range is processed by a
+// single call of \a op on the calling thread.
+*/
+template< typename OP >  // Type of the range operation
+void smpFor( size_t first, size_t last, const OP& op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_USER_ASSERT( first <= last, "Invalid index range detected" );
+
+   if( first >= last )
+      return;
+
+   if( isParallelSectionActive() || isSerialSectionActive() ||
+       TheThreadBackend::size() < 2UL || last - first < 2UL ) {
+      op( first, last );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFor_backend( first, last, op );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
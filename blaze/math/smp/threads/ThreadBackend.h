@@ -51,11 +51,20 @@
 #endif
 
 #include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <boost/exception_ptr.hpp>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/constraints/Const.h>
+#include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Backoff.h>
+#include <blaze/util/threadpool/Barrier.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
 
@@ -75,7 +84,10 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. All tasks are scheduled
+// as part of a TaskGroup, which serves as completion handle for a single submission. This way
+// several application threads can concurrently share the pool of threads and each thread only
+// waits for the completion of its own tasks.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -86,12 +98,163 @@ template< typename TT    // Type of the encapsulated thread
 class ThreadBackend
 {
  public:
+   //**Class TaskGroup*****************************************************************************
+   /*!\brief Completion handle for a group of scheduled tasks.
+   //
+   // The TaskGroup class counts the number of pending tasks of a single submission to the
+   // thread backend. The wait() function blocks until all tasks scheduled as part of the
+   // group have been completed. Tasks scheduled by other threads or as part of other groups
+   // are not waited for. In case a task of the group has thrown an exception, the first
+   // captured exception is rethrown by the wait() function in the waiting thread. The
+   // destructor implicitly waits for all pending tasks, but doesn't report exceptions.\n
+   // The waiting thread follows the hybrid wait policy of the threadpool::Backoff class: it
+   // polls the number of pending tasks for \c SMP_SPIN_TIME microseconds, yields its time slice
+   // for \c SMP_YIELD_TIME microseconds and only then blocks on a condition variable. The
+   // number of pending tasks and the blocking state of the waiting thread are combined in a
+   // single atomic state, such that a completing task only acquires the mutex of the group in
+   // case the waiting thread is actually blocked.
+   */
+   class TaskGroup : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief The default constructor of the TaskGroup class.
+      */
+      explicit inline TaskGroup()
+         : state_( 0UL )  // Twice the number of pending tasks plus the blocking flag
+         , mutex_()       // Synchronization mutex
+         , done_ ()       // Wait condition for the completion of all tasks
+         , error_()       // The first exception thrown by a task of the group
+      {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief The destructor of the TaskGroup class.
+      */
+      inline ~TaskGroup() {
+         join();
+      }
+      //*******************************************************************************************
+
+      //**Wait function****************************************************************************
+      /*!\brief Waiting for all tasks of the group to be completed.
+      //
+      // \return void
+      //
+      // This function blocks until all tasks of the group have been completed. In case a task
+      // has thrown an exception, the first captured exception is rethrown.
+      */
+      inline void wait() {
+         join();
+         if( error_ ) {
+            const boost::exception_ptr error( error_ );
+            error_ = boost::exception_ptr();
+            boost::rethrow_exception( error );
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Utility functions************************************************************************
+      /*!\brief Blocking until all tasks of the group have been completed.
+      //
+      // \return void
+      */
+      inline void join() {
+         threadpool::Backoff backoff;
+
+         while( state_.load( boost::memory_order_acquire ) != 0UL ) {
+            if( !backoff.wait() ) {
+               LT lock( mutex_ );
+               size_t state( state_.load() );
+               while( state != 0UL && !state_.compare_exchange_weak( state, state | 1UL ) ) {}
+               while( state_.load() > 1UL ) {
+                  done_.wait( lock );
+               }
+               state_.store( 0UL );
+               return;
+            }
+         }
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Registration of a new pending task.
+      //
+      // \return void
+      */
+      inline void add() {
+         state_.fetch_add( 2UL );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Capturing the currently handled exception of a task.
+      //
+      // \return void
+      //
+      // This function must be called from within a catch block. Only the first exception thrown
+      // by a task of the group is kept.
+      */
+      inline void fail() {
+         LT lock( mutex_ );
+         if( !error_ )
+            error_ = boost::current_exception();
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Notification about the completion of a task.
+      //
+      // \return void
+      //
+      // In case the waiting thread is not blocked, the completion only decrements the number of
+      // pending tasks; the group must not be accessed afterwards since the waiting thread might
+      // already have returned. Otherwise the decrement is performed under the lock of the group
+      // in order to keep the group alive until the notification has been sent.
+      */
+      inline void complete() {
+         size_t state( state_.load( boost::memory_order_relaxed ) );
+         while( ( state & 1UL ) == 0UL ) {
+            if( state_.compare_exchange_weak( state, state - 2UL ) )
+               return;
+         }
+         LT lock( mutex_ );
+         if( state_.fetch_sub( 2UL ) == 3UL )
+            done_.notify_all();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      boost::atomic<size_t> state_;  //!< Twice the number of pending tasks plus the blocking flag.
+      MT mutex_;                     //!< Synchronization mutex.
+      CT done_;                      //!< Wait condition for the completion of all tasks.
+      boost::exception_ptr  error_;  //!< The first exception thrown by a task of the group.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      friend class ThreadBackend;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   /*!\brief Sense-reversing barrier for fork-join kernels.
+   //
+   // The barrier can be used to synchronize the phases of the tasks of a fork-join kernel
+   // (see threadpool::Barrier). All participating tasks have to be executed concurrently, i.e.
+   // the number of tasks must not exceed the number of threads of the backend system.
+   */
+   typedef threadpool::Barrier<MT,LT,CT>  Barrier;
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t size       ();
+   static inline void   resize     ( size_t n, bool block=false );
+   static inline void   wait       ();
+   static inline void   setAffinity( const std::string& spec );
    //@}
    //**********************************************************************************************
 
@@ -99,16 +262,22 @@ class ThreadBackend
    /*!\name Thread execution functions */
    //@{
    template< typename Target, typename Source >
-   static inline void scheduleAssign( Target& target, const Source& source );
+   static inline void scheduleAssign( TaskGroup& group, Target& target, const Source& source );
 
    template< typename Target, typename Source >
-   static inline void scheduleAddAssign( Target& target, const Source& source );
+   static inline void scheduleAddAssign( TaskGroup& group, Target& target, const Source& source );
 
    template< typename Target, typename Source >
-   static inline void scheduleSubAssign( Target& target, const Source& source );
+   static inline void scheduleSubAssign( TaskGroup& group, Target& target, const Source& source );
 
    template< typename Target, typename Source >
-   static inline void scheduleMultAssign( Target& target, const Source& source );
+   static inline void scheduleMultAssign( TaskGroup& group, Target& target, const Source& source );
+
+   template< typename OP >
+   static inline void scheduleRange( TaskGroup& group, const OP& op, size_t begin, size_t end );
+
+   template< typename OP >
+   static inline void scheduleTask( const OP& op );
    //@}
    //**********************************************************************************************
 
@@ -125,10 +294,12 @@ class ThreadBackend
       //
       // \param target The target operand to be assigned to.
       // \param source The source operand to be assigned to the target.
+      // \param group The task group of the assignment.
       */
-      explicit inline Assigner( Target& target, const Source& source )
+      explicit inline Assigner( Target& target, const Source& source, TaskGroup& group )
          : target_( target )  // The target operand
          , source_( source )  // The source operand
+         , group_ ( &group )  // The task group of the assignment
       {}
       //*******************************************************************************************
 
@@ -138,13 +309,22 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         assign( target_, source_ );
+         try {
+            BLAZE_PARALLEL_SECTION {
+               assign( target_, source_ );
+            }
+         }
+         catch( ... ) {
+            group_->fail();
+         }
+         group_->complete();
       }
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
       Target       target_;  //!< The target operand.
       const Source source_;  //!< The source operand.
+      TaskGroup*   group_;   //!< The task group of the assignment.
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
@@ -166,10 +346,12 @@ class ThreadBackend
       //
       // \param target The target operand to be assigned to.
       // \param source The source operand to be added to the target.
+      // \param group The task group of the assignment.
       */
-      explicit inline AddAssigner( Target& target, const Source& source )
+      explicit inline AddAssigner( Target& target, const Source& source, TaskGroup& group )
          : target_( target )  // The target operand
          , source_( source )  // The source operand
+         , group_ ( &group )  // The task group of the assignment
       {}
       //*******************************************************************************************
 
@@ -179,13 +361,22 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         addAssign( target_, source_ );
+         try {
+            BLAZE_PARALLEL_SECTION {
+               addAssign( target_, source_ );
+            }
+         }
+         catch( ... ) {
+            group_->fail();
+         }
+         group_->complete();
       }
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
       Target       target_;  //!< The target operand.
       const Source source_;  //!< The source operand.
+      TaskGroup*   group_;   //!< The task group of the assignment.
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
@@ -207,10 +398,12 @@ class ThreadBackend
       //
       // \param target The target operand to be assigned to.
       // \param source The source operand to be subtracted from the target.
+      // \param group The task group of the assignment.
       */
-      explicit inline SubAssigner( Target& target, const Source& source )
+      explicit inline SubAssigner( Target& target, const Source& source, TaskGroup& group )
          : target_( target )  // The target operand
          , source_( source )  // The source operand
+         , group_ ( &group )  // The task group of the assignment
       {}
       //*******************************************************************************************
 
@@ -220,13 +413,22 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         subAssign( target_, source_ );
+         try {
+            BLAZE_PARALLEL_SECTION {
+               subAssign( target_, source_ );
+            }
+         }
+         catch( ... ) {
+            group_->fail();
+         }
+         group_->complete();
       }
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
       Target       target_;  //!< The target operand.
       const Source source_;  //!< The source operand.
+      TaskGroup*   group_;   //!< The task group of the assignment.
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
@@ -248,10 +450,12 @@ class ThreadBackend
       //
       // \param target The target operand to be assigned to.
       // \param source The source operand to be multiplied with the target.
+      // \param group The task group of the assignment.
       */
-      explicit inline MultAssigner( Target& target, const Source& source )
+      explicit inline MultAssigner( Target& target, const Source& source, TaskGroup& group )
          : target_( target )  // The target operand
          , source_( source )  // The source operand
+         , group_ ( &group )  // The task group of the assignment
       {}
       //*******************************************************************************************
 
@@ -261,13 +465,22 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         multAssign( target_, source_ );
+         try {
+            BLAZE_PARALLEL_SECTION {
+               multAssign( target_, source_ );
+            }
+         }
+         catch( ... ) {
+            group_->fail();
+         }
+         group_->complete();
       }
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
       Target       target_;  //!< The target operand.
       const Source source_;  //!< The source operand.
+      TaskGroup*   group_;   //!< The task group of the assignment.
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
@@ -277,10 +490,94 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class RangeExecutor*****************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a range operation.
+   */
+   template< typename OP >  // Type of the range operation
+   struct RangeExecutor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the RangeExecutor class template.
+      //
+      // \param op The range operation to be executed.
+      // \param begin The first index of the subrange.
+      // \param end The index one past the last index of the subrange.
+      // \param group The task group of the range operation.
+      */
+      explicit inline RangeExecutor( const OP& op, size_t begin, size_t end, TaskGroup& group )
+         : op_   ( op     )  // The range operation
+         , begin_( begin  )  // The first index of the subrange
+         , end_  ( end    )  // The index one past the last index of the subrange
+         , group_( &group )  // The task group of the range operation
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the range operation for the given subrange.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         try {
+            BLAZE_PARALLEL_SECTION {
+               op_( begin_, end_ );
+            }
+         }
+         catch( ... ) {
+            group_->fail();
+         }
+         group_->complete();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const OP     op_;     //!< The range operation.
+      const size_t begin_;  //!< The first index of the subrange.
+      const size_t end_;    //!< The index one past the last index of the subrange.
+      TaskGroup*   group_;  //!< The task group of the range operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class TaskExecutor******************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a task without completion handle.
+   */
+   template< typename OP >  // Type of the task
+   struct TaskExecutor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the TaskExecutor class template.
+      //
+      // \param op The task to be executed.
+      */
+      explicit inline TaskExecutor( const OP& op )
+         : op_( op )  // The task
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the task.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         BLAZE_SERIAL_SECTION {
+            op_();
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      OP op_;  //!< The task.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t               initPool    ();
+   static inline threadpool::Affinity initAffinity();
    //@}
    //**********************************************************************************************
 
@@ -290,9 +587,10 @@ class ThreadBackend
    static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
                                                 /*!< It is initialized with the number of threads
                                                      specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+                                                     \c BLAZE_NUM_THREADS and pinned according
+                                                     to the \c BLAZE_AFFINITY environment variable.
+                                                     However, it can be explicitly resized to
+                                                     arbitrary numbers of threads. */
    //@}
    //**********************************************************************************************
 };
@@ -311,7 +609,7 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), initAffinity() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -376,7 +674,9 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed, including the tasks
+// scheduled by other threads. In order to wait for the tasks of a single submission only,
+// the TaskGroup::wait() function has to be used.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -390,6 +690,30 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changes the placement of the threads managed by the thread backend system.
+//
+// \param spec The affinity specification (\c "compact", \c "scatter", \c "none", or a CPU list).
+// \return void
+// \exception std::invalid_argument Invalid affinity specification.
+//
+// This function pins the threads of the backend system to the CPUs given by the affinity
+// specification (see threadpool::Affinity). In case an invalid specification is given, an
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( const std::string& spec )
+{
+   threadpool_.setAffinity( threadpool::Affinity( spec ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -402,6 +726,7 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling an assignment of the given operands for execution.
 //
+// \param group The task group of the assignment.
 // \param target The target operand to be assigned to.
 // \param source The target operand to be assigned to the target.
 // \return void
@@ -414,10 +739,12 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( TaskGroup& group, Target& target,
+                                                        const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   group.add();
+   threadpool_.schedule( Assigner<Target,Source>( target, source, group ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -427,6 +754,7 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const So
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling an addition assignment of the given operands for execution.
 //
+// \param group The task group of the assignment.
 // \param target The target operand to be assigned to.
 // \param source The target operand to be added to the target.
 // \return void
@@ -439,10 +767,12 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( TaskGroup& group, Target& target,
+                                                        const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   group.add();
+   threadpool_.schedule( AddAssigner<Target,Source>( target, source, group ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -452,6 +782,7 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling a subtraction assignment of the given operands for execution.
 //
+// \param group The task group of the assignment.
 // \param target The target operand to be assigned to.
 // \param source The target operand to be subtracted from the target.
 // \return void
@@ -464,10 +795,12 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( TaskGroup& group, Target& target,
+                                                        const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   group.add();
+   threadpool_.schedule( SubAssigner<Target,Source>( target, source, group ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -477,6 +810,7 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling a multiplication assignment of the given operands for execution.
 //
+// \param group The task group of the assignment.
 // \param target The target operand to be assigned to.
 // \param source The target operand to be multiplied with the target.
 // \return void
@@ -489,10 +823,65 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( TaskGroup& group, Target& target,
+                                                        const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   group.add();
+   threadpool_.schedule( MultAssigner<Target,Source>( target, source, group ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a range operation for execution.
+//
+// \param group The task group of the range operation.
+// \param op The range operation to be executed.
+// \param begin The first index of the subrange.
+// \param end The index one past the last index of the subrange.
+// \return void
+//
+// This function schedules the execution of the given range operation for the index range
+// \f$[begin..end)\f$. The range operation is copied into the scheduled task.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the range operation
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleRange( TaskGroup& group, const OP& op,
+                                                       size_t begin, size_t end )
+{
+   group.add();
+   threadpool_.schedule( RangeExecutor<OP>( op, begin, end, group ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a task for execution without completion handle.
+//
+// \param op The task to be executed.
+// \return void
+//
+// This function schedules the given task for execution. The task is copied into the thread pool
+// and executed within a serial section, i.e. all SMP operations performed by the task are executed
+// by the executing thread only. In contrast to the other scheduling functions the task is not part
+// of a task group, i.e. the task itself is responsible for signaling its completion.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleTask( const OP& op )
+{
+   threadpool_.schedule( TaskExecutor<OP>( op ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -539,6 +928,46 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial placement of the threads of the thread pool.
+//
+// \return The initial placement of the threads.
+//
+// This function determines the initial placement of the threads based on the \c BLAZE_AFFINITY
+// environment variable (\c "compact", \c "scatter", \c "none", or a CPU list such as
+// \c "0,2,4-7"). In case the environment variable is not defined or contains an invalid
+// specification, the threads are not pinned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline threadpool::Affinity ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   const char* env = std::getenv( "BLAZE_AFFINITY" );
+
+   if( env == NULL )
+      return threadpool::Affinity();
+
+   try {
+      return threadpool::Affinity( env );
+   }
+   catch( std::invalid_argument& ) {
+      return threadpool::Affinity();
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,229 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BasisFactorization.h
+//  \brief Header file for the sparse LU factorization of a simplex basis
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BASISFACTORIZATION_H_
+#define _BLAZE_MATH_SOLVERS_BASISFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Precision.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sparse LU factorization of a simplex basis with product form updates.
+// \ingroup complementarity_solvers
+//
+// The BasisFactorization class represents the inverse of a sparse, square basis matrix \f$ B \f$
+// as required by revised simplex and pivoting methods. The basis is factorized into \f$ P B Q =
+// L U \f$ by a right-looking sparse LU factorization with threshold Markowitz pivoting: In each
+// elimination step the pivot is chosen among the elements of the active submatrix that are at
+// least a fraction \f$ u = 0.1 \f$ of the largest element of their column such that the upper
+// bound \f$ (r-1)(c-1) \f$ of the fill-in is minimal, where \a r and \a c denote the number of
+// non-zero elements of the row and column of the candidate. The search for the pivot is limited
+// to a few rows and columns of minimal count, which in particular selects all row and column
+// singletons first. Subsequent exchanges of single basis columns are represented in product
+// form, i.e. each exchange appends an eta matrix to the factorization:
+
+      \f[ B_k^{-1} = E_k \cdots E_1 B_0^{-1} \f]
+
+// Both the forward transformation \f$ B^{-1} x \f$ (ftran()) and the backward transformation
+// \f$ B^{-T} x \f$ (btran()) skip all zero elements of the intermediate results. For very sparse
+// right-hand sides the overloads taking the indices of the non-zero elements restrict the solves
+// to the pattern of the result, which is determined by a depth-first search in the graphs of the
+// factors. Thus the cost of such a hypersparse solve is proportional to the number of arithmetic
+// operations instead of the size of the basis. Since the eta file grows with each update, the
+// basis should be refactorized as soon as etaNonZeros() becomes large compared to
+// factorNonZeros().
+*/
+class BasisFactorization
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BasisFactorization();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size          () const;
+   inline size_t factorNonZeros() const;
+   inline size_t etaNonZeros   () const;
+   inline size_t getNumUpdates () const;
+
+   bool factor( const CompressedMatrix<real,true>& B );
+   void update( size_t r, const VecN& alpha );
+   void update( size_t r, const VecN& alpha, const std::vector<size_t>& indices );
+   void ftran ( VecN& x ) const;
+   void ftran ( VecN& x, std::vector<size_t>& indices ) const;
+   void btran ( VecN& x ) const;
+   void btran ( VecN& x, std::vector<size_t>& indices ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   bool   selectPivot  ( size_t& row, size_t& col );
+   real   columnMaximum( size_t j );
+   size_t reach        ( const std::vector<size_t>& Ap, const std::vector<size_t>& Ai, size_t nz ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                      //!< The size of the basis.
+   std::vector<size_t> Lp_;        //!< The column offsets of the strictly lower factor.
+   std::vector<size_t> Li_;        //!< The row indices of the strictly lower factor.
+   std::vector<real>   Lx_;        //!< The values of the strictly lower factor.
+   std::vector<size_t> Ltp_;       //!< The row offsets of the strictly lower factor.
+   std::vector<size_t> Lti_;       //!< The column indices of the strictly lower factor.
+   std::vector<real>   Ltx_;       //!< The row-wise values of the strictly lower factor.
+   std::vector<size_t> Up_;        //!< The column offsets of the strictly upper factor.
+   std::vector<size_t> Ui_;        //!< The row indices of the strictly upper factor.
+   std::vector<real>   Ux_;        //!< The values of the strictly upper factor.
+   std::vector<size_t> Utp_;       //!< The row offsets of the strictly upper factor.
+   std::vector<size_t> Uti_;       //!< The column indices of the strictly upper factor.
+   std::vector<real>   Utx_;       //!< The row-wise values of the strictly upper factor.
+   std::vector<real>   Ud_;        //!< The diagonal of the upper factor.
+   std::vector<size_t> pinv_;      //!< The row permutation (original row to pivot position).
+   std::vector<size_t> prow_;      //!< The inverse row permutation (pivot position to original row).
+   std::vector<size_t> order_;     //!< The column permutation (pivot position to basis column).
+   std::vector<size_t> qinv_;      //!< The inverse column permutation (basis column to pivot position).
+   std::vector<size_t> etaP_;      //!< The offsets of the eta vectors.
+   std::vector<size_t> etaR_;      //!< The pivot positions of the eta vectors.
+   std::vector<real>   etaD_;      //!< The pivot values of the eta vectors.
+   std::vector<size_t> etaI_;      //!< The off-pivot indices of the eta vectors.
+   std::vector<real>   etaX_;      //!< The off-pivot values of the eta vectors.
+
+   std::vector< std::vector<size_t> > colIndices_;  //!< The row indices of the active submatrix.
+   std::vector< std::vector<real> >   colValues_;   //!< The values of the active submatrix.
+   std::vector< std::vector<size_t> > rowIndices_;  //!< The column indices of the active submatrix.
+   std::vector<real>   colMax_;    //!< Cached column maxima of the active submatrix.
+   std::vector<size_t> colHead_;   //!< Heads of the column lists by number of non-zero elements.
+   std::vector<size_t> colNext_;   //!< Successors within the column lists.
+   std::vector<size_t> colPrev_;   //!< Predecessors within the column lists.
+   std::vector<size_t> rowHead_;   //!< Heads of the row lists by number of non-zero elements.
+   std::vector<size_t> rowNext_;   //!< Successors within the row lists.
+   std::vector<size_t> rowPrev_;   //!< Predecessors within the row lists.
+
+   mutable std::vector<size_t> stack_;    //!< Stack and output of the depth-first search.
+   mutable std::vector<size_t> pstack_;   //!< Position stack of the depth-first search.
+   mutable std::vector<size_t> pattern_;  //!< Start nodes of the depth-first search.
+   mutable std::vector<size_t> marker_;   //!< Visit markers of the depth-first search.
+   mutable size_t stamp_;                 //!< The current visit stamp.
+   mutable VecN work_;                    //!< Dense work vector of the solves.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the factorized basis.
+//
+// \return The number of rows and columns of the basis.
+*/
+inline size_t BasisFactorization::size() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the LU factors.
+//
+// \return The number of non-zero elements of \f$ L \f$ and \f$ U \f$ (including the diagonal).
+*/
+inline size_t BasisFactorization::factorNonZeros() const
+{
+   return Li_.size() + Ui_.size() + Ud_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the eta file.
+//
+// \return The number of non-zero elements of all eta vectors.
+*/
+inline size_t BasisFactorization::etaNonZeros() const
+{
+   return etaI_.size() + etaR_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of column exchanges since the last factorization.
+//
+// \return The number of eta matrices.
+*/
+inline size_t BasisFactorization::getNumUpdates() const
+{
+   return etaR_.size();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,438 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BatchSolver.h
+//  \brief Header file for the batch solver for independent problems
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BATCHSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_BATCHSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parallel solver for a batch of independent problems.
+// \ingroup solvers
+//
+// The BatchSolver class template solves a collection of independent problems (for instance the
+// contact problems of the independent islands of a simulation) in parallel by means of the
+// active thread backend. Each problem is solved sequentially by a single worker, different
+// problems are solved concurrently:
+
+   \code
+   std::vector<blaze::ContactLCP> islands;
+   std::vector<bool> converged;
+   // ... Setting up the islands
+
+   blaze::PGS pgs;
+   pgs.setMaxIterations( 100 );
+
+   blaze::BatchSolver<blaze::PGS> batch( pgs );
+   const size_t solved( batch.solve( islands, converged ) );
+   \endcode
+
+// Each worker owns a copy of the given solver, which is reused for all problems assigned to the
+// worker and for all subsequent batches. Therefore the helper data of the solvers (as for instance
+// the inverse diagonal elements of the PGS solver) is only reallocated in case a problem exceeds
+// the size of all previous problems of the same worker.
+//
+// The problems are distributed to the workers dynamically: The problems are sorted by their
+// estimated cost (the number of unknowns and non-zero elements of the system matrix) and each
+// worker repeatedly fetches the next most expensive unsolved problem via a shared atomic cursor
+// as soon as it has finished its previous problem. Therefore the workers stay busy even if the
+// estimated costs are poor predictions of the actual solution times (as for instance due to
+// very different numbers of iterations). Note that the assignment of problems to workers
+// depends on the actual thread scheduling. The solution of a problem is only deterministic in
+// case it does not depend on data cached by the solver for previous problems.
+//
+// The solver type \a ST has to provide a \c solve() function for the problem type and the
+// \c getLastIterations() function. The problem type has to provide the \c size() function and
+// the system matrix \c A_.
+*/
+template< typename ST >  // Type of the solver
+class BatchSolver
+{
+ private:
+   //**Worker kernel*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Sequential solution of dynamically fetched problems by a range of workers.
+   //
+   // The workers of the given range are executed by the same thread and therefore share the
+   // solver of the first worker of the range. The problems are fetched in descending order of
+   // their estimated cost until all problems have been handed out.
+   */
+   template< typename CP >  // Type of the problems
+   struct WorkerKernel
+   {
+      inline void operator()( size_t first, size_t /*last*/ ) const {
+         ST& solver( solvers_[first] );
+         size_t k( next_->fetch_add( 1UL, boost::memory_order_relaxed ) );
+         while( k < size_ ) {
+            const size_t i( order_[k] );
+            converged_[i]  = solver.solve( problems_[i] );
+            iterations_[i] = solver.getLastIterations();
+            k = next_->fetch_add( 1UL, boost::memory_order_relaxed );
+         }
+      }
+
+      ST*                    solvers_;     //!< The solvers of the workers.
+      CP*                    problems_;    //!< The problems to be solved.
+      const size_t*          order_;       //!< The problems sorted by descending cost.
+      size_t                 size_;        //!< The total number of problems.
+      boost::atomic<size_t>* next_;        //!< The position of the next problem to be solved.
+      unsigned char*         converged_;   //!< The convergence flags of the problems.
+      size_t*                iterations_;  //!< The iterations spent for the problems.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Cost comparison*****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Ordering of problems by descending cost and ascending index.
+   */
+   struct CostGreater
+   {
+      inline bool operator()( size_t i, size_t j ) const {
+         return ( costs_[i] != costs_[j] )?( costs_[i] > costs_[j] ):( i < j );
+      }
+
+      const size_t* costs_;  //!< The estimated costs of the problems.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BatchSolver();
+   explicit inline BatchSolver( const ST& solver );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline const ST&                  getSolver    () const;
+   inline size_t                     getNumWorkers() const;
+   inline const std::vector<size_t>& getIterations() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setSolver( const ST& solver );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename CP > size_t solve( std::vector<CP>& problems, std::vector<bool>& converged );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename CP > void schedule( const std::vector<CP>& problems );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ST solver_;                          //!< The prototype solver for all workers.
+   std::vector<ST> solvers_;            //!< The solvers of the workers.
+   size_t workers_;                     //!< The number of workers of the last batch.
+   std::vector<size_t> costs_;          //!< The estimated costs of the problems.
+   std::vector<size_t> order_;          //!< The problems sorted by descending cost.
+   std::vector<unsigned char> status_;  //!< The convergence flags of the problems.
+   std::vector<size_t> iterations_;     //!< The iterations spent for the problems.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the BatchSolver class.
+*/
+template< typename ST >  // Type of the solver
+inline BatchSolver<ST>::BatchSolver()
+   : solver_    ()     // The prototype solver for all workers
+   , solvers_   ()     // The solvers of the workers
+   , workers_   ( 0 )  // The number of workers of the last batch
+   , costs_     ()     // The estimated costs of the problems
+   , order_     ()     // The problems sorted by descending cost
+   , status_    ()     // The convergence flags of the problems
+   , iterations_()     // The iterations spent for the problems
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the BatchSolver class.
+//
+// \param solver The prototype solver for all workers.
+//
+// All workers use a copy of the given solver and therefore inherit all of its settings.
+*/
+template< typename ST >  // Type of the solver
+inline BatchSolver<ST>::BatchSolver( const ST& solver )
+   : solver_    ( solver )  // The prototype solver for all workers
+   , solvers_   ()          // The solvers of the workers
+   , workers_   ( 0 )       // The number of workers of the last batch
+   , costs_     ()          // The estimated costs of the problems
+   , order_     ()          // The problems sorted by descending cost
+   , status_    ()          // The convergence flags of the problems
+   , iterations_()          // The iterations spent for the problems
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the prototype solver for all workers.
+//
+// \return The prototype solver.
+*/
+template< typename ST >  // Type of the solver
+inline const ST& BatchSolver<ST>::getSolver() const
+{
+   return solver_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of workers used for the last batch.
+//
+// \return The number of workers of the last batch.
+*/
+template< typename ST >  // Type of the solver
+inline size_t BatchSolver<ST>::getNumWorkers() const
+{
+   return workers_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of iterations spent for each problem of the last batch.
+//
+// \return The iterations spent for the problems of the last batch.
+*/
+template< typename ST >  // Type of the solver
+inline const std::vector<size_t>& BatchSolver<ST>::getIterations() const
+{
+   return iterations_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the prototype solver for all workers.
+//
+// \param solver The new prototype solver.
+// \return void
+//
+// The solvers of all workers are discarded and recreated from the new prototype solver for the
+// next batch.
+*/
+template< typename ST >  // Type of the solver
+inline void BatchSolver<ST>::setSolver( const ST& solver )
+{
+   solver_ = solver;
+   solvers_.clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given batch of independent problems.
+//
+// \param problems The problems to be solved.
+// \param converged The convergence flags of the problems.
+// \return The number of sufficiently accurately solved problems.
+//
+// This function solves all given problems and stores for each problem whether the solution is
+// sufficiently accurate in the given vector of convergence flags, which is resized accordingly.
+// In case the function is called from within a serial section or an active parallel section,
+// all problems are solved by a single worker on the calling thread.
+*/
+template< typename ST >  // Type of the solver
+template< typename CP >  // Type of the problems
+size_t BatchSolver<ST>::solve( std::vector<CP>& problems, std::vector<bool>& converged )
+{
+   const size_t P( problems.size() );
+
+   workers_ = ( P < 2UL || isSerialSectionActive() || isParallelSectionActive() )
+              ?( 1UL ):( min( getNumThreads(), P ) );
+
+   if( solvers_.size() < workers_ )
+      solvers_.resize( workers_, solver_ );
+
+   schedule( problems );
+
+   status_.assign( P, 0U );
+   iterations_.assign( P, 0UL );
+
+   if( P > 0UL )
+   {
+      boost::atomic<size_t> next( 0UL );
+
+      WorkerKernel<CP> kernel;
+      kernel.solvers_    = &solvers_[0];
+      kernel.problems_   = &problems[0];
+      kernel.order_      = &order_[0];
+      kernel.size_       = P;
+      kernel.next_       = &next;
+      kernel.converged_  = &status_[0];
+      kernel.iterations_ = &iterations_[0];
+
+      smpFor( 0UL, workers_, kernel );
+   }
+
+   size_t solved( 0UL );
+   converged.resize( P );
+
+   for( size_t i=0UL; i<P; ++i ) {
+      converged[i] = ( status_[i] != 0U );
+      if( converged[i] ) ++solved;
+   }
+
+   return solved;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Determines the processing order of the given problems.
+//
+// \param problems The problems to be solved.
+// \return void
+//
+// The problems are sorted by descending estimated cost, which is given by the number of unknowns
+// and the number of non-zero elements of the system matrix. Problems of equal cost are ordered
+// by ascending index. Processing the most expensive problems first reduces the idle time of the
+// workers at the end of the batch.
+*/
+template< typename ST >  // Type of the solver
+template< typename CP >  // Type of the problems
+void BatchSolver<ST>::schedule( const std::vector<CP>& problems )
+{
+   const size_t P( problems.size() );
+
+   costs_.resize( P );
+   for( size_t i=0UL; i<P; ++i ) {
+      costs_[i] = problems[i].size() + problems[i].A_.nonZeros();
+   }
+
+   order_.resize( P );
+   for( size_t i=0UL; i<P; ++i ) {
+      order_[i] = i;
+   }
+
+   if( P > 0UL ) {
+      CostGreater greater;
+      greater.costs_ = &costs_[0];
+      std::sort( order_.begin(), order_.end(), greater );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
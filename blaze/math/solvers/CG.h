@@ -40,10 +40,28 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <stdexcept>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
 #include <blaze/math/problems/LSE.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
 #include <blaze/math/solvers/Solver.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/ColorMacros.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -55,15 +73,162 @@ namespace blaze {
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief A conjugate gradient solver.
+/*!\brief A preconditioned conjugate gradient solver.
 // \ingroup lse_solvers
 //
-// TODO: description
-// TODO: Problem formulation: \f$ A \cdot x + b = 0 \f$ !!
+// The CG class solves linear systems of equations of the form \f$ A \cdot x + b = 0 \f$ with a
+// symmetric positive definite system matrix \f$ A \f$ by means of the (preconditioned) conjugate
+// gradient method. The system matrix can be given either as any Blaze matrix type or as a user
+// defined linear operator. A linear operator is any type that provides the following interface:
+
+   \code
+   class LinearOperator
+   {
+    public:
+      size_t rows   () const;                                // Number of rows of the operator
+      size_t columns() const;                                // Number of columns of the operator
+      void   apply  ( const VecN& x, VecN& y ) const;       // Computes y = A * x
+   };
+   \endcode
+
+// Preconditioners provide the function \c apply( const VecN& r, VecN& z ), which computes the
+// preconditioned vector \f$ z = M^{-1} r \f$ (see for instance the JacobiPreconditioner, the
+// SSORPreconditioner and the IC0Preconditioner classes). In case no preconditioner is given,
+// the IdentityPreconditioner is used and the preconditioning step is skipped:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::CG cg;
+   cg.solve( A, b, x );                                  // Unpreconditioned CG
+   cg.solve( A, b, x, blaze::IC0Preconditioner( A ) );  // IC(0) preconditioned CG
+   \endcode
+
+// Per iteration, the solver performs a single matrix-vector multiplication, which is fused with
+// the computation of \f$ d^T A d \f$ for row-major compressed matrices, and a single pass over
+// the vectors that updates both the solution and the residual and computes the maximum norm
+// and the squared norm of the new residual. Both passes are executed in parallel in case the
+// size of the system exceeds the SMP threshold for vector operations. In case deterministic
+// reductions are enabled (see \c SMP_DETERMINISTIC_REDUCTION), the vectors are split into blocks
+// of fixed size and the per-block results are combined via a fixed reduction tree, i.e. the
+// iterates are independent of the number of threads. By default the solver does not check the
+// symmetry of the system matrix, since this requires an additional pass over the matrix in every
+// call. The check can be enabled via the setSymmetryCheck() function.
 */
 class CG : public Solver
 {
-public:
+ private:
+   //**Update kernel*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Fused update of the solution and the residual (\f$ x += \alpha d, r += \alpha h \f$).
+   //
+   // Each block of the vectors is updated in a single pass, which additionally computes the
+   // maximum norm and the squared norm of the new residual within the block.
+   */
+   struct UpdateKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, n_ ) );
+            real norm( 0 );
+            Accumulator< real, ReductionAccumulation<real>::value > dot;
+            for( size_t i=begin; i<end; ++i ) {
+               x_[i] += alpha_ * d_[i];
+               const real tmp( r_[i] + alpha_ * h_[i] );
+               r_[i] = tmp;
+               norm  = max( norm, std::fabs( tmp ) );
+               dot  += tmp * tmp;
+            }
+            norms_[b] = norm;
+            dots_ [b] = dot.result();
+         }
+      }
+
+      size_t      n_;          //!< The size of the vectors.
+      size_t      blockSize_;  //!< The size of a single block.
+      real        alpha_;      //!< The step size.
+      real*       x_;          //!< The vector of unknowns.
+      real*       r_;          //!< The residual.
+      const real* d_;          //!< The search direction.
+      const real* h_;          //!< The product of the system matrix and the search direction.
+      real*       norms_;      //!< The maximum norms of the residual per block.
+      real*       dots_;       //!< The squared norms of the residual per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Residual kernel*****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computation of the maximum norm of the residual and of \f$ r^T z \f$ per block.
+   */
+   struct ResidualKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, n_ ) );
+            real norm( 0 );
+            Accumulator< real, ReductionAccumulation<real>::value > dot;
+            for( size_t i=begin; i<end; ++i ) {
+               norm = max( norm, std::fabs( r_[i] ) );
+               dot += r_[i] * z_[i];
+            }
+            norms_[b] = norm;
+            dots_ [b] = dot.result();
+         }
+      }
+
+      size_t      n_;          //!< The size of the vectors.
+      size_t      blockSize_;  //!< The size of a single block.
+      const real* r_;          //!< The residual.
+      const real* z_;          //!< The preconditioned residual.
+      real*       norms_;      //!< The maximum norms of the residual per block.
+      real*       dots_;       //!< The dot products per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication kernel***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Fused matrix-vector multiplication for row-major compressed matrices.
+   //
+   // The kernel computes \f$ h = A d \f$ row by row and accumulates \f$ d^T h \f$ per block in
+   // the same pass.
+   */
+   template< typename MT >  // Type of the system matrix
+   struct MultKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         typedef typename MT::ConstIterator  ConstIterator;
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, n_ ) );
+            Accumulator< real, ReductionAccumulation<real>::value > dot;
+            for( size_t i=begin; i<end; ++i ) {
+               real tmp( 0 );
+               for( ConstIterator element=A_->begin(i); element!=A_->end(i); ++element )
+                  tmp += element->value() * d_[element->index()];
+               h_[i] = tmp;
+               dot  += d_[i] * tmp;
+            }
+            dots_[b] = dot.result();
+         }
+      }
+
+      size_t      n_;          //!< The size of the vectors.
+      size_t      blockSize_;  //!< The size of a single block.
+      const MT*   A_;          //!< The system matrix.
+      const real* d_;          //!< The search direction.
+      real*       h_;          //!< The product of the system matrix and the search direction.
+      real*       dots_;       //!< The dot products per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
@@ -71,21 +236,74 @@ public:
    //@}
    //**********************************************************************************************
 
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool getSymmetryCheck() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setSymmetryCheck( bool check );
+   //@}
+   //**********************************************************************************************
+
    //**Solver functions****************************************************************************
    /*!\name Solver functions */
    //@{
    bool solve( LSE& lse );
    bool solve( const CMatMxN& A, const VecN& b, VecN& x );
+
+   template< typename MT >
+   bool solve( const MT& A, const VecN& b, VecN& x );
+
+   template< typename MT, typename PT >
+   bool solve( const MT& A, const VecN& b, VecN& x, const PT& pc );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   inline real multiply( const CompressedMatrix<Type,false>& A, size_t blocks, size_t blockSize );
+
+   template< typename MT >
+   inline typename EnableIf< IsMatrix<MT>, real >::Type
+      multiply( const MT& A, size_t blocks, size_t blockSize );
+
+   template< typename MT >
+   inline typename DisableIf< IsMatrix<MT>, real >::Type
+      multiply( const MT& A, size_t blocks, size_t blockSize );
+
+   template< typename MT >
+   inline typename EnableIf< IsMatrix<MT>, bool >::Type isSymmetricSystem( const MT& A ) const;
+
+   template< typename MT >
+   inline typename DisableIf< IsMatrix<MT>, bool >::Type isSymmetricSystem( const MT& A ) const;
+
+   template< typename OP >
+   inline void forEachBlock( size_t blocks, const OP& op ) const;
+
+   inline real maxNorm( size_t blocks ) const;
+   inline real dot    ( size_t blocks ) const;
    //@}
    //**********************************************************************************************
 
-private:
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   VecN r_;  //!< TODO
-   VecN d_;  //!< TODO
-   VecN h_;  //!< TODO
+   VecN r_;               //!< The residual \f$ r = A x + b \f$.
+   VecN d_;               //!< The search direction.
+   VecN h_;               //!< The product of the system matrix and the search direction.
+   VecN z_;               //!< The preconditioned residual.
+   VecN norms_;           //!< Auxiliary vector for the per-block maximum norms of the residual.
+   VecN dots_;            //!< Auxiliary vector for the per-block dot products.
+   bool parallel_;        //!< Flag for the parallel execution of the vector operations.
+   bool checkSymmetry_;   //!< Flag for the symmetry check of the system matrix.
    //@}
    //**********************************************************************************************
 };
@@ -96,24 +314,406 @@ private:
 
 //=================================================================================================
 //
-//  SOLVER FUNCTIONS
+//  GET FUNCTIONS
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Returns whether the symmetry of the system matrix is checked.
+//
+// \return \a true if the symmetry of the system matrix is checked, \a false if not.
+*/
+inline bool CG::getSymmetryCheck() const
+{
+   return checkSymmetry_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
 //
-// \param lse TODO
-// \return TODO
+//  SET FUNCTIONS
 //
-// TODO: description
-// TODO: Problem formulation: \f$ A \cdot x + b = 0 \f$ !!
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Enables or disables the symmetry check of the system matrix.
+//
+// \param check \a true to check the symmetry of the system matrix in every call, \a false if not.
+// \return void
+//
+// In case the check is enabled, the solve() functions throw a \a std::invalid_argument exception
+// for non-symmetric system matrices. Note that the symmetry of user defined linear operators is
+// never checked.
+*/
+inline void CG::setSymmetryCheck( bool check )
+{
+   checkSymmetry_ = check;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param lse The linear system of equations to be solved.
+// \return \a true if the solution is sufficiently accurate, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument System matrix is not symmetric.
+// \exception std::invalid_argument Invalid right-hand side vector size.
 */
 inline bool CG::solve( LSE& lse ) {
    return solve( lse.A_, lse.b_, lse.x_ );
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Solves the linear system of equations \f$ A \cdot x + b = 0 \f$.
+//
+// \param A The system matrix or linear operator.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns.
+// \return \a true if the solution is sufficiently accurate, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument System matrix is not symmetric.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+template< typename MT >  // Type of the system matrix
+bool CG::solve( const MT& A, const VecN& b, VecN& x )
+{
+   return solve( A, b, x, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system of equations \f$ A \cdot x + b = 0 \f$ with preconditioning.
+//
+// \param A The system matrix or linear operator.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns.
+// \param pc The preconditioner.
+// \return \a true if the solution is sufficiently accurate, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument System matrix is not symmetric.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The vector of unknowns is resized to the size of the system and the iteration starts from
+// \f$ x = 0 \f$. In case warm starts are enabled (see Solver::setWarmStart()) and the given
+// vector of unknowns already matches the size of the system, the iteration instead starts from
+// the given vector. The iteration stops as soon as the maximum norm of the residual drops below
+// the threshold of the solver or the maximum number of iterations is reached. In case statistics
+// are enabled, the matrix-vector multiplication and the preconditioning are accounted as residual
+// time, the updates of the solution and the search direction as update time.
+*/
+template< typename MT    // Type of the system matrix
+        , typename PT >  // Type of the preconditioner
+bool CG::solve( const MT& A, const VecN& b, VecN& x, const PT& pc )
+{
+   const bool identity( IsSame<PT,IdentityPreconditioner>::value );
+   const size_t n( b.size() );
+   bool converged( false );
+   real alpha, beta, delta;
+
+   resetStatistics();
+   double start( timestamp() );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "System matrix is not square" );
+
+   if( checkSymmetry_ && !isSymmetricSystem( A ) )
+      throw std::invalid_argument( "System matrix is not symmetric" );
+
+   if( A.rows() != n )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   // Determining the number of blocks for the vector operations
+   parallel_ = !( n < SMP_DVECDVECADD_THRESHOLD || isSerialSectionActive() || isParallelSectionActive() );
+
+   const size_t blocks( ( SMP_DETERMINISTIC_REDUCTION )?( reductionBlocks( n ) )
+                                                       :( ( parallel_ )?( min( getNumThreads(), n ) ):( 1UL ) ) );
+   const size_t blockSize( ( SMP_DETERMINISTIC_REDUCTION )?( SMP_REDUCTION_BLOCK_SIZE )
+                                                          :( ( n + blocks - 1UL ) / blocks ) );
+
+   // Allocating helper data
+   r_.resize( n, false );
+   d_.resize( n, false );
+   h_.resize( n, false );
+   if( !identity ) z_.resize( n, false );
+   norms_.resize( blocks, false );
+   dots_.resize( blocks, false );
+
+   // Preparing the vector of unknowns
+   const bool warm( warmStart_ && x.size() == n );
+
+   if( !warm ) {
+      x.resize( n, false );
+      x.reset();
+   }
+
+   const VecN& z( identity ? r_ : z_ );
+
+   UpdateKernel update;
+   update.n_ = n;
+   update.blockSize_ = blockSize;
+   update.x_ = x.data();
+   update.r_ = r_.data();
+   update.d_ = d_.data();
+   update.h_ = h_.data();
+   update.norms_ = norms_.data();
+   update.dots_  = dots_.data();
+
+   ResidualKernel residual;
+   residual.n_ = n;
+   residual.blockSize_ = blockSize;
+   residual.r_ = r_.data();
+   residual.z_ = z.data();
+   residual.norms_ = norms_.data();
+   residual.dots_  = dots_.data();
+
+   // Computing the initial residual (for x = 0, the residual is given by b)
+   if( warm ) {
+      d_ = x;
+      multiply( A, blocks, blockSize );
+      r_ = h_ + b;
+   }
+   else {
+      r_ = b;
+   }
+
+   if( !identity )
+      pc.apply( r_, z_ );
+
+   // Initial convergence test
+   forEachBlock( blocks, residual );
+   lastPrecision_ = maxNorm( blocks );
+   delta = dot( blocks );
+
+   if( lastPrecision_ < threshold_ )
+      converged = true;
+
+   d_ = -z;
+
+   recordSetup( start );
+
+   // Performing the CG iterations
+   size_t it( 0 );
+
+   for( ; !converged && it<maxIterations_; ++it )
+   {
+      const double begin( timestamp() );
+
+      start = begin;
+      alpha = delta / multiply( A, blocks, blockSize );
+      recordResidual( start );
+
+      start = timestamp();
+      update.alpha_ = alpha;
+      forEachBlock( blocks, update );
+      lastPrecision_ = maxNorm( blocks );
+      recordUpdate( start );
+
+      if( lastPrecision_ < threshold_ ) {
+         converged = true;
+         recordIteration( begin, lastPrecision_ );
+         ++it;
+         break;
+      }
+
+      start = timestamp();
+      if( !identity ) {
+         pc.apply( r_, z_ );
+         forEachBlock( blocks, residual );
+      }
+      beta = dot( blocks );
+      recordResidual( start );
+
+      start = timestamp();
+      d_ = ( beta / delta ) * d_ - z;
+      recordUpdate( start );
+
+      delta = beta;
+
+      recordIteration( begin, lastPrecision_ );
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " CG iterations.";
+      else
+         log << BLAZE_YELLOW << "      WARNING: Did not solve the linear system within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes \f$ h = A d \f$ and \f$ d^T h \f$ for a row-major compressed system matrix.
+//
+// \param A The system matrix.
+// \param blocks The number of blocks of the vector operations.
+// \param blockSize The size of a single block.
+// \return The scalar product \f$ d^T h \f$.
+*/
+template< typename Type >  // Data type of the system matrix
+inline real CG::multiply( const CompressedMatrix<Type,false>& A, size_t blocks, size_t blockSize )
+{
+   MultKernel< CompressedMatrix<Type,false> > kernel;
+   kernel.n_ = A.rows();
+   kernel.blockSize_ = blockSize;
+   kernel.A_ = &A;
+   kernel.d_ = d_.data();
+   kernel.h_ = h_.data();
+   kernel.dots_ = dots_.data();
+
+   forEachBlock( blocks, kernel );
+
+   return dot( blocks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes \f$ h = A d \f$ and \f$ d^T h \f$ for a general system matrix.
+//
+// \param A The system matrix.
+// \return The scalar product \f$ d^T h \f$.
+*/
+template< typename MT >  // Type of the system matrix
+inline typename EnableIf< IsMatrix<MT>, real >::Type
+   CG::multiply( const MT& A, size_t /*blocks*/, size_t /*blockSize*/ )
+{
+   h_ = A * d_;
+   return trans( d_ ) * h_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes \f$ h = A d \f$ and \f$ d^T h \f$ for a user defined linear operator.
+//
+// \param A The linear operator.
+// \return The scalar product \f$ d^T h \f$.
+*/
+template< typename MT >  // Type of the linear operator
+inline typename DisableIf< IsMatrix<MT>, real >::Type
+   CG::multiply( const MT& A, size_t /*blocks*/, size_t /*blockSize*/ )
+{
+   A.apply( d_, h_ );
+   return trans( d_ ) * h_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the symmetry of the given system matrix.
+//
+// \param A The system matrix.
+// \return \a true if the system matrix is symmetric, \a false if not.
+*/
+template< typename MT >  // Type of the system matrix
+inline typename EnableIf< IsMatrix<MT>, bool >::Type CG::isSymmetricSystem( const MT& A ) const
+{
+   return isSymmetric( A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the symmetry of the given linear operator.
+//
+// \param A The linear operator.
+// \return Always \a true since the symmetry of linear operators cannot be checked.
+*/
+template< typename MT >  // Type of the linear operator
+inline typename DisableIf< IsMatrix<MT>, bool >::Type CG::isSymmetricSystem( const MT& /*A*/ ) const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given block operation for all blocks of the vector operations.
+//
+// \param blocks The number of blocks of the vector operations.
+// \param op The block operation.
+// \return void
+//
+// The blocks are processed in parallel in case the size of the system exceeds the SMP threshold
+// for vector operations and sequentially otherwise.
+*/
+template< typename OP >  // Type of the block operation
+inline void CG::forEachBlock( size_t blocks, const OP& op ) const
+{
+   if( parallel_ )
+      smpFor( 0UL, blocks, op );
+   else
+      op( 0UL, blocks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduction of the per-block maximum norms.
+//
+// \param blocks The number of blocks of the vector operations.
+// \return The maximum norm of the residual.
+*/
+inline real CG::maxNorm( size_t blocks ) const
+{
+   real norm( 0 );
+   for( size_t b=0UL; b<blocks; ++b )
+      norm = max( norm, norms_[b] );
+   return norm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduction of the per-block dot products.
+//
+// \param blocks The number of blocks of the vector operations.
+// \return The dot product.
+//
+// In case deterministic reductions are enabled, the per-block dot products are combined via a
+// fixed reduction tree.
+*/
+inline real CG::dot( size_t blocks ) const
+{
+   if( SMP_DETERMINISTIC_REDUCTION )
+      return treeReduction( dots_.data(), blocks );
+
+   real sum( 0 );
+   for( size_t b=0UL; b<blocks; ++b )
+      sum += dots_[b];
+   return sum;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
@@ -47,7 +49,14 @@
 #include <blaze/math/problems/ContactLCP.h>
 #include <blaze/math/problems/LCP.h>
 #include <blaze/math/shims/IsNaN.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/solvers/Solver.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/logging/DebugSection.h>
@@ -66,12 +75,210 @@ namespace blaze {
 /*!\brief Implementation of the conjugate projected gradient algorithm.
 // \ingroup complementarity_solvers
 //
-// TODO: description of the CPG solver
-// TODO: capabilities of the CPG solver (which LCP problems, etc)
-// TODO: known issues of the CPG solver
+// The CPG class solves LCPs, box LCPs and contact LCPs with symmetric positive semi-definite
+// system matrix by means of conjugate gradient iterations, which are projected onto the bounds
+// of the unknowns (see the \c lbound() and \c ubound() functions of the problem classes).
+//
+// Per iteration, the solver performs a single sparse matrix-vector multiplication \f$ q = A p \f$
+// for the current descent direction \f$ p \f$. The product is used both for the line search and
+// for the incremental update of the negative residual \f$ r = -(A x + b) \f$. Unknowns that are
+// clamped to their bounds deviate from the linear update, which is corrected by the rows of the
+// (symmetric) system matrix of the clamped unknowns only. In order to avoid the accumulation of
+// rounding errors, the residual is recomputed from scratch periodically and before convergence
+// is accepted. The descent step, the bound clamping and the active set detection as well as the
+// projection of the gradient and the computation of the convergence criterion are each performed
+// in a single fused pass over the unknowns, which is executed in parallel for large problems.
+// For contact LCPs, whose friction bounds depend on the normal unknown of the same contact, the
+// unknowns of a contact are always processed by the same thread. In case deterministic
+// reductions are enabled (see \c SMP_DETERMINISTIC_REDUCTION), the unknowns are split into
+// blocks of fixed size and the per-block results are combined via a fixed reduction tree, i.e.
+// the iterates are independent of the number of threads.
 */
 class CPG : public Solver
 {
+ private:
+   //**Projection kernel***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Projection of the gradient and computation of the residual.
+   */
+   template< typename CP >  // Type of the complementarity problem
+   struct ProjectionKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         const VecN& x( cp_->x_ );
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, n_ ) );
+            real rmax( 0 );
+            Accumulator< real, ReductionAccumulation<real>::value > nom;
+            for( size_t i=begin; i<end; ++i ) {
+               real tmp( r_[i] );
+               if( activity_[i] == -1 ) {
+                  tmp   = max( tmp,   real(0) );
+                  p_[i] = max( p_[i], real(0) );
+               }
+               else if( activity_[i] == 1 ) {
+                  tmp   = min( tmp,   real(0) );
+                  p_[i] = min( p_[i], real(0) );
+               }
+               nom += w_[i] * tmp;
+               z_[i] = tmp;
+               rmax = max( rmax, std::fabs( max( x[i] - cp_->ubound( i ),
+                                                 min( x[i] - cp_->lbound( i ), -r_[i] ) ) ) );
+            }
+            noms_[b] = nom.result();
+            rmax_[b] = rmax;
+         }
+      }
+
+      const CP*  cp_;         //!< The complementarity problem.
+      const real* r_;         //!< The negative residual.
+      const int* activity_;   //!< The activity of the unknowns.
+      const real* w_;         //!< The previous projected gradient.
+      real*      z_;          //!< The new projected gradient.
+      real*      p_;          //!< The descent direction.
+      real*      noms_;       //!< The per-block nominators of the conjugation coefficient.
+      real*      rmax_;       //!< The per-block maximum norms of the residual.
+      size_t     n_;          //!< The number of unknowns.
+      size_t     blockSize_;  //!< The number of unknowns per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Direction kernel****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Update of the descent direction \f$ p = w + \beta p \f$ and computation of \f$ r^T p \f$.
+   */
+   struct DirectionKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, n_ ) );
+            Accumulator< real, ReductionAccumulation<real>::value > nom;
+            for( size_t i=begin; i<end; ++i ) {
+               p_[i] = w_[i] + beta_ * p_[i];
+               nom += r_[i] * p_[i];
+            }
+            noms_[b] = nom.result();
+         }
+      }
+
+      const real* w_;         //!< The projected gradient.
+      const real* r_;         //!< The negative residual.
+      real*       p_;         //!< The descent direction.
+      real*       noms_;      //!< The per-block nominators of the step length.
+      real        beta_;      //!< The conjugation coefficient.
+      size_t      n_;         //!< The number of unknowns.
+      size_t      blockSize_; //!< The number of unknowns per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication kernel***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computation of \f$ q = A p \f$ and \f$ p^T q \f$, or of \f$ r = -(A x + b) \f$.
+   */
+   struct MultKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, n_ ) );
+            Accumulator< real, ReductionAccumulation<real>::value > dot;
+            for( size_t i=begin; i<end; ++i ) {
+               real tmp( 0 );
+               for( CMatMxN::ConstIterator element=A_->begin(i); element!=A_->end(i); ++element )
+                  tmp += element->value() * v_[element->index()];
+               if( b_ ) {
+                  y_[i] = -tmp - b_[i];
+               }
+               else {
+                  y_[i] = tmp;
+                  dot += v_[i] * tmp;
+               }
+            }
+            dots_[b] = dot.result();
+         }
+      }
+
+      const CMatMxN* A_;          //!< The system matrix.
+      const real*    v_;          //!< The multiplied vector.
+      const real*    b_;          //!< The right-hand side vector (only for residual computations).
+      real*          y_;          //!< The result vector.
+      real*          dots_;       //!< The per-block scalar products \f$ v^T y \f$.
+      size_t         n_;          //!< The number of unknowns.
+      size_t         blockSize_;  //!< The number of unknowns per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Descent kernel******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Descent along the search direction, bound clamping and active set detection.
+   */
+   template< typename CP >  // Type of the complementarity problem
+   struct DescentKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         VecN& x( cp_->x_ );
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, n_ ) );
+            size_t count( 0 );
+            for( size_t i=begin; i<end; ++i )
+            {
+               const real step( x[i] + alpha_ * p_[i] );
+
+               if( activity_[i] != 0 && p_[i] == real(0) ) {
+                  // In case the bounds are depending on the unknowns this ensures that
+                  // the unknowns stay at the bounds
+                  if( activity_[i] == -1 )
+                     x[i] = cp_->lbound( i );
+                  else
+                     x[i] = cp_->ubound( i );
+               }
+               else {
+                  x[i] = step;
+
+                  if( x[i] <= cp_->lbound( i ) ) {
+                     x[i] = cp_->lbound( i );
+                     activity_[i] = -1;
+                  }
+                  else if( x[i] >= cp_->ubound( i ) ) {
+                     x[i] = cp_->ubound( i );
+                     activity_[i] = 1;
+                  }
+                  else {
+                     activity_[i] = 0;
+                  }
+               }
+
+               // Linear update of the residual and recording of the deviation from the linear step
+               r_[i] -= alpha_ * q_[i];
+               delta_[i] = x[i] - step;
+               if( delta_[i] != real(0) )
+                  clamped_[begin+count++] = i;
+            }
+            counts_[b] = count;
+         }
+      }
+
+      CP*           cp_;         //!< The complementarity problem.
+      const real*   p_;          //!< The descent direction.
+      const real*   q_;          //!< The product of the system matrix and the descent direction.
+      real*         r_;          //!< The negative residual.
+      real*         delta_;      //!< The deviations from the linear step.
+      int*          activity_;   //!< The activity of the unknowns.
+      size_t*       clamped_;    //!< The indices of the clamped unknowns per block.
+      size_t*       counts_;     //!< The number of clamped unknowns per block.
+      real          alpha_;      //!< The step length.
+      size_t        n_;          //!< The number of unknowns.
+      size_t        blockSize_;  //!< The number of unknowns per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
@@ -88,13 +295,37 @@ class CPG : public Solver
    //**********************************************************************************************
 
  private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename CP > inline real project ( const CP& cp, real& betaNom );
+   template< typename CP > static inline size_t nodeSize();
+
+   template< typename OP > inline void forEachBlock( const OP& op ) const;
+
+   inline void residual( const CMatMxN& A, const VecN& b, const VecN& x );
+   inline void correct ( const CMatMxN& A );
+   inline real sum     ( const VecN& v ) const;
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   VecN                r_;         //!< TODO
-   VecN                w_;         //!< TODO
-   VecN                p_;         //!< TODO
-   DynamicVector<int>  activity_;  //!< TODO
+   VecN                r_;         //!< The negative residual \f$ -(A x + b) \f$.
+   VecN                w_;         //!< The projected gradient.
+   VecN                p_;         //!< The descent direction.
+   VecN                q_;         //!< The product of the system matrix and the descent direction.
+   VecN                z_;         //!< The projected gradient of the current iteration.
+   VecN                delta_;     //!< The deviations of the unknowns from the linear step.
+   DynamicVector<int>  activity_;  //!< The activity of the unknowns (-1: lower bound, 1: upper bound).
+   VecN                noms_;      //!< The per-block partial sums.
+   VecN                rmax_;      //!< The per-block maximum norms of the residual.
+   std::vector<size_t> clamped_;   //!< The indices of the clamped unknowns per block.
+   std::vector<size_t> counts_;    //!< The number of clamped unknowns per block.
+   size_t              blocks_;    //!< The number of blocks of the vector operations.
+   size_t              blockSize_; //!< The number of unknowns per block.
+   bool                parallel_;  //!< Flag for the parallel execution of the vector operations.
    //@}
    //**********************************************************************************************
 };
@@ -110,45 +341,65 @@ class CPG : public Solver
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Solves the provided complementarity problem.
 //
-// \param cp TODO
-// \return void
+// \param cp The complementarity problem to solve.
+// \return \a true if the solution is sufficiently accurate, \a false if not.
 //
-// TODO
+// The current values of the unknowns are projected onto the bounds and used as initial guess.
+// The system matrix of the problem is required to be symmetric.
 */
 template< typename CP >  // Type of the complementarity problem
 bool CPG::solve( CP& cp )
 {
    const size_t n( cp.size() );
+   const size_t ns( nodeSize<CP>() );
    const CMatMxN& A( cp.A_ );
    const VecN&    b( cp.b_ );
 
    bool converged( false );
    VecN& x( cp.x_ );
-   size_t activeSetChanges( 0 );
    real alpha( 0 ), alpha_nom( 0 ), alpha_denom( 1 );
    real beta( 0 ),  beta_nom( 0 ),  beta_denom( 0 );
-   real tmp( 0 );
 
    BLAZE_INTERNAL_ASSERT( isSymmetric( A ), "The CPG solver requires that the system matrix is symmetric" );
 
+   resetStatistics();
+   double start( timestamp() );
+
+   // Determining the number of blocks for the vector operations (aligned to the contacts)
+   parallel_ = !( n < SMP_DVECDVECADD_THRESHOLD || isSerialSectionActive() || isParallelSectionActive() );
+
+   if( SMP_DETERMINISTIC_REDUCTION ) {
+      blockSize_ = ( SMP_REDUCTION_BLOCK_SIZE + ns - 1UL ) / ns * ns;
+      blocks_ = max( ( n + blockSize_ - 1UL ) / blockSize_, size_t( 1UL ) );
+   }
+   else {
+      blocks_ = ( parallel_ )?( min( getNumThreads(), ( n + ns - 1UL ) / ns ) ):( 1UL );
+      blockSize_ = ( ( n + blocks_ - 1UL ) / blocks_ + ns - 1UL ) / ns * ns;
+   }
+
    // Allocating helper data
    r_.resize( n, false );
    w_.resize( n, false );
    p_.resize( n, false );
+   q_.resize( n, false );
+   z_.resize( n, false );
+   delta_.resize( n, false );
    activity_.resize( n, false );
+   noms_.resize( blocks_, false );
+   rmax_.resize( blocks_, false );
+   clamped_.resize( n );
+   counts_.resize( blocks_ );
 
    // Determining activity and project initial solution to feasible region
    for( size_t i=0; i<n; ++i ) {
       if( x[i] <= cp.lbound( i ) ) {
          x[i] = cp.lbound( i );
-         ++activeSetChanges;
          activity_[i] = -1;
       }
       else if( x[i] >= cp.ubound( i ) ) {
          x[i] = cp.ubound( i );
-         ++activeSetChanges;
          activity_[i] = 1;
       }
       else {
@@ -157,38 +408,81 @@ bool CPG::solve( CP& cp )
    }
 
    // Computing the initial residual
-   lastPrecision_ = cp.residual();
-   if( lastPrecision_ < threshold_ )
-      converged = true;
+   residual( A, b, x );
 
    // Choosing the initial values such that the descent direction conjugation process is disabled
    p_ = real(0);
    w_ = real(0);
 
+   recordSetup( start );
+
+   DirectionKernel direction;
+   direction.w_ = w_.data();
+   direction.r_ = r_.data();
+   direction.p_ = p_.data();
+   direction.noms_ = noms_.data();
+   direction.n_ = n;
+   direction.blockSize_ = blockSize_;
+
+   MultKernel mult;
+   mult.A_ = &A;
+   mult.v_ = p_.data();
+   mult.b_ = NULL;
+   mult.y_ = q_.data();
+   mult.dots_ = noms_.data();
+   mult.n_ = n;
+   mult.blockSize_ = blockSize_;
+
+   DescentKernel<CP> descent;
+   descent.cp_ = &cp;
+   descent.p_ = p_.data();
+   descent.q_ = q_.data();
+   descent.r_ = r_.data();
+   descent.delta_ = delta_.data();
+   descent.activity_ = activity_.data();
+   descent.clamped_ = &clamped_[0];
+   descent.counts_ = &counts_[0];
+   descent.n_ = n;
+   descent.blockSize_ = blockSize_;
+
    size_t it( 0 );
-   for( ; !converged && it < maxIterations_; ++it )
+   size_t refresh( 0 );
+   double begin( 0.0 );
+
+   for( ;; ++it )
    {
-      // Computing the steepest descent direction
-      r_ = -( A*x + b );
+      // Projecting the gradient and the previous descent direction and computing the residual
+      start = timestamp();
+      lastPrecision_ = project( cp, beta_nom );
+
+      if( lastPrecision_ < threshold_ && refresh != it ) {
+         // Verifying the convergence based on the exact residual
+         residual( A, b, x );
+         refresh = it;
+         lastPrecision_ = project( cp, beta_nom );
+      }
+      recordResidual( start );
 
-      // Projecting the gradient and the previous descent direction
-      beta_nom = real(0);
-      beta_denom = alpha_denom;
+      if( it > 0UL )
+         recordIteration( begin, lastPrecision_ );
 
-      for( size_t i=0; i<n; ++i ) {
-         tmp = r_[i];
-         if( activity_[i] == -1 ) {
-            tmp   = max( tmp,   0 );
-            p_[i] = max( p_[i], 0 );
-         }
-         else if( activity_[i] == 1 ) {
-            tmp   = min( tmp,   0 );
-            p_[i] = min( p_[i], 0 );
-         }
-         beta_nom += w_[i] * tmp;
-         w_[i] = tmp;
+      if( lastPrecision_ < threshold_ ) {
+         converged = true;
+         break;
       }
 
+      if( it == maxIterations_ )
+         break;
+
+      begin = timestamp();
+      start = begin;
+
+      // Accepting the new projected gradient
+      w_.swap( z_ );
+      direction.w_ = w_.data();
+
+      beta_denom = alpha_denom;
+
       if( beta_denom == 0 ) {
          // No conjugation can be performed, fallback to steepest descent
          beta = 0;
@@ -200,11 +494,13 @@ bool CPG::solve( CP& cp )
       BLAZE_INTERNAL_ASSERT( !isnan( beta ), "Conjugation coefficient is nan" );
 
       // Choosing the next descent direction conjugated to all previous directions
-      p_ = w_ + beta * p_;
+      direction.beta_ = beta;
+      forEachBlock( direction );
+      alpha_nom = sum( noms_ );
 
       // Finding the minimum along the descent direction p
-      alpha_nom   = trans(r_) * p_;
-      alpha_denom = trans(p_) * A * p_;
+      forEachBlock( mult );
+      alpha_denom = sum( noms_ );
 
       if( alpha_denom == 0 )
          // In case p^T A p is zero, no reduction of the objective function can be obtained
@@ -214,9 +510,12 @@ bool CPG::solve( CP& cp )
          alpha = alpha_nom / alpha_denom;
 
       if( alpha == 0 ) {
+         recordUpdate( start );
+
          if( beta == 0 ) {
             // p is the steepest descent direction since beta = 0 but we still cannot
             // make any progress along p => minimum
+            recordIteration( begin, lastPrecision_ );
             break;
          }
          else {
@@ -225,45 +524,18 @@ bool CPG::solve( CP& cp )
          }
       }
 
-      // Descending along p and projecting
-      activeSetChanges = 0;
-
-      for( size_t i=0; i<n; ++i ) {
-         if( activity_[i] != 0 && p_[i] == real(0) ) {
-            // In case the bounds are depending on the unknowns this ensures that
-            // the unknowns stay at the bounds
-            if( activity_[i] == -1 )
-               x[i] = cp.lbound( i );
-            else
-               x[i] = cp.ubound( i );
-         }
-         else {
-            x[i] += alpha * p_[i];
+      // Descending along p, projecting and updating the residual
+      descent.alpha_ = alpha;
+      forEachBlock( descent );
+      correct( A );
 
-            if( x[i] <= cp.lbound( i ) ) {
-               x[i] = cp.lbound( i );
-               if( activity_[i] != -1 )
-                  ++activeSetChanges;
-               activity_[i] = -1;
-            }
-            else if( x[i] >= cp.ubound( i ) ) {
-               x[i] = cp.ubound( i );
-               if( activity_[i] != +1 )
-                  ++activeSetChanges;
-               activity_[i] = +1;
-            }
-            else {
-               if( activity_[i] != 0 )
-                  ++activeSetChanges;
-               activity_[i] = 0;
-            }
-         }
+      // Periodically recomputing the residual from scratch
+      if( ( it+1UL ) % 50UL == 0UL ) {
+         residual( A, b, x );
+         refresh = it+1UL;
       }
 
-      // Computing the residual (TODO we should improve this)
-      lastPrecision_ = cp.residual();
-      if( lastPrecision_ < threshold_ )
-         converged = true;
+      recordUpdate( start );
    }
 
    BLAZE_LOG_DEBUG_SECTION( log ) {
@@ -280,6 +552,161 @@ bool CPG::solve( CP& cp )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Projects the gradient and the descent direction and computes the residual.
+//
+// \param cp The complementarity problem to solve.
+// \param betaNom The nominator of the conjugation coefficient.
+// \return The maximum norm of the residual of the complementarity problem.
+//
+// The projected gradient is stored in \a z_, the previous projected gradient in \a w_ remains
+// unchanged. Therefore the function can be repeated after a recomputation of the residual.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real CPG::project( const CP& cp, real& betaNom )
+{
+   ProjectionKernel<CP> kernel;
+   kernel.cp_ = &cp;
+   kernel.r_ = r_.data();
+   kernel.activity_ = activity_.data();
+   kernel.w_ = w_.data();
+   kernel.z_ = z_.data();
+   kernel.p_ = p_.data();
+   kernel.noms_ = noms_.data();
+   kernel.rmax_ = rmax_.data();
+   kernel.n_ = cp.size();
+   kernel.blockSize_ = blockSize_;
+
+   forEachBlock( kernel );
+
+   betaNom = sum( noms_ );
+
+   real rmax( 0 );
+   for( size_t b=0UL; b<blocks_; ++b )
+      rmax = max( rmax, rmax_[b] );
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns per node of the given complementarity problem type.
+//
+// \return The number of unknowns that have to be processed by the same thread.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline size_t CPG::nodeSize()
+{
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given block operation for all blocks of the vector operations.
+//
+// \param op The block operation.
+// \return void
+//
+// The blocks are processed in parallel in case the number of unknowns exceeds the SMP threshold
+// for vector operations and sequentially otherwise.
+*/
+template< typename OP >  // Type of the block operation
+inline void CPG::forEachBlock( const OP& op ) const
+{
+   if( parallel_ )
+      smpFor( 0UL, blocks_, op );
+   else
+      op( 0UL, blocks_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recomputes the negative residual \f$ r = -(A x + b) \f$ from scratch.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns.
+// \return void
+*/
+inline void CPG::residual( const CMatMxN& A, const VecN& b, const VecN& x )
+{
+   MultKernel kernel;
+   kernel.A_ = &A;
+   kernel.v_ = x.data();
+   kernel.b_ = b.data();
+   kernel.y_ = r_.data();
+   kernel.dots_ = noms_.data();
+   kernel.n_ = A.rows();
+   kernel.blockSize_ = blockSize_;
+
+   forEachBlock( kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Corrects the residual for the unknowns clamped during the last descent step.
+//
+// \param A The symmetric system matrix.
+// \return void
+//
+// This function subtracts \f$ A \delta \f$ from the residual, where \f$ \delta \f$ is the
+// deviation of the clamped unknowns from the linear step. Due to the symmetry of \a A, only the
+// rows of the clamped unknowns are traversed.
+*/
+inline void CPG::correct( const CMatMxN& A )
+{
+   for( size_t b=0UL; b<blocks_; ++b ) {
+      for( size_t k=b*blockSize_; k<b*blockSize_+counts_[b]; ++k ) {
+         const size_t j( clamped_[k] );
+         const real dj( delta_[j] );
+         for( CMatMxN::ConstIterator element=A.begin(j); element!=A.end(j); ++element )
+            r_[element->index()] -= element->value() * dj;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sums the per-block partial results.
+//
+// \param v The vector of per-block partial results.
+// \return The sum of the first \a blocks_ partial results.
+//
+// In case deterministic reductions are enabled, the partial results are combined via a fixed
+// reduction tree.
+*/
+inline real CPG::sum( const VecN& v ) const
+{
+   if( SMP_DETERMINISTIC_REDUCTION )
+      return treeReduction( v.data(), blocks_ );
+
+   real tmp( 0 );
+   for( size_t b=0UL; b<blocks_; ++b )
+      tmp += v[b];
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of unknowns per contact of a contact LCP.
+//
+// \return The number of unknowns per contact.
+*/
+template<>
+inline size_t CPG::nodeSize<ContactLCP>()
+{
+   return 3UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
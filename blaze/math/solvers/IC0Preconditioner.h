@@ -0,0 +1,305 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IC0Preconditioner.h
+//  \brief Header file for the incomplete Cholesky preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/sparse/SetOperations.h>
+#include <blaze/math/triangular/LevelSchedule.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The zero fill-in incomplete Cholesky (IC(0)) preconditioner.
+// \ingroup preconditioners
+//
+// The IC0Preconditioner class represents the preconditioner \f$ M = L L^T \f$, where \f$ L \f$
+// is the incomplete Cholesky factor of the symmetric positive definite system matrix restricted
+// to the sparsity pattern of the lower part of the system matrix. The factor is stored as a
+// row-major compressed matrix, the application of the preconditioner consists of a forward
+// substitution with \f$ L \f$ and a backward substitution with \f$ L^T \f$. For the backward
+// substitution a row-major copy of \f$ L^T \f$ is stored along with the factor. Both
+// substitutions are level-scheduled (see the LevelSchedule class), i.e. all unknowns of a
+// single level are computed in parallel in case the level is sufficiently large. Note that the
+// incomplete factorization may break down for matrices that are not diagonally dominant, in
+// which case a \a std::invalid_argument exception is thrown.
+*/
+class IC0Preconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline IC0Preconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline IC0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void compute( const Matrix<MT,SO>& A );
+
+   inline void           compute( const CMatMxN& A );
+   inline size_t         size   () const;
+   inline const CMatMxN& factor () const;
+   inline void           apply  ( const VecN& r, VecN& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CMatMxN       L_;      //!< The incomplete Cholesky factor \f$ L \f$.
+                          /*!< The diagonal element of each row is stored as the last element
+                               of the row. */
+   CMatMxN       U_;      //!< The transpose \f$ L^T \f$ of the incomplete Cholesky factor.
+   LevelSchedule lower_;  //!< The level schedule of the forward substitution.
+   LevelSchedule upper_;  //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the IC0Preconditioner class.
+*/
+inline IC0Preconditioner::IC0Preconditioner()
+   : L_    ()  // The incomplete Cholesky factor
+   , U_    ()  // The transpose of the incomplete Cholesky factor
+   , lower_()  // The level schedule of the forward substitution
+   , upper_()  // The level schedule of the backward substitution
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the IC0Preconditioner class.
+//
+// \param A The symmetric positive definite system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete Cholesky factorization failed.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline IC0Preconditioner::IC0Preconditioner( const Matrix<MT,SO>& A )
+   : L_    ()  // The incomplete Cholesky factor
+   , U_    ()  // The transpose of the incomplete Cholesky factor
+   , lower_()  // The level schedule of the forward substitution
+   , upper_()  // The level schedule of the backward substitution
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given system matrix.
+//
+// \param A The symmetric positive definite system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete Cholesky factorization failed.
+//
+// This function converts the given matrix to a row-major compressed matrix and computes the
+// incomplete Cholesky factor of the converted matrix.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline void IC0Preconditioner::compute( const Matrix<MT,SO>& A )
+{
+   compute( CMatMxN( ~A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given row-major compressed system matrix.
+//
+// \param A The symmetric positive definite system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete Cholesky factorization failed.
+//
+// The factor is computed row by row. Each off-diagonal element \f$ l_{ij} \f$ requires the
+// sparse dot product of the already computed parts of the rows \a i and \a j, which is
+// evaluated by the sparse intersection kernel directly on the storage of the factor. Finally,
+// the transpose of the factor and the level schedules of both substitutions are computed.
+*/
+inline void IC0Preconditioner::compute( const CMatMxN& A )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( A.rows() );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i) && element->index()<=i; ++element )
+         ++nonzeros;
+   }
+
+   L_.reset();
+   L_.resize( n, n, false );
+   L_.reserve( nonzeros );
+
+   const CMatMxN& L( L_ );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      bool diagonal( false );
+
+      for( ConstIterator element=A.begin(i); element!=A.end(i) && element->index()<=i; ++element )
+      {
+         const size_t j( element->index() );
+
+         if( j < i ) {
+            const real sum( sparseDot<real>( L.begin(i), L.end(i), L.begin(j), L.end(j) ) );
+            L_.append( i, j, ( element->value() - sum ) / ( L.end(j)-1 )->value() );
+         }
+         else {
+            real pivot( element->value() );
+            for( ConstIterator l=L.begin(i); l!=L.end(i); ++l )
+               pivot -= l->value() * l->value();
+            if( !( pivot > real(0) ) )
+               throw std::invalid_argument( "Incomplete Cholesky factorization failed" );
+            L_.append( i, i, std::sqrt( pivot ) );
+            diagonal = true;
+         }
+      }
+
+      if( !diagonal )
+         throw std::invalid_argument( "Incomplete Cholesky factorization failed" );
+
+      L_.finalize( i );
+   }
+
+   U_ = trans( L_ );
+
+   lower_.computeLower( L_ );
+   upper_.computeUpper( U_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioner.
+*/
+inline size_t IC0Preconditioner::size() const
+{
+   return L_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the incomplete Cholesky factor.
+//
+// \return Reference to the lower triangular factor \f$ L \f$.
+*/
+inline const CMatMxN& IC0Preconditioner::factor() const
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = (L L^T)^{-1} r \f$).
+//
+// \param r The vector to be preconditioned.
+// \param z The resulting preconditioned vector.
+// \return void
+//
+// The forward substitution traverses the rows of \f$ L \f$, the backward substitution traverses
+// the rows of \f$ L^T \f$, both in the order of their level schedules. Both substitutions
+// operate in-place on \a z.
+*/
+inline void IC0Preconditioner::apply( const VecN& r, VecN& z ) const
+{
+   BLAZE_USER_ASSERT( r.size() == L_.rows(), "Invalid vector size detected" );
+
+   z = r;
+
+   lower_.solve( L_, z );
+   upper_.solve( U_, z );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
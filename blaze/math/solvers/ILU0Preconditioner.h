@@ -0,0 +1,338 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILU0Preconditioner.h
+//  \brief Header file for the incomplete LU preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/triangular/LevelSchedule.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The zero fill-in incomplete LU (ILU(0)) preconditioner.
+// \ingroup preconditioners
+//
+// The ILU0Preconditioner class represents the preconditioner \f$ M = L U \f$, where \f$ L \f$
+// is a unit lower triangular and \f$ U \f$ an upper triangular matrix, whose combined sparsity
+// pattern is restricted to the sparsity pattern of the (general, not necessarily symmetric)
+// system matrix. Both factors are stored as row-major compressed matrices: \f$ L \f$ without
+// its unit diagonal and \f$ U \f$ with the diagonal element as the first element of each row.
+// The application of the preconditioner consists of a forward substitution with \f$ L \f$ and
+// a backward substitution with \f$ U \f$, both of which are level-scheduled (see the
+// LevelSchedule class). Note that the incomplete factorization requires all diagonal elements
+// of the system matrix to be stored and may break down due to a zero pivot, in which case a
+// \a std::invalid_argument exception is thrown. For a symmetric system matrix the factors
+// satisfy \f$ U = D L^T \f$, i.e. the preconditioner is symmetric and can also be used with
+// the CG solver.
+*/
+class ILU0Preconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ILU0Preconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline ILU0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void compute( const Matrix<MT,SO>& A );
+
+   inline void           compute( const CMatMxN& A );
+   inline size_t         size   () const;
+   inline const CMatMxN& lower  () const;
+   inline const CMatMxN& upper  () const;
+   inline void           apply  ( const VecN& r, VecN& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CMatMxN       L_;      //!< The strictly lower part of the unit lower triangular factor \f$ L \f$.
+   CMatMxN       U_;      //!< The upper triangular factor \f$ U \f$.
+                          /*!< The diagonal element of each row is stored as the first element
+                               of the row. */
+   LevelSchedule lower_;  //!< The level schedule of the forward substitution.
+   LevelSchedule upper_;  //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the ILU0Preconditioner class.
+*/
+inline ILU0Preconditioner::ILU0Preconditioner()
+   : L_    ()  // The unit lower triangular factor
+   , U_    ()  // The upper triangular factor
+   , lower_()  // The level schedule of the forward substitution
+   , upper_()  // The level schedule of the backward substitution
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ILU0Preconditioner class.
+//
+// \param A The system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete LU factorization failed.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline ILU0Preconditioner::ILU0Preconditioner( const Matrix<MT,SO>& A )
+   : L_    ()  // The unit lower triangular factor
+   , U_    ()  // The upper triangular factor
+   , lower_()  // The level schedule of the forward substitution
+   , upper_()  // The level schedule of the backward substitution
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given system matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete LU factorization failed.
+//
+// This function converts the given matrix to a row-major compressed matrix and computes the
+// incomplete LU factors of the converted matrix.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline void ILU0Preconditioner::compute( const Matrix<MT,SO>& A )
+{
+   compute( CMatMxN( ~A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given row-major compressed system matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete LU factorization failed.
+//
+// The factors are computed in-place on a copy of the system matrix by means of the row-wise
+// (IKJ) variant of Gaussian elimination, which discards all updates outside the sparsity
+// pattern. The positions of the elements of the current row are tracked by a dense index map,
+// the positions of the diagonal elements of all preceding rows are kept for the access to the
+// corresponding rows of \f$ U \f$. Afterwards the combined factor is split into \f$ L \f$ and
+// \f$ U \f$ and the level schedules of both substitutions are computed.
+*/
+inline void ILU0Preconditioner::compute( const CMatMxN& A )
+{
+   typedef CMatMxN::Iterator       Iterator;
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( A.rows() );
+
+   CMatMxN LU( A );
+
+   std::vector<Iterator> pos     ( n, Iterator() );
+   std::vector<Iterator> diagonal( n, Iterator() );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      for( Iterator element=LU.begin(i); element!=LU.end(i); ++element )
+         pos[element->index()] = element;
+
+      if( pos[i] == Iterator() )
+         throw std::invalid_argument( "Incomplete LU factorization failed" );
+
+      for( Iterator element=LU.begin(i); element->index()<i; ++element )
+      {
+         const size_t k( element->index() );
+         const real factor( element->value() / diagonal[k]->value() );
+
+         element->value() = factor;
+
+         for( ConstIterator u=diagonal[k]+1; u!=LU.end(k); ++u ) {
+            if( pos[u->index()] != Iterator() )
+               pos[u->index()]->value() -= factor * u->value();
+         }
+      }
+
+      if( isDefault( pos[i]->value() ) )
+         throw std::invalid_argument( "Incomplete LU factorization failed" );
+
+      diagonal[i] = pos[i];
+
+      for( Iterator element=LU.begin(i); element!=LU.end(i); ++element )
+         pos[element->index()] = Iterator();
+   }
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i )
+      nonzeros += static_cast<size_t>( diagonal[i] - LU.begin(i) );
+
+   L_.reset();
+   L_.resize( n, n, false );
+   L_.reserve( nonzeros );
+
+   U_.reset();
+   U_.resize( n, n, false );
+   U_.reserve( LU.nonZeros() - nonzeros );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      for( ConstIterator element=LU.begin(i); element!=diagonal[i]; ++element )
+         L_.append( i, element->index(), element->value() );
+      L_.finalize( i );
+
+      for( ConstIterator element=diagonal[i]; element!=LU.end(i); ++element )
+         U_.append( i, element->index(), element->value() );
+      U_.finalize( i );
+   }
+
+   lower_.computeLower( L_ );
+   upper_.computeUpper( U_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioner.
+*/
+inline size_t ILU0Preconditioner::size() const
+{
+   return U_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the strictly lower part of the unit lower triangular factor.
+//
+// \return Reference to the strictly lower part of the factor \f$ L \f$.
+*/
+inline const CMatMxN& ILU0Preconditioner::lower() const
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper triangular factor.
+//
+// \return Reference to the upper triangular factor \f$ U \f$.
+*/
+inline const CMatMxN& ILU0Preconditioner::upper() const
+{
+   return U_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = (L U)^{-1} r \f$).
+//
+// \param r The vector to be preconditioned.
+// \param z The resulting preconditioned vector.
+// \return void
+//
+// Both the forward substitution with \f$ L \f$ and the backward substitution with \f$ U \f$
+// traverse the rows of the factors in the order of their level schedules and operate in-place
+// on \a z.
+*/
+inline void ILU0Preconditioner::apply( const VecN& r, VecN& z ) const
+{
+   BLAZE_USER_ASSERT( r.size() == U_.rows(), "Invalid vector size detected" );
+
+   z = r;
+
+   lower_.solve( L_, z, true );
+   upper_.solve( U_, z );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,574 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILUTPreconditioner.h
+//  \brief Header file for the threshold-based incomplete LU preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_SOLVERS_ILUTPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILUTPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/triangular/LevelSchedule.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The threshold-based incomplete LU (ILUT) preconditioner.
+// \ingroup preconditioners
+//
+// The ILUTPreconditioner class represents the preconditioner \f$ M = L U \f$, where \f$ L \f$
+// is a unit lower triangular and \f$ U \f$ an upper triangular matrix. In contrast to the
+// ILU0Preconditioner, the sparsity pattern of the factors is not fixed in advance, but is
+// determined by a dual dropping strategy: During the elimination of row \a i all elements with
+// a magnitude smaller than \f$ \tau \|a_{i*}\|_2 \f$ are dropped, afterwards only the \a p
+// largest off-diagonal elements are kept in both the \f$ L \f$ and the \f$ U \f$ part of the
+// row. The drop tolerance \f$ \tau \f$ and the fill limit \a p trade the cost of the
+// factorization and of each application for the quality of the preconditioner:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> r, z;
+   // ... Resizing and initialization
+
+   blaze::ILUTPreconditioner ilut( A, 1E-3, 20UL );  // Drop tolerance 1E-3, fill limit 20
+   ilut.apply( r, z );                              // Computes z = inv( L U ) * r
+   \endcode
+
+// Note that due to the row-wise dropping the factors of a symmetric matrix are in general not
+// symmetric. Therefore the ILUTPreconditioner is meant for solvers for general systems, whereas
+// for the CG solver the IC0Preconditioner should be used. The factors are stored in the same format as the factors of the ILU0Preconditioner and are
+// applied by level-scheduled substitutions (see the LevelSchedule class). In case the
+// factorization encounters a zero pivot, a \a std::invalid_argument exception is thrown.
+*/
+class ILUTPreconditioner
+{
+ private:
+   //**Magnitude comparison************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Comparison of two elements of the work vector by descending magnitude.
+   */
+   struct GreaterMagnitude
+   {
+      explicit inline GreaterMagnitude( const real* w ) : w_( w ) {}
+
+      inline bool operator()( size_t i, size_t j ) const {
+         return std::fabs( w_[i] ) > std::fabs( w_[j] );
+      }
+
+      const real* w_;  //!< The work vector.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ILUTPreconditioner( real tau = real(1E-4), size_t fill = 10UL );
+
+   template< typename MT, bool SO >
+   explicit inline ILUTPreconditioner( const Matrix<MT,SO>& A,
+                                       real tau = real(1E-4), size_t fill = 10UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline real   getDropTolerance() const;
+   inline size_t getFillLimit    () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setDropTolerance( real tau );
+   inline void setFillLimit    ( size_t fill );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void compute( const Matrix<MT,SO>& A );
+
+   inline void           compute( const CMatMxN& A );
+   inline size_t         size   () const;
+   inline const CMatMxN& lower  () const;
+   inline const CMatMxN& upper  () const;
+   inline void           apply  ( const VecN& r, VecN& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void select( std::vector<size_t>& indices, const std::vector<real>& w, real tol ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   real          tau_;    //!< The drop tolerance \f$ \tau \f$.
+   size_t        fill_;   //!< The maximum number of off-diagonal elements per row of each factor.
+   CMatMxN       L_;      //!< The strictly lower part of the unit lower triangular factor \f$ L \f$.
+   CMatMxN       U_;      //!< The upper triangular factor \f$ U \f$.
+                          /*!< The diagonal element of each row is stored as the first element
+                               of the row. */
+   LevelSchedule lower_;  //!< The level schedule of the forward substitution.
+   LevelSchedule upper_;  //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the ILUTPreconditioner class.
+//
+// \param tau The drop tolerance \f$ \tau \geq 0 \f$.
+// \param fill The maximum number of off-diagonal elements per row of each factor.
+// \exception std::invalid_argument Invalid drop tolerance.
+*/
+inline ILUTPreconditioner::ILUTPreconditioner( real tau, size_t fill )
+   : tau_  ( real(0) )  // The drop tolerance
+   , fill_ ( fill )     // The maximum number of off-diagonal elements per row
+   , L_    ()           // The unit lower triangular factor
+   , U_    ()           // The upper triangular factor
+   , lower_()           // The level schedule of the forward substitution
+   , upper_()           // The level schedule of the backward substitution
+{
+   setDropTolerance( tau );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ILUTPreconditioner class.
+//
+// \param A The system matrix.
+// \param tau The drop tolerance \f$ \tau \geq 0 \f$.
+// \param fill The maximum number of off-diagonal elements per row of each factor.
+// \exception std::invalid_argument Invalid drop tolerance.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete LU factorization failed.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline ILUTPreconditioner::ILUTPreconditioner( const Matrix<MT,SO>& A, real tau, size_t fill )
+   : tau_  ( real(0) )  // The drop tolerance
+   , fill_ ( fill )     // The maximum number of off-diagonal elements per row
+   , L_    ()           // The unit lower triangular factor
+   , U_    ()           // The upper triangular factor
+   , lower_()           // The level schedule of the forward substitution
+   , upper_()           // The level schedule of the backward substitution
+{
+   setDropTolerance( tau );
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the drop tolerance of the preconditioner.
+//
+// \return The drop tolerance \f$ \tau \f$.
+*/
+inline real ILUTPreconditioner::getDropTolerance() const
+{
+   return tau_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill limit of the preconditioner.
+//
+// \return The maximum number of off-diagonal elements per row of each factor.
+*/
+inline size_t ILUTPreconditioner::getFillLimit() const
+{
+   return fill_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the drop tolerance of the preconditioner.
+//
+// \param tau The drop tolerance \f$ \tau \geq 0 \f$.
+// \return void
+// \exception std::invalid_argument Invalid drop tolerance.
+//
+// The new drop tolerance only takes effect for the next computation of the preconditioner.
+*/
+inline void ILUTPreconditioner::setDropTolerance( real tau )
+{
+   if( !( tau >= real(0) ) )
+      throw std::invalid_argument( "Invalid drop tolerance" );
+
+   tau_ = tau;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the fill limit of the preconditioner.
+//
+// \param fill The maximum number of off-diagonal elements per row of each factor.
+// \return void
+//
+// The new fill limit only takes effect for the next computation of the preconditioner.
+*/
+inline void ILUTPreconditioner::setFillLimit( size_t fill )
+{
+   fill_ = fill;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given system matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete LU factorization failed.
+//
+// This function converts the given matrix to a row-major compressed matrix and computes the
+// incomplete LU factors of the converted matrix.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline void ILUTPreconditioner::compute( const Matrix<MT,SO>& A )
+{
+   compute( CMatMxN( ~A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given row-major compressed system matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Incomplete LU factorization failed.
+//
+// Each row is scattered into a dense work vector and eliminated by the already computed rows
+// of \f$ U \f$ in ascending column order, which is maintained by a min-heap over the indices
+// of the lower part of the row, including the newly created fill-in. Since the final number
+// of elements is not known in advance, the factors are assembled in temporary compressed row
+// storage and copied into the compressed matrices with exactly the required capacity.
+*/
+inline void ILUTPreconditioner::compute( const CMatMxN& A )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( A.rows() );
+
+   std::vector<real>   w   ( n, real(0) );
+   std::vector<bool>   used( n, false );
+   std::vector<size_t> heap, lindices, uindices;
+
+   std::vector<size_t> lptr( 1UL, 0UL ), lidx, uptr( 1UL, 0UL ), uidx;
+   std::vector<real>   lval, uval;
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      real norm( 0 );
+
+      w[i] = real(0);
+
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         w[j]    = element->value();
+         used[j] = true;
+         norm   += element->value() * element->value();
+         if( j < i ) heap.push_back( j );
+         else if( j > i ) uindices.push_back( j );
+      }
+
+      used[i] = true;
+
+      const real tol( tau_ * std::sqrt( norm ) );
+
+      std::make_heap( heap.begin(), heap.end(), std::greater<size_t>() );
+
+      while( !heap.empty() )
+      {
+         std::pop_heap( heap.begin(), heap.end(), std::greater<size_t>() );
+         const size_t k( heap.back() );
+         heap.pop_back();
+
+         const real factor( w[k] / uval[uptr[k]] );
+         w[k] = factor;
+         lindices.push_back( k );
+
+         if( std::fabs( factor ) < tol )
+            continue;
+
+         for( size_t p=uptr[k]+1UL; p<uptr[k+1UL]; ++p )
+         {
+            const size_t j( uidx[p] );
+
+            if( !used[j] ) {
+               used[j] = true;
+               w[j]    = real(0);
+               if( j < i ) {
+                  heap.push_back( j );
+                  std::push_heap( heap.begin(), heap.end(), std::greater<size_t>() );
+               }
+               else uindices.push_back( j );
+            }
+
+            w[j] -= factor * uval[p];
+         }
+      }
+
+      const real pivot( w[i] );
+
+      if( isDefault( pivot ) )
+         throw std::invalid_argument( "Incomplete LU factorization failed" );
+
+      for( size_t k=0UL; k<lindices.size(); ++k ) {
+         used[lindices[k]] = false;
+      }
+      for( size_t k=0UL; k<uindices.size(); ++k ) {
+         used[uindices[k]] = false;
+      }
+      used[i] = false;
+
+      select( lindices, w, tol );
+      select( uindices, w, tol );
+
+      for( size_t k=0UL; k<lindices.size(); ++k ) {
+         lidx.push_back( lindices[k] );
+         lval.push_back( w[lindices[k]] );
+      }
+      lptr.push_back( lidx.size() );
+
+      uidx.push_back( i );
+      uval.push_back( pivot );
+      for( size_t k=0UL; k<uindices.size(); ++k ) {
+         uidx.push_back( uindices[k] );
+         uval.push_back( w[uindices[k]] );
+      }
+      uptr.push_back( uidx.size() );
+
+      lindices.clear();
+      uindices.clear();
+   }
+
+   L_.reset();
+   L_.resize( n, n, false );
+   L_.reserve( lidx.size() );
+
+   U_.reset();
+   U_.resize( n, n, false );
+   U_.reserve( uidx.size() );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      for( size_t p=lptr[i]; p<lptr[i+1UL]; ++p )
+         L_.append( i, lidx[p], lval[p] );
+      L_.finalize( i );
+
+      for( size_t p=uptr[i]; p<uptr[i+1UL]; ++p )
+         U_.append( i, uidx[p], uval[p] );
+      U_.finalize( i );
+   }
+
+   lower_.computeLower( L_ );
+   upper_.computeUpper( U_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioner.
+*/
+inline size_t ILUTPreconditioner::size() const
+{
+   return U_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the strictly lower part of the unit lower triangular factor.
+//
+// \return Reference to the strictly lower part of the factor \f$ L \f$.
+*/
+inline const CMatMxN& ILUTPreconditioner::lower() const
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper triangular factor.
+//
+// \return Reference to the upper triangular factor \f$ U \f$.
+*/
+inline const CMatMxN& ILUTPreconditioner::upper() const
+{
+   return U_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = (L U)^{-1} r \f$).
+//
+// \param r The vector to be preconditioned.
+// \param z The resulting preconditioned vector.
+// \return void
+//
+// Both the forward substitution with \f$ L \f$ and the backward substitution with \f$ U \f$
+// traverse the rows of the factors in the order of their level schedules and operate in-place
+// on \a z.
+*/
+inline void ILUTPreconditioner::apply( const VecN& r, VecN& z ) const
+{
+   BLAZE_USER_ASSERT( r.size() == U_.rows(), "Invalid vector size detected" );
+
+   z = r;
+
+   lower_.solve( L_, z, true );
+   upper_.solve( U_, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the dual dropping strategy to the given indices of the work vector.
+//
+// \param indices The indices of the off-diagonal elements of one part of the current row.
+// \param w The work vector.
+// \param tol The absolute drop tolerance of the current row.
+// \return void
+//
+// This function removes all indices of elements that are zero or smaller than the drop
+// tolerance, restricts the remaining indices to the indices of the \a fill_ largest elements,
+// and sorts the remaining indices in ascending order.
+*/
+inline void ILUTPreconditioner::select( std::vector<size_t>& indices, const std::vector<real>& w,
+                                        real tol ) const
+{
+   size_t count( 0UL );
+
+   for( size_t k=0UL; k<indices.size(); ++k ) {
+      const real value( std::fabs( w[indices[k]] ) );
+      if( value >= tol && !isDefault( value ) )
+         indices[count++] = indices[k];
+   }
+
+   indices.resize( count );
+
+   if( count > fill_ ) {
+      std::nth_element( indices.begin(), indices.begin()+fill_, indices.end(),
+                        GreaterMagnitude( &w[0] ) );
+      indices.resize( fill_ );
+   }
+
+   std::sort( indices.begin(), indices.end() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
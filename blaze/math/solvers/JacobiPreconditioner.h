@@ -0,0 +1,211 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/JacobiPreconditioner.h
+//  \brief Header file for the Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The Jacobi (diagonal) preconditioner.
+// \ingroup preconditioners
+//
+// The JacobiPreconditioner class represents the preconditioner \f$ M = diag(A) \f$. It stores
+// the inverse diagonal elements of the system matrix, which turns the application of the
+// preconditioner into a single componentwise vector multiplication:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::JacobiPreconditioner pc( A );
+   blaze::CG cg;
+   cg.solve( A, b, x, pc );
+   \endcode
+*/
+class JacobiPreconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline JacobiPreconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void compute( const Matrix<MT,SO>& A );
+
+   inline size_t size () const;
+   inline void   apply( const VecN& r, VecN& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   VecN inv_;  //!< The inverse diagonal elements of the system matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the JacobiPreconditioner class.
+*/
+inline JacobiPreconditioner::JacobiPreconditioner()
+   : inv_()  // The inverse diagonal elements of the system matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the JacobiPreconditioner class.
+//
+// \param A The system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline JacobiPreconditioner::JacobiPreconditioner( const Matrix<MT,SO>& A )
+   : inv_()  // The inverse diagonal elements of the system matrix
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given system matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline void JacobiPreconditioner::compute( const Matrix<MT,SO>& A )
+{
+   if( (~A).rows() != (~A).columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( (~A).rows() );
+
+   inv_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const real tmp( (~A)(i,i) );
+      if( isDefault( tmp ) )
+         throw std::invalid_argument( "Invalid diagonal element in the system matrix" );
+      inv_[i] = real(1) / tmp;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioner.
+*/
+inline size_t JacobiPreconditioner::size() const
+{
+   return inv_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = M^{-1} r \f$).
+//
+// \param r The vector to be preconditioned.
+// \param z The resulting preconditioned vector.
+// \return void
+*/
+inline void JacobiPreconditioner::apply( const VecN& r, VecN& z ) const
+{
+   BLAZE_USER_ASSERT( r.size() == inv_.size(), "Invalid vector size detected" );
+
+   z = inv_ * r;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
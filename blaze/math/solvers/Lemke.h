@@ -41,9 +41,13 @@
 //*************************************************************************************************
 
 #include <iosfwd>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/problems/LCP.h>
+#include <blaze/math/solvers/BasisFactorization.h>
 #include <blaze/math/solvers/Solver.h>
 #include <blaze/system/Precision.h>
 #include <blaze/util/Types.h>
@@ -61,11 +65,36 @@ namespace blaze {
 /*!\brief The Lemke pivoting algorithm for solving LCPs.
 // \ingroup complementarity_solvers
 //
-// TODO
+// The Lemke class solves LCPs by means of Lemke's complementary pivoting algorithm with a
+// lexicographic ratio test. Two representations of the pivoting tableau are available (see the
+// setRepresentation() function):
+//
+//  - \a Lemke::revised (default): The current basis is kept as sparse LU factorization (see the
+//    BasisFactorization class). Each pivot step computes the column of the driving variable by
+//    a single hypersparse solve with the basis and appends the column exchange to the
+//    factorization in product form. Ties of the ratio test are resolved column by column of the
+//    inverse basis, i.e. each additional column of the lexicographic comparison costs a single
+//    hypersparse solve with a unit vector irrespective of the number of tied rows. Thus the cost
+//    and memory of a pivot step are proportional to the number of non-zero elements of the
+//    factorization. In order to limit the growth of the product form, the basis is refactorized
+//    as soon as the eta file exceeds a multiple of the size of the LU factors (see the
+//    setRefactorizationThreshold() function).
+//  - \a Lemke::dense: Pivoting on the explicit dense \f$ n \times (n+1) \f$ tableaux. Each pivot
+//    step costs \f$ O(n^2) \f$ operations and the tableaux require \f$ O(n^2) \f$ memory, but the
+//    cost does not depend on the fill-in of the basis. This representation is kept as fallback
+//    and as reference for the revised form.
 */
 class Lemke : public Solver
 {
  public:
+   //**Representations*****************************************************************************
+   //! The available representations of the pivoting tableau.
+   enum Representation {
+      dense   = 0,  //!< Pivoting on the dense tableau.
+      revised = 1   //!< Pivoting on the sparse LU factorization of the basis.
+   };
+   //**********************************************************************************************
+
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
@@ -73,6 +102,22 @@ class Lemke : public Solver
    //@}
    //**********************************************************************************************
 
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline Representation getRepresentation          () const;
+   inline real           getRefactorizationThreshold() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setRepresentation          ( Representation representation );
+   inline void setRefactorizationThreshold( real threshold );
+   //@}
+   //**********************************************************************************************
+
    //**Solver functions****************************************************************************
    /*!\name Solver functions */
    //@{
@@ -92,26 +137,132 @@ class Lemke : public Solver
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   bool isComponentwiseNonnegative( const VecN& v ) const;
-   bool isComponentwisePositive   ( const VecN& v ) const;
-   bool isLexicographicallyLess   ( size_t i1, real f1, size_t i2, real f2 ) const;
-   bool isLexicographicallyGreater( size_t i1, real f1, size_t i2, real f2 ) const;
-   void pivot                     ( size_t block, size_t drive );
+   bool   isComponentwiseNonnegative( const VecN& v ) const;
+   bool   isComponentwisePositive   ( const VecN& v ) const;
+   bool   isLexicographicallyLess   ( size_t i1, real f1, size_t i2, real f2 ) const;
+   bool   isLexicographicallyGreater( size_t i1, real f1, size_t i2, real f2 ) const;
+   size_t selectInitialBlocking     ();
+   size_t selectBlocking            ( size_t drive );
+   size_t lexicographicMinimum      ();
+   bool   pivot                     ( size_t block, size_t drive );
+   bool   refactorize               ();
+   void   computeColumn             ( size_t drive );
+   void   column                    ( ptrdiff_t variable, VecN& c, std::vector<size_t>& indices ) const;
+   void   setupTableau              ();
+   void   assembleTableau           ( MatMxN& Q, MatMxN& T ) const;
+   void   extractSolution           ( VecN& x ) const;
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   DynamicVector<ptrdiff_t> basics_;     //!< TODO
-   DynamicVector<ptrdiff_t> nonbasics_;  //!< TODO
-   MatMxN                   M_;          //!< TODO
-   MatMxN                   Q_;          //!< TODO
+   Representation           representation_;  //!< The representation of the pivoting tableau.
+   real                     refactorLimit_;   //!< The refactorization threshold.
+   bool                     dense_;           //!< Flag for pivoting on the dense tableau.
+   DynamicVector<ptrdiff_t> basics_;          //!< The basic variables (negative for w, positive for z).
+   DynamicVector<ptrdiff_t> nonbasics_;       //!< The nonbasic variables (0 for the artificial variable).
+   CompressedMatrix<real,true> M_;            //!< Column-major copy of the LCP matrix.
+   CompressedMatrix<real,true> B_;            //!< The basis matrix for refactorizations.
+   BasisFactorization       basis_;           //!< The factorization of the current basis.
+   VecN                     d_;               //!< The cover vector.
+   VecN                     q_;               //!< The right-hand side vector of the LCP.
+   VecN                     xB_;              //!< The values of the basic variables.
+   VecN                     alpha_;           //!< The column of the driving variable.
+   std::vector<size_t>      alphaIndices_;    //!< The indices of the non-zero elements of alpha_.
+   VecN                     unit_;            //!< Column of the inverse basis for lexicographic tests.
+   std::vector<size_t>      unitIndices_;     //!< The indices of the non-zero elements of unit_.
+   VecN                     scale_;           //!< The scaling factors of the rows in the ratio test.
+   std::vector<size_t>      ties_;            //!< The candidate rows of the ratio test.
+   std::vector<size_t>      marker_;          //!< Markers of the remaining candidate rows.
+   size_t                   stamp_;           //!< The current marker stamp.
+   MatMxN                   Q_;               //!< The dense tableau \f$ B^{-1} [q, I] \f$.
+   MatMxN                   T_;               //!< The dense tableau of the nonbasic variables.
    //@}
    //**********************************************************************************************
 };
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the representation of the pivoting tableau.
+//
+// \return The current representation.
+*/
+inline Lemke::Representation Lemke::getRepresentation() const
+{
+   return representation_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relative size of the eta file that triggers a refactorization of the basis.
+//
+// \return The refactorization threshold.
+*/
+inline real Lemke::getRefactorizationThreshold() const
+{
+   return refactorLimit_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the representation of the pivoting tableau.
+//
+// \param representation The new representation.
+// \return void
+//
+// The representation takes effect with the next solution process. The default representation
+// is \a Lemke::revised.
+*/
+inline void Lemke::setRepresentation( Representation representation )
+{
+   representation_ = representation;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the relative size of the eta file that triggers a refactorization of the basis.
+//
+// \param threshold The new refactorization threshold.
+// \return void
+// \exception std::invalid_argument Invalid refactorization threshold.
+//
+// In revised form, the basis is refactorized as soon as the number of non-zero elements of the
+// eta file exceeds \a threshold times the number of non-zero elements of the LU factors, i.e.
+// as soon as the fill-in of the product form renders the solves with the basis more expensive
+// than a fresh factorization. Small thresholds limit the cost of the solves and the accumulation
+// of rounding errors, large thresholds avoid the cost of the refactorizations. The default
+// threshold is 4.
+*/
+inline void Lemke::setRefactorizationThreshold( real threshold )
+{
+   if( threshold <= real(0) )
+      throw std::invalid_argument( "Invalid refactorization threshold" );
+
+   refactorLimit_ = threshold;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -41,13 +41,25 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/problems/BoxLCP.h>
 #include <blaze/math/problems/ContactLCP.h>
 #include <blaze/math/problems/LCP.h>
+#include <blaze/math/reordering/AdjacencyGraph.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/solvers/Solver.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/logging/DebugSection.h>
@@ -66,12 +78,136 @@ namespace blaze {
 /*!\brief A projected Gauss-Seidel Solver for (box) LCPs.
 // \ingroup complementarity_solvers
 //
-// TODO: description of the PGS solver
-// TODO: capabilities of the PGS solver (which LCP problems, etc)
-// TODO: known issues of the PGS solver
+// The PGS class solves linear complementarity problems (LCP, BoxLCP and ContactLCP) by means of
+// projected Gauss-Seidel sweeps. Three sweep modes are available (see the setSweepMode() function):
+//
+//  - \a PGS::gaussSeidel: The default, strictly sequential sweep over all unknowns.
+//  - \a PGS::colored: The nodes of the problem (the unknowns of an LCP or BoxLCP or the contacts
+//    of a ContactLCP) are colored such that no two nodes of the same color are coupled by the
+//    system matrix. The nodes of each color are then updated in parallel. Since the update of a
+//    node only depends on nodes of other colors, the result corresponds to a sequential sweep in
+//    color order and is therefore deterministic for a fixed coloring, independent of the number
+//    of threads. The coloring is computed by a greedy algorithm in node order.
+//  - \a PGS::jacobi: All nodes are updated in parallel based on the solution of the previous
+//    sweep. The update is damped by the relaxation parameter (see the setRelaxation() function).
+//    This mode is a fallback for strongly coupled problems that require too many colors. The
+//    default relaxation parameter is 0.5.
+//
+// All sweeps compute the row products of the system matrix directly on the row iterators of
+// the compressed system matrix.
+//
+// For contact LCPs, the solver optionally performs block updates (see the setBlockUpdate()
+// function): Instead of updating the normal and the two friction unknowns of a contact one
+// after another by means of the scalar inverse diagonal elements, the residuals of all three
+// unknowns are computed first and the three unknowns are updated together by means of the
+// precomputed inverse of the 3x3 diagonal block of the contact. Afterwards, the normal unknown
+// is projected to the positive half-space and the friction unknowns are projected onto the
+// isotropic friction cone \f$ \sqrt{x_t^2+x_o^2} \le \mu x_n \f$ in a single step. Note that
+// in contrast to the friction box used by the scalar updates, this projection solves the
+// problem with respect to the isotropic Coulomb friction cone.
+//
+// In case warm starts are enabled (see Solver::setWarmStart()), the solver caches the coloring
+// of the nodes together with a copy of the sparsity pattern of the system matrix. Subsequent
+// solution processes for system matrices with exactly the same sparsity pattern reuse the
+// cached coloring instead of recomputing it. Since the coloring only depends on the sparsity
+// pattern, it remains valid for arbitrary changes of the values of the system matrix. All data
+// depending on the values of the system matrix (i.e. the inverse diagonal elements and the
+// inverse diagonal blocks) is recomputed in every solution process. The cached coloring can be
+// discarded via the invalidate() function.
 */
 class PGS : public Solver
 {
+ public:
+   //**Sweep modes*********************************************************************************
+   //! The available sweep modes of the PGS solver.
+   enum SweepMode {
+      gaussSeidel = 0,  //!< Sequential projected Gauss-Seidel sweep.
+      colored     = 1,  //!< Parallel projected Gauss-Seidel sweep over a coloring of the nodes.
+      jacobi      = 2   //!< Parallel relaxed projected Jacobi sweep.
+   };
+   //**********************************************************************************************
+
+ private:
+   //**Colored sweep kernel************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Projected Gauss-Seidel update of the nodes of a single color.
+   */
+   template< typename CP >  // Type of the complementarity problem
+   struct ColorKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, size_ ) );
+            real rmax( 0 );
+            for( size_t k=begin; k<end; ++k )
+               rmax = max( rmax, solver_->update( *cp_, nodes_[k] ) );
+            rmax_[b] = rmax;
+         }
+      }
+
+      const PGS*    solver_;     //!< The PGS solver.
+      CP*           cp_;         //!< The complementarity problem.
+      const size_t* nodes_;      //!< The nodes of the color.
+      size_t        size_;       //!< The number of nodes of the color.
+      size_t        blockSize_;  //!< The number of nodes per block.
+      real*         rmax_;       //!< The maximum changes of the unknowns per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Jacobi residual kernel**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computation of the residual \f$ r = -b - A x \f$ for the Jacobi sweep.
+   */
+   struct ResidualKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, size_ ) );
+            for( size_t i=begin; i<end; ++i )
+               (*r_)[i] = -(*b_)[i] - product( *A_, *x_, i );
+         }
+      }
+
+      const CMatMxN* A_;          //!< The system matrix.
+      const VecN*    b_;          //!< The right-hand side vector.
+      const VecN*    x_;          //!< The vector of unknowns.
+      VecN*          r_;          //!< The residual.
+      size_t         size_;       //!< The number of unknowns.
+      size_t         blockSize_;  //!< The number of unknowns per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Jacobi update kernel************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Relaxed projected Jacobi update of all nodes.
+   */
+   template< typename CP >  // Type of the complementarity problem
+   struct JacobiKernel
+   {
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t b=first; b<last; ++b ) {
+            const size_t begin( b*blockSize_ );
+            const size_t end  ( min( begin+blockSize_, size_ ) );
+            real rmax( 0 );
+            for( size_t k=begin; k<end; ++k )
+               rmax = max( rmax, solver_->relax( *cp_, k ) );
+            rmax_[b] = rmax;
+         }
+      }
+
+      const PGS* solver_;     //!< The PGS solver.
+      CP*        cp_;         //!< The complementarity problem.
+      size_t     size_;       //!< The number of nodes.
+      size_t     blockSize_;  //!< The number of nodes per block.
+      real*      rmax_;       //!< The maximum changes of the unknowns per block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
@@ -80,10 +216,31 @@ class PGS : public Solver
    //@}
    //**********************************************************************************************
 
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline SweepMode getSweepMode  () const;
+   inline real      getRelaxation () const;
+   inline size_t    getNumColors  () const;
+   inline bool      getBlockUpdate() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setSweepMode  ( SweepMode mode );
+   inline void setRelaxation ( real omega );
+   inline void setBlockUpdate( bool block );
+   //@}
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
    template< typename CP > bool solve( CP& cp );
+
+   inline void invalidate();
    //@}
    //**********************************************************************************************
 
@@ -91,16 +248,48 @@ class PGS : public Solver
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   template< typename CP > inline real sweep( CP& cp ) const;
+   template< typename CP > inline real sweep        ( CP& cp );
+   template< typename CP > inline real sweepColored ( CP& cp );
+   template< typename CP > inline real sweepJacobi  ( CP& cp );
+   template< typename CP > inline real update       ( CP& cp, size_t node ) const;
+   template< typename CP > inline real relax        ( CP& cp, size_t node ) const;
+   template< typename CP > inline void color        ( const CP& cp );
+   template< typename CP > inline void setupBlocks  ( const CP& cp );
+   template< typename CP > static inline size_t nodeSize();
+
+   inline size_t blocks( size_t nodes, size_t unknowns );
+   inline real   reduce( size_t blocks ) const;
+
+   inline real updateBlock( ContactLCP& cp, size_t node, const Vec3& residual, real omega ) const;
+
+   static inline real product( const CMatMxN& A, const VecN& x, size_t i );
+
+   inline bool matchesPattern( const CMatMxN& A, size_t ns ) const;
+   inline void storePattern  ( const CMatMxN& A, size_t ns );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   VecN diagonal_;  //!< Vector for the diagonal entries of the LCP matrix.
-                    /*!< For performance reasons, the vector contains the inverse of the
-                         diagonal elements. */
+   SweepMode mode_;      //!< The sweep mode of the solver.
+   real      omega_;     //!< The relaxation parameter of the Jacobi sweep.
+   VecN diagonal_;       //!< Vector for the diagonal entries of the LCP matrix.
+                         /*!< For performance reasons, the vector contains the inverse of the
+                              diagonal elements. */
+   VecN residual_;       //!< The residual of the Jacobi sweep.
+   VecN rmax_;           //!< The maximum changes of the unknowns per block.
+   std::vector<size_t> colorOffsets_;  //!< The offsets of the colors within the node vector.
+   std::vector<size_t> colorNodes_;    //!< The nodes of the problem sorted by color.
+   bool block_;          //!< Flag for block updates of contact LCPs.
+
+   //! The inverse 3x3 diagonal blocks of the contacts of a contact LCP.
+   std::vector< Mat3x3, AlignedAllocator<Mat3x3> > blockInverses_;
+
+   std::vector<size_t> patternOffsets_;  //!< The row offsets of the sparsity pattern of the cached coloring.
+   std::vector<size_t> patternIndices_;  //!< The column indices of the sparsity pattern of the cached coloring.
+   size_t patternNodeSize_;              //!< The node size of the cached coloring.
+   bool colorsCached_;   //!< Flag for a valid cached coloring.
    //@}
    //**********************************************************************************************
 };
@@ -109,6 +298,116 @@ class PGS : public Solver
 
 
 
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current sweep mode of the solver.
+//
+// \return The current sweep mode.
+*/
+inline PGS::SweepMode PGS::getSweepMode() const
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relaxation parameter of the Jacobi sweep.
+//
+// \return The relaxation parameter \f$ \omega \f$.
+*/
+inline real PGS::getRelaxation() const
+{
+   return omega_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether block updates are performed for contact LCPs.
+//
+// \return \a true in case block updates are performed, \a false if not.
+*/
+inline bool PGS::getBlockUpdate() const
+{
+   return block_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of colors of the last colored solution process.
+//
+// \return The number of colors of the last coloring.
+*/
+inline size_t PGS::getNumColors() const
+{
+   return colorOffsets_.empty() ? 0UL : colorOffsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the sweep mode of the solver.
+//
+// \param mode The new sweep mode.
+// \return void
+*/
+inline void PGS::setSweepMode( SweepMode mode )
+{
+   mode_ = mode;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the relaxation parameter of the Jacobi sweep.
+//
+// \param omega The relaxation parameter \f$ \omega \in (0..1] \f$.
+// \return void
+// \exception std::invalid_argument Invalid relaxation parameter.
+*/
+inline void PGS::setRelaxation( real omega )
+{
+   if( !( omega > real(0) && omega <= real(1) ) )
+      throw std::invalid_argument( "Invalid relaxation parameter" );
+
+   omega_ = omega;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Enables or disables block updates for contact LCPs.
+//
+// \param block \a true to enable block updates, \a false to disable them.
+// \return void
+//
+// This setting only affects contact LCPs. For all other complementarity problems the unknowns
+// are always updated individually.
+*/
+inline void PGS::setBlockUpdate( bool block )
+{
+   block_ = block;
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  UTILITY FUNCTIONS
@@ -121,7 +420,9 @@ class PGS : public Solver
 // \param cp The complementarity problem to solve.
 // \return Returns \a true if the solution is sufficiently accurate, otherwise it returns \a false.
 //
-// TODO
+// The current values of the unknowns are used as initial guess. In case warm starts are enabled
+// and the sparsity pattern of the system matrix is unchanged since the last solution process,
+// the cached coloring is reused (see the class description).
 */
 template< typename CP >  // Type of the complementarity problem
 bool PGS::solve( CP& cp )
@@ -130,6 +431,9 @@ bool PGS::solve( CP& cp )
    const CMatMxN& A( cp.A_ );
    bool converged( false );
 
+   resetStatistics();
+   const double start( timestamp() );
+
    // Allocating the helper data
    diagonal_.resize( n, false );
 
@@ -140,6 +444,19 @@ bool PGS::solve( CP& cp )
       diagonal_[i] = real(1) / tmp;
    }
 
+   // Precomputing the inverse diagonal blocks
+   setupBlocks( cp );
+
+   // Coloring the nodes of the problem
+   if( mode_ == colored )
+   {
+      if( !warmStart_ || !colorsCached_ || !matchesPattern( A, nodeSize<CP>() ) ) {
+         color( cp );
+         colorsCached_ = warmStart_;
+         if( warmStart_ ) storePattern( A, nodeSize<CP>() );
+      }
+   }
+
    // Projecting the initial solution to a feasible region
    for( size_t i=0; i<n; ++i ) {
       cp.project( i );
@@ -150,11 +467,17 @@ bool PGS::solve( CP& cp )
    if( lastPrecision_ < threshold_ )
       converged = true;
 
+   recordSetup( start );
+
    // The main iteration loop
    size_t it( 0 );
 
    for( ; !converged && it<maxIterations_; ++it ) {
+      const double begin( timestamp() );
       lastPrecision_ = sweep( cp );
+      if( mode_ != jacobi )
+         recordUpdate( begin );
+      recordIteration( begin, lastPrecision_ );
       if( lastPrecision_ < threshold_ )
          converged = true;
    }
@@ -174,87 +497,596 @@ bool PGS::solve( CP& cp )
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Discards the coloring cached for warm starts.
+//
+// \return void
+//
+// The next solution process recomputes the coloring even if warm starts are enabled and the
+// sparsity pattern of the system matrix is unchanged.
+*/
+inline void PGS::invalidate()
+{
+   colorsCached_ = false;
+   patternOffsets_.clear();
+   patternIndices_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a single sweep over all unknowns of the given complementarity problem.
 //
 // \param cp The complementarity problem to solve.
-// \return TODO
+// \return The maximum change of the unknowns during the sweep.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::sweep( CP& cp )
+{
+   if( mode_ == colored )
+      return sweepColored( cp );
+   else if( mode_ == jacobi )
+      return sweepJacobi( cp );
+
+   const size_t N( cp.size() / nodeSize<CP>() );
+   real rmax( 0 );
+
+   for( size_t i=0; i<N; ++i ) {
+      rmax = max( rmax, update( cp, i ) );
+   }
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a parallel sweep over the colors of the given complementarity problem.
+//
+// \param cp The complementarity problem to solve.
+// \return The maximum change of the unknowns during the sweep.
+//
+// The colors are processed one after another, the nodes of a single color are updated in
+// parallel.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::sweepColored( CP& cp )
+{
+   BLAZE_INTERNAL_ASSERT( !colorOffsets_.empty(), "Missing coloring detected" );
+
+   ColorKernel<CP> kernel;
+   kernel.solver_ = this;
+   kernel.cp_ = &cp;
+
+   real rmax( 0 );
+
+   for( size_t c=0UL; c<colorOffsets_.size()-1UL; ++c )
+   {
+      const size_t size( colorOffsets_[c+1UL] - colorOffsets_[c] );
+      const size_t nblocks( blocks( size, size*nodeSize<CP>() ) );
+
+      kernel.nodes_ = &colorNodes_[colorOffsets_[c]];
+      kernel.size_ = size;
+      kernel.blockSize_ = ( size + nblocks - 1UL ) / nblocks;
+      kernel.rmax_ = rmax_.data();
+
+      smpFor( 0UL, nblocks, kernel );
+
+      rmax = max( rmax, reduce( nblocks ) );
+   }
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a parallel relaxed Jacobi sweep over the given complementarity problem.
 //
-// TODO
+// \param cp The complementarity problem to solve.
+// \return The maximum change of the unknowns during the sweep.
+//
+// In a first pass, the residual of all unknowns is computed based on the current solution. In a
+// second pass, all nodes are updated by the relaxed residual and projected on the solution range.
 */
 template< typename CP >  // Type of the complementarity problem
-inline real PGS::sweep( CP& cp ) const
+inline real PGS::sweepJacobi( CP& cp )
 {
-   real maxResidual( 0 ), xold( 0 );
    const size_t n( cp.size() );
+   const size_t N( n / nodeSize<CP>() );
 
-   const CMatMxN& A( cp.A_ );
-   const VecN&    b( cp.b_ );
+   residual_.resize( n, false );
+
+   ResidualKernel residual;
+   residual.A_ = &cp.A_;
+   residual.b_ = &cp.b_;
+   residual.x_ = &cp.x_;
+   residual.r_ = &residual_;
+   residual.size_ = n;
+
+   double start( timestamp() );
+
+   const size_t rblocks( blocks( n, n ) );
+   residual.blockSize_ = ( n + rblocks - 1UL ) / rblocks;
+   smpFor( 0UL, rblocks, residual );
+
+   recordResidual( start );
+   start = timestamp();
+
+   JacobiKernel<CP> kernel;
+   kernel.solver_ = this;
+   kernel.cp_ = &cp;
+   kernel.size_ = N;
+
+   const size_t nblocks( blocks( N, n ) );
+   kernel.blockSize_ = ( N + nblocks - 1UL ) / nblocks;
+   kernel.rmax_ = rmax_.data();
+   smpFor( 0UL, nblocks, kernel );
+
+   const real rmax( reduce( nblocks ) );
+   recordUpdate( start );
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Projected Gauss-Seidel update of a single unknown.
+//
+// \param cp The complementarity problem to solve.
+// \param node The index of the unknown to be updated.
+// \return The change of the unknown.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::update( CP& cp, size_t node ) const
+{
    VecN& x( cp.x_ );
 
-   for( size_t i=0; i<n; ++i )
+   const real residual( -cp.b_[node] - product( cp.A_, x, node ) );
+
+   // Updating and projecting the unknown
+   const real xold( x[node] );
+   x[node] += diagonal_[node] * residual;
+   cp.project( node );
+
+   return std::fabs( xold - x[node] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Relaxed projected Jacobi update of a single unknown.
+//
+// \param cp The complementarity problem to solve.
+// \param node The index of the unknown to be updated.
+// \return The change of the unknown.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::relax( CP& cp, size_t node ) const
+{
+   VecN& x( cp.x_ );
+
+   const real xold( x[node] );
+   x[node] += omega_ * diagonal_[node] * residual_[node];
+   cp.project( node );
+
+   return std::fabs( xold - x[node] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a coloring of the nodes of the given complementarity problem.
+//
+// \param cp The complementarity problem to solve.
+// \return void
+//
+// Two nodes are coupled in case any unknown of the first node is coupled to any unknown of the
+// second node in the symmetrized sparsity pattern of the system matrix. The nodes are colored
+// greedily in ascending order by the smallest color that is not used by any coupled node. The
+// nodes of each color are stored in ascending order.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void PGS::color( const CP& cp )
+{
+   const size_t ns( nodeSize<CP>() );
+   const size_t N( cp.size() / ns );
+   const AdjacencyGraph graph( cp.A_ );
+
+   std::vector<size_t> colors( N );
+   std::vector<size_t> marker;
+   size_t ncolors( 0UL );
+
+   for( size_t u=0UL; u<N; ++u )
    {
-      const real residual( - b[i] - ( A * x )[i] );
+      for( size_t i=u*ns; i<(u+1UL)*ns; ++i ) {
+         for( AdjacencyGraph::ConstIterator v=graph.begin(i); v!=graph.end(i); ++v ) {
+            const size_t w( *v / ns );
+            if( w < u ) marker[colors[w]] = u;
+         }
+      }
 
-      // Updating and projecting the unknown
-      xold = x[i];
-      x[i] += diagonal_[i] * residual;
-      cp.project( i );
-      maxResidual = max( maxResidual, std::fabs( xold - x[i] ) );
+      size_t c( 0UL );
+      while( c < ncolors && marker[c] == u ) ++c;
+
+      if( c == ncolors ) {
+         marker.push_back( N );
+         ++ncolors;
+      }
+
+      colors[u] = c;
+   }
+
+   colorOffsets_.assign( ncolors+1UL, 0UL );
+   for( size_t u=0UL; u<N; ++u ) {
+      ++colorOffsets_[colors[u]+1UL];
+   }
+   for( size_t c=0UL; c<ncolors; ++c ) {
+      colorOffsets_[c+1UL] += colorOffsets_[c];
    }
 
-   return maxResidual;
+   colorNodes_.resize( N );
+   std::vector<size_t> pos( colorOffsets_.begin(), colorOffsets_.end()-1L );
+   for( size_t u=0UL; u<N; ++u ) {
+      colorNodes_[pos[colors[u]]++] = u;
+   }
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Precomputes the inverse diagonal blocks for block updates.
 //
 // \param cp The complementarity problem to solve.
-// \return TODO
+// \return void
+//
+// The default implementation for all problems with scalar updates does nothing.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void PGS::setupBlocks( const CP& /*cp*/ )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns per node of the given complementarity problem type.
+//
+// \return The number of unknowns per node.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline size_t PGS::nodeSize()
+{
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of blocks for a parallel update.
+//
+// \param nodes The number of nodes to be updated.
+// \param unknowns The number of unknowns to be updated.
+// \return The number of blocks.
+//
+// This function additionally guarantees that the auxiliary vector for the per-block results
+// provides enough space for the returned number of blocks.
+*/
+inline size_t PGS::blocks( size_t nodes, size_t unknowns )
+{
+   const size_t nblocks( ( unknowns < SMP_PGS_THRESHOLD || nodes < 2UL ||
+                           isSerialSectionActive() || isParallelSectionActive() )
+                         ?( 1UL ):( min( getNumThreads(), nodes ) ) );
+
+   if( rmax_.size() < nblocks )
+      rmax_.resize( nblocks, false );
+
+   return nblocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduction of the per-block maximum changes of the unknowns.
+//
+// \param blocks The number of blocks.
+// \return The maximum change of the unknowns.
+*/
+inline real PGS::reduce( size_t blocks ) const
+{
+   real rmax( 0 );
+   for( size_t b=0UL; b<blocks; ++b )
+      rmax = max( rmax, rmax_[b] );
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the product of a row of the system matrix with the vector of unknowns.
+//
+// \param A The system matrix.
+// \param x The vector of unknowns.
+// \param i The index of the row.
+// \return The scalar product of the \a i-th row of \a A and \a x.
+*/
+inline real PGS::product( const CMatMxN& A, const VecN& x, size_t i )
+{
+   real tmp( 0 );
+   for( CMatMxN::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+      tmp += element->value() * x[element->index()];
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given system matrix matches the sparsity pattern of the cached coloring.
+//
+// \param A The system matrix.
+// \param ns The number of unknowns per node.
+// \return \a true in case the sparsity patterns are identical, \a false if not.
+//
+// This function performs an exact comparison of the row offsets and the column indices of the
+// given system matrix with the stored sparsity pattern. Its cost is linear in the number of
+// non-zero elements.
+*/
+inline bool PGS::matchesPattern( const CMatMxN& A, size_t ns ) const
+{
+   if( ns != patternNodeSize_ || A.rows()+1UL != patternOffsets_.size() ||
+       A.nonZeros() != patternIndices_.size() )
+      return false;
+
+   std::vector<size_t>::const_iterator index( patternIndices_.begin() );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+   {
+      if( patternOffsets_[i+1UL] - patternOffsets_[i] != A.nonZeros(i) )
+         return false;
+
+      for( CMatMxN::ConstIterator element=A.begin(i); element!=A.end(i); ++element, ++index ) {
+         if( element->index() != *index )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the sparsity pattern of the given system matrix.
 //
-// TODO: specialization for contact LCPs
-// TODO: more infos
+// \param A The system matrix.
+// \param ns The number of unknowns per node.
+// \return void
+*/
+inline void PGS::storePattern( const CMatMxN& A, size_t ns )
+{
+   patternNodeSize_ = ns;
+   patternOffsets_.resize( A.rows()+1UL );
+   patternIndices_.resize( A.nonZeros() );
+
+   size_t k( 0UL );
+   patternOffsets_[0UL] = 0UL;
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( CMatMxN::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+         patternIndices_[k++] = element->index();
+      patternOffsets_[i+1UL] = k;
+   }
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Projected Gauss-Seidel update of a single contact.
+//
+// \param cp The contact complementarity problem to solve.
+// \param node The index of the contact to be updated.
+// \return The maximum change of the three unknowns of the contact.
+//
+// The normal unknown of the contact is projected to the positive half-space, the two friction
+// unknowns are projected to the friction box defined by the updated normal unknown.
 */
 template<>
-inline real PGS::sweep( ContactLCP& cp ) const
+inline real PGS::update( ContactLCP& cp, size_t node ) const
 {
-   const size_t N( cp.size() / 3 );
    real rmax( 0 ), residual, flimit, aux;
-   size_t j;
+   size_t j( node * 3 );
 
    const CMatMxN& A( cp.A_ );
    const VecN&  b( cp.b_ );
    VecN& x( cp.x_ );
 
-   for( size_t i=0; i<N; ++i )
-   {
-      j = i * 3;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( 0, x[j] + diagonal_[j] * residual );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
-
-      flimit = cp.cof_[i] * x[j];
-
-      ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
-
-      ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
+   if( block_ ) {
+      const Vec3 r( -b[j    ] - product( A, x, j     ),
+                    -b[j+1UL] - product( A, x, j+1UL ),
+                    -b[j+2UL] - product( A, x, j+2UL ) );
+      return updateBlock( cp, node, r, real(1) );
    }
 
+   residual = -b[j] - product( A, x, j );
+   aux = max( 0, x[j] + diagonal_[j] * residual );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
+   flimit = cp.cof_[node] * x[j];
+
+   ++j;
+   residual = -b[j] - product( A, x, j );
+   aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
+   ++j;
+   residual = -b[j] - product( A, x, j );
+   aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
    return rmax;
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Relaxed projected Jacobi update of a single contact.
+//
+// \param cp The contact complementarity problem to solve.
+// \param node The index of the contact to be updated.
+// \return The maximum change of the three unknowns of the contact.
+*/
+template<>
+inline real PGS::relax( ContactLCP& cp, size_t node ) const
+{
+   real rmax( 0 ), flimit, aux;
+   size_t j( node * 3 );
+
+   VecN& x( cp.x_ );
+
+   if( block_ ) {
+      const Vec3 r( residual_[j], residual_[j+1UL], residual_[j+2UL] );
+      return updateBlock( cp, node, r, omega_ );
+   }
+
+   aux = max( 0, x[j] + omega_ * diagonal_[j] * residual_[j] );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
+   flimit = cp.cof_[node] * x[j];
+
+   ++j;
+   aux = max( -flimit, min( flimit, x[j] + omega_ * diagonal_[j] * residual_[j] ) );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
+   ++j;
+   aux = max( -flimit, min( flimit, x[j] + omega_ * diagonal_[j] * residual_[j] ) );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Precomputes the inverse 3x3 diagonal blocks of a contact LCP.
+//
+// \param cp The contact complementarity problem to solve.
+// \return void
+//
+// In case block updates are enabled, this function computes the inverse of the 3x3 diagonal
+// block of each contact. Singular blocks are replaced by the inverse of their diagonal.
+*/
+template<>
+inline void PGS::setupBlocks( const ContactLCP& cp )
+{
+   if( !block_ )
+      return;
+
+   const CMatMxN& A( cp.A_ );
+   const size_t N( cp.size() / 3UL );
+
+   blockInverses_.resize( N );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      const size_t j( i*3UL );
+      Mat3x3& B( blockInverses_[i] );
+
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t l=0UL; l<3UL; ++l )
+            B(k,l) = A(j+k,j+l);
+
+      const real c00( B(1,1)*B(2,2) - B(1,2)*B(2,1) );
+      const real c01( B(1,2)*B(2,0) - B(1,0)*B(2,2) );
+      const real c02( B(1,0)*B(2,1) - B(1,1)*B(2,0) );
+      const real det( B(0,0)*c00 + B(0,1)*c01 + B(0,2)*c02 );
+
+      if( std::fabs( det ) <= std::numeric_limits<real>::epsilon() * std::fabs( B(0,0)*B(1,1)*B(2,2) ) ) {
+         const Mat3x3 D( B );
+         B.reset();
+         for( size_t k=0UL; k<3UL; ++k )
+            B(k,k) = real(1) / D(k,k);
+         continue;
+      }
+
+      const real idet( real(1) / det );
+      const Mat3x3 C( B );
+
+      B(0,0) = c00 * idet;
+      B(1,0) = c01 * idet;
+      B(2,0) = c02 * idet;
+      B(0,1) = ( C(0,2)*C(2,1) - C(0,1)*C(2,2) ) * idet;
+      B(1,1) = ( C(0,0)*C(2,2) - C(0,2)*C(2,0) ) * idet;
+      B(2,1) = ( C(0,1)*C(2,0) - C(0,0)*C(2,1) ) * idet;
+      B(0,2) = ( C(0,1)*C(1,2) - C(0,2)*C(1,1) ) * idet;
+      B(1,2) = ( C(0,2)*C(1,0) - C(0,0)*C(1,2) ) * idet;
+      B(2,2) = ( C(0,0)*C(1,1) - C(0,1)*C(1,0) ) * idet;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Block update of a single contact.
+//
+// \param cp The contact complementarity problem to solve.
+// \param node The index of the contact to be updated.
+// \param residual The residuals of the three unknowns of the contact.
+// \param omega The relaxation parameter of the update.
+// \return The maximum change of the three unknowns of the contact.
+//
+// The three unknowns of the contact are updated by the inverse diagonal block of the contact.
+// Afterwards the normal unknown is projected to the positive half-space and the two friction
+// unknowns are projected onto the friction cone defined by the updated normal unknown.
+*/
+inline real PGS::updateBlock( ContactLCP& cp, size_t node, const Vec3& residual, real omega ) const
+{
+   const size_t j( node * 3UL );
+   VecN& x( cp.x_ );
+
+   const Vec3 xold( x[j], x[j+1UL], x[j+2UL] );
+   Vec3 xnew( xold + omega * ( blockInverses_[node] * residual ) );
+
+   xnew[0] = max( real(0), xnew[0] );
+
+   const real flimit( cp.cof_[node] * xnew[0] );
+   const real ft( std::sqrt( xnew[1]*xnew[1] + xnew[2]*xnew[2] ) );
+
+   if( ft > flimit ) {
+      const real scale( flimit / ft );
+      xnew[1] *= scale;
+      xnew[2] *= scale;
+   }
+
+   x[j    ] = xnew[0];
+   x[j+1UL] = xnew[1];
+   x[j+2UL] = xnew[2];
+
+   return max( std::fabs( xnew[0] - xold[0] ),
+               std::fabs( xnew[1] - xold[1] ),
+               std::fabs( xnew[2] - xold[2] ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns per contact of a contact complementarity problem.
+//
+// \return The number of unknowns per contact.
+*/
+template<>
+inline size_t PGS::nodeSize<ContactLCP>()
+{
+   return 3UL;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
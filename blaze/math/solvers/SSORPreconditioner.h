@@ -0,0 +1,309 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SSORPreconditioner.h
+//  \brief Header file for the symmetric successive over-relaxation preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The symmetric successive over-relaxation (SSOR) preconditioner.
+// \ingroup preconditioners
+//
+// The SSORPreconditioner class represents the preconditioner
+
+                     \f[ M = \frac{\omega}{2-\omega} (\frac{D}{\omega}+L) (\frac{D}{\omega})^{-1}
+                                                     (\frac{D}{\omega}+L^T), \f]
+
+// where \f$ D \f$ is the diagonal and \f$ L \f$ the strictly lower part of the symmetric system
+// matrix and \f$ \omega \in (0..2) \f$ is the relaxation parameter. The application of the
+// preconditioner consists of one forward and one backward Gauss-Seidel sweep over a row-major
+// copy of the system matrix. For \f$ \omega = 1 \f$ the preconditioner reduces to the symmetric
+// Gauss-Seidel preconditioner.
+*/
+class SSORPreconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SSORPreconditioner( real omega = real(1) );
+
+   template< typename MT, bool SO >
+   explicit inline SSORPreconditioner( const Matrix<MT,SO>& A, real omega = real(1) );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline real getOmega() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setOmega( real omega );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void compute( const Matrix<MT,SO>& A );
+
+   inline size_t size () const;
+   inline void   apply( const VecN& r, VecN& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   real    omega_;  //!< The relaxation parameter \f$ \omega \f$.
+   CMatMxN A_;      //!< Row-major copy of the system matrix.
+   VecN    diag_;   //!< The diagonal elements of the system matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the SSORPreconditioner class.
+//
+// \param omega The relaxation parameter \f$ \omega \in (0..2) \f$.
+// \exception std::invalid_argument Invalid relaxation parameter.
+*/
+inline SSORPreconditioner::SSORPreconditioner( real omega )
+   : omega_( real(1) )  // The relaxation parameter
+   , A_    ()           // Row-major copy of the system matrix
+   , diag_ ()           // The diagonal elements of the system matrix
+{
+   setOmega( omega );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the SSORPreconditioner class.
+//
+// \param A The symmetric system matrix.
+// \param omega The relaxation parameter \f$ \omega \in (0..2) \f$.
+// \exception std::invalid_argument Invalid relaxation parameter.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline SSORPreconditioner::SSORPreconditioner( const Matrix<MT,SO>& A, real omega )
+   : omega_( real(1) )  // The relaxation parameter
+   , A_    ()           // Row-major copy of the system matrix
+   , diag_ ()           // The diagonal elements of the system matrix
+{
+   setOmega( omega );
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the relaxation parameter of the preconditioner.
+//
+// \return The relaxation parameter \f$ \omega \f$.
+*/
+inline real SSORPreconditioner::getOmega() const
+{
+   return omega_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the relaxation parameter of the preconditioner.
+//
+// \param omega The relaxation parameter \f$ \omega \in (0..2) \f$.
+// \return void
+// \exception std::invalid_argument Invalid relaxation parameter.
+*/
+inline void SSORPreconditioner::setOmega( real omega )
+{
+   if( !( omega > real(0) && omega < real(2) ) )
+      throw std::invalid_argument( "Invalid relaxation parameter" );
+
+   omega_ = omega;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given system matrix.
+//
+// \param A The symmetric system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline void SSORPreconditioner::compute( const Matrix<MT,SO>& A )
+{
+   if( (~A).rows() != (~A).columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   A_ = ~A;
+
+   const size_t n( A_.rows() );
+
+   diag_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      diag_[i] = A_(i,i);
+      if( isDefault( diag_[i] ) )
+         throw std::invalid_argument( "Invalid diagonal element in the system matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioner.
+*/
+inline size_t SSORPreconditioner::size() const
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = M^{-1} r \f$).
+//
+// \param r The vector to be preconditioned.
+// \param z The resulting preconditioned vector.
+// \return void
+//
+// The forward sweep solves \f$ (\frac{D}{\omega}+L) y = r \f$, the backward sweep solves
+// \f$ (\frac{D}{\omega}+L^T) z = \frac{2-\omega}{\omega} \frac{D}{\omega} y \f$. Both sweeps
+// operate in-place on \a z.
+*/
+inline void SSORPreconditioner::apply( const VecN& r, VecN& z ) const
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   BLAZE_USER_ASSERT( r.size() == diag_.size(), "Invalid vector size detected" );
+
+   const size_t n( diag_.size() );
+   const real scale( ( real(2) - omega_ ) / omega_ );
+
+   z.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      real tmp( r[i] );
+      for( ConstIterator element=A_.begin(i); element!=A_.end(i) && element->index()<i; ++element ) {
+         tmp -= element->value() * z[element->index()];
+      }
+      z[i] = omega_ * tmp / diag_[i];
+   }
+
+   for( size_t i=n; i>0UL; --i ) {
+      const size_t k( i-1UL );
+      real tmp( scale * diag_[k] * z[k] / omega_ );
+      for( ConstIterator element=A_.end(k); element!=A_.begin(k) && (element-1)->index()>k; --element ) {
+         tmp -= (element-1)->value() * z[(element-1)->index()];
+      }
+      z[k] = omega_ * tmp / diag_[k];
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
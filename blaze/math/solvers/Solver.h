@@ -41,7 +41,9 @@
 //*************************************************************************************************
 
 #include <limits>
+#include <vector>
 #include <blaze/system/Solvers.h>
+#include <blaze/util/Time.h>
 #include <blaze/util/Types.h>
 
 
@@ -77,6 +79,7 @@ class Solver
    inline size_t getLastIterations() const;
    inline real   getLastPrecision()  const;
    inline real   getThreshold()      const;
+   inline bool   getWarmStart()      const;
    //@}
    //**********************************************************************************************
 
@@ -85,10 +88,36 @@ class Solver
    //@{
    inline void   setMaxIterations( size_t maxIterations );
    inline void   setThreshold    ( real threshold );
+   inline void   setWarmStart    ( bool warmStart );
+   //@}
+   //**********************************************************************************************
+
+   //**Statistics functions************************************************************************
+   /*!\name Statistics functions */
+   //@{
+   inline void                       setStatistics     ( bool statistics );
+   inline bool                       getStatistics     () const;
+   inline const std::vector<real>&   getResidualHistory() const;
+   inline const std::vector<double>& getIterationTimes () const;
+   inline double                     getSetupTime      () const;
+   inline double                     getResidualTime   () const;
+   inline double                     getUpdateTime     () const;
    //@}
    //**********************************************************************************************
 
  protected:
+   //**Statistics functions************************************************************************
+   /*!\name Statistics functions */
+   //@{
+   inline double timestamp      () const;
+   inline void   resetStatistics();
+   inline void   recordSetup    ( double start );
+   inline void   recordResidual ( double start );
+   inline void   recordUpdate   ( double start );
+   inline void   recordIteration( double start, real residual );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -98,6 +127,13 @@ class Solver
    size_t lastIterations_;  //!< The number of iterations spent in the last solution process.
    real   lastPrecision_;   //!< The precision of the solution after the solution process.
    real   threshold_;       //!< Precision threshold for the solution.
+   bool   warmStart_;       //!< Flag for the reuse of data cached by previous solution processes.
+   bool   statistics_;      //!< Flag for the recording of convergence statistics.
+   std::vector<real>   residuals_;  //!< The residual after each iteration of the last solution process.
+   std::vector<double> times_;      //!< The wall clock time of each iteration of the last solution process.
+   double setupTime_;       //!< The wall clock time of the setup of the last solution process.
+   double residualTime_;    //!< The wall clock time spent for residual computations.
+   double updateTime_;      //!< The wall clock time spent for updates of the unknowns.
    //@}
    //**********************************************************************************************
 };
@@ -120,6 +156,13 @@ inline Solver::Solver()
    , lastIterations_( 0 )                                 // The number of iterations spent in the last solution process
    , lastPrecision_ ( std::numeric_limits<real>::max() )  // The precision of the solution after the solution process
    , threshold_     ( solvers::threshold )                // Precision threshold for the solution
+   , warmStart_     ( false )                             // Flag for the reuse of cached data
+   , statistics_    ( false )                             // Flag for the recording of convergence statistics
+   , residuals_     ()                                    // The residual after each iteration
+   , times_         ()                                    // The wall clock time of each iteration
+   , setupTime_     ( 0.0 )                               // The wall clock time of the setup
+   , residualTime_  ( 0.0 )                               // The wall clock time spent for residual computations
+   , updateTime_    ( 0.0 )                               // The wall clock time spent for updates of the unknowns
 {}
 //*************************************************************************************************
 
@@ -183,6 +226,18 @@ inline real Solver::getThreshold() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns whether the solver reuses data cached by previous solution processes.
+//
+// \return \a true in case warm starts are enabled, \a false if not.
+*/
+inline bool Solver::getWarmStart() const
+{
+   return warmStart_;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -214,6 +269,217 @@ inline void Solver::setThreshold( real threshold )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Enables or disables the reuse of data cached by previous solution processes.
+//
+// \param warmStart \a true to enable warm starts, \a false to disable them.
+//
+// In case warm starts are enabled, the solver is allowed to use the given solution vector as
+// initial guess and to reuse setup data that only depends on the sparsity pattern of the system
+// matrix (as for instance colorings) computed during the previous solution process as long as
+// the sparsity pattern of the system matrix is unchanged. Setup data depending on the values of
+// the system matrix is recomputed in every solution process.
+*/
+inline void Solver::setWarmStart( bool warmStart )
+{
+   warmStart_ = warmStart;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATISTICS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Enables or disables the recording of convergence statistics.
+//
+// \param statistics \a true to enable the recording of statistics, \a false to disable it.
+//
+// By default, no statistics are recorded and the solvers don't perform any additional timing
+// measurements. In case the recording is enabled, each solution process records the residual
+// and the wall clock time of each iteration as well as the accumulated time spent for the setup,
+// for residual computations and for the updates of the unknowns.
+*/
+inline void Solver::setStatistics( bool statistics )
+{
+   statistics_ = statistics;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the solver records convergence statistics.
+//
+// \return \a true in case statistics are recorded, \a false if not.
+*/
+inline bool Solver::getStatistics() const
+{
+   return statistics_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the residual after each iteration of the last solution process.
+//
+// \return The residual history of the last solution process.
+//
+// The history is only recorded in case statistics are enabled (see setStatistics()).
+*/
+inline const std::vector<real>& Solver::getResidualHistory() const
+{
+   return residuals_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the wall clock time of each iteration of the last solution process.
+//
+// \return The iteration times (in seconds) of the last solution process.
+//
+// The times are only recorded in case statistics are enabled (see setStatistics()).
+*/
+inline const std::vector<double>& Solver::getIterationTimes() const
+{
+   return times_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the wall clock time of the setup of the last solution process.
+//
+// \return The setup time (in seconds) of the last solution process.
+*/
+inline double Solver::getSetupTime() const
+{
+   return setupTime_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the wall clock time spent for residual computations in the last solution process.
+//
+// \return The accumulated residual time (in seconds) of the last solution process.
+*/
+inline double Solver::getResidualTime() const
+{
+   return residualTime_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the wall clock time spent for updates of the unknowns in the last solution process.
+//
+// \return The accumulated update time (in seconds) of the last solution process.
+*/
+inline double Solver::getUpdateTime() const
+{
+   return updateTime_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current wall clock time in case statistics are recorded.
+//
+// \return The current wall clock time or 0 in case no statistics are recorded.
+*/
+inline double Solver::timestamp() const
+{
+   return ( statistics_ )?( getWcTime() ):( 0.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the statistics at the beginning of a solution process.
+//
+// \return void
+*/
+inline void Solver::resetStatistics()
+{
+   residuals_.clear();
+   times_.clear();
+   setupTime_    = 0.0;
+   residualTime_ = 0.0;
+   updateTime_   = 0.0;
+
+   if( statistics_ ) {
+      residuals_.reserve( maxIterations_ );
+      times_.reserve( maxIterations_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the time spent for the setup since the given time stamp.
+//
+// \param start The time stamp at the beginning of the setup.
+// \return void
+*/
+inline void Solver::recordSetup( double start )
+{
+   if( statistics_ )
+      setupTime_ += getWcTime() - start;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the time spent for a residual computation since the given time stamp.
+//
+// \param start The time stamp at the beginning of the residual computation.
+// \return void
+*/
+inline void Solver::recordResidual( double start )
+{
+   if( statistics_ )
+      residualTime_ += getWcTime() - start;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the time spent for an update of the unknowns since the given time stamp.
+//
+// \param start The time stamp at the beginning of the update.
+// \return void
+*/
+inline void Solver::recordUpdate( double start )
+{
+   if( statistics_ )
+      updateTime_ += getWcTime() - start;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the residual and the wall clock time of a single iteration.
+//
+// \param start The time stamp at the beginning of the iteration.
+// \param residual The residual after the iteration.
+// \return void
+*/
+inline void Solver::recordIteration( double start, real residual )
+{
+   if( statistics_ ) {
+      times_.push_back( getWcTime() - start );
+      residuals_.push_back( residual );
+   }
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
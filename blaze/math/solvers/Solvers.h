@@ -68,6 +68,18 @@ namespace solvers {}
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\defgroup preconditioners Preconditioners
+// \ingroup lse_solvers
+//
+// Preconditioners transform a linear system of equations into an equivalent system with more
+// favorable spectral properties in order to accelerate the convergence of iterative solvers.
+// All preconditioners provide the function \c apply( const VecN& r, VecN& z ), which computes
+// \f$ z = M^{-1} r \f$ for the preconditioning matrix \f$ M \f$.
+*/
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\defgroup complementarity_solvers Complementarity System Solvers
 // \ingroup solvers
@@ -0,0 +1,425 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SparseCholesky.h
+//  \brief Header file for the supernodal sparse Cholesky factorization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SPARSECHOLESKY_H_
+#define _BLAZE_MATH_SOLVERS_SPARSECHOLESKY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/reordering/PermutationVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/system/Precision.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal sparse Cholesky factorization of symmetric positive definite matrices.
+// \ingroup lse_solvers
+//
+// The SparseCholesky class computes the factorization \f$ P A P^T = L L^T \f$ of a sparse,
+// symmetric positive definite matrix \f$ A \f$ and solves linear systems with the factorized
+// matrix for an arbitrary number of right-hand sides. In contrast to the iterative solvers the
+// cost of a solve is independent of the condition of the matrix and the factorization can be
+// reused for any number of right-hand sides. The factorization is split into two phases:
+//
+//  - The symbolic analysis (see analyze()) computes the fill reducing permutation \f$ P \f$
+//    (see approximateMinimumDegree()), the elimination tree and the supernodes of the factor.
+//    A supernode is a set of contiguous columns of \f$ L \f$ with an identical pattern below
+//    the diagonal block, which is stored as a dense column-major matrix. Small supernodes are
+//    merged into their parent at the cost of a few explicitly stored zeros.
+//  - The numeric factorization (see factorize()) computes the supernodes in the multifrontal
+//    fashion: The elements of \f$ A \f$ and the update matrices of the child supernodes are
+//    assembled into the supernode, which is then factorized by a blocked dense Cholesky
+//    factorization. The update matrix for the parent is computed by a single dense matrix
+//    multiplication. Supernodes on the same level of the supernodal elimination tree are
+//    independent of each other and are factorized in parallel.
+//
+// The symbolic analysis depends only on the sparsity pattern of the matrix. Therefore a matrix
+// with modified values but an identical sparsity pattern can be refactorized without repeating
+// the analysis:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A;
+   blaze::DynamicVector<double> b, x;
+   blaze::DynamicMatrix<double> B;
+   // ... Initialization
+
+   blaze::SparseCholesky cholesky( A );  // Symbolic analysis and numeric factorization
+
+   cholesky.solve( b, x );  // Computes x = inv(A) * b
+   cholesky.solve( B );     // Computes B = inv(A) * B for all columns of B at once
+
+   // ... Modification of the values of A
+
+   cholesky.factorize( A );  // Numeric refactorization with the previous analysis
+   \endcode
+
+// The forward and backward substitutions traverse the supernodal elimination tree level by
+// level as well, processing all right-hand sides of a supernode by dense matrix multiplications.
+// Therefore solving for several right-hand sides at once is considerably faster than separate
+// solves for each right-hand side.
+*/
+class SparseCholesky
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef DynamicMatrix<real,true>  Supernode;  //!< Type of the dense columns of a supernode.
+   //**********************************************************************************************
+
+   //**Kernels*************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename OP > struct LevelKernel;
+   struct FactorKernel;
+   struct ForwardKernel;
+   struct BackwardKernel;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseCholesky();
+
+   template< typename MT, bool SO, bool NF >
+   explicit inline SparseCholesky( const SymmetricMatrix<MT,SO,false,NF>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Factorization functions*********************************************************************
+   /*!\name Factorization functions */
+   //@{
+   template< typename MT, bool SO, bool NF >
+   inline void analyze( const SymmetricMatrix<MT,SO,false,NF>& A );
+
+   template< typename MT, bool SO, bool NF >
+   inline void factorize( const SymmetricMatrix<MT,SO,false,NF>& A );
+
+   template< typename MT, bool SO, bool NF >
+   inline void compute( const SymmetricMatrix<MT,SO,false,NF>& A );
+
+          void analyze  ( const CMatMxN& A );
+          void factorize( const CMatMxN& A );
+   inline void compute  ( const CMatMxN& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+          void solve( VecN& b ) const;
+   inline void solve( const VecN& b, VecN& x ) const;
+          void solve( MatMxN& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                   size       () const;
+   inline size_t                   nonZeros   () const;
+   inline size_t                   supernodes () const;
+   inline size_t                   levels     () const;
+   inline const PermutationVector& permutation() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename OP >
+   void execute( const OP& op, bool reverse, size_t rhs ) const;
+
+   int  factorizeSupernode( size_t s, const CMatMxN& A, std::vector<Supernode>& updates );
+   void forwardSupernode  ( size_t s, MatMxN& W, std::vector<MatMxN>& updates ) const;
+   void backwardSupernode ( size_t s, MatMxN& W ) const;
+   void relativeIndices   ( size_t s, size_t c, std::vector<size_t>& indices ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                           //!< The size of the factorized matrix.
+   size_t nonZeros_;                    //!< The number of stored elements of the factor.
+   PermutationVector perm_;             //!< The fill reducing permutation.
+   std::vector<size_t> columns_;        //!< The first column of each supernode.
+   std::vector<size_t> rowPtr_;         //!< The offsets of the row indices of each supernode.
+   std::vector<size_t> rows_;           //!< The row indices of all supernodes.
+                                        /*!< The row indices of a supernode start with its
+                                             columns and are sorted in ascending order. */
+   std::vector<size_t> childPtr_;       //!< The offsets of the children of each supernode.
+   std::vector<size_t> children_;       //!< The child supernodes of all supernodes.
+   std::vector<size_t> levelPtr_;       //!< The offsets of the supernodes of each level.
+   std::vector<size_t> schedule_;       //!< The supernodes sorted by level.
+   std::vector<size_t> levelWork_;      //!< The number of stored elements of each level.
+   std::vector<Supernode> factors_;     //!< The dense columns of all supernodes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SparseCholesky class.
+//
+// \param A The sparse symmetric positive definite matrix.
+// \exception std::invalid_argument Cholesky factorization failed.
+//
+// This constructor performs both the symbolic analysis and the numeric factorization of the
+// given matrix. In case the matrix is not positive definite, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT  // Type of the adapted sparse matrix
+        , bool SO      // Storage order of the adapted sparse matrix
+        , bool NF >    // Numeric flag
+inline SparseCholesky::SparseCholesky( const SymmetricMatrix<MT,SO,false,NF>& A )
+   : n_        ( 0UL )       // The size of the factorized matrix
+   , nonZeros_ ( 0UL )       // The number of stored elements of the factor
+   , perm_     ()            // The fill reducing permutation
+   , columns_  ( 1UL, 0UL )  // The first column of each supernode
+   , rowPtr_   ()            // The offsets of the row indices of each supernode
+   , rows_     ()            // The row indices of all supernodes
+   , childPtr_ ()            // The offsets of the children of each supernode
+   , children_ ()            // The child supernodes of all supernodes
+   , levelPtr_ ( 1UL, 0UL )  // The offsets of the supernodes of each level
+   , schedule_ ()            // The supernodes sorted by level
+   , levelWork_()            // The number of stored elements of each level
+   , factors_  ()            // The dense columns of all supernodes
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FACTORIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the symbolic analysis of the given sparse symmetric matrix.
+//
+// \param A The sparse symmetric matrix.
+// \return void
+//
+// This function converts the given matrix to a row-major compressed matrix and computes the
+// fill reducing permutation and the supernodal structure of the factor of the converted matrix.
+*/
+template< typename MT  // Type of the adapted sparse matrix
+        , bool SO      // Storage order of the adapted sparse matrix
+        , bool NF >    // Numeric flag
+inline void SparseCholesky::analyze( const SymmetricMatrix<MT,SO,false,NF>& A )
+{
+   analyze( CMatMxN( A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the numeric factorization of the given sparse symmetric matrix.
+//
+// \param A The sparse symmetric positive definite matrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+// \exception std::invalid_argument Invalid sparsity pattern.
+// \exception std::invalid_argument Cholesky factorization failed.
+//
+// This function converts the given matrix to a row-major compressed matrix and computes the
+// numeric factorization of the converted matrix based on the previous symbolic analysis.
+*/
+template< typename MT  // Type of the adapted sparse matrix
+        , bool SO      // Storage order of the adapted sparse matrix
+        , bool NF >    // Numeric flag
+inline void SparseCholesky::factorize( const SymmetricMatrix<MT,SO,false,NF>& A )
+{
+   factorize( CMatMxN( A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the symbolic analysis and the numeric factorization of the given matrix.
+//
+// \param A The sparse symmetric positive definite matrix.
+// \return void
+// \exception std::invalid_argument Cholesky factorization failed.
+*/
+template< typename MT  // Type of the adapted sparse matrix
+        , bool SO      // Storage order of the adapted sparse matrix
+        , bool NF >    // Numeric flag
+inline void SparseCholesky::compute( const SymmetricMatrix<MT,SO,false,NF>& A )
+{
+   compute( CMatMxN( A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the symbolic analysis and the numeric factorization of the given matrix.
+//
+// \param A The row-major symmetric positive definite matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Cholesky factorization failed.
+*/
+inline void SparseCholesky::compute( const CMatMxN& A )
+{
+   analyze( A );
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the factorized linear system for the given right-hand side (\f$ x = A^{-1} b \f$).
+//
+// \param b The right-hand side vector.
+// \param x The resulting solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+inline void SparseCholesky::solve( const VecN& b, VecN& x ) const
+{
+   x = b;
+   solve( x );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the factorized matrix.
+//
+// \return The number of rows and columns of the factorized matrix.
+*/
+inline size_t SparseCholesky::size() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the Cholesky factor.
+//
+// \return The number of stored elements of \f$ L \f$ including the explicit zeros of supernodes.
+*/
+inline size_t SparseCholesky::nonZeros() const
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes of the Cholesky factor.
+//
+// \return The number of supernodes.
+*/
+inline size_t SparseCholesky::supernodes() const
+{
+   return columns_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of the supernodal elimination tree.
+//
+// \return The number of levels.
+*/
+inline size_t SparseCholesky::levels() const
+{
+   return levelPtr_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill reducing permutation of the factorization.
+//
+// \return The new-to-old mapping of the permutation \f$ P \f$.
+*/
+inline const PermutationVector& SparseCholesky::permutation() const
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,11 +44,20 @@ namespace blaze {
 //
 //=================================================================================================
 
+class BasisFactorization;
+template< typename > class BatchSolver;
 class CG;
 class CPG;
 class GaussianElimination;
+class IC0Preconditioner;
+class IdentityPreconditioner;
+class ILU0Preconditioner;
+class ILUTPreconditioner;
+class JacobiPreconditioner;
 class Lemke;
 class PGS;
+class SparseCholesky;
+class SSORPreconditioner;
 
 } // namespace blaze
 
@@ -0,0 +1,1857 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a block-compressed row sparse matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/SameSize.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a block-compressed row (BSR) sparse matrix.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is the representation of an arbitrary sized sparse
+// matrix whose non-zero elements are clustered in small, dense blocks of fixed size. Typical
+// examples are the system matrices of contact problems and finite element discretizations,
+// where each unknown is a 3D or 6D quantity. The type and size of the blocks is specified via
+// a single template argument, which has to be an instance of the StaticMatrix class template:
+
+   \code
+   template< typename Type, size_t M, size_t N, bool SO >
+   class BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can only be used
+//          with numeric element types.
+//  - M   : specifies the number of rows of each block.
+//  - N   : specifies the number of columns of each block.
+//  - SO  : specifies the storage order of the individual blocks.
+//
+// The blocks are stored in a block-wise compressed row format. In contrast to the CompressedMatrix
+// class template, which stores one index per non-zero element, the BlockCompressedMatrix stores
+// a single column index per \f$ M \times N \f$ block. This reduces the index memory by a factor
+// of up to \f$ M \cdot N \f$ and enables register-blocked, vectorized kernels for the sparse
+// matrix/dense vector and sparse matrix/dense matrix multiplication. Both multiplications are
+// executed in parallel in case a shared memory parallelization is active.
+//
+// The block structure is set up via the reserve(), append() and finalize() functions or by a
+// conversion from an arbitrary scalar sparse matrix whose dimensions are multiples of the block
+// size. All size related arguments of the block access functions are given in terms of blocks,
+// whereas the scalar access functions inherited from the SparseMatrix interface (rows(),
+// columns(), the function call operator and the row iterators) operate on the scalar elements.
+// Therefore a BlockCompressedMatrix can be used as a row-major sparse matrix in any expression
+// that doesn't modify the matrix. The result type of all such expressions is the according
+// CompressedMatrix:
+
+   \code
+   using blaze::StaticMatrix;
+   using blaze::BlockCompressedMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   typedef StaticMatrix<double,3UL,3UL>  Block;
+
+   // Setup of a 2x2 block matrix (i.e. a 6x6 scalar matrix) with three non-zero blocks
+   BlockCompressedMatrix<Block> A( 2UL, 2UL, 3UL );
+   A.append( 0UL, 0UL, Block( 4.0, 1.0, 0.0, 1.0, 4.0, 1.0, 0.0, 1.0, 4.0 ) );
+   A.append( 0UL, 1UL, Block( 1.0 ) );
+   A.finalize( 0UL );
+   A.append( 1UL, 1UL, Block( 2.0 ) );
+   A.finalize( 1UL );
+
+   DynamicVector<double> x( 6UL, 1.0 ), y;
+   y = A * x;  // Block sparse matrix/dense vector multiplication
+
+   CompressedMatrix<double> B( A );           // Conversion to a scalar sparse matrix
+   BlockCompressedMatrix<Block> C( B * B );   // Conversion from a scalar sparse matrix
+   \endcode
+*/
+template< typename BT >  // Type of the blocks
+class BlockCompressedMatrix;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of BlockCompressedMatrix for StaticMatrix blocks.
+// \ingroup block_compressed_matrix
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+class BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >
+   : public SparseMatrix< BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticMatrix<Type,M,N,SO>  BlockType;  //!< Type of the dense blocks.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<BlockType>  ElementBase;  //!< Base class for the block elements.
+   //**********************************************************************************************
+
+   //**Private class Element***********************************************************************
+   /*!\brief Value-index-pair for the blocks of the BlockCompressedMatrix class.
+   */
+   struct Element : public ElementBase
+   {
+      // This operator is required due to a bug in all versions of the the MSVC compiler.
+      // A simple 'using ElementBase::operator=;' statement results in ambiguity problems.
+      template< typename Other >
+      inline Element& operator=( const Other& rhs )
+      {
+         ElementBase::operator=( rhs );
+         return *this;
+      }
+
+      friend class BlockCompressedMatrix;
+   };
+   //**********************************************************************************************
+
+   //**Private class FindIndex*********************************************************************
+   /*!\brief Helper class for the lower_bound() function.
+   */
+   struct FindIndex : public std::binary_function<Element,size_t,bool>
+   {
+      inline bool operator()( const Element& element, size_t index ) const {
+         return element.index() < index;
+      }
+      inline bool operator()( size_t index, const Element& element ) const {
+         return index < element.index();
+      }
+      inline bool operator()( const Element& element1, const Element& element2 ) const {
+         return element1.index() < element2.index();
+      }
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<BlockType>  This;                //!< Type of this BlockCompressedMatrix instance.
+   typedef CompressedMatrix<Type,rowMajor>   ResultType;          //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  OppositeType;      //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  TransposeType;     //!< Transpose type for expression template evaluations.
+   typedef Type                              ElementType;         //!< Type of the sparse matrix elements.
+   typedef const Type&                       ReturnType;          //!< Return type for expression template evaluations.
+   typedef const This&                       CompositeType;       //!< Data type for composite expression templates.
+   typedef const Type&                       ConstReference;      //!< Reference to a constant sparse matrix value.
+   typedef Element*                          BlockIterator;       //!< Iterator over non-constant blocks.
+   typedef const Element*                    ConstBlockIterator;  //!< Iterator over constant blocks.
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the scalar elements of a single row of the block-compressed matrix.
+   //
+   // The ConstIterator class provides the scalar view on a single row of the block-compressed
+   // matrix that is required by the SparseMatrix interface. It traverses all elements of the
+   // according row of all non-zero blocks in the according block row.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef ValueIndexPair<Type>  Element;  //!< Element type of the sparse matrix.
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying pointers.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying pointers.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param block Iterator to the current block.
+      // \param row The row of the current block.
+      */
+      inline ConstIterator( ConstBlockIterator block, size_t row )
+         : block_ ( block )  // Iterator to the current block
+         , row_   ( row   )  // The row of the current block
+         , column_( 0UL   )  // The column of the current block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         if( ++column_ == N ) {
+            column_ = 0UL;
+            ++block_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( value(), index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ReturnType value() const {
+         return block_->value()(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return block_->index()*N + column_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return ( block_ == rhs.block_ ) && ( column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( block_ - rhs.block_ ) * DifferenceType( N ) +
+                DifferenceType( column_ ) - DifferenceType( rhs.column_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ConstBlockIterator block_;   //!< Iterator to the current block.
+      size_t             row_;     //!< The row of the current block.
+      size_t             column_;  //!< The column of the current block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The block-compressed matrix cannot be used as target of SMP assignments. However, the
+       block-compressed matrix/dense vector and matrix/dense matrix multiplications are
+       executed in parallel via their own evaluation strategy. */
+   enum { smpAssignable = 0 };
+
+   //! Number of rows of the dense blocks.
+   enum { rowsPerBlock = M };
+
+   //! Number of columns of the dense blocks.
+   enum { columnsPerBlock = N };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline BlockCompressedMatrix();
+                            explicit inline BlockCompressedMatrix( size_t m, size_t n );
+                            explicit inline BlockCompressedMatrix( size_t m, size_t n, size_t nonzeros );
+                                     inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+   template< typename MT, bool SO2 > inline BlockCompressedMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference     operator()( size_t i, size_t j ) const;
+   inline ConstIterator      begin     ( size_t i ) const;
+   inline ConstIterator      cbegin    ( size_t i ) const;
+   inline ConstIterator      end       ( size_t i ) const;
+   inline ConstIterator      cend      ( size_t i ) const;
+   inline BlockIterator      blockBegin( size_t i );
+   inline ConstBlockIterator blockBegin( size_t i ) const;
+   inline BlockIterator      blockEnd  ( size_t i );
+   inline ConstBlockIterator blockEnd  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   template< typename MT, bool SO2 > inline BlockCompressedMatrix& operator=( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t        rows() const;
+   inline size_t        columns() const;
+   inline size_t        blockRows() const;
+   inline size_t        blockColumns() const;
+   inline size_t        capacity() const;
+   inline size_t        nonZeros() const;
+   inline size_t        nonZeros( size_t i ) const;
+   inline size_t        nonZeroBlocks() const;
+   inline size_t        nonZeroBlocks( size_t i ) const;
+   inline void          reset();
+   inline void          clear();
+   inline BlockIterator insert ( size_t i, size_t j, const BlockType& block );
+   inline void          reserve( size_t nonzeros );
+   inline void          swap( BlockCompressedMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline BlockIterator      find      ( size_t i, size_t j );
+   inline ConstBlockIterator find      ( size_t i, size_t j ) const;
+   inline BlockIterator      lowerBound( size_t i, size_t j );
+   inline ConstBlockIterator lowerBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const BlockType& block );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                          BlockIterator insert( BlockIterator pos, size_t i, size_t j, const BlockType& block );
+   inline size_t          extendCapacity() const;
+                          void          reserveElements( size_t nonzeros );
+   template< typename MT > void         convert( const SparseMatrix<MT,rowMajor>& sm );
+   template< typename MT > void         convert( const SparseMatrix<MT,columnMajor>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;              //!< The current number of block rows of the sparse matrix.
+   size_t n_;              //!< The current number of block columns of the sparse matrix.
+   size_t capacity_;       //!< The current capacity of the pointer array.
+   BlockIterator* begin_;  //!< Pointers to the first non-zero block of each block row.
+   BlockIterator* end_;    //!< Pointers one past the last non-zero block of each block row.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE ( ElementBase, Element );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, size_t M, size_t N, bool SO >
+const Type BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::zero_ = Type();
+/*! \endcond */
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockCompressedMatrix()
+   : m_       ( 0UL )                // The current number of block rows of the sparse matrix
+   , n_       ( 0UL )                // The current number of block columns of the sparse matrix
+   , capacity_( 0UL )                // The current capacity of the pointer array
+   , begin_( new BlockIterator[2] )  // Pointers to the first non-zero block of each block row
+   , end_  ( begin_+1 )              // Pointers one past the last non-zero block of each block row
+{
+   begin_[0] = end_[0] = NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of \f$ m \times n \f$ blocks.
+//
+// \param m The number of block rows of the matrix.
+// \param n The number of block columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity. Note that the scalar
+// size of the matrix is \f$ (m \cdot M) \times (n \cdot N) \f$.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockCompressedMatrix( size_t m, size_t n )
+   : m_       ( m )                          // The current number of block rows of the sparse matrix
+   , n_       ( n )                          // The current number of block columns of the sparse matrix
+   , capacity_( m )                          // The current capacity of the pointer array
+   , begin_( new BlockIterator[2UL*m+2UL] )  // Pointers to the first non-zero block of each block row
+   , end_  ( begin_+(m+1UL) )                // Pointers one past the last non-zero block of each block row
+{
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of \f$ m \times n \f$ blocks.
+//
+// \param m The number of block rows of the matrix.
+// \param n The number of block columns of the matrix.
+// \param nonzeros The number of expected non-zero blocks.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockCompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( m )                          // The current number of block rows of the sparse matrix
+   , n_       ( n )                          // The current number of block columns of the sparse matrix
+   , capacity_( m )                          // The current capacity of the pointer array
+   , begin_( new BlockIterator[2UL*m+2UL] )  // Pointers to the first non-zero block of each block row
+   , end_  ( begin_+(m+1UL) )                // Pointers one past the last non-zero block of each block row
+{
+   begin_[0UL] = allocate<Element>( nonzeros );
+   for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
+      begin_[i] = begin_[0UL];
+   end_[m_] = begin_[0UL]+nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Block-compressed matrix to be copied.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : m_       ( sm.m_ )                          // The current number of block rows of the sparse matrix
+   , n_       ( sm.n_ )                          // The current number of block columns of the sparse matrix
+   , capacity_( sm.m_ )                          // The current capacity of the pointer array
+   , begin_   ( new BlockIterator[2UL*m_+2UL] )  // Pointers to the first non-zero block of each block row
+   , end_     ( begin_+(m_+1UL) )                // Pointers one past the last non-zero block of each block row
+{
+   const size_t nonzeros( sm.nonZeroBlocks() );
+
+   begin_[0UL] = allocate<Element>( nonzeros );
+   for( size_t i=0UL; i<m_; ++i )
+      begin_[i+1UL] = end_[i] = std::copy( sm.begin_[i], sm.end_[i], begin_[i] );
+   end_[m_] = begin_[0UL]+nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from scalar sparse matrices.
+//
+// \param sm Sparse matrix to be converted.
+// \exception std::invalid_argument Matrix sizes are not multiples of the block size.
+//
+// This constructor converts the given scalar sparse matrix into block-compressed storage. Each
+// block that contains at least one non-zero element of the given matrix is stored as a dense
+// block. In case the number of rows of the given matrix is not a multiple of \a M or the number
+// of columns is not a multiple of \a N, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockCompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( 0UL  )  // The current number of block rows of the sparse matrix
+   , n_       ( 0UL  )  // The current number of block columns of the sparse matrix
+   , capacity_( 0UL  )  // The current capacity of the pointer array
+   , begin_   ( NULL )  // Pointers to the first non-zero block of each block row
+   , end_     ( NULL )  // Pointers one past the last non-zero block of each block row
+{
+   if( (~sm).rows() % M != 0UL || (~sm).columns() % N != 0UL )
+      throw std::invalid_argument( "Matrix sizes are not multiples of the block size" );
+
+   m_        = (~sm).rows() / M;
+   n_        = (~sm).columns() / N;
+   capacity_ = m_;
+   begin_    = new BlockIterator[2UL*m_+2UL];
+   end_      = begin_+(m_+1UL);
+
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = NULL;
+
+   convert( ~sm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::~BlockCompressedMatrix()
+{
+   deallocate( begin_[0UL] );
+   delete [] begin_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the scalar elements of the block-compressed matrix.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M \cdot m-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N \cdot n-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstReference
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstBlockIterator pos( find( i/M, j/N ) );
+
+   if( pos == end_[i/M] )
+      return zero_;
+   else
+      return pos->value()(i%M,j%N);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first scalar element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first scalar element of row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return ConstIterator( begin_[i/M], i%M );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first scalar element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first scalar element of row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return ConstIterator( begin_[i/M], i%M );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last scalar element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last scalar element of row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return ConstIterator( end_[i/M], i%M );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last scalar element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last scalar element of row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return ConstIterator( end_[i/M], i%M );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator to the first non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::blockBegin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index" );
+   return begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator to the first non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstBlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::blockBegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index" );
+   return begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator just past the last non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::blockEnd( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index" );
+   return end_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator just past the last non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstBlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::blockEnd( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index" );
+   return end_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Block-compressed matrix to be copied.
+// \return Reference to the assigned block-compressed matrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >&
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   const size_t nonzeros( rhs.nonZeroBlocks() );
+
+   if( rhs.m_ > capacity_ || nonzeros > capacity() )
+   {
+      BlockIterator* newBegin( new BlockIterator[2UL*rhs.m_+2UL] );
+      BlockIterator* newEnd  ( newBegin+(rhs.m_+1UL) );
+
+      newBegin[0UL] = allocate<Element>( nonzeros );
+      for( size_t i=0UL; i<rhs.m_; ++i ) {
+         newBegin[i+1UL] = newEnd[i] = std::copy( rhs.begin_[i], rhs.end_[i], newBegin[i] );
+      }
+      newEnd[rhs.m_] = newBegin[0UL]+nonzeros;
+
+      std::swap( begin_, newBegin );
+      end_ = newEnd;
+      deallocate( newBegin[0UL] );
+      delete [] newBegin;
+      capacity_ = rhs.m_;
+   }
+   else {
+      for( size_t i=0UL; i<rhs.m_; ++i ) {
+         begin_[i+1UL] = end_[i] = std::copy( rhs.begin_[i], rhs.end_[i], begin_[i] );
+      }
+   }
+
+   m_ = rhs.m_;
+   n_ = rhs.n_;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for scalar sparse matrices.
+//
+// \param rhs Sparse matrix to be converted and assigned.
+// \return Reference to the assigned block-compressed matrix.
+// \exception std::invalid_argument Matrix sizes are not multiples of the block size.
+//
+// The given sparse matrix is converted into block-compressed storage. In case the number of rows
+// of the given matrix is not a multiple of \a M or the number of columns is not a multiple of
+// \a N, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >&
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of scalar rows of the block-compressed matrix.
+//
+// \return The number of scalar rows of the block-compressed matrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::rows() const
+{
+   return m_*M;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of scalar columns of the block-compressed matrix.
+//
+// \return The number of scalar columns of the block-compressed matrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::columns() const
+{
+   return n_*N;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of block rows of the block-compressed matrix.
+//
+// \return The number of block rows of the block-compressed matrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::blockRows() const
+{
+   return m_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of block columns of the block-compressed matrix.
+//
+// \return The number of block columns of the block-compressed matrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::blockColumns() const
+{
+   return n_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum number of blocks of the block-compressed matrix.
+//
+// \return The capacity of the block-compressed matrix in terms of blocks.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::capacity() const
+{
+   return end_[m_] - begin_[0UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of stored scalar elements in the block-compressed matrix.
+//
+// \return The number of stored scalar elements.
+//
+// Note that all elements of the stored blocks are counted, including explicit zeros.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::nonZeros() const
+{
+   return nonZeroBlocks()*M*N;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of stored scalar elements in the specified row.
+//
+// \param i The index of the scalar row.
+// \return The number of stored scalar elements of row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return nonZeroBlocks( i/M )*N;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero blocks in the block-compressed matrix.
+//
+// \return The number of non-zero blocks.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::nonZeroBlocks() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+      nonzeros += nonZeroBlocks( i );
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero blocks in the specified block row.
+//
+// \param i The index of the block row.
+// \return The number of non-zero blocks of block row \a i.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::nonZeroBlocks( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index" );
+   return end_[i] - begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all blocks but preserves the size and the capacity of the matrix.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::reset()
+{
+   for( size_t i=0UL; i<m_; ++i )
+      end_[i] = begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Clearing the block-compressed matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the block-compressed matrix is 0.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::clear()
+{
+   end_[0UL] = end_[m_];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inserting a block into the block-compressed matrix.
+//
+// \param i The block row index of the new block. The index has to be in the range \f$[0..m-1]\f$.
+// \param j The block column index of the new block. The index has to be in the range \f$[0..n-1]\f$.
+// \param block The new block to be inserted.
+// \return Iterator to the newly inserted block.
+// \exception std::invalid_argument Invalid block-compressed matrix access index.
+//
+// This function inserts a new block into the block-compressed matrix. However, duplicate blocks
+// are not allowed. In case the matrix already contains a block at block row \a i and block
+// column \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::insert( size_t i, size_t j, const BlockType& block )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid block column access index" );
+
+   const BlockIterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[i] && pos->index_ == j )
+      throw std::invalid_argument( "Bad access index" );
+
+   return insert( pos, i, j, block );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inserting a block into the block-compressed matrix.
+//
+// \param pos The position of the new block.
+// \param i The block row index of the new block.
+// \param j The block column index of the new block.
+// \param block The new block to be inserted.
+// \return Iterator to the newly inserted block.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::insert( BlockIterator pos, size_t i, size_t j, const BlockType& block )
+{
+   if( begin_[i+1UL] - end_[i] != 0 ) {
+      std::copy_backward( pos, end_[i], end_[i]+1 );
+      pos->value_ = block;
+      pos->index_ = j;
+      ++end_[i];
+
+      return pos;
+   }
+   else if( end_[m_] - begin_[m_] != 0 ) {
+      std::copy_backward( pos, end_[m_-1UL], end_[m_-1UL]+1 );
+
+      pos->value_ = block;
+      pos->index_ = j;
+
+      for( size_t k=i+1UL; k<m_+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+
+      return pos;
+   }
+   else {
+      size_t newCapacity( extendCapacity() );
+
+      BlockIterator* newBegin = new BlockIterator[2UL*capacity_+2UL];
+      BlockIterator* newEnd   = newBegin+capacity_+1UL;
+
+      newBegin[0UL] = allocate<Element>( newCapacity );
+
+      for( size_t k=0UL; k<i; ++k ) {
+         const size_t nonzeros( end_[k] - begin_[k] );
+         const size_t total( begin_[k+1UL] - begin_[k] );
+         newEnd  [k]     = newBegin[k] + nonzeros;
+         newBegin[k+1UL] = newBegin[k] + total;
+      }
+      newEnd  [i]     = newBegin[i] + ( end_[i] - begin_[i] ) + 1;
+      newBegin[i+1UL] = newBegin[i] + ( begin_[i+1] - begin_[i] ) + 1;
+      for( size_t k=i+1UL; k<m_; ++k ) {
+         const size_t nonzeros( end_[k] - begin_[k] );
+         const size_t total( begin_[k+1UL] - begin_[k] );
+         newEnd  [k]     = newBegin[k] + nonzeros;
+         newBegin[k+1UL] = newBegin[k] + total;
+      }
+
+      newEnd[m_] = newEnd[capacity_] = newBegin[0UL]+newCapacity;
+
+      BlockIterator tmp = std::copy( begin_[0UL], pos, newBegin[0UL] );
+      tmp->value_ = block;
+      tmp->index_ = j;
+      std::copy( pos, end_[m_-1UL], tmp+1UL );
+
+      std::swap( newBegin, begin_ );
+      end_ = newEnd;
+      deallocate( newBegin[0UL] );
+      delete [] newBegin;
+
+      return tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacity of the block-compressed matrix.
+//
+// \param nonzeros The new minimum capacity in terms of blocks.
+// \return void
+//
+// This function increases the capacity of the block-compressed matrix to at least \a nonzeros
+// blocks. The current values of the matrix blocks and the individual capacities of the block
+// rows are preserved.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swapping the contents of two block-compressed matrices.
+//
+// \param sm The block-compressed matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::swap( BlockCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( end_  , sm.end_   );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating a new block-compressed matrix capacity.
+//
+// \return The new block-compressed matrix capacity.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline size_t BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::extendCapacity() const
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reserving the specified number of blocks for the block-compressed matrix.
+//
+// \param nonzeros The number of blocks to be reserved.
+// \return void
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::reserveElements( size_t nonzeros )
+{
+   BlockIterator* newBegin = new BlockIterator[2UL*capacity_+2UL];
+   BlockIterator* newEnd   = newBegin+capacity_+1UL;
+
+   newBegin[0UL] = allocate<Element>( nonzeros );
+
+   for( size_t k=0UL; k<m_; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row pointers" );
+      newEnd  [k]     = std::copy( begin_[k], end_[k], newBegin[k] );
+      newBegin[k+1UL] = newBegin[k] + ( begin_[k+1UL] - begin_[k] );
+   }
+
+   newEnd[m_] = newBegin[0UL]+nonzeros;
+
+   std::swap( newBegin, begin_ );
+   deallocate( newBegin[0UL] );
+   delete [] newBegin;
+   end_ = newEnd;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of a row-major scalar sparse matrix into block-compressed storage.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+//
+// This function converts the given row-major sparse matrix into block-compressed storage. In
+// a first pass the number of non-zero blocks per block row is determined, which enables an
+// exact allocation. In a second pass the blocks are created in ascending order of their block
+// column indices and the scalar elements are scattered into the blocks.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+template< typename MT >  // Type of the row-major sparse matrix
+void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::convert( const SparseMatrix<MT,rowMajor>& sm )
+{
+   typedef typename MT::CompositeType                               CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  RhsIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix operand
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == m_*M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( A.columns() == n_*N, "Invalid number of columns" );
+
+   const size_t invalid( size_t(-1) );
+
+   std::vector<size_t> marker( n_, invalid );
+   std::vector<size_t> positions( n_, 0UL );
+   std::vector<size_t> indices;
+
+   // Counting the number of non-zero blocks per block row
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t k=i*M; k<(i+1UL)*M; ++k ) {
+         for( RhsIterator element=A.begin(k); element!=A.end(k); ++element ) {
+            const size_t j( element->index() / N );
+            if( marker[j] != i ) {
+               marker[j] = i;
+               ++nonzeros;
+            }
+         }
+      }
+   }
+
+   begin_[0UL] = end_[0UL] = allocate<Element>( nonzeros );
+   end_[m_] = begin_[0UL]+nonzeros;
+
+   std::fill( marker.begin(), marker.end(), invalid );
+
+   // Creating the blocks and scattering the scalar elements
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      indices.clear();
+
+      for( size_t k=i*M; k<(i+1UL)*M; ++k ) {
+         for( RhsIterator element=A.begin(k); element!=A.end(k); ++element ) {
+            const size_t j( element->index() / N );
+            if( marker[j] != i ) {
+               marker[j] = i;
+               indices.push_back( j );
+            }
+         }
+      }
+
+      std::sort( indices.begin(), indices.end() );
+
+      for( size_t l=0UL; l<indices.size(); ++l ) {
+         positions[indices[l]] = l;
+         end_[i]->value_.reset();
+         end_[i]->index_ = indices[l];
+         ++end_[i];
+      }
+
+      for( size_t k=i*M; k<(i+1UL)*M; ++k ) {
+         for( RhsIterator element=A.begin(k); element!=A.end(k); ++element ) {
+            const size_t j( element->index() );
+            begin_[i][positions[j/N]].value_(k-i*M,j%N) = element->value();
+         }
+      }
+
+      finalize( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of a column-major scalar sparse matrix into block-compressed storage.
+//
+// \param sm The column-major sparse matrix to be converted.
+// \return void
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+template< typename MT >  // Type of the column-major sparse matrix
+void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::convert( const SparseMatrix<MT,columnMajor>& sm )
+{
+   const CompressedMatrix<Type,rowMajor> tmp( ~sm );
+   convert( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches for a specific block in the block-compressed matrix.
+//
+// \param i The block row index of the search block. The index has to be in the range \f$[0..m-1]\f$.
+// \param j The block column index of the search block. The index has to be in the range \f$[0..n-1]\f$.
+// \return Iterator to the block in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::find( size_t i, size_t j )
+{
+   return const_cast<BlockIterator>( const_cast<const This&>( *this ).find( i, j ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches for a specific block in the block-compressed matrix.
+//
+// \param i The block row index of the search block. The index has to be in the range \f$[0..m-1]\f$.
+// \param j The block column index of the search block. The index has to be in the range \f$[0..n-1]\f$.
+// \return Iterator to the block in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstBlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::find( size_t i, size_t j ) const
+{
+   const ConstBlockIterator pos( lowerBound( i, j ) );
+   if( pos != end_[i] && pos->index_ == j )
+      return pos;
+   else return end_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first block with a block column index not less then the
+//        given column index.
+//
+// \param i The block row index of the search block. The index has to be in the range \f$[0..m-1]\f$.
+// \param j The block column index of the search block. The index has to be in the range \f$[0..n-1]\f$.
+// \return Iterator to the first block with a block column index not less then the given index.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::BlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::lowerBound( size_t i, size_t j )
+{
+   return const_cast<BlockIterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first block with a block column index not less then the
+//        given column index.
+//
+// \param i The block row index of the search block. The index has to be in the range \f$[0..m-1]\f$.
+// \param j The block column index of the search block. The index has to be in the range \f$[0..n-1]\f$.
+// \return Iterator to the first block with a block column index not less then the given index.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline typename BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::ConstBlockIterator
+   BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid block column access index" );
+   return std::lower_bound( begin_[i], end_[i], j, FindIndex() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appending a block to the specified block row of the block-compressed matrix.
+//
+// \param i The block row index of the new block. The index has to be in the range \f$[0..m-1]\f$.
+// \param j The block column index of the new block. The index has to be in the range \f$[0..n-1]\f$.
+// \param block The new block to be appended.
+// \return void
+//
+// This function provides a very efficient way to fill a block-compressed matrix with blocks. It
+// appends a new block to the end of the specified block row without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new block must be strictly larger than the largest index of non-zero
+//    blocks in the specified block row of the block-compressed matrix
+//  - the current number of non-zero blocks in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! Note that the finalize()
+// function has to be explicitly called for each block row, even for empty ones!
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::append( size_t i, size_t j, const BlockType& block )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid block column access index" );
+   BLAZE_USER_ASSERT( end_[i] < end_[m_], "Not enough reserved space left" );
+   BLAZE_USER_ASSERT( begin_[i] == end_[i] || j > ( end_[i]-1UL )->index_, "Index is not strictly increasing" );
+
+   end_[i]->value_ = block;
+   end_[i]->index_ = j;
+   ++end_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Finalizing the block insertion of a block row.
+//
+// \param i The index of the block row to be finalized \f$[0..m-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill the matrix with blocks.
+// After completion of block row \a i via the append() function, this function can be called to
+// finalize block row \a i and prepare the next block row for insertion process via append().
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline void BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block row access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != m_-1UL )
+      end_[i+1UL] = end_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type    // Data type of the blocks
+        , size_t M         // Number of rows of the blocks
+        , size_t N         // Number of columns of the blocks
+        , bool SO >        // Storage order of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type    // Data type of the blocks
+        , size_t M         // Number of rows of the blocks
+        , size_t N         // Number of columns of the blocks
+        , bool SO >        // Storage order of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false; block-compressed matrices are not SMP-assignable.
+*/
+template< typename Type  // Data type of the blocks
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , bool SO >      // Storage order of the blocks
+inline bool BlockCompressedMatrix< StaticMatrix<Type,M,N,SO> >::canSMPAssign() const
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename BT >
+inline void reset( BlockCompressedMatrix<BT>& m );
+
+template< typename BT >
+inline void clear( BlockCompressedMatrix<BT>& m );
+
+template< typename BT >
+inline void swap( BlockCompressedMatrix<BT>& a, BlockCompressedMatrix<BT>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block-compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The block-compressed matrix to be resetted.
+// \return void
+*/
+template< typename BT >  // Type of the blocks
+inline void reset( BlockCompressedMatrix<BT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block-compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The block-compressed matrix to be cleared.
+// \return void
+*/
+template< typename BT >  // Type of the blocks
+inline void clear( BlockCompressedMatrix<BT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block-compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename BT >  // Type of the blocks
+inline void swap( BlockCompressedMatrix<BT>& a, BlockCompressedMatrix<BT>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,6 +44,8 @@
 #include <functional>
 #include <stdexcept>
 #include <vector>
+#include <boost/atomic.hpp>
+#include <boost/thread/mutex.hpp>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
@@ -51,6 +53,10 @@
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
@@ -61,9 +67,11 @@
 #include <blaze/math/traits/RowTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasColumnIndex.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/CacheSize.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -248,6 +256,119 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Private class ConversionCount***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Counting pass of the storage order conversion.
+   //
+   // This functor counts the number of non-zero elements per row of the row-major target
+   // matrix for a range of blocks of columns of the column-major source matrix. The counts of
+   // block \a b are stored in the range \f$[b \cdot M .. (b+1) \cdot M)\f$ of the given array.
+   */
+   template< typename MT >  // Type of the column-major source matrix
+   struct ConversionCount
+   {
+      inline ConversionCount( const MT& rhs, size_t blockSize, size_t* counts )
+         : rhs_      ( rhs       )  // The column-major source matrix
+         , blockSize_( blockSize )  // The number of columns per block
+         , counts_   ( counts    )  // The per-block row counts
+      {}
+
+      inline void operator()( size_t first, size_t last ) const
+      {
+         typedef typename MT::ConstIterator  RhsIterator;
+
+         const size_t m( rhs_.rows() );
+         const size_t n( rhs_.columns() );
+
+         for( size_t b=first; b<last; ++b )
+         {
+            size_t* const counts( counts_ + b*m );
+            const size_t jbegin( b*blockSize_ );
+            const size_t jend( min( jbegin+blockSize_, n ) );
+
+            for( size_t j=jbegin; j<jend; ++j ) {
+               for( RhsIterator element=rhs_.begin(j); element!=rhs_.end(j); ++element )
+                  ++counts[element->index()];
+            }
+         }
+      }
+
+      const MT&     rhs_;        //!< The column-major source matrix.
+      const size_t  blockSize_;  //!< The number of columns per block.
+      size_t* const counts_;     //!< The per-block row counts.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class ConversionScatter*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Scatter pass of the storage order conversion.
+   //
+   // This functor copies the non-zero elements of a range of blocks of columns of the
+   // column-major source matrix to their final position within the row-major target matrix.
+   // The given offsets of block \a b specify the next free position within each row. In order
+   // to keep the written memory cache resident, the target rows are processed in tiles of
+   // \a tileSize rows.
+   */
+   template< typename MT >  // Type of the column-major source matrix
+   struct ConversionScatter
+   {
+      inline ConversionScatter( const MT& rhs, size_t blockSize, size_t tileSize,
+                                size_t* offsets, Element* base )
+         : rhs_      ( rhs       )  // The column-major source matrix
+         , blockSize_( blockSize )  // The number of columns per block
+         , tileSize_ ( tileSize  )  // The number of target rows per tile
+         , offsets_  ( offsets   )  // The per-block row offsets
+         , base_     ( base      )  // The first element of the target matrix
+      {}
+
+      inline void operator()( size_t first, size_t last ) const
+      {
+         typedef typename MT::ConstIterator  RhsIterator;
+
+         const size_t m( rhs_.rows() );
+         const size_t n( rhs_.columns() );
+
+         std::vector<RhsIterator> cursors;
+
+         for( size_t b=first; b<last; ++b )
+         {
+            size_t* const offsets( offsets_ + b*m );
+            const size_t jbegin( b*blockSize_ );
+            const size_t jend( min( jbegin+blockSize_, n ) );
+
+            cursors.clear();
+            for( size_t j=jbegin; j<jend; ++j )
+               cursors.push_back( rhs_.begin(j) );
+
+            for( size_t ibegin=0UL; ibegin<m; ibegin+=tileSize_ )
+            {
+               const size_t iend( ( m-ibegin > tileSize_ )?( ibegin+tileSize_ ):( m ) );
+
+               for( size_t j=jbegin; j<jend; ++j )
+               {
+                  RhsIterator& element( cursors[j-jbegin] );
+                  const RhsIterator end( rhs_.end(j) );
+
+                  for( ; element!=end && element->index()<iend; ++element ) {
+                     Element& target( base_[ offsets[element->index()]++ ] );
+                     target.value_ = element->value();
+                     target.index_ = j;
+                  }
+               }
+            }
+         }
+      }
+
+      const MT&      rhs_;        //!< The column-major source matrix.
+      const size_t   blockSize_;  //!< The number of columns per block.
+      const size_t   tileSize_;   //!< The number of target rows per tile.
+      size_t* const  offsets_;    //!< The per-block row offsets.
+      Element* const base_;       //!< The first element of the target matrix.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef CompressedMatrix<Type,SO>   This;            //!< Type of this CompressedMatrix instance.
@@ -263,6 +384,48 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    typedef const Element*              ConstIterator;   //!< Iterator over constant elements.
    //**********************************************************************************************
 
+   //**ColumnEntry struct definition***************************************************************
+   /*!\brief Entry of the transposed column index of the compressed matrix.
+   //
+   // Each entry of the column index refers to a single non-zero element of the compressed
+   // matrix by means of its row index and an iterator to the element within its row. Since
+   // the iterator points directly into the row-wise storage, the column index always refers to
+   // the current values of the compressed matrix. Note that the column index only provides read
+   // access to the elements; write access is provided by the columnElement() function of the
+   // non-constant matrix.
+   */
+   struct ColumnEntry
+   {
+      //**Index function***************************************************************************
+      /*!\brief Access to the row index of the referenced element.
+      //
+      // \return The row index of the referenced element.
+      */
+      inline size_t index() const {
+         return row_;
+      }
+      //*******************************************************************************************
+
+      //**Element function*************************************************************************
+      /*!\brief Access to the referenced element.
+      //
+      // \return Iterator to the referenced element within its row.
+      */
+      inline ConstIterator element() const {
+         return pos_;
+      }
+      //*******************************************************************************************
+
+      size_t        row_;  //!< The row index of the referenced element.
+      ConstIterator pos_;  //!< Iterator to the referenced element within its row.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Iterator over the entries of a single column of the column index.
+   typedef typename std::vector<ColumnEntry>::const_iterator  ColumnEntryIterator;
+   //**********************************************************************************************
+
    //**Rebind struct definition********************************************************************
    /*!\brief Rebind mechanism to obtain a CompressedMatrix with different data/element type.
    */
@@ -375,6 +538,16 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    //@}
    //**********************************************************************************************
 
+   //**Column index functions**********************************************************************
+   /*!\name Column index functions */
+   //@{
+   inline ColumnEntryIterator columnBegin  ( size_t j ) const;
+   inline ColumnEntryIterator columnEnd    ( size_t j ) const;
+   inline Iterator            columnElement( ColumnEntryIterator entry );
+   inline ConstIterator       columnElement( ColumnEntryIterator entry ) const;
+   //@}
+   //**********************************************************************************************
+
    //**Low-level utility functions*****************************************************************
    /*!\name Low-level utility functions */
    //@{
@@ -402,12 +575,49 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    //**********************************************************************************************
 
  private:
+   //**Private struct ColumnIndex*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Transposed (column-wise) index into the non-zero elements of the compressed matrix.
+   */
+   struct ColumnIndex
+   {
+      explicit inline ColumnIndex() : valid_( false ) {}
+
+      std::vector<ColumnEntry> entries_;  //!< The column-wise sorted entries of all non-zero elements.
+      std::vector<size_t>      begin_;    //!< Offsets of the first entry of each column.
+      std::vector<size_t>      end_;      //!< Offsets one past the last entry of each column.
+      boost::atomic<bool>      valid_;    //!< Validity flag of the column index.
+      boost::mutex             mutex_;    //!< Synchronization mutex for the (re-)construction.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private struct FindRow***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() function on the column index.
+   */
+   struct FindRow : public std::binary_function<ColumnEntry,size_t,bool>
+   {
+      inline bool operator()( const ColumnEntry& entry, size_t row ) const {
+         return entry.row_ < row;
+      }
+      inline bool operator()( size_t row, const ColumnEntry& entry ) const {
+         return row < entry.row_;
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
           Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
    inline size_t   extendCapacity() const;
           void     reserveElements( size_t nonzeros );
+   inline const ColumnIndex& columnIndex() const;
+          ColumnIndex*       buildColumnIndex() const;
+   inline void               invalidateColumnIndex();
+          void     eraseColumnEntries( size_t i, Iterator first, Iterator last );
    //@}
    //**********************************************************************************************
 
@@ -420,6 +630,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    Iterator* begin_;  //!< Pointers to the first non-zero element of each row.
    Iterator* end_;    //!< Pointers one past the last non-zero element of each row.
 
+   mutable boost::atomic<ColumnIndex*> colIndex_;  //!< The lazily built transposed index of the matrix.
+
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
    //**********************************************************************************************
@@ -468,6 +680,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
    , capacity_( 0UL )           // The current capacity of the pointer array
    , begin_( new Iterator[2] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+1 )         // Pointers one past the last non-zero element of each row
+   , colIndex_( NULL )          // The lazily built transposed index of the matrix
 {
    begin_[0] = end_[0] = NULL;
 }
@@ -490,6 +703,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   , colIndex_( NULL )                  // The lazily built transposed index of the matrix
 {
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = NULL;
@@ -514,6 +728,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   , colIndex_( NULL )                  // The lazily built transposed index of the matrix
 {
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
@@ -540,6 +755,7 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
    , capacity_( m )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   , colIndex_( NULL )                   // The lazily built transposed index of the matrix
 {
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
 
@@ -568,6 +784,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
    , capacity_( sm.m_ )                     // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   , colIndex_( NULL )                      // The lazily built transposed index of the matrix
 {
    const size_t nonzeros( sm.nonZeros() );
 
@@ -594,6 +811,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
    , capacity_( m_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   , colIndex_( NULL )                      // The lazily built transposed index of the matrix
 {
    using blaze::assign;
 
@@ -620,6 +838,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
    , capacity_( m_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   , colIndex_( NULL )                      // The lazily built transposed index of the matrix
 {
    using blaze::assign;
 
@@ -652,6 +871,7 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 {
    deallocate( begin_[0UL] );
    delete [] begin_;
+   delete colIndex_.load( boost::memory_order_relaxed );
 }
 //*************************************************************************************************
 
@@ -865,6 +1085,8 @@ inline CompressedMatrix<Type,SO>&
 {
    if( &rhs == this ) return *this;
 
+   invalidateColumnIndex();
+
    const size_t nonzeros( rhs.nonZeros() );
 
    if( rhs.m_ > capacity_ || nonzeros > capacity() )
@@ -1232,6 +1454,8 @@ template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::reset()
 {
+   invalidateColumnIndex();
+
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
 }
@@ -1254,6 +1478,8 @@ template< typename Type  // Data type of the sparse matrix
 inline void CompressedMatrix<Type,SO>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   invalidateColumnIndex();
    end_[i] = begin_[i];
 }
 //*************************************************************************************************
@@ -1270,6 +1496,8 @@ template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::clear()
 {
+   invalidateColumnIndex();
+
    end_[0UL] = end_[m_];
    m_ = 0UL;
    n_ = 0UL;
@@ -1354,6 +1582,8 @@ template< typename Type  // Data type of the sparse matrix
 typename CompressedMatrix<Type,SO>::Iterator
    CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
+   invalidateColumnIndex();
+
    if( begin_[i+1UL] - end_[i] != 0 ) {
       std::copy_backward( pos, end_[i], end_[i]+1 );
       pos->value_ = value;
@@ -1433,8 +1663,10 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
    const Iterator pos( find( i, j ) );
-   if( pos != end_[i] )
+   if( pos != end_[i] ) {
+      eraseColumnEntries( i, pos, pos+1 );
       end_[i] = std::copy( pos+1, end_[i], pos );
+   }
 }
 //*************************************************************************************************
 
@@ -1458,8 +1690,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
 
-   if( pos != end_[i] )
+   if( pos != end_[i] ) {
+      eraseColumnEntries( i, pos, pos+1 );
       end_[i] = std::copy( pos+1, end_[i], pos );
+   }
 
    return pos;
 }
@@ -1488,8 +1722,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
    BLAZE_USER_ASSERT( first >= begin_[i] && first <= end_[i], "Invalid compressed matrix iterator" );
    BLAZE_USER_ASSERT( last  >= begin_[i] && last  <= end_[i], "Invalid compressed matrix iterator" );
 
-   if( first != last )
+   if( first != last ) {
+      eraseColumnEntries( i, first, last );
       end_[i] = std::copy( last, end_[i], first );
+   }
 
    return first;
 }
@@ -1520,6 +1756,8 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    if( m == m_ && n == n_ ) return;
 
+   invalidateColumnIndex();
+
    if( m > capacity_ )
    {
       Iterator* newBegin( new Iterator[2UL*m+2UL] );
@@ -1632,6 +1870,8 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 
    if( current >= nonzeros ) return;
 
+   invalidateColumnIndex();
+
    const ptrdiff_t additional( nonzeros - current );
 
    if( end_[m_] - begin_[m_] < additional )
@@ -1716,6 +1956,8 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
+   invalidateColumnIndex();
+
    if( i < ( m_ - 1UL ) )
       end_[i+1] = std::copy( begin_[i+1], end_[i+1], end_[i] );
    begin_[i+1] = end_[i];
@@ -1799,6 +2041,9 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() *
    std::swap( capacity_, sm.capacity_ );
    std::swap( begin_, sm.begin_ );
    std::swap( end_  , sm.end_   );
+   ColumnIndex* const tmp( colIndex_.load( boost::memory_order_relaxed ) );
+   colIndex_.store( sm.colIndex_.load( boost::memory_order_relaxed ), boost::memory_order_relaxed );
+   sm.colIndex_.store( tmp, boost::memory_order_relaxed );
 }
 //*************************************************************************************************
 
@@ -1835,6 +2080,8 @@ template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 {
+   invalidateColumnIndex();
+
    Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
    Iterator* newEnd   = newBegin+capacity_+1UL;
 
@@ -1856,6 +2103,171 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the valid transposed column index of the compressed matrix.
+//
+// \return Reference to the valid column index.
+//
+// This function returns the column index of the compressed matrix and (re-)builds it in case it
+// does not exist yet or has been invalidated by a modification of the sparse pattern.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline const typename CompressedMatrix<Type,SO>::ColumnIndex&
+   CompressedMatrix<Type,SO>::columnIndex() const
+{
+   const ColumnIndex* index( colIndex_.load( boost::memory_order_acquire ) );
+
+   if( index == NULL || !index->valid_.load( boost::memory_order_acquire ) )
+      index = buildColumnIndex();
+
+   return *index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief (Re-)Building the transposed column index of the compressed matrix.
+//
+// \return Pointer to the valid column index.
+//
+// This function (re-)builds the transposed column index of the compressed matrix by means of
+// a counting sort of all non-zero elements with respect to their column indices. Since the
+// rows are traversed in ascending order, the entries of each column are sorted with respect
+// to their row indices. The cost of the construction is \f$ O(M+N+nnz) \f$.
+//
+// The function can safely be called concurrently by several threads reading the matrix: the
+// column index is published via an atomic compare-and-swap and is constructed by exactly one
+// thread while holding the mutex of the column index. All other threads wait for the index to
+// become valid.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+typename CompressedMatrix<Type,SO>::ColumnIndex*
+   CompressedMatrix<Type,SO>::buildColumnIndex() const
+{
+   ColumnIndex* index( colIndex_.load( boost::memory_order_acquire ) );
+
+   if( index == NULL ) {
+      ColumnIndex* tmp( new ColumnIndex() );
+      if( colIndex_.compare_exchange_strong( index, tmp, boost::memory_order_acq_rel, boost::memory_order_acquire ) )
+         index = tmp;
+      else delete tmp;
+   }
+
+   boost::mutex::scoped_lock lock( index->mutex_ );
+
+   if( index->valid_.load( boost::memory_order_relaxed ) )
+      return index;
+
+   // Counting the number of elements per column
+   index->begin_.assign( n_+1UL, 0UL );
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( ConstIterator element=begin_[i]; element!=end_[i]; ++element )
+         ++index->begin_[element->index_+1UL];
+   }
+
+   for( size_t j=1UL; j<=n_; ++j ) {
+      index->begin_[j] += index->begin_[j-1UL];
+   }
+
+   // Distributing the elements to the columns
+   index->end_.assign( index->begin_.begin(), index->begin_.end()-1 );
+   index->entries_.resize( index->begin_[n_] );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( ConstIterator element=begin_[i]; element!=end_[i]; ++element ) {
+         ColumnEntry& entry( index->entries_[index->end_[element->index_]++] );
+         entry.row_ = i;
+         entry.pos_ = element;
+      }
+   }
+
+   index->valid_.store( true, boost::memory_order_release );
+
+   return index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Invalidating the transposed column index of the compressed matrix.
+//
+// \return void
+//
+// This function marks the column index as invalid due to a modification of the sparse pattern
+// of the matrix. The column index is rebuilt on the next column access.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrix<Type,SO>::invalidateColumnIndex()
+{
+   ColumnIndex* const index( colIndex_.load( boost::memory_order_relaxed ) );
+
+   if( index != NULL )
+      index->valid_.store( false, boost::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updating the column index for the erasure of a range of elements of row \a i.
+//
+// \param i The row index of the erased elements.
+// \param first Iterator to the first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return void
+//
+// This function incrementally updates a valid column index for the erasure of the elements in
+// the range \f$ [first..last) \f$ of row \a i. The function has to be called \b before the
+// elements are removed from the row. The entries of the erased elements are removed from their
+// columns and the entries of all subsequent elements of row \a i are adapted to the shifted
+// positions of the elements. Therefore the cost of the update is proportional to the number of
+// elements in row \a i (times the logarithm of the column lengths) instead of the cost for a
+// complete rebuild of the column index.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompressedMatrix<Type,SO>::eraseColumnEntries( size_t i, Iterator first, Iterator last )
+{
+   typedef typename std::vector<ColumnEntry>::iterator  EntryIterator;
+
+   ColumnIndex* const ptr( colIndex_.load( boost::memory_order_relaxed ) );
+
+   if( ptr == NULL || !ptr->valid_.load( boost::memory_order_relaxed ) )
+      return;
+
+   ColumnIndex& index( *ptr );
+   const EntryIterator entries( index.entries_.begin() );
+
+   // Removing the entries of the erased elements
+   for( Iterator element=first; element!=last; ++element )
+   {
+      const size_t j( element->index_ );
+      const EntryIterator pos( std::lower_bound( entries+index.begin_[j], entries+index.end_[j], i, FindRow() ) );
+
+      BLAZE_INTERNAL_ASSERT( pos != entries+index.end_[j] && pos->pos_ == element, "Invalid column index detected" );
+
+      std::copy( pos+1, entries+index.end_[j], pos );
+      --index.end_[j];
+   }
+
+   // Adapting the entries of the subsequent elements of row i
+   const ptrdiff_t shift( last - first );
+
+   for( Iterator element=last; element!=end_[i]; ++element )
+   {
+      const size_t j( element->index_ );
+      const EntryIterator pos( std::lower_bound( entries+index.begin_[j], entries+index.end_[j], i, FindRow() ) );
+
+      BLAZE_INTERNAL_ASSERT( pos != entries+index.end_[j] && pos->pos_ == element, "Invalid column index detected" );
+
+      pos->pos_ -= shift;
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2021,6 +2433,130 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 
 
 
+//=================================================================================================
+//
+//  COLUMN INDEX FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first column index entry of column \a j.
+//
+// \param j The column index (\f$[0..N-1]\f$).
+// \return Iterator to the first column index entry of column \a j.
+//
+// This function returns an iterator to the first entry of the transposed column index for
+// column \a j. The column index refers to all non-zero elements of column \a j in ascending
+// order of their row indices and enables an efficient column-wise traversal of the row-major
+// matrix in \f$ O(nnz(j)) \f$ time:
+
+   \code
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  MatrixType;
+
+   MatrixType A;
+   // ... Resizing and initialization
+
+   for( MatrixType::ColumnEntryIterator it=A.columnBegin(2); it!=A.columnEnd(2); ++it ) {
+      ... = it->index();             // Access to the row index of the non-zero element
+      ... = it->element()->value();  // Access to the value of the non-zero element
+   }
+   \endcode
+
+// The column index is built lazily on the first call of columnBegin() or columnEnd() and is
+// kept up to date by element erasures. Since the column index refers to the elements within
+// their rows, value updates of the compressed matrix are immediately visible via the iterators
+// returned by element(). All other modifications of the sparse pattern (as for instance the
+// insertion of new elements via insert(), append(), or the function call operator) invalidate
+// the column index, which is rebuilt at a cost of \f$ O(M+N+nnz) \f$ on the next column access.
+// Therefore all column index iterators are subject to invalidation due to any modification of
+// the sparse pattern of the matrix, and alternating insertions and column accesses should be
+// avoided. The lazy construction is thread-safe, i.e. several threads may concurrently access
+// the columns of the same matrix, given that the matrix is not modified at the same time.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedMatrix<Type,SO>::ColumnEntryIterator
+   CompressedMatrix<Type,SO>::columnBegin( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ColumnIndex& index( columnIndex() );
+   return index.entries_.begin() + index.begin_[j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last column index entry of column \a j.
+//
+// \param j The column index (\f$[0..N-1]\f$).
+// \return Iterator just past the last column index entry of column \a j.
+//
+// This function returns an iterator just past the last entry of the transposed column index
+// for column \a j. For more details see the description of the columnBegin() function.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedMatrix<Type,SO>::ColumnEntryIterator
+   CompressedMatrix<Type,SO>::columnEnd( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ColumnIndex& index( columnIndex() );
+   return index.entries_.begin() + index.end_[j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element referenced by the given column index entry.
+//
+// \param entry Iterator to a column index entry of the matrix.
+// \return Iterator to the referenced element within its row.
+//
+// This function converts the given column index entry into an iterator to the referenced
+// element, which in contrast to the iterator returned by the element() function of the entry
+// provides write access to the element:
+
+   \code
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  MatrixType;
+
+   MatrixType A;
+   // ... Resizing and initialization
+
+   for( MatrixType::ColumnEntryIterator it=A.columnBegin(2); it!=A.columnEnd(2); ++it ) {
+      A.columnElement( it )->value() *= 2.0;  // Scaling the non-zero elements of column 2
+   }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedMatrix<Type,SO>::Iterator
+   CompressedMatrix<Type,SO>::columnElement( ColumnEntryIterator entry )
+{
+   return const_cast<Iterator>( entry->element() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element referenced by the given column index entry.
+//
+// \param entry Iterator to a column index entry of the matrix.
+// \return Iterator to the referenced element within its row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedMatrix<Type,SO>::ConstIterator
+   CompressedMatrix<Type,SO>::columnElement( ColumnEntryIterator entry ) const
+{
+   return entry->element();
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  LOW-LEVEL UTILITY FUNCTIONS
@@ -2079,6 +2615,8 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
    BLAZE_USER_ASSERT( end_[i] < end_[m_], "Not enough reserved space left" );
    BLAZE_USER_ASSERT( begin_[i] == end_[i] || j > ( end_[i]-1UL )->index_, "Index is not strictly increasing" );
 
+   invalidateColumnIndex();
+
    end_[i]->value_ = value;
 
    if( !check || !isDefault( end_[i]->value_ ) ) {
@@ -2202,6 +2740,8 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
+   invalidateColumnIndex();
+
    size_t nonzeros( 0UL );
 
    for( size_t i=1UL; i<=m_; ++i )
@@ -2258,6 +2798,8 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
    if( m_ == 0UL || begin_[0] == NULL )
       return;
 
+   invalidateColumnIndex();
+
    for( size_t i=0UL; i<m_; ++i ) {
       begin_[i+1UL] = end_[i] = std::copy( (~rhs).begin(i), (~rhs).end(i), begin_[i] );
    }
@@ -2288,25 +2830,39 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
-   typedef typename MT::ConstIterator  RhsIterator;
+   invalidateColumnIndex();
 
-   // Counting the number of elements per row
-   std::vector<size_t> rowLengths( m_, 0UL );
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         ++rowLengths[element->index()];
-   }
+   if( m_ == 0UL || n_ == 0UL )
+      return;
+
+   // Splitting the columns of the right-hand side matrix into blocks
+   const size_t blocks( ( (~rhs).nonZeros() < SMP_SMATCONVERSION_THRESHOLD ||
+                          isSerialSectionActive() || isParallelSectionActive() )
+                        ?( 1UL ):( min( getNumThreads(), n_ ) ) );
+   const size_t blockSize( ( n_ + blocks - 1UL ) / blocks );
+
+   // Counting the number of elements per row for each block
+   std::vector<size_t> offsets( blocks*m_, 0UL );
+   smpFor( 0UL, blocks, ConversionCount<MT>( ~rhs, blockSize, &offsets[0] ) );
 
-   // Resizing the sparse matrix
+   // Computing the start position of each block within each row and resizing the sparse matrix
+   size_t nonzeros( 0UL );
    for( size_t i=0UL; i<m_; ++i ) {
-      begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
+      for( size_t b=0UL; b<blocks; ++b ) {
+         const size_t count( offsets[b*m_+i] );
+         offsets[b*m_+i] = nonzeros;
+         nonzeros += count;
+      }
+      begin_[i+1UL] = end_[i] = begin_[0UL] + nonzeros;
    }
+   end_[m_] = begin_[m_];
 
-   // Appending the elements to the rows of the sparse matrix
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         append( element->index(), j, element->value() );
-   }
+   // Copying the elements to the rows of the sparse matrix (tiled such that the currently
+   // written cache line of each row of a tile fits into half of the cache)
+   const size_t tiles( min( ( m_ - 1UL ) / ( cacheSize / 128UL ) + 1UL, max( nonzeros / n_, 1UL ) ) );
+   const size_t tileSize( ( m_ + tiles - 1UL ) / tiles );
+
+   smpFor( 0UL, blocks, ConversionScatter<MT>( ~rhs, blockSize, tileSize, &offsets[0], begin_[0UL] ) );
 }
 //*************************************************************************************************
 
@@ -2482,6 +3038,119 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Private class ConversionCount***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Counting pass of the storage order conversion.
+   //
+   // This functor counts the number of non-zero elements per column of the column-major target
+   // matrix for a range of blocks of rows of the row-major source matrix. The counts of
+   // block \a b are stored in the range \f$[b \cdot M .. (b+1) \cdot M)\f$ of the given array.
+   */
+   template< typename MT >  // Type of the row-major source matrix
+   struct ConversionCount
+   {
+      inline ConversionCount( const MT& rhs, size_t blockSize, size_t* counts )
+         : rhs_      ( rhs       )  // The row-major source matrix
+         , blockSize_( blockSize )  // The number of rows per block
+         , counts_   ( counts    )  // The per-block column counts
+      {}
+
+      inline void operator()( size_t first, size_t last ) const
+      {
+         typedef typename MT::ConstIterator  RhsIterator;
+
+         const size_t n( rhs_.columns() );
+         const size_t m( rhs_.rows() );
+
+         for( size_t b=first; b<last; ++b )
+         {
+            size_t* const counts( counts_ + b*n );
+            const size_t ibegin( b*blockSize_ );
+            const size_t iend( min( ibegin+blockSize_, m ) );
+
+            for( size_t i=ibegin; i<iend; ++i ) {
+               for( RhsIterator element=rhs_.begin(i); element!=rhs_.end(i); ++element )
+                  ++counts[element->index()];
+            }
+         }
+      }
+
+      const MT&     rhs_;        //!< The row-major source matrix.
+      const size_t  blockSize_;  //!< The number of rows per block.
+      size_t* const counts_;     //!< The per-block column counts.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class ConversionScatter*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Scatter pass of the storage order conversion.
+   //
+   // This functor copies the non-zero elements of a range of blocks of rows of the
+   // row-major source matrix to their final position within the column-major target matrix.
+   // The given offsets of block \a b specify the next free position within each column. In order
+   // to keep the written memory cache resident, the target columns are processed in tiles of
+   // \a tileSize columns.
+   */
+   template< typename MT >  // Type of the row-major source matrix
+   struct ConversionScatter
+   {
+      inline ConversionScatter( const MT& rhs, size_t blockSize, size_t tileSize,
+                                size_t* offsets, Element* base )
+         : rhs_      ( rhs       )  // The row-major source matrix
+         , blockSize_( blockSize )  // The number of rows per block
+         , tileSize_ ( tileSize  )  // The number of target columns per tile
+         , offsets_  ( offsets   )  // The per-block column offsets
+         , base_     ( base      )  // The first element of the target matrix
+      {}
+
+      inline void operator()( size_t first, size_t last ) const
+      {
+         typedef typename MT::ConstIterator  RhsIterator;
+
+         const size_t n( rhs_.columns() );
+         const size_t m( rhs_.rows() );
+
+         std::vector<RhsIterator> cursors;
+
+         for( size_t b=first; b<last; ++b )
+         {
+            size_t* const offsets( offsets_ + b*n );
+            const size_t ibegin( b*blockSize_ );
+            const size_t iend( min( ibegin+blockSize_, m ) );
+
+            cursors.clear();
+            for( size_t i=ibegin; i<iend; ++i )
+               cursors.push_back( rhs_.begin(i) );
+
+            for( size_t jbegin=0UL; jbegin<n; jbegin+=tileSize_ )
+            {
+               const size_t jend( ( n-jbegin > tileSize_ )?( jbegin+tileSize_ ):( n ) );
+
+               for( size_t i=ibegin; i<iend; ++i )
+               {
+                  RhsIterator& element( cursors[i-ibegin] );
+                  const RhsIterator end( rhs_.end(i) );
+
+                  for( ; element!=end && element->index()<jend; ++element ) {
+                     Element& target( base_[ offsets[element->index()]++ ] );
+                     target.value_ = element->value();
+                     target.index_ = i;
+                  }
+               }
+            }
+         }
+      }
+
+      const MT&      rhs_;        //!< The row-major source matrix.
+      const size_t   blockSize_;  //!< The number of rows per block.
+      const size_t   tileSize_;   //!< The number of target columns per tile.
+      size_t* const  offsets_;    //!< The per-block column offsets.
+      Element* const base_;       //!< The first element of the target matrix.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef CompressedMatrix<Type,true>   This;            //!< Type of this CompressedMatrix instance.
@@ -4521,25 +5190,37 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
-   typedef typename MT::ConstIterator  RhsIterator;
+   if( m_ == 0UL || n_ == 0UL )
+      return;
 
-   // Counting the number of elements per column
-   std::vector<size_t> columnLengths( n_, 0UL );
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         ++columnLengths[element->index()];
-   }
+   // Splitting the rows of the right-hand side matrix into blocks
+   const size_t blocks( ( (~rhs).nonZeros() < SMP_SMATCONVERSION_THRESHOLD ||
+                          isSerialSectionActive() || isParallelSectionActive() )
+                        ?( 1UL ):( min( getNumThreads(), m_ ) ) );
+   const size_t blockSize( ( m_ + blocks - 1UL ) / blocks );
+
+   // Counting the number of elements per column for each block
+   std::vector<size_t> offsets( blocks*n_, 0UL );
+   smpFor( 0UL, blocks, ConversionCount<MT>( ~rhs, blockSize, &offsets[0] ) );
 
-   // Resizing the sparse matrix
+   // Computing the start position of each block within each column and resizing the sparse matrix
+   size_t nonzeros( 0UL );
    for( size_t j=0UL; j<n_; ++j ) {
-      begin_[j+1UL] = end_[j+1UL] = begin_[j] + columnLengths[j];
+      for( size_t b=0UL; b<blocks; ++b ) {
+         const size_t count( offsets[b*n_+j] );
+         offsets[b*n_+j] = nonzeros;
+         nonzeros += count;
+      }
+      begin_[j+1UL] = end_[j] = begin_[0UL] + nonzeros;
    }
+   end_[n_] = begin_[n_];
 
-   // Appending the elements to the columns of the sparse matrix
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         append( i, element->index(), element->value() );
-   }
+   // Copying the elements to the columns of the sparse matrix (tiled such that the currently
+   // written cache line of each column of a tile fits into half of the cache)
+   const size_t tiles( min( ( n_ - 1UL ) / ( cacheSize / 128UL ) + 1UL, max( nonzeros / m_, 1UL ) ) );
+   const size_t tileSize( ( n_ + tiles - 1UL ) / tiles );
+
+   smpFor( 0UL, blocks, ConversionScatter<MT>( ~rhs, blockSize, tileSize, &offsets[0], begin_[0UL] ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4808,6 +5489,26 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 
 
 
+//=================================================================================================
+//
+//  HASCOLUMNINDEX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct HasColumnIndex< CompressedMatrix<T,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ISRESIZABLE SPECIALIZATIONS
@@ -44,6 +44,7 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename > class BlockCompressedMatrix;
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
 
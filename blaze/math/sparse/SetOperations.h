@@ -0,0 +1,504 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SetOperations.h
+//  \brief Header file for the sparse index set operation kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_SPARSE_SETOPERATIONS_H_
+#define _BLAZE_MATH_SPARSE_SETOPERATIONS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsPointer.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemovePointer.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary type trait for the detection of raw sparse element iterators.
+// \ingroup sparse
+//
+// This type trait tests whether the given iterator type is a plain pointer to value-index pairs
+// of numeric type (as for instance the iterators of CompressedVector and CompressedMatrix). In
+// this case the \a value member enumeration is set to 1, otherwise it is 0. For these iterators
+// the set operation kernels switch to branchless and galloping variants.
+*/
+template< typename Iterator, bool = IsPointer<Iterator>::value >
+struct IsRawSparseIterator
+{
+   enum { value = 0 };
+};
+
+template< typename Iterator >
+struct IsRawSparseIterator<Iterator,true>
+{
+ private:
+   typedef typename RemoveCV< typename RemovePointer<Iterator>::Type >::Type  Element;
+
+ public:
+   enum { value = IsNumeric<typename Element::ValueType>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum ratio between the numbers of non-zero elements of two operands for galloping.
+// \ingroup sparse
+//
+// In case one of the two operands of a sparse dot product has at least this many times more
+// non-zero elements than the other one, the kernel does not walk the longer operand element by
+// element, but gallops (exponential search followed by binary search) to the next candidate.
+*/
+const size_t SPARSE_GALLOPING_RATIO = 16UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Comparison functor for the binary search within sparse element ranges.
+// \ingroup sparse
+*/
+struct SparseIndexLess
+{
+   template< typename Element >
+   inline bool operator()( const Element& element, size_t index ) const {
+      return element.index() < index;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Galloping search for the first element with an index not less than the given index.
+// \ingroup sparse
+//
+// \param first Iterator to the first element of the sorted sparse element range.
+// \param last Iterator one past the last element of the sorted sparse element range.
+// \param index The index to be searched for.
+// \return Iterator to the first element with an index not less than \a index.
+//
+// The search probes the elements at exponentially increasing distances from \a first and then
+// performs a binary search within the last bracket. In contrast to a plain binary search the
+// cost is logarithmic in the distance to the result instead of the length of the range.
+*/
+template< typename Iterator >  // Type of the random access sparse element iterator
+inline Iterator gallop( Iterator first, Iterator last, size_t index )
+{
+   const size_t n( last - first );
+
+   if( n == 0UL || first->index() >= index )
+      return first;
+
+   size_t lo( 0UL ), hi( 1UL );
+
+   while( hi < n && first[hi].index() < index ) {
+      lo  = hi;
+      hi *= 2UL;
+   }
+
+   return std::lower_bound( first+lo+1UL, first+( hi < n ? hi : n ), index, SparseIndexLess() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DOT PRODUCT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the scalar product of two sorted sparse element ranges.
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return The scalar product of the two ranges.
+*/
+template< typename MultType         // Type of the multiplication result
+        , typename LeftIterator     // Type of the left-hand side iterator
+        , typename RightIterator >  // Type of the right-hand side iterator
+inline typename DisableIf< And< IsRawSparseIterator<LeftIterator>
+                              , IsRawSparseIterator<RightIterator> >, MultType >::Type
+   sparseDot( LeftIterator l, LeftIterator lend, RightIterator r, RightIterator rend )
+{
+   MultType sp = MultType();
+
+   for( ; l!=lend && r!=rend; ++l ) {
+      while( r->index() < l->index() && ++r != rend ) {}
+      if( r!=rend && l->index() == r->index() ) {
+         sp = l->value() * r->value();
+         ++r;
+         break;
+      }
+   }
+
+   for( ; l!=lend && r!=rend; ++l ) {
+      while( r->index() < l->index() && ++r != rend ) {}
+      if( r!=rend && l->index() == r->index() ) {
+         sp += l->value() * r->value();
+         ++r;
+      }
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimized kernel for the scalar product of two sorted ranges of numeric elements.
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return The scalar product of the two ranges.
+//
+// In case the number of non-zero elements of the two ranges differ by more than a factor of
+// \a SPARSE_GALLOPING_RATIO, the kernel iterates over the shorter range and gallops through the
+// longer one. Otherwise both ranges are intersected by a branchless merge, which advances both
+// iterators by means of the comparison results and thereby avoids the unpredictable branches
+// of the default kernel.
+*/
+template< typename MultType         // Type of the multiplication result
+        , typename LeftIterator     // Type of the left-hand side iterator
+        , typename RightIterator >  // Type of the right-hand side iterator
+inline typename EnableIf< And< IsRawSparseIterator<LeftIterator>
+                             , IsRawSparseIterator<RightIterator> >, MultType >::Type
+   sparseDot( LeftIterator l, LeftIterator lend, RightIterator r, RightIterator rend )
+{
+   const size_t lnz( lend - l );
+   const size_t rnz( rend - r );
+
+   MultType sp = MultType();
+
+   if( lnz * SPARSE_GALLOPING_RATIO <= rnz )
+   {
+      for( ; l!=lend; ++l ) {
+         r = gallop( r, rend, l->index() );
+         if( r == rend ) break;
+         if( r->index() == l->index() ) {
+            sp += l->value() * r->value();
+            ++r;
+         }
+      }
+   }
+   else if( rnz * SPARSE_GALLOPING_RATIO <= lnz )
+   {
+      for( ; r!=rend; ++r ) {
+         l = gallop( l, lend, r->index() );
+         if( l == lend ) break;
+         if( l->index() == r->index() ) {
+            sp += l->value() * r->value();
+            ++l;
+         }
+      }
+   }
+   else
+   {
+      while( l != lend && r != rend ) {
+         const size_t li( l->index() );
+         const size_t ri( r->index() );
+         sp += ( li == ri )?( l->value() * r->value() ):( MultType() );
+         l += ( li <= ri );
+         r += ( ri <= li );
+      }
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MERGE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the merging addition of two sorted sparse element ranges.
+// \ingroup sparse
+//
+// \param lhs The target sparse vector.
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return void
+//
+// The sum of the two ranges is appended to the given sparse vector, which must provide enough
+// capacity for the non-zero elements of both ranges.
+*/
+template< typename VT               // Type of the target sparse vector
+        , bool TF                   // Transpose flag of the target sparse vector
+        , typename LeftIterator     // Type of the left-hand side iterator
+        , typename RightIterator >  // Type of the right-hand side iterator
+inline typename DisableIf< And< IsRawSparseIterator<LeftIterator>
+                              , IsRawSparseIterator<RightIterator> > >::Type
+   sparseMergeAdd( SparseVector<VT,TF>& lhs, LeftIterator l, LeftIterator lend,
+                   RightIterator r, RightIterator rend )
+{
+   while( l != lend && r != rend )
+   {
+      if( l->index() < r->index() ) {
+         (~lhs).append( l->index(), l->value() );
+         ++l;
+      }
+      else if( l->index() > r->index() ) {
+         (~lhs).append( r->index(), r->value() );
+         ++r;
+      }
+      else {
+         (~lhs).append( l->index(), l->value() + r->value() );
+         ++l;
+         ++r;
+      }
+   }
+
+   while( l != lend ) {
+      (~lhs).append( l->index(), l->value() );
+      ++l;
+   }
+
+   while( r != rend ) {
+      (~lhs).append( r->index(), r->value() );
+      ++r;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Branchless kernel for the merging addition of two sorted ranges of numeric elements.
+// \ingroup sparse
+//
+// \param lhs The target sparse vector.
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return void
+//
+// The sum of the two ranges is appended to the given sparse vector, which must provide enough
+// capacity for the non-zero elements of both ranges. In each step exactly one element is
+// appended, whose index and value are selected from the comparison results instead of by
+// branching.
+*/
+template< typename VT               // Type of the target sparse vector
+        , bool TF                   // Transpose flag of the target sparse vector
+        , typename LeftIterator     // Type of the left-hand side iterator
+        , typename RightIterator >  // Type of the right-hand side iterator
+inline typename EnableIf< And< IsRawSparseIterator<LeftIterator>
+                             , IsRawSparseIterator<RightIterator> > >::Type
+   sparseMergeAdd( SparseVector<VT,TF>& lhs, LeftIterator l, LeftIterator lend,
+                   RightIterator r, RightIterator rend )
+{
+   typedef typename RemovePointer<LeftIterator>::Type::ValueType   E1;
+   typedef typename RemovePointer<RightIterator>::Type::ValueType  E2;
+
+   while( l != lend && r != rend ) {
+      const size_t li( l->index() );
+      const size_t ri( r->index() );
+      const bool lsel( li <= ri );
+      const bool rsel( ri <= li );
+      (~lhs).append( lsel ? li : ri, ( lsel ? l->value() : E1() ) + ( rsel ? r->value() : E2() ) );
+      l += lsel;
+      r += rsel;
+   }
+
+   for( ; l!=lend; ++l ) {
+      (~lhs).append( l->index(), l->value() );
+   }
+
+   for( ; r!=rend; ++r ) {
+      (~lhs).append( r->index(), r->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the merging subtraction of two sorted sparse element ranges.
+// \ingroup sparse
+//
+// \param lhs The target sparse vector.
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return void
+//
+// The difference of the two ranges is appended to the given sparse vector, which must provide
+// enough capacity for the non-zero elements of both ranges.
+*/
+template< typename VT               // Type of the target sparse vector
+        , bool TF                   // Transpose flag of the target sparse vector
+        , typename LeftIterator     // Type of the left-hand side iterator
+        , typename RightIterator >  // Type of the right-hand side iterator
+inline typename DisableIf< And< IsRawSparseIterator<LeftIterator>
+                              , IsRawSparseIterator<RightIterator> > >::Type
+   sparseMergeSub( SparseVector<VT,TF>& lhs, LeftIterator l, LeftIterator lend,
+                   RightIterator r, RightIterator rend )
+{
+   while( l != lend && r != rend )
+   {
+      if( l->index() < r->index() ) {
+         (~lhs).append( l->index(), l->value() );
+         ++l;
+      }
+      else if( l->index() > r->index() ) {
+         (~lhs).append( r->index(), -r->value() );
+         ++r;
+      }
+      else {
+         (~lhs).append( l->index(), l->value() - r->value() );
+         ++l;
+         ++r;
+      }
+   }
+
+   while( l != lend ) {
+      (~lhs).append( l->index(), l->value() );
+      ++l;
+   }
+
+   while( r != rend ) {
+      (~lhs).append( r->index(), -r->value() );
+      ++r;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Branchless kernel for the merging subtraction of two sorted ranges of numeric elements.
+// \ingroup sparse
+//
+// \param lhs The target sparse vector.
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return void
+//
+// The difference of the two ranges is appended to the given sparse vector, which must provide
+// enough capacity for the non-zero elements of both ranges. In each step exactly one element
+// is appended, whose index and value are selected from the comparison results instead of by
+// branching.
+*/
+template< typename VT               // Type of the target sparse vector
+        , bool TF                   // Transpose flag of the target sparse vector
+        , typename LeftIterator     // Type of the left-hand side iterator
+        , typename RightIterator >  // Type of the right-hand side iterator
+inline typename EnableIf< And< IsRawSparseIterator<LeftIterator>
+                             , IsRawSparseIterator<RightIterator> > >::Type
+   sparseMergeSub( SparseVector<VT,TF>& lhs, LeftIterator l, LeftIterator lend,
+                   RightIterator r, RightIterator rend )
+{
+   typedef typename RemovePointer<LeftIterator>::Type::ValueType   E1;
+   typedef typename RemovePointer<RightIterator>::Type::ValueType  E2;
+
+   while( l != lend && r != rend ) {
+      const size_t li( l->index() );
+      const size_t ri( r->index() );
+      const bool lsel( li <= ri );
+      const bool rsel( ri <= li );
+      (~lhs).append( lsel ? li : ri, ( lsel ? l->value() : E1() ) - ( rsel ? r->value() : E2() ) );
+      l += lsel;
+      r += rsel;
+   }
+
+   for( ; l!=lend; ++l ) {
+      (~lhs).append( l->index(), l->value() );
+   }
+
+   for( ; r!=rend; ++r ) {
+      (~lhs).append( r->index(), -r->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
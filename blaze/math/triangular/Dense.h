@@ -0,0 +1,308 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/triangular/Dense.h
+//  \brief Header file for the triangular solves with dense triangular matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_TRIANGULAR_DENSE_H_
+#define _BLAZE_MATH_TRIANGULAR_DENSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/adaptors/LowerMatrix.h>
+#include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Size of the diagonal blocks of the blocked dense triangular solves.
+// \ingroup triangular_solve
+//
+// The dense triangular solves process the triangular matrix in diagonal blocks of this size.
+// The diagonal blocks are solved by scalar substitution, all remaining elements are applied
+// by the vectorized and parallelized dense matrix/vector and matrix/matrix multiplication
+// kernels.
+*/
+const size_t TRIANGULAR_BLOCK_SIZE = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE TRIANGULAR SOLVES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Dense triangular solves */
+//@{
+template< typename MT, bool SO, typename VT >
+inline void trsv( const LowerMatrix<MT,SO,true>& A, DenseVector<VT,false>& b );
+
+template< typename MT, bool SO, typename VT >
+inline void trsv( const UpperMatrix<MT,SO,true>& A, DenseVector<VT,false>& b );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void trsm( const LowerMatrix<MT1,SO1,true>& A, DenseMatrix<MT2,SO2>& B );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void trsm( const UpperMatrix<MT1,SO1,true>& A, DenseMatrix<MT2,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the dense lower triangular system \f$ A \vec{x} = \vec{b} \f$ in-place.
+// \ingroup triangular_solve
+//
+// \param A The dense lower triangular system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution \f$ \vec{x} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ \vec{b} = A^{-1} \vec{b} \f$ by forward substitution. The matrix
+// is processed in diagonal blocks: After a diagonal block has been solved by scalar forward
+// substitution, the contribution of the new unknowns to all remaining unknowns is subtracted
+// by a single matrix/vector multiplication with the subdiagonal block column. No check for
+// singularity is performed, i.e. zero diagonal elements result in a division by zero.
+*/
+template< typename MT    // Type of the adapted dense matrix
+        , bool SO        // Storage order of the adapted dense matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void trsv( const LowerMatrix<MT,SO,true>& A, DenseVector<VT,false>& b )
+{
+   typedef typename VT::ElementType  ET;
+
+   if( A.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   VT& x( ~b );
+   const size_t n( x.size() );
+
+   for( size_t kk=0UL; kk<n; kk+=TRIANGULAR_BLOCK_SIZE )
+   {
+      const size_t kend( min( kk+TRIANGULAR_BLOCK_SIZE, n ) );
+
+      for( size_t i=kk; i<kend; ++i ) {
+         ET tmp( x[i] );
+         for( size_t j=kk; j<i; ++j )
+            tmp -= A(i,j) * x[j];
+         x[i] = tmp / A(i,i);
+      }
+
+      if( kend < n ) {
+         subvector( x, kend, n-kend ) -=
+            submatrix( A, kend, kk, n-kend, kend-kk ) * subvector( x, kk, kend-kk );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the dense upper triangular system \f$ A \vec{x} = \vec{b} \f$ in-place.
+// \ingroup triangular_solve
+//
+// \param A The dense upper triangular system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution \f$ \vec{x} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ \vec{b} = A^{-1} \vec{b} \f$ by backward substitution. The matrix
+// is processed in diagonal blocks, starting with the last block: After a diagonal block has been
+// solved by scalar backward substitution, the contribution of the new unknowns to all remaining
+// unknowns is subtracted by a single matrix/vector multiplication with the block column above
+// the diagonal block. No check for singularity is performed, i.e. zero diagonal elements result
+// in a division by zero.
+*/
+template< typename MT    // Type of the adapted dense matrix
+        , bool SO        // Storage order of the adapted dense matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void trsv( const UpperMatrix<MT,SO,true>& A, DenseVector<VT,false>& b )
+{
+   typedef typename VT::ElementType  ET;
+
+   if( A.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   VT& x( ~b );
+
+   for( size_t kend=x.size(); kend>0UL; )
+   {
+      const size_t kk( ( kend > TRIANGULAR_BLOCK_SIZE )?( kend-TRIANGULAR_BLOCK_SIZE ):( 0UL ) );
+
+      for( size_t i=kend; i>kk; --i ) {
+         ET tmp( x[i-1UL] );
+         for( size_t j=i; j<kend; ++j )
+            tmp -= A(i-1UL,j) * x[j];
+         x[i-1UL] = tmp / A(i-1UL,i-1UL);
+      }
+
+      if( kk > 0UL ) {
+         subvector( x, 0UL, kk ) -=
+            submatrix( A, 0UL, kk, kk, kend-kk ) * subvector( x, kk, kend-kk );
+      }
+
+      kend = kk;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the dense lower triangular system \f$ A X = B \f$ in-place.
+// \ingroup triangular_solve
+//
+// \param A The dense lower triangular system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution \f$ X \f$.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes \f$ B = A^{-1} B \f$ for all columns of \a B at once. The matrix is
+// processed in diagonal blocks: After the rows of a diagonal block have been solved by scalar
+// forward substitution, the contribution of the new rows to all remaining rows is subtracted by
+// a single matrix/matrix multiplication with the subdiagonal block column. No check for
+// singularity is performed, i.e. zero diagonal elements result in a division by zero.
+*/
+template< typename MT1  // Type of the adapted dense matrix
+        , bool SO1      // Storage order of the adapted dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void trsm( const LowerMatrix<MT1,SO1,true>& A, DenseMatrix<MT2,SO2>& B )
+{
+   if( A.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   MT2& X( ~B );
+   const size_t n( X.rows() );
+   const size_t m( X.columns() );
+
+   for( size_t kk=0UL; kk<n; kk+=TRIANGULAR_BLOCK_SIZE )
+   {
+      const size_t kend( min( kk+TRIANGULAR_BLOCK_SIZE, n ) );
+
+      for( size_t i=kk; i<kend; ++i ) {
+         for( size_t j=kk; j<i; ++j ) {
+            const typename MT1::ElementType a( A(i,j) );
+            for( size_t c=0UL; c<m; ++c )
+               X(i,c) -= a * X(j,c);
+         }
+         const typename MT1::ElementType d( A(i,i) );
+         for( size_t c=0UL; c<m; ++c )
+            X(i,c) /= d;
+      }
+
+      if( kend < n ) {
+         submatrix( X, kend, 0UL, n-kend, m ) -=
+            submatrix( A, kend, kk, n-kend, kend-kk ) * submatrix( X, kk, 0UL, kend-kk, m );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the dense upper triangular system \f$ A X = B \f$ in-place.
+// \ingroup triangular_solve
+//
+// \param A The dense upper triangular system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution \f$ X \f$.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes \f$ B = A^{-1} B \f$ for all columns of \a B at once. The matrix is
+// processed in diagonal blocks, starting with the last block: After the rows of a diagonal block
+// have been solved by scalar backward substitution, the contribution of the new rows to all
+// remaining rows is subtracted by a single matrix/matrix multiplication with the block column
+// above the diagonal block. No check for singularity is performed, i.e. zero diagonal elements
+// result in a division by zero.
+*/
+template< typename MT1  // Type of the adapted dense matrix
+        , bool SO1      // Storage order of the adapted dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void trsm( const UpperMatrix<MT1,SO1,true>& A, DenseMatrix<MT2,SO2>& B )
+{
+   if( A.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   MT2& X( ~B );
+   const size_t m( X.columns() );
+
+   for( size_t kend=X.rows(); kend>0UL; )
+   {
+      const size_t kk( ( kend > TRIANGULAR_BLOCK_SIZE )?( kend-TRIANGULAR_BLOCK_SIZE ):( 0UL ) );
+
+      for( size_t i=kend; i>kk; --i ) {
+         for( size_t j=i; j<kend; ++j ) {
+            const typename MT1::ElementType a( A(i-1UL,j) );
+            for( size_t c=0UL; c<m; ++c )
+               X(i-1UL,c) -= a * X(j,c);
+         }
+         const typename MT1::ElementType d( A(i-1UL,i-1UL) );
+         for( size_t c=0UL; c<m; ++c )
+            X(i-1UL,c) /= d;
+      }
+
+      if( kk > 0UL ) {
+         submatrix( X, 0UL, 0UL, kk, m ) -=
+            submatrix( A, 0UL, kk, kk, kend-kk ) * submatrix( X, kk, 0UL, kend-kk, m );
+      }
+
+      kend = kk;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,573 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/triangular/LevelSchedule.h
+//  \brief Header file for the level schedule of sparse triangular substitutions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_TRIANGULAR_LEVELSCHEDULE_H_
+#define _BLAZE_MATH_TRIANGULAR_LEVELSCHEDULE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Backoff.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level schedule for the parallel substitution with row-major sparse triangular matrices.
+// \ingroup triangular_solve
+//
+// The LevelSchedule class partitions the rows of a row-major sparse triangular matrix into
+// levels such that each row only depends on rows of preceding levels. The level of a row is one
+// larger than the largest level of all rows it depends on, i.e. for a lower triangular matrix
+// all rows \f$ j < i \f$ with \f$ l_{ij} \neq 0 \f$ and for an upper triangular matrix all rows
+// \f$ j > i \f$ with \f$ u_{ij} \neq 0 \f$. Additionally, the schedule stores the number of
+// dependencies of each row and the rows depending on each row.
+//
+// The parallel substitution is synchronization-free: Instead of separating the levels by
+// barriers, each row owns an atomic counter of its not yet computed dependencies. The threads
+// fetch chunks of rows in the order of the levels via a shared atomic cursor, wait until the
+// counter of each row has dropped to zero, compute the row and decrement the counters of all
+// rows depending on it. Thus a row is computed as soon as its own dependencies are available,
+// independent of the progress of the remaining rows of the preceding levels, and no thread
+// idles at the end of a level. Since rows are only fetched in the order of the levels, every
+// row a thread waits for has already been fetched by a running thread, which guarantees the
+// progress of the substitution.
+//
+// The schedule only depends on the sparsity pattern of the triangular matrix. Therefore it can
+// be computed once and reused for all subsequent substitutions with the same matrix, also in
+// case the values of the matrix change as long as its sparsity pattern stays the same:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::LowerMatrix;
+
+   LowerMatrix< CompressedMatrix<double,blaze::rowMajor> > L;
+   DynamicVector<double,blaze::columnVector> b;
+   // ... Resizing and initialization
+
+   const blaze::LevelSchedule schedule( L );  // Analysis of the dependencies between the rows
+
+   trsv( L, b, schedule );  // Level-scheduled in-place computation of b = inv( L ) * b
+   \endcode
+
+// The substitution is processed in parallel in case the widest level contains at least
+// \a SMP_TRSV_THRESHOLD unknowns. Otherwise the rows are processed single-threaded in their
+// natural order.
+*/
+class LevelSchedule
+{
+ private:
+   //**Sync-free kernel***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Synchronization-free execution of a row operation for all rows of the schedule.
+   //
+   // Each worker repeatedly fetches the next chunk of rows in the order of the levels. Before a
+   // row is processed, the worker waits until all rows it depends on have been processed. The
+   // release semantics of the decrements of the dependency counters in combination with the
+   // acquire semantics of the waiting loads guarantee that the results of all dependencies are
+   // visible to the row operation.
+   */
+   template< typename OP >  // Type of the row operation
+   struct SyncFreeKernel
+   {
+      inline void operator()( size_t /*first*/, size_t /*last*/ ) const {
+         size_t begin( next_->fetch_add( chunkSize_, boost::memory_order_relaxed ) );
+         while( begin < size_ ) {
+            const size_t end( min( begin+chunkSize_, size_ ) );
+            for( size_t k=begin; k<end; ++k ) {
+               const size_t i( rows_[k] );
+               if( counters_[i].load( boost::memory_order_acquire ) != 0UL ) {
+                  threadpool::Backoff backoff;
+                  while( counters_[i].load( boost::memory_order_acquire ) != 0UL ) {
+                     if( !backoff.wait() ) boost::this_thread::yield();
+                  }
+               }
+               (*op_)( i );
+               for( size_t p=succPtr_[i]; p<succPtr_[i+1UL]; ++p ) {
+                  counters_[succ_[p]].fetch_sub( 1UL, boost::memory_order_release );
+               }
+            }
+            begin = next_->fetch_add( chunkSize_, boost::memory_order_relaxed );
+         }
+      }
+
+      size_t                 size_;       //!< The total number of rows.
+      size_t                 chunkSize_;  //!< The number of rows fetched at once.
+      const size_t*          rows_;       //!< The rows of all levels.
+      const size_t*          succPtr_;    //!< The first position of the dependent rows of each row.
+      const size_t*          succ_;       //!< The dependent rows of all rows.
+      boost::atomic<size_t>* counters_;   //!< The numbers of outstanding dependencies.
+      boost::atomic<size_t>* next_;       //!< The position of the next chunk of rows.
+      const OP*              op_;         //!< The row operation.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Substitution********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computation of a single unknown of a triangular system.
+   //
+   // The diagonal element is identified by its index, all other elements of the row are
+   // treated as dependencies on already computed unknowns.
+   */
+   template< typename MT    // Type of the triangular matrix
+           , typename VT >  // Type of the right-hand side and solution vector
+   struct Substitution
+   {
+      inline void operator()( size_t i ) const {
+         typedef typename MT::ConstIterator  ConstIterator;
+         typedef typename VT::ElementType    ET;
+         ET tmp( (*z_)[i] );
+         ET diagonal( unit_ ? 1 : 0 );
+         for( ConstIterator element=T_->begin(i); element!=T_->end(i); ++element ) {
+            const size_t j( element->index() );
+            if( j != i )     tmp -= element->value() * (*z_)[j];
+            else if( !unit_ ) diagonal = element->value();
+         }
+         (*z_)[i] = ( unit_ )?( tmp ):( tmp / diagonal );
+      }
+
+      const MT* T_;     //!< The triangular matrix.
+      VT*       z_;     //!< The right-hand side and solution vector.
+      bool      unit_;  //!< \a true for a unit triangular matrix.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LevelSchedule();
+
+   template< typename MT >
+   explicit inline LevelSchedule( const SparseMatrix<MT,false>& T );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   inline void computeLower( const SparseMatrix<MT,false>& L );
+
+   template< typename MT >
+   inline void computeUpper( const SparseMatrix<MT,false>& U );
+
+   inline void   reset  ();
+   inline bool   isUpper() const;
+   inline size_t size   () const;
+   inline size_t levels () const;
+   inline size_t width  ( size_t level ) const;
+
+   template< typename OP >
+   inline void execute( const OP& op, size_t work = 1UL ) const;
+
+   template< typename MT, typename VT >
+   inline void solve( const SparseMatrix<MT,false>& T, DenseVector<VT,false>& z, bool unit = false ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   inline void compute( const MT& T, bool upper );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   bool                upper_;     //!< \a true in case the schedule refers to an upper triangular matrix.
+   size_t              maxWidth_;  //!< The number of rows of the widest level.
+   std::vector<size_t> rows_;      //!< The rows of all levels, sorted by level.
+   std::vector<size_t> ptr_;       //!< The first position of each level within \a rows_.
+   std::vector<size_t> deps_;      //!< The number of dependencies of each row.
+   std::vector<size_t> succPtr_;   //!< The first position of the dependent rows of each row within \a succ_.
+   std::vector<size_t> succ_;      //!< The dependent rows of all rows.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the LevelSchedule class.
+*/
+inline LevelSchedule::LevelSchedule()
+   : upper_   ( false )     // Flag for an upper triangular matrix
+   , maxWidth_( 0UL )       // The number of rows of the widest level
+   , rows_    ()            // The rows of all levels
+   , ptr_     ( 1UL, 0UL )  // The first position of each level
+   , deps_    ()            // The number of dependencies of each row
+   , succPtr_ ( 1UL, 0UL )  // The first position of the dependent rows of each row
+   , succ_    ()            // The dependent rows of all rows
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the level schedule of the given triangular matrix.
+//
+// \param T The row-major lower or upper triangular matrix.
+//
+// The kind of the triangular matrix is determined by its type. Therefore this constructor can
+// only be used for lower and upper triangular matrix types (as for instance the LowerMatrix
+// and UpperMatrix adaptors). For all other matrix types the computeLower() or computeUpper()
+// function has to be used.
+*/
+template< typename MT >  // Type of the triangular matrix
+inline LevelSchedule::LevelSchedule( const SparseMatrix<MT,false>& T )
+   : upper_   ( false )     // Flag for an upper triangular matrix
+   , maxWidth_( 0UL )       // The number of rows of the widest level
+   , rows_    ()            // The rows of all levels
+   , ptr_     ( 1UL, 0UL )  // The first position of each level
+   , deps_    ()            // The number of dependencies of each row
+   , succPtr_ ( 1UL, 0UL )  // The first position of the dependent rows of each row
+   , succ_    ()            // The dependent rows of all rows
+{
+   BLAZE_STATIC_ASSERT( IsLower<MT>::value || IsUpper<MT>::value );
+
+   compute( ~T, !IsLower<MT>::value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the level schedule for the given lower triangular matrix.
+//
+// \param L The row-major lower triangular matrix.
+// \return void
+*/
+template< typename MT >  // Type of the triangular matrix
+inline void LevelSchedule::computeLower( const SparseMatrix<MT,false>& L )
+{
+   compute( ~L, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the level schedule for the given upper triangular matrix.
+//
+// \param U The row-major upper triangular matrix.
+// \return void
+*/
+template< typename MT >  // Type of the triangular matrix
+inline void LevelSchedule::computeUpper( const SparseMatrix<MT,false>& U )
+{
+   compute( ~U, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the level schedule to an empty schedule.
+//
+// \return void
+*/
+inline void LevelSchedule::reset()
+{
+   upper_    = false;
+   maxWidth_ = 0UL;
+   rows_.clear();
+   ptr_.assign( 1UL, 0UL );
+   deps_.clear();
+   succPtr_.assign( 1UL, 0UL );
+   succ_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the schedule refers to an upper triangular matrix.
+//
+// \return \a true in case of an upper triangular matrix, \a false in case of a lower one.
+*/
+inline bool LevelSchedule::isUpper() const
+{
+   return upper_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the scheduled triangular matrix.
+//
+// \return The number of rows.
+*/
+inline size_t LevelSchedule::size() const
+{
+   return rows_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of the schedule.
+//
+// \return The number of levels.
+*/
+inline size_t LevelSchedule::levels() const
+{
+   return ptr_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the given level.
+//
+// \param level The index of the level \f$[0..levels()-1]\f$.
+// \return The number of rows of the level.
+*/
+inline size_t LevelSchedule::width( size_t level ) const
+{
+   BLAZE_USER_ASSERT( level < levels(), "Invalid level access index" );
+
+   return ptr_[level+1UL] - ptr_[level];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given row operation for all rows in the order of the schedule.
+//
+// \param op The row operation.
+// \param work The number of unknowns computed by a single row operation.
+// \return void
+//
+// This function calls the constant function call operator of \a op, which accepts the index of
+// a row, once for every row of the scheduled matrix. Each row is processed after all rows it
+// depends on. In case the number of unknowns of the widest level, i.e. its number of rows times
+// \a work, is larger or equal to the \a SMP_TRSV_THRESHOLD, the rows are processed in parallel
+// by means of the synchronization-free scheme described above. Therefore the row operation is
+// required to only modify the data associated with the given row.
+*/
+template< typename OP >  // Type of the row operation
+inline void LevelSchedule::execute( const OP& op, size_t work ) const
+{
+   const size_t n( rows_.size() );
+
+   if( maxWidth_*work < SMP_TRSV_THRESHOLD || maxWidth_ < 2UL || getNumThreads() < 2UL ||
+       isSerialSectionActive() || isParallelSectionActive() )
+   {
+      if( upper_ ) {
+         for( size_t i=n; i>0UL; --i )
+            op( i-1UL );
+      }
+      else {
+         for( size_t i=0UL; i<n; ++i )
+            op( i );
+      }
+      return;
+   }
+
+   const size_t threads( min( getNumThreads(), maxWidth_ ) );
+
+   UniqueArray< boost::atomic<size_t> > counters( new boost::atomic<size_t>[n] );
+   for( size_t i=0UL; i<n; ++i )
+      counters[i].store( deps_[i], boost::memory_order_relaxed );
+
+   boost::atomic<size_t> next( 0UL );
+
+   SyncFreeKernel<OP> kernel;
+   kernel.size_      = n;
+   kernel.chunkSize_ = max( 1UL, min( 64UL / max( work, 1UL ), maxWidth_ / threads ) );
+   kernel.rows_      = &rows_[0];
+   kernel.succPtr_   = &succPtr_[0];
+   kernel.succ_      = ( succ_.empty() )?( NULL ):( &succ_[0] );
+   kernel.counters_  = counters.get();
+   kernel.next_      = &next;
+   kernel.op_        = &op;
+
+   smpFor( 0UL, threads, kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the scheduled triangular system in-place.
+//
+// \param T The row-major triangular matrix the schedule has been computed for.
+// \param z The right-hand side vector, which is overwritten by the solution.
+// \param unit \a true in case the diagonal of \a T is an implicit unit diagonal.
+// \return void
+//
+// In case \a unit is \a true, any stored diagonal elements of \a T are ignored.
+*/
+template< typename MT    // Type of the triangular matrix
+        , typename VT >  // Type of the right-hand side and solution vector
+inline void LevelSchedule::solve( const SparseMatrix<MT,false>& T, DenseVector<VT,false>& z,
+                                  bool unit ) const
+{
+   BLAZE_USER_ASSERT( (~T).rows() == rows_.size(), "Invalid matrix size detected" );
+   BLAZE_USER_ASSERT( (~z).size() == rows_.size(), "Invalid vector size detected" );
+
+   Substitution<MT,VT> substitution;
+   substitution.T_    = &~T;
+   substitution.z_    = &~z;
+   substitution.unit_ = unit;
+
+   execute( substitution );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the level schedule for the given triangular matrix.
+//
+// \param T The row-major triangular matrix.
+// \param upper \a true in case of an upper triangular matrix, \a false in case of a lower one.
+// \return void
+//
+// The levels and the numbers of dependencies are computed in a single pass over the matrix in
+// the order of the substitution. Afterwards the rows are sorted by level by means of a counting
+// sort, which preserves the natural order of the rows within each level, and the dependent rows
+// of each row are collected in a second pass over the matrix.
+*/
+template< typename MT >  // Type of the triangular matrix
+inline void LevelSchedule::compute( const MT& T, bool upper )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   BLAZE_USER_ASSERT( T.rows() == T.columns(), "Non-square triangular matrix detected" );
+
+   const size_t n( T.rows() );
+
+   std::vector<size_t> level( n, 0UL );
+   size_t levels( 0UL );
+
+   deps_.assign( n, 0UL );
+   succPtr_.assign( n+1UL, 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( upper ? n-k-1UL : k );
+      size_t tmp( 0UL );
+
+      for( ConstIterator element=T.begin(i); element!=T.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( upper ? j > i : j < i ) {
+            tmp = max( tmp, level[j]+1UL );
+            ++deps_[i];
+            ++succPtr_[j+1UL];
+         }
+      }
+
+      level[i] = tmp;
+      levels   = max( levels, tmp+1UL );
+   }
+
+   for( size_t j=0UL; j<n; ++j )
+      succPtr_[j+1UL] += succPtr_[j];
+
+   succ_.resize( succPtr_[n] );
+
+   std::vector<size_t> next( succPtr_.begin(), succPtr_.end()-1 );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( ConstIterator element=T.begin(i); element!=T.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( upper ? j > i : j < i )
+            succ_[next[j]++] = i;
+      }
+   }
+
+   upper_ = upper;
+   ptr_.assign( levels+1UL, 0UL );
+   rows_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i )
+      ++ptr_[level[i]+1UL];
+
+   maxWidth_ = 0UL;
+   for( size_t l=0UL; l<levels; ++l ) {
+      maxWidth_ = max( maxWidth_, ptr_[l+1UL] );
+      ptr_[l+1UL] += ptr_[l];
+   }
+
+   std::vector<size_t> pos( ptr_.begin(), ptr_.end()-1 );
+   for( size_t i=0UL; i<n; ++i )
+      rows_[pos[level[i]]++] = i;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,503 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/triangular/Sparse.h
+//  \brief Header file for the triangular solves with sparse triangular matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_TRIANGULAR_SPARSE_H_
+#define _BLAZE_MATH_TRIANGULAR_SPARSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/adaptors/LowerMatrix.h>
+#include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/triangular/LevelSchedule.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ROW OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of a single row of the solution of a sparse triangular system with
+//        multiple right-hand sides.
+// \ingroup triangular_solve
+//
+// The row operation computes row \a i of \f$ X \f$ from the already computed rows by means of
+// row \a i of the row-major triangular matrix. It is used for both the sequential and the
+// level-scheduled solves (see the LevelSchedule class).
+*/
+template< typename MT1    // Type of the row-major triangular matrix
+        , typename MT2 >  // Type of the right-hand side and solution matrix
+struct TrsmRowOperation
+{
+   inline void operator()( size_t i ) const {
+      typedef typename MT1::ConstIterator  ConstIterator;
+      typedef typename MT2::ElementType    ET;
+      const size_t m( X_->columns() );
+      ET diagonal( 0 );
+      for( ConstIterator element=A_->begin(i); element!=A_->end(i); ++element ) {
+         const size_t j( element->index() );
+         if( j == i ) {
+            diagonal = element->value();
+            continue;
+         }
+         for( size_t c=0UL; c<m; ++c )
+            (*X_)(i,c) -= element->value() * (*X_)(j,c);
+      }
+      for( size_t c=0UL; c<m; ++c )
+         (*X_)(i,c) /= diagonal;
+   }
+
+   const MT1* A_;  //!< The row-major triangular matrix.
+   MT2*       X_;  //!< The right-hand side and solution matrix.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE TRIANGULAR SOLVES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse triangular solves */
+//@{
+template< typename MT, bool SO, typename VT >
+inline void trsv( const LowerMatrix<MT,SO,false>& A, DenseVector<VT,false>& b );
+
+template< typename MT, bool SO, typename VT >
+inline void trsv( const UpperMatrix<MT,SO,false>& A, DenseVector<VT,false>& b );
+
+template< typename MT, typename VT >
+inline void trsv( const LowerMatrix<MT,false,false>& A, DenseVector<VT,false>& b,
+                  const LevelSchedule& schedule );
+
+template< typename MT, typename VT >
+inline void trsv( const UpperMatrix<MT,false,false>& A, DenseVector<VT,false>& b,
+                  const LevelSchedule& schedule );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void trsm( const LowerMatrix<MT1,SO1,false>& A, DenseMatrix<MT2,SO2>& B );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void trsm( const UpperMatrix<MT1,SO1,false>& A, DenseMatrix<MT2,SO2>& B );
+
+template< typename MT1, typename MT2, bool SO2 >
+inline void trsm( const LowerMatrix<MT1,false,false>& A, DenseMatrix<MT2,SO2>& B,
+                  const LevelSchedule& schedule );
+
+template< typename MT1, typename MT2, bool SO2 >
+inline void trsm( const UpperMatrix<MT1,false,false>& A, DenseMatrix<MT2,SO2>& B,
+                  const LevelSchedule& schedule );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sequential in-place solve of a sparse triangular system \f$ A \vec{x} = \vec{b} \f$.
+// \ingroup triangular_solve
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param x The right-hand side vector, which is overwritten by the solution.
+// \param upper \a true in case of an upper triangular matrix, \a false in case of a lower one.
+// \return void
+//
+// For a row-major matrix the function computes the unknowns one after another as the dot
+// product of the corresponding row with the already computed unknowns. For a column-major
+// matrix each new unknown is scattered into the remaining unknowns by means of the
+// corresponding column.
+*/
+template< typename MT    // Type of the triangular matrix
+        , bool SO        // Storage order of the triangular matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void trsv_backend( const SparseMatrix<MT,SO>& A, VT& x, bool upper )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+   typedef typename VT::ElementType    ET;
+
+   const size_t n( x.size() );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( upper ? n-k-1UL : k );
+
+      if( !SO ) {
+         ET tmp( x[i] );
+         ET diagonal( 0 );
+         for( ConstIterator element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+            if( element->index() != i ) tmp -= element->value() * x[element->index()];
+            else diagonal = element->value();
+         }
+         x[i] = tmp / diagonal;
+      }
+      else {
+         ET diagonal( 0 );
+         for( ConstIterator element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+            if( element->index() == i ) diagonal = element->value();
+         }
+         const ET tmp( x[i] / diagonal );
+         for( ConstIterator element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+            if( element->index() != i ) x[element->index()] -= element->value() * tmp;
+         }
+         x[i] = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sequential in-place solve of a sparse triangular system \f$ A X = B \f$.
+// \ingroup triangular_solve
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param X The right-hand side matrix, which is overwritten by the solution.
+// \param upper \a true in case of an upper triangular matrix, \a false in case of a lower one.
+// \return void
+//
+// The rows of \a X are computed one after another, by means of the rows of a row-major matrix
+// or by scattering each new row by means of the columns of a column-major matrix.
+*/
+template< typename MT1    // Type of the triangular matrix
+        , bool SO1        // Storage order of the triangular matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline void trsm_backend( const SparseMatrix<MT1,SO1>& A, MT2& X, bool upper )
+{
+   typedef typename MT1::ConstIterator  ConstIterator;
+   typedef typename MT2::ElementType    ET;
+
+   const size_t n( X.rows() );
+   const size_t m( X.columns() );
+
+   TrsmRowOperation<MT1,MT2> op;
+   op.A_ = &~A;
+   op.X_ = &X;
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( upper ? n-k-1UL : k );
+
+      if( !SO1 ) {
+         op( i );
+      }
+      else {
+         ET diagonal( 0 );
+         for( ConstIterator element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+            if( element->index() == i ) diagonal = element->value();
+         }
+         for( size_t c=0UL; c<m; ++c )
+            X(i,c) /= diagonal;
+         for( ConstIterator element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+            const size_t j( element->index() );
+            if( j == i ) continue;
+            for( size_t c=0UL; c<m; ++c )
+               X(j,c) -= element->value() * X(i,c);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse lower triangular system \f$ A \vec{x} = \vec{b} \f$ in-place.
+// \ingroup triangular_solve
+//
+// \param A The sparse lower triangular system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution \f$ \vec{x} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ \vec{b} = A^{-1} \vec{b} \f$ by sequential forward substitution.
+// For repeated solves with a row-major matrix the level-scheduled trsv() function should be
+// preferred. No check for singularity is performed, i.e. missing or zero diagonal elements
+// result in a division by zero.
+*/
+template< typename MT    // Type of the adapted sparse matrix
+        , bool SO        // Storage order of the adapted sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void trsv( const LowerMatrix<MT,SO,false>& A, DenseVector<VT,false>& b )
+{
+   if( A.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   trsv_backend( A, ~b, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse upper triangular system \f$ A \vec{x} = \vec{b} \f$ in-place.
+// \ingroup triangular_solve
+//
+// \param A The sparse upper triangular system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution \f$ \vec{x} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ \vec{b} = A^{-1} \vec{b} \f$ by sequential backward substitution.
+// For repeated solves with a row-major matrix the level-scheduled trsv() function should be
+// preferred. No check for singularity is performed, i.e. missing or zero diagonal elements
+// result in a division by zero.
+*/
+template< typename MT    // Type of the adapted sparse matrix
+        , bool SO        // Storage order of the adapted sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void trsv( const UpperMatrix<MT,SO,false>& A, DenseVector<VT,false>& b )
+{
+   if( A.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   trsv_backend( A, ~b, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-scheduled in-place solve of the sparse lower triangular system
+//        \f$ A \vec{x} = \vec{b} \f$.
+// \ingroup triangular_solve
+//
+// \param A The row-major sparse lower triangular system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution \f$ \vec{x} \f$.
+// \param schedule The level schedule of \a A.
+// \return void
+// \exception std::invalid_argument Invalid level schedule.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ \vec{b} = A^{-1} \vec{b} \f$ by forward substitution in the order
+// of the given level schedule, which has to be computed for \a A in advance (see the
+// LevelSchedule class). All unknowns of a level are computed in parallel in case the level is
+// sufficiently large. Since the schedule only depends on the sparsity pattern of \a A, it can
+// be reused for any number of solves.
+*/
+template< typename MT    // Type of the adapted sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void trsv( const LowerMatrix<MT,false,false>& A, DenseVector<VT,false>& b,
+                  const LevelSchedule& schedule )
+{
+   if( schedule.size() != A.rows() || schedule.isUpper() )
+      throw std::invalid_argument( "Invalid level schedule" );
+
+   if( A.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   schedule.solve( A, ~b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-scheduled in-place solve of the sparse upper triangular system
+//        \f$ A \vec{x} = \vec{b} \f$.
+// \ingroup triangular_solve
+//
+// \param A The row-major sparse upper triangular system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution \f$ \vec{x} \f$.
+// \param schedule The level schedule of \a A.
+// \return void
+// \exception std::invalid_argument Invalid level schedule.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ \vec{b} = A^{-1} \vec{b} \f$ by backward substitution in the order
+// of the given level schedule, which has to be computed for \a A in advance (see the
+// LevelSchedule class). All unknowns of a level are computed in parallel in case the level is
+// sufficiently large. Since the schedule only depends on the sparsity pattern of \a A, it can
+// be reused for any number of solves.
+*/
+template< typename MT    // Type of the adapted sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void trsv( const UpperMatrix<MT,false,false>& A, DenseVector<VT,false>& b,
+                  const LevelSchedule& schedule )
+{
+   if( schedule.size() != A.rows() || !schedule.isUpper() )
+      throw std::invalid_argument( "Invalid level schedule" );
+
+   if( A.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   schedule.solve( A, ~b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse lower triangular system \f$ A X = B \f$ in-place.
+// \ingroup triangular_solve
+//
+// \param A The sparse lower triangular system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution \f$ X \f$.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes \f$ B = A^{-1} B \f$ for all columns of \a B at once by sequential
+// forward substitution. For repeated solves with a row-major matrix the level-scheduled trsm()
+// function should be preferred. No check for singularity is performed, i.e. missing or zero
+// diagonal elements result in a division by zero.
+*/
+template< typename MT1  // Type of the adapted sparse matrix
+        , bool SO1      // Storage order of the adapted sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void trsm( const LowerMatrix<MT1,SO1,false>& A, DenseMatrix<MT2,SO2>& B )
+{
+   if( A.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   trsm_backend( A, ~B, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse upper triangular system \f$ A X = B \f$ in-place.
+// \ingroup triangular_solve
+//
+// \param A The sparse upper triangular system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution \f$ X \f$.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes \f$ B = A^{-1} B \f$ for all columns of \a B at once by sequential
+// backward substitution. For repeated solves with a row-major matrix the level-scheduled trsm()
+// function should be preferred. No check for singularity is performed, i.e. missing or zero
+// diagonal elements result in a division by zero.
+*/
+template< typename MT1  // Type of the adapted sparse matrix
+        , bool SO1      // Storage order of the adapted sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void trsm( const UpperMatrix<MT1,SO1,false>& A, DenseMatrix<MT2,SO2>& B )
+{
+   if( A.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   trsm_backend( A, ~B, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-scheduled in-place solve of the sparse lower triangular system \f$ A X = B \f$.
+// \ingroup triangular_solve
+//
+// \param A The row-major sparse lower triangular system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution \f$ X \f$.
+// \param schedule The level schedule of \a A.
+// \return void
+// \exception std::invalid_argument Invalid level schedule.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes \f$ B = A^{-1} B \f$ for all columns of \a B at once by forward
+// substitution in the order of the given level schedule (see the LevelSchedule class). All
+// rows of \f$ X \f$ belonging to a level are computed in parallel in case the level contains
+// sufficiently many unknowns.
+*/
+template< typename MT1  // Type of the adapted sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void trsm( const LowerMatrix<MT1,false,false>& A, DenseMatrix<MT2,SO2>& B,
+                  const LevelSchedule& schedule )
+{
+   if( schedule.size() != A.rows() || schedule.isUpper() )
+      throw std::invalid_argument( "Invalid level schedule" );
+
+   if( A.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   TrsmRowOperation< LowerMatrix<MT1,false,false>, MT2 > op;
+   op.A_ = &A;
+   op.X_ = &~B;
+
+   schedule.execute( op, (~B).columns() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-scheduled in-place solve of the sparse upper triangular system \f$ A X = B \f$.
+// \ingroup triangular_solve
+//
+// \param A The row-major sparse upper triangular system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution \f$ X \f$.
+// \param schedule The level schedule of \a A.
+// \return void
+// \exception std::invalid_argument Invalid level schedule.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes \f$ B = A^{-1} B \f$ for all columns of \a B at once by backward
+// substitution in the order of the given level schedule (see the LevelSchedule class). All
+// rows of \f$ X \f$ belonging to a level are computed in parallel in case the level contains
+// sufficiently many unknowns.
+*/
+template< typename MT1  // Type of the adapted sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void trsm( const UpperMatrix<MT1,false,false>& A, DenseMatrix<MT2,SO2>& B,
+                  const LevelSchedule& schedule )
+{
+   if( schedule.size() != A.rows() || !schedule.isUpper() )
+      throw std::invalid_argument( "Invalid level schedule" );
+
+   if( A.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   TrsmRowOperation< UpperMatrix<MT1,false,false>, MT2 > op;
+   op.A_ = &A;
+   op.X_ = &~B;
+
+   schedule.execute( op, (~B).columns() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,84 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/triangular/TriangularSolve.h
+//  \brief Header file for the documentation of the triangular solve module
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_TRIANGULAR_TRIANGULARSOLVE_H_
+#define _BLAZE_MATH_TRIANGULAR_TRIANGULARSOLVE_H_
+
+
+//=================================================================================================
+//
+//  DOXYGEN DOCUMENTATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup triangular_solve Triangular Solves
+// \ingroup math
+//
+// The triangular solve module provides the in-place solution of triangular systems of equations
+// with a single right-hand side vector (trsv()) or with multiple right-hand sides given as the
+// columns of a dense matrix (trsm()). The system matrix is given as LowerMatrix or UpperMatrix
+// adaptor, which determines whether a forward or a backward substitution is performed:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::LowerMatrix;
+   using blaze::UpperMatrix;
+
+   LowerMatrix< DynamicMatrix<double,blaze::rowMajor> > L;
+   UpperMatrix< CompressedMatrix<double,blaze::rowMajor> > U;
+   DynamicVector<double,blaze::columnVector> b;
+   DynamicMatrix<double,blaze::columnMajor> B;
+   // ... Resizing and initialization
+
+   trsv( L, b );  // Computes b = inv( L ) * b
+   trsm( L, B );  // Computes B = inv( L ) * B
+
+   const blaze::LevelSchedule schedule( U );
+
+   trsv( U, b, schedule );  // Level-scheduled computation of b = inv( U ) * b
+   trsm( U, B, schedule );  // Level-scheduled computation of B = inv( U ) * B
+   \endcode
+
+// Dense triangular matrices are processed in diagonal blocks, such that the majority of the
+// operations is performed by the vectorized and parallelized dense matrix/vector and matrix/
+// matrix multiplication kernels. Sparse triangular matrices are either processed sequentially
+// or, for row-major matrices, in the order of a LevelSchedule, which has to be computed once
+// for the sparsity pattern of the matrix and enables the parallel computation of all unknowns
+// of a level.
+*/
+//*************************************************************************************************
+
+#endif
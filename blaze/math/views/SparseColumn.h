@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <iterator>
 #include <stdexcept>
 #include <blaze/math/constraints/Computation.h>
@@ -67,6 +68,7 @@
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubTrait.h>
 #include <blaze/math/traits/SubvectorTrait.h>
+#include <blaze/math/typetraits/HasColumnIndex.h>
 #include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -360,6 +362,12 @@ namespace blaze {
 
 // Although Blaze performs the resulting matrix/vector multiplication as efficiently as possible
 // using a column-major storage order for matrix B would result in a more efficient evaluation.
+//
+// In case the row-major matrix provides a transposed column index (as for instance the row-major
+// CompressedMatrix or a submatrix of it), the column view uses this index for the traversal of
+// the column elements. In this case the iteration over a column costs \f$ O(nnz(column)) \f$
+// instead of one binary search per matrix row. The column index is built on the first column
+// traversal and is rebuilt after any modification of the sparse pattern of the matrix.
 */
 template< typename MT                               // Type of the sparse matrix
         , bool SO = IsColumnMajorMatrix<MT>::value  // Storage order
@@ -2488,12 +2496,281 @@ class SparseColumn<MT,false,false> : public SparseVector< SparseColumn<MT,false,
    };
    //**********************************************************************************************
 
+   //**IndexedColumnIterator class definition******************************************************
+   /*!\brief Iterator over the elements of the sparse column based on a transposed column index.
+   //
+   // This iterator is used for row-major matrices providing a transposed column index (see the
+   // HasColumnIndex type trait). In contrast to the ColumnIterator class, which searches each
+   // row of the matrix for an element in the column, the IndexedColumnIterator directly steps
+   // through the column index and therefore only visits the non-zero elements of the column.
+   */
+   template< typename MatrixType      // Type of the sparse matrix
+           , typename IteratorType >  // Type of the sparse matrix iterator
+   class IndexedColumnIterator
+   {
+    private:
+      //**Type definitions*************************************************************************
+      typedef typename MatrixType::ColumnEntryIterator  EntryIterator;  //!< Iterator over the column index.
+      //*******************************************************************************************
+
+      //**FindRow struct definition****************************************************************
+      /*!\brief Helper class for the lower_bound() function on the column index.
+      */
+      struct FindRow
+      {
+         template< typename EntryType >
+         inline bool operator()( const EntryType& entry, size_t row ) const {
+            return entry.index() < row;
+         }
+      };
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag               IteratorCategory;  //!< The iterator category.
+      typedef ColumnElement<MatrixType,IteratorType>  ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                               PointerType;       //!< Pointer return type.
+      typedef ValueType                               ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                               DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the IndexedColumnIterator class.
+      */
+      inline IndexedColumnIterator()
+         : matrix_( NULL  )  // The sparse matrix containing the column.
+         , row_   ( 0UL   )  // The current row index.
+         , column_( 0UL   )  // The current column index.
+         , pos_   ()         // Iterator to the current sparse element.
+         , entry_ ()         // Iterator to the current column index entry.
+         , last_  ()         // Iterator past the last column index entry.
+         , synced_( false )  // Synchronization flag of the column index iterators.
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the IndexedColumnIterator class.
+      //
+      // \param matrix The matrix containing the column.
+      // \param row The row index.
+      // \param column The column index.
+      //
+      // The iterator is positioned at the first non-zero element of the column with a row index
+      // not less than \a row.
+      */
+      inline IndexedColumnIterator( MatrixType& matrix, size_t row, size_t column )
+         : matrix_( &matrix )  // The sparse matrix containing the column.
+         , row_   ( row     )  // The current row index.
+         , column_( column  )  // The current column index.
+         , pos_   ()           // Iterator to the current sparse element.
+         , entry_ ()           // Iterator to the current column index entry.
+         , last_  ()           // Iterator past the last column index entry.
+         , synced_( false   )  // Synchronization flag of the column index iterators.
+      {
+         seek( row );
+      }
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the IndexedColumnIterator class.
+      //
+      // \param matrix The matrix containing the column.
+      // \param row The row index.
+      // \param column The column index.
+      // \param pos Initial position of the iterator
+      //
+      // The position within the column index is only determined when required. Thus the
+      // iterator can be created directly after modifications of the sparse pattern (as for
+      // instance by the set() and insert() functions) without rebuilding the column index.
+      */
+      inline IndexedColumnIterator( MatrixType& matrix, size_t row, size_t column, IteratorType pos )
+         : matrix_( &matrix )  // The sparse matrix containing the column.
+         , row_   ( row     )  // The current row index.
+         , column_( column  )  // The current column index.
+         , pos_   ( pos     )  // Iterator to the current sparse element.
+         , entry_ ()           // Iterator to the current column index entry.
+         , last_  ()           // Iterator past the last column index entry.
+         , synced_( false   )  // Synchronization flag of the column index iterators.
+      {
+         BLAZE_INTERNAL_ASSERT( matrix.find( row, column ) == pos, "Invalid initial iterator position" );
+      }
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different IndexedColumnIterator instances.
+      //
+      // \param it The column iterator to be copied.
+      */
+      template< typename MatrixType2, typename IteratorType2 >
+      inline IndexedColumnIterator( const IndexedColumnIterator<MatrixType2,IteratorType2>& it )
+         : matrix_( it.matrix_ )  // The sparse matrix containing the column.
+         , row_   ( it.row_    )  // The current row index.
+         , column_( it.column_ )  // The current column index.
+         , pos_   ( it.pos_    )  // Iterator to the current sparse element.
+         , entry_ ( it.entry_  )  // Iterator to the current column index entry.
+         , last_  ( it.last_   )  // Iterator past the last column index entry.
+         , synced_( it.synced_ )  // Synchronization flag of the column index iterators.
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline IndexedColumnIterator& operator++() {
+         if( !synced_ ) {
+            seek( row_+1UL );
+         }
+         else if( ++entry_ != last_ ) {
+            row_ = (*entry_).index();
+            pos_ = matrix_->columnElement( entry_ );
+         }
+         else {
+            row_ = matrix_->rows();
+         }
+
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const IndexedColumnIterator operator++( int ) {
+         const IndexedColumnIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse vector element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( pos_, row_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse vector element at the current iterator position.
+      //
+      // \return Reference to the sparse vector element at the current iterator position.
+      */
+      inline PointerType operator->() const {
+         return PointerType( pos_, row_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two IndexedColumnIterator objects.
+      //
+      // \param rhs The right-hand side column iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename MatrixType2, typename IteratorType2 >
+      inline bool operator==( const IndexedColumnIterator<MatrixType2,IteratorType2>& rhs ) const {
+         return ( matrix_ == rhs.matrix_ ) && ( row_ == rhs.row_ ) && ( column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two IndexedColumnIterator objects.
+      //
+      // \param rhs The right-hand side column iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename MatrixType2, typename IteratorType2 >
+      inline bool operator!=( const IndexedColumnIterator<MatrixType2,IteratorType2>& rhs ) const {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two column iterators.
+      //
+      // \param rhs The right-hand side column iterator.
+      // \return The number of elements between the two column iterators.
+      */
+      inline DifferenceType operator-( const IndexedColumnIterator& rhs ) const {
+         return position() - rhs.position();
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Seek function****************************************************************************
+      /*!\brief Positioning the iterator at the first column element with a row index not less
+      //        than \a row.
+      //
+      // \param row The row index.
+      // \return void
+      */
+      inline void seek( size_t row ) {
+         last_   = matrix_->columnEnd( column_ );
+         entry_  = std::lower_bound( matrix_->columnBegin( column_ ), last_, row, FindRow() );
+         synced_ = true;
+
+         if( entry_ != last_ ) {
+            row_ = (*entry_).index();
+            pos_ = matrix_->columnElement( entry_ );
+         }
+         else {
+            row_ = matrix_->rows();
+         }
+      }
+      //*******************************************************************************************
+
+      //**Position function************************************************************************
+      /*!\brief Returns the current position of the iterator within the column index.
+      //
+      // \return Iterator to the current column index entry.
+      */
+      inline EntryIterator position() const {
+         if( synced_ ) return entry_;
+         return std::lower_bound( matrix_->columnBegin( column_ ), matrix_->columnEnd( column_ ), row_, FindRow() );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      MatrixType*   matrix_;  //!< The sparse matrix containing the column.
+      size_t        row_;     //!< The current row index.
+      size_t        column_;  //!< The current column index.
+      IteratorType  pos_;     //!< Iterator to the current sparse element.
+      EntryIterator entry_;   //!< Iterator to the current column index entry.
+      EntryIterator last_;    //!< Iterator past the last column index entry.
+      bool          synced_;  //!< Synchronization flag of the column index iterators.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2, typename IteratorType2 > friend class IndexedColumnIterator;
+      template< typename MT2, bool SO2, bool SF2 > friend class SparseColumn;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Type definitions****************************************************************************
    //! Iterator over constant elements.
-   typedef ColumnIterator<const MT,typename MT::ConstIterator>  ConstIterator;
+   typedef typename If< HasColumnIndex<MT>
+                      , IndexedColumnIterator<const MT,typename MT::ConstIterator>
+                      , ColumnIterator<const MT,typename MT::ConstIterator> >::Type  ConstIterator;
 
    //! Iterator over non-constant elements.
-   typedef typename IfTrue< useConst, ConstIterator, ColumnIterator<MT,typename MT::Iterator> >::Type  Iterator;
+   typedef typename IfTrue< useConst
+                          , ConstIterator
+                          , typename If< HasColumnIndex<MT>
+                                       , IndexedColumnIterator<MT,typename MT::Iterator>
+                                       , ColumnIterator<MT,typename MT::Iterator> >::Type >::Type  Iterator;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -3202,11 +3479,7 @@ inline size_t SparseColumn<MT,false,false>::capacity() const
 template< typename MT >  // Type of the sparse matrix
 inline size_t SparseColumn<MT,false,false>::nonZeros() const
 {
-   size_t counter( 0UL );
-   for( ConstIterator element=begin(); element!=end(); ++element ) {
-      ++counter;
-   }
-   return counter;
+   return end() - begin();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3331,10 +3604,10 @@ template< typename MT >  // Type of the sparse matrix
 inline typename SparseColumn<MT,false,false>::Iterator
    SparseColumn<MT,false,false>::erase( Iterator first, Iterator last )
 {
-   for( ; first!=last; ++first ) {
-      matrix_.erase( first.row_, first.pos_ );
+   while( first != last ) {
+      first = erase( first );
    }
-   return last;
+   return first;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3630,15 +3903,7 @@ template< typename MT >  // Type of the sparse matrix
 inline typename SparseColumn<MT,false,false>::Iterator
    SparseColumn<MT,false,false>::lowerBound( size_t index )
 {
-   for( size_t i=index; i<size(); ++i )
-   {
-      const typename MT::Iterator pos( matrix_.find( i, col_ ) );
-
-      if( pos != matrix_.end( i ) )
-         return Iterator( matrix_, i, col_, pos );
-   }
-
-   return end();
+   return Iterator( matrix_, index, col_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3661,15 +3926,7 @@ template< typename MT >  // Type of the sparse matrix
 inline typename SparseColumn<MT,false,false>::ConstIterator
    SparseColumn<MT,false,false>::lowerBound( size_t index ) const
 {
-   for( size_t i=index; i<size(); ++i )
-   {
-      const typename MT::ConstIterator pos( matrix_.find( i, col_ ) );
-
-      if( pos != matrix_.end( i ) )
-         return ConstIterator( matrix_, i, col_, pos );
-   }
-
-   return end();
+   return ConstIterator( matrix_, index, col_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3692,15 +3949,7 @@ template< typename MT >  // Type of the sparse matrix
 inline typename SparseColumn<MT,false,false>::Iterator
    SparseColumn<MT,false,false>::upperBound( size_t index )
 {
-   for( size_t i=index+1UL; i<size(); ++i )
-   {
-      const typename MT::Iterator pos( matrix_.find( i, col_ ) );
-
-      if( pos != matrix_.end( i ) )
-         return Iterator( matrix_, i, col_, pos );
-   }
-
-   return end();
+   return Iterator( matrix_, index+1UL, col_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3723,15 +3972,7 @@ template< typename MT >  // Type of the sparse matrix
 inline typename SparseColumn<MT,false,false>::ConstIterator
    SparseColumn<MT,false,false>::upperBound( size_t index ) const
 {
-   for( size_t i=index+1UL; i<size(); ++i )
-   {
-      const typename MT::ConstIterator pos( matrix_.find( i, col_ ) );
-
-      if( pos != matrix_.end( i ) )
-         return ConstIterator( matrix_, i, col_, pos );
-   }
-
-   return end();
+   return ConstIterator( matrix_, index+1UL, col_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <iterator>
 #include <stdexcept>
 #include <vector>
@@ -69,6 +70,7 @@
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasColumnIndex.h>
 #include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -816,6 +818,271 @@ class SparseSubmatrix : public SparseMatrix< SparseSubmatrix<MT,AF,SO>, SO >
    typedef typename IfTrue< useConst, ConstIterator, SubmatrixIterator<MT,typename MT::Iterator> >::Type  Iterator;
    //**********************************************************************************************
 
+   //**SubmatrixColumnEntry class definition******************************************************
+   /*!\brief Entry of the transposed column index of the sparse submatrix.
+   //
+   // This class adapts an entry of the transposed column index of the underlying row-major
+   // sparse matrix (see the HasColumnIndex type trait) to the index space of the submatrix.
+   */
+   template< typename MatrixType >  // Type of the sparse matrix
+   class SubmatrixColumnEntry
+   {
+    private:
+      //**Type definitions*************************************************************************
+      typedef typename MatrixType::ColumnEntryIterator  EntryIterator;  //!< Iterator over the column index.
+      //*******************************************************************************************
+
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SubmatrixColumnEntry class.
+      //
+      // \param entry Iterator to the column index entry of the sparse matrix.
+      // \param row The first row of the submatrix.
+      // \param column The first column of the submatrix.
+      */
+      inline SubmatrixColumnEntry( EntryIterator entry, size_t row, size_t column )
+         : entry_ ( entry  )  // Iterator to the column index entry of the sparse matrix
+         , row_   ( row    )  // The first row of the submatrix
+         , column_( column )  // The first column of the submatrix
+      {}
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the column index entry.
+      //
+      // \return Reference to the column index entry.
+      */
+      inline const SubmatrixColumnEntry* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the row index of the referenced element within the submatrix.
+      //
+      // \return The row index of the referenced element.
+      */
+      inline size_t index() const {
+         return (*entry_).index() - row_;
+      }
+      //*******************************************************************************************
+
+      //**Element function*************************************************************************
+      /*!\brief Access to the referenced element.
+      //
+      // \return Iterator to the referenced element within its submatrix row.
+      */
+      inline ConstIterator element() const {
+         return ConstIterator( (*entry_).element(), column_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      EntryIterator entry_;   //!< Iterator to the column index entry of the sparse matrix.
+      size_t        row_;     //!< The first row of the submatrix.
+      size_t        column_;  //!< The first column of the submatrix.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**SubmatrixColumnEntryIterator class definition**********************************************
+   /*!\brief Iterator over the transposed column index of the sparse submatrix.
+   */
+   template< typename MatrixType >  // Type of the sparse matrix
+   class SubmatrixColumnEntryIterator
+   {
+    private:
+      //**Type definitions*************************************************************************
+      typedef typename MatrixType::ColumnEntryIterator  EntryIterator;  //!< Iterator over the column index.
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag   IteratorCategory;  //!< The iterator category.
+      typedef SubmatrixColumnEntry<MatrixType>  ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                         PointerType;       //!< Pointer return type.
+      typedef ValueType                         ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                         DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the SubmatrixColumnEntryIterator class.
+      */
+      inline SubmatrixColumnEntryIterator()
+         : entry_ ()  // Iterator to the current column index entry of the sparse matrix
+         , row_   ()  // The first row of the submatrix
+         , column_()  // The first column of the submatrix
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SubmatrixColumnEntryIterator class.
+      //
+      // \param entry Iterator to the column index entry of the sparse matrix.
+      // \param row The first row of the submatrix.
+      // \param column The first column of the submatrix.
+      */
+      inline SubmatrixColumnEntryIterator( EntryIterator entry, size_t row, size_t column )
+         : entry_ ( entry  )  // Iterator to the current column index entry of the sparse matrix
+         , row_   ( row    )  // The first row of the submatrix
+         , column_( column )  // The first column of the submatrix
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline SubmatrixColumnEntryIterator& operator++() {
+         ++entry_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const SubmatrixColumnEntryIterator operator++( int ) {
+         const SubmatrixColumnEntryIterator tmp( *this );
+         ++entry_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline SubmatrixColumnEntryIterator& operator--() {
+         --entry_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return Reference to the incremented iterator.
+      */
+      inline SubmatrixColumnEntryIterator& operator+=( DifferenceType inc ) {
+         entry_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return Reference to the decremented iterator.
+      */
+      inline SubmatrixColumnEntryIterator& operator-=( DifferenceType dec ) {
+         entry_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a SubmatrixColumnEntryIterator and an integral value.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      inline const SubmatrixColumnEntryIterator operator+( DifferenceType inc ) const {
+         return SubmatrixColumnEntryIterator( entry_+inc, row_, column_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current column index entry.
+      //
+      // \return The current column index entry.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( entry_, row_, column_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current column index entry.
+      //
+      // \return The current column index entry.
+      */
+      inline PointerType operator->() const {
+         return PointerType( entry_, row_, column_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two SubmatrixColumnEntryIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same entry, \a false if not.
+      */
+      inline bool operator==( const SubmatrixColumnEntryIterator& rhs ) const {
+         return entry_ == rhs.entry_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two SubmatrixColumnEntryIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same entry, \a false if they do.
+      */
+      inline bool operator!=( const SubmatrixColumnEntryIterator& rhs ) const {
+         return entry_ != rhs.entry_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of entries between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of entries between the two iterators.
+      */
+      inline DifferenceType operator-( const SubmatrixColumnEntryIterator& rhs ) const {
+         return entry_ - rhs.entry_;
+      }
+      //*******************************************************************************************
+
+      //**Base function****************************************************************************
+      /*!\brief Access to the current column index entry of the sparse matrix.
+      //
+      // \return Iterator to the current column index entry of the sparse matrix.
+      */
+      inline EntryIterator base() const {
+         return entry_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      EntryIterator entry_;   //!< Iterator to the current column index entry of the sparse matrix.
+      size_t        row_;     //!< The first row of the submatrix.
+      size_t        column_;  //!< The first column of the submatrix.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Iterator over the entries of a single column of the transposed column index.
+   typedef SubmatrixColumnEntryIterator<MT>  ColumnEntryIterator;
+   //**********************************************************************************************
+
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template assignment strategy.
    enum { smpAssignable = MT::smpAssignable };
@@ -904,6 +1171,16 @@ class SparseSubmatrix : public SparseMatrix< SparseSubmatrix<MT,AF,SO>, SO >
    //@}
    //**********************************************************************************************
 
+   //**Column index functions**********************************************************************
+   /*!\name Column index functions */
+   //@{
+   inline ColumnEntryIterator columnBegin  ( size_t j ) const;
+   inline ColumnEntryIterator columnEnd    ( size_t j ) const;
+   inline Iterator            columnElement( ColumnEntryIterator entry );
+   inline ConstIterator       columnElement( ColumnEntryIterator entry ) const;
+   //@}
+   //**********************************************************************************************
+
    //**Low-level utility functions*****************************************************************
    /*!\name Low-level utility functions */
    //@{
@@ -931,6 +1208,18 @@ class SparseSubmatrix : public SparseMatrix< SparseSubmatrix<MT,AF,SO>, SO >
    //**********************************************************************************************
 
  private:
+   //**FindRow struct definition*******************************************************************
+   /*!\brief Helper class for the lower_bound() function on the column index.
+   */
+   struct FindRow
+   {
+      template< typename EntryType >
+      inline bool operator()( const EntryType& entry, size_t row ) const {
+         return entry.index() < row;
+      }
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -2674,6 +2963,110 @@ inline typename SparseSubmatrix<MT,AF,SO>::ConstIterator
 
 
 
+//=================================================================================================
+//
+//  COLUMN INDEX FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first column index entry of column \a j.
+//
+// \param j The column index (\f$[0..N-1]\f$).
+// \return Iterator to the first column index entry of column \a j.
+//
+// This function returns an iterator to the first entry of the transposed column index of the
+// underlying sparse matrix that refers to an element of column \a j of the submatrix. Note
+// that this function is only available in case the underlying row-major sparse matrix provides
+// a transposed column index (see the HasColumnIndex type trait).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename SparseSubmatrix<MT,AF,SO>::ColumnEntryIterator
+   SparseSubmatrix<MT,AF,SO>::columnBegin( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return ColumnEntryIterator( std::lower_bound( matrix_.columnBegin( column_ + j ),
+                                                 matrix_.columnEnd  ( column_ + j ),
+                                                 row_, FindRow() ), row_, column_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last column index entry of column \a j.
+//
+// \param j The column index (\f$[0..N-1]\f$).
+// \return Iterator just past the last column index entry of column \a j.
+//
+// This function returns an iterator just past the last entry of the transposed column index
+// of the underlying sparse matrix that refers to an element of column \a j of the submatrix.
+// Note that this function is only available in case the underlying row-major sparse matrix
+// provides a transposed column index (see the HasColumnIndex type trait).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename SparseSubmatrix<MT,AF,SO>::ColumnEntryIterator
+   SparseSubmatrix<MT,AF,SO>::columnEnd( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return ColumnEntryIterator( std::lower_bound( matrix_.columnBegin( column_ + j ),
+                                                 matrix_.columnEnd  ( column_ + j ),
+                                                 row_ + m_, FindRow() ), row_, column_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element referenced by the given column index entry.
+//
+// \param entry Iterator to a column index entry of the submatrix.
+// \return Iterator to the referenced element within its submatrix row.
+//
+// This function converts the given column index entry into an iterator to the referenced
+// element, which in contrast to the iterator returned by the element() function of the entry
+// provides write access to the element. Note that this function is only available in case the
+// underlying row-major sparse matrix provides a transposed column index (see the HasColumnIndex
+// type trait).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename SparseSubmatrix<MT,AF,SO>::Iterator
+   SparseSubmatrix<MT,AF,SO>::columnElement( ColumnEntryIterator entry )
+{
+   return Iterator( matrix_.columnElement( entry.base() ), column_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element referenced by the given column index entry.
+//
+// \param entry Iterator to a column index entry of the submatrix.
+// \return Iterator to the referenced element within its submatrix row.
+//
+// This function converts the given column index entry into an iterator to the referenced
+// element. Note that this function is only available in case the underlying row-major sparse
+// matrix provides a transposed column index (see the HasColumnIndex type trait).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename SparseSubmatrix<MT,AF,SO>::ConstIterator
+   SparseSubmatrix<MT,AF,SO>::columnElement( ColumnEntryIterator entry ) const
+{
+   return entry->element();
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  LOW-LEVEL UTILITY FUNCTIONS
@@ -6173,6 +6566,26 @@ inline const SparseSubmatrix<MT,AF1,SO>
 
 
 
+//=================================================================================================
+//
+//  HASCOLUMNINDEX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool AF >
+struct HasColumnIndex< SparseSubmatrix<MT,AF,false> > : public HasColumnIndex<MT>::Type
+{
+   enum { value = HasColumnIndex<MT>::value };
+   typedef typename HasColumnIndex<MT>::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ISRESTRICTED SPECIALIZATIONS
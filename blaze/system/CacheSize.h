@@ -68,6 +68,7 @@
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::cacheSize > 100000UL && blaze::cacheSize < 100000000UL );
+BLAZE_STATIC_ASSERT( blaze::cacheLineSize >= 16UL && ( blaze::cacheLineSize & ( blaze::cacheLineSize - 1UL ) ) == 0UL );
 
 }
 /*! \endcond */
@@ -40,6 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Accumulation.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 #include <blaze/config/SMP.h>
 
 
@@ -123,4 +126,92 @@
 #endif
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//
+//  TBB PARALLEL MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the Intel TBB parallelization.
+// \ingroup system
+//
+// This compilation switch enables/disables the parallelization based on the task scheduler of
+// the Intel Threading Building Blocks (TBB). In case the \c BLAZE_USE_TBB_THREADS command line
+// argument is specified during compilation the Blaze library attempts to parallelize all matrix
+// and vector computations by submitting tasks to the TBB task arena of the calling thread. Note
+// however that the OpenMP-based, the C++11 thread-based, and the Boost thread-based
+// parallelizations have priority over the TBB parallelization and will be preferred in case
+// several parallelizations are activated. In case no parallelization is enabled, all
+// computations are performed on a single compute core.
+*/
+#if BLAZE_USE_SHARED_MEMORY_PARALLELIZATION && defined(BLAZE_USE_TBB_THREADS)
+#define BLAZE_TBB_PARALLEL_MODE 1
+#else
+#define BLAZE_TBB_PARALLEL_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  THREAD-LOCAL STORAGE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\def BLAZE_THREAD_LOCAL
+// \brief Platform dependent setup of the thread-local storage class specifier.
+// \ingroup system
+//
+// This macro expands to the storage class specifier for thread-local variables. It is used for
+// the activity flags of the parallel and serial sections, which allows several application
+// threads to independently start shared-memory parallel operations at the same time, and for
+// the scratch arena of expression temporaries. In case the compiler does not provide thread-local
+// storage, the macro expands to nothing and \c BLAZE_THREAD_LOCAL_SUPPORT is set to 0.
+*/
+#if __cplusplus >= 201103L
+#  define BLAZE_THREAD_LOCAL thread_local
+#  define BLAZE_THREAD_LOCAL_SUPPORT 1
+
+// Intel compiler, GNU compiler and Clang
+#elif defined(__INTEL_COMPILER) || defined(__ICC) || defined(__GNUC__) || defined(__clang__)
+#  define BLAZE_THREAD_LOCAL __thread
+#  define BLAZE_THREAD_LOCAL_SUPPORT 1
+
+// Microsoft visual studio
+#elif defined(_MSC_VER)
+#  define BLAZE_THREAD_LOCAL __declspec(thread)
+#  define BLAZE_THREAD_LOCAL_SUPPORT 1
+
+// All other compilers
+#else
+#  define BLAZE_THREAD_LOCAL
+#  define BLAZE_THREAD_LOCAL_SUPPORT 0
+
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::SMP_REDUCTION_BLOCK_SIZE > 0UL && blaze::SMP_REDUCTION_BLOCK_SIZE % 64UL == 0UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
 #endif
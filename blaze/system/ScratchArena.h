@@ -0,0 +1,102 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/ScratchArena.h
+//  \brief Header file for the scratch arena settings
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_SCRATCHARENA_H_
+#define _BLAZE_SYSTEM_SCRATCHARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+
+
+//=================================================================================================
+//
+//  SCRATCH ARENA CONFIGURATION
+//
+//=================================================================================================
+
+#include <blaze/config/ScratchArena.h>
+
+
+
+
+//=================================================================================================
+//
+//  SCRATCH ARENA SETTINGS
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Activation of the scratch arena for expression temporaries.
+// \ingroup system
+//
+// This setting specifies whether the temporaries of expressions are placed in the thread-local
+// scratch arena. The scratch arena is used in case it is activated via the \a useScratchArena
+// switch in the <em>./blaze/config/ScratchArena.h</em> configuration file and in case the
+// compiler provides thread-local storage (see \c BLAZE_THREAD_LOCAL).
+*/
+const bool scratchArenaActive = useScratchArena && BLAZE_THREAD_LOCAL_SUPPORT;
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::scratchArenaLimit % 64UL == 0UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
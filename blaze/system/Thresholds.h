@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 
@@ -56,6 +57,624 @@
 
 
 
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
+//=================================================================================================
+//
+//  COMPILE TIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Compile time thresholds
+// \ingroup system
+//
+// In case the runtime thresholds are deactivated (see the \c BLAZE_USE_RUNTIME_THRESHOLDS switch
+// in <em>./blaze/config/Thresholds.h</em>), all thresholds are compile time constants. For a
+// detailed description of the single thresholds see <em>./blaze/config/Thresholds.h</em>.
+*/
+//@{
+namespace blaze {
+
+const size_t DMATDVECMULT_THRESHOLD       = BLAZE_DMATDVECMULT_THRESHOLD;
+const size_t TDMATDVECMULT_THRESHOLD      = BLAZE_TDMATDVECMULT_THRESHOLD;
+const size_t TDVECDMATMULT_THRESHOLD      = BLAZE_TDVECDMATMULT_THRESHOLD;
+const size_t TDVECTDMATMULT_THRESHOLD     = BLAZE_TDVECTDMATMULT_THRESHOLD;
+const size_t DMATDMATMULT_THRESHOLD       = BLAZE_DMATDMATMULT_THRESHOLD;
+const size_t DMATTDMATMULT_THRESHOLD      = BLAZE_DMATTDMATMULT_THRESHOLD;
+const size_t TDMATDMATMULT_THRESHOLD      = BLAZE_TDMATDMATMULT_THRESHOLD;
+const size_t TDMATTDMATMULT_THRESHOLD     = BLAZE_TDMATTDMATMULT_THRESHOLD;
+const size_t SMP_DVECASSIGN_THRESHOLD     = BLAZE_SMP_DVECASSIGN_THRESHOLD;
+const size_t SMP_DVECDVECADD_THRESHOLD    = BLAZE_SMP_DVECDVECADD_THRESHOLD;
+const size_t SMP_DVECDVECSUB_THRESHOLD    = BLAZE_SMP_DVECDVECSUB_THRESHOLD;
+const size_t SMP_DVECDVECMULT_THRESHOLD   = BLAZE_SMP_DVECDVECMULT_THRESHOLD;
+const size_t SMP_DVECSCALARMULT_THRESHOLD = BLAZE_SMP_DVECSCALARMULT_THRESHOLD;
+const size_t SMP_DMATDVECMULT_THRESHOLD   = BLAZE_SMP_DMATDVECMULT_THRESHOLD;
+const size_t SMP_TDMATDVECMULT_THRESHOLD  = BLAZE_SMP_TDMATDVECMULT_THRESHOLD;
+const size_t SMP_TDVECDMATMULT_THRESHOLD  = BLAZE_SMP_TDVECDMATMULT_THRESHOLD;
+const size_t SMP_TDVECTDMATMULT_THRESHOLD = BLAZE_SMP_TDVECTDMATMULT_THRESHOLD;
+const size_t SMP_DMATSVECMULT_THRESHOLD   = BLAZE_SMP_DMATSVECMULT_THRESHOLD;
+const size_t SMP_TDMATSVECMULT_THRESHOLD  = BLAZE_SMP_TDMATSVECMULT_THRESHOLD;
+const size_t SMP_TSVECDMATMULT_THRESHOLD  = BLAZE_SMP_TSVECDMATMULT_THRESHOLD;
+const size_t SMP_TSVECTDMATMULT_THRESHOLD = BLAZE_SMP_TSVECTDMATMULT_THRESHOLD;
+const size_t SMP_SMATDVECMULT_THRESHOLD   = BLAZE_SMP_SMATDVECMULT_THRESHOLD;
+const size_t SMP_TSMATDVECMULT_THRESHOLD  = BLAZE_SMP_TSMATDVECMULT_THRESHOLD;
+const size_t SMP_BSMATDVECMULT_THRESHOLD  = BLAZE_SMP_BSMATDVECMULT_THRESHOLD;
+const size_t SMP_TDVECSMATMULT_THRESHOLD  = BLAZE_SMP_TDVECSMATMULT_THRESHOLD;
+const size_t SMP_TDVECTSMATMULT_THRESHOLD = BLAZE_SMP_TDVECTSMATMULT_THRESHOLD;
+const size_t SMP_SMATSVECMULT_THRESHOLD   = BLAZE_SMP_SMATSVECMULT_THRESHOLD;
+const size_t SMP_TSMATSVECMULT_THRESHOLD  = BLAZE_SMP_TSMATSVECMULT_THRESHOLD;
+const size_t SMP_TSVECSMATMULT_THRESHOLD  = BLAZE_SMP_TSVECSMATMULT_THRESHOLD;
+const size_t SMP_TSVECTSMATMULT_THRESHOLD = BLAZE_SMP_TSVECTSMATMULT_THRESHOLD;
+const size_t SMP_DMATASSIGN_THRESHOLD     = BLAZE_SMP_DMATASSIGN_THRESHOLD;
+const size_t SMP_DMATDMATADD_THRESHOLD    = BLAZE_SMP_DMATDMATADD_THRESHOLD;
+const size_t SMP_DMATTDMATADD_THRESHOLD   = BLAZE_SMP_DMATTDMATADD_THRESHOLD;
+const size_t SMP_DMATDMATSUB_THRESHOLD    = BLAZE_SMP_DMATDMATSUB_THRESHOLD;
+const size_t SMP_DMATTDMATSUB_THRESHOLD   = BLAZE_SMP_DMATTDMATSUB_THRESHOLD;
+const size_t SMP_DMATSCALARMULT_THRESHOLD = BLAZE_SMP_DMATSCALARMULT_THRESHOLD;
+const size_t SMP_DMATDMATMULT_THRESHOLD   = BLAZE_SMP_DMATDMATMULT_THRESHOLD;
+const size_t SMP_DMATTDMATMULT_THRESHOLD  = BLAZE_SMP_DMATTDMATMULT_THRESHOLD;
+const size_t SMP_TDMATDMATMULT_THRESHOLD  = BLAZE_SMP_TDMATDMATMULT_THRESHOLD;
+const size_t SMP_TDMATTDMATMULT_THRESHOLD = BLAZE_SMP_TDMATTDMATMULT_THRESHOLD;
+const size_t SMP_DMATSMATMULT_THRESHOLD   = BLAZE_SMP_DMATSMATMULT_THRESHOLD;
+const size_t SMP_DMATTSMATMULT_THRESHOLD  = BLAZE_SMP_DMATTSMATMULT_THRESHOLD;
+const size_t SMP_TDMATSMATMULT_THRESHOLD  = BLAZE_SMP_TDMATSMATMULT_THRESHOLD;
+const size_t SMP_TDMATTSMATMULT_THRESHOLD = BLAZE_SMP_TDMATTSMATMULT_THRESHOLD;
+const size_t SMP_SMATDMATMULT_THRESHOLD   = BLAZE_SMP_SMATDMATMULT_THRESHOLD;
+const size_t SMP_BSMATDMATMULT_THRESHOLD  = BLAZE_SMP_BSMATDMATMULT_THRESHOLD;
+const size_t SMP_SMATTDMATMULT_THRESHOLD  = BLAZE_SMP_SMATTDMATMULT_THRESHOLD;
+const size_t SMP_TSMATDMATMULT_THRESHOLD  = BLAZE_SMP_TSMATDMATMULT_THRESHOLD;
+const size_t SMP_TSMATTDMATMULT_THRESHOLD = BLAZE_SMP_TSMATTDMATMULT_THRESHOLD;
+const size_t SMP_SMATSMATMULT_THRESHOLD   = BLAZE_SMP_SMATSMATMULT_THRESHOLD;
+const size_t SMP_SMATTSMATMULT_THRESHOLD  = BLAZE_SMP_SMATTSMATMULT_THRESHOLD;
+const size_t SMP_TSMATSMATMULT_THRESHOLD  = BLAZE_SMP_TSMATSMATMULT_THRESHOLD;
+const size_t SMP_TSMATTSMATMULT_THRESHOLD = BLAZE_SMP_TSMATTSMATMULT_THRESHOLD;
+const size_t SMP_DVECTDVECMULT_THRESHOLD  = BLAZE_SMP_DVECTDVECMULT_THRESHOLD;
+const size_t SMP_SMATCONVERSION_THRESHOLD = BLAZE_SMP_SMATCONVERSION_THRESHOLD;
+const size_t SMP_PGS_THRESHOLD            = BLAZE_SMP_PGS_THRESHOLD;
+const size_t SMP_TRSV_THRESHOLD           = BLAZE_SMP_TRSV_THRESHOLD;
+const size_t SMP_CHOLESKY_THRESHOLD       = BLAZE_SMP_CHOLESKY_THRESHOLD;
+
+} // namespace blaze
+//@}
+//*************************************************************************************************
+
+
+
+
+#else
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Storage of the runtime thresholds.
+// \ingroup system
+//
+// The ThresholdTable class template provides a single definition of all runtime thresholds in
+// all compilation units. The values are statically initialized with the settings given in
+// <em>./blaze/config/Thresholds.h</em> and are therefore valid at any time, including the
+// dynamic initialization phase of a program.
+*/
+template< typename T >  // Type of the threshold values
+struct ThresholdTable
+{
+   //**Utility functions***************************************************************************
+   static size_t find      ( const std::string& name );
+   static bool   initialize();
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   enum { size = 58 };
+
+   static T                 values[size];  //!< The current values of the thresholds.
+   static const char* const names [size];  //!< The names of the thresholds.
+   static bool              initialized;   //!< Initialization flag.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+T ThresholdTable<T>::values[ThresholdTable<T>::size] =
+{
+   BLAZE_DMATDVECMULT_THRESHOLD,
+   BLAZE_TDMATDVECMULT_THRESHOLD,
+   BLAZE_TDVECDMATMULT_THRESHOLD,
+   BLAZE_TDVECTDMATMULT_THRESHOLD,
+   BLAZE_DMATDMATMULT_THRESHOLD,
+   BLAZE_DMATTDMATMULT_THRESHOLD,
+   BLAZE_TDMATDMATMULT_THRESHOLD,
+   BLAZE_TDMATTDMATMULT_THRESHOLD,
+   BLAZE_SMP_DVECASSIGN_THRESHOLD,
+   BLAZE_SMP_DVECDVECADD_THRESHOLD,
+   BLAZE_SMP_DVECDVECSUB_THRESHOLD,
+   BLAZE_SMP_DVECDVECMULT_THRESHOLD,
+   BLAZE_SMP_DVECSCALARMULT_THRESHOLD,
+   BLAZE_SMP_DMATDVECMULT_THRESHOLD,
+   BLAZE_SMP_TDMATDVECMULT_THRESHOLD,
+   BLAZE_SMP_TDVECDMATMULT_THRESHOLD,
+   BLAZE_SMP_TDVECTDMATMULT_THRESHOLD,
+   BLAZE_SMP_DMATSVECMULT_THRESHOLD,
+   BLAZE_SMP_TDMATSVECMULT_THRESHOLD,
+   BLAZE_SMP_TSVECDMATMULT_THRESHOLD,
+   BLAZE_SMP_TSVECTDMATMULT_THRESHOLD,
+   BLAZE_SMP_SMATDVECMULT_THRESHOLD,
+   BLAZE_SMP_TSMATDVECMULT_THRESHOLD,
+   BLAZE_SMP_BSMATDVECMULT_THRESHOLD,
+   BLAZE_SMP_TDVECSMATMULT_THRESHOLD,
+   BLAZE_SMP_TDVECTSMATMULT_THRESHOLD,
+   BLAZE_SMP_SMATSVECMULT_THRESHOLD,
+   BLAZE_SMP_TSMATSVECMULT_THRESHOLD,
+   BLAZE_SMP_TSVECSMATMULT_THRESHOLD,
+   BLAZE_SMP_TSVECTSMATMULT_THRESHOLD,
+   BLAZE_SMP_DMATASSIGN_THRESHOLD,
+   BLAZE_SMP_DMATDMATADD_THRESHOLD,
+   BLAZE_SMP_DMATTDMATADD_THRESHOLD,
+   BLAZE_SMP_DMATDMATSUB_THRESHOLD,
+   BLAZE_SMP_DMATTDMATSUB_THRESHOLD,
+   BLAZE_SMP_DMATSCALARMULT_THRESHOLD,
+   BLAZE_SMP_DMATDMATMULT_THRESHOLD,
+   BLAZE_SMP_DMATTDMATMULT_THRESHOLD,
+   BLAZE_SMP_TDMATDMATMULT_THRESHOLD,
+   BLAZE_SMP_TDMATTDMATMULT_THRESHOLD,
+   BLAZE_SMP_DMATSMATMULT_THRESHOLD,
+   BLAZE_SMP_DMATTSMATMULT_THRESHOLD,
+   BLAZE_SMP_TDMATSMATMULT_THRESHOLD,
+   BLAZE_SMP_TDMATTSMATMULT_THRESHOLD,
+   BLAZE_SMP_SMATDMATMULT_THRESHOLD,
+   BLAZE_SMP_BSMATDMATMULT_THRESHOLD,
+   BLAZE_SMP_SMATTDMATMULT_THRESHOLD,
+   BLAZE_SMP_TSMATDMATMULT_THRESHOLD,
+   BLAZE_SMP_TSMATTDMATMULT_THRESHOLD,
+   BLAZE_SMP_SMATSMATMULT_THRESHOLD,
+   BLAZE_SMP_SMATTSMATMULT_THRESHOLD,
+   BLAZE_SMP_TSMATSMATMULT_THRESHOLD,
+   BLAZE_SMP_TSMATTSMATMULT_THRESHOLD,
+   BLAZE_SMP_DVECTDVECMULT_THRESHOLD,
+   BLAZE_SMP_SMATCONVERSION_THRESHOLD,
+   BLAZE_SMP_PGS_THRESHOLD,
+   BLAZE_SMP_TRSV_THRESHOLD,
+   BLAZE_SMP_CHOLESKY_THRESHOLD
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+const char* const ThresholdTable<T>::names[ThresholdTable<T>::size] =
+{
+   "DMATDVECMULT_THRESHOLD",
+   "TDMATDVECMULT_THRESHOLD",
+   "TDVECDMATMULT_THRESHOLD",
+   "TDVECTDMATMULT_THRESHOLD",
+   "DMATDMATMULT_THRESHOLD",
+   "DMATTDMATMULT_THRESHOLD",
+   "TDMATDMATMULT_THRESHOLD",
+   "TDMATTDMATMULT_THRESHOLD",
+   "SMP_DVECASSIGN_THRESHOLD",
+   "SMP_DVECDVECADD_THRESHOLD",
+   "SMP_DVECDVECSUB_THRESHOLD",
+   "SMP_DVECDVECMULT_THRESHOLD",
+   "SMP_DVECSCALARMULT_THRESHOLD",
+   "SMP_DMATDVECMULT_THRESHOLD",
+   "SMP_TDMATDVECMULT_THRESHOLD",
+   "SMP_TDVECDMATMULT_THRESHOLD",
+   "SMP_TDVECTDMATMULT_THRESHOLD",
+   "SMP_DMATSVECMULT_THRESHOLD",
+   "SMP_TDMATSVECMULT_THRESHOLD",
+   "SMP_TSVECDMATMULT_THRESHOLD",
+   "SMP_TSVECTDMATMULT_THRESHOLD",
+   "SMP_SMATDVECMULT_THRESHOLD",
+   "SMP_TSMATDVECMULT_THRESHOLD",
+   "SMP_BSMATDVECMULT_THRESHOLD",
+   "SMP_TDVECSMATMULT_THRESHOLD",
+   "SMP_TDVECTSMATMULT_THRESHOLD",
+   "SMP_SMATSVECMULT_THRESHOLD",
+   "SMP_TSMATSVECMULT_THRESHOLD",
+   "SMP_TSVECSMATMULT_THRESHOLD",
+   "SMP_TSVECTSMATMULT_THRESHOLD",
+   "SMP_DMATASSIGN_THRESHOLD",
+   "SMP_DMATDMATADD_THRESHOLD",
+   "SMP_DMATTDMATADD_THRESHOLD",
+   "SMP_DMATDMATSUB_THRESHOLD",
+   "SMP_DMATTDMATSUB_THRESHOLD",
+   "SMP_DMATSCALARMULT_THRESHOLD",
+   "SMP_DMATDMATMULT_THRESHOLD",
+   "SMP_DMATTDMATMULT_THRESHOLD",
+   "SMP_TDMATDMATMULT_THRESHOLD",
+   "SMP_TDMATTDMATMULT_THRESHOLD",
+   "SMP_DMATSMATMULT_THRESHOLD",
+   "SMP_DMATTSMATMULT_THRESHOLD",
+   "SMP_TDMATSMATMULT_THRESHOLD",
+   "SMP_TDMATTSMATMULT_THRESHOLD",
+   "SMP_SMATDMATMULT_THRESHOLD",
+   "SMP_BSMATDMATMULT_THRESHOLD",
+   "SMP_SMATTDMATMULT_THRESHOLD",
+   "SMP_TSMATDMATMULT_THRESHOLD",
+   "SMP_TSMATTDMATMULT_THRESHOLD",
+   "SMP_SMATSMATMULT_THRESHOLD",
+   "SMP_SMATTSMATMULT_THRESHOLD",
+   "SMP_TSMATSMATMULT_THRESHOLD",
+   "SMP_TSMATTSMATMULT_THRESHOLD",
+   "SMP_DVECTDVECMULT_THRESHOLD",
+   "SMP_SMATCONVERSION_THRESHOLD",
+   "SMP_PGS_THRESHOLD",
+   "SMP_TRSV_THRESHOLD",
+   "SMP_CHOLESKY_THRESHOLD"
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+bool ThresholdTable<T>::initialized = false;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime threshold.
+// \ingroup system
+//
+// The RuntimeThreshold class template represents a single runtime threshold. It is implicitly
+// convertible to the current value of the threshold and can therefore be used in the same way
+// as a compile time threshold.
+*/
+template< size_t I >  // Index of the threshold
+struct RuntimeThreshold
+{
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the current value of the threshold.
+   //
+   // \return The current value of the threshold.
+   */
+   inline operator size_t() const {
+      return ThresholdTable<size_t>::values[I];
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\name Runtime thresholds
+// \ingroup system
+//
+// In case the runtime thresholds are activated (see the \c BLAZE_USE_RUNTIME_THRESHOLDS switch
+// in <em>./blaze/config/Thresholds.h</em>), all thresholds can be adjusted at runtime via the
+// setThreshold() and loadThresholds() functions. For a detailed description of the single
+// thresholds see <em>./blaze/config/Thresholds.h</em>.
+*/
+//@{
+const RuntimeThreshold< 0UL> DMATDVECMULT_THRESHOLD       = RuntimeThreshold< 0UL>();
+const RuntimeThreshold< 1UL> TDMATDVECMULT_THRESHOLD      = RuntimeThreshold< 1UL>();
+const RuntimeThreshold< 2UL> TDVECDMATMULT_THRESHOLD      = RuntimeThreshold< 2UL>();
+const RuntimeThreshold< 3UL> TDVECTDMATMULT_THRESHOLD     = RuntimeThreshold< 3UL>();
+const RuntimeThreshold< 4UL> DMATDMATMULT_THRESHOLD       = RuntimeThreshold< 4UL>();
+const RuntimeThreshold< 5UL> DMATTDMATMULT_THRESHOLD      = RuntimeThreshold< 5UL>();
+const RuntimeThreshold< 6UL> TDMATDMATMULT_THRESHOLD      = RuntimeThreshold< 6UL>();
+const RuntimeThreshold< 7UL> TDMATTDMATMULT_THRESHOLD     = RuntimeThreshold< 7UL>();
+const RuntimeThreshold< 8UL> SMP_DVECASSIGN_THRESHOLD     = RuntimeThreshold< 8UL>();
+const RuntimeThreshold< 9UL> SMP_DVECDVECADD_THRESHOLD    = RuntimeThreshold< 9UL>();
+const RuntimeThreshold<10UL> SMP_DVECDVECSUB_THRESHOLD    = RuntimeThreshold<10UL>();
+const RuntimeThreshold<11UL> SMP_DVECDVECMULT_THRESHOLD   = RuntimeThreshold<11UL>();
+const RuntimeThreshold<12UL> SMP_DVECSCALARMULT_THRESHOLD = RuntimeThreshold<12UL>();
+const RuntimeThreshold<13UL> SMP_DMATDVECMULT_THRESHOLD   = RuntimeThreshold<13UL>();
+const RuntimeThreshold<14UL> SMP_TDMATDVECMULT_THRESHOLD  = RuntimeThreshold<14UL>();
+const RuntimeThreshold<15UL> SMP_TDVECDMATMULT_THRESHOLD  = RuntimeThreshold<15UL>();
+const RuntimeThreshold<16UL> SMP_TDVECTDMATMULT_THRESHOLD = RuntimeThreshold<16UL>();
+const RuntimeThreshold<17UL> SMP_DMATSVECMULT_THRESHOLD   = RuntimeThreshold<17UL>();
+const RuntimeThreshold<18UL> SMP_TDMATSVECMULT_THRESHOLD  = RuntimeThreshold<18UL>();
+const RuntimeThreshold<19UL> SMP_TSVECDMATMULT_THRESHOLD  = RuntimeThreshold<19UL>();
+const RuntimeThreshold<20UL> SMP_TSVECTDMATMULT_THRESHOLD = RuntimeThreshold<20UL>();
+const RuntimeThreshold<21UL> SMP_SMATDVECMULT_THRESHOLD   = RuntimeThreshold<21UL>();
+const RuntimeThreshold<22UL> SMP_TSMATDVECMULT_THRESHOLD  = RuntimeThreshold<22UL>();
+const RuntimeThreshold<23UL> SMP_BSMATDVECMULT_THRESHOLD  = RuntimeThreshold<23UL>();
+const RuntimeThreshold<24UL> SMP_TDVECSMATMULT_THRESHOLD  = RuntimeThreshold<24UL>();
+const RuntimeThreshold<25UL> SMP_TDVECTSMATMULT_THRESHOLD = RuntimeThreshold<25UL>();
+const RuntimeThreshold<26UL> SMP_SMATSVECMULT_THRESHOLD   = RuntimeThreshold<26UL>();
+const RuntimeThreshold<27UL> SMP_TSMATSVECMULT_THRESHOLD  = RuntimeThreshold<27UL>();
+const RuntimeThreshold<28UL> SMP_TSVECSMATMULT_THRESHOLD  = RuntimeThreshold<28UL>();
+const RuntimeThreshold<29UL> SMP_TSVECTSMATMULT_THRESHOLD = RuntimeThreshold<29UL>();
+const RuntimeThreshold<30UL> SMP_DMATASSIGN_THRESHOLD     = RuntimeThreshold<30UL>();
+const RuntimeThreshold<31UL> SMP_DMATDMATADD_THRESHOLD    = RuntimeThreshold<31UL>();
+const RuntimeThreshold<32UL> SMP_DMATTDMATADD_THRESHOLD   = RuntimeThreshold<32UL>();
+const RuntimeThreshold<33UL> SMP_DMATDMATSUB_THRESHOLD    = RuntimeThreshold<33UL>();
+const RuntimeThreshold<34UL> SMP_DMATTDMATSUB_THRESHOLD   = RuntimeThreshold<34UL>();
+const RuntimeThreshold<35UL> SMP_DMATSCALARMULT_THRESHOLD = RuntimeThreshold<35UL>();
+const RuntimeThreshold<36UL> SMP_DMATDMATMULT_THRESHOLD   = RuntimeThreshold<36UL>();
+const RuntimeThreshold<37UL> SMP_DMATTDMATMULT_THRESHOLD  = RuntimeThreshold<37UL>();
+const RuntimeThreshold<38UL> SMP_TDMATDMATMULT_THRESHOLD  = RuntimeThreshold<38UL>();
+const RuntimeThreshold<39UL> SMP_TDMATTDMATMULT_THRESHOLD = RuntimeThreshold<39UL>();
+const RuntimeThreshold<40UL> SMP_DMATSMATMULT_THRESHOLD   = RuntimeThreshold<40UL>();
+const RuntimeThreshold<41UL> SMP_DMATTSMATMULT_THRESHOLD  = RuntimeThreshold<41UL>();
+const RuntimeThreshold<42UL> SMP_TDMATSMATMULT_THRESHOLD  = RuntimeThreshold<42UL>();
+const RuntimeThreshold<43UL> SMP_TDMATTSMATMULT_THRESHOLD = RuntimeThreshold<43UL>();
+const RuntimeThreshold<44UL> SMP_SMATDMATMULT_THRESHOLD   = RuntimeThreshold<44UL>();
+const RuntimeThreshold<45UL> SMP_BSMATDMATMULT_THRESHOLD  = RuntimeThreshold<45UL>();
+const RuntimeThreshold<46UL> SMP_SMATTDMATMULT_THRESHOLD  = RuntimeThreshold<46UL>();
+const RuntimeThreshold<47UL> SMP_TSMATDMATMULT_THRESHOLD  = RuntimeThreshold<47UL>();
+const RuntimeThreshold<48UL> SMP_TSMATTDMATMULT_THRESHOLD = RuntimeThreshold<48UL>();
+const RuntimeThreshold<49UL> SMP_SMATSMATMULT_THRESHOLD   = RuntimeThreshold<49UL>();
+const RuntimeThreshold<50UL> SMP_SMATTSMATMULT_THRESHOLD  = RuntimeThreshold<50UL>();
+const RuntimeThreshold<51UL> SMP_TSMATSMATMULT_THRESHOLD  = RuntimeThreshold<51UL>();
+const RuntimeThreshold<52UL> SMP_TSMATTSMATMULT_THRESHOLD = RuntimeThreshold<52UL>();
+const RuntimeThreshold<53UL> SMP_DVECTDVECMULT_THRESHOLD  = RuntimeThreshold<53UL>();
+const RuntimeThreshold<54UL> SMP_SMATCONVERSION_THRESHOLD = RuntimeThreshold<54UL>();
+const RuntimeThreshold<55UL> SMP_PGS_THRESHOLD            = RuntimeThreshold<55UL>();
+const RuntimeThreshold<56UL> SMP_TRSV_THRESHOLD           = RuntimeThreshold<56UL>();
+const RuntimeThreshold<57UL> SMP_CHOLESKY_THRESHOLD       = RuntimeThreshold<57UL>();
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime threshold functions */
+//@{
+inline size_t getThreshold  ( const std::string& name );
+inline void   setThreshold  ( const std::string& name, size_t value );
+inline void   loadThresholds( const std::string& filename );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+// \ingroup system
+//
+// \param name The name of the threshold (e.g. \c "SMP_DMATDVECMULT_THRESHOLD").
+// \return The current value of the threshold.
+// \exception std::invalid_argument Invalid threshold name.
+//
+// This function returns the current value of the given threshold. The name of the threshold
+// can be given with or without the \c BLAZE_ prefix. In case no threshold with the given name
+// exists, a \a std::invalid_argument exception is thrown.
+*/
+inline size_t getThreshold( const std::string& name )
+{
+   return ThresholdTable<size_t>::values[ThresholdTable<size_t>::find( name )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the given threshold.
+// \ingroup system
+//
+// \param name The name of the threshold (e.g. \c "SMP_DMATDVECMULT_THRESHOLD").
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold name.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function sets the value of the given threshold. The name of the threshold can be given
+// with or without the \c BLAZE_ prefix. In case no threshold with the given name exists or in
+// case the value of a BLAS threshold is set to 0, a \a std::invalid_argument exception is
+// thrown.
+//
+// Note that changing a threshold while any thread executes a \b Blaze operation results in
+// undefined behavior.
+*/
+inline void setThreshold( const std::string& name, size_t value )
+{
+   const size_t index( ThresholdTable<size_t>::find( name ) );
+
+   if( value == 0UL && std::string( ThresholdTable<size_t>::names[index] ).compare( 0UL, 4UL, "SMP_" ) != 0 ) {
+      throw std::invalid_argument( "Invalid threshold value" );
+   }
+
+   ThresholdTable<size_t>::values[index] = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading the thresholds from the given threshold file.
+// \ingroup system
+//
+// \param filename The name of the threshold file.
+// \return void
+// \exception std::runtime_error Threshold file could not be opened.
+// \exception std::invalid_argument Invalid threshold name.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function loads the thresholds from the given threshold file. The file uses the same
+// format as <em>./blaze/config/Thresholds.h</em>, i.e. every threshold is specified by a
+// preprocessor definition:
+
+   \code
+   #define BLAZE_SMP_DMATDVECMULT_THRESHOLD 1200UL
+   #define BLAZE_DMATDMATMULT_THRESHOLD 4900UL
+   \endcode
+
+// All other lines, including comments and include guards, are ignored. Therefore a threshold
+// file generated by the calibration tool of the Blaze benchmark suite can be used both at
+// runtime and at compile time (i.e. by including it before any \b Blaze header). Thresholds
+// that are not specified in the file keep their current values.
+//
+// Note that changing a threshold while any thread executes a \b Blaze operation results in
+// undefined behavior.
+*/
+inline void loadThresholds( const std::string& filename )
+{
+   std::ifstream file( filename.c_str() );
+
+   if( !file ) {
+      throw std::runtime_error( "Threshold file could not be opened" );
+   }
+
+   const std::string suffix( "_THRESHOLD" );
+   std::string line;
+
+   while( std::getline( file, line ) )
+   {
+      std::istringstream iss( line );
+      std::string directive, name, value;
+
+      if( !( iss >> directive >> name >> value ) || directive != "#define" ||
+          name.size() <= suffix.size() ||
+          name.compare( name.size() - suffix.size(), suffix.size(), suffix ) != 0 )
+         continue;
+
+      const size_t pos( value.find_first_not_of( "0123456789" ) );
+
+      if( pos == 0UL || ( pos != std::string::npos &&
+                          value.find_first_not_of( "uUlL", pos ) != std::string::npos ) ) {
+         throw std::invalid_argument( "Invalid threshold value" );
+      }
+
+      setThreshold( name, std::strtoul( value.c_str(), NULL, 10 ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLDTABLE UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the given threshold.
+//
+// \param name The name of the threshold, with or without the \c BLAZE_ prefix.
+// \return The index of the threshold.
+// \exception std::invalid_argument Invalid threshold name.
+*/
+template< typename T >  // Type of the threshold values
+size_t ThresholdTable<T>::find( const std::string& name )
+{
+   const size_t offset( ( name.compare( 0UL, 6UL, "BLAZE_" ) == 0 )?( 6UL ):( 0UL ) );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      if( name.compare( offset, std::string::npos, names[i] ) == 0 )
+         return i;
+   }
+
+   throw std::invalid_argument( "Invalid threshold name" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the thresholds from the environment.
+//
+// \return \a true after the initialization.
+//
+// This function adapts the thresholds to the environment. First, the threshold file specified
+// by the \c BLAZE_THRESHOLD_FILE environment variable is loaded. Second, every threshold is
+// set to the value of the environment variable of the same name (e.g. the environment variable
+// \c BLAZE_SMP_DMATDVECMULT_THRESHOLD for the \c SMP_DMATDVECMULT_THRESHOLD). In case the
+// threshold file cannot be loaded or an environment variable contains an invalid value, the
+// according setting is ignored. The initialization is performed only once per program.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename T >  // Type of the threshold values
+bool ThresholdTable<T>::initialize()
+{
+   if( initialized )
+      return true;
+
+   initialized = true;
+
+   const char* file = std::getenv( "BLAZE_THRESHOLD_FILE" );
+
+   if( file != NULL ) {
+      try {
+         loadThresholds( file );
+      }
+      catch( std::exception& ) {}
+   }
+
+   for( size_t i=0UL; i<size; ++i )
+   {
+      const char* env = std::getenv( ( std::string( "BLAZE_" ) + names[i] ).c_str() );
+
+      if( env == NULL )
+         continue;
+
+      char* end( NULL );
+      const unsigned long value( std::strtoul( env, &end, 10 ) );
+
+      if( end == env || *end != '\0' )
+         continue;
+
+      try {
+         setThreshold( names[i], value );
+      }
+      catch( std::exception& ) {}
+   }
+
+   return true;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+const bool thresholdsInitialized = ThresholdTable<size_t>::initialize();
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+#endif
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -66,59 +685,65 @@
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
-
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_DMATDVECMULT_THRESHOLD       > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDMATDVECMULT_THRESHOLD      > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDVECDMATMULT_THRESHOLD      > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDVECTDMATMULT_THRESHOLD     > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_DMATDMATMULT_THRESHOLD       > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_DMATTDMATMULT_THRESHOLD      > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDMATDMATMULT_THRESHOLD      > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDMATTDMATMULT_THRESHOLD     > 0UL );
+
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECASSIGN_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_BSMATDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATASSIGN_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDMATADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_BSMATDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATCONVERSION_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_PGS_THRESHOLD            >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TRSV_THRESHOLD           >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_CHOLESKY_THRESHOLD       >= 0UL );
 
 }
 /*! \endcond */
@@ -0,0 +1,467 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ScratchArena.h
+//  \brief Header file for the thread-local scratch arena
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SCRATCHARENA_H_
+#define _BLAZE_UTIL_SCRATCHARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/ScratchArena.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-local, stack-like memory arena for temporaries.
+// \ingroup util
+//
+// The ScratchArena class provides each thread of execution with a single, 64-byte aligned memory
+// block, from which the memory for short-lived temporaries is taken in a stack-like fashion. An
+// allocation moves the top of the stack upwards, a deallocation of the topmost allocation moves
+// it back down. Allocations that are not released in reverse order are marked as free and are
+// reclaimed as soon as all allocations above them have been released.\n
+// In case a request does not fit into the remaining memory of the arena, the memory is allocated
+// dynamically and the required size is recorded. As soon as the arena is empty again, it is
+// enlarged to the largest recorded demand (but not beyond the \a scratchArenaLimit). Thus after
+// a short warm-up phase repeated evaluations do not perform any dynamic memory allocation.\n
+// Since the state of the arena is thread-local, it can be used from within the threads of the
+// shared-memory parallelization without any synchronization. Note however that the memory of
+// an arena must be released by the same thread that allocated it.\n
+// The arena is used by the DynamicVector and DynamicMatrix class templates for the temporaries
+// of expressions (see the ScratchTemporary class). This class must \b NOT be used explicitly!
+// It is reserved for internal use only.
+*/
+template< typename T >  // Dummy type for the static member initialization
+class ScratchArena
+{
+ public:
+   //**********************************************************************************************
+   enum { alignment = 64UL };  //!< Alignment of all allocations of the arena.
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   static inline void arm    ();
+   static inline void disarm ();
+   static inline bool consume();
+
+   template< typename Type >
+   static inline Type* allocate( size_t n );
+
+   static inline bool owns      ( const void* address );
+   static inline void deallocate( const void* address );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t capacity();
+   static inline size_t size    ();
+   static inline void   release ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private struct Header***********************************************************************
+   /*!\brief Header of a single allocation of the scratch arena.
+   */
+   struct Header
+   {
+      Header* prev_;  //!< The header of the previous allocation.
+      bool    free_;  //!< Flag for an allocation that has already been released.
+   };
+   //**********************************************************************************************
+
+   //**Private struct Cleanup**********************************************************************
+#if __cplusplus >= 201103L
+   /*!\brief Releases the memory of the arena of a thread at the end of the thread.
+   */
+   struct Cleanup
+   {
+      inline ~Cleanup() {
+         deallocate_backend( begin_ );
+         begin_ = NULL;
+         end_   = NULL;
+         top_   = NULL;
+      }
+   };
+#endif
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t ceil ( size_t bytes );
+   static        void   grow ();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static BLAZE_THREAD_LOCAL byte*   begin_;   //!< The first byte of the arena.
+   static BLAZE_THREAD_LOCAL byte*   end_;     //!< The byte one past the last byte of the arena.
+   static BLAZE_THREAD_LOCAL byte*   top_;     //!< The first unused byte of the arena.
+   static BLAZE_THREAD_LOCAL Header* last_;    //!< The header of the topmost allocation.
+   static BLAZE_THREAD_LOCAL size_t  demand_;  //!< The largest recorded demand in bytes.
+   static BLAZE_THREAD_LOCAL bool    armed_;   //!< Flag for the arena allocation of the next temporary.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+// Note that the pointers are initialized with 0 instead of NULL since thread-local variables
+// require a constant initialization.
+template< typename T >
+BLAZE_THREAD_LOCAL byte* ScratchArena<T>::begin_ = 0;
+
+template< typename T >
+BLAZE_THREAD_LOCAL byte* ScratchArena<T>::end_ = 0;
+
+template< typename T >
+BLAZE_THREAD_LOCAL byte* ScratchArena<T>::top_ = 0;
+
+template< typename T >
+BLAZE_THREAD_LOCAL typename ScratchArena<T>::Header* ScratchArena<T>::last_ = 0;
+
+template< typename T >
+BLAZE_THREAD_LOCAL size_t ScratchArena<T>::demand_ = 0UL;
+
+template< typename T >
+BLAZE_THREAD_LOCAL bool ScratchArena<T>::armed_ = false;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Requests the arena allocation of the next temporary of the calling thread.
+//
+// \return void
+//
+// This function marks the next allocation of a temporary on the calling thread to be taken from
+// the scratch arena. The request is consumed by the allocation (see the consume() function) or
+// withdrawn via the disarm() function. In case the scratch arena is deactivated (see the
+// \a useScratchArena switch), the function has no effect.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline void ScratchArena<T>::arm()
+{
+   armed_ = scratchArenaActive;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Withdraws a pending arena allocation request of the calling thread.
+//
+// \return void
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline void ScratchArena<T>::disarm()
+{
+   armed_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Consumes a pending arena allocation request of the calling thread.
+//
+// \return \a true in case an arena allocation was requested, \a false if not.
+//
+// This function returns whether the next allocation of the calling thread has been requested to
+// be taken from the scratch arena. The request is reset, i.e. it only affects a single allocation.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline bool ScratchArena<T>::consume()
+{
+   const bool request( armed_ );
+   armed_ = false;
+   return request;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates an array of built-in elements from the arena of the calling thread.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first element of the 64-byte aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// In case the request does not fit into the remaining memory of the arena, the memory is taken
+// from the free store via the allocate() function. Therefore the memory must always be released
+// via the deallocate() function of the arena or, in case it is not owned by the arena (see the
+// owns() function), via the global deallocate() function.
+*/
+template< typename T >     // Dummy type for the static member initialization
+template< typename Type >  // Type of the elements
+inline Type* ScratchArena<T>::allocate( size_t n )
+{
+   BLAZE_STATIC_ASSERT( IsBuiltin<Type>::value );
+   BLAZE_STATIC_ASSERT( size_t( AlignmentOf<Type>::value ) <= size_t( alignment ) );
+   BLAZE_STATIC_ASSERT( sizeof(Header) <= size_t( alignment ) );
+
+   // Empty arrays occupy a single alignment unit such that all addresses lie within the arena
+   const size_t bytes( alignment + ceil( ( n > 0UL )?( n*sizeof(Type) ):( 1UL ) ) );
+
+   if( last_ == NULL && demand_ > size_t( end_ - begin_ ) )
+      grow();
+
+   if( bytes > size_t( end_ - top_ ) ) {
+      const size_t required( size_t( top_ - begin_ ) + bytes );
+      if( required <= scratchArenaLimit && required > demand_ )
+         demand_ = required;
+      return blaze::allocate<Type>( n );
+   }
+
+   Header* const header( reinterpret_cast<Header*>( top_ ) );
+   header->prev_ = last_;
+   header->free_ = false;
+
+   last_ = header;
+   top_ += bytes;
+
+   return reinterpret_cast<Type*>( reinterpret_cast<byte*>( header ) + alignment );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given memory is owned by the arena of the calling thread.
+//
+// \param address The address of the first element of the array.
+// \return \a true in case the memory is owned by the arena, \a false if not.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline bool ScratchArena<T>::owns( const void* address )
+{
+   const byte* const ptr( reinterpret_cast<const byte*>( address ) );
+   return ptr >= begin_ && ptr < end_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases memory of the arena of the calling thread.
+//
+// \param address The address of the first element of the array to be released.
+// \return void
+//
+// This function releases the given memory, which must have been allocated from the arena of the
+// calling thread. In case the memory is the topmost allocation of the arena, the top of the arena
+// is moved down past all released allocations. Otherwise the memory is reclaimed as soon as all
+// allocations above it have been released.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline void ScratchArena<T>::deallocate( const void* address )
+{
+   BLAZE_INTERNAL_ASSERT( owns( address ), "Invalid arena address detected" );
+
+   Header* const header( reinterpret_cast<Header*>( const_cast<byte*>(
+      reinterpret_cast<const byte*>( address ) - alignment ) ) );
+
+   BLAZE_INTERNAL_ASSERT( !header->free_, "Repeated release of arena memory detected" );
+
+   header->free_ = true;
+
+   while( last_ != NULL && last_->free_ ) {
+      top_  = reinterpret_cast<byte*>( last_ );
+      last_ = last_->prev_;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the capacity of the arena of the calling thread.
+//
+// \return The capacity of the arena in bytes.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline size_t ScratchArena<T>::capacity()
+{
+   return size_t( end_ - begin_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the currently used memory of the arena of the calling thread.
+//
+// \return The number of bytes between the beginning and the top of the arena.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline size_t ScratchArena<T>::size()
+{
+   return size_t( top_ - begin_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the memory of the arena of the calling thread.
+//
+// \return void
+//
+// This function returns the memory of the arena of the calling thread to the free store and
+// resets the recorded demand. It has no effect in case the arena is currently in use. In C++11
+// the memory is automatically released at the end of a thread. For older C++ standards this
+// function should be called before the end of an application thread that used the arena.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline void ScratchArena<T>::release()
+{
+   if( last_ != NULL )
+      return;
+
+   deallocate_backend( begin_ );
+
+   begin_  = NULL;
+   end_    = NULL;
+   top_    = NULL;
+   demand_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rounds the given number of bytes up to the alignment of the arena.
+//
+// \param bytes The number of bytes.
+// \return The rounded number of bytes.
+*/
+template< typename T >  // Dummy type for the static member initialization
+inline size_t ScratchArena<T>::ceil( size_t bytes )
+{
+   return ( bytes + alignment - 1UL ) & ~size_t( alignment - 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Enlarges the empty arena of the calling thread to the largest recorded demand.
+//
+// \return void
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename T >  // Dummy type for the static member initialization
+void ScratchArena<T>::grow()
+{
+   BLAZE_INTERNAL_ASSERT( last_ == NULL, "Invalid growth of an active arena" );
+
+#if __cplusplus >= 201103L
+   static thread_local Cleanup cleanup;
+   UNUSED_PARAMETER( cleanup );
+#endif
+
+   deallocate_backend( begin_ );
+
+   begin_ = NULL;
+   end_   = NULL;
+   top_   = NULL;
+
+   begin_ = allocate_backend( demand_, alignment );
+   end_   = begin_ + demand_;
+   top_   = begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The scratch arena of the Blaze library.
+// \ingroup util
+*/
+typedef ScratchArena<int>  TheScratchArena;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -142,7 +142,7 @@ template<> struct STATIC_ASSERTION_FAILED<true> { enum { value = 1 }; };
 */
 #define BLAZE_STATIC_ASSERT(expr) \
    typedef ::blaze::STATIC_ASSERTION_TEST< ::blaze::STATIC_ASSERTION_FAILED< (expr) != 0 >::value > \
-      BLAZE_JOIN( BLAZE_STATIC_ASSERTION_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( BLAZE_STATIC_ASSERTION_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
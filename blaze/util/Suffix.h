@@ -52,4 +52,22 @@
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Helper macro for marking compile time check typedefs as unused.
+// \ingroup util
+//
+// The compile time checks (static assertions and constraints) are realized by typedefs that are
+// never referenced. This macro marks these typedefs as unused in order to prevent warnings of
+// GNU compatible compilers for typedefs that are locally defined but not used.
+*/
+#if defined(__GNUC__) || defined(__clang__)
+#  define BLAZE_UNUSED_TYPEDEF __attribute__((unused))
+#else
+#  define BLAZE_UNUSED_TYPEDEF
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
 #endif
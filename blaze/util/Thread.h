@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <boost/atomic.hpp>
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <blaze/util/Assert.h>
@@ -320,12 +321,12 @@ class Thread : private NonCopyable
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile bool   terminated_;  //!< Thread termination flag.
-                                 /*!< This flag value is used by the managing thread
-                                      pool to learn whether the thread has terminated
-                                      its execution. */
-   ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
-   ThreadHandle    thread_;      //!< Handle to the thread of execution.
+   boost::atomic<bool> terminated_;  //!< Thread termination flag.
+                                     /*!< This flag value is used by the managing thread
+                                          pool to learn whether the thread has terminated
+                                          its execution. */
+   ThreadPoolType*     pool_;        //!< Handle to the managing thread pool.
+   ThreadHandle        thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
 
@@ -616,7 +617,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool Thread<TT,MT,LT,CT>::hasTerminated() const
 {
-   return terminated_;
+   return terminated_.load( boost::memory_order_acquire );
 }
 //*************************************************************************************************
 
@@ -647,7 +648,7 @@ void Thread<TT,MT,LT,CT>::run()
    while( pool_->executeTask() ) {}
 
    // Setting the termination flag
-   terminated_ = true;
+   terminated_.store( true, boost::memory_order_release );
 }
 //*************************************************************************************************
 
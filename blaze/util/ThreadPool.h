@@ -41,12 +41,15 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <boost/atomic.hpp>
 #include <boost/bind.hpp>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/PtrVector.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Backoff.h>
 #include <blaze/util/threadpool/Task.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
@@ -144,6 +147,24 @@ namespace blaze {
 // For more information about the standard thread functionality, see [1] or [2] or the current
 // documentation at the Boost homepage: www.boost.org.
 //
+// Scheduled tasks are stored in a bounded, lock-free task queue. Each function/functor (and its
+// bound arguments) is copied in-place into the queue, i.e. scheduling a task does not allocate
+// any dynamic memory as long as the callable fits into the fixed-size buffer of a task (see
+// threadpool::Task). The mutex of the thread pool is only acquired in order to wake up idle
+// threads or in case the task queue is full, in which case the scheduling thread blocks until
+// the already scheduled tasks have been completed. Idle threads first poll the task queue for
+// \c SMP_SPIN_TIME microseconds, then yield their time slice for \c SMP_YIELD_TIME microseconds
+// and only afterwards block until a new task is scheduled (see threadpool::Backoff). This
+// avoids the wake-up latency for back-to-back parallel operations.
+//
+// Optionally, the threads of the pool can be pinned to specific CPUs by passing a
+// threadpool::Affinity to the constructor or to the setAffinity() function, e.g. in order to
+// spread the threads evenly over the sockets of a NUMA system:
+
+   \code
+   StdThreadPool threadpool( 8, threadpool::Affinity( "scatter" ) );
+   \endcode
+
 //
 // \section threadpool_setup Using the ThreadPool class
 //
@@ -323,7 +344,7 @@ class ThreadPool : private NonCopyable
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, const threadpool::Affinity& affinity=threadpool::Affinity() );
    //@}
    //**********************************************************************************************
 
@@ -370,18 +391,28 @@ class ThreadPool : private NonCopyable
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   void resize( size_t n, bool block=false );
-   void wait();
-   void clear();
+   void resize     ( size_t n, bool block=false );
+   void wait       ();
+   void clear      ();
+   void setAffinity( const threadpool::Affinity& affinity );
    //@}
    //**********************************************************************************************
 
  private:
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   void push( const Callable& func );
+   //@}
+   //**********************************************************************************************
+
    //**Thread functions****************************************************************************
    /*!\name Thread functions */
    //@{
    void createThread();
-   bool executeTask();
+   void pinThreads  ();
+   bool executeTask ();
    //@}
    //**********************************************************************************************
 
@@ -393,7 +424,9 @@ class ThreadPool : private NonCopyable
                                /*!< This number may differ from the total number of threads
                                     during a resize of the thread pool. */
    volatile size_t active_;    //!< Number of currently active/busy threads.
+   boost::atomic<size_t> sleeping_;  //!< Number of threads waiting for a new task.
    Threads threads_;           //!< The threads contained in the thread pool.
+   threadpool::Affinity affinity_;  //!< The placement of the threads on the CPUs.
    TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
    mutable Mutex mutex_;       //!< Synchronization mutex.
    Condition waitForTask_;     //!< Wait condition for idle threads.
@@ -422,19 +455,23 @@ class ThreadPool : private NonCopyable
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param affinity The placement of the threads on the CPUs of the system.
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. In case the given \a affinity is not empty, the
+// thread with index \a i is pinned to the \a i-th CPU of the affinity (see threadpool::Affinity).
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, const threadpool::Affinity& affinity )
    : total_     ( 0 )  // Total number of threads in the thread pool
    , expected_  ( 0 )  // Expected number of threads in the thread pool
    , active_    ( 0 )  // Number of currently active/busy threads
+   , sleeping_  ( 0 )  // Number of threads waiting for a new task
    , threads_      ()  // The threads contained in the thread pool
+   , affinity_     ( affinity )  // The placement of the threads on the CPUs
    , taskqueue_    ()  // Task queue for the scheduled tasks
    , mutex_        ()  // Synchronization mutex
    , waitForTask_  ()  // Wait condition for idle threads
@@ -592,9 +629,7 @@ template< typename TT          // Type of the encapsulated thread
 template< typename Callable >  // Type of the function/functor
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( func );
-   waitForTask_.notify_one();
+   push( func );
 }
 //*************************************************************************************************
 
@@ -617,9 +652,7 @@ template< typename Callable  // Type of the function/functor
         , typename A1 >      // Type of the first argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1 ) );
-   waitForTask_.notify_one();
+   push( boost::bind<void>( func, a1 ) );
 }
 //*************************************************************************************************
 
@@ -644,9 +677,7 @@ template< typename Callable  // Type of the function/functor
         , typename A2 >      // Type of the second argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2 ) );
-   waitForTask_.notify_one();
+   push( boost::bind<void>( func, a1, a2 ) );
 }
 //*************************************************************************************************
 
@@ -673,9 +704,7 @@ template< typename Callable  // Type of the function/functor
         , typename A3 >      // Type of the third argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3 ) );
-   waitForTask_.notify_one();
+   push( boost::bind<void>( func, a1, a2, a3 ) );
 }
 //*************************************************************************************************
 
@@ -704,9 +733,7 @@ template< typename Callable  // Type of the function/functor
         , typename A4 >      // Type of the fourth argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3, a4 ) );
-   waitForTask_.notify_one();
+   push( boost::bind<void>( func, a1, a2, a3, a4 ) );
 }
 //*************************************************************************************************
 
@@ -737,9 +764,44 @@ template< typename Callable  // Type of the function/functor
         , typename A5 >      // Type of the fifth argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3, a4, a5 ) );
-   waitForTask_.notify_one();
+   push( boost::bind<void>( func, a1, a2, a3, a4, a5 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Adding the given function/functor to the task queue.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function adds the given function/functor to the lock-free task queue and wakes up an
+// idle thread, if necessary. The thread pool is only locked in case an idle thread has to be
+// notified or in case the task queue is full. In the latter case the function blocks until
+// the currently scheduled tasks have been completed.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+void ThreadPool<TT,MT,LT,CT>::push( const Callable& func )
+{
+   while( !taskqueue_.push( func ) )
+   {
+      Lock lock( mutex_ );
+
+      while( !taskqueue_.isEmpty() && active_ > 0 ) {
+         waitForThread_.wait( lock );
+      }
+   }
+
+   if( sleeping_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
 }
 //*************************************************************************************************
 
@@ -832,6 +894,8 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
          }
          else ++thread;
       }
+
+      pinThreads();
    }
 }
 //*************************************************************************************************
@@ -859,6 +923,30 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Changing the placement of the threads on the CPUs of the system.
+//
+// \param affinity The new placement of the threads.
+// \return void
+//
+// This function pins the thread with index \a i of the thread pool to the \a i-th CPU of the
+// given affinity (see threadpool::Affinity). The placement also applies to all threads that
+// are added to the thread pool later on. In case the given affinity is empty, the placement
+// of the currently running threads remains unchanged.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setAffinity( const threadpool::Affinity& affinity )
+{
+   Lock lock( mutex_ );
+   affinity_ = affinity;
+   pinThreads();
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Removing all scheduled tasks from the thread pool.
 //
@@ -906,14 +994,39 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pinning all threads of the thread pool according to the current affinity.
+//
+// \return void
+//
+// This function must only be called while holding the lock of the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::pinThreads()
+{
+   if( affinity_.isEmpty() )
+      return;
+
+   size_t index( 0UL );
+   for( typename Threads::Iterator thread=threads_.begin(); thread!=threads_.end(); ++thread ) {
+      affinity_.pin( thread->thread_->native_handle(), index++ );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
 // \return \a true in case a task was successfully finished, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// In case there is no task available, the thread polls the task queue according to the hybrid
+// wait policy of the threadpool::Backoff class and finally blocks and waits for a new task to
+// be scheduled.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -921,32 +1034,47 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 bool ThreadPool<TT,MT,LT,CT>::executeTask()
 {
-   threadpool::Task task;
+   // Executing a scheduled task without locking the thread pool
+   if( taskqueue_.execute() )
+      return true;
 
-   // Acquiring a scheduled task
-   {
-      Lock lock( mutex_ );
+   // Polling for a new task according to the hybrid wait policy
+   threadpool::Backoff backoff;
+
+   while( backoff.wait() ) {
+      if( taskqueue_.execute() )
+         return true;
+   }
+
+   // Blocking until a new task is scheduled
+   Lock lock( mutex_ );
 
-      while( taskqueue_.isEmpty() )
-      {
-         --active_;
+   --active_;
+   waitForThread_.notify_all();
+
+   while( true )
+   {
+      if( total_ > expected_ ) {
+         --total_;
          waitForThread_.notify_all();
+         return false;
+      }
 
-         if( total_ > expected_ ) {
-            --total_;
-            return false;
-         }
+      // Announcing the idle thread before checking the task queue a last time. In combination
+      // with the check of the number of sleeping threads in push(), this guarantees that
+      // either the idle thread finds the new task or the scheduling thread wakes it up.
+      ++sleeping_;
 
-         waitForTask_.wait( lock );
-         ++active_;
+      if( !taskqueue_.isEmpty() ) {
+         --sleeping_;
+         break;
       }
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+      waitForTask_.wait( lock );
+      --sleeping_;
    }
 
-   // Executing the task
-   task();
+   ++active_;
 
    return true;
 }
@@ -80,7 +80,7 @@ template<> struct CONSTRAINT_MUST_BE_ARITHMETIC_TYPE_FAILED<true> { enum { value
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_ARITHMETIC_TYPE_FAILED< ::blaze::IsArithmetic<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_ARITHMETIC_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_ARITHMETIC_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -118,7 +118,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_ARITHMETIC_TYPE_FAILED<true> { enum { v
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_ARITHMETIC_TYPE_FAILED< !::blaze::IsArithmetic<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_ARITHMETIC_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_ARITHMETIC_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -79,7 +79,7 @@ template<> struct CONSTRAINT_MUST_BE_BASE_OF_FAILED<true> { enum { value = 1 };
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_BASE_OF_FAILED< ::blaze::IsBaseOf<B,D>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_BASE_OF_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_BASE_OF_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -118,7 +118,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_BASE_OF_FAILED<true> { enum { value = 1
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_BASE_OF_FAILED< !::blaze::IsBaseOf<B,D>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_BASE_OF_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_BASE_OF_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -159,7 +159,7 @@ template<> struct CONSTRAINT_MUST_BE_STRICTLY_BASE_OF_FAILED<true> { enum { valu
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_STRICTLY_BASE_OF_FAILED< ::blaze::IsBaseOf<B,D>::value && \
                                                              !::blaze::IsBaseOf<D,B>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_STRICTLY_BASE_OF_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_STRICTLY_BASE_OF_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -200,7 +200,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_STRICTLY_BASE_OF_FAILED<true> { enum {
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_STRICTLY_BASE_OF_FAILED< !::blaze::IsBaseOf<B,D>::value || \
                                                                    ::blaze::IsBaseOf<D,B>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOTBE_STRICTLY_BASE_OF_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOTBE_STRICTLY_BASE_OF_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
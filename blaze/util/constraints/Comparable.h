@@ -80,7 +80,7 @@ template<> struct CONSTRAINT_POINTER_MUST_BE_COMPARABLE_FAILED<true> { enum { va
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_POINTER_MUST_BE_COMPARABLE_FAILED< ::blaze::IsConvertible<P1,P2>::value || \
                                                                 ::blaze::IsConvertible<P2,P1>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_POINTER_MUST_BE_COMPARABLE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_POINTER_MUST_BE_COMPARABLE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -79,7 +79,7 @@ template<> struct CONSTRAINT_MUST_BE_DERIVED_FROM_FAILED<true> { enum { value =
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_DERIVED_FROM_FAILED< ::blaze::IsBaseOf<B,D>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_DERIVED_FROM_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_DERIVED_FROM_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -118,7 +118,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_DERIVED_FROM_FAILED<true> { enum { valu
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_DERIVED_FROM_FAILED< !::blaze::IsBaseOf<B,D>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_DERIVED_FROM_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_DERIVED_FROM_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -159,7 +159,7 @@ template<> struct CONSTRAINT_MUST_BE_STRICTLY_DERIVED_FROM_FAILED<true> { enum {
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_STRICTLY_DERIVED_FROM_FAILED< ::blaze::IsBaseOf<B,D>::value && \
                                                                   !::blaze::IsBaseOf<D,B>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_STRICTLY_DERIVED_FROM_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_STRICTLY_DERIVED_FROM_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -200,7 +200,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_STRICTLY_DERIVED_FROM_FAILED<true> { en
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_STRICTLY_DERIVED_FROM_FAILED< !::blaze::IsBaseOf<B,D>::value || \
                                                                         ::blaze::IsBaseOf<D,B>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_STRICTLY_DERIVED_FROM_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_STRICTLY_DERIVED_FROM_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -81,7 +81,7 @@ template<> struct CONSTRAINT_MUST_BE_DOUBLE_TYPE_FAILED<true> { enum { value = 1
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_DOUBLE_TYPE_FAILED< ::blaze::IsDouble<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_DOUBLE_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_DOUBLE_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -121,7 +121,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_DOUBLE_TYPE_FAILED<true> { enum { value
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_DOUBLE_TYPE_FAILED< !::blaze::IsDouble<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_DOUBLE_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_DOUBLE_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
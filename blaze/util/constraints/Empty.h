@@ -79,7 +79,7 @@ template<> struct CONSTRAINT_MUST_BE_EMPTY_FAILED<true> { enum { value = 1 }; };
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_EMPTY_FAILED< ::blaze::IsEmpty<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_EMPTY_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_EMPTY_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -117,7 +117,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_EMPTY_FAILED<true> { enum { value = 1 }
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_EMPTY_FAILED< !::blaze::IsEmpty<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_EMPTY_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_EMPTY_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
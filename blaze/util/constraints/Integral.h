@@ -79,7 +79,7 @@ template<> struct CONSTRAINT_MUST_BE_INTEGRAL_TYPE_FAILED<true> { enum { value =
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_INTEGRAL_TYPE_FAILED< ::blaze::IsIntegral<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_INTEGRAL_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_INTEGRAL_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -117,7 +117,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_INTEGRAL_TYPE_FAILED<true> { enum { val
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_INTEGRAL_TYPE_FAILED< !::blaze::IsIntegral<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_INTEGRAL_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_INTEGRAL_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
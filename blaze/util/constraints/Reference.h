@@ -79,7 +79,7 @@ template<> struct CONSTRAINT_MUST_BE_REFERENCE_TYPE_FAILED<true> { enum { value
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_BE_REFERENCE_TYPE_FAILED< ::blaze::IsReference<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_BE_REFERENCE_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_BE_REFERENCE_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -117,7 +117,7 @@ template<> struct CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE_FAILED<true> { enum { va
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE_FAILED< !::blaze::IsReference<T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -79,7 +79,7 @@ template<> struct CONSTRAINT_MUST_HAVE_SAME_SIZE_FAILED<true> { enum { value = 1
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_HAVE_SAME_SIZE_FAILED< ::blaze::HaveSameSize<T1,T2>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_SAME_SIZE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_HAVE_SAME_SIZE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -117,7 +117,7 @@ template<> struct CONSTRAINT_MUST_NOT_HAVE_SAME_SIZE_FAILED<true> { enum { value
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_MUST_NOT_HAVE_SAME_SIZE_FAILED< !::blaze::HaveSameSize<T1,T2>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_MUST_NOT_HAVE_SAME_SIZE_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_MUST_NOT_HAVE_SAME_SIZE_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -80,7 +80,7 @@ template<> struct CONSTRAINT_SOFT_TYPE_RESTRICTION_FAILED<true> { enum { value =
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_SOFT_TYPE_RESTRICTION_FAILED< ::blaze::ContainsRelated<TYPELIST,T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_SOFT_TYPE_RESTRICTION_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_SOFT_TYPE_RESTRICTION_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 
@@ -119,7 +119,7 @@ template<> struct CONSTRAINT_TYPE_RESTRICTION_FAILED<true> { enum { value = 1 };
    typedef \
       ::blaze::CONSTRAINT_TEST< \
          ::blaze::CONSTRAINT_TYPE_RESTRICTION_FAILED< ::blaze::Contains<TYPELIST,T>::value >::value > \
-      BLAZE_JOIN( CONSTRAINT_TYPE_RESTRICTION_TYPEDEF, __LINE__ )
+      BLAZE_JOIN( CONSTRAINT_TYPE_RESTRICTION_TYPEDEF, __LINE__ ) BLAZE_UNUSED_TYPEDEF
 //*************************************************************************************************
 
 } // namespace blaze
@@ -0,0 +1,529 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Affinity.h
+//  \brief Thread affinity and processor topology for thread pools
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+#define _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <pthread.h>
+#  include <sched.h>
+#  include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Placement of the threads of a thread pool on the processors of the system.
+// \ingroup threads
+//
+// The Affinity class represents an ordered list of logical processors (CPUs). The thread with
+// index \a i of a thread pool is pinned to the CPU with index \f$ i \bmod size() \f$ of the
+// list. The list is created from a textual specification:
+//
+//  - \c "compact": The available CPUs ordered by socket, core and hardware thread, i.e. the
+//    threads fill up the cores of the first socket before the next socket is used.
+//  - \c "scatter": The available CPUs ordered such that consecutive threads are distributed
+//    round-robin over the sockets, using all cores before the second hardware thread of a core.
+//  - An explicit list of CPU indices and CPU ranges, as for instance \c "0,2,4-7".
+//  - An empty string or \c "none": No pinning, the operating system places the threads.
+
+   \code
+   threadpool::Affinity affinity( "scatter" );
+
+   affinity.pin( 3UL );  // Pinning the calling thread to the fourth CPU of the list
+   \endcode
+
+// Only the CPUs the process is allowed to run on are considered for the \c "compact" and
+// \c "scatter" policies. The topology of the system is currently only evaluated on Linux
+// systems; on other systems both policies result in the natural order of the CPUs. Pinning
+// is supported on Linux and Windows systems and has no effect on all other systems.
+*/
+class Affinity
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Affinity();
+   explicit inline Affinity( const std::string& spec );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t size()    const;
+   inline size_t operator[]( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool pin( size_t index ) const;
+
+   template< typename Handle >
+   inline bool pin( Handle handle, size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief Location of a single CPU within the topology of the system.
+   */
+   struct Location
+   {
+      size_t cpu_;      //!< The index of the CPU.
+      size_t package_;  //!< The index of the socket.
+      size_t core_;     //!< The rank of the core within its socket.
+      size_t sibling_;  //!< The rank of the CPU within its core.
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Ordering of the CPUs for the compact placement policy.
+   */
+   struct CompactOrder
+   {
+      inline bool operator()( const Location& a, const Location& b ) const {
+         if( a.package_ != b.package_ ) return a.package_ < b.package_;
+         if( a.core_    != b.core_    ) return a.core_    < b.core_;
+         return a.sibling_ < b.sibling_;
+      }
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Ordering of the CPUs for the scatter placement policy.
+   */
+   struct ScatterOrder
+   {
+      inline bool operator()( const Location& a, const Location& b ) const {
+         if( a.sibling_ != b.sibling_ ) return a.sibling_ < b.sibling_;
+         if( a.core_    != b.core_    ) return a.core_    < b.core_;
+         return a.package_ < b.package_;
+      }
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void   parse   ( const std::string& list, std::vector<size_t>& cpus );
+   static inline size_t number  ( const std::string& list, size_t& pos );
+   static inline void   topology( std::vector<Location>& locations );
+   static inline size_t readId  ( size_t cpu, const char* name );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> cpus_;  //!< The ordered list of CPUs.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the Affinity class.
+//
+// The default constructor creates an empty CPU list, i.e. threads are not pinned.
+*/
+inline Affinity::Affinity()
+   : cpus_()  // The ordered list of CPUs
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the Affinity class.
+//
+// \param spec The affinity specification (\c "compact", \c "scatter", \c "none", or a CPU list).
+// \exception std::invalid_argument Invalid affinity specification.
+//
+// This constructor creates the CPU list according to the given specification. Whitespace
+// within the specification is ignored. In case the specification is invalid, a
+// \a std::invalid_argument exception is thrown.
+*/
+inline Affinity::Affinity( const std::string& spec )
+   : cpus_()  // The ordered list of CPUs
+{
+   std::string list;
+   for( std::string::const_iterator c=spec.begin(); c!=spec.end(); ++c ) {
+      if( *c != ' ' && *c != '\t' )
+         list += *c;
+   }
+
+   if( list.empty() || list == "none" )
+      return;
+
+   if( list == "compact" || list == "scatter" )
+   {
+      std::vector<Location> locations;
+      topology( locations );
+
+      if( list == "compact" )
+         std::stable_sort( locations.begin(), locations.end(), CompactOrder() );
+      else
+         std::stable_sort( locations.begin(), locations.end(), ScatterOrder() );
+
+      for( size_t i=0UL; i<locations.size(); ++i )
+         cpus_.push_back( locations[i].cpu_ );
+   }
+   else parse( list, cpus_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the CPU list is empty, i.e. whether threads remain unpinned.
+//
+// \return \a true in case the CPU list is empty, \a false if not.
+*/
+inline bool Affinity::isEmpty() const
+{
+   return cpus_.empty();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of CPUs in the CPU list.
+//
+// \return The number of CPUs.
+*/
+inline size_t Affinity::size() const
+{
+   return cpus_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPU assigned to the thread with the given index.
+//
+// \param index The index of the thread.
+// \return The index of the assigned CPU.
+//
+// In case there are more threads than CPUs in the list, the CPUs are assigned cyclically.
+// Note that the CPU list must not be empty.
+*/
+inline size_t Affinity::operator[]( size_t index ) const
+{
+   return cpus_[index % cpus_.size()];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pins the calling thread to the CPU assigned to the given thread index.
+//
+// \param index The index of the calling thread.
+// \return \a true in case the thread has been pinned, \a false if not.
+*/
+inline bool Affinity::pin( size_t index ) const
+{
+#if defined(_WIN32)
+   return pin( GetCurrentThread(), index );
+#else
+   return pin( pthread_self(), index );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the given thread to the CPU assigned to the given thread index.
+//
+// \param handle The native handle of the thread.
+// \param index The index of the thread.
+// \return \a true in case the thread has been pinned, \a false if not.
+//
+// In case the CPU list is empty or pinning is not supported on the system, the function has
+// no effect and returns \a false.
+*/
+template< typename Handle >  // Type of the native thread handle
+inline bool Affinity::pin( Handle handle, size_t index ) const
+{
+   if( cpus_.empty() )
+      return false;
+
+   const size_t cpu( (*this)[index] );
+
+#if defined(__linux__)
+   if( cpu >= CPU_SETSIZE )
+      return false;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   CPU_SET( cpu, &set );
+   return pthread_setaffinity_np( handle, sizeof( cpu_set_t ), &set ) == 0;
+#elif defined(_WIN32)
+   if( cpu >= 8UL*sizeof( DWORD_PTR ) )
+      return false;
+
+   return SetThreadAffinityMask( handle, DWORD_PTR( 1 ) << cpu ) != 0;
+#else
+   UNUSED_PARAMETER( handle, cpu );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing an explicit list of CPU indices and CPU ranges.
+//
+// \param list The CPU list (for instance \c "0,2,4-7").
+// \param cpus The resulting ordered list of CPUs.
+// \return void
+// \exception std::invalid_argument Invalid affinity specification.
+*/
+inline void Affinity::parse( const std::string& list, std::vector<size_t>& cpus )
+{
+   size_t pos( 0UL );
+
+   while( true )
+   {
+      const size_t first( number( list, pos ) );
+      size_t last( first );
+
+      if( pos < list.size() && list[pos] == '-' ) {
+         last = number( list, ++pos );
+         if( last < first )
+            throw std::invalid_argument( "Invalid affinity specification" );
+      }
+
+      for( size_t cpu=first; cpu<=last; ++cpu )
+         cpus.push_back( cpu );
+
+      if( pos == list.size() )
+         return;
+
+      if( list[pos] != ',' )
+         throw std::invalid_argument( "Invalid affinity specification" );
+      ++pos;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing a single CPU index.
+//
+// \param list The CPU list.
+// \param pos The position of the CPU index within the list; advanced past the index.
+// \return The parsed CPU index.
+// \exception std::invalid_argument Invalid affinity specification.
+*/
+inline size_t Affinity::number( const std::string& list, size_t& pos )
+{
+   const size_t begin( pos );
+   size_t value( 0UL );
+
+   for( ; pos < list.size() && list[pos] >= '0' && list[pos] <= '9'; ++pos ) {
+      value = 10UL*value + static_cast<size_t>( list[pos] - '0' );
+      if( value > 65535UL )
+         throw std::invalid_argument( "Invalid affinity specification" );
+   }
+
+   if( pos == begin )
+      throw std::invalid_argument( "Invalid affinity specification" );
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determining the location of all available CPUs.
+//
+// \param locations The locations of all CPUs the process is allowed to run on.
+// \return void
+//
+// On Linux systems the socket and core of each CPU are read from the \c sysfs file system.
+// On all other systems all CPUs are treated as separate cores of a single socket.
+*/
+inline void Affinity::topology( std::vector<Location>& locations )
+{
+   std::vector<size_t> cpus;
+
+#if defined(__linux__)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   if( sched_getaffinity( 0, sizeof( cpu_set_t ), &set ) == 0 ) {
+      for( size_t cpu=0UL; cpu<CPU_SETSIZE; ++cpu ) {
+         if( CPU_ISSET( cpu, &set ) )
+            cpus.push_back( cpu );
+      }
+   }
+#elif defined(_WIN32)
+   SYSTEM_INFO info;
+   GetSystemInfo( &info );
+   for( size_t cpu=0UL; cpu<info.dwNumberOfProcessors; ++cpu )
+      cpus.push_back( cpu );
+#else
+   const long count( sysconf( _SC_NPROCESSORS_ONLN ) );
+   for( long cpu=0L; cpu<count; ++cpu )
+      cpus.push_back( static_cast<size_t>( cpu ) );
+#endif
+
+   std::vector<size_t> coreIds( cpus.size() );
+   locations.resize( cpus.size() );
+
+   for( size_t i=0UL; i<cpus.size(); ++i ) {
+      locations[i].cpu_     = cpus[i];
+      locations[i].package_ = readId( cpus[i], "physical_package_id" );
+      coreIds[i]            = readId( cpus[i], "core_id" );
+   }
+
+   // Replacing the core IDs by the rank of the core within its socket and determining the rank
+   // of each CPU within its core
+   for( size_t i=0UL; i<locations.size(); ++i )
+   {
+      locations[i].core_    = 0UL;
+      locations[i].sibling_ = 0UL;
+
+      for( size_t j=0UL; j<locations.size(); ++j )
+      {
+         if( locations[j].package_ != locations[i].package_ )
+            continue;
+
+         if( coreIds[j] == coreIds[i] ) {
+            if( j < i ) ++locations[i].sibling_;
+            continue;
+         }
+
+         if( coreIds[j] < coreIds[i] ) {
+            bool first( true );
+            for( size_t k=0UL; k<j && first; ++k ) {
+               if( locations[k].package_ == locations[j].package_ && coreIds[k] == coreIds[j] )
+                  first = false;
+            }
+            if( first ) ++locations[i].core_;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a topology ID of the given CPU.
+//
+// \param cpu The index of the CPU.
+// \param name The name of the topology attribute.
+// \return The ID of the CPU, or the CPU index in case the ID is not available.
+//
+// On Linux systems the ID is read from \c /sys/devices/system/cpu/cpuN/topology/. On all
+// other systems or in case the attribute is not available, the function returns 0 for the
+// socket and the CPU index for the core.
+*/
+inline size_t Affinity::readId( size_t cpu, const char* name )
+{
+   const std::string attribute( name );
+   const size_t fallback( ( attribute == "core_id" )?( cpu ):( 0UL ) );
+
+#if defined(__linux__)
+   std::ostringstream path;
+   path << "/sys/devices/system/cpu/cpu" << cpu << "/topology/" << attribute;
+
+   std::ifstream in( path.str().c_str() );
+   long id( 0L );
+
+   if( in >> id && id >= 0L )
+      return static_cast<size_t>( id );
+#endif
+
+   return fallback;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
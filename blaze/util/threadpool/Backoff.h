@@ -0,0 +1,257 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Backoff.h
+//  \brief Spin-then-yield backoff for waiting threads
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_BACKOFF_H_
+#define _BLAZE_UTIL_THREADPOOL_BACKOFF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  include <windows.h>
+#else
+#  include <sched.h>
+#  include <unistd.h>
+#endif
+
+#include <blaze/system/SMP.h>
+#include <blaze/util/Time.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Hybrid backoff policy for waiting threads.
+// \ingroup threads
+//
+// The Backoff class implements the first two phases of a spin-then-yield-then-block wait. Each
+// call of the wait() function performs a single backoff step: during the first \a spinTime
+// microseconds the calling thread spins on the \c pause instruction of the CPU, during the
+// following \a yieldTime microseconds it yields its time slice to other threads. Afterwards
+// wait() returns \a false to indicate that the caller should block on its condition variable:
+
+   \code
+   threadpool::Backoff backoff;
+
+   while( !condition() ) {
+      if( !backoff.wait() ) {
+         // Blocking on a condition variable
+      }
+   }
+   \endcode
+
+// The default durations are given by the \c SMP_SPIN_TIME and \c SMP_YIELD_TIME settings in
+// the <tt>./blaze/config/SMP.h</tt> configuration file. The clock is only queried every few
+// steps, so the overhead of a backoff step is dominated by the \c pause instruction. On
+// systems with a single processor the spin phase is skipped, since a spinning thread would
+// only delay the thread it is waiting for. For the same reason the spin phase should be
+// disabled in case more threads are used than processors are available.
+*/
+class Backoff
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Backoff( size_t spinTime=SMP_SPIN_TIME, size_t yieldTime=SMP_YIELD_TIME );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool wait();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t processors();
+   static inline void   pause();
+   static inline void   yield();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t steps_;      //!< The number of performed backoff steps.
+   bool   yielding_;   //!< Flag for the yield phase.
+   double start_;      //!< The wall clock time of the first backoff step.
+   double spinTime_;   //!< The duration of the spin phase in seconds.
+   double totalTime_;  //!< The total duration of the spin and yield phase in seconds.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Backoff class.
+//
+// \param spinTime The duration of the spin phase in microseconds.
+// \param yieldTime The duration of the yield phase in microseconds.
+*/
+inline Backoff::Backoff( size_t spinTime, size_t yieldTime )
+   : steps_    ( 0UL )    // The number of performed backoff steps
+   , yielding_ ( false )  // Flag for the yield phase
+   , start_    ( 0.0 )    // The wall clock time of the first backoff step
+   , spinTime_ ( ( processors() > 1UL )?( 1E-6 * spinTime ):( 0.0 ) )  // The spin duration
+   , totalTime_( spinTime_ + 1E-6 * yieldTime )                        // The total duration
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performs a single backoff step.
+//
+// \return \a true in case the caller should continue to poll, \a false if it should block.
+*/
+inline bool Backoff::wait()
+{
+   if( totalTime_ == 0.0 )
+      return false;
+
+   if( steps_ == 0UL )
+      start_ = getWcTime();
+
+   ++steps_;
+
+   // Querying the clock only every 64 steps of the spin phase
+   if( yielding_ || spinTime_ == 0.0 || ( steps_ & 63UL ) == 0UL )
+   {
+      const double elapsed( getWcTime() - start_ );
+
+      if( elapsed >= totalTime_ )
+         return false;
+
+      yielding_ = ( elapsed >= spinTime_ );
+   }
+
+   if( yielding_ )
+      yield();
+   else
+      pause();
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of available processors.
+//
+// \return The number of online processors of the system.
+*/
+inline size_t Backoff::processors()
+{
+#if defined(_MSC_VER)
+   SYSTEM_INFO info;
+   GetSystemInfo( &info );
+   return info.dwNumberOfProcessors;
+#else
+   static const long count( sysconf( _SC_NPROCESSORS_ONLN ) );
+   return ( count > 0L )?( static_cast<size_t>( count ) ):( 1UL );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes a CPU specific spin-wait hint.
+//
+// \return void
+*/
+inline void Backoff::pause()
+{
+#if defined(__GNUC__) && ( defined(__i386__) || defined(__x86_64__) )
+   __asm__ __volatile__( "pause" );
+#elif defined(__GNUC__) && ( defined(__arm__) || defined(__aarch64__) )
+   __asm__ __volatile__( "yield" );
+#elif defined(_MSC_VER)
+   YieldProcessor();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Yields the time slice of the calling thread.
+//
+// \return void
+*/
+inline void Backoff::yield()
+{
+#if defined(_MSC_VER)
+   SwitchToThread();
+#else
+   sched_yield();
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
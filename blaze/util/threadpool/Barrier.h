@@ -0,0 +1,243 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Barrier.h
+//  \brief Header file for the sense-reversing Barrier class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_BARRIER_H_
+#define _BLAZE_UTIL_THREADPOOL_BARRIER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <boost/atomic.hpp>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Backoff.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sense-reversing barrier for a fixed number of threads.
+// \ingroup threads
+//
+// The Barrier class template synchronizes a fixed number of threads: each thread calling the
+// wait() function is blocked until all participating threads have arrived at the barrier. The
+// barrier is reusable, i.e. the same barrier can be used to separate an arbitrary number of
+// consecutive phases of a fork-join kernel. The barrier uses a global sense flag that is
+// reversed by the last arriving thread in each phase, while all other threads wait for the
+// reversal according to the hybrid wait policy of the Backoff class: they spin, then yield
+// their time slice and finally block on a condition variable. Via the three template
+// parameters the barrier can be configured for either C++11 or Boost threads:
+//
+//  - MT: specifies the type of the used synchronization mutex.
+//  - LT: specifies the type of lock used in combination with the given mutex type.
+//  - CT: specifies the type of the used condition variable.
+//
+// Note that all participating threads have to be executed concurrently. In combination with
+// the thread pool this means that the number of participating tasks must not exceed the number
+// of threads of the pool and that no other tasks must be able to occupy the threads.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class Barrier : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Barrier( size_t count );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Synchronization functions*******************************************************************
+   /*!\name Synchronization functions */
+   //@{
+   inline bool wait();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const size_t count_;              //!< The number of participating threads.
+   boost::atomic<size_t> arrived_;   //!< The number of threads that arrived in the current phase.
+   boost::atomic<bool> sense_;       //!< The global sense of the barrier.
+   boost::atomic<size_t> sleeping_;  //!< The number of threads blocked on the condition variable.
+   MT mutex_;                        //!< Synchronization mutex.
+   CT wakeup_;                       //!< Wait condition for the reversal of the sense.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Barrier class.
+//
+// \param count The number of participating threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline Barrier<MT,LT,CT>::Barrier( size_t count )
+   : count_   ( count )  // The number of participating threads
+   , arrived_ ( 0UL   )  // The number of threads that arrived in the current phase
+   , sense_   ( false )  // The global sense of the barrier
+   , sleeping_( 0UL   )  // The number of threads blocked on the condition variable
+   , mutex_   ()         // Synchronization mutex
+   , wakeup_  ()         // Wait condition for the reversal of the sense
+{
+   if( count == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of participating threads.
+//
+// \return The number of threads synchronized by the barrier.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t Barrier<MT,LT,CT>::size() const
+{
+   return count_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYNCHRONIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Waits until all participating threads have arrived at the barrier.
+//
+// \return \a true for the last thread to arrive at the barrier, \a false for all other threads.
+//
+// This function blocks the calling thread until all participating threads have called wait().
+// The last thread to arrive does not wait, but releases all other threads by reversing the
+// global sense of the barrier. All memory operations performed by any of the threads before
+// calling wait() are visible to all threads after their return from wait().
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool Barrier<MT,LT,CT>::wait()
+{
+   // The sense cannot be reversed before the calling thread has arrived
+   const bool sense( !sense_.load( boost::memory_order_relaxed ) );
+
+   if( arrived_.fetch_add( 1UL ) == count_ - 1UL )
+   {
+      arrived_.store( 0UL, boost::memory_order_relaxed );
+      sense_.store( sense );
+
+      if( sleeping_.load() > 0UL ) {
+         LT lock( mutex_ );
+         wakeup_.notify_all();
+      }
+
+      return true;
+   }
+
+   Backoff backoff;
+
+   while( sense_.load( boost::memory_order_acquire ) != sense )
+   {
+      if( !backoff.wait() )
+      {
+         LT lock( mutex_ );
+         ++sleeping_;
+
+         while( sense_.load() != sense ) {
+            wakeup_.wait( lock );
+         }
+
+         --sleeping_;
+         break;
+      }
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -1,7 +1,7 @@
 //=================================================================================================
 /*!
 //  \file blaze/util/threadpool/Task.h
-//  \brief Header file for the Task base class
+//  \brief Header file for the Task class
 //
 //  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
 //
@@ -40,7 +40,11 @@
 // Includes
 //*************************************************************************************************
 
-#include <boost/function.hpp>
+#include <new>
+#include <boost/type_traits/alignment_of.hpp>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -49,15 +53,360 @@ namespace threadpool {
 
 //=================================================================================================
 //
-//  TYPE DEFINITIONS
+//  CLASS DEFINITION
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*!\brief Handle for a single, executable task.
 // \ingroup threads
+//
+// The Task class stores a single function/functor that can be called without arguments and
+// returns void. In contrast to a general purpose function wrapper the callable is stored
+// in-place in a fixed-size buffer of \a capacity bytes, i.e. storing a task does not require
+// any dynamic memory allocation. Only callables that exceed the size or the alignment of the
+// buffer are stored on the heap. Task objects are non-copyable; they are constructed in-place
+// in the cells of the TaskQueue via the reset() function, moved out of the cell via transfer(),
+// executed via run() and destroyed either by run() or by clear().
+*/
+class Task : private NonCopyable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! Size of the in-place storage for the stored callable in bytes.
+   enum { capacity = 224UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Task();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Task();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isEmpty() const;
+
+   template< typename Callable >
+   inline void reset( const Callable& func );
+
+   inline void transfer( Task& task );
+   inline void run     ();
+   inline void clear   ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief In-place storage for the stored callable.
+   //
+   // The union members besides the buffer itself only serve to impose the maximum alignment
+   // of the fundamental types on the buffer.
+   */
+   union Storage {
+      char        buffer_[capacity];  //!< The raw storage for the callable.
+      long double alignment1_;        //!< Auxiliary member for the alignment of the buffer.
+      double      alignment2_;        //!< Auxiliary member for the alignment of the buffer.
+      void*       alignment3_;        //!< Auxiliary member for the alignment of the buffer.
+      size_t      alignment4_;        //!< Auxiliary member for the alignment of the buffer.
+   };
+
+   typedef void (*Executor)( void* );  //!< Type of the execution and destruction functions.
+   typedef void (*Relocator)( void*, void* );  //!< Type of the relocation functions.
+   //**********************************************************************************************
+
+   //**Type erasure functions**********************************************************************
+   /*!\name Type erasure functions */
+   //@{
+   template< typename Callable > static inline void runLocal    ( void* callable );
+   template< typename Callable > static inline void destroyLocal( void* callable );
+   template< typename Callable > static inline void moveLocal   ( void* callable, void* target );
+   template< typename Callable > static inline void runHeap     ( void* callable );
+   template< typename Callable > static inline void destroyHeap ( void* callable );
+   template< typename Callable > static inline void moveHeap    ( void* callable, void* target );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Storage   storage_;  //!< In-place storage for the stored callable.
+   Executor  run_;      //!< Function for the execution and destruction of the callable.
+   Executor  destroy_;  //!< Function for the destruction of the callable without execution.
+   Relocator move_;     //!< Function for the relocation of the callable into another task.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the Task class.
+//
+// The default constructor creates an empty task.
+*/
+inline Task::Task()
+   : storage_()     // In-place storage for the stored callable
+   , run_    ( 0 )  // Function for the execution and destruction of the callable
+   , destroy_( 0 )  // Function for the destruction of the callable without execution
+   , move_   ( 0 )  // Function for the relocation of the callable into another task
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the Task class.
+//
+// The destructor destroys the stored callable without executing it.
+*/
+inline Task::~Task()
+{
+   clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the task currently stores a callable.
+//
+// \return \a true in case the task is empty, \a false if not.
+*/
+inline bool Task::isEmpty() const
+{
+   return run_ == 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores a copy of the given function/functor in the task.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function stores a copy of the given function/functor in the task. The callable is
+// stored in-place in case it fits into the \a capacity bytes of the internal buffer and in
+// case its alignment requirements are met, otherwise it is stored on the heap. The given
+// function/functor must be copyable, must be callable without arguments and must return void.
+// The task is required to be empty.
+*/
+template< typename Callable >  // Type of the function/functor
+inline void Task::reset( const Callable& func )
+{
+   BLAZE_INTERNAL_ASSERT( isEmpty(), "Non-empty task detected" );
+
+   if( sizeof( Callable ) <= sizeof( Storage ) &&
+       boost::alignment_of<Callable>::value <= boost::alignment_of<Storage>::value ) {
+      ::new( static_cast<void*>( storage_.buffer_ ) ) Callable( func );
+      run_     = &runLocal<Callable>;
+      destroy_ = &destroyLocal<Callable>;
+      move_    = &moveLocal<Callable>;
+   }
+   else {
+      *static_cast<Callable**>( static_cast<void*>( storage_.buffer_ ) ) = new Callable( func );
+      run_     = &runHeap<Callable>;
+      destroy_ = &destroyHeap<Callable>;
+      move_    = &moveHeap<Callable>;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves the stored callable into the given task.
+//
+// \param task The target task.
+// \return void
+//
+// This function moves the stored callable into the given task. Callables stored in-place are
+// copied into the buffer of the target task and destroyed afterwards, callables stored on the
+// heap are handed over without copying. After the function has returned, this task is empty.
+// This task is required to be non-empty, the target task is required to be empty.
+*/
+inline void Task::transfer( Task& task )
+{
+   BLAZE_INTERNAL_ASSERT( !isEmpty(), "Empty task detected" );
+   BLAZE_INTERNAL_ASSERT( task.isEmpty(), "Non-empty task detected" );
+
+   move_( storage_.buffer_, task.storage_.buffer_ );
+   task.run_     = run_;
+   task.destroy_ = destroy_;
+   task.move_    = move_;
+   run_     = 0;
+   destroy_ = 0;
+   move_    = 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes and destroys the stored callable.
+//
+// \return void
+//
+// This function executes the stored callable and destroys it afterwards. After the function
+// has returned, the task is empty. The task is required to be non-empty.
+*/
+inline void Task::run()
+{
+   BLAZE_INTERNAL_ASSERT( !isEmpty(), "Empty task detected" );
+
+   const Executor executor( run_ );
+   run_     = 0;
+   destroy_ = 0;
+   move_    = 0;
+   executor( storage_.buffer_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys the stored callable without executing it.
+//
+// \return void
+*/
+inline void Task::clear()
+{
+   if( destroy_ != 0 ) {
+      destroy_( storage_.buffer_ );
+      run_     = 0;
+      destroy_ = 0;
+      move_    = 0;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE ERASURE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Executes and destroys a callable stored in the internal buffer.
+//
+// \param callable Pointer to the internal buffer.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void Task::runLocal( void* callable )
+{
+   Callable* func( static_cast<Callable*>( callable ) );
+   (*func)();
+   func->~Callable();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys a callable stored in the internal buffer.
+//
+// \param callable Pointer to the internal buffer.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void Task::destroyLocal( void* callable )
+{
+   static_cast<Callable*>( callable )->~Callable();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Relocates a callable stored in the internal buffer.
+//
+// \param callable Pointer to the internal buffer.
+// \param target Pointer to the internal buffer of the target task.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void Task::moveLocal( void* callable, void* target )
+{
+   Callable* func( static_cast<Callable*>( callable ) );
+   ::new( target ) Callable( *func );
+   func->~Callable();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes and destroys a callable stored on the heap.
+//
+// \param callable Pointer to the internal buffer holding the pointer to the callable.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void Task::runHeap( void* callable )
+{
+   Callable* func( *static_cast<Callable**>( callable ) );
+   (*func)();
+   delete func;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys a callable stored on the heap.
+//
+// \param callable Pointer to the internal buffer holding the pointer to the callable.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void Task::destroyHeap( void* callable )
+{
+   delete *static_cast<Callable**>( callable );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Relocates a callable stored on the heap.
+//
+// \param callable Pointer to the internal buffer holding the pointer to the callable.
+// \param target Pointer to the internal buffer of the target task.
+// \return void
 */
-typedef boost::function<void(void)>  Task;
+template< typename Callable >  // Type of the function/functor
+inline void Task::moveHeap( void* callable, void* target )
+{
+   *static_cast<Callable**>( target ) = *static_cast<Callable**>( callable );
+}
 //*************************************************************************************************
 
 } // namespace threadpool
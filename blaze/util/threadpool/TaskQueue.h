@@ -40,8 +40,12 @@
 // Includes
 //*************************************************************************************************
 
-#include <deque>
+#include <boost/atomic.hpp>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
 #include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
 
 
 namespace blaze {
@@ -59,24 +63,27 @@ namespace threadpool {
 // \ingroup threads
 //
 // The TaskQueue class represents the internal task container of a thread pool. It uses a FIFO
-// (first in, first out) strategy to store and remove the assigned tasks.
+// (first in, first out) strategy to store and remove the assigned tasks. The queue is a bounded,
+// lock-free multi-producer/multi-consumer ring buffer: each cell of the ring contains a Task
+// and a sequence number that indicates whether the cell is ready to be written or to be read.
+// Producers and consumers claim cells via atomic compare-and-swap operations on the enqueue and
+// dequeue position, respectively. Tasks are constructed in-place in the cells, i.e. neither
+// pushing nor executing a task requires dynamic memory or a mutex. The consumer moves a task
+// out of its cell and releases the cell before executing the task, such that a long running
+// task doesn't block its cell and tasks are able to push further tasks into the queue. The capacity of the queue is fixed at construction time; in case the queue is full,
+// push() fails and the caller has to retry.
 */
-class TaskQueue
+class TaskQueue : private NonCopyable
 {
- private:
-   //**Type definitions****************************************************************************
-   typedef std::deque<Task>  Tasks;  //!< FIFO container for tasks.
-   //**********************************************************************************************
-
  public:
    //**Type definitions****************************************************************************
-   typedef Tasks::size_type  SizeType;  //!< Size type of the task queue.
+   typedef size_t  SizeType;  //!< Size type of the task queue.
    //**********************************************************************************************
 
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit inline TaskQueue();
+   explicit inline TaskQueue( SizeType capacity = 256UL );
    //@}
    //**********************************************************************************************
 
@@ -99,24 +106,48 @@ class TaskQueue
    //**Element functions***************************************************************************
    /*!\name Element functions */
    //@{
-   inline void push ( Task task );
-   inline Task pop  ();
-   inline void clear();
+   template< typename Callable >
+   inline bool push( const Callable& func );
+
+   inline bool execute();
+   inline void clear  ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief A single cell of the ring buffer.
+   */
+   struct Cell {
+      boost::atomic<size_t> sequence_;  //!< The sequence number of the cell.
+      Task task_;                       //!< The task stored in the cell.
+   };
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline Cell* acquire( size_t& pos );
    //@}
    //**********************************************************************************************
 
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   inline void swap( TaskQueue& tq ) /* throw() */;
+   static inline size_t cellsFor( SizeType capacity );
    //@}
    //**********************************************************************************************
 
- private:
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Tasks tasks_;  //!< FIFO container for the contained tasks.
+   UniqueArray<Cell> cells_;           //!< The cells of the ring buffer.
+   const size_t mask_;                 //!< The index mask of the ring buffer.
+   char padding1_[64];                 //!< Padding to avoid false sharing.
+   boost::atomic<size_t> enqueuePos_;  //!< The position of the next task to be written.
+   char padding2_[64];                 //!< Padding to avoid false sharing.
+   boost::atomic<size_t> dequeuePos_;  //!< The position of the next task to be read.
+   char padding3_[64];                 //!< Padding to avoid false sharing.
    //@}
    //**********************************************************************************************
 };
@@ -132,11 +163,25 @@ class TaskQueue
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Default constructor for TaskQueue.
+/*!\brief Constructor for TaskQueue.
+//
+// \param capacity The minimum number of tasks the queue is able to hold.
+//
+// The capacity of the queue is rounded up to the next power of two.
 */
-inline TaskQueue::TaskQueue()
-   : tasks_()  // FIFO container for the contained tasks
-{}
+inline TaskQueue::TaskQueue( SizeType capacity )
+   : cells_     ( new Cell[ cellsFor( capacity ) ] )  // The cells of the ring buffer
+   , mask_      ( cellsFor( capacity ) - 1UL )        // The index mask of the ring buffer
+   , padding1_  ()                                    // Padding to avoid false sharing
+   , enqueuePos_( 0UL )                               // The position of the next task to be written
+   , padding2_  ()                                    // Padding to avoid false sharing
+   , dequeuePos_( 0UL )                               // The position of the next task to be read
+   , padding3_  ()                                    // Padding to avoid false sharing
+{
+   for( size_t i=0UL; i<=mask_; ++i ) {
+      cells_[i].sequence_.store( i, boost::memory_order_relaxed );
+   }
+}
 //*************************************************************************************************
 
 
@@ -153,7 +198,7 @@ inline TaskQueue::TaskQueue()
 //
 // The destructor destroys any remaining task in the task queue.
 */
-TaskQueue::~TaskQueue()
+inline TaskQueue::~TaskQueue()
 {
    clear();
 }
@@ -175,7 +220,7 @@ TaskQueue::~TaskQueue()
 */
 inline TaskQueue::SizeType TaskQueue::maxSize() const
 {
-   return tasks_.max_size();
+   return mask_ + 1UL;
 }
 //*************************************************************************************************
 
@@ -185,11 +230,14 @@ inline TaskQueue::SizeType TaskQueue::maxSize() const
 //
 // \return The current size.
 //
-// This function returns the number of the currently contained tasks.
+// This function returns the number of the currently contained tasks. Note that in case other
+// threads are concurrently accessing the queue, the result is only a snapshot.
 */
 inline TaskQueue::SizeType TaskQueue::size() const
 {
-   return tasks_.size();
+   const size_t dequeuePos( dequeuePos_.load() );
+   const size_t enqueuePos( enqueuePos_.load() );
+   return ( enqueuePos > dequeuePos )?( enqueuePos - dequeuePos ):( 0UL );
 }
 //*************************************************************************************************
 
@@ -201,7 +249,7 @@ inline TaskQueue::SizeType TaskQueue::size() const
 */
 inline bool TaskQueue::isEmpty() const
 {
-   return tasks_.empty();
+   return size() == 0UL;
 }
 //*************************************************************************************************
 
@@ -217,28 +265,70 @@ inline bool TaskQueue::isEmpty() const
 //*************************************************************************************************
 /*!\brief Adding a task to the end of the task queue.
 //
-// \param task The task to be added to the end of the task queue.
-// \return void
+// \param func The function/functor to be added to the end of the task queue.
+// \return \a true in case the task was added, \a false in case the queue is full.
 //
-// This function adds the given task to the end of the task queue. It runs in constant time.
+// This function adds the given function/functor to the end of the task queue. The callable is
+// copied in-place into a free cell of the queue. In case the queue is full, the function
+// returns \a false and the callable is not added.
 */
-inline void TaskQueue::push( Task task )
+template< typename Callable >  // Type of the function/functor
+inline bool TaskQueue::push( const Callable& func )
 {
-   tasks_.push_back( task );
+   size_t pos( enqueuePos_.load( boost::memory_order_relaxed ) );
+   Cell* cell( NULL );
+
+   while( true )
+   {
+      cell = &cells_[pos & mask_];
+      const size_t seq( cell->sequence_.load( boost::memory_order_acquire ) );
+
+      if( seq == pos ) {
+         if( enqueuePos_.compare_exchange_weak( pos, pos+1UL ) )
+            break;
+      }
+      else if( seq < pos ) {
+         return false;
+      }
+      else {
+         pos = enqueuePos_.load( boost::memory_order_relaxed );
+      }
+   }
+
+   cell->task_.reset( func );
+   cell->sequence_.store( pos+1UL, boost::memory_order_release );
+
+   return true;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Returns the task from the front of the task queue.
+/*!\brief Removes and executes the task from the front of the task queue.
 //
-// \return The first task in the task queue.
+// \return \a true in case a task has been executed, \a false in case the queue is empty.
+//
+// The task is moved out of its cell and the cell is released for new tasks before the task
+// is executed. Otherwise a task pushing new tasks into the queue (as for instance a task of
+// the asynchronous task graph releasing its successors) could find its own cell occupied once
+// the ring buffer wraps around, i.e. the queue would appear to be full although it contains
+// only a single task.
 */
-inline Task TaskQueue::pop()
+inline bool TaskQueue::execute()
 {
-   const Task task( tasks_.front() );
-   tasks_.pop_front();
-   return task;
+   size_t pos;
+   Cell* const cell( acquire( pos ) );
+
+   if( cell == NULL )
+      return false;
+
+   Task task;
+   cell->task_.transfer( task );
+   cell->sequence_.store( pos+mask_+1UL, boost::memory_order_release );
+
+   task.run();
+
+   return true;
 }
 //*************************************************************************************************
 
@@ -250,60 +340,68 @@ inline Task TaskQueue::pop()
 */
 inline void TaskQueue::clear()
 {
-   tasks_.clear();
+   size_t pos;
+   Cell* cell;
+
+   while( ( cell = acquire( pos ) ) != NULL ) {
+      cell->task_.clear();
+      cell->sequence_.store( pos+mask_+1UL, boost::memory_order_release );
+   }
 }
 //*************************************************************************************************
 
 
-
-
-//=================================================================================================
-//
-//  UTILITY FUNCTIONS
-//
-//=================================================================================================
-
 //*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
+/*!\brief Claims the cell at the front of the task queue.
 //
-// \param tq The task queue to be swapped.
-// \return void
-// \exception no-throw guarantee.
+// \param pos Reference to the position of the claimed cell.
+// \return Pointer to the claimed cell, \a NULL in case the queue is empty.
 */
-inline void TaskQueue::swap( TaskQueue& tq ) /* throw() */
+inline TaskQueue::Cell* TaskQueue::acquire( size_t& pos )
 {
-   tasks_.swap( tq.tasks_ );
+   pos = dequeuePos_.load( boost::memory_order_relaxed );
+
+   while( true )
+   {
+      Cell* const cell( &cells_[pos & mask_] );
+      const size_t seq( cell->sequence_.load( boost::memory_order_acquire ) );
+
+      if( seq == pos+1UL ) {
+         if( dequeuePos_.compare_exchange_weak( pos, pos+1UL ) )
+            return cell;
+      }
+      else if( seq < pos+1UL ) {
+         return NULL;
+      }
+      else {
+         pos = dequeuePos_.load( boost::memory_order_relaxed );
+      }
+   }
 }
 //*************************************************************************************************
 
 
 
 
+
+
 //=================================================================================================
 //
-//  GLOBAL OPERATORS
+//  UTILITY FUNCTIONS
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\name TaskQueue operators */
-//@{
-inline void swap( TaskQueue& a, TaskQueue& b ) /* throw() */;
-//@}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
+/*!\brief Returns the number of cells of a queue with the given minimum capacity.
 //
-// \param a The first task queue to be swapped.
-// \param b The second task queue to be swapped.
-// \return void
-// \exception no-throw guarantee.
+// \param capacity The minimum number of tasks the queue is able to hold.
+// \return The smallest power of two not smaller than the given capacity (at least 2).
 */
-inline void swap( TaskQueue& a, TaskQueue& b ) /* throw() */
+inline size_t TaskQueue::cellsFor( SizeType capacity )
 {
-   a.swap( b );
+   size_t n( 2UL );
+   while( n < capacity ) n *= 2UL;
+   return n;
 }
 //*************************************************************************************************
 
@@ -311,5 +409,4 @@ inline void swap( TaskQueue& a, TaskQueue& b ) /* throw() */
 
 } // namespace blaze
 
-
 #endif
@@ -0,0 +1,538 @@
+//=================================================================================================
+/*!
+//  \file src/main/Calibration.cpp
+//  \brief Source file for the Blaze threshold calibration
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#  define BLAZE_USE_RUNTIME_THRESHOLDS 1
+#endif
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Infinity.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
+#  error "The calibration requires runtime thresholds (BLAZE_USE_RUNTIME_THRESHOLDS)"
+#endif
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blazemark::element_t;
+using blazemark::size_t;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of the calibration results.
+//
+// This type definition specifies the type of the calibrated thresholds, consisting of the name
+// and the value of each threshold.
+*/
+typedef std::vector< std::pair<std::string,size_t> >  Results;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CALIBRATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Operations of the calibration kernels.
+*/
+enum Operation
+{
+   assignment     = 0,  //!< Assignment of an operand.
+   addition       = 1,  //!< Addition of two operands.
+   subtraction    = 2,  //!< Subtraction of two operands.
+   multiplication = 3,  //!< Multiplication of two operands.
+   scaling        = 4   //!< Multiplication of an operand with a scalar.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration kernel for dense vector operations.
+//
+// This kernel evaluates the given operation for two dense vectors of size \a N.
+*/
+template< Operation Op >  // Type of the operation
+class VectorKernel
+{
+ public:
+   explicit VectorKernel( size_t N )
+      : a_( N ), b_( N ), c_( N )
+   {
+      blazemark::blaze::init( a_ );
+      blazemark::blaze::init( b_ );
+   }
+
+   void operator()() {
+      switch( Op ) {
+         case assignment    : c_ = a_;        break;
+         case addition      : c_ = a_ + b_;   break;
+         case subtraction   : c_ = a_ - b_;   break;
+         case multiplication: c_ = a_ * b_;   break;
+         case scaling       : c_ = a_ * 2.1;  break;
+      }
+   }
+
+ private:
+   blaze::DynamicVector<element_t> a_, b_, c_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration kernel for the outer product of two dense vectors.
+//
+// This kernel evaluates the outer product of two dense vectors of size \a N.
+*/
+class OuterProductKernel
+{
+ public:
+   explicit OuterProductKernel( size_t N )
+      : a_( N ), b_( N ), A_( N, N )
+   {
+      blazemark::blaze::init( a_ );
+      blazemark::blaze::init( b_ );
+   }
+
+   void operator()() {
+      A_ = a_ * b_;
+   }
+
+ private:
+   blaze::DynamicVector<element_t,blaze::columnVector> a_;
+   blaze::DynamicVector<element_t,blaze::rowVector> b_;
+   blaze::DynamicMatrix<element_t> A_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration kernel for dense matrix/dense vector multiplications.
+//
+// This kernel evaluates the multiplication of a \f$ N \times N \f$ dense matrix with a dense
+// column vector (\f$ y = A * x \f$).
+*/
+template< bool SO >  // Storage order of the matrix
+class MatVecKernel
+{
+ public:
+   explicit MatVecKernel( size_t N )
+      : A_( N, N ), x_( N ), y_( N )
+   {
+      blazemark::blaze::init( A_ );
+      blazemark::blaze::init( x_ );
+   }
+
+   void operator()() {
+      y_ = A_ * x_;
+   }
+
+ private:
+   blaze::DynamicMatrix<element_t,SO> A_;
+   blaze::DynamicVector<element_t,blaze::columnVector> x_, y_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration kernel for dense vector/dense matrix multiplications.
+//
+// This kernel evaluates the multiplication of a dense row vector with a \f$ N \times N \f$
+// dense matrix (\f$ y^T = x^T * A \f$).
+*/
+template< bool SO >  // Storage order of the matrix
+class TVecMatKernel
+{
+ public:
+   explicit TVecMatKernel( size_t N )
+      : x_( N ), A_( N, N ), y_( N )
+   {
+      blazemark::blaze::init( x_ );
+      blazemark::blaze::init( A_ );
+   }
+
+   void operator()() {
+      y_ = x_ * A_;
+   }
+
+ private:
+   blaze::DynamicVector<element_t,blaze::rowVector> x_;
+   blaze::DynamicMatrix<element_t,SO> A_;
+   blaze::DynamicVector<element_t,blaze::rowVector> y_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration kernel for dense matrix operations.
+//
+// This kernel evaluates the given operation for two \f$ N \times N \f$ dense matrices.
+*/
+template< Operation Op  // Type of the operation
+        , bool SO1      // Storage order of the left-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+class MatrixKernel
+{
+ public:
+   explicit MatrixKernel( size_t N )
+      : A_( N, N ), B_( N, N ), C_( N, N )
+   {
+      blazemark::blaze::init( A_ );
+      blazemark::blaze::init( B_ );
+   }
+
+   void operator()() {
+      switch( Op ) {
+         case assignment    : C_ = A_;        break;
+         case addition      : C_ = A_ + B_;   break;
+         case subtraction   : C_ = A_ - B_;   break;
+         case multiplication: C_ = A_ * B_;   break;
+         case scaling       : C_ = A_ * 2.1;  break;
+      }
+   }
+
+ private:
+   blaze::DynamicMatrix<element_t,SO1> A_;
+   blaze::DynamicMatrix<element_t,SO2> B_;
+   blaze::DynamicMatrix<element_t,SO1> C_;
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measuring the runtime of a single evaluation of the given kernel.
+//
+// \param kernel The kernel to be measured.
+// \return The minimum runtime of a single evaluation of the kernel.
+//
+// This function first estimates the necessary number of steps in the same way as the benchmarks
+// (see for instance the estimateSteps() functions of the benchmarks), but with a shorter target
+// runtime. Afterwards the minimum runtime of \a blazemark::reps repetitions is determined.
+*/
+template< typename Kernel >  // Type of the calibration kernel
+double measure( Kernel& kernel )
+{
+   blaze::timing::WcTimer timer;
+   size_t steps( 1UL );
+
+   while( true ) {
+      timer.start();
+      for( size_t i=0UL; i<steps; ++i ) {
+         kernel();
+      }
+      timer.end();
+      if( timer.last() >= 0.05 ) break;
+      steps *= 2UL;
+   }
+
+   double runtime( timer.last() / steps );
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t i=0UL; i<steps; ++i ) {
+         kernel();
+      }
+      timer.end();
+      runtime = blaze::min( runtime, timer.last() / steps );
+   }
+
+   return runtime;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of a single threshold.
+//
+// \param name The name of the threshold.
+// \param first The smallest size of the operands.
+// \param last The largest size of the operands.
+// \param results The calibration results.
+// \return void
+//
+// This function determines the crossover point of the given threshold by evaluating the kernel
+// for increasing operand sizes \f$[first..last]\f$, once with the threshold set to its minimum
+// (i.e. the SMP or BLAS kernels are used) and once with the threshold set to its maximum (i.e.
+// the serial or custom Blaze kernels are used). The smallest size from which on the SMP or BLAS
+// kernels are faster is used as the new threshold. In case no crossover point is found, the
+// current value of the threshold is kept. Note that the threshold is left at its maximum such
+// that it doesn't affect the calibration of other thresholds.
+*/
+template< typename Kernel >  // Type of the calibration kernel
+void calibrate( const std::string& name, size_t first, size_t last, Results& results )
+{
+   const bool   blas   ( name.compare( 0UL, 4UL, "SMP_" ) != 0 );
+   const size_t minimum( blas ? 1UL : 0UL );
+   const size_t maximum( blaze::inf );
+
+   size_t crossover( 0UL );
+   size_t wins( 0UL );
+
+   std::cout << "   " << std::setw(32) << name << std::flush;
+
+   for( size_t N=first; N<=last && wins<2UL; N+=N/2UL )
+   {
+      Kernel kernel( N );
+
+      blaze::setThreshold( name, minimum );
+      const double tuned( measure( kernel ) );
+
+      blaze::setThreshold( name, maximum );
+      const double plain( measure( kernel ) );
+
+      if( tuned < plain ) {
+         if( wins++ == 0UL ) crossover = N;
+      }
+      else wins = 0UL;
+   }
+
+   if( wins > 0UL ) {
+      const size_t value( ( blas )?( crossover*crossover ):( crossover-1UL ) );
+      std::cout << value << "\n";
+      results.push_back( std::make_pair( name, value ) );
+   }
+   else {
+      std::cout << "no crossover up to " << last << " (keeping the current value)\n";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing the threshold file.
+//
+// \param filename The name of the threshold file.
+// \param results The calibration results.
+// \return void
+// \exception std::runtime_error Threshold file could not be created.
+//
+// This function writes all thresholds to the given file. Calibrated thresholds are written
+// with their calibrated values, all other thresholds with their current values.
+*/
+void write( const std::string& filename, const Results& results )
+{
+   typedef blaze::ThresholdTable<size_t>  Table;
+
+   for( Results::const_iterator result=results.begin(); result!=results.end(); ++result ) {
+      blaze::setThreshold( result->first, result->second );
+   }
+
+   std::ofstream file( filename.c_str() );
+
+   if( !file ) {
+      throw std::runtime_error( "Threshold file could not be created" );
+   }
+
+   file << "//=================================================================================================\n"
+        << "/*!\n"
+        << "//  \\file " << filename << "\n"
+        << "//  \\brief Thresholds calibrated by the Blaze threshold calibration for "
+        << blaze::getNumThreads() << " thread(s)\n"
+        << "*/\n"
+        << "//=================================================================================================\n\n";
+
+   for( size_t i=0UL; i<Table::size; ++i ) {
+      file << "#define BLAZE_" << Table::names[i] << " " << Table::values[i] << "UL\n";
+   }
+
+   if( !file ) {
+      throw std::runtime_error( "Threshold file could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze threshold calibration.
+//
+// \param argc The total number of command line arguments.
+// \param argv The array of command line arguments.
+// \return Success code for the execution.
+//
+// The calibration measures the crossover points of the SMP thresholds (for the current number
+// of threads) and of the BLAS thresholds (in case BLAS is used) on the host and writes all
+// thresholds to the given threshold file. The file can either be loaded at runtime (see the
+// blaze::loadThresholds() function and the \c BLAZE_THRESHOLD_FILE environment variable) or it
+// can be included before any Blaze header to fix the thresholds at compile time.
+*/
+int main( int argc, char** argv )
+{
+   if( argc > 2 ) {
+      std::cerr << " Invalid use of program 'calibration'!\n"
+                << "   Use: ./calibration [<threshold_file>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::string filename( ( argc == 2 )?( argv[1] ):( "Thresholds.h" ) );
+
+   std::cout << "\n Blaze threshold calibration:\n" << std::left;
+
+   ::blaze::setSeed( ::blazemark::seed );
+
+   Results results;
+
+   try
+   {
+      using blaze::rowMajor;
+      using blaze::columnMajor;
+
+      typedef blaze::ThresholdTable<size_t>  Table;
+
+      const std::vector<size_t> current( Table::values, Table::values + Table::size );
+
+      if( blaze::getNumThreads() > 1UL )
+      {
+         std::cout << "  SMP thresholds (" << blaze::getNumThreads() << " threads):\n";
+
+         for( size_t i=0UL; i<Table::size; ++i ) {
+            if( std::string( Table::names[i] ).compare( 0UL, 4UL, "SMP_" ) == 0 )
+               blaze::setThreshold( Table::names[i], blaze::inf );
+         }
+
+         calibrate< VectorKernel<assignment> >    ( "SMP_DVECASSIGN_THRESHOLD"    , 100UL, 4000000UL, results );
+         calibrate< VectorKernel<addition> >      ( "SMP_DVECDVECADD_THRESHOLD"   , 100UL, 4000000UL, results );
+         calibrate< VectorKernel<subtraction> >   ( "SMP_DVECDVECSUB_THRESHOLD"   , 100UL, 4000000UL, results );
+         calibrate< VectorKernel<multiplication> >( "SMP_DVECDVECMULT_THRESHOLD"  , 100UL, 4000000UL, results );
+         calibrate< VectorKernel<scaling> >       ( "SMP_DVECSCALARMULT_THRESHOLD", 100UL, 4000000UL, results );
+         calibrate< OuterProductKernel >          ( "SMP_DVECTDVECMULT_THRESHOLD" ,  10UL,    2000UL, results );
+
+         calibrate< MatVecKernel<rowMajor   > > ( "SMP_DMATDVECMULT_THRESHOLD"  , 10UL, 3000UL, results );
+         calibrate< MatVecKernel<columnMajor> > ( "SMP_TDMATDVECMULT_THRESHOLD" , 10UL, 3000UL, results );
+         calibrate< TVecMatKernel<rowMajor   > >( "SMP_TDVECDMATMULT_THRESHOLD" , 10UL, 3000UL, results );
+         calibrate< TVecMatKernel<columnMajor> >( "SMP_TDVECTDMATMULT_THRESHOLD", 10UL, 3000UL, results );
+
+         calibrate< MatrixKernel<assignment    ,rowMajor,rowMajor> >   ( "SMP_DMATASSIGN_THRESHOLD"    , 10UL, 2000UL, results );
+         calibrate< MatrixKernel<addition      ,rowMajor,rowMajor> >   ( "SMP_DMATDMATADD_THRESHOLD"   , 10UL, 2000UL, results );
+         calibrate< MatrixKernel<addition      ,rowMajor,columnMajor> >( "SMP_DMATTDMATADD_THRESHOLD"  , 10UL, 2000UL, results );
+         calibrate< MatrixKernel<subtraction   ,rowMajor,rowMajor> >   ( "SMP_DMATDMATSUB_THRESHOLD"   , 10UL, 2000UL, results );
+         calibrate< MatrixKernel<subtraction   ,rowMajor,columnMajor> >( "SMP_DMATTDMATSUB_THRESHOLD"  , 10UL, 2000UL, results );
+         calibrate< MatrixKernel<scaling       ,rowMajor,rowMajor> >   ( "SMP_DMATSCALARMULT_THRESHOLD", 10UL, 2000UL, results );
+
+         calibrate< MatrixKernel<multiplication,rowMajor   ,rowMajor> >   ( "SMP_DMATDMATMULT_THRESHOLD"  , 4UL, 1000UL, results );
+         calibrate< MatrixKernel<multiplication,rowMajor   ,columnMajor> >( "SMP_DMATTDMATMULT_THRESHOLD" , 4UL, 1000UL, results );
+         calibrate< MatrixKernel<multiplication,columnMajor,rowMajor> >   ( "SMP_TDMATDMATMULT_THRESHOLD" , 4UL, 1000UL, results );
+         calibrate< MatrixKernel<multiplication,columnMajor,columnMajor> >( "SMP_TDMATTDMATMULT_THRESHOLD", 4UL, 1000UL, results );
+      }
+      else {
+         std::cout << "  SMP thresholds: skipped (single thread)\n";
+      }
+
+#if BLAZE_BLAS_MODE
+      std::cout << "  BLAS thresholds:\n";
+
+      BLAZE_SERIAL_SECTION
+      {
+         calibrate< MatVecKernel<rowMajor   > > ( "DMATDVECMULT_THRESHOLD"  , 10UL, 4000UL, results );
+         calibrate< MatVecKernel<columnMajor> > ( "TDMATDVECMULT_THRESHOLD" , 10UL, 4000UL, results );
+         calibrate< TVecMatKernel<rowMajor   > >( "TDVECDMATMULT_THRESHOLD" , 10UL, 4000UL, results );
+         calibrate< TVecMatKernel<columnMajor> >( "TDVECTDMATMULT_THRESHOLD", 10UL, 4000UL, results );
+
+         calibrate< MatrixKernel<multiplication,rowMajor   ,rowMajor> >   ( "DMATDMATMULT_THRESHOLD"  , 4UL, 1000UL, results );
+         calibrate< MatrixKernel<multiplication,rowMajor   ,columnMajor> >( "DMATTDMATMULT_THRESHOLD" , 4UL, 1000UL, results );
+         calibrate< MatrixKernel<multiplication,columnMajor,rowMajor> >   ( "TDMATDMATMULT_THRESHOLD" , 4UL, 1000UL, results );
+         calibrate< MatrixKernel<multiplication,columnMajor,columnMajor> >( "TDMATTDMATMULT_THRESHOLD", 4UL, 1000UL, results );
+      }
+#else
+      std::cout << "  BLAS thresholds: skipped (BLAS mode deactivated)\n";
+#endif
+
+      for( size_t i=0UL; i<Table::size; ++i ) {
+         blaze::setThreshold( Table::names[i], current[i] );
+      }
+
+      write( filename, results );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during calibration: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Thresholds written to '" << filename << "'\n" << std::endl;
+}
+//*************************************************************************************************
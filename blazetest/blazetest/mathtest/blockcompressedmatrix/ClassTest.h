@@ -0,0 +1,383 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/blockcompressedmatrix/ClassTest.h
+//  \brief Header file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BlockCompressedMatrix class template.
+//
+// This class represents a test suite for the blaze::BlockCompressedMatrix class template. It
+// performs a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testFunctionCall();
+   void testIterator    ();
+   void testNonZeros    ();
+   void testReset       ();
+   void testClear       ();
+   void testInsert      ();
+   void testAppend      ();
+   void testReserve     ();
+   void testSwap        ();
+   void testFind        ();
+   void testMatVecMult  ();
+   void testMatMatMult  ();
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& matrix, size_t minCapacity ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkNonZeroBlocks( const Type& matrix, size_t expectedNonZeroBlocks ) const;
+
+   template< typename Type >
+   void checkNonZeroBlocks( const Type& matrix, size_t index, size_t expectedNonZeroBlocks ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::StaticMatrix<int,2UL,3UL,blaze::rowMajor>  BT;  //!< Type of the matrix blocks.
+   typedef blaze::BlockCompressedMatrix<BT>                  MT;  //!< Type of the block-compressed matrix.
+   typedef MT::ResultType                                    RT;  //!< Result type of the block-compressed matrix.
+   typedef MT::TransposeType                                 TT;  //!< Transpose type of the block-compressed matrix.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( RT );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( TT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::BlockType, BT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType, RT::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType, TT::ElementType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given matrix. In case the actual number of
+// rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( matrix.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << matrix.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given matrix. In case the actual number of
+// columns does not correspond to the given expected number of columns, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( matrix.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << matrix.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param minCapacity The expected minimum capacity of the matrix in terms of blocks.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of the given matrix. In case the actual capacity is smaller
+// than the given expected minimum capacity, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkCapacity( const Type& matrix, size_t minCapacity ) const
+{
+   if( matrix.capacity() < minCapacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity                 : " << matrix.capacity() << "\n"
+          << "   Expected minimum capacity: " << minCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given matrix. In case the actual
+// number of non-zero elements does not correspond to the given expected number, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( matrix.nonZeros() != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << matrix.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero blocks of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeroBlocks The expected number of non-zero blocks of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero blocks of the given matrix. In case the actual
+// number of non-zero blocks does not correspond to the given expected number, or in case the
+// capacity is smaller than the number of non-zero blocks, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeroBlocks( const Type& matrix, size_t expectedNonZeroBlocks ) const
+{
+   if( matrix.nonZeroBlocks() != expectedNonZeroBlocks ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero blocks\n"
+          << " Details:\n"
+          << "   Number of non-zero blocks         : " << matrix.nonZeroBlocks() << "\n"
+          << "   Expected number of non-zero blocks: " << expectedNonZeroBlocks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( matrix.capacity() < matrix.nonZeroBlocks() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Number of non-zero blocks: " << matrix.nonZeroBlocks() << "\n"
+          << "   Capacity                 : " << matrix.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero blocks in a specific block row of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param index The block row to be checked.
+// \param expectedNonZeroBlocks The expected number of non-zero blocks in the specified block row.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero blocks in the specified block row of the given
+// matrix. In case the actual number of non-zero blocks does not correspond to the given expected
+// number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeroBlocks( const Type& matrix, size_t index, size_t expectedNonZeroBlocks ) const
+{
+   if( matrix.nonZeroBlocks( index ) != expectedNonZeroBlocks ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero blocks in block row " << index << "\n"
+          << " Details:\n"
+          << "   Number of non-zero blocks         : " << matrix.nonZeroBlocks( index ) << "\n"
+          << "   Expected number of non-zero blocks: " << expectedNonZeroBlocks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BlockCompressedMatrix class test.
+*/
+#define RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::blockcompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -110,6 +110,7 @@ class ClassTest
    void testFind        ();
    void testLowerBound  ();
    void testUpperBound  ();
+   void testColumnIndex ();
    void testIsDefault   ();
 
    template< typename Type >
@@ -0,0 +1,162 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/AsyncTest.h
+//  \brief Header file for the asynchronous evaluation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_ASYNCTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_ASYNCTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the asynchronous evaluation of statements.
+//
+// This class represents a test suite for the async() functions. It tests that dependent
+// statements are evaluated in the order of their submission in case of read-after-write,
+// write-after-read and write-after-write dependencies, including dependencies via views such
+// as subvectors and rows, and that long chains of dependent statements are evaluated correctly.
+*/
+class AsyncTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;   //!< Type of the column vectors.
+   typedef blaze::DynamicVector<double,blaze::rowVector>     TVT;  //!< Type of the row vectors.
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>      MT;   //!< Type of the matrices.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AsyncTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSubvectorDependencies();
+   void testRowDependencies();
+   void testChains();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The current number of threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the asynchronous evaluation of statements.
+//
+// \return void
+*/
+void runTest()
+{
+   AsyncTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the asynchronous evaluation test.
+*/
+#define RUN_SMP_ASYNC_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,171 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/ScratchArenaTest.h
+//  \brief Header file for the scratch arena test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_SCRATCHARENATEST_H_
+#define _BLAZETEST_MATHTEST_SMP_SCRATCHARENATEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/util/ScratchArena.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the thread-local scratch arena.
+//
+// This class represents a test suite for the ScratchArena class template and the ScratchTemporary
+// class template. It tests the stack-like allocation and release of arena memory, the growth of
+// the arena to the recorded demand, the reuse of the arena by repeated allocations, the reset of
+// the arena via the release() function, the independence of the arenas of different threads, and
+// the placement of the temporaries of expressions in the arena.
+*/
+class ScratchArenaTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::TheScratchArena  Arena;  //!< Type of the tested scratch arena.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ScratchArenaTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testRequest();
+   void testAllocation();
+   void testOrder();
+   void testReuse();
+   void testRelease();
+   void testLimit();
+   void testThreads();
+   void testTemporary();
+   void testExpressions();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static size_t footprint ( size_t n );
+   static void   deallocate( double* address );
+   static void   run       ( const void* foreign, std::string* error );
+
+   void checkSize     ( size_t expected, const std::string& error ) const;
+   void checkCapacity ( size_t expected, const std::string& error ) const;
+   void checkOwnership( const void* address, bool expected, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the thread-local scratch arena.
+//
+// \return void
+*/
+void runTest()
+{
+   ScratchArenaTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the scratch arena test.
+*/
+#define RUN_SMP_SCRATCHARENA_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,169 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/TBBBackendTest.h
+//  \brief Header file for the SMP TBB backend test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_TBBBACKENDTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_TBBBACKENDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the TBB-based shared-memory parallelization.
+//
+// This class represents a test suite for the TBB backend of the shared-memory parallelization
+// (see \c BLAZE_USE_TBB_THREADS). It tests the thread limits within TBB task arenas of different
+// concurrency, compares the SMP assignments of dense and sparse operands to the according serial
+// assignments, and tests parallel operations started from within the tasks of an application
+// parallel loop. In case the TBB backend is not active, the test is skipped.
+*/
+class TBBBackendTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicVector<double,blaze::columnVector>     VT;   //!< Dense vector type.
+   typedef blaze::CompressedVector<double,blaze::columnVector>  SVT;  //!< Sparse vector type.
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>         MT;   //!< Row-major dense matrix type.
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>      TMT;  //!< Column-major dense matrix type.
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>      SMT;  //!< Row-major sparse matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TBBBackendTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testNumThreads();
+   void testVectorAssignments();
+   void testMatrixAssignments();
+   void testParallelFor();
+   void testNestedOperations();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The concurrency of the current task arena.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the TBB-based shared-memory parallelization.
+//
+// \return void
+*/
+void runTest()
+{
+   TBBBackendTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP TBB backend test.
+*/
+#define RUN_SMP_TBB_BACKEND_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
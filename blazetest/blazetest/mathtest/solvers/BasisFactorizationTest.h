@@ -0,0 +1,173 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/BasisFactorizationTest.h
+//  \brief Header file for the basis factorization test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_BASISFACTORIZATIONTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_BASISFACTORIZATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/solvers/BasisFactorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the sparse LU factorization of simplex bases.
+//
+// This class represents a test suite for the BasisFactorization class. It factorizes bases
+// that require row and column permutations, threshold pivoting and a fill-reducing pivot order,
+// performs sequences of column exchanges in product form followed by refactorizations and checks
+// the residuals of the forward and backward transformations as well as the patterns of the
+// hypersparse solves.
+*/
+class BasisFactorizationTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CompressedMatrix<blaze::real,blaze::columnMajor>  MT;  //!< Type of the bases.
+   typedef blaze::DynamicMatrix<blaze::real,blaze::columnMajor>     DT;  //!< Type of the dense bases.
+   typedef blaze::VecN                                              VT;  //!< Type of the vectors.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BasisFactorizationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testFactorization();
+   void testHypersparse();
+   void testUpdate();
+   void testSingular();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static MT tridiagonal( size_t n );
+
+   void checkSolves  ( const blaze::BasisFactorization& bf, const MT& B,
+                       const std::string& label ) const;
+   void checkPattern ( const VT& x, const VT& ref, const std::vector<size_t>& indices,
+                       const std::string& label ) const;
+   void checkUpdates ( const blaze::BasisFactorization& bf, size_t updates,
+                       const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse LU factorization of simplex bases.
+//
+// \return void
+*/
+void runTest()
+{
+   BasisFactorizationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the basis factorization test.
+*/
+#define RUN_SOLVERS_BASISFACTORIZATION_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,179 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/BatchSolverTest.h
+//  \brief Header file for the batch solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_BATCHSOLVERTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_BATCHSOLVERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/problems/ContactLCP.h>
+#include <blaze/math/problems/LCP.h>
+#include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/BatchSolver.h>
+#include <blaze/math/solvers/CG.h>
+#include <blaze/math/solvers/PGS.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the batch solver.
+//
+// This class represents a test suite for the BatchSolver class template. It solves batches of
+// independent problems of different sizes (LCPs, contact LCPs and linear systems of equations)
+// with any number of threads and compares each solution, its convergence flag and its number
+// of iterations against a known reference solution and against the solution of the problem by
+// a single solver.
+*/
+class BatchSolverTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CMatMxN  MT;  //!< Type of the system matrices.
+   typedef blaze::VecN     VT;  //!< Type of the right-hand side vectors and unknowns.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BatchSolverTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testLCPs();
+   void testContactLCPs();
+   void testLSEs();
+   void testConvergence();
+   void testSerialSection();
+   void testSettings();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static MT                tridiagonal( size_t n );
+   static blaze::LCP        lcp        ( size_t n, VT& ref );
+   static blaze::ContactLCP contacts   ( size_t N, VT& ref );
+   static size_t            size       ( size_t p );
+
+   void checkSolution( const VT& x, const VT& ref, size_t p, const std::string& label ) const;
+   void checkBatch   ( size_t solved, const std::vector<bool>& converged, size_t P,
+                       const std::string& label ) const;
+   void checkWorkers ( size_t workers, size_t expected, const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the batch solver.
+//
+// \return void
+*/
+void runTest()
+{
+   BatchSolverTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the batch solver test.
+*/
+#define RUN_SOLVERS_BATCHSOLVER_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
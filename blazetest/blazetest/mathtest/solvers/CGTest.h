@@ -0,0 +1,192 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/CGTest.h
+//  \brief Header file for the conjugate gradient solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_CGTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_CGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/solvers/CG.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the conjugate gradient solver.
+//
+// This class represents a test suite for the CG class. It solves symmetric positive definite
+// systems given as sparse and dense matrices of both storage orders and as linear operators,
+// with and without the available preconditioners, and compares the computed solutions and
+// their residuals against known reference solutions. Additionally, it checks the recorded
+// convergence statistics and the warm start from a given initial solution.
+*/
+class CGTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CMatMxN  MT;  //!< Type of the system matrices.
+   typedef blaze::VecN     VT;  //!< Type of the right-hand side vectors and unknowns.
+   //**********************************************************************************************
+
+   //**Class Laplacian*****************************************************************************
+   /*!\brief Matrix-free linear operator for the five-point Laplacian on a square grid.
+   */
+   class Laplacian
+   {
+    public:
+      explicit inline Laplacian( size_t k ) : k_( k ) {}
+
+      inline size_t rows   () const { return k_*k_; }
+      inline size_t columns() const { return k_*k_; }
+
+      void apply( const VT& x, VT& y ) const;
+
+    private:
+      size_t k_;  //!< The number of grid points per dimension.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit CGTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMatrixTypes();
+   void testPreconditioners();
+   void testLSE();
+   void testParallel();
+   void testStatistics();
+   void testWarmStart();
+   void testErrors();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static MT   laplacian( size_t k, blaze::real shift );
+   static VT   reference( size_t n );
+   static void configure( blaze::CG& cg );
+
+   template< typename MatrixType >
+   void checkSolution( const MatrixType& A, const VT& b, const VT& x, const VT& ref,
+                       const std::string& label ) const;
+
+   void checkStatistics( const blaze::CG& cg, const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the conjugate gradient solver.
+//
+// \return void
+*/
+void runTest()
+{
+   CGTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the conjugate gradient solver test.
+*/
+#define RUN_SOLVERS_CG_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
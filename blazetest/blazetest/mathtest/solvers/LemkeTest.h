@@ -0,0 +1,171 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/LemkeTest.h
+//  \brief Header file for the Lemke solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_LEMKETEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_LEMKETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/problems/LCP.h>
+#include <blaze/math/solvers/Lemke.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the Lemke solver.
+//
+// This class represents a test suite for the Lemke class. It solves LCPs with non-symmetric
+// P-matrices and known reference solutions in the dense and in the revised representation,
+// including large LCPs that require several hundred pivot steps with frequent, default and
+// without refactorizations of the basis, degenerate LCPs that require the lexicographic ratio
+// test and LCPs without solution.
+*/
+class LemkeTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CMatMxN  MT;  //!< Type of the system matrices.
+   typedef blaze::VecN     VT;  //!< Type of the right-hand side vectors and unknowns.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit LemkeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSettings();
+   void testLCP();
+   void testManyPivots();
+   void testDegenerate();
+   void testTrivial();
+   void testInfeasible();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static blaze::LCP  lcp      ( size_t n, bool degenerate, VT& ref );
+   static void        configure( blaze::Lemke& lemke, blaze::Lemke::Representation representation );
+   static const char* name     ( blaze::Lemke::Representation representation );
+
+   void checkSolution( const blaze::Lemke& lemke, const blaze::LCP& cp, const VT& ref,
+                       const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the Lemke solver.
+//
+// \return void
+*/
+void runTest()
+{
+   LemkeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Lemke solver test.
+*/
+#define RUN_SOLVERS_LEMKE_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
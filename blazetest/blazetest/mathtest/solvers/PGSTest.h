@@ -0,0 +1,183 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/PGSTest.h
+//  \brief Header file for the projected Gauss-Seidel solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_PGSTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_PGSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/problems/BoxLCP.h>
+#include <blaze/math/problems/ContactLCP.h>
+#include <blaze/math/problems/LCP.h>
+#include <blaze/math/solvers/PGS.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the projected Gauss-Seidel solver.
+//
+// This class represents a test suite for the PGS class. It solves complementarity problems with
+// known reference solutions in all sweep modes (for contact problems with scalar and with block
+// updates) and compares the colored and the relaxed Jacobi sweeps for any number of threads
+// against straightforward sequential implementations. Additionally, it checks the recorded
+// convergence statistics and the reuse of the cached coloring for warm starts.
+*/
+class PGSTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CMatMxN  MT;  //!< Type of the system matrices.
+   typedef blaze::VecN     VT;  //!< Type of the right-hand side vectors and unknowns.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit PGSTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSettings();
+   void testLCP();
+   void testBoxLCP();
+   void testColoring();
+   void testColoredSweep();
+   void testJacobiSweep();
+   void testContactLCP();
+   void testBlockUpdate();
+   void testStatistics();
+   void testWarmStart();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static MT          laplacian( size_t k );
+   static blaze::LCP  lcp      ( size_t k, VT& ref );
+   static blaze::LCP  arrowhead( size_t n, VT& ref );
+   static blaze::ContactLCP contacts( size_t N, VT& ref );
+   static void        configure( blaze::PGS& pgs, blaze::PGS::SweepMode mode );
+   static const char* name     ( blaze::PGS::SweepMode mode );
+   static blaze::real product  ( const MT& A, const VT& x, size_t i );
+
+   void checkSolution( const VT& x, const VT& ref, const std::string& label ) const;
+   void checkIterates( const VT& x, const VT& ref, const std::string& label ) const;
+   void checkColors  ( const blaze::PGS& pgs, size_t colors, const std::string& label ) const;
+   void checkStatistics( const blaze::PGS& pgs, const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the projected Gauss-Seidel solver.
+//
+// \return void
+*/
+void runTest()
+{
+   PGSTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the projected Gauss-Seidel solver test.
+*/
+#define RUN_SOLVERS_PGS_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
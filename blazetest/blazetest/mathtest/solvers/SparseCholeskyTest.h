@@ -0,0 +1,177 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/SparseCholeskyTest.h
+//  \brief Header file for the sparse Cholesky solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_SPARSECHOLESKYTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_SPARSECHOLESKYTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/solvers/SparseCholesky.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the sparse Cholesky solver.
+//
+// This class represents a test suite for the SparseCholesky class. It factorizes symmetric
+// positive definite matrices with regular and irregular sparsity patterns and compares the
+// solutions for single and multiple right-hand sides and their residuals against known
+// reference solutions. Additionally, it checks the numeric refactorization based on a previous
+// symbolic analysis, the parallel factorization and solution and the error handling.
+*/
+class SparseCholeskyTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CMatMxN              MT;  //!< Type of the system matrices.
+   typedef blaze::SymmetricMatrix<MT>  ST;  //!< Type of the symmetric system matrices.
+   typedef blaze::MatMxN               DT;  //!< Type of the right-hand side matrices.
+   typedef blaze::VecN                 VT;  //!< Type of the right-hand side vectors.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseCholeskyTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testFactorization();
+   void testMultipleRHS();
+   void testRefactorization();
+   void testParallel();
+   void testErrors();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static MT laplacian( size_t k, size_t d, blaze::real shift );
+   static MT irregular( size_t n );
+   static DT reference( size_t n, size_t m );
+
+   void checkFactorization( const blaze::SparseCholesky& cholesky, const MT& A,
+                            const std::string& label ) const;
+   void checkSolution     ( const MT& A, const DT& X, const DT& ref,
+                            const std::string& label ) const;
+   void checkSolution     ( const MT& A, const VT& x, const DT& ref,
+                            const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse Cholesky solver.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseCholeskyTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse Cholesky solver test.
+*/
+#define RUN_SOLVERS_SPARSECHOLESKY_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
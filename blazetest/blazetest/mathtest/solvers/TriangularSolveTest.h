@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/TriangularSolveTest.h
+//  \brief Header file for the triangular solve test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_TRIANGULARSOLVETEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_TRIANGULARSOLVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/TriangularSolve.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the triangular solves.
+//
+// This class represents a test suite for the trsv() and trsm() functions. It solves lower and
+// upper triangular systems given as dense and sparse LowerMatrix and UpperMatrix adaptors of
+// both storage orders, with one and with multiple right-hand sides of both storage orders, both
+// sequentially and level-scheduled, and compares the computed solutions and their residuals
+// against known reference solutions.
+*/
+class TriangularSolveTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::real                                    ET;    //!< Element type.
+   typedef blaze::DynamicMatrix<ET,blaze::rowMajor>       DMT;   //!< Row-major dense matrix.
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>    TDMT;  //!< Column-major dense matrix.
+   typedef blaze::CompressedMatrix<ET,blaze::rowMajor>     SMT;   //!< Row-major sparse matrix.
+   typedef blaze::CompressedMatrix<ET,blaze::columnMajor>  TSMT;  //!< Column-major sparse matrix.
+   typedef blaze::DynamicVector<ET,blaze::columnVector>   VT;    //!< Dense column vector.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TriangularSolveTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDense();
+   void testSparse();
+   void testScheduled();
+   void testParallel();
+   void testErrors();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static DMT         denseLower ( size_t n );
+   static SMT         sparseLower( size_t n, size_t width );
+   static DMT         reference  ( size_t n, size_t m );
+   static blaze::real maxNorm    ( const VT& v );
+
+   template< bool SO >
+   static blaze::real maxNorm( const blaze::DynamicMatrix<ET,SO>& M );
+
+   template< typename AT >
+   void checkTrsv( const AT& A, const std::string& label ) const;
+
+   template< typename AT >
+   void checkTrsv( const AT& A, const blaze::LevelSchedule& schedule,
+                   const std::string& label ) const;
+
+   template< bool SO, typename AT >
+   void checkTrsm( const AT& A, const std::string& label ) const;
+
+   template< bool SO, typename AT >
+   void checkTrsm( const AT& A, const blaze::LevelSchedule& schedule,
+                   const std::string& label ) const;
+
+   template< typename AT, typename XT >
+   void checkSolution( const AT& A, const XT& X, const XT& B, const XT& ref,
+                       const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the triangular solves.
+//
+// \return void
+*/
+void runTest()
+{
+   TriangularSolveTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the triangular solve test.
+*/
+#define RUN_SOLVERS_TRIANGULARSOLVE_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,1047 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testInsert();
+   testAppend();
+   testReserve();
+   testSwap();
+   testFind();
+   testMatVecMult();
+   testMatMatMult();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkRows         ( mat, 0UL );
+      checkColumns      ( mat, 0UL );
+      checkNonZeroBlocks( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (0x0)";
+
+      MT mat( 0UL, 0UL );
+
+      checkRows         ( mat, 0UL );
+      checkColumns      ( mat, 0UL );
+      checkNonZeroBlocks( mat, 0UL );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (2x4)";
+
+      MT mat( 2UL, 4UL );
+
+      checkRows         ( mat,  4UL );
+      checkColumns      ( mat, 12UL );
+      checkNonZeroBlocks( mat,  0UL );
+      checkNonZeroBlocks( mat, 0UL, 0UL );
+      checkNonZeroBlocks( mat, 1UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size/Non-zeros constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix size/non-zeros constructor (2x4)";
+
+      MT mat( 2UL, 4UL, 3UL );
+
+      checkRows         ( mat,  4UL );
+      checkColumns      ( mat, 12UL );
+      checkCapacity     ( mat,  3UL );
+      checkNonZeroBlocks( mat,  0UL );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy constructor";
+
+      MT mat1( 2UL, 3UL, 3UL );
+      mat1.append( 0UL, 1UL, BT( 1 ) );
+      mat1.finalize( 0UL );
+      mat1.append( 1UL, 0UL, BT( 2 ) );
+      mat1.append( 1UL, 2UL, BT( 3 ) );
+      mat1.finalize( 1UL );
+
+      MT mat2( mat1 );
+
+      checkRows         ( mat2, 4UL );
+      checkColumns      ( mat2, 9UL );
+      checkNonZeros     ( mat2, 18UL );
+      checkNonZeroBlocks( mat2, 3UL );
+      checkNonZeroBlocks( mat2, 0UL, 1UL );
+      checkNonZeroBlocks( mat2, 1UL, 2UL );
+
+      if( mat2(0,3) != 1 || mat2(1,5) != 1 || mat2(2,0) != 2 || mat2(3,8) != 3 || mat2(0,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (row-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 4UL, 9UL );
+      mat1(0,1) = 1;
+      mat1(1,7) = 2;
+      mat1(3,2) = 3;
+      mat1(3,8) = 4;
+
+      MT mat2( mat1 );
+
+      checkRows         ( mat2, 4UL );
+      checkColumns      ( mat2, 9UL );
+      checkNonZeroBlocks( mat2, 4UL );
+      checkNonZeroBlocks( mat2, 0UL, 2UL );
+      checkNonZeroBlocks( mat2, 1UL, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 4UL, 9UL );
+      mat1(0,1) = 1;
+      mat1(1,7) = 2;
+      mat1(3,2) = 3;
+      mat1(3,8) = 4;
+
+      MT mat2( mat1 );
+
+      checkRows         ( mat2, 4UL );
+      checkColumns      ( mat2, 9UL );
+      checkNonZeroBlocks( mat2, 4UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (invalid size)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 4UL, 8UL );
+
+      try {
+         MT mat2( mat1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion to CompressedMatrix";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 6UL, 6UL );
+      for( size_t i=0UL; i<6UL; ++i ) {
+         mat1(i,i) = int( i+1UL );
+         mat1(i,5UL-i) = -int( i+1UL );
+      }
+
+      const MT mat2( mat1 );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> mat3( mat2 );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> mat4( mat2 );
+
+      if( mat3 != mat1 || mat4 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Result (row-major):\n" << mat3 << "\n"
+             << "   Result (column-major):\n" << mat4 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "BlockCompressedMatrix copy assignment";
+
+      MT mat1( 2UL, 3UL, 2UL );
+      mat1.append( 0UL, 2UL, BT( 5 ) );
+      mat1.finalize( 0UL );
+      mat1.append( 1UL, 1UL, BT( 6 ) );
+      mat1.finalize( 1UL );
+
+      MT mat2( 1UL, 1UL );
+      mat2 = mat1;
+
+      checkRows         ( mat2, 4UL );
+      checkColumns      ( mat2, 9UL );
+      checkNonZeroBlocks( mat2, 2UL );
+
+      if( mat2(1,8) != 5 || mat2(3,3) != 6 || mat2(3,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 2UL, 6UL );
+      mat1(0,0) = 1;
+      mat1(1,4) = 2;
+
+      MT mat2;
+      mat2 = mat1 * 2;
+
+      checkRows         ( mat2, 2UL );
+      checkColumns      ( mat2, 6UL );
+      checkNonZeroBlocks( mat2, 2UL );
+
+      if( mat2(0,0) != 2 || mat2(1,4) != 4 || mat2(1,3) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "BlockCompressedMatrix::operator()";
+
+   MT mat( 2UL, 2UL, 2UL );
+   mat.append( 0UL, 1UL, BT( 1, 2, 3, 4, 5, 6 ) );
+   mat.finalize( 0UL );
+   mat.append( 1UL, 0UL, BT( 7, 8, 9, 10, 11, 12 ) );
+   mat.finalize( 1UL );
+
+   if( mat(0,3) != 1 || mat(0,4) != 2 || mat(0,5) != 3 || mat(1,3) != 4 || mat(1,4) != 5 ||
+       mat(1,5) != 6 || mat(2,0) != 7 || mat(2,1) != 8 || mat(2,2) != 9 || mat(3,0) != 10 ||
+       mat(3,1) != 11 || mat(3,2) != 12 || mat(0,0) != 0 || mat(3,5) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 0 0 1 2 3 )\n( 0 0 0 4 5 6 )\n"
+                                   "( 7 8 9 0 0 0 )\n( 10 11 12 0 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scalar row iterators and the block iterators of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::ConstIterator       ConstIterator;
+   typedef MT::BlockIterator       BlockIterator;
+   typedef MT::ConstBlockIterator  ConstBlockIterator;
+
+   MT mat( 2UL, 3UL, 3UL );
+   mat.append( 0UL, 0UL, BT( 1, 2, 3, 4, 5, 6 ) );
+   mat.append( 0UL, 2UL, BT( 7, 8, 9, 10, 11, 12 ) );
+   mat.finalize( 0UL );
+   mat.finalize( 1UL );
+
+   // Counting the number of elements in 1st row
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( mat.end(1UL) - mat.begin(1UL) );
+
+      if( number != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in 2nd block row
+   {
+      test_ = "Iterator subtraction (empty block row)";
+
+      if( mat.begin(2UL) != mat.end(2UL) || mat.begin(3UL) != mat.end(3UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator range detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      const size_t indices[] = { 0UL, 1UL, 2UL, 6UL, 7UL, 8UL };
+      const int    values [] = { 4, 5, 6, 10, 11, 12 };
+
+      size_t k( 0UL );
+      for( ConstIterator it=mat.cbegin(1UL); it!=mat.cend(1UL); ++it, ++k )
+      {
+         if( it->index() != indices[k] || it->value() != values[k] ||
+             (*it).index() != indices[k] || (*it).value() != values[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Index         : " << it->index() << "\n"
+                << "   Value         : " << it->value() << "\n"
+                << "   Expected index: " << indices[k] << "\n"
+                << "   Expected value: " << values[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Testing write access via BlockIterator
+   {
+      test_ = "Write access via BlockIterator";
+
+      for( BlockIterator block=mat.blockBegin(0UL); block!=mat.blockEnd(0UL); ++block ) {
+         block->value() *= 2;
+      }
+
+      const MT& cmat( mat );
+      const ConstBlockIterator block( cmat.blockBegin(0UL) + 1 );
+
+      if( block->index() != 2UL || mat(0,0) != 2 || mat(1,8) != 24 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Block iterator access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() and \c nonZeroBlocks() member functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() and \c nonZeroBlocks() member functions
+// of the BlockCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "BlockCompressedMatrix::nonZeros()";
+
+   MT mat( 3UL, 2UL, 3UL );
+   mat.append( 0UL, 0UL, BT( 1 ) );
+   mat.append( 0UL, 1UL, BT( 2 ) );
+   mat.finalize( 0UL );
+   mat.finalize( 1UL );
+   mat.append( 2UL, 1UL, BT( 3 ) );
+   mat.finalize( 2UL );
+
+   checkNonZeros     ( mat, 18UL );
+   checkNonZeroBlocks( mat, 3UL );
+   checkNonZeroBlocks( mat, 0UL, 2UL );
+   checkNonZeroBlocks( mat, 1UL, 0UL );
+   checkNonZeroBlocks( mat, 2UL, 1UL );
+
+   if( mat.nonZeros( 1UL ) != 6UL || mat.nonZeros( 3UL ) != 0UL || mat.nonZeros( 4UL ) != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of row non-zeros detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros (rows 1,3,4): " << mat.nonZeros( 1UL ) << ","
+          << mat.nonZeros( 3UL ) << "," << mat.nonZeros( 4UL ) << "\n"
+          << "   Expected: 6,0,3\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "BlockCompressedMatrix::reset()";
+
+   MT mat( 2UL, 2UL, 2UL );
+   mat.append( 0UL, 0UL, BT( 1 ) );
+   mat.finalize( 0UL );
+   mat.append( 1UL, 1UL, BT( 2 ) );
+   mat.finalize( 1UL );
+
+   reset( mat );
+
+   checkRows         ( mat, 4UL );
+   checkColumns      ( mat, 6UL );
+   checkCapacity     ( mat, 2UL );
+   checkNonZeroBlocks( mat, 0UL );
+
+   if( mat(0,0) != 0 || mat(3,5) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "BlockCompressedMatrix::clear()";
+
+   MT mat( 2UL, 2UL, 2UL );
+   mat.append( 0UL, 0UL, BT( 1 ) );
+   mat.finalize( 0UL );
+   mat.finalize( 1UL );
+
+   clear( mat );
+
+   checkRows         ( mat, 0UL );
+   checkColumns      ( mat, 0UL );
+   checkNonZeroBlocks( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c insert() member function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c insert() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   test_ = "BlockCompressedMatrix::insert()";
+
+   MT mat( 3UL, 4UL );
+
+   // Inserting a block into an empty matrix
+   mat.insert( 1UL, 2UL, BT( 1 ) );
+
+   checkNonZeroBlocks( mat, 1UL );
+   checkNonZeroBlocks( mat, 1UL, 1UL );
+
+   // Inserting blocks in front of and behind existing blocks
+   mat.insert( 1UL, 0UL, BT( 2 ) );
+   mat.insert( 0UL, 3UL, BT( 3 ) );
+   mat.insert( 2UL, 1UL, BT( 4 ) );
+   mat.insert( 1UL, 3UL, BT( 5 ) );
+
+   checkNonZeroBlocks( mat, 5UL );
+   checkNonZeroBlocks( mat, 0UL, 1UL );
+   checkNonZeroBlocks( mat, 1UL, 3UL );
+   checkNonZeroBlocks( mat, 2UL, 1UL );
+
+   if( mat(0,9) != 3 || mat(2,0) != 2 || mat(3,6) != 1 || mat(2,11) != 5 || mat(5,5) != 4 ||
+       mat(4,0) != 0 || mat(0,0) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inserting blocks failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Trying to insert an already existing block
+   try {
+      mat.insert( 1UL, 2UL, BT( 6 ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inserting an existing block succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "BlockCompressedMatrix::append()";
+
+   MT mat( 4UL, 3UL, 4UL );
+   mat.append( 0UL, 1UL, BT( 1 ) );
+   mat.finalize( 0UL );
+   mat.finalize( 1UL );
+   mat.append( 2UL, 0UL, BT( 2 ) );
+   mat.append( 2UL, 2UL, BT( 3 ) );
+   mat.finalize( 2UL );
+   mat.append( 3UL, 1UL, BT( 4 ) );
+   mat.finalize( 3UL );
+
+   checkRows         ( mat, 8UL );
+   checkColumns      ( mat, 9UL );
+   checkNonZeroBlocks( mat, 4UL );
+   checkNonZeroBlocks( mat, 0UL, 1UL );
+   checkNonZeroBlocks( mat, 1UL, 0UL );
+   checkNonZeroBlocks( mat, 2UL, 2UL );
+   checkNonZeroBlocks( mat, 3UL, 1UL );
+
+   if( mat(1,3) != 1 || mat(4,0) != 2 || mat(5,8) != 3 || mat(7,5) != 4 || mat(2,3) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Append operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() member function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   test_ = "BlockCompressedMatrix::reserve()";
+
+   MT mat( 3UL, 3UL );
+   mat.insert( 1UL, 1UL, BT( 1 ) );
+
+   mat.reserve( 10UL );
+
+   checkCapacity     ( mat, 10UL );
+   checkNonZeroBlocks( mat, 1UL );
+   checkNonZeroBlocks( mat, 1UL, 1UL );
+
+   if( mat(2,3) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reserve operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BlockCompressedMatrix swap";
+
+   MT mat1( 1UL, 2UL, 1UL );
+   mat1.append( 0UL, 1UL, BT( 1 ) );
+   mat1.finalize( 0UL );
+
+   MT mat2( 2UL, 1UL );
+
+   swap( mat1, mat2 );
+
+   checkRows         ( mat1, 4UL );
+   checkColumns      ( mat1, 3UL );
+   checkNonZeroBlocks( mat1, 0UL );
+   checkRows         ( mat2, 2UL );
+   checkColumns      ( mat2, 6UL );
+   checkNonZeroBlocks( mat2, 1UL );
+
+   if( mat2(1,5) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the second matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() and \c lowerBound() member functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() and \c lowerBound() member functions of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "BlockCompressedMatrix::find()";
+
+   typedef MT::ConstBlockIterator  ConstBlockIterator;
+
+   MT mat( 2UL, 5UL, 3UL );
+   mat.append( 0UL, 1UL, BT( 1 ) );
+   mat.append( 0UL, 3UL, BT( 2 ) );
+   mat.finalize( 0UL );
+   mat.append( 1UL, 4UL, BT( 3 ) );
+   mat.finalize( 1UL );
+
+   const MT& cmat( mat );
+
+   const ConstBlockIterator pos1( cmat.find( 0UL, 3UL ) );
+   const ConstBlockIterator pos2( cmat.find( 0UL, 2UL ) );
+   const ConstBlockIterator pos3( cmat.lowerBound( 0UL, 2UL ) );
+   const ConstBlockIterator pos4( cmat.lowerBound( 1UL, 0UL ) );
+
+   if( pos1 == cmat.blockEnd(0UL) || pos1->index() != 3UL || pos1->value()(0,0) != 2 ||
+       pos2 != cmat.blockEnd(0UL) || pos3 != pos1 ||
+       pos4 == cmat.blockEnd(1UL) || pos4->index() != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Block lookup failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block sparse matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication between a BlockCompressedMatrix and a
+// dense vector, including the addition and subtraction assignment. The results are compared
+// to the results of the according CompressedMatrix multiplication. The large test case is
+// sufficiently large to trigger a parallel evaluation in case a shared memory parallelization
+// is active. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatVecMult()
+{
+   const size_t sizes[] = { 6UL, 48UL, 1500UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      test_ = "BlockCompressedMatrix/dense vector multiplication";
+
+      const size_t n( sizes[s] );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( n, n );
+      ref.reserve( 5UL*n );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t k=0UL; k<5UL; ++k ) {
+            const size_t j( ( i*7UL + k*k*13UL ) % n );
+            ref(i,j) = blaze::rand<int>( -5, 5 );
+         }
+      }
+
+      blaze::DynamicVector<int,blaze::columnVector> x( n );
+      for( size_t i=0UL; i<n; ++i )
+         x[i] = blaze::rand<int>( -5, 5 );
+
+      const MT mat( ref );
+
+      blaze::DynamicVector<int,blaze::columnVector> y1, y2;
+
+      y1 = mat * x;
+      y2 = ref * x;
+
+      if( y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Size: " << n << "\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      test_ = "BlockCompressedMatrix/dense vector multiplication (addition assignment)";
+
+      y1 += mat * ( x + x );
+      y2 += ref * ( x + x );
+
+      if( y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Size: " << n << "\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      test_ = "BlockCompressedMatrix/dense vector multiplication (subtraction assignment)";
+
+      y1 -= mat * x;
+      y2 -= ref * x;
+
+      if( y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Size: " << n << "\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block sparse matrix/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication between a BlockCompressedMatrix and a
+// row-major dense matrix for row-major and column-major targets, including the addition and
+// subtraction assignment. The results are compared to the results of the according
+// CompressedMatrix multiplication. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMatMatMult()
+{
+   const size_t sizes[] = { 6UL, 48UL, 300UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( n, n );
+      ref.reserve( 5UL*n );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t k=0UL; k<5UL; ++k ) {
+            const size_t j( ( i*5UL + k*k*11UL ) % n );
+            ref(i,j) = blaze::rand<int>( -5, 5 );
+         }
+      }
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> B( n, 13UL );
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<13UL; ++j )
+            B(i,j) = blaze::rand<int>( -5, 5 );
+
+      const MT mat( ref );
+
+      // Row-major target
+      {
+         test_ = "BlockCompressedMatrix/row-major dense matrix multiplication (row-major target)";
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> C1, C2;
+
+         C1 = mat * B;
+         C2 = ref * B;
+
+         if( C1 != C2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Size: " << n << "\n"
+                << "   Result:\n" << C1 << "\n"
+                << "   Expected result:\n" << C2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         C1 += mat * B;
+         C2 += ref * B;
+         C1 -= mat * ( B + B );
+         C2 -= ref * ( B + B );
+
+         if( C1 != C2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Addition/subtraction assignment failed\n"
+                << " Details:\n"
+                << "   Size: " << n << "\n"
+                << "   Result:\n" << C1 << "\n"
+                << "   Expected result:\n" << C2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Column-major target
+      {
+         test_ = "BlockCompressedMatrix/row-major dense matrix multiplication (column-major target)";
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> C1, C2;
+
+         C1 = mat * B;
+         C2 = ref * B;
+
+         C1 += mat * B;
+         C2 += ref * B;
+
+         if( C1 != C2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Size: " << n << "\n"
+                << "   Result:\n" << C1 << "\n"
+                << "   Expected result:\n" << C2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <boost/thread/thread.hpp>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/util/Complex.h>
@@ -90,6 +91,7 @@ ClassTest::ClassTest()
    testFind();
    testLowerBound();
    testUpperBound();
+   testColumnIndex();
    testIsDefault();
 }
 //*************************************************************************************************
@@ -8388,6 +8390,168 @@ void ClassTest::testUpperBound()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Helper functor for the concurrent traversal of the column index of a matrix.
+*/
+struct ColumnTraversal
+{
+   typedef blaze::CompressedMatrix<int,blaze::rowMajor>  MatrixType;
+
+   ColumnTraversal( const MatrixType& mat, size_t& sum ) : mat_( &mat ), sum_( &sum ) {}
+
+   void operator()() const {
+      *sum_ = 0UL;
+      for( size_t j=0UL; j<mat_->columns(); ++j ) {
+         for( MatrixType::ColumnEntryIterator it=mat_->columnBegin(j); it!=mat_->columnEnd(j); ++it )
+            *sum_ += it->index() + it->element()->value();
+      }
+   }
+
+   const MatrixType* mat_;
+   size_t* sum_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the column index of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c columnBegin() and \c columnEnd() member functions of
+// the row-major CompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testColumnIndex()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix::columnBegin()/columnEnd()";
+
+      typedef blaze::CompressedMatrix<int,blaze::rowMajor>  MatrixType;
+      typedef MatrixType::ColumnEntryIterator               ColumnEntryIterator;
+
+      MatrixType mat( 4UL, 3UL );
+      mat(0,1) = 1;
+      mat(2,1) = 2;
+      mat(2,0) = 3;
+      mat(3,1) = 4;
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      // Traversing the initial column index
+      {
+         ColumnEntryIterator it( mat.columnBegin( 1UL ) );
+         const ColumnEntryIterator end( mat.columnEnd( 1UL ) );
+
+         if( end - it != 3L ||
+             it->index() != 0UL || it->element()->value() != 1 || (++it)->index() != 2UL ||
+             it->element()->value() != 2 || (++it)->index() != 3UL || it->element()->value() != 4 ||
+             mat.columnBegin( 2UL ) != mat.columnEnd( 2UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid column index\n"
+                << " Details:\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Modifying an element via the column index
+      {
+         mat.columnElement( mat.columnBegin( 0UL ) )->value() = 5;
+
+         if( mat(2,0) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Modification via the column index failed\n"
+                << " Details:\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Erasing elements
+      {
+         mat.erase( 2UL, 0UL );
+         mat.erase( 0UL, 1UL );
+
+         ColumnEntryIterator it( mat.columnBegin( 1UL ) );
+
+         if( mat.columnBegin( 0UL ) != mat.columnEnd( 0UL ) || mat.columnEnd( 1UL ) - it != 2L ||
+             it->index() != 2UL || it->element()->value() != 2 ||
+             (++it)->index() != 3UL || it->element()->value() != 4 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid column index after erase operation\n"
+                << " Details:\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Inserting elements
+      {
+         mat(1,1) = 6;
+         mat(3,2) = 7;
+
+         ColumnEntryIterator it( mat.columnBegin( 1UL ) );
+
+         if( mat.columnEnd( 1UL ) - it != 3L || it->index() != 1UL || it->element()->value() != 6 ||
+             mat.columnEnd( 2UL ) - mat.columnBegin( 2UL ) != 1L ||
+             mat.columnBegin( 2UL )->index() != 3UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid column index after insert operation\n"
+                << " Details:\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Concurrent first access to the column index
+      {
+         const size_t threads( 4UL );
+
+         MatrixType mat2( 50UL, 40UL );
+         size_t expected( 0UL );
+         for( size_t i=0UL; i<mat2.rows(); ++i ) {
+            for( size_t j=(i%3UL); j<mat2.columns(); j+=3UL ) {
+               mat2(i,j) = int( i+j );
+               expected += i + i + j;
+            }
+         }
+
+         size_t sums[threads];
+         boost::thread_group group;
+         for( size_t t=0UL; t<threads; ++t )
+            group.create_thread( ColumnTraversal( mat2, sums[t] ) );
+         group.join_all();
+
+         for( size_t t=0UL; t<threads; ++t ) {
+            if( sums[t] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid concurrent traversal of the column index\n"
+                   << " Details:\n"
+                   << "   Thread          = " << t << "\n"
+                   << "   Result          = " << sums[t] << "\n"
+                   << "   Expected result = " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c isDefault() function with the CompressedMatrix class template.
 //
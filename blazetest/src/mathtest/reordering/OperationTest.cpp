@@ -0,0 +1,485 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/reordering/OperationTest.cpp
+//  \brief Source file for the reordering operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/reordering/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace reordering {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the reordering operation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testPermutationVector();
+   testPermutationMatrix();
+   testPermute();
+   testReverseCuthillMcKee();
+   testNestedDissection();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PermutationVector class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the PermutationVector class. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPermutationVector()
+{
+   test_ = "PermutationVector";
+
+   // Identity permutation
+   {
+      const blaze::PermutationVector p( 4UL );
+
+      if( p.size() != 4UL || !p.isIdentity() || p[2] != 2UL || p.inverse( 3UL ) != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of the identity permutation failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Construction from a new-to-old mapping and inversion
+   {
+      const size_t order[] = { 2UL, 0UL, 3UL, 1UL };
+      blaze::PermutationVector p( order, order+4UL );
+
+      if( p.isIdentity() || p[0] != 2UL || p[3] != 1UL || p.inverse( 2UL ) != 0UL || p.inverse( 1UL ) != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction from a new-to-old mapping failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      p.invert();
+
+      if( p[2] != 0UL || p[1] != 3UL || p.inverse( 0UL ) != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Construction from an invalid mapping
+   {
+      const size_t order[] = { 2UL, 0UL, 2UL };
+
+      try {
+         blaze::PermutationVector p( order, order+3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction from an invalid mapping succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PermutationMatrix class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the PermutationMatrix class and its multiplication with
+// dense vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPermutationMatrix()
+{
+   test_ = "PermutationMatrix";
+
+   const size_t order[] = { 2UL, 0UL, 3UL, 1UL };
+   const blaze::PermutationMatrix P( blaze::PermutationVector( order, order+4UL ) );
+
+   if( P.rows() != 4UL || P.columns() != 4UL || P.nonZeros() != 4UL || !P(0,2) || P(0,0) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::DynamicVector<int,blaze::columnVector> x( 4UL );
+   x[0] = 10; x[1] = 11; x[2] = 12; x[3] = 13;
+
+   const blaze::DynamicVector<int,blaze::columnVector> y( P * x );
+
+   if( y[0] != 12 || y[1] != 10 || y[2] != 13 || y[3] != 11 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with a column vector failed\n"
+          << " Details:\n"
+          << "   Result:\n" << y << "\n"
+          << "   Expected result:\n( 12 10 13 11 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( trans( P ) * y != x || trans( trans( y ) * P ) != x ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with the transpose failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::DynamicVector<int,blaze::columnVector> z( P * blaze::DynamicVector<int,blaze::columnVector>( 3UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with a vector of invalid size succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << z << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the symmetric permutation of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the permute() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPermute()
+{
+   test_ = "permute() function";
+
+   const size_t order[] = { 2UL, 0UL, 3UL, 1UL };
+   const blaze::PermutationMatrix P( blaze::PermutationVector( order, order+4UL ) );
+
+   MT A( 4UL, 4UL );
+   A(0,0) = 1; A(0,3) = 2; A(1,2) = 3; A(2,0) = 4; A(3,1) = 5; A(3,3) = 6;
+
+   // Row-major matrix
+   {
+      const MT B( permute( A, P ) );
+
+      bool equal( B.nonZeros() == A.nonZeros() );
+      for( size_t i=0UL; i<4UL; ++i )
+         for( size_t j=0UL; j<4UL; ++j )
+            equal = equal && B(i,j) == A(order[i],order[j]);
+
+      if( !equal ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric permutation of a row-major matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Original matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Column-major matrix
+   {
+      const blaze::CompressedMatrix<int,blaze::columnMajor> C( A );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> B( permute( C, P ) );
+
+      if( B != permute( A, P ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric permutation of a column-major matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Original matrix:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reverse Cuthill-McKee ordering.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reverseCuthillMcKee() function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReverseCuthillMcKee()
+{
+   test_ = "reverseCuthillMcKee() function";
+
+   // Bandwidth reduction of a randomly numbered grid
+   {
+      const MT A( grid( 12UL ) );
+      const blaze::PermutationVector p( blaze::reverseCuthillMcKee( A ) );
+      const MT B( permute( A, blaze::PermutationMatrix( p ) ) );
+
+      if( p.size() != A.rows() || bandwidth( B ) > 12UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth reduction failed\n"
+             << " Details:\n"
+             << "   Original bandwidth = " << bandwidth( A ) << "\n"
+             << "   Reduced bandwidth  = " << bandwidth( B ) << " (expected at most 12)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Ordering of a matrix with several connected components
+   {
+      MT A( 6UL, 6UL );
+      A(0,4) = 1; A(4,2) = 1; A(5,5) = 1;
+
+      const blaze::PermutationVector p( blaze::reverseCuthillMcKee( A ) );
+
+      if( p.size() != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Ordering of disconnected components failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Ordering of a non-square matrix
+   try {
+      blaze::reverseCuthillMcKee( MT( 2UL, 3UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Ordering of a non-square matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nested dissection ordering.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the nestedDissection() function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testNestedDissection()
+{
+   test_ = "nestedDissection() function";
+
+   const MT A( grid( 16UL ) );
+   const blaze::PermutationVector p( blaze::nestedDissection( A, 4UL ) );
+   const blaze::PermutationVector q( blaze::reverseCuthillMcKee( A ) );
+
+   const size_t ndFill ( fill( permute( A, blaze::PermutationMatrix( p ) ) ) );
+   const size_t rcmFill( fill( permute( A, blaze::PermutationMatrix( q ) ) ) );
+
+   if( p.size() != A.rows() || ndFill >= rcmFill ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fill reduction failed\n"
+          << " Details:\n"
+          << "   Fill of the nested dissection ordering     = " << ndFill << "\n"
+          << "   Fill of the reverse Cuthill-McKee ordering = " << rcmFill << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the five-point stencil matrix of a randomly numbered \f$ n \times n \f$ grid.
+//
+// \param n The number of grid points per dimension.
+// \return The stencil matrix.
+*/
+OperationTest::MT OperationTest::grid( size_t n )
+{
+   std::vector<size_t> number( n*n );
+   for( size_t i=0UL; i<n*n; ++i ) {
+      number[i] = ( i*7919UL ) % ( n*n );
+   }
+
+   MT A( n*n, n*n );
+
+   for( size_t x=0UL; x<n; ++x ) {
+      for( size_t y=0UL; y<n; ++y ) {
+         const size_t v( number[x*n+y] );
+         A(v,v) = 4;
+         if( x > 0UL   ) A(v,number[(x-1UL)*n+y]) = -1;
+         if( x+1UL < n ) A(v,number[(x+1UL)*n+y]) = -1;
+         if( y > 0UL   ) A(v,number[x*n+y-1UL]) = -1;
+         if( y+1UL < n ) A(v,number[x*n+y+1UL]) = -1;
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of non-zero elements of the Cholesky factor of the given matrix.
+//
+// \param A The square matrix with symmetric sparsity pattern.
+// \return The number of off-diagonal non-zero elements of the Cholesky factor.
+*/
+size_t OperationTest::fill( const MT& A )
+{
+   std::vector< std::set<size_t> > pattern( A.rows() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         if( element->index() > i ) pattern[i].insert( element->index() );
+      }
+   }
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<A.rows(); ++k ) {
+      nonzeros += pattern[k].size();
+      if( pattern[k].empty() ) continue;
+      const size_t parent( *pattern[k].begin() );
+      for( std::set<size_t>::const_iterator j=pattern[k].begin(); j!=pattern[k].end(); ++j ) {
+         if( *j != parent ) pattern[parent].insert( *j );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of the given square matrix.
+//
+// \param A The square matrix.
+// \return The bandwidth of the matrix.
+*/
+size_t OperationTest::bandwidth( const MT& A )
+{
+   size_t bandwidth( 0UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t distance( ( element->index() > i )?( element->index() - i ):( i - element->index() ) );
+         if( distance > bandwidth ) bandwidth = distance;
+      }
+   }
+
+   return bandwidth;
+}
+//*************************************************************************************************
+
+} // namespace reordering
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running reordering operation test..." << std::endl;
+
+   try
+   {
+      RUN_REORDERING_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during reordering operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
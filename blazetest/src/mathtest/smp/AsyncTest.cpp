@@ -0,0 +1,334 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/AsyncTest.cpp
+//  \brief Source file for the asynchronous evaluation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/SMP.h>
+#include <blaze/math/Views.h>
+#include <blazetest/mathtest/smp/AsyncTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the asynchronous evaluation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+AsyncTest::AsyncTest()
+   : test_()
+   , threads_( 1UL )
+{
+   for( threads_=1UL; threads_<=4UL; ++threads_ )
+   {
+      blaze::setNumThreads( threads_ );
+
+      for( size_t rep=0UL; rep<3UL; ++rep ) {
+         testSubvectorDependencies();
+         testRowDependencies();
+         testChains();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of data dependencies via subvectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function submits statements that read the targets of previous statements via subvectors
+// (read after write), that write vectors read via subvectors by pending statements (write after
+// read) and that repeatedly write the same vector (write after write). In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testSubvectorDependencies()
+{
+   test_ = "Dependencies via subvectors";
+
+   const size_t n( 40000UL );
+   const size_t h( n / 2UL );
+
+   VT a( n ), b( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = double( i );
+      b[i] = double( 2UL*i );
+   }
+
+   VT x( n, 0.0 ), y( n, 0.0 ), z( h, 0.0 ), p( n, 0.0 );
+
+   {
+      std::vector<blaze::AsyncHandle> handles;
+
+      handles.push_back( blaze::async( x, a * 2.0 ) );                           // x = 2a
+      handles.push_back( blaze::async( y, subvector( x, 0UL, n ) + b ) );        // RAW: y = 2a + b
+      handles.push_back( blaze::async( p, subvector( x, 0UL, n ) * 1.0 ) );      // RAW: p = 2a
+      handles.push_back( blaze::async( p, subvector( p, 0UL, n ) + a ) );        // WAW: p = 3a
+      handles.push_back( blaze::async( x, b * 3.0 ) );                           // WAR/WAW: x = 3b
+      handles.push_back( blaze::async( z, subvector( x, h, h ) * 0.5 ) );        // RAW: z = 1.5b[h..n)
+      handles.push_back( blaze::async( x, a ) );                                 // WAR/WAW: x = a
+
+      for( size_t i=0UL; i<handles.size(); ++i )
+         handles[i].wait();
+   }
+
+   VT y2( a*2.0 + b ), p2( a*3.0 ), z2( subvector( b, h, h ) * 1.5 );
+
+   checkResult( y, y2, "Read after write via subvector failed" );
+   checkResult( p, p2, "Write after read via subvector failed" );
+   checkResult( z, z2, "Read after repeated writes failed" );
+   checkResult( x, a , "Write after write failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of data dependencies via rows.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function submits statements that read rows of the targets of previous statements (read
+// after write) and that write matrices whose rows are read by pending statements (write after
+// read). In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testRowDependencies()
+{
+   test_ = "Dependencies via rows";
+
+   const size_t m( 200UL );
+   const size_t n( 300UL );
+
+   MT A( m, n, 0.0 ), B( m, n ), C( m, n );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         B(i,j) = double( i*n + j );
+         C(i,j) = double( j ) - double( i );
+      }
+   }
+
+   TVT r1( n, 0.0 ), r2( n, 0.0 ), r3( n, 0.0 );
+
+   {
+      std::vector<blaze::AsyncHandle> handles;
+
+      handles.push_back( blaze::async( A, B * 2.0 ) );                           // A = 2B
+      handles.push_back( blaze::async( r1, row( A, 7UL ) * 1.0 ) );              // RAW: r1 = 2B(7,:)
+      handles.push_back( blaze::async( r2, row( A, 9UL ) + row( B, 9UL ) ) );    // RAW: r2 = 3B(9,:)
+      handles.push_back( blaze::async( A, C ) );                                 // WAR/WAW: A = C
+      handles.push_back( blaze::async( r3, row( A, 9UL ) + row( B, 9UL ) ) );    // RAW: r3 = C(9,:) + B(9,:)
+
+      for( size_t i=0UL; i<handles.size(); ++i )
+         handles[i].wait();
+   }
+
+   TVT e1( row( B, 7UL ) * 2.0 ), e2( row( B, 9UL ) * 3.0 ), e3( row( C, 9UL ) + row( B, 9UL ) );
+
+   checkResult( r1, e1, "Read after write via row failed" );
+   checkResult( r2, e2, "Read after write via row failed" );
+   checkResult( r3, e3, "Write after read via row failed" );
+   checkResult( A , C , "Write after write failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of long chains of dependent statements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function submits a long chain of statements alternately writing two vectors, each
+// reading the result of its predecessor, and a wide graph of statements on many vectors with
+// dependencies between neighboring vectors. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void AsyncTest::testChains()
+{
+   test_ = "Chains of statements";
+
+   // Long chain alternately writing two vectors
+   {
+      const size_t n( 5000UL );
+      const size_t length( 400UL );
+
+      VT e( n, 1.0 ), x( n, 0.0 ), y( n, 0.0 );
+
+      {
+         std::vector<blaze::AsyncHandle> handles;
+
+         for( size_t i=0UL; i<length; i+=2UL ) {
+            handles.push_back( blaze::async( x, subvector( y, 0UL, n ) + e ) );
+            handles.push_back( blaze::async( y, subvector( x, 0UL, n ) + e ) );
+         }
+
+         handles.back().wait();
+      }
+
+      const VT x2( n, double( length-1UL ) ), y2( n, double( length ) );
+
+      checkResult( x, x2, "Long chain of statements failed" );
+      checkResult( y, y2, "Long chain of statements failed" );
+   }
+
+   // Wide graph with dependencies between neighboring vectors
+   {
+      const size_t n( 1000UL );
+      const size_t width( 64UL );
+
+      VT a( n );
+      for( size_t i=0UL; i<n; ++i )
+         a[i] = double( i );
+
+      std::vector<VT> v( width, VT( n, 0.0 ) ), w( width, VT( n, 0.0 ) );
+
+      {
+         std::vector<blaze::AsyncHandle> handles;
+
+         for( size_t k=0UL; k<width; ++k )
+            handles.push_back( blaze::async( v[k], a * double( k ) ) );
+
+         for( size_t k=0UL; k<width; ++k )
+            handles.push_back( blaze::async( w[k], v[k] + v[(k+1UL)%width] ) );
+
+         for( size_t k=0UL; k<width; ++k )
+            handles.push_back( blaze::async( v[k], a ) );
+
+         for( size_t i=0UL; i<handles.size(); ++i )
+            handles[i].wait();
+      }
+
+      for( size_t k=0UL; k<width; ++k ) {
+         const VT w2( a * double( 2UL*k + 1UL - ( k+1UL == width ? width : 0UL ) ) );
+         checkResult( w[k], w2, "Wide graph of statements failed" );
+         checkResult( v[k], a , "Wide graph of statements failed" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of an asynchronous statement.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void AsyncTest::checkResult( const T1& result, const T2& expected, const std::string& error ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Number of threads = " << threads_ << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous evaluation test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_ASYNC_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous evaluation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,271 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/BarrierTest.cpp
+//  \brief Source file for the barrier test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <boost/thread/thread_time.hpp>
+#include <blazetest/mathtest/smp/BarrierTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the barrier test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+BarrierTest::BarrierTest()
+{
+   testConstructor();
+   testPhases();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Barrier constructor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction of barriers for valid and invalid numbers of threads.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BarrierTest::testConstructor()
+{
+   test_ = "Barrier constructor";
+
+   {
+      Barrier barrier( 1UL );
+
+      if( barrier.size() != 1UL || !barrier.wait() || !barrier.wait() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Single-thread barrier failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      Barrier barrier( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction of a barrier for zero threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of consecutive phases of the barrier.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function lets several threads pass many consecutive phases of a single barrier. In each
+// phase each thread publishes its arrival before waiting and checks the arrivals of all other
+// threads after waiting. In some phases the first thread arrives late, such that the other
+// threads exceed the spin and yield phases and block on the condition variable. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BarrierTest::testPhases()
+{
+   test_ = "Barrier phases";
+
+   const size_t phases( 500UL );
+
+   for( size_t threads=2UL; threads<=5UL; ++threads )
+   {
+      Barrier barrier( threads );
+      std::vector<size_t> arrivals( threads, 0UL );
+      std::vector< std::vector<size_t> > last( threads, std::vector<size_t>( phases, 0UL ) );
+      std::vector<std::string> errors( threads );
+
+      boost::thread_group group;
+
+      for( size_t id=0UL; id<threads; ++id ) {
+         group.create_thread( boost::bind( &BarrierTest::run, &barrier, id, phases, 2000UL,
+                                           &arrivals, &last[id], &errors[id] ) );
+      }
+
+      group.join_all();
+
+      for( size_t id=0UL; id<threads; ++id ) {
+         if( !errors[id].empty() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Thread left a phase too early\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   Thread = " << id << "\n"
+                << "   " << errors[id] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      for( size_t phase=0UL; phase<phases; ++phase )
+      {
+         size_t count( 0UL );
+         for( size_t id=0UL; id<threads; ++id )
+            count += last[id][phase];
+
+         if( count != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of last arriving threads\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   Phase = " << phase << "\n"
+                << "   Last arriving threads = " << count << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Passing the given number of phases of a barrier.
+//
+// \param barrier The barrier shared by all threads.
+// \param id The index of the thread.
+// \param phases The number of phases.
+// \param delay The delay of the first thread in every 50th phase (in microseconds).
+// \param arrivals The number of completed arrivals of all threads.
+// \param last The flags of the phases in which the thread arrived last.
+// \param error The description of the first detected error.
+// \return void
+//
+// Each phase consists of two waits on the barrier: after the first wait all threads check the
+// arrivals of all other threads, the second wait guarantees that all checks are completed
+// before the next arrival is published.
+*/
+void BarrierTest::run( Barrier* barrier, size_t id, size_t phases, size_t delay,
+                       std::vector<size_t>* arrivals, std::vector<size_t>* last, std::string* error )
+{
+   for( size_t phase=0UL; phase<phases; ++phase )
+   {
+      if( id == 0UL && phase % 50UL == 0UL ) {
+         boost::this_thread::sleep( boost::posix_time::microseconds( delay ) );
+      }
+
+      (*arrivals)[id] = phase + 1UL;
+
+      if( barrier->wait() )
+         (*last)[phase] = 1UL;
+
+      for( size_t i=0UL; i<arrivals->size(); ++i ) {
+         if( error->empty() && (*arrivals)[i] != phase + 1UL ) {
+            std::ostringstream oss;
+            oss << "Phase " << phase << ": arrival of thread " << i << " is " << (*arrivals)[i];
+            *error = oss.str();
+         }
+      }
+
+      barrier->wait();
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running barrier test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_BARRIER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during barrier test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
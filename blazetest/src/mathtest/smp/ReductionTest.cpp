@@ -0,0 +1,355 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ReductionTest.cpp
+//  \brief Source file for the deterministic reduction test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_SMP_DETERMINISTIC_REDUCTION
+#  define BLAZE_SMP_DETERMINISTIC_REDUCTION 1
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/SMP.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blazetest/mathtest/smp/ReductionTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Block reduction summing up a range of single precision values.
+*/
+struct Sum
+{
+   explicit Sum( const std::vector<float>& values )
+      : values_( &values ) {}
+
+   float operator()( size_t begin, size_t end ) const {
+      float sum( 0.0F );
+      for( size_t i=begin; i<end; ++i )
+         sum += (*values_)[i];
+      return sum;
+   }
+
+   const std::vector<float>* values_;  //!< The summed values.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+//! Sizes of the reduced vectors (below, at and above the SMP threshold and the block size).
+const size_t sizes[] = { 1000UL, 2048UL, 38001UL, 81920UL, 100003UL, 1000003UL };
+
+//! Maximum number of threads used for the reductions.
+const size_t maxThreads = 6UL;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the deterministic reduction test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ReductionTest::ReductionTest()
+   : test_()
+{
+   testInnerProduct<float>();
+   testInnerProduct<double>();
+   testNorms<float>();
+   testNorms<double>();
+   testReduce();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the deterministic inner product of two dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the inner product of two dense vectors with one to \a maxThreads
+// threads and compares the results bitwise to the result of the serial evaluation. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the vectors
+void ReductionTest::testInnerProduct()
+{
+   test_ = "Inner product";
+
+   for( size_t s=0UL; s<sizeof( sizes )/sizeof( sizes[0] ); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      blaze::DynamicVector<T,blaze::columnVector> a( n ), b( n );
+      initialize( a, 1UL );
+      initialize( b, 2UL );
+
+      T expected1( 0 ), expected2( 0 );
+
+      BLAZE_SERIAL_SECTION {
+         expected1 = trans( a ) * b;
+         expected2 = trans( a ) * ( b * T( 2 ) );
+      }
+
+      for( size_t threads=1UL; threads<=maxThreads; ++threads )
+      {
+         blaze::setNumThreads( threads );
+
+         checkResult( T( trans( a ) * b ), expected1, n, threads,
+                      "Inner product differs from the serial result" );
+         checkResult( T( trans( a ) * ( b * T( 2 ) ) ), expected2, n, threads,
+                      "Inner product of an expression differs from the serial result" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the deterministic norms of a dense vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the length and the square length of a dense vector with one to
+// \a maxThreads threads and compares the results bitwise to the results of the serial
+// evaluation. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the vector
+void ReductionTest::testNorms()
+{
+   test_ = "Dense vector norms";
+
+   for( size_t s=0UL; s<sizeof( sizes )/sizeof( sizes[0] ); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      blaze::DynamicVector<T,blaze::columnVector> a( n );
+      initialize( a, 3UL );
+
+      T expected1( 0 ), expected2( 0 );
+
+      BLAZE_SERIAL_SECTION {
+         expected1 = length( a );
+         expected2 = sqrLength( a );
+      }
+
+      for( size_t threads=1UL; threads<=maxThreads; ++threads )
+      {
+         blaze::setNumThreads( threads );
+
+         checkResult( T( length( a ) ), expected1, n, threads,
+                      "Length differs from the serial result" );
+         checkResult( T( sqrLength( a ) ), expected2, n, threads,
+                      "Square length differs from the serial result" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the smpReduce() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the parallel evaluation of the smpReduce() function with one to
+// \a maxThreads threads yields the same result as its serial evaluation and that all blocks
+// contribute exactly once to the result. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ReductionTest::testReduce()
+{
+   test_ = "Blocked reduction";
+
+   for( size_t s=0UL; s<sizeof( sizes )/sizeof( sizes[0] ); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      std::vector<float> ones( n, 1.0F ), values( n );
+      for( size_t i=0UL; i<n; ++i )
+         values[i] = float( std::sin( double( i ) ) * std::pow( 10.0, double( i%7UL ) - 3.0 ) );
+
+      const float expected( blaze::smpReduce<float>( n, Sum( values ), false ) );
+
+      for( size_t threads=1UL; threads<=maxThreads; ++threads )
+      {
+         blaze::setNumThreads( threads );
+
+         checkResult( blaze::smpReduce<float>( n, Sum( ones ), true ), float( n ), n, threads,
+                      "Invalid number of reduced elements" );
+         checkResult( blaze::smpReduce<float>( n, Sum( values ), true ), expected, n, threads,
+                      "Parallel reduction differs from the serial reduction" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense vector with values of strongly varying magnitude.
+//
+// \param v The vector to be initialized.
+// \param seed The seed of the values.
+// \return void
+//
+// The magnitudes of the values vary over several orders, such that the rounding of any sum of
+// the values depends on the order of the additions.
+*/
+template< typename T >  // Element type of the vector
+void ReductionTest::initialize( blaze::DynamicVector<T,blaze::columnVector>& v, size_t seed )
+{
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      v[i] = T( std::sin( double( 7UL*i + seed ) ) * std::pow( 10.0, double( ( 13UL*i + seed ) % 9UL ) - 4.0 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise comparison of a reduction result with the expected result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param size The number of reduced elements.
+// \param threads The number of threads used for the reduction.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T >  // Type of the results
+void ReductionTest::checkResult( T result, T expected, size_t size, size_t threads,
+                                 const std::string& error ) const
+{
+   if( std::memcmp( &result, &expected, sizeof( T ) ) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Number of elements = " << size << "\n"
+          << "   Number of threads = " << threads << "\n"
+          << std::setprecision( 20 )
+          << "   Result = " << result << "\n"
+          << "   Expected result = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running deterministic reduction test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_REDUCTION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during deterministic reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,825 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ScratchArenaTest.cpp
+//  \brief Source file for the scratch arena test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/ScratchTemporary.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Memory.h>
+#include <blazetest/mathtest/smp/ScratchArenaTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the scratch arena test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ScratchArenaTest::ScratchArenaTest()
+{
+   testRequest();
+   testAllocation();
+   testOrder();
+   testReuse();
+   testRelease();
+   testLimit();
+   testThreads();
+   testTemporary();
+   testExpressions();
+
+   Arena::release();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the arena allocation requests.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a request via the arm() function is consumed by exactly one call of
+// the consume() function and that it is withdrawn via the disarm() function. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testRequest()
+{
+   test_ = "Arena allocation requests";
+
+   Arena::arm();
+
+   if( Arena::consume() != blaze::scratchArenaActive ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid consumption of an arena allocation request\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( Arena::consume() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Arena allocation request consumed twice\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   Arena::arm();
+   Arena::disarm();
+
+   if( Arena::consume() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Withdrawn arena allocation request consumed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the allocation from an empty arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an allocation from an empty arena is taken from the free store and
+// that the arena grows to the recorded demand as soon as it is used again. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testAllocation()
+{
+   test_ = "Allocation from an empty arena";
+
+   Arena::release();
+
+   checkCapacity( 0UL, "Invalid capacity of a released arena" );
+   checkSize    ( 0UL, "Invalid size of a released arena" );
+
+   double* first( Arena::allocate<double>( 100UL ) );
+
+   checkOwnership( first, false, "First allocation taken from an empty arena" );
+   checkCapacity ( 0UL, "Arena grown while in use" );
+
+   deallocate( first );
+
+   double* second( Arena::allocate<double>( 100UL ) );
+
+   checkOwnership( second, true, "Second allocation not taken from the arena" );
+   checkCapacity ( footprint( 100UL ), "Arena not grown to the recorded demand" );
+   checkSize     ( footprint( 100UL ), "Invalid size of the arena" );
+
+   if( reinterpret_cast<size_t>( second ) % size_t( Arena::alignment ) != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment of arena memory\n"
+          << " Details:\n"
+          << "   Address = " << second << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   double* empty( Arena::allocate<double>( 0UL ) );
+
+   checkOwnership( empty, false, "Empty array taken from a full arena" );
+
+   deallocate( empty );
+   deallocate( second );
+
+   checkSize( 0UL, "Arena not empty after the release of all allocations" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the release of arena memory in arbitrary order.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that memory that is not released in reverse order of its allocation is
+// reclaimed as soon as all allocations above it have been released. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testOrder()
+{
+   test_ = "Release of arena memory in arbitrary order";
+
+   const size_t total( footprint( 100UL ) + footprint( 50UL ) + footprint( 0UL ) );
+
+   for( size_t i=0UL; i<3UL; ++i ) {
+      double* a( Arena::allocate<double>( 100UL ) );
+      double* b( Arena::allocate<double>(  50UL ) );
+      double* c( Arena::allocate<double>(   0UL ) );
+      deallocate( c );
+      deallocate( b );
+      deallocate( a );
+   }
+
+   checkCapacity( total, "Arena not grown to the recorded demand" );
+
+   double* a( Arena::allocate<double>( 100UL ) );
+   double* b( Arena::allocate<double>(  50UL ) );
+   double* c( Arena::allocate<double>(   0UL ) );
+
+   checkOwnership( a, true, "First allocation not taken from the arena" );
+   checkOwnership( b, true, "Second allocation not taken from the arena" );
+   checkOwnership( c, true, "Empty allocation not taken from the arena" );
+   checkSize     ( total, "Invalid size of the arena" );
+
+   if( b <= a || c <= b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Arena memory not allocated in a stack-like fashion\n"
+          << " Details:\n"
+          << "   First address = " << a << "\n"
+          << "   Second address = " << b << "\n"
+          << "   Third address = " << c << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   deallocate( b );
+   checkSize( total, "Memory in the middle of the arena reclaimed too early" );
+
+   deallocate( a );
+   checkSize( total, "Memory at the bottom of the arena reclaimed too early" );
+
+   deallocate( c );
+   checkSize( 0UL, "Released memory below the top of the arena not reclaimed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of the arena by repeated allocations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that after the warm-up phase repeated allocations of the same pattern are
+// taken from the same memory of the arena and that the arena is not enlarged again. Additionally
+// it tests that an arena is only enlarged when it is empty. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testReuse()
+{
+   test_ = "Reuse of the arena";
+
+   Arena::release();
+
+   double* first ( NULL );
+   double* second( NULL );
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<10UL; ++i )
+   {
+      double* a( Arena::allocate<double>( 300UL ) );
+      double* b( Arena::allocate<double>( 700UL ) );
+
+      if( i == 2UL ) {
+         checkOwnership( a, true, "First allocation not taken from the arena" );
+         checkOwnership( b, true, "Second allocation not taken from the arena" );
+         first    = a;
+         second   = b;
+         capacity = Arena::capacity();
+      }
+      else if( i > 2UL && ( a != first || b != second || Arena::capacity() != capacity ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Arena memory not reused\n"
+             << " Details:\n"
+             << "   Iteration = " << i << "\n"
+             << "   Addresses = " << a << ", " << b << "\n"
+             << "   Expected addresses = " << first << ", " << second << "\n"
+             << "   Capacity = " << Arena::capacity() << "\n"
+             << "   Expected capacity = " << capacity << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      deallocate( b );
+      deallocate( a );
+   }
+
+   checkCapacity( footprint( 300UL ) + footprint( 700UL ), "Invalid capacity after the warm-up" );
+
+   double* a( Arena::allocate<double>( 300UL ) );
+   double* b( Arena::allocate<double>( 5000UL ) );
+
+   checkOwnership( b, false, "Oversized allocation taken from the arena" );
+   checkCapacity ( capacity, "Arena grown while in use" );
+
+   deallocate( b );
+   deallocate( a );
+
+   a = Arena::allocate<double>( 300UL );
+   b = Arena::allocate<double>( 5000UL );
+
+   checkOwnership( b, true, "Arena not grown to the recorded demand" );
+   checkCapacity ( footprint( 300UL ) + footprint( 5000UL ), "Invalid capacity after the growth" );
+
+   deallocate( b );
+   deallocate( a );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reset of the arena via the release() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the release() function has no effect on an arena in use and that it
+// returns the memory of an empty arena and resets the recorded demand. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testRelease()
+{
+   test_ = "Reset of the arena";
+
+   for( size_t i=0UL; i<2UL; ++i )
+      deallocate( Arena::allocate<double>( 200UL ) );
+
+   const size_t capacity( Arena::capacity() );
+   double* a( Arena::allocate<double>( 200UL ) );
+
+   checkOwnership( a, true, "Allocation not taken from the arena" );
+
+   Arena::release();
+
+   checkOwnership( a, true, "Arena in use released" );
+   checkCapacity ( capacity, "Arena in use released" );
+   checkSize     ( footprint( 200UL ), "Invalid size of the arena" );
+
+   deallocate( a );
+   Arena::release();
+
+   checkCapacity( 0UL, "Empty arena not released" );
+   checkSize    ( 0UL, "Empty arena not released" );
+
+   a = Arena::allocate<double>( 200UL );
+
+   checkOwnership( a, false, "Demand not reset by the release of the arena" );
+   checkCapacity ( 0UL, "Demand not reset by the release of the arena" );
+
+   deallocate( a );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the size limit of the arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that allocations exceeding the \a scratchArenaLimit are taken from the
+// free store and that they don't enlarge the arena. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testLimit()
+{
+   test_ = "Size limit of the arena";
+
+   const size_t n( blaze::scratchArenaLimit / sizeof( double ) );
+
+   Arena::release();
+
+   for( size_t i=0UL; i<3UL; ++i ) {
+      double* a( Arena::allocate<double>( n ) );
+      checkOwnership( a, false, "Allocation beyond the size limit taken from the arena" );
+      checkCapacity ( 0UL, "Arena grown beyond the size limit" );
+      deallocate( a );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the independence of the arenas of different threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that every thread uses its own arena, i.e. that the memory of the arena
+// of one thread is not owned by the arena of any other thread and that the allocations of other
+// threads don't affect the arena of the calling thread. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testThreads()
+{
+   if( !BLAZE_THREAD_LOCAL_SUPPORT )
+      return;
+
+   test_ = "Thread-local arenas";
+
+   for( size_t i=0UL; i<2UL; ++i )
+      deallocate( Arena::allocate<double>( 400UL ) );
+
+   double* a( Arena::allocate<double>( 400UL ) );
+   const size_t capacity( Arena::capacity() );
+
+   checkOwnership( a, true, "Allocation not taken from the arena" );
+
+   const size_t threads( 4UL );
+   std::vector<std::string> errors( threads );
+
+   boost::thread_group group;
+
+   for( size_t id=0UL; id<threads; ++id ) {
+      group.create_thread( boost::bind( &ScratchArenaTest::run, a, &errors[id] ) );
+   }
+
+   group.join_all();
+
+   for( size_t id=0UL; id<threads; ++id ) {
+      if( !errors[id].empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << errors[id] << "\n"
+             << " Details:\n"
+             << "   Thread = " << id << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkOwnership( a, true, "Arena memory lost by the allocations of other threads" );
+   checkCapacity ( capacity, "Arena modified by the allocations of other threads" );
+   checkSize     ( footprint( 400UL ), "Arena modified by the allocations of other threads" );
+
+   deallocate( a );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the placement of temporaries via the ScratchTemporary class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that const dense vectors and matrices with built-in element type that
+// are declared directly behind a ScratchTemporary are placed in the arena, that non-const and
+// non-built-in temporaries are not affected, and that an unconsumed request is withdrawn at the
+// end of the lifetime of the ScratchTemporary. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testTemporary()
+{
+   using blaze::complex;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::ScratchTemporary;
+   using blaze::rowMajor;
+
+   if( !blaze::scratchArenaActive )
+      return;
+
+   test_ = "ScratchTemporary class template";
+
+   typedef const DynamicVector<double>           VT;
+   typedef const DynamicMatrix<double,rowMajor>  MT;
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      const ScratchTemporary<VT> scratchV;
+      VT v( 100UL, 1.0 );
+      const ScratchTemporary<MT> scratchM;
+      MT M( 20UL, 30UL, 2.0 );
+
+      if( i == 2UL ) {
+         checkOwnership( v.data(), true, "Const vector temporary not placed in the arena" );
+         checkOwnership( M.data(), true, "Const matrix temporary not placed in the arena" );
+      }
+
+      if( v[99] != 1.0 || M(19,29) != 2.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid initialization of a temporary\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkSize( 0UL, "Arena not empty after the destruction of all temporaries" );
+
+   {
+      const ScratchTemporary< DynamicVector<double> > scratch;
+      DynamicVector<double> v( 100UL );
+      checkOwnership( v.data(), false, "Non-const vector placed in the arena" );
+   }
+
+   {
+      const ScratchTemporary< const DynamicVector< complex<double> > > scratch;
+      const DynamicVector<double> v( 100UL );
+      checkOwnership( v.data(), false, "Vector placed in the arena by a non-built-in request" );
+   }
+
+   {
+      const ScratchTemporary<VT> scratch;
+      UNUSED_PARAMETER( scratch );
+   }
+
+   {
+      const DynamicVector<double> v( 100UL );
+      checkOwnership( v.data(), false, "Unconsumed request not withdrawn" );
+   }
+
+   checkSize( 0UL, "Arena not empty after the destruction of all temporaries" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the temporaries of expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the temporaries of a dense matrix/dense matrix multiplication and of
+// a sparse matrix/dense vector multiplication are placed in the arena, that the arena is reused
+// by repeated evaluations without further growth, and that the results are identical to the
+// results computed without temporaries, both for a serial and a parallel evaluation. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ScratchArenaTest::testExpressions()
+{
+   using blaze::columnVector;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   test_ = "Temporaries of expressions";
+
+   const size_t n( 40UL );
+
+   DynamicMatrix<double,rowMajor> A( n, n ), B( n, n ), C( n, n ), D( n, n );
+   DynamicVector<double,columnVector> a( n ), b( n );
+   CompressedMatrix<double,rowMajor> S( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = double( ( i*3UL + j ) % 7UL );
+         B(i,j) = double( ( i + j*5UL ) % 4UL );
+         C(i,j) = double( ( i*j ) % 5UL );
+         D(i,j) = double( ( i + j ) % 3UL );
+      }
+      a[i] = double( i % 6UL );
+      b[i] = double( i % 4UL );
+      S(i,i) = 2.0;
+      S(i,(i*7UL)%n) = 1.0;
+   }
+
+   const DynamicMatrix<double,rowMajor> AB( A + B ), CD( C + D );
+   const DynamicVector<double,columnVector> ab( a + b );
+   DynamicMatrix<double,rowMajor> refM( AB * CD ), M( n, n );
+   DynamicVector<double,columnVector> refV( S * ab ), v( n );
+
+   Arena::release();
+
+   size_t capacity( 0UL );
+
+   BLAZE_SERIAL_SECTION
+   {
+      for( size_t i=0UL; i<6UL; ++i )
+      {
+         M = ( A + B ) * ( C + D );
+         v = S * ( a + b );
+
+         if( M != refM || v != refV ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid result of the serial evaluation\n"
+                << " Details:\n"
+                << "   Iteration = " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         checkSize( 0UL, "Arena not empty after the evaluation" );
+
+         if( !blaze::scratchArenaActive )
+            continue;
+
+         if( i == 3UL ) {
+            capacity = Arena::capacity();
+            if( capacity < 2UL*footprint( n*n ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Temporaries not placed in the arena\n"
+                   << " Details:\n"
+                   << "   Capacity = " << capacity << "\n"
+                   << "   Expected minimum capacity = " << 2UL*footprint( n*n ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+         else if( i > 3UL ) {
+            checkCapacity( capacity, "Arena grown by a repeated evaluation" );
+         }
+      }
+   }
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      M = ( A + B ) * ( C + D );
+      v = S * ( a + b );
+
+      if( M != refM || v != refV ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result of the parallel evaluation\n"
+             << " Details:\n"
+             << "   Number of threads = " << threads << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes occupied by an arena allocation of \a n double elements.
+//
+// \param n The number of allocated elements.
+// \return The number of bytes occupied in the arena.
+*/
+size_t ScratchArenaTest::footprint( size_t n )
+{
+   const size_t alignment( Arena::alignment );
+   const size_t bytes( ( n > 0UL )?( n*sizeof( double ) ):( 1UL ) );
+   return alignment + ( ( bytes + alignment - 1UL ) / alignment ) * alignment;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the given memory either to the arena or to the free store.
+//
+// \param address The first element of the array to be released.
+// \return void
+*/
+void ScratchArenaTest::deallocate( double* address )
+{
+   if( Arena::owns( address ) )
+      Arena::deallocate( address );
+   else blaze::deallocate( address );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Repeated arena allocations within a separate thread.
+//
+// \param foreign Memory of the arena of a different thread.
+// \param error The error message in case an error is detected.
+// \return void
+*/
+void ScratchArenaTest::run( const void* foreign, std::string* error )
+{
+   if( Arena::owns( foreign ) ) {
+      *error = "Memory of a foreign arena owned by the arena of a thread";
+      return;
+   }
+
+   if( Arena::capacity() != 0UL ) {
+      *error = "Non-empty arena of a new thread";
+      return;
+   }
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      double* a( Arena::allocate<double>( 1000UL ) );
+
+      if( i > 0UL && !Arena::owns( a ) ) {
+         *error = "Repeated allocation not taken from the arena of a thread";
+      }
+
+      deallocate( a );
+
+      if( Arena::owns( foreign ) ) {
+         *error = "Memory of a foreign arena owned by the arena of a thread";
+      }
+   }
+
+   if( Arena::size() != 0UL ) {
+      *error = "Arena of a thread not empty after the release of all allocations";
+   }
+
+   Arena::release();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the size of the arena of the calling thread.
+//
+// \param expected The expected size of the arena in bytes.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ScratchArenaTest::checkSize( size_t expected, const std::string& error ) const
+{
+   if( Arena::size() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Size = " << Arena::size() << "\n"
+          << "   Expected size = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the arena of the calling thread.
+//
+// \param expected The expected capacity of the arena in bytes.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ScratchArenaTest::checkCapacity( size_t expected, const std::string& error ) const
+{
+   if( Arena::capacity() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Capacity = " << Arena::capacity() << "\n"
+          << "   Expected capacity = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the ownership of the given memory by the arena of the calling thread.
+//
+// \param address The address of the first element of the array.
+// \param expected \a true in case the memory is expected to be owned by the arena.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ScratchArenaTest::checkOwnership( const void* address, bool expected,
+                                       const std::string& error ) const
+{
+   if( Arena::owns( address ) != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Address = " << address << "\n"
+          << "   Arena size = " << Arena::size() << "\n"
+          << "   Arena capacity = " << Arena::capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running scratch arena test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_SCRATCHARENA_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during scratch arena test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
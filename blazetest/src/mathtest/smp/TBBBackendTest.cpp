@@ -0,0 +1,567 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/TBBBackendTest.cpp
+//  \brief Source file for the SMP TBB backend test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/SMP.h>
+#include <blaze/system/SMP.h>
+#include <blazetest/mathtest/smp/TBBBackendTest.h>
+
+#if BLAZE_TBB_PARALLEL_MODE
+#  include <tbb/blocked_range.h>
+#  include <tbb/global_control.h>
+#  include <tbb/parallel_for.h>
+#  include <tbb/task_arena.h>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+#if BLAZE_TBB_PARALLEL_MODE
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Functor for the execution of a single test function within a TBB task arena.
+*/
+struct Execute
+{
+   typedef void (TBBBackendTest::*Test)();
+
+   Execute( TBBBackendTest& test, Test function )
+      : test_( &test ), function_( function ) {}
+
+   void operator()() const { (test_->*function_)(); }
+
+   TBBBackendTest* test_;  //!< The test suite.
+   Test function_;         //!< The executed test function.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Range operation incrementing the execution counters of a range of indices.
+*/
+struct Count
+{
+   explicit Count( std::vector<int>& flags )
+      : flags_( &flags ) {}
+
+   void operator()( size_t first, size_t last ) const {
+      for( size_t i=first; i<last; ++i )
+         ++(*flags_)[i];
+   }
+
+   std::vector<int>* flags_;  //!< The execution counters of all indices.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Body of an application parallel loop performing a Blaze assignment per iteration.
+*/
+template< typename VT >  // Type of the dense vectors
+struct NestedAssignment
+{
+   NestedAssignment( std::vector<VT>& targets, const VT& a, const VT& b )
+      : targets_( &targets ), a_( &a ), b_( &b ) {}
+
+   void operator()( const tbb::blocked_range<size_t>& range ) const {
+      for( size_t i=range.begin(); i<range.end(); ++i )
+         (*targets_)[i] = (*a_) + (*b_) * double( i );
+   }
+
+   std::vector<VT>* targets_;  //!< The targets of the assignments.
+   const VT* a_;               //!< The first operand.
+   const VT* b_;               //!< The second operand.
+};
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SMP TBB backend test.
+//
+// \exception std::runtime_error Operation error detected.
+//
+// All tests are executed within TBB task arenas of one, two, four and seven threads. Since the
+// maximum allowed parallelism is raised accordingly, the arenas use the requested number of
+// threads even on machines with fewer cores.
+*/
+TBBBackendTest::TBBBackendTest()
+   : test_()
+   , threads_( 1UL )
+{
+#if BLAZE_TBB_PARALLEL_MODE
+   const size_t concurrencies[] = { 1UL, 2UL, 4UL, 7UL };
+
+   tbb::global_control control( tbb::global_control::max_allowed_parallelism, 7UL );
+
+   for( size_t i=0UL; i<sizeof( concurrencies )/sizeof( concurrencies[0] ); ++i )
+   {
+      threads_ = concurrencies[i];
+
+      tbb::task_arena arena( static_cast<int>( threads_ ) );
+
+      arena.execute( Execute( *this, &TBBBackendTest::testNumThreads ) );
+      arena.execute( Execute( *this, &TBBBackendTest::testVectorAssignments ) );
+      arena.execute( Execute( *this, &TBBBackendTest::testMatrixAssignments ) );
+      arena.execute( Execute( *this, &TBBBackendTest::testParallelFor ) );
+      arena.execute( Execute( *this, &TBBBackendTest::testNestedOperations ) );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_TBB_PARALLEL_MODE
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the thread limits of the TBB backend.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the number of threads of a parallel operation is bounded both by
+// the concurrency of the current task arena and by the limit specified via setNumThreads(),
+// and that invalid settings are rejected. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void TBBBackendTest::testNumThreads()
+{
+   test_ = "Number of threads";
+
+   blaze::setNumThreads( 64UL );
+
+   if( blaze::getNumThreads() != threads_ ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Number of threads not bounded by the task arena\n"
+          << " Details:\n"
+          << "   Arena concurrency = " << threads_ << "\n"
+          << "   Number of threads = " << blaze::getNumThreads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setNumThreads( 2UL );
+
+   if( blaze::getNumThreads() != ( threads_ < 2UL ? threads_ : 2UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Number of threads not bounded by the thread limit\n"
+          << " Details:\n"
+          << "   Arena concurrency = " << threads_ << "\n"
+          << "   Number of threads = " << blaze::getNumThreads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setNumThreads( 64UL );
+
+   try {
+      blaze::setNumThreads( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting zero threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::setAffinity( "invalid" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an invalid affinity succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments to dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the SMP assignment, addition assignment, subtraction assignment, and
+// multiplication assignment of dense and sparse vector operands to the according serial
+// assignments. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TBBBackendTest::testVectorAssignments()
+{
+   test_ = "Dense vector assignments";
+
+   const size_t n( 100003UL );
+
+   VT a( n ), b( n ), c( n );
+   SVT s( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = double( i%17UL );
+      b[i] = double( i%13UL ) - 6.0;
+      c[i] = double( i%11UL ) + 1.0;
+      if( i%7UL == 0UL )
+         s[i] = double( i%5UL ) + 1.0;
+   }
+
+   {
+      VT result( a ), expected( a );
+      result = b + c;
+      BLAZE_SERIAL_SECTION { expected = b + c; }
+      checkResult( result, expected, "Assignment of a dense vector addition failed" );
+   }
+
+   {
+      VT result( a ), expected( a );
+      result += b * 2.0;
+      BLAZE_SERIAL_SECTION { expected += b * 2.0; }
+      checkResult( result, expected, "Addition assignment of a scaled dense vector failed" );
+   }
+
+   {
+      VT result( a ), expected( a );
+      result -= b - c;
+      BLAZE_SERIAL_SECTION { expected -= b - c; }
+      checkResult( result, expected, "Subtraction assignment of a dense vector subtraction failed" );
+   }
+
+   {
+      VT result( a ), expected( a );
+      result *= c;
+      BLAZE_SERIAL_SECTION { expected *= c; }
+      checkResult( result, expected, "Multiplication assignment of a dense vector failed" );
+   }
+
+   {
+      VT result( a ), expected( a );
+      result = s;
+      BLAZE_SERIAL_SECTION { expected = s; }
+      checkResult( result, expected, "Assignment of a sparse vector failed" );
+   }
+
+   {
+      VT result( a ), expected( a );
+      result += s;
+      BLAZE_SERIAL_SECTION { expected += s; }
+      checkResult( result, expected, "Addition assignment of a sparse vector failed" );
+   }
+
+   {
+      VT result( a ), expected( a );
+      result -= s * 3.0;
+      BLAZE_SERIAL_SECTION { expected -= s * 3.0; }
+      checkResult( result, expected, "Subtraction assignment of a scaled sparse vector failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments to dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the SMP assignment, addition assignment, and subtraction assignment
+// of dense and sparse matrix operands with row-major and column-major storage order, as well
+// as the SMP matrix multiplication, to the according serial assignments. All values are small
+// integers, such that the results are exact for any decomposition of the computations. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TBBBackendTest::testMatrixAssignments()
+{
+   test_ = "Dense matrix assignments";
+
+   const size_t m( 301UL );
+   const size_t n( 257UL );
+
+   MT  A( m, n ), B( m, n ), C( n, n );
+   TMT TB( m, n );
+   SMT S( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j)  = double( ( i+j )%7UL );
+         B(i,j)  = double( ( 3UL*i+j )%5UL ) - 2.0;
+         TB(i,j) = double( ( i+2UL*j )%9UL ) - 4.0;
+         if( ( i+j )%11UL == 0UL )
+            S(i,j) = double( i%3UL ) + 1.0;
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         C(i,j) = double( ( i*j )%3UL ) - 1.0;
+      }
+   }
+
+   {
+      MT result( A ), expected( A );
+      result = B + TB;
+      BLAZE_SERIAL_SECTION { expected = B + TB; }
+      checkResult( result, expected, "Assignment of a mixed dense matrix addition failed" );
+   }
+
+   {
+      TMT result( A ), expected( A );
+      result = B - TB * 2.0;
+      BLAZE_SERIAL_SECTION { expected = B - TB * 2.0; }
+      checkResult( result, expected, "Assignment of a mixed dense matrix subtraction failed" );
+   }
+
+   {
+      MT result( A ), expected( A );
+      result += TB;
+      BLAZE_SERIAL_SECTION { expected += TB; }
+      checkResult( result, expected, "Addition assignment of a dense matrix failed" );
+   }
+
+   {
+      TMT result( A ), expected( A );
+      result -= B;
+      BLAZE_SERIAL_SECTION { expected -= B; }
+      checkResult( result, expected, "Subtraction assignment of a dense matrix failed" );
+   }
+
+   {
+      MT result( A ), expected( A );
+      result = B * C;
+      BLAZE_SERIAL_SECTION { expected = B * C; }
+      checkResult( result, expected, "Assignment of a dense matrix multiplication failed" );
+   }
+
+   {
+      MT result( A ), expected( A );
+      result = S;
+      BLAZE_SERIAL_SECTION { expected = S; }
+      checkResult( result, expected, "Assignment of a sparse matrix failed" );
+   }
+
+   {
+      TMT result( A ), expected( A );
+      result += S;
+      BLAZE_SERIAL_SECTION { expected += S; }
+      checkResult( result, expected, "Addition assignment of a sparse matrix failed" );
+   }
+
+   {
+      MT result( A ), expected( A );
+      result -= S * C;
+      BLAZE_SERIAL_SECTION { expected -= S * C; }
+      checkResult( result, expected, "Subtraction assignment of a sparse matrix multiplication failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the smpFor() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the smpFor() function processes each index of the given range
+// exactly once. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TBBBackendTest::testParallelFor()
+{
+   test_ = "Parallel loop";
+
+   const size_t sizes[] = { 1UL, 2UL, 7UL, 1000UL, 100003UL };
+
+   for( size_t s=0UL; s<sizeof( sizes )/sizeof( sizes[0] ); ++s )
+   {
+      std::vector<int> flags( sizes[s]+2UL, 0 );
+
+      blaze::smpFor( 1UL, sizes[s]+1UL, Count( flags ) );
+
+      for( size_t i=0UL; i<flags.size(); ++i ) {
+         if( flags[i] != ( i == 0UL || i == sizes[s]+1UL ? 0 : 1 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Index not processed exactly once\n"
+                << " Details:\n"
+                << "   Arena concurrency = " << threads_ << "\n"
+                << "   Range = [1.." << sizes[s]+1UL << ")\n"
+                << "   Index = " << i << "\n"
+                << "   Executions = " << flags[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel operations started from within application tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs an SMP assignment within each iteration of an application TBB parallel
+// loop and compares the results to the according serial assignments. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void TBBBackendTest::testNestedOperations()
+{
+   test_ = "Nested parallel operations";
+
+   const size_t n( 60000UL );
+   const size_t iterations( 9UL );
+
+   VT a( n ), b( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = double( i%19UL );
+      b[i] = double( i%23UL ) - 11.0;
+   }
+
+   std::vector<VT> targets( iterations, VT( n, 0.0 ) );
+
+   tbb::parallel_for( tbb::blocked_range<size_t>( 0UL, iterations, 1UL ),
+                      NestedAssignment<VT>( targets, a, b ) );
+
+   for( size_t i=0UL; i<iterations; ++i ) {
+      VT expected( n );
+      BLAZE_SERIAL_SECTION { expected = a + b * double( i ); }
+      checkResult( targets[i], expected, "Assignment within an application task failed" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of an SMP assignment.
+//
+// \param result The result of the SMP assignment.
+// \param expected The result of the serial assignment.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void TBBBackendTest::checkResult( const T1& result, const T2& expected, const std::string& error ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Arena concurrency = " << threads_ << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP TBB backend test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_TBB_BACKEND_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP TBB backend test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,544 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ThreadBackendTest.cpp
+//  \brief Source file for the SMP thread backend test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/math/SMP.h>
+#include <blaze/math/Views.h>
+#include <blazetest/mathtest/smp/ThreadBackendTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Range operation for the initialization of a vector.
+//
+// The operation sets each element of the given subrange to the sum of its index and an offset.
+*/
+struct Fill
+{
+   Fill( std::vector<double>& values, double offset )
+      : values_( &values ), offset_( offset ) {}
+
+   void operator()( size_t begin, size_t end ) const {
+      for( size_t i=begin; i<end; ++i )
+         (*values_)[i] = offset_ + i;
+   }
+
+   std::vector<double>* values_;  //!< The vector to be initialized.
+   double offset_;                //!< The offset of all elements.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Range operation performing nested SMP operations for each row of a matrix.
+//
+// For each row of the given subrange the operation performs an SMP assignment to the row and
+// an SMP range loop over the columns of the row.
+*/
+struct NestedFill
+{
+   NestedFill( blaze::DynamicMatrix<double>& A, const blaze::DynamicVector<double>& x,
+               std::vector< std::vector<double> >& values )
+      : A_( &A ), x_( &x ), values_( &values ) {}
+
+   void operator()( size_t begin, size_t end ) const {
+      for( size_t i=begin; i<end; ++i ) {
+         row( *A_, i ) = trans( (*x_) * double( i+1UL ) );
+         blaze::smpFor( 0UL, (*values_)[i].size(), Fill( (*values_)[i], double( i ) ) );
+      }
+   }
+
+   blaze::DynamicMatrix<double>* A_;             //!< The matrix to be initialized.
+   const blaze::DynamicVector<double>* x_;       //!< The vector assigned to each row.
+   std::vector< std::vector<double> >* values_;  //!< The vectors to be initialized per row.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Range operation throwing an exception for a single index.
+//
+// The operation marks all indices of the given subrange as visited. In case the subrange
+// contains the given invalid index, a \a std::invalid_argument exception is thrown afterwards.
+*/
+struct Thrower
+{
+   Thrower( std::vector<int>& visited, size_t invalid )
+      : visited_( &visited ), invalid_( invalid ) {}
+
+   void operator()( size_t begin, size_t end ) const {
+      for( size_t i=begin; i<end; ++i )
+         (*visited_)[i] = 1;
+      if( begin <= invalid_ && invalid_ < end )
+         throw std::invalid_argument( "Invalid index detected" );
+   }
+
+   std::vector<int>* visited_;  //!< The visit flags of all indices.
+   size_t invalid_;             //!< The index causing the exception.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SMP thread backend test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ThreadBackendTest::ThreadBackendTest()
+{
+   testConcurrentSubmissions();
+   testNestedWaits();
+   testExceptionPropagation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent submission of SMP operations from several application threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts several application threads that concurrently submit SMP assignments
+// and SMP range loops to the backend system and checks the results of all operations for
+// different numbers of threads of the backend system. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ThreadBackendTest::testConcurrentSubmissions()
+{
+   test_ = "Concurrent submissions";
+
+   const size_t submitters( 4UL );
+
+   for( size_t threads=1UL; threads<=5UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::vector<std::string> errors( submitters );
+      boost::thread_group group;
+
+      for( size_t id=0UL; id<submitters; ++id ) {
+         group.create_thread( boost::bind( &ThreadBackendTest::submit, id, 20UL, &errors[id] ) );
+      }
+
+      group.join_all();
+
+      for( size_t id=0UL; id<submitters; ++id ) {
+         if( !errors[id].empty() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed SMP operation in application thread " << id << "\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   " << errors[id] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested waits for SMP operations and asynchronous statements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests SMP operations that are submitted from within the tasks of another SMP
+// operation and asynchronous statements whose evaluation requires an SMP operation while the
+// application thread waits for a different SMP operation. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ThreadBackendTest::testNestedWaits()
+{
+   test_ = "Nested waits";
+
+   for( size_t threads=1UL; threads<=5UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      // SMP operations within an SMP range loop
+      {
+         const size_t m( 37UL );
+         const size_t n( 500UL );
+
+         MT A( m, n, 0.0 );
+         VT x( n );
+         for( size_t j=0UL; j<n; ++j )
+            x[j] = double( j );
+
+         std::vector< std::vector<double> > values( m, std::vector<double>( n, 0.0 ) );
+
+         blaze::smpFor( 0UL, m, NestedFill( A, x, values ) );
+
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               if( A(i,j) != double( (i+1UL)*j ) || values[i][j] != double( i+j ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Nested SMP operation failed\n"
+                      << " Details:\n"
+                      << "   Number of threads = " << threads << "\n"
+                      << "   Element (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // SMP operations within asynchronous statements
+      {
+         const size_t n( 50000UL );
+
+         VT a( n ), b( n, 0.0 ), c( n, 0.0 );
+         for( size_t i=0UL; i<n; ++i )
+            a[i] = double( i );
+
+         std::vector<double> values( n, 0.0 );
+
+         blaze::AsyncHandle h1( blaze::async( b, a + a ) );
+         blaze::AsyncHandle h2( blaze::async( c, b + a ) );
+
+         blaze::smpFor( 0UL, n, Fill( values, 1.0 ) );
+
+         h2.wait();
+         h1.wait();
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( b[i] != 2.0*i || c[i] != 3.0*i || values[i] != 1.0+i ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Asynchronous statement failed\n"
+                   << " Details:\n"
+                   << "   Number of threads = " << threads << "\n"
+                   << "   Element " << i << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions from the tasks of an SMP operation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown by a task of an SMP range loop is rethrown in
+// the submitting thread after all other tasks of the loop have been completed, and that the
+// backend system remains usable afterwards. The test is also performed concurrently from
+// several application threads. Since exceptions must not leave an OpenMP parallel region, the
+// test is skipped for the OpenMP backend. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ThreadBackendTest::testExceptionPropagation()
+{
+#if !BLAZE_OPENMP_PARALLEL_MODE
+   test_ = "Exception propagation";
+
+   const size_t n( 1000UL );
+   const size_t invalid[] = { 0UL, 1UL, 333UL, 500UL, 999UL };
+
+   for( size_t threads=1UL; threads<=5UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      for( size_t k=0UL; k<sizeof(invalid)/sizeof(size_t); ++k )
+      {
+         std::vector<int> visited( n, 0 );
+
+         try {
+            blaze::smpFor( 0UL, n, Thrower( visited, invalid[k] ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Exception of a task was not propagated\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   Invalid index     = " << invalid[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( !visited[i] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Exception propagated before the completion of all tasks\n"
+                   << " Details:\n"
+                   << "   Number of threads = " << threads << "\n"
+                   << "   Invalid index     = " << invalid[k] << "\n"
+                   << "   Unvisited index   = " << i << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      std::vector<double> values( n, 0.0 );
+      blaze::smpFor( 0UL, n, Fill( values, 2.0 ) );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( values[i] != 2.0+i ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: SMP range loop failed after an exception\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      const size_t submitters( 3UL );
+
+      std::vector<std::string> errors( submitters );
+      boost::thread_group group;
+
+      for( size_t id=0UL; id<submitters; ++id ) {
+         group.create_thread( boost::bind( &ThreadBackendTest::fail, id, 20UL, &errors[id] ) );
+      }
+
+      group.join_all();
+
+      for( size_t id=0UL; id<submitters; ++id ) {
+         if( !errors[id].empty() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed exception propagation in application thread " << id << "\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   " << errors[id] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Repeated submission of SMP operations from a single application thread.
+//
+// \param id The index of the application thread.
+// \param repetitions The number of submissions.
+// \param error The description of the first detected error.
+// \return void
+//
+// This function is executed by each application thread of the concurrent submission test. The
+// first detected error is stored in \a error.
+*/
+void ThreadBackendTest::submit( size_t id, size_t repetitions, std::string* error )
+{
+   try {
+      const size_t n( 50000UL );
+
+      VT a( n ), b( n );
+      MT A( 120UL, 130UL ), B( 120UL, 130UL );
+      std::vector<double> values( n );
+
+      for( size_t rep=0UL; rep<repetitions; ++rep )
+      {
+         const double offset( double( id*repetitions + rep ) );
+
+         for( size_t i=0UL; i<n; ++i )
+            a[i] = offset + i;
+
+         b = a + a;
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( b[i] != 2.0*( offset + i ) ) {
+               std::ostringstream oss;
+               oss << "Vector addition failed at element " << i << " in repetition " << rep;
+               *error = oss.str();
+               return;
+            }
+         }
+
+         A = offset;
+         B = A * 2.0;
+
+         for( size_t i=0UL; i<B.rows(); ++i ) {
+            for( size_t j=0UL; j<B.columns(); ++j ) {
+               if( B(i,j) != 2.0*offset ) {
+                  std::ostringstream oss;
+                  oss << "Matrix scaling failed at element (" << i << "," << j << ") in repetition " << rep;
+                  *error = oss.str();
+                  return;
+               }
+            }
+         }
+
+         blaze::smpFor( 0UL, n, Fill( values, offset ) );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( values[i] != offset + i ) {
+               std::ostringstream oss;
+               oss << "SMP range loop failed at index " << i << " in repetition " << rep;
+               *error = oss.str();
+               return;
+            }
+         }
+      }
+   }
+   catch( std::exception& ex ) {
+      *error = ex.what();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Repeated submission of failing SMP range loops from a single application thread.
+//
+// \param id The index of the application thread.
+// \param repetitions The number of submissions.
+// \param error The description of the first detected error.
+// \return void
+//
+// This function is executed by each application thread of the exception propagation test. The
+// first detected error is stored in \a error.
+*/
+void ThreadBackendTest::fail( size_t id, size_t repetitions, std::string* error )
+{
+   const size_t n( 100UL );
+
+   std::vector<int> visited( n );
+
+   for( size_t rep=0UL; rep<repetitions; ++rep )
+   {
+      std::fill( visited.begin(), visited.end(), 0 );
+
+      try {
+         blaze::smpFor( 0UL, n, Thrower( visited, ( id*7UL + rep*13UL ) % n ) );
+         *error = "Exception of a task was not propagated";
+         return;
+      }
+      catch( std::invalid_argument& ) {}
+      catch( std::exception& ex ) {
+         *error = ex.what();
+         return;
+      }
+
+      if( std::find( visited.begin(), visited.end(), 0 ) != visited.end() ) {
+         *error = "Exception propagated before the completion of all tasks";
+         return;
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP thread backend test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_THREADBACKEND_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP thread backend test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,411 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ThreadMappingTest.cpp
+//  \brief Source file for the SMP thread mapping test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/smp/ThreadMappingTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SMP thread mapping test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ThreadMappingTest::ThreadMappingTest()
+{
+   testMapping();
+   testAssignment();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ThreadMapping class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the 2D tile partition for 1 to 16 threads, many matrix shapes and
+// different alignments. The tiles have to cover the matrix exactly once without empty tiles,
+// they must respect the alignments and they have to use at least as many threads as a pure
+// row or column partition. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ThreadMappingTest::testMapping()
+{
+   test_ = "ThreadMapping";
+
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 3UL, 5UL, 7UL, 16UL, 17UL, 31UL, 64UL, 100UL, 129UL, 257UL, 1000UL };
+   const size_t alignments[][2] = { { 1UL, 1UL }, { 1UL, 8UL }, { 4UL, 8UL }, { 8UL, 1UL }, { 2UL, 16UL } };
+
+   const size_t numSizes( sizeof(sizes)/sizeof(size_t) );
+   const size_t numAlignments( sizeof(alignments)/sizeof(alignments[0]) );
+
+   for( size_t threads=1UL; threads<=16UL; ++threads ) {
+      for( size_t a=0UL; a<numAlignments; ++a ) {
+         for( size_t im=0UL; im<numSizes; ++im ) {
+            for( size_t in=0UL; in<numSizes; ++in )
+            {
+               const size_t m ( sizes[im] );
+               const size_t n ( sizes[in] );
+               const size_t ra( alignments[a][0] );
+               const size_t ca( alignments[a][1] );
+
+               const blaze::ThreadMapping tiles( threads, m, n, ra, ca );
+
+               std::ostringstream details;
+               details << " Details:\n"
+                       << "   Number of threads = " << threads << "\n"
+                       << "   Matrix size       = " << m << "x" << n << "\n"
+                       << "   Alignments        = " << ra << "/" << ca << "\n"
+                       << "   Tiles             = " << tiles.rows() << "x" << tiles.columns()
+                       << " of size " << tiles.rowsPerThread() << "x" << tiles.colsPerThread() << "\n";
+
+               if( m == 0UL || n == 0UL ) {
+                  if( tiles.size() != 0UL ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Tiles for an empty matrix\n"
+                         << details.str();
+                     throw std::runtime_error( oss.str() );
+                  }
+                  continue;
+               }
+
+               if( tiles.size() == 0UL || tiles.size() > threads ||
+                   tiles.size() != tiles.rows() * tiles.columns() ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid number of tiles\n"
+                      << details.str();
+                  throw std::runtime_error( oss.str() );
+               }
+
+               if( tiles.rowsPerThread() % ra != 0UL || tiles.colsPerThread() % ca != 0UL ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Unaligned tiles\n"
+                      << details.str();
+                  throw std::runtime_error( oss.str() );
+               }
+
+               if( tiles.rows()*tiles.rowsPerThread() < m || ( tiles.rows()-1UL )*tiles.rowsPerThread() >= m ||
+                   tiles.columns()*tiles.colsPerThread() < n || ( tiles.columns()-1UL )*tiles.colsPerThread() >= n ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Tiles don't cover the matrix or contain empty tiles\n"
+                      << details.str();
+                  throw std::runtime_error( oss.str() );
+               }
+
+               const size_t maxRows   ( ( m + ra - 1UL ) / ra );
+               const size_t maxCols   ( ( n + ca - 1UL ) / ca );
+               const size_t p         ( ( threads < maxRows )?( threads ):( maxRows ) );
+               const size_t q         ( ( threads < maxCols )?( threads ):( maxCols ) );
+               const size_t rowBand   ( ( ( m + p - 1UL ) / p + ra - 1UL ) / ra * ra );
+               const size_t colBand   ( ( ( n + q - 1UL ) / q + ca - 1UL ) / ca * ca );
+               const size_t rowTiles  ( ( m + rowBand - 1UL ) / rowBand );
+               const size_t colTiles  ( ( n + colBand - 1UL ) / colBand );
+
+               if( tiles.size() < rowTiles || tiles.size() < colTiles ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Fewer tiles than a 1D partition\n"
+                      << details.str()
+                      << "   1D partitions     = " << rowTiles << " row bands, " << colTiles << " column bands\n";
+                  throw std::runtime_error( oss.str() );
+               }
+
+               if( m > 300UL || n > 300UL )
+                  continue;
+
+               std::vector<int> counts( m*n, 0 );
+
+               for( size_t i=0UL; i<tiles.rows(); ++i ) {
+                  for( size_t j=0UL; j<tiles.columns(); ++j ) {
+                     const size_t rbegin( i*tiles.rowsPerThread() );
+                     const size_t cbegin( j*tiles.colsPerThread() );
+                     const size_t rend  ( ( rbegin+tiles.rowsPerThread() < m )?( rbegin+tiles.rowsPerThread() ):( m ) );
+                     const size_t cend  ( ( cbegin+tiles.colsPerThread() < n )?( cbegin+tiles.colsPerThread() ):( n ) );
+                     for( size_t r=rbegin; r<rend; ++r )
+                        for( size_t c=cbegin; c<cend; ++c )
+                           ++counts[r*n+c];
+                  }
+               }
+
+               for( size_t e=0UL; e<m*n; ++e ) {
+                  if( counts[e] != 1 ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Element not covered exactly once\n"
+                         << details.str()
+                         << "   Element           = (" << e/n << "," << e%n << ")\n"
+                         << "   Coverage          = " << counts[e] << "\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the tiled SMP assignments of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the SMP assignment, addition assignment, subtraction assignment and
+// multiplication of row-major and column-major dense matrices with the serial results for odd
+// numbers of threads. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadMappingTest::testAssignment()
+{
+   test_ = "Tiled SMP assignment";
+
+   for( size_t threads=1UL; threads<=9UL; threads+=2UL )
+   {
+      blaze::setNumThreads( threads );
+
+      testAssignment<MT,MT,MT>   ( 301UL, 157UL, 83UL );
+      testAssignment<MT,MT,MT>   ( 1001UL, 33UL, 17UL );
+      testAssignment<MT,TMT,MT>  ( 199UL, 1001UL, 5UL );
+      testAssignment<TMT,TMT,TMT>( 157UL, 301UL, 83UL );
+      testAssignment<TMT,MT,TMT> ( 33UL, 1001UL, 17UL );
+      testAssignment<TMT,TMT,MT> ( 1001UL, 199UL, 5UL );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparison of the SMP assignments to an \f$ M \times N \f$ matrix with the serial results.
+//
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param k The inner dimension of the matrix multiplication.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the target matrix
+        , typename T2    // Type of the first operand
+        , typename T3 >  // Type of the second operand
+void ThreadMappingTest::testAssignment( size_t m, size_t n, size_t k )
+{
+   T2 B( m, n ), D( m, k );
+   T3 C( m, n ), E( k, n );
+
+   randomize( B, 1UL );
+   randomize( C, 2UL );
+   randomize( D, 3UL );
+   randomize( E, 4UL );
+
+   T1 A, R;
+
+   BLAZE_SERIAL_SECTION {
+      R = B;
+   }
+   A = B;
+   checkResult( A, R, "Assignment", blaze::getNumThreads() );
+
+   BLAZE_SERIAL_SECTION {
+      R = B + C;
+   }
+   A = B + C;
+   checkResult( A, R, "Addition", blaze::getNumThreads() );
+
+   BLAZE_SERIAL_SECTION {
+      R += B;
+   }
+   A += B;
+   checkResult( A, R, "Addition assignment", blaze::getNumThreads() );
+
+   BLAZE_SERIAL_SECTION {
+      R -= C;
+   }
+   A -= C;
+   checkResult( A, R, "Subtraction assignment", blaze::getNumThreads() );
+
+   BLAZE_SERIAL_SECTION {
+      R = B * 3.0;
+   }
+   A = B * 3.0;
+   checkResult( A, R, "Scaling", blaze::getNumThreads() );
+
+   BLAZE_SERIAL_SECTION {
+      R = D * E;
+   }
+   A = D * E;
+   checkResult( A, R, "Multiplication", blaze::getNumThreads() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an SMP assignment.
+//
+// \param result The result of the SMP assignment.
+// \param expected The result of the serial assignment.
+// \param op The label of the performed operation.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the result matrix
+        , typename T2 >  // Type of the expected matrix
+void ThreadMappingTest::checkResult( const T1& result, const T2& expected,
+                                     const std::string& op, size_t threads ) const
+{
+   if( result.rows() != expected.rows() || result.columns() != expected.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << op << " failed\n"
+          << " Details:\n"
+          << "   Number of threads = " << threads << "\n"
+          << "   Result size = " << result.rows() << "x" << result.columns() << "\n"
+          << "   Expected size = " << expected.rows() << "x" << expected.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         if( result(i,j) != expected(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << op << " failed\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   Matrix size = " << result.rows() << "x" << result.columns() << "\n"
+                << "   Element (" << i << "," << j << ") = " << result(i,j) << "\n"
+                << "   Expected value = " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a matrix with small integral values.
+//
+// \param A The matrix to be initialized.
+// \param seed The seed of the initialization.
+// \return void
+//
+// All values are small integers, such that the results of the tested operations are exact
+// independent of the order of evaluation.
+*/
+template< typename Type >  // Type of the matrix
+void ThreadMappingTest::randomize( Type& A, size_t seed )
+{
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = double( ( i*7UL + j*13UL + seed*5UL ) % 11UL ) - 5.0;
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP thread mapping test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_THREADMAPPING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP thread mapping test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
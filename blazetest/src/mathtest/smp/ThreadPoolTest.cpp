@@ -0,0 +1,579 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ThreadPoolTest.cpp
+//  \brief Source file for the thread pool test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <blazetest/mathtest/smp/ThreadPoolTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Task incrementing the execution counter of a single index.
+*/
+struct Mark
+{
+   Mark( std::vector<int>& flags, size_t index )
+      : flags_( &flags ), index_( index ) {}
+
+   void operator()() const { ++(*flags_)[index_]; }
+
+   std::vector<int>* flags_;  //!< The execution counters of all indices.
+   size_t index_;             //!< The index of the task.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task of configurable size tracking the number of its live copies.
+//
+// The size of the task can be used to select between the in-place storage and the heap storage
+// of the threadpool::Task class.
+*/
+template< size_t N >  // Size of the payload
+struct Tracked
+{
+   Tracked( boost::atomic<int>& live, boost::atomic<int>& runs )
+      : live_( &live ), runs_( &runs ) { ++(*live_); }
+
+   Tracked( const Tracked& t )
+      : live_( t.live_ ), runs_( t.runs_ ) { ++(*live_); }
+
+   ~Tracked() { --(*live_); }
+
+   void operator()() const { ++(*runs_); }
+
+   boost::atomic<int>* live_;  //!< The number of live copies.
+   boost::atomic<int>* runs_;  //!< The number of executions.
+   char payload_[N];           //!< The payload of the task.
+
+ private:
+   Tracked& operator=( const Tracked& );
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task pushing its successor into the task queue it is executed from.
+*/
+struct Requeue
+{
+   Requeue( blaze::threadpool::TaskQueue& queue, size_t remaining, size_t& runs, bool& failed )
+      : queue_( &queue ), remaining_( remaining ), runs_( &runs ), failed_( &failed ) {}
+
+   void operator()() const {
+      ++(*runs_);
+      if( remaining_ > 0UL && !queue_->push( Requeue( *queue_, remaining_-1UL, *runs_, *failed_ ) ) )
+         *failed_ = true;
+   }
+
+   blaze::threadpool::TaskQueue* queue_;  //!< The queue the task is executed from.
+   size_t remaining_;                     //!< The number of remaining successors.
+   size_t* runs_;                         //!< The number of executions.
+   bool* failed_;                         //!< Failure flag for pushing the successor.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the thread pool test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ThreadPoolTest::ThreadPoolTest()
+{
+   testTaskQueue();
+   testConcurrentQueue();
+   testThreadPool();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the task queue.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the capacity, the FIFO order and the storage of small and large tasks
+// of the task queue, as well as tasks pushing further tasks into the queue they are executed
+// from. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadPoolTest::testTaskQueue()
+{
+   test_ = "Task queue";
+
+   // Capacity and FIFO order
+   {
+      Queue queue( 5UL );
+      std::vector<int> flags( 9UL, 0 );
+
+      if( queue.maxSize() != 8UL || !queue.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Maximum size = " << queue.maxSize() << "\n"
+             << "   Expected maximum size = 8\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<8UL; ++i ) {
+         if( !queue.push( Mark( flags, i ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Push to a non-full queue failed\n"
+                << " Details:\n"
+                << "   Index = " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( queue.push( Mark( flags, 8UL ) ) || queue.size() != 8UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Push to a full queue succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( !queue.execute() || flags[0] != 1 || flags[1] != 0 || !queue.push( Mark( flags, 8UL ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Execution of the front task failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=1UL; i<9UL; ++i ) {
+         if( !queue.execute() || flags[i] != 1 || ( i < 8UL && flags[i+1UL] != 0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Tasks not executed in FIFO order\n"
+                << " Details:\n"
+                << "   Index = " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( queue.execute() || !queue.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Execution from an empty queue succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Storage of small and large tasks
+   {
+      boost::atomic<int> live( 0 );
+      boost::atomic<int> runs( 0 );
+
+      {
+         Queue queue( 8UL );
+
+         for( size_t i=0UL; i<3UL; ++i ) {
+            queue.push( Tracked<16UL>( live, runs ) );
+            queue.push( Tracked<1024UL>( live, runs ) );
+         }
+
+         if( live != 6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of stored tasks\n"
+                << " Details:\n"
+                << "   Live tasks = " << live << "\n"
+                << "   Expected live tasks = 6\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         queue.execute();
+         queue.execute();
+
+         if( live != 4 || runs != 2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Execution of small and large tasks failed\n"
+                << " Details:\n"
+                << "   Live tasks = " << live << " (expected 4)\n"
+                << "   Executed tasks = " << runs << " (expected 2)\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         queue.clear();
+
+         if( live != 0 || runs != 2 || !queue.isEmpty() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Clearing the queue failed\n"
+                << " Details:\n"
+                << "   Live tasks = " << live << " (expected 0)\n"
+                << "   Executed tasks = " << runs << " (expected 2)\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         queue.push( Tracked<16UL>( live, runs ) );
+         queue.push( Tracked<1024UL>( live, runs ) );
+      }
+
+      if( live != 0 || runs != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Destruction of pending tasks failed\n"
+             << " Details:\n"
+             << "   Live tasks = " << live << " (expected 0)\n"
+             << "   Executed tasks = " << runs << " (expected 2)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Tasks pushing further tasks while the ring buffer wraps around
+   {
+      Queue queue( 2UL );
+      std::vector<int> flags( 1UL, 0 );
+      size_t runs( 0UL );
+      bool failed( false );
+
+      queue.push( Requeue( queue, 20UL, runs, failed ) );
+      queue.push( Mark( flags, 0UL ) );
+
+      while( queue.execute() ) {}
+
+      if( failed || runs != 21UL || flags[0] != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Push from an executed task failed\n"
+             << " Details:\n"
+             << "   Executed tasks = " << runs << " (expected 21)\n"
+             << "   Failed push = " << std::boolalpha << failed << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent use of the task queue by several producers and consumers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts several producer threads that push tasks to a small task queue and
+// several consumer threads that concurrently execute the tasks. It checks that each task is
+// executed exactly once. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ThreadPoolTest::testConcurrentQueue()
+{
+   test_ = "Concurrent task queue";
+
+   const size_t producers( 3UL );
+   const size_t consumers( 3UL );
+   const size_t tasks    ( 4000UL );
+
+   for( size_t capacity=2UL; capacity<=64UL; capacity*=4UL )
+   {
+      Queue queue( capacity );
+      std::vector<int> flags( producers*tasks, 0 );
+      boost::atomic<size_t> executed( 0UL );
+
+      boost::thread_group group;
+
+      for( size_t i=0UL; i<consumers; ++i ) {
+         group.create_thread( boost::bind( &ThreadPoolTest::consume, &queue, &executed, producers*tasks ) );
+      }
+
+      for( size_t i=0UL; i<producers; ++i ) {
+         group.create_thread( boost::bind( &ThreadPoolTest::produce, &queue, &flags, i*tasks, (i+1UL)*tasks ) );
+      }
+
+      group.join_all();
+
+      if( executed != producers*tasks || !queue.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of executed tasks\n"
+             << " Details:\n"
+             << "   Capacity = " << capacity << "\n"
+             << "   Executed tasks = " << executed << "\n"
+             << "   Expected executed tasks = " << producers*tasks << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      check( flags, test_, "Task not executed exactly once" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks to thread pools of different sizes from several application
+// threads, including more tasks than fit into the task queue, and tests the resizing of the
+// thread pool. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadPoolTest::testThreadPool()
+{
+   test_ = "Thread pool";
+
+   const size_t schedulers( 4UL );
+   const size_t tasks     ( 1500UL );
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      Pool pool( threads );
+
+      if( pool.size() != threads ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Size = " << pool.size() << "\n"
+             << "   Expected size = " << threads << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Concurrent scheduling from several application threads
+      {
+         std::vector<int> flags( schedulers*tasks, 0 );
+         boost::thread_group group;
+
+         for( size_t i=0UL; i<schedulers; ++i ) {
+            group.create_thread( boost::bind( &ThreadPoolTest::schedule, &pool, &flags, i*tasks, (i+1UL)*tasks ) );
+         }
+
+         group.join_all();
+         pool.wait();
+
+         if( !pool.isEmpty() || pool.active() != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Pending tasks after wait\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         check( flags, test_, "Scheduled task not executed exactly once" );
+      }
+
+      // Scheduling after growing and shrinking the pool
+      for( size_t n=1UL; n<=threads+2UL; n+=threads+1UL )
+      {
+         pool.resize( n, true );
+
+         if( pool.size() != n ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Resizing failed\n"
+                << " Details:\n"
+                << "   Size = " << pool.size() << "\n"
+                << "   Expected size = " << n << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         std::vector<int> flags( tasks, 0 );
+         schedule( &pool, &flags, 0UL, tasks );
+         pool.wait();
+
+         check( flags, test_, "Task not executed exactly once after resizing" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pushing a range of tasks to the given task queue.
+//
+// \param queue The task queue.
+// \param flags The execution counters of all tasks.
+// \param first The index of the first task.
+// \param last The index one past the last task.
+// \return void
+//
+// In case the task queue is full, the function retries to push the task until it succeeds.
+*/
+void ThreadPoolTest::produce( Queue* queue, std::vector<int>* flags, size_t first, size_t last )
+{
+   for( size_t i=first; i<last; ++i ) {
+      while( !queue->push( Mark( *flags, i ) ) ) {
+         boost::this_thread::yield();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing tasks from the given task queue until the given number of tasks is reached.
+//
+// \param queue The task queue.
+// \param executed The total number of executed tasks of all consumers.
+// \param total The total number of tasks of all producers.
+// \return void
+*/
+void ThreadPoolTest::consume( Queue* queue, boost::atomic<size_t>* executed, size_t total )
+{
+   while( executed->load() < total ) {
+      if( queue->execute() )
+         ++(*executed);
+      else
+         boost::this_thread::yield();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling a range of tasks to the given thread pool.
+//
+// \param pool The thread pool.
+// \param flags The execution counters of all tasks.
+// \param first The index of the first task.
+// \param last The index one past the last task.
+// \return void
+*/
+void ThreadPoolTest::schedule( Pool* pool, std::vector<int>* flags, size_t first, size_t last )
+{
+   for( size_t i=first; i<last; ++i ) {
+      pool->schedule( Mark( *flags, i ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that each task has been executed exactly once.
+//
+// \param flags The execution counters of all tasks.
+// \param test The label of the current test.
+// \param error The error message in case a task has not been executed exactly once.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ThreadPoolTest::check( const std::vector<int>& flags, const std::string& test, const std::string& error )
+{
+   for( size_t i=0UL; i<flags.size(); ++i ) {
+      if( flags[i] != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test << "\n"
+             << " Error: " << error << "\n"
+             << " Details:\n"
+             << "   Task index = " << i << "\n"
+             << "   Number of executions = " << flags[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread pool test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_THREADPOOL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread pool test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,603 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/BasisFactorizationTest.cpp
+//  \brief Source file for the basis factorization test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Functions.h>
+#include <blazetest/mathtest/solvers/BasisFactorizationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the basis factorization test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+BasisFactorizationTest::BasisFactorizationTest()
+{
+   testFactorization();
+   testHypersparse();
+   testUpdate();
+   testSingular();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the LU factorization of different bases.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function factorizes a tridiagonal basis, a basis with a zero diagonal (which requires
+// a column permutation), an arrowhead basis (which can only be factorized without fill-in in
+// case the dense row and column are eliminated last) and a basis with tiny diagonal elements
+// (which requires threshold pivoting) and checks the residuals of the forward and backward
+// transformations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BasisFactorizationTest::testFactorization()
+{
+   test_ = "LU factorization of bases";
+
+   blaze::BasisFactorization bf;
+
+   {
+      const MT B( tridiagonal( 50UL ) );
+
+      if( !bf.factor( B ) || bf.size() != 50UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of a tridiagonal basis failed\n"
+             << " Details:\n"
+             << "   Size of the factorization = " << bf.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkUpdates( bf, 0UL, "Tridiagonal basis" );
+      checkSolves( bf, B, "Tridiagonal basis" );
+   }
+
+   {
+      const size_t n( 50UL );
+      const MT T( tridiagonal( n ) );
+
+      MT B( n, n );
+      B.reserve( T.nonZeros() );
+      for( size_t j=0UL; j<n; ++j ) {
+         const size_t k( ( j + n/2UL ) % n );
+         for( MT::ConstIterator element=T.begin(k); element!=T.end(k); ++element )
+            B.append( element->index(), j, element->value() );
+         B.finalize( j );
+      }
+
+      if( !bf.factor( B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of a basis with zero diagonal failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolves( bf, B, "Basis with zero diagonal" );
+   }
+
+   {
+      const size_t n( 60UL );
+
+      MT B( n, n );
+      B.reserve( 3UL*n );
+      for( size_t j=0UL; j<n; ++j ) {
+         if( j == 0UL ) {
+            B.append( 0UL, 0UL, blaze::real( 2*n ) );
+            for( size_t i=1UL; i<n; ++i )
+               B.append( i, 0UL, -1 );
+         }
+         else {
+            B.append( 0UL, j, 1 );
+            B.append( j, j, 4 + blaze::real( j % 3UL ) );
+         }
+         B.finalize( j );
+      }
+
+      if( !bf.factor( B ) || bf.factorNonZeros() != B.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fill-in in the factorization of an arrowhead basis\n"
+             << " Details:\n"
+             << "   Non-zero elements of the basis = " << B.nonZeros() << "\n"
+             << "   Non-zero elements of the factors = " << bf.factorNonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolves( bf, B, "Arrowhead basis" );
+   }
+
+   {
+      const size_t n( 40UL );
+
+      MT B( n, n );
+      B.reserve( 2UL*n );
+      for( size_t j=0UL; j<n; ++j ) {
+         if( j % 2UL == 0UL ) {
+            B.append( j    , j, 1E-12 );
+            B.append( j+1UL, j, 1 );
+         }
+         else {
+            B.append( j-1UL, j, 1 );
+            B.append( j    , j, 1 + blaze::real( j ) / n );
+         }
+         B.finalize( j );
+      }
+
+      if( !bf.factor( B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of a basis with tiny diagonal elements failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolves( bf, B, "Basis with tiny diagonal elements" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the forward and backward transformations of sparse right-hand sides.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves with sparse right-hand sides for a basis with small coupled diagonal
+// blocks and compares the results of the hypersparse solves against the dense solves. The
+// resulting indices have to contain every non-zero element of the solution and must not be
+// larger than the coupled blocks. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void BasisFactorizationTest::testHypersparse()
+{
+   test_ = "Hypersparse transformations";
+
+   const size_t n( 400UL );
+
+   // Setting up 4x4 diagonal blocks, coupling every odd block to its predecessor
+   MT B( n, n );
+   B.reserve( 5UL*n );
+   for( size_t j=0UL; j<n; ++j ) {
+      const size_t first( j - j % 4UL );
+      if( j % 8UL == 4UL )
+         B.append( first-1UL, j, 0.5 );
+      for( size_t i=first; i<first+4UL; ++i )
+         B.append( i, j, ( i == j )?( blaze::real( 6 ) ):( std::sin( blaze::real( i+2UL*j ) ) ) );
+      B.finalize( j );
+   }
+
+   blaze::BasisFactorization bf;
+   bf.factor( B );
+   checkSolves( bf, B, "Coupled blocks" );
+
+   for( size_t j=0UL; j<n; j+=7UL )
+   {
+      std::ostringstream label;
+      label << "Right-hand side with non-zero elements " << j << " and " << ( j*11UL ) % n;
+
+      VT x( n, 0 );
+      x[j] = 1;
+      x[( j*11UL ) % n] += 2;
+
+      std::vector<size_t> pattern;
+      pattern.push_back( j );
+      if( ( j*11UL ) % n != j )
+         pattern.push_back( ( j*11UL ) % n );
+
+      {
+         VT ref( x ), y( x );
+         std::vector<size_t> indices( pattern );
+         bf.ftran( ref );
+         bf.ftran( y, indices );
+         checkPattern( y, ref, indices, "Forward transformation, " + label.str() );
+      }
+
+      {
+         VT ref( x ), y( x );
+         std::vector<size_t> indices( pattern );
+         bf.btran( ref );
+         bf.btran( y, indices );
+         checkPattern( y, ref, indices, "Backward transformation, " + label.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the column exchanges in product form and the refactorization.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a long sequence of column exchanges with sparse columns, alternately
+// via the dense and the sparse update, and checks the forward and backward transformations
+// against the explicitly updated basis after each exchange. Finally, it refactorizes the
+// updated basis, which has to discard all eta matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void BasisFactorizationTest::testUpdate()
+{
+   test_ = "Column exchanges of the basis";
+
+   const size_t n( 60UL );
+   const size_t updates( 80UL );
+
+   DT D( tridiagonal( n ) );
+
+   blaze::BasisFactorization bf;
+   bf.factor( MT( D ) );
+
+   for( size_t k=0UL; k<updates; ++k )
+   {
+      std::ostringstream label;
+      label << "After " << k+1UL << " column exchange(s)";
+
+      // Setting up the new basis column and its representation with respect to the basis
+      VT a( n, 0 );
+      a[( k*7UL ) % n] = 1 + std::sin( blaze::real( k ) );
+      a[( k*13UL + 1UL ) % n] += 2 + std::cos( blaze::real( k ) );
+      a[( k*29UL + 5UL ) % n] += -1;
+
+      std::vector<size_t> indices;
+      for( size_t i=0UL; i<n; ++i ) {
+         if( a[i] != blaze::real(0) ) indices.push_back( i );
+      }
+
+      VT alpha( a );
+      if( k % 2UL == 0UL )
+         bf.ftran( alpha );
+      else
+         bf.ftran( alpha, indices );
+
+      // Replacing the basis column with the largest element of the representation
+      size_t r( 0UL );
+      for( size_t i=1UL; i<n; ++i ) {
+         if( std::fabs( alpha[i] ) > std::fabs( alpha[r] ) ) r = i;
+      }
+
+      if( k % 2UL == 0UL )
+         bf.update( r, alpha );
+      else
+         bf.update( r, alpha, indices );
+
+      for( size_t i=0UL; i<n; ++i )
+         D(i,r) = a[i];
+
+      checkUpdates( bf, k+1UL, label.str() );
+      checkSolves( bf, MT( D ), label.str() );
+   }
+
+   if( bf.etaNonZeros() < updates ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size of the eta file\n"
+          << " Details:\n"
+          << "   Non-zero elements of the eta file = " << bf.etaNonZeros() << "\n"
+          << "   Number of column exchanges = " << updates << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const MT B( D );
+
+   if( !bf.factor( B ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Refactorization of the updated basis failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkUpdates( bf, 0UL, "Refactorization" );
+   checkSolves( bf, B, "Refactorization" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the factorization of singular bases.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the factorization of a basis with a zero column, of a basis with
+// two identical columns and of a numerically singular basis fails. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void BasisFactorizationTest::testSingular()
+{
+   test_ = "Factorization of singular bases";
+
+   const size_t n( 20UL );
+
+   blaze::BasisFactorization bf;
+
+   for( size_t c=0UL; c<3UL; ++c )
+   {
+      DT D( tridiagonal( n ) );
+
+      const char* label( "" );
+
+      if( c == 0UL ) {
+         label = "Zero column";
+         for( size_t i=0UL; i<n; ++i )
+            D(i,7UL) = 0;
+      }
+      else if( c == 1UL ) {
+         label = "Identical columns";
+         for( size_t i=0UL; i<n; ++i )
+            D(i,12UL) = D(i,3UL);
+      }
+      else {
+         label = "Linearly dependent columns";
+         for( size_t i=0UL; i<n; ++i )
+            D(i,n-1UL) = D(i,0UL) + 2*D(i,5UL) - D(i,9UL);
+      }
+
+      if( bf.factor( MT( D ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular basis factorized\n"
+             << " Details:\n"
+             << "   Basis = " << label << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a non-symmetric, diagonally dominant tridiagonal basis.
+//
+// \param n The number of rows and columns of the basis.
+// \return The \f$ n \times n \f$ tridiagonal basis.
+*/
+BasisFactorizationTest::MT BasisFactorizationTest::tridiagonal( size_t n )
+{
+   MT B( n, n );
+   B.reserve( 3UL*n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( j > 0UL ) B.append( j-1UL, j, -0.5 );
+      B.append( j, j, 4 + blaze::real( j % 3UL ) );
+      if( j+1UL < n ) B.append( j+1UL, j, -1 );
+      B.finalize( j );
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the forward and backward transformations against the given basis.
+//
+// \param bf The factorization of the basis.
+// \param B The basis.
+// \param label The label of the basis.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves with all unit vectors and with a dense right-hand side and checks the
+// residuals \f$ B y - x \f$ and \f$ B^T y - x \f$.
+*/
+void BasisFactorizationTest::checkSolves( const blaze::BasisFactorization& bf, const MT& B,
+                                          const std::string& label ) const
+{
+   const size_t n( B.columns() );
+
+   blaze::real ftran( 0 ), btran( 0 );
+
+   for( size_t j=0UL; j<=n; ++j )
+   {
+      VT x( n, 0 );
+      if( j < n ) x[j] = 1;
+      else for( size_t i=0UL; i<n; ++i ) x[i] = 1 + std::sin( blaze::real( i ) );
+
+      VT y( x ), z( x );
+      bf.ftran( y );
+      bf.btran( z );
+
+      const VT r( B * y - x );
+      const VT s( trans( B ) * z - x );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         ftran = blaze::max( ftran, std::fabs( r[i] ) );
+         btran = blaze::max( btran, std::fabs( s[i] ) );
+      }
+   }
+
+   if( bf.size() != n || ftran > 1E-10 || btran > 1E-10 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid transformation\n"
+          << " Details:\n"
+          << "   Basis = " << label << "\n"
+          << "   Size of the basis = " << n << "\n"
+          << "   Size of the factorization = " << bf.size() << "\n"
+          << "   Residual of the forward transformation = " << ftran << "\n"
+          << "   Residual of the backward transformation = " << btran << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a hypersparse solve against the result of the dense solve.
+//
+// \param x The result of the hypersparse solve.
+// \param ref The result of the dense solve.
+// \param indices The indices of the result of the hypersparse solve.
+// \param label The label of the solve.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The indices have to be unique, must cover all non-zero elements of the result and must not
+// exceed the size of two coupled blocks.
+*/
+void BasisFactorizationTest::checkPattern( const VT& x, const VT& ref,
+                                           const std::vector<size_t>& indices,
+                                           const std::string& label ) const
+{
+   std::vector<size_t> sorted( indices );
+   std::sort( sorted.begin(), sorted.end() );
+
+   const bool unique( std::adjacent_find( sorted.begin(), sorted.end() ) == sorted.end() );
+
+   blaze::real error( 0 );
+   size_t missing( 0UL );
+
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      error = blaze::max( error, std::fabs( x[i] - ref[i] ) );
+      if( x[i] != blaze::real(0) && !std::binary_search( sorted.begin(), sorted.end(), i ) )
+         ++missing;
+   }
+
+   if( !unique || missing > 0UL || indices.size() > 16UL || error > 1E-12 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid hypersparse solve\n"
+          << " Details:\n"
+          << "   Solve = " << label << "\n"
+          << "   Number of indices = " << indices.size() << "\n"
+          << "   Unique indices = " << unique << "\n"
+          << "   Non-zero elements missing in the indices = " << missing << "\n"
+          << "   Deviation from the dense solve = " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of column exchanges since the last factorization.
+//
+// \param bf The factorization of the basis.
+// \param updates The expected number of column exchanges.
+// \param label The label of the basis.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void BasisFactorizationTest::checkUpdates( const blaze::BasisFactorization& bf, size_t updates,
+                                           const std::string& label ) const
+{
+   if( bf.getNumUpdates() != updates || ( updates == 0UL ) != ( bf.etaNonZeros() == 0UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of column exchanges\n"
+          << " Details:\n"
+          << "   Basis = " << label << "\n"
+          << "   Number of column exchanges = " << bf.getNumUpdates() << "\n"
+          << "   Expected number of column exchanges = " << updates << "\n"
+          << "   Non-zero elements of the eta file = " << bf.etaNonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running basis factorization test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_BASISFACTORIZATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during basis factorization test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
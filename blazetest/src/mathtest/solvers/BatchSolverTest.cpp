@@ -0,0 +1,785 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/BatchSolverTest.cpp
+//  \brief Source file for the batch solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blazetest/mathtest/solvers/BatchSolverTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the batch solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+BatchSolverTest::BatchSolverTest()
+{
+   testLCPs();
+   testContactLCPs();
+   testLSEs();
+   testConvergence();
+   testSerialSection();
+   testSettings();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batch solver for LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a batch of LCPs of different sizes with one to four threads by means
+// of the PGS solver and compares the solutions and the numbers of iterations against the
+// reference solutions and against the solution of each LCP by a single solver. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BatchSolverTest::testLCPs()
+{
+   test_ = "Batch of LCPs";
+
+   const size_t P( 40UL );
+
+   blaze::PGS pgs;
+   pgs.setSweepMode( blaze::PGS::gaussSeidel );
+   pgs.setThreshold( 1E-13 );
+   pgs.setMaxIterations( 100000UL );
+
+   std::vector<blaze::LCP> problems;
+   std::vector<VT> refs( P );
+   std::vector<size_t> iterations( P );
+
+   for( size_t p=0UL; p<P; ++p ) {
+      problems.push_back( lcp( size( p ), refs[p] ) );
+      blaze::LCP tmp( problems.back() );
+      pgs.solve( tmp );
+      iterations[p] = pgs.getLastIterations();
+   }
+
+   blaze::BatchSolver<blaze::PGS> batch( pgs );
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      std::vector<blaze::LCP> lcps( problems );
+      std::vector<bool> converged;
+
+      const size_t solved( batch.solve( lcps, converged ) );
+
+      checkBatch( solved, converged, P, label.str() );
+      checkWorkers( batch.getNumWorkers(), blaze::getNumThreads(), label.str() );
+
+      for( size_t p=0UL; p<P; ++p )
+      {
+         checkSolution( lcps[p].x_, refs[p], p, label.str() );
+
+         if( batch.getIterations().size() != P || batch.getIterations()[p] != iterations[p] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of iterations\n"
+                << " Details:\n"
+                << "   Batch = " << label.str() << "\n"
+                << "   Problem = " << p << "\n"
+                << "   Number of recorded problems = " << batch.getIterations().size() << "\n"
+                << "   Iterations of a single solver = " << iterations[p] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch solver for contact LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a batch of contact LCPs of different sizes (as for instance given by the
+// independent islands of a simulation) with one and four threads by means of the PGS solver
+// with block updates. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void BatchSolverTest::testContactLCPs()
+{
+   test_ = "Batch of contact LCPs";
+
+   const size_t P( 16UL );
+
+   blaze::PGS pgs;
+   pgs.setBlockUpdate( true );
+   pgs.setThreshold( 1E-13 );
+   pgs.setMaxIterations( 100000UL );
+
+   std::vector<blaze::ContactLCP> problems;
+   std::vector<VT> refs( P );
+
+   for( size_t p=0UL; p<P; ++p ) {
+      problems.push_back( contacts( 2UL + size( p ) / 3UL, refs[p] ) );
+   }
+
+   blaze::BatchSolver<blaze::PGS> batch( pgs );
+
+   for( size_t threads=1UL; threads<=4UL; threads+=3UL )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      std::vector<blaze::ContactLCP> islands( problems );
+      std::vector<bool> converged;
+
+      const size_t solved( batch.solve( islands, converged ) );
+
+      checkBatch( solved, converged, P, label.str() );
+      checkWorkers( batch.getNumWorkers(), blaze::getNumThreads(), label.str() );
+
+      for( size_t p=0UL; p<P; ++p ) {
+         checkSolution( islands[p].x_, refs[p], p, label.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch solver for linear systems of equations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a batch of symmetric positive definite linear systems of different sizes
+// with one to four threads by means of the CG solver and checks the residuals and solutions.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BatchSolverTest::testLSEs()
+{
+   test_ = "Batch of LSEs";
+
+   const size_t P( 24UL );
+
+   blaze::CG cg;
+   cg.setThreshold( 1E-10 );
+   cg.setMaxIterations( 5000UL );
+
+   std::vector<blaze::LSE> problems( P );
+   std::vector<VT> refs( P );
+
+   for( size_t p=0UL; p<P; ++p ) {
+      const size_t n( size( p ) );
+      refs[p].resize( n );
+      for( size_t i=0UL; i<n; ++i )
+         refs[p][i] = 1 + std::sin( blaze::real( i+p ) );
+      problems[p].A_ = tridiagonal( n );
+      problems[p].b_ = -( problems[p].A_ * refs[p] );
+   }
+
+   blaze::BatchSolver<blaze::CG> batch( cg );
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      std::vector<blaze::LSE> lses( problems );
+      std::vector<bool> converged;
+
+      const size_t solved( batch.solve( lses, converged ) );
+
+      checkBatch( solved, converged, P, label.str() );
+      checkWorkers( batch.getNumWorkers(), blaze::getNumThreads(), label.str() );
+
+      for( size_t p=0UL; p<P; ++p )
+      {
+         checkSolution( lses[p].x_, refs[p], p, label.str() );
+
+         if( lses[p].residual() > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid residual\n"
+                << " Details:\n"
+                << "   Batch = " << label.str() << "\n"
+                << "   Problem = " << p << "\n"
+                << "   Residual = " << lses[p].residual() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the convergence flags of the batch solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a batch of LCPs with a limited number of iterations, where every other
+// LCP is initialized with its reference solution. It checks that exactly the initialized LCPs
+// are reported as converged and that the number of iterations of all other LCPs is given by
+// the iteration limit. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void BatchSolverTest::testConvergence()
+{
+   test_ = "Convergence flags of the batch solver";
+
+   const size_t P( 20UL );
+   const size_t limit( 5UL );
+
+   blaze::PGS pgs;
+   pgs.setSweepMode( blaze::PGS::gaussSeidel );
+   pgs.setThreshold( 1E-13 );
+   pgs.setMaxIterations( limit );
+
+   std::vector<blaze::LCP> problems;
+   std::vector<VT> refs( P );
+
+   for( size_t p=0UL; p<P; ++p ) {
+      problems.push_back( lcp( size( p ), refs[p] ) );
+      if( p % 2UL == 1UL ) problems.back().x_ = refs[p];
+   }
+
+   blaze::setNumThreads( 4UL );
+
+   blaze::BatchSolver<blaze::PGS> batch( pgs );
+   std::vector<bool> converged;
+
+   const size_t solved( batch.solve( problems, converged ) );
+
+   for( size_t p=0UL; p<P; ++p )
+   {
+      const bool initialized( p % 2UL == 1UL );
+
+      if( solved != P/2UL || converged.size() != P || converged[p] != initialized ||
+          batch.getIterations()[p] != ( initialized ? 0UL : limit ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid convergence\n"
+             << " Details:\n"
+             << "   Problem = " << p << "\n"
+             << "   Initialized with the reference solution = " << initialized << "\n"
+             << "   Number of solved problems = " << solved << " (expected " << P/2UL << ")\n"
+             << "   Number of convergence flags = " << converged.size() << "\n"
+             << "   Iterations = " << batch.getIterations()[p] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch solver within a serial section and for small batches.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all problems are solved by a single worker within a serial section
+// and for batches of a single problem and that empty batches are handled correctly. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BatchSolverTest::testSerialSection()
+{
+   test_ = "Batch solver within a serial section";
+
+   const size_t P( 12UL );
+
+   blaze::PGS pgs;
+   pgs.setThreshold( 1E-13 );
+   pgs.setMaxIterations( 100000UL );
+
+   std::vector<blaze::LCP> problems;
+   std::vector<VT> refs( P );
+
+   for( size_t p=0UL; p<P; ++p ) {
+      problems.push_back( lcp( size( p ), refs[p] ) );
+   }
+
+   blaze::setNumThreads( 4UL );
+
+   blaze::BatchSolver<blaze::PGS> batch( pgs );
+
+   {
+      std::vector<blaze::LCP> lcps( problems );
+      std::vector<bool> converged;
+      size_t solved( 0UL );
+
+      BLAZE_SERIAL_SECTION {
+         solved = batch.solve( lcps, converged );
+      }
+
+      checkBatch( solved, converged, P, "Serial section" );
+      checkWorkers( batch.getNumWorkers(), 1UL, "Serial section" );
+
+      for( size_t p=0UL; p<P; ++p ) {
+         checkSolution( lcps[p].x_, refs[p], p, "Serial section" );
+      }
+   }
+
+   {
+      std::vector<blaze::LCP> lcps( 1UL, problems[0] );
+      std::vector<bool> converged;
+
+      const size_t solved( batch.solve( lcps, converged ) );
+
+      checkBatch( solved, converged, 1UL, "Single problem" );
+      checkWorkers( batch.getNumWorkers(), 1UL, "Single problem" );
+      checkSolution( lcps[0].x_, refs[0], 0UL, "Single problem" );
+   }
+
+   {
+      std::vector<blaze::LCP> lcps;
+      std::vector<bool> converged( 3UL, true );
+
+      const size_t solved( batch.solve( lcps, converged ) );
+
+      checkBatch( solved, converged, 0UL, "Empty batch" );
+
+      if( !batch.getIterations().empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterations recorded for an empty batch\n"
+             << " Details:\n"
+             << "   Number of recorded problems = " << batch.getIterations().size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the prototype solver of the batch solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the initial state of a batch solver and that a new prototype solver
+// replaces the solvers of all workers that have been created for previous batches. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BatchSolverTest::testSettings()
+{
+   test_ = "Batch solver settings";
+
+   const size_t P( 8UL );
+   const size_t limit( 3UL );
+
+   blaze::BatchSolver<blaze::PGS> batch;
+
+   if( batch.getNumWorkers() != 0UL || !batch.getIterations().empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid initial state\n"
+          << " Details:\n"
+          << "   Number of workers = " << batch.getNumWorkers() << "\n"
+          << "   Number of recorded problems = " << batch.getIterations().size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::vector<blaze::LCP> problems;
+   std::vector<VT> refs( P );
+
+   for( size_t p=0UL; p<P; ++p ) {
+      problems.push_back( lcp( size( p ), refs[p] ) );
+   }
+
+   blaze::setNumThreads( 4UL );
+
+   blaze::PGS pgs;
+   pgs.setThreshold( 1E-13 );
+   pgs.setMaxIterations( 100000UL );
+   batch.setSolver( pgs );
+
+   {
+      std::vector<blaze::LCP> lcps( problems );
+      std::vector<bool> converged;
+
+      const size_t solved( batch.solve( lcps, converged ) );
+
+      checkBatch( solved, converged, P, "Initial prototype solver" );
+
+      for( size_t p=0UL; p<P; ++p ) {
+         checkSolution( lcps[p].x_, refs[p], p, "Initial prototype solver" );
+      }
+   }
+
+   pgs.setMaxIterations( limit );
+   batch.setSolver( pgs );
+
+   {
+      std::vector<blaze::LCP> lcps( problems );
+      std::vector<bool> converged;
+
+      const size_t solved( batch.solve( lcps, converged ) );
+
+      for( size_t p=0UL; p<P; ++p )
+      {
+         if( batch.getSolver().getMaxIterations() != limit || solved != 0UL ||
+             converged.size() != P || converged[p] || batch.getIterations()[p] != limit ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: New prototype solver not used\n"
+                << " Details:\n"
+                << "   Problem = " << p << "\n"
+                << "   Iteration limit of the prototype solver = " << batch.getSolver().getMaxIterations() << "\n"
+                << "   Number of solved problems = " << solved << "\n"
+                << "   Iterations = " << batch.getIterations()[p] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a symmetric positive definite tridiagonal matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The \f$ n \times n \f$ tridiagonal matrix.
+//
+// The diagonal element of row \a i is given by \f$ 4 + (i \bmod 3) \f$, all off-diagonal
+// elements are -1.
+*/
+BatchSolverTest::MT BatchSolverTest::tridiagonal( size_t n )
+{
+   MT A( n, n );
+   A.reserve( 3UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i > 0UL ) A.append( i, i-1UL, -1 );
+      A.append( i, i, 4 + blaze::real( i % 3UL ) );
+      if( i+1UL < n ) A.append( i, i+1UL, -1 );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an LCP with known solution.
+//
+// \param n The size of the LCP.
+// \param ref The reference solution of the LCP.
+// \return The LCP for a tridiagonal matrix with zero initial guess.
+//
+// Every third unknown of the reference solution is zero with a positive residual, all other
+// unknowns are positive with a zero residual.
+*/
+blaze::LCP BatchSolverTest::lcp( size_t n, VT& ref )
+{
+   VT w( n );
+   ref.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i % 3UL == 0UL ) {
+         ref[i] = 0;
+         w[i]   = 1 + 0.5 * std::cos( blaze::real( i+n ) );
+      }
+      else {
+         ref[i] = 1 + 0.5 * std::sin( blaze::real( i+n ) );
+         w[i]   = 0;
+      }
+   }
+
+   blaze::LCP cp;
+   cp.A_ = tridiagonal( n );
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a contact LCP with known solution.
+//
+// \param N The number of contacts.
+// \param ref The reference solution of the contact LCP.
+// \return The contact LCP with zero initial guess.
+//
+// The 3x3 diagonal blocks of the contacts are fully populated and neighboring contacts are
+// coupled. Every fourth contact of the reference solution is separating, all other contacts
+// are sticking.
+*/
+blaze::ContactLCP BatchSolverTest::contacts( size_t N, VT& ref )
+{
+   const size_t n( 3UL*N );
+   const blaze::real block[3][3] = { { 4.0, 0.5, 0.3 }, { 0.5, 3.0, 0.2 }, { 0.3, 0.2, 3.0 } };
+
+   blaze::ContactLCP cp;
+   cp.A_.resize( n, n );
+   cp.A_.reserve( 9UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t c( i / 3UL ), k( i % 3UL );
+      if( c > 0UL ) {
+         for( size_t l=0UL; l<3UL; ++l )
+            cp.A_.append( i, 3UL*(c-1UL)+l, -0.2 );
+      }
+      for( size_t l=0UL; l<3UL; ++l )
+         cp.A_.append( i, 3UL*c+l, block[k][l] );
+      if( c+1UL < N ) {
+         for( size_t l=0UL; l<3UL; ++l )
+            cp.A_.append( i, 3UL*(c+1UL)+l, -0.2 );
+      }
+      cp.A_.finalize( i );
+   }
+
+   VT w( n, 0 );
+   ref.resize( n );
+
+   for( size_t c=0UL; c<N; ++c ) {
+      const size_t j( 3UL*c );
+      if( c % 4UL == 3UL ) {
+         ref[j] = ref[j+1UL] = ref[j+2UL] = 0;
+         w[j] = 1 + 0.1 * blaze::real( c % 5UL );
+      }
+      else {
+         ref[j    ] = 1 + 0.3 * std::sin( blaze::real( c+N ) );
+         ref[j+1UL] = 0.1 * std::cos( blaze::real( c+N ) );
+         ref[j+2UL] = 0.05 * std::sin( blaze::real( 2UL*c ) );
+      }
+   }
+
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+   cp.cof_.resize( N );
+   cp.cof_ = 0.5;
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the problem with the given index.
+//
+// \param p The index of the problem.
+// \return The size of the problem.
+//
+// The sizes of consecutive problems vary between 4 and 64 in order to result in strongly
+// varying solution times.
+*/
+size_t BatchSolverTest::size( size_t p )
+{
+   return 4UL + ( p*37UL ) % 61UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a single problem against its reference solution.
+//
+// \param x The computed solution.
+// \param ref The reference solution.
+// \param p The index of the problem.
+// \param label The label of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void BatchSolverTest::checkSolution( const VT& x, const VT& ref, size_t p,
+                                     const std::string& label ) const
+{
+   blaze::real error( 0 );
+
+   if( x.size() == ref.size() ) {
+      for( size_t i=0UL; i<x.size(); ++i )
+         error = blaze::max( error, std::fabs( x[i] - ref[i] ) );
+   }
+
+   if( x.size() != ref.size() || error > 1E-8 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   Batch = " << label << "\n"
+          << "   Problem = " << p << "\n"
+          << "   Size of the problem = " << ref.size() << "\n"
+          << "   Size of the solution = " << x.size() << "\n"
+          << "   Error = " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the convergence flags of a batch.
+//
+// \param solved The number of solved problems returned by the batch solver.
+// \param converged The convergence flags of the problems.
+// \param P The number of problems of the batch.
+// \param label The label of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all problems of the batch are reported as converged.
+*/
+void BatchSolverTest::checkBatch( size_t solved, const std::vector<bool>& converged, size_t P,
+                                  const std::string& label ) const
+{
+   size_t flags( 0UL );
+   for( size_t p=0UL; p<converged.size(); ++p ) {
+      if( converged[p] ) ++flags;
+   }
+
+   if( solved != P || converged.size() != P || flags != P ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Not all problems solved\n"
+          << " Details:\n"
+          << "   Batch = " << label << "\n"
+          << "   Number of problems = " << P << "\n"
+          << "   Number of solved problems = " << solved << "\n"
+          << "   Number of convergence flags = " << converged.size() << "\n"
+          << "   Number of set convergence flags = " << flags << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of workers used for a batch.
+//
+// \param workers The number of workers of the batch.
+// \param expected The expected number of workers.
+// \param label The label of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void BatchSolverTest::checkWorkers( size_t workers, size_t expected, const std::string& label ) const
+{
+   if( workers != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of workers\n"
+          << " Details:\n"
+          << "   Batch = " << label << "\n"
+          << "   Number of workers = " << workers << "\n"
+          << "   Expected number of workers = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running batch solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_BATCHSOLVER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during batch solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,731 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/CGTest.cpp
+//  \brief Source file for the conjugate gradient solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/IC0Preconditioner.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
+#include <blaze/math/solvers/SSORPreconditioner.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/solvers/CGTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the conjugate gradient solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+CGTest::CGTest()
+{
+   testMatrixTypes();
+   testPreconditioners();
+   testLSE();
+   testParallel();
+   testStatistics();
+   testWarmStart();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CG solver for different types of system matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves the same system with a row-major and a column-major compressed matrix,
+// with a row-major and a column-major dense matrix and with a matrix-free linear operator. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void CGTest::testMatrixTypes()
+{
+   using blaze::columnMajor;
+   using blaze::rowMajor;
+
+   test_ = "CG with different system matrix types";
+
+   const size_t k( 12UL );
+   const MT A( laplacian( k, 0 ) );
+   const VT ref( reference( k*k ) );
+   const VT b( -( A * ref ) );
+
+   blaze::CG cg;
+   configure( cg );
+
+   {
+      VT x;
+      cg.solve( A, b, x );
+      checkSolution( A, b, x, ref, "Row-major compressed matrix" );
+   }
+
+   {
+      const blaze::CompressedMatrix<blaze::real,columnMajor> B( A );
+      VT x;
+      cg.solve( B, b, x );
+      checkSolution( B, b, x, ref, "Column-major compressed matrix" );
+   }
+
+   {
+      const blaze::DynamicMatrix<blaze::real,rowMajor> B( A );
+      VT x;
+      cg.solve( B, b, x );
+      checkSolution( B, b, x, ref, "Row-major dense matrix" );
+   }
+
+   {
+      const blaze::DynamicMatrix<blaze::real,columnMajor> B( A );
+      VT x;
+      cg.solve( B, b, x );
+      checkSolution( B, b, x, ref, "Column-major dense matrix" );
+   }
+
+   {
+      VT x;
+      cg.solve( Laplacian( k ), b, x );
+      checkSolution( A, b, x, ref, "Linear operator" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CG solver with preconditioning.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a system with a strongly varying diagonal without preconditioner and
+// with the Jacobi, SSOR and IC(0) preconditioners. It checks the solutions and that the IC(0)
+// and SSOR preconditioners reduce the number of iterations. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void CGTest::testPreconditioners()
+{
+   test_ = "Preconditioned CG";
+
+   const size_t k( 24UL );
+   const MT A( laplacian( k, 10 ) );
+   const VT ref( reference( k*k ) );
+   const VT b( -( A * ref ) );
+
+   blaze::CG cg;
+   configure( cg );
+
+   VT x;
+
+   cg.solve( A, b, x );
+   checkSolution( A, b, x, ref, "No preconditioner" );
+   const size_t plain( cg.getLastIterations() );
+
+   cg.solve( A, b, x, blaze::JacobiPreconditioner( A ) );
+   checkSolution( A, b, x, ref, "Jacobi preconditioner" );
+   const size_t jacobi( cg.getLastIterations() );
+
+   cg.solve( A, b, x, blaze::SSORPreconditioner( A ) );
+   checkSolution( A, b, x, ref, "SSOR preconditioner" );
+   const size_t ssor( cg.getLastIterations() );
+
+   cg.solve( A, b, x, blaze::SSORPreconditioner( A, 1.5 ) );
+   checkSolution( A, b, x, ref, "SSOR preconditioner (omega = 1.5)" );
+
+   cg.solve( A, b, x, blaze::IC0Preconditioner( A ) );
+   checkSolution( A, b, x, ref, "IC(0) preconditioner" );
+   const size_t ic0( cg.getLastIterations() );
+
+   if( jacobi > plain || ssor >= plain || ic0 >= plain ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Preconditioning does not reduce the number of iterations\n"
+          << " Details:\n"
+          << "   No preconditioner = " << plain << " iterations\n"
+          << "   Jacobi = " << jacobi << " iterations\n"
+          << "   SSOR = " << ssor << " iterations\n"
+          << "   IC(0) = " << ic0 << " iterations\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CG solver for a linear system of equations data structure.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves an LSE and checks its residual. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void CGTest::testLSE()
+{
+   test_ = "CG for an LSE";
+
+   const size_t k( 10UL );
+   const VT ref( reference( k*k ) );
+
+   blaze::LSE lse;
+   lse.A_ = laplacian( k, 1 );
+   lse.b_ = -( lse.A_ * ref );
+
+   blaze::CG cg;
+   configure( cg );
+
+   if( !cg.solve( lse ) || lse.residual() > 1E-8 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: LSE not solved\n"
+          << " Details:\n"
+          << "   Residual = " << lse.residual() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkSolution( lse.A_, lse.b_, lse.x_, ref, "LSE" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel execution of the CG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a system exceeding the SMP threshold for vector operations with one to
+// four threads, with and without IC(0) preconditioning. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void CGTest::testParallel()
+{
+   test_ = "Parallel CG";
+
+   size_t k( 8UL );
+   while( k*k < blaze::SMP_DVECDVECADD_THRESHOLD )
+      k *= 2UL;
+
+   const MT A( laplacian( k, 1 ) );
+   const VT ref( reference( k*k ) );
+   const VT b( -( A * ref ) );
+   const blaze::IC0Preconditioner ic0( A );
+
+   blaze::CG cg;
+   configure( cg );
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      VT x;
+      cg.solve( A, b, x );
+      checkSolution( A, b, x, ref, label.str() );
+
+      cg.solve( A, b, x, ic0 );
+      checkSolution( A, b, x, ref, label.str() + ", IC(0) preconditioner" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the convergence statistics of the CG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that no statistics are recorded by default and that the recorded residual
+// history and timings of enabled statistics match the performed iterations, with and without
+// preconditioning. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void CGTest::testStatistics()
+{
+   test_ = "CG statistics";
+
+   const size_t k( 16UL );
+   const MT A( laplacian( k, 1 ) );
+   const VT ref( reference( k*k ) );
+   const VT b( -( A * ref ) );
+
+   blaze::CG cg;
+   configure( cg );
+
+   VT x;
+
+   cg.solve( A, b, x );
+   checkSolution( A, b, x, ref, "Disabled statistics" );
+
+   if( cg.getStatistics() || !cg.getResidualHistory().empty() || !cg.getIterationTimes().empty() ||
+       cg.getSetupTime() != 0.0 || cg.getResidualTime() != 0.0 || cg.getUpdateTime() != 0.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Statistics recorded by default\n"
+          << " Details:\n"
+          << "   Size of the residual history = " << cg.getResidualHistory().size() << "\n"
+          << "   Number of iteration times = " << cg.getIterationTimes().size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   cg.setStatistics( true );
+
+   cg.solve( A, b, x );
+   checkSolution( A, b, x, ref, "No preconditioner" );
+   checkStatistics( cg, "No preconditioner" );
+
+   cg.solve( A, b, x, blaze::IC0Preconditioner( A ) );
+   checkSolution( A, b, x, ref, "IC(0) preconditioner" );
+   checkStatistics( cg, "IC(0) preconditioner" );
+
+   cg.setStatistics( false );
+
+   cg.solve( A, b, x );
+
+   if( !cg.getResidualHistory().empty() || !cg.getIterationTimes().empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Statistics recorded after disabling the statistics\n"
+          << " Details:\n"
+          << "   Size of the residual history = " << cg.getResidualHistory().size() << "\n"
+          << "   Number of iteration times = " << cg.getIterationTimes().size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the warm start of the CG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the given vector of unknowns is ignored unless warm starts are
+// enabled, that a warm start from the reference solution does not require any iteration, that
+// a warm start from a nearby solution requires fewer iterations than a cold start and that a
+// vector of invalid size results in a cold start. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void CGTest::testWarmStart()
+{
+   test_ = "CG warm start";
+
+   const size_t k( 16UL );
+   const size_t n( k*k );
+   const MT A( laplacian( k, 1 ) );
+   const VT ref( reference( n ) );
+   const VT b( -( A * ref ) );
+   const blaze::IC0Preconditioner ic0( A );
+
+   VT nearby( ref );
+   for( size_t i=0UL; i<n; ++i )
+      nearby[i] += 1E-6 * std::cos( blaze::real( i ) );
+
+   blaze::CG cg;
+   configure( cg );
+
+   VT x;
+
+   cg.solve( A, b, x );
+   checkSolution( A, b, x, ref, "Cold start" );
+   const size_t cold( cg.getLastIterations() );
+
+   x = ref;
+   cg.solve( A, b, x );
+   checkSolution( A, b, x, ref, "Disabled warm start" );
+
+   if( cg.getWarmStart() || cg.getLastIterations() != cold ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Initial solution used without warm start\n"
+          << " Details:\n"
+          << "   Iterations of the cold start = " << cold << "\n"
+          << "   Iterations with the reference solution = " << cg.getLastIterations() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   cg.setWarmStart( true );
+
+   x = ref;
+   cg.solve( A, b, x );
+   checkSolution( A, b, x, ref, "Warm start from the reference solution" );
+
+   if( cg.getLastIterations() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Iterations performed for the reference solution\n"
+          << " Details:\n"
+          << "   Iterations = " << cg.getLastIterations() << "\n"
+          << "   Precision = " << cg.getLastPrecision() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   x = nearby;
+   cg.solve( A, b, x );
+   checkSolution( A, b, x, ref, "Warm start from a nearby solution" );
+   const size_t warm( cg.getLastIterations() );
+
+   x = nearby;
+   cg.solve( A, b, x, ic0 );
+   checkSolution( A, b, x, ref, "Warm start from a nearby solution, IC(0) preconditioner" );
+
+   x.resize( n-1UL );
+   cg.solve( A, b, x );
+   checkSolution( A, b, x, ref, "Warm start with an invalid initial solution" );
+
+   if( warm >= cold || cg.getLastIterations() != cold ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of iterations\n"
+          << " Details:\n"
+          << "   Iterations of the cold start = " << cold << "\n"
+          << "   Iterations of the warm start from a nearby solution = " << warm << "\n"
+          << "   Iterations of the warm start with an invalid initial solution = " << cg.getLastIterations() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the CG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that non-square and (with enabled symmetry check) non-symmetric system
+// matrices as well as right-hand side vectors of invalid size are rejected. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void CGTest::testErrors()
+{
+   test_ = "CG error handling";
+
+   blaze::CG cg;
+   configure( cg );
+
+   VT x;
+
+   try {
+      cg.solve( MT( 3UL, 4UL ), VT( 3UL, 1 ), x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-square system matrix accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      cg.solve( laplacian( 3UL, 0 ), VT( 8UL, 1 ), x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Right-hand side vector of invalid size accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   MT A( laplacian( 3UL, 0 ) );
+   A(0,1) = -2;
+
+   if( cg.getSymmetryCheck() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Symmetry check enabled by default\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   cg.setSymmetryCheck( true );
+
+   try {
+      cg.solve( A, VT( 9UL, 1 ), x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-symmetric system matrix accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the five-point Laplacian for the given vector.
+//
+// \param x The vector of grid values.
+// \param y The result vector.
+// \return void
+*/
+void CGTest::Laplacian::apply( const VT& x, VT& y ) const
+{
+   y.resize( k_*k_, false );
+
+   for( size_t i=0UL; i<k_; ++i ) {
+      for( size_t j=0UL; j<k_; ++j ) {
+         const size_t row( i*k_+j );
+         blaze::real tmp( 4 * x[row] );
+         if( i > 0UL    ) tmp -= x[row-k_];
+         if( i+1UL < k_ ) tmp -= x[row+k_];
+         if( j > 0UL    ) tmp -= x[row-1UL];
+         if( j+1UL < k_ ) tmp -= x[row+1UL];
+         y[row] = tmp;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the five-point Laplacian on a square grid with a varying diagonal shift.
+//
+// \param k The number of grid points per dimension.
+// \param shift The scaling factor of the diagonal shift.
+// \return The symmetric positive definite system matrix of size \f$ k^2 \times k^2 \f$.
+//
+// The diagonal element of row \a i is given by \f$ 4 + shift \cdot (i \bmod 5) \f$.
+*/
+CGTest::MT CGTest::laplacian( size_t k, blaze::real shift )
+{
+   const size_t n( k*k );
+   MT A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=0UL; j<k; ++j ) {
+         const size_t row( i*k+j );
+         if( i > 0UL )   A.append( row, row-k, -1 );
+         if( j > 0UL )   A.append( row, row-1UL, -1 );
+         A.append( row, row, 4 + shift * blaze::real( row % 5UL ) );
+         if( j+1UL < k ) A.append( row, row+1UL, -1 );
+         if( i+1UL < k ) A.append( row, row+k, -1 );
+         A.finalize( row );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the reference solution of the given size.
+//
+// \param n The size of the reference solution.
+// \return The reference solution.
+*/
+CGTest::VT CGTest::reference( size_t n )
+{
+   VT x( n );
+   for( size_t i=0UL; i<n; ++i )
+      x[i] = 1 + std::sin( blaze::real( i ) );
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configures the given CG solver for the tests.
+//
+// \param cg The solver to be configured.
+// \return void
+*/
+void CGTest::configure( blaze::CG& cg )
+{
+   cg.setThreshold( 1E-10 );
+   cg.setMaxIterations( 5000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the computed solution against the residual and the reference solution.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The computed solution.
+// \param ref The reference solution.
+// \param label The label of the solved system.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MatrixType >  // Type of the system matrix
+void CGTest::checkSolution( const MatrixType& A, const VT& b, const VT& x, const VT& ref,
+                            const std::string& label ) const
+{
+   blaze::real residual( 0 ), error( 0 );
+
+   if( x.size() == ref.size() ) {
+      const VT r( A * x + b );
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         residual = blaze::max( residual, std::fabs( r[i] ) );
+         error    = blaze::max( error, std::fabs( x[i] - ref[i] ) );
+      }
+   }
+
+   if( x.size() != ref.size() || residual > 1E-8 || error > 1E-6 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   System = " << label << "\n"
+          << "   Size of the system = " << ref.size() << "\n"
+          << "   Size of the solution = " << x.size() << "\n"
+          << "   Residual = " << residual << "\n"
+          << "   Error = " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the recorded statistics of the last solution process.
+//
+// \param cg The solver to be checked.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void CGTest::checkStatistics( const blaze::CG& cg, const std::string& label ) const
+{
+   const std::vector<blaze::real>& residuals( cg.getResidualHistory() );
+   const std::vector<double>& times( cg.getIterationTimes() );
+   const size_t iterations( cg.getLastIterations() );
+
+   double total( 0.0 );
+   bool negative( cg.getSetupTime() < 0.0 || cg.getResidualTime() < 0.0 || cg.getUpdateTime() < 0.0 );
+
+   for( size_t i=0UL; i<times.size(); ++i ) {
+      total += times[i];
+      if( times[i] < 0.0 ) negative = true;
+   }
+
+   if( iterations == 0UL || residuals.size() != iterations || times.size() != iterations ||
+       residuals.back() != cg.getLastPrecision() || residuals.back() >= cg.getThreshold() ||
+       negative || cg.getResidualTime() + cg.getUpdateTime() > 1.000001*total + 1E-9 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid statistics\n"
+          << " Details:\n"
+          << "   Solution process = " << label << "\n"
+          << "   Iterations = " << iterations << "\n"
+          << "   Size of the residual history = " << residuals.size() << "\n"
+          << "   Number of iteration times = " << times.size() << "\n"
+          << "   Final residual = " << ( residuals.empty() ? blaze::real(0) : residuals.back() ) << "\n"
+          << "   Precision = " << cg.getLastPrecision() << "\n"
+          << "   Total iteration time = " << total << "\n"
+          << "   Setup time = " << cg.getSetupTime() << "\n"
+          << "   Residual time = " << cg.getResidualTime() << "\n"
+          << "   Update time = " << cg.getUpdateTime() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CG solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_CG_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CG solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,618 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/CPGTest.cpp
+//  \brief Source file for the conjugate projected gradient solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Functions.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/solvers/CPGTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the conjugate projected gradient solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+CPGTest::CPGTest()
+{
+   testLCP();
+   testBoxLCP();
+   testContactLCP();
+   testParallel();
+   testConvergence();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CPG solver for LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves an LCP whose solution has both positive unknowns and unknowns at the
+// lower bound. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void CPGTest::testLCP()
+{
+   test_ = "CPG for LCPs";
+
+   VT ref;
+   blaze::LCP cp( lcp( 20UL, ref ) );
+
+   blaze::CPG cpg;
+   configure( cpg );
+
+   const bool converged( cpg.solve( cp ) );
+   checkSolution( cpg, converged, cp, ref, "LCP" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CPG solver for box LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a box LCP whose solution has unknowns at the lower bound, at the upper
+// bound and in between. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void CPGTest::testBoxLCP()
+{
+   test_ = "CPG for box LCPs";
+
+   VT ref;
+   blaze::BoxLCP cp( boxLCP( 20UL, ref ) );
+
+   blaze::CPG cpg;
+   configure( cpg );
+
+   const bool converged( cpg.solve( cp ) );
+   checkSolution( cpg, converged, cp, ref, "Box LCP" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CPG solver for contact LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a contact LCP with sticking and separating contacts, i.e. with friction
+// bounds depending on the normal unknowns. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void CPGTest::testContactLCP()
+{
+   test_ = "CPG for contact LCPs";
+
+   VT ref;
+   blaze::ContactLCP cp( contacts( 200UL, ref ) );
+
+   blaze::CPG cpg;
+   configure( cpg );
+
+   const bool converged( cpg.solve( cp ) );
+   checkSolution( cpg, converged, cp, ref, "Contact LCP" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel execution of the CPG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves an LCP and a contact LCP exceeding the SMP threshold for vector
+// operations with one to four threads. In case deterministic reductions are enabled, the
+// solutions have to be identical for all numbers of threads. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void CPGTest::testParallel()
+{
+   test_ = "Parallel CPG";
+
+   size_t k( 8UL );
+   while( k*k < blaze::SMP_DVECDVECADD_THRESHOLD )
+      k *= 2UL;
+
+   const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD / 3UL + 100UL );
+
+   VT lcpRef, contactRef;
+   const blaze::LCP        lcpProblem    ( lcp( k, lcpRef ) );
+   const blaze::ContactLCP contactProblem( contacts( N, contactRef ) );
+
+   VT lcpSerial, contactSerial;
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      blaze::CPG cpg;
+      configure( cpg );
+
+      {
+         blaze::LCP cp( lcpProblem );
+         const bool converged( cpg.solve( cp ) );
+         checkSolution( cpg, converged, cp, lcpRef, "LCP, " + label.str() );
+
+         if( threads == 1UL )
+            lcpSerial = cp.x_;
+         else if( blaze::SMP_DETERMINISTIC_REDUCTION && cp.x_ != lcpSerial ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solution depends on the number of threads\n"
+                << " Details:\n"
+                << "   Problem = LCP, " << label.str() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::ContactLCP cp( contactProblem );
+         const bool converged( cpg.solve( cp ) );
+         checkSolution( cpg, converged, cp, contactRef, "Contact LCP, " + label.str() );
+
+         if( threads == 1UL )
+            contactSerial = cp.x_;
+         else if( blaze::SMP_DETERMINISTIC_REDUCTION && cp.x_ != contactSerial ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solution depends on the number of threads\n"
+                << " Details:\n"
+                << "   Problem = Contact LCP, " << label.str() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the convergence control of the CPG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the solver stops at the iteration limit, that a warm start from the
+// reference solution does not require any iteration and that the recorded statistics match the
+// performed iterations. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void CPGTest::testConvergence()
+{
+   test_ = "CPG convergence control";
+
+   VT ref;
+   const blaze::BoxLCP problem( boxLCP( 16UL, ref ) );
+
+   blaze::CPG cpg;
+   configure( cpg );
+
+   {
+      blaze::BoxLCP cp( problem );
+      cpg.setMaxIterations( 3UL );
+
+      if( cpg.solve( cp ) || cpg.getLastIterations() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iteration limit not respected\n"
+             << " Details:\n"
+             << "   Iterations = " << cpg.getLastIterations() << "\n"
+             << "   Precision = " << cpg.getLastPrecision() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      configure( cpg );
+   }
+
+   {
+      blaze::BoxLCP cp( problem );
+      cp.x_ = ref;
+
+      const bool converged( cpg.solve( cp ) );
+      checkSolution( cpg, converged, cp, ref, "Warm start from the reference solution" );
+
+      if( cpg.getLastIterations() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterations performed for the reference solution\n"
+             << " Details:\n"
+             << "   Iterations = " << cpg.getLastIterations() << "\n"
+             << "   Precision = " << cpg.getLastPrecision() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::BoxLCP cp( problem );
+      cpg.setStatistics( true );
+
+      const bool converged( cpg.solve( cp ) );
+      checkSolution( cpg, converged, cp, ref, "Enabled statistics" );
+
+      const size_t iterations( cpg.getLastIterations() );
+
+      if( iterations == 0UL || cpg.getResidualHistory().size() != iterations ||
+          cpg.getIterationTimes().size() != iterations ||
+          cpg.getResidualHistory().back() != cpg.getLastPrecision() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid statistics\n"
+             << " Details:\n"
+             << "   Iterations = " << iterations << "\n"
+             << "   Size of the residual history = " << cpg.getResidualHistory().size() << "\n"
+             << "   Number of iteration times = " << cpg.getIterationTimes().size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the five-point Laplacian on a square grid with a diagonal shift.
+//
+// \param k The number of grid points per dimension.
+// \return The symmetric positive definite system matrix of size \f$ k^2 \times k^2 \f$.
+*/
+CPGTest::MT CPGTest::laplacian( size_t k )
+{
+   const size_t n( k*k );
+   MT A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=0UL; j<k; ++j ) {
+         const size_t row( i*k+j );
+         if( i > 0UL )   A.append( row, row-k, -1 );
+         if( j > 0UL )   A.append( row, row-1UL, -1 );
+         A.append( row, row, 8 );
+         if( j+1UL < k ) A.append( row, row+1UL, -1 );
+         if( i+1UL < k ) A.append( row, row+k, -1 );
+         A.finalize( row );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an LCP with known solution.
+//
+// \param k The number of grid points per dimension.
+// \param ref The reference solution of the LCP.
+// \return The LCP with zero initial guess.
+//
+// Every third unknown of the reference solution is zero with a positive residual, all other
+// unknowns are positive with a zero residual.
+*/
+blaze::LCP CPGTest::lcp( size_t k, VT& ref )
+{
+   const size_t n( k*k );
+
+   VT w( n );
+   ref.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i % 3UL == 0UL ) {
+         ref[i] = 0;
+         w[i]   = 1 + 0.5 * std::cos( blaze::real( i ) );
+      }
+      else {
+         ref[i] = 1 + 0.5 * std::sin( blaze::real( i ) );
+         w[i]   = 0;
+      }
+   }
+
+   blaze::LCP cp;
+   cp.A_ = laplacian( k );
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a box LCP with known solution.
+//
+// \param k The number of grid points per dimension.
+// \param ref The reference solution of the box LCP.
+// \return The box LCP with bounds -1 and 1.5 and zero initial guess.
+//
+// Every fourth unknown of the reference solution is at the lower bound with a positive residual,
+// every fourth unknown is at the upper bound with a negative residual, all others are strictly
+// inside the bounds with a zero residual.
+*/
+blaze::BoxLCP CPGTest::boxLCP( size_t k, VT& ref )
+{
+   const size_t n( k*k );
+
+   VT w( n );
+   ref.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      switch( i % 4UL ) {
+         case 0UL: ref[i] = -1;   w[i] =  1 + 0.5 * std::cos( blaze::real( i ) ); break;
+         case 1UL: ref[i] = 1.5;  w[i] = -1 + 0.5 * std::cos( blaze::real( i ) ); break;
+         default:  ref[i] = std::sin( blaze::real( i ) ); w[i] = 0; break;
+      }
+   }
+
+   blaze::BoxLCP cp;
+   cp.A_ = laplacian( k );
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+   cp.xmin_.resize( n );
+   cp.xmax_.resize( n );
+   cp.xmin_ = -1;
+   cp.xmax_ = 1.5;
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a contact LCP with known solution.
+//
+// \param N The number of contacts.
+// \param ref The reference solution of the contact LCP.
+// \return The contact LCP with zero initial guess.
+//
+// The symmetric 3x3 diagonal blocks of the contacts are fully populated and neighboring contacts
+// are coupled symmetrically. Every fourth contact of the reference solution is separating (zero
+// unknowns with a positive normal residual), all other contacts are sticking (zero residual and
+// tangential unknowns strictly inside the friction bounds).
+*/
+blaze::ContactLCP CPGTest::contacts( size_t N, VT& ref )
+{
+   const size_t n( 3UL*N );
+   const blaze::real block[3][3] = { { 4.0, 0.5, 0.3 }, { 0.5, 3.0, 0.2 }, { 0.3, 0.2, 3.0 } };
+
+   blaze::ContactLCP cp;
+   cp.A_.resize( n, n );
+   cp.A_.reserve( 9UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t c( i / 3UL ), k( i % 3UL );
+      if( c > 0UL ) {
+         for( size_t l=0UL; l<3UL; ++l )
+            cp.A_.append( i, 3UL*(c-1UL)+l, -0.2 );
+      }
+      for( size_t l=0UL; l<3UL; ++l )
+         cp.A_.append( i, 3UL*c+l, block[k][l] );
+      if( c+1UL < N ) {
+         for( size_t l=0UL; l<3UL; ++l )
+            cp.A_.append( i, 3UL*(c+1UL)+l, -0.2 );
+      }
+      cp.A_.finalize( i );
+   }
+
+   VT w( n, 0 );
+   ref.resize( n );
+
+   for( size_t c=0UL; c<N; ++c ) {
+      const size_t j( 3UL*c );
+      if( c % 4UL == 3UL ) {
+         ref[j] = ref[j+1UL] = ref[j+2UL] = 0;
+         w[j] = 1 + 0.1 * blaze::real( c % 5UL );
+      }
+      else {
+         ref[j    ] = 1 + 0.3 * std::sin( blaze::real( c ) );
+         ref[j+1UL] = 0.1 * std::cos( blaze::real( c ) );
+         ref[j+2UL] = 0.05 * std::sin( blaze::real( 2UL*c ) );
+      }
+   }
+
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+   cp.cof_.resize( N );
+   cp.cof_ = 0.5;
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configures the given CPG solver for the tests.
+//
+// \param cpg The solver to be configured.
+// \return void
+*/
+void CPGTest::configure( blaze::CPG& cpg )
+{
+   cpg.setThreshold( 1E-12 );
+   cpg.setMaxIterations( 10000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the exact residual of the given complementarity problem.
+//
+// \param cp The complementarity problem.
+// \return The maximum norm of the projected residual.
+//
+// In contrast to the \c residual() functions of the problem classes, this function computes
+// the product of the system matrix and the unknowns only once.
+*/
+template< typename CP >  // Type of the complementarity problem
+blaze::real CPGTest::residual( const CP& cp )
+{
+   const VT w( cp.A_ * cp.x_ + cp.b_ );
+
+   blaze::real rmax( 0 );
+
+   for( size_t i=0UL; i<cp.size(); ++i ) {
+      rmax = blaze::max( rmax, std::fabs( blaze::max( cp.x_[i] - cp.ubound( i ),
+                                          blaze::min( cp.x_[i] - cp.lbound( i ), w[i] ) ) ) );
+   }
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the computed solution against its exact residual and the reference solution.
+//
+// \param cpg The solver used for the solution.
+// \param converged The result of the solution process.
+// \param cp The solved complementarity problem.
+// \param ref The reference solution.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// Since the solver only accepts the convergence based on a recomputed residual, the exact
+// residual of the solution has to be below the threshold of the solver (up to rounding).
+*/
+template< typename CP >  // Type of the complementarity problem
+void CPGTest::checkSolution( const blaze::CPG& cpg, bool converged, const CP& cp, const VT& ref,
+                             const std::string& label ) const
+{
+   blaze::real error( 0 ), exact( 0 );
+
+   if( cp.x_.size() == ref.size() ) {
+      exact = residual( cp );
+      for( size_t i=0UL; i<ref.size(); ++i )
+         error = blaze::max( error, std::fabs( cp.x_[i] - ref[i] ) );
+   }
+
+   if( !converged || cp.x_.size() != ref.size() || cpg.getLastPrecision() >= cpg.getThreshold() ||
+       exact > 1.01 * cpg.getThreshold() || error > 1E-9 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   Solution process = " << label << "\n"
+          << "   Converged = " << converged << "\n"
+          << "   Iterations = " << cpg.getLastIterations() << "\n"
+          << "   Size of the problem = " << ref.size() << "\n"
+          << "   Size of the solution = " << cp.x_.size() << "\n"
+          << "   Precision = " << cpg.getLastPrecision() << "\n"
+          << "   Exact residual = " << exact << "\n"
+          << "   Error = " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CPG solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_CPG_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CPG solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,530 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/LemkeTest.cpp
+//  \brief Source file for the Lemke solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Functions.h>
+#include <blazetest/mathtest/solvers/LemkeTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Lemke solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+LemkeTest::LemkeTest()
+{
+   testSettings();
+   testLCP();
+   testManyPivots();
+   testDegenerate();
+   testTrivial();
+   testInfeasible();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the settings of the Lemke solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the default representation and refactorization threshold and that
+// non-positive refactorization thresholds are rejected. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void LemkeTest::testSettings()
+{
+   test_ = "Lemke settings";
+
+   blaze::Lemke lemke;
+
+   if( lemke.getRepresentation() != blaze::Lemke::revised || lemke.getRefactorizationThreshold() != 4 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid default settings\n"
+          << " Details:\n"
+          << "   Representation = " << name( lemke.getRepresentation() ) << "\n"
+          << "   Refactorization threshold = " << lemke.getRefactorizationThreshold() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   lemke.setRepresentation( blaze::Lemke::dense );
+   lemke.setRefactorizationThreshold( 0.5 );
+
+   if( lemke.getRepresentation() != blaze::Lemke::dense || lemke.getRefactorizationThreshold() != 0.5 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting the representation or the refactorization threshold failed\n"
+          << " Details:\n"
+          << "   Representation = " << name( lemke.getRepresentation() ) << "\n"
+          << "   Refactorization threshold = " << lemke.getRefactorizationThreshold() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::real invalid[] = { 0, -1 };
+
+   for( size_t i=0UL; i<2UL; ++i )
+   {
+      try {
+         lemke.setRefactorizationThreshold( invalid[i] );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid refactorization threshold accepted\n"
+             << " Details:\n"
+             << "   Refactorization threshold = " << invalid[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Lemke solver for a small LCP.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a small LCP in the dense and in the revised representation. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LemkeTest::testLCP()
+{
+   test_ = "Lemke for a small LCP";
+
+   const blaze::Lemke::Representation representations[] = { blaze::Lemke::dense, blaze::Lemke::revised };
+
+   for( size_t r=0UL; r<2UL; ++r )
+   {
+      VT ref;
+      blaze::LCP cp( lcp( 30UL, false, ref ) );
+
+      blaze::Lemke lemke;
+      configure( lemke, representations[r] );
+
+      lemke.solve( cp );
+      checkSolution( lemke, cp, ref, name( representations[r] ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Lemke solver for a large LCP requiring many pivot steps.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves an LCP with 300 unknowns, 200 of which are positive in the solution and
+// therefore require at least 200 pivot steps. The LCP is solved in the dense representation and
+// in the revised representation with a refactorization after almost every pivot step, with the
+// default refactorization threshold and without any refactorization. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void LemkeTest::testManyPivots()
+{
+   test_ = "Lemke with many pivot steps";
+
+   const blaze::real thresholds[] = { 0.01, 4, 1E6 };
+
+   VT ref;
+   const blaze::LCP problem( lcp( 300UL, false, ref ) );
+
+   {
+      blaze::LCP cp( problem );
+
+      blaze::Lemke lemke;
+      configure( lemke, blaze::Lemke::dense );
+
+      lemke.solve( cp );
+      checkSolution( lemke, cp, ref, name( blaze::Lemke::dense ) );
+   }
+
+   for( size_t t=0UL; t<3UL; ++t )
+   {
+      std::ostringstream label;
+      label << name( blaze::Lemke::revised ) << " (refactorization threshold " << thresholds[t] << ")";
+
+      blaze::LCP cp( problem );
+
+      blaze::Lemke lemke;
+      configure( lemke, blaze::Lemke::revised );
+      lemke.setRefactorizationThreshold( thresholds[t] );
+
+      lemke.solve( cp );
+      checkSolution( lemke, cp, ref, label.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Lemke solver for degenerate LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves an LCP whose reference solution has unknowns with both a zero value and
+// a zero residual and an LCP with a constant right-hand side, which results in ties in the
+// ratio tests that have to be resolved lexicographically. The latter is solved in the dense
+// representation first, the solution of the revised representation has to match. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LemkeTest::testDegenerate()
+{
+   test_ = "Lemke for degenerate LCPs";
+
+   const blaze::Lemke::Representation representations[] = { blaze::Lemke::dense, blaze::Lemke::revised };
+
+   for( size_t r=0UL; r<2UL; ++r )
+   {
+      VT ref;
+      blaze::LCP cp( lcp( 100UL, true, ref ) );
+
+      blaze::Lemke lemke;
+      configure( lemke, representations[r] );
+
+      lemke.solve( cp );
+      checkSolution( lemke, cp, ref, std::string( name( representations[r] ) ) + ", degenerate solution" );
+   }
+
+   VT dense;
+   VT unused;
+   const blaze::LCP problem( lcp( 100UL, false, unused ) );
+
+   for( size_t r=0UL; r<2UL; ++r )
+   {
+      blaze::LCP cp( problem );
+      cp.b_ = -1;
+
+      blaze::Lemke lemke;
+      configure( lemke, representations[r] );
+
+      lemke.solve( cp );
+
+      if( r == 0UL ) dense = cp.x_;
+      checkSolution( lemke, cp, dense, std::string( name( representations[r] ) ) + ", constant right-hand side" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Lemke solver for an LCP with non-negative right-hand side.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the zero vector is returned for an LCP with non-negative right-hand
+// side, irrespective of the initial values of the unknowns. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void LemkeTest::testTrivial()
+{
+   test_ = "Lemke for a trivial LCP";
+
+   const blaze::Lemke::Representation representations[] = { blaze::Lemke::dense, blaze::Lemke::revised };
+
+   for( size_t r=0UL; r<2UL; ++r )
+   {
+      VT unused;
+      blaze::LCP cp( lcp( 20UL, false, unused ) );
+      cp.b_ = 1;
+      cp.x_ = 5;
+
+      blaze::Lemke lemke;
+      configure( lemke, representations[r] );
+
+      lemke.solve( cp );
+      checkSolution( lemke, cp, VT( 20UL, 0 ), name( representations[r] ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Lemke solver for an LCP without solution.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an infeasible LCP is reported as not solved after the given number
+// of tries and that the precision of the last try is returned. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void LemkeTest::testInfeasible()
+{
+   test_ = "Lemke for an infeasible LCP";
+
+   const blaze::Lemke::Representation representations[] = { blaze::Lemke::dense, blaze::Lemke::revised };
+
+   for( size_t r=0UL; r<2UL; ++r )
+   {
+      const size_t n( 4UL );
+
+      blaze::LCP cp;
+      cp.A_.resize( n, n );
+      for( size_t i=0UL; i<n; ++i )
+         cp.A_(i,i) = -1;
+      cp.b_.resize( n );
+      cp.b_ = -1;
+      cp.x_.resize( n );
+      cp.x_.reset();
+
+      blaze::Lemke lemke;
+      configure( lemke, representations[r] );
+      lemke.setMaxIterations( 3UL );
+
+      if( lemke.solve( cp ) || lemke.getLastIterations() != 3UL ||
+          !( lemke.getLastPrecision() >= lemke.getThreshold() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Infeasible LCP reported as solved\n"
+             << " Details:\n"
+             << "   Representation = " << name( representations[r] ) << "\n"
+             << "   Tries = " << lemke.getLastIterations() << "\n"
+             << "   Precision = " << lemke.getLastPrecision() << "\n"
+             << "   Threshold = " << lemke.getThreshold() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates an LCP with a non-symmetric P-matrix and known solution.
+//
+// \param n The size of the LCP.
+// \param degenerate \a true for a degenerate reference solution, \a false if not.
+// \param ref The reference solution of the LCP.
+// \return The LCP with zero initial guess.
+//
+// The system matrix is strictly diagonally dominant with a positive diagonal and couples each
+// unknown to its neighbors and to a distant unknown. Every third unknown of the reference
+// solution is zero with a positive residual, all others are positive with a zero residual. In
+// case of a degenerate reference solution, additionally every fifth unknown has both a zero
+// value and a zero residual.
+*/
+blaze::LCP LemkeTest::lcp( size_t n, bool degenerate, VT& ref )
+{
+   blaze::LCP cp;
+   cp.A_.resize( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t far( ( i*17UL + 3UL ) % n );
+      if( far + 1UL < i || far > i + 1UL )
+         cp.A_(i,far) = 0.3;
+      if( i > 0UL )   cp.A_(i,i-1UL) = -1;
+      cp.A_(i,i) = 4 + blaze::real( i % 3UL );
+      if( i+1UL < n ) cp.A_(i,i+1UL) = 0.5;
+   }
+
+   VT w( n );
+   ref.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( degenerate && i % 5UL == 0UL ) {
+         ref[i] = 0;
+         w[i]   = 0;
+      }
+      else if( i % 3UL == 0UL ) {
+         ref[i] = 0;
+         w[i]   = 1 + 0.5 * std::cos( blaze::real( i ) );
+      }
+      else {
+         ref[i] = 1 + 0.5 * std::sin( blaze::real( i ) );
+         w[i]   = 0;
+      }
+   }
+
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configures the given Lemke solver for the tests.
+//
+// \param lemke The solver to be configured.
+// \param representation The representation of the pivoting tableau.
+// \return void
+//
+// The solver is restricted to a single try with the default cover vector.
+*/
+void LemkeTest::configure( blaze::Lemke& lemke, blaze::Lemke::Representation representation )
+{
+   lemke.setRepresentation( representation );
+   lemke.setThreshold( 1E-10 );
+   lemke.setMaxIterations( 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given representation.
+//
+// \param representation The representation of the pivoting tableau.
+// \return The name of the representation.
+*/
+const char* LemkeTest::name( blaze::Lemke::Representation representation )
+{
+   return ( representation == blaze::Lemke::dense )?( "Dense tableau" ):( "Revised form" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the computed solution against the reference solution.
+//
+// \param lemke The solver used for the solution.
+// \param cp The solved LCP.
+// \param ref The reference solution.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reports convergence, that the solution is feasible and
+// complementary and that it matches the reference solution.
+*/
+void LemkeTest::checkSolution( const blaze::Lemke& lemke, const blaze::LCP& cp, const VT& ref,
+                               const std::string& label ) const
+{
+   blaze::real error( 0 ), residual( 0 ), infeasibility( 0 );
+
+   if( cp.x_.size() == ref.size() ) {
+      const VT w( cp.A_ * cp.x_ + cp.b_ );
+      for( size_t i=0UL; i<ref.size(); ++i ) {
+         error         = blaze::max( error, std::fabs( cp.x_[i] - ref[i] ) );
+         residual      = blaze::max( residual, std::fabs( cp.x_[i] * w[i] ) );
+         infeasibility = blaze::max( infeasibility, -blaze::min( cp.x_[i], w[i] ) );
+      }
+   }
+
+   if( cp.x_.size() != ref.size() || lemke.getLastPrecision() >= lemke.getThreshold() ||
+       lemke.getLastIterations() != 1UL || error > 1E-9 || residual > 1E-9 || infeasibility > 1E-9 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   Solution process = " << label << "\n"
+          << "   Size of the problem = " << ref.size() << "\n"
+          << "   Size of the solution = " << cp.x_.size() << "\n"
+          << "   Tries = " << lemke.getLastIterations() << "\n"
+          << "   Precision = " << lemke.getLastPrecision() << "\n"
+          << "   Error = " << error << "\n"
+          << "   Complementarity residual = " << residual << "\n"
+          << "   Infeasibility = " << infeasibility << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Lemke solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_LEMKE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Lemke solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,1124 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/PGSTest.cpp
+//  \brief Source file for the projected Gauss-Seidel solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Infinity.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/solvers/PGSTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the projected Gauss-Seidel solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+PGSTest::PGSTest()
+{
+   testSettings();
+   testLCP();
+   testBoxLCP();
+   testColoring();
+   testColoredSweep();
+   testJacobiSweep();
+   testContactLCP();
+   testBlockUpdate();
+   testStatistics();
+   testWarmStart();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the settings of the PGS solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the default settings of the solver and the rejection of invalid relaxation
+// parameters. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testSettings()
+{
+   test_ = "PGS settings";
+
+   blaze::PGS pgs;
+
+   if( pgs.getSweepMode() != blaze::PGS::gaussSeidel || pgs.getRelaxation() != 0.5 ||
+       pgs.getBlockUpdate() || pgs.getNumColors() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid default settings\n"
+          << " Details:\n"
+          << "   Sweep mode = " << name( pgs.getSweepMode() ) << "\n"
+          << "   Relaxation = " << pgs.getRelaxation() << "\n"
+          << "   Block update = " << pgs.getBlockUpdate() << "\n"
+          << "   Number of colors = " << pgs.getNumColors() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   pgs.setSweepMode( blaze::PGS::jacobi );
+   pgs.setRelaxation( 1 );
+
+   if( pgs.getSweepMode() != blaze::PGS::jacobi || pgs.getRelaxation() != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting the sweep mode and the relaxation parameter failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::real invalid[] = { 0, -0.5, 1.5 };
+
+   for( size_t i=0UL; i<3UL; ++i ) {
+      try {
+         pgs.setRelaxation( invalid[i] );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid relaxation parameter accepted\n"
+             << " Details:\n"
+             << "   Relaxation = " << invalid[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PGS solver for LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves an LCP with a known solution, in which a third of the unknowns is zero
+// with a positive residual, in all sweep modes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testLCP()
+{
+   test_ = "PGS for LCPs";
+
+   const blaze::PGS::SweepMode modes[] = { blaze::PGS::gaussSeidel, blaze::PGS::colored, blaze::PGS::jacobi };
+
+   for( size_t m=0UL; m<4UL; ++m )
+   {
+      const blaze::PGS::SweepMode mode( modes[blaze::min( m, 2UL )] );
+
+      VT ref;
+      blaze::LCP cp( lcp( 20UL, ref ) );
+
+      blaze::PGS pgs;
+      configure( pgs, mode );
+      if( m == 3UL ) pgs.setRelaxation( 1 );
+
+      std::ostringstream label;
+      label << name( mode ) << ( ( m == 3UL )?( " (omega = 1)" ):( "" ) );
+
+      if( !pgs.solve( cp ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LCP not solved\n"
+             << " Details:\n"
+             << "   Sweep mode = " << label.str() << "\n"
+             << "   Precision = " << pgs.getLastPrecision() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolution( cp.x_, ref, label.str() );
+
+      const VT w( cp.A_ * cp.x_ + cp.b_ );
+      blaze::real residual( 0 );
+      for( size_t i=0UL; i<cp.size(); ++i )
+         residual = blaze::max( residual, std::fabs( blaze::min( cp.x_[i], w[i] ) ) );
+
+      if( residual > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Complementarity conditions violated\n"
+             << " Details:\n"
+             << "   Sweep mode = " << label.str() << "\n"
+             << "   Residual = " << residual << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PGS solver for box LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a box LCP with a known solution, in which a quarter of the unknowns is
+// at the lower bound and a quarter at the upper bound, in all sweep modes. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testBoxLCP()
+{
+   test_ = "PGS for box LCPs";
+
+   const blaze::PGS::SweepMode modes[] = { blaze::PGS::gaussSeidel, blaze::PGS::colored, blaze::PGS::jacobi };
+
+   const size_t k( 20UL );
+   const size_t n( k*k );
+
+   VT ref( n ), w( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      switch( i % 4UL ) {
+         case 0UL: ref[i] = -1;   w[i] =  1 + std::cos( blaze::real( i ) ); break;
+         case 1UL: ref[i] = 1.5;  w[i] = -1 + std::cos( blaze::real( i ) ); break;
+         default:  ref[i] = std::sin( blaze::real( i ) ); w[i] = 0; break;
+      }
+   }
+
+   for( size_t m=0UL; m<3UL; ++m )
+   {
+      blaze::BoxLCP cp;
+      cp.A_ = laplacian( k );
+      cp.b_ = w - cp.A_ * ref;
+      cp.x_.resize( n );
+      cp.x_.reset();
+      cp.xmin_.resize( n );
+      cp.xmax_.resize( n );
+      cp.xmin_ = -1;
+      cp.xmax_ = 1.5;
+
+      blaze::PGS pgs;
+      configure( pgs, modes[m] );
+
+      if( !pgs.solve( cp ) || cp.residual() > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Box LCP not solved\n"
+             << " Details:\n"
+             << "   Sweep mode = " << name( modes[m] ) << "\n"
+             << "   Precision = " << pgs.getLastPrecision() << "\n"
+             << "   Residual = " << cp.residual() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolution( cp.x_, ref, name( modes[m] ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the coloring of the colored sweep mode.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the number of colors of the greedy coloring for the five-point Laplacian
+// (two colors) and for an arrowhead matrix (three colors) and checks the solutions of both
+// problems. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testColoring()
+{
+   test_ = "Coloring of the colored sweep";
+
+   blaze::PGS pgs;
+   configure( pgs, blaze::PGS::colored );
+
+   {
+      VT ref;
+      blaze::LCP cp( lcp( 15UL, ref ) );
+
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Five-point Laplacian" );
+      checkColors( pgs, 2UL, "Five-point Laplacian" );
+   }
+
+   {
+      VT ref;
+      blaze::LCP cp( arrowhead( 20UL, ref ) );
+
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Arrowhead matrix" );
+      checkColors( pgs, 3UL, "Arrowhead matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel colored sweep.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a fixed number of colored sweeps for a problem exceeding the SMP
+// threshold of the PGS solver with one to four threads. The iterates must be bitwise identical
+// to a sequential Gauss-Seidel sweep over the two colors of the checkerboard coloring, and the
+// converged solution must match the reference solution. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testColoredSweep()
+{
+   test_ = "Parallel colored sweep";
+
+   size_t k( 16UL );
+   while( k*k < blaze::SMP_PGS_THRESHOLD )
+      k *= 2UL;
+
+   const size_t sweeps( 25UL );
+
+   VT ref, expected;
+   blaze::LCP cp( lcp( k, ref ) );
+
+   expected = cp.x_;
+   for( size_t s=0UL; s<sweeps; ++s ) {
+      for( size_t c=0UL; c<2UL; ++c ) {
+         for( size_t i=0UL; i<k; ++i ) {
+            for( size_t j=0UL; j<k; ++j ) {
+               if( ( i + j ) % 2UL != c ) continue;
+               const size_t row( i*k+j );
+               const blaze::real residual( -cp.b_[row] - product( cp.A_, expected, row ) );
+               expected[row] += ( blaze::real(1) / cp.A_(row,row) ) * residual;
+               expected[row] = blaze::max( blaze::real(0), expected[row] );
+            }
+         }
+      }
+   }
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      blaze::PGS pgs;
+      configure( pgs, blaze::PGS::colored );
+      pgs.setMaxIterations( sweeps );
+      pgs.setThreshold( 0 );
+
+      cp.x_.reset();
+      pgs.solve( cp );
+      checkIterates( cp.x_, expected, label.str() );
+
+      configure( pgs, blaze::PGS::colored );
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, label.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel relaxed Jacobi sweep.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a fixed number of relaxed Jacobi sweeps for a problem exceeding the
+// SMP threshold of the PGS solver with one to four threads. The iterates must be bitwise
+// identical to a sequential relaxed Jacobi iteration, and the converged solution must match
+// the reference solution. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void PGSTest::testJacobiSweep()
+{
+   test_ = "Parallel relaxed Jacobi sweep";
+
+   size_t k( 16UL );
+   while( k*k < blaze::SMP_PGS_THRESHOLD )
+      k *= 2UL;
+
+   const size_t sweeps( 25UL );
+   const blaze::real omega( 0.75 );
+
+   VT ref, expected, residual;
+   blaze::LCP cp( lcp( k, ref ) );
+
+   expected = cp.x_;
+   residual.resize( k*k );
+
+   for( size_t s=0UL; s<sweeps; ++s ) {
+      for( size_t i=0UL; i<k*k; ++i )
+         residual[i] = -cp.b_[i] - product( cp.A_, expected, i );
+      for( size_t i=0UL; i<k*k; ++i ) {
+         expected[i] += omega * ( blaze::real(1) / cp.A_(i,i) ) * residual[i];
+         expected[i] = blaze::max( blaze::real(0), expected[i] );
+      }
+   }
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      blaze::PGS pgs;
+      configure( pgs, blaze::PGS::jacobi );
+      pgs.setRelaxation( omega );
+      pgs.setMaxIterations( sweeps );
+      pgs.setThreshold( 0 );
+
+      cp.x_.reset();
+      pgs.solve( cp );
+      checkIterates( cp.x_, expected, label.str() );
+
+      configure( pgs, blaze::PGS::jacobi );
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, label.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Test of the PGS solver for contact LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a contact LCP exceeding the SMP threshold of the PGS solver with sticking
+// and separating contacts in all sweep modes, with scalar and with block updates, and with one
+// and four threads. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testContactLCP()
+{
+   test_ = "PGS for contact LCPs";
+
+   const blaze::PGS::SweepMode modes[] = { blaze::PGS::gaussSeidel, blaze::PGS::colored, blaze::PGS::jacobi };
+
+   const size_t N( blaze::SMP_PGS_THRESHOLD / 3UL + 100UL );
+
+   for( size_t threads=1UL; threads<=4UL; threads+=3UL )
+   {
+      blaze::setNumThreads( threads );
+
+      for( size_t block=0UL; block<2UL; ++block )
+      {
+         for( size_t m=0UL; m<3UL; ++m )
+         {
+            std::ostringstream label;
+            label << name( modes[m] ) << ( block ? ", block updates" : ", scalar updates" )
+                  << ", " << threads << " thread(s)";
+
+            VT ref;
+            blaze::ContactLCP cp( contacts( N, ref ) );
+
+            blaze::PGS pgs;
+            configure( pgs, modes[m] );
+            pgs.setBlockUpdate( block != 0UL );
+
+            if( !pgs.solve( cp ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Contact LCP not solved\n"
+                   << " Details:\n"
+                   << "   Solution process = " << label.str() << "\n"
+                   << "   Precision = " << pgs.getLastPrecision() << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            checkSolution( cp.x_, ref, label.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block updates of the PGS solver for contact LCPs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a single Gauss-Seidel sweep with block updates for uncoupled contacts
+// with fully populated 3x3 diagonal blocks. For sticking contacts the sweep must yield the exact
+// solution of the 3x3 system, for sliding contacts the tangential unknowns must be scaled onto
+// the isotropic friction cone. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void PGSTest::testBlockUpdate()
+{
+   test_ = "PGS block updates";
+
+   const size_t N( 12UL );
+   const blaze::real mu( 0.5 );
+
+   blaze::ContactLCP cp;
+   cp.A_.resize( 3UL*N, 3UL*N );
+   cp.b_.resize( 3UL*N );
+   cp.x_.resize( 3UL*N );
+   cp.cof_.resize( N );
+   cp.x_.reset();
+   cp.cof_ = mu;
+
+   VT expected( 3UL*N );
+
+   for( size_t c=0UL; c<N; ++c )
+   {
+      const size_t j( 3UL*c );
+      const blaze::real s( 0.1 * blaze::real( c ) );
+
+      const blaze::StaticMatrix<blaze::real,3UL,3UL> B( 4+s, 0.5, 0.3,
+                                                        0.5, 3  , 0.2+s,
+                                                        0.3, 0.2+s, 3+s );
+
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t l=0UL; l<3UL; ++l )
+            cp.A_(j+k,j+l) = B(k,l);
+
+      // Unconstrained solution of the contact: sticking for even, sliding for odd contacts
+      const blaze::StaticVector<blaze::real,3UL> y( 1 + s, ( c % 2UL )?( 0.9 ):( 0.1 ),
+                                                           ( c % 2UL )?( -0.6 ):( 0.05 ) );
+      const blaze::StaticVector<blaze::real,3UL> b( -( B * y ) );
+
+      cp.b_[j    ] = b[0];
+      cp.b_[j+1UL] = b[1];
+      cp.b_[j+2UL] = b[2];
+
+      const blaze::real ft( std::sqrt( y[1]*y[1] + y[2]*y[2] ) );
+      const blaze::real scale( ( ft > mu*y[0] )?( mu*y[0] / ft ):( 1 ) );
+
+      expected[j    ] = y[0];
+      expected[j+1UL] = y[1] * scale;
+      expected[j+2UL] = y[2] * scale;
+   }
+
+   blaze::PGS pgs;
+   configure( pgs, blaze::PGS::gaussSeidel );
+   pgs.setBlockUpdate( true );
+   pgs.setMaxIterations( 1UL );
+
+   if( !pgs.getBlockUpdate() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Enabling block updates failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   pgs.solve( cp );
+
+   blaze::real error( 0 );
+   for( size_t i=0UL; i<3UL*N; ++i )
+      error = blaze::max( error, std::fabs( cp.x_[i] - expected[i] ) );
+
+   if( error > 1E-12 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of a single block update sweep\n"
+          << " Details:\n"
+          << "   Error = " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the convergence statistics of the PGS solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests for all sweep modes that no statistics are recorded by default and that
+// the recorded residual history and timings of enabled statistics match the performed sweeps.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testStatistics()
+{
+   test_ = "PGS statistics";
+
+   const blaze::PGS::SweepMode modes[] = { blaze::PGS::gaussSeidel, blaze::PGS::colored, blaze::PGS::jacobi };
+
+   for( size_t m=0UL; m<3UL; ++m )
+   {
+      VT ref;
+      blaze::LCP cp( lcp( 12UL, ref ) );
+
+      blaze::PGS pgs;
+      configure( pgs, modes[m] );
+
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, name( modes[m] ) );
+
+      if( pgs.getStatistics() || !pgs.getResidualHistory().empty() || !pgs.getIterationTimes().empty() ||
+          pgs.getSetupTime() != 0.0 || pgs.getResidualTime() != 0.0 || pgs.getUpdateTime() != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Statistics recorded by default\n"
+             << " Details:\n"
+             << "   Sweep mode = " << name( modes[m] ) << "\n"
+             << "   Size of the residual history = " << pgs.getResidualHistory().size() << "\n"
+             << "   Number of iteration times = " << pgs.getIterationTimes().size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      pgs.setStatistics( true );
+
+      cp.x_.reset();
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, name( modes[m] ) );
+      checkStatistics( pgs, name( modes[m] ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the warm start of the PGS solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the warm start of the colored sweep. It checks that a warm start from the
+// reference solution does not require any sweep, that the cached coloring is reused for changed
+// values of the system matrix while its value-dependent data is recomputed, that a changed
+// sparsity pattern of the same size results in a new coloring and that the cached coloring can
+// be discarded explicitly. Additionally, it checks the recomputation of the inverse diagonal
+// blocks for the block updates of contact LCPs. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testWarmStart()
+{
+   test_ = "PGS warm start";
+
+   {
+      blaze::PGS pgs;
+      configure( pgs, blaze::PGS::colored );
+      pgs.setWarmStart( true );
+
+      VT ref, other;
+      blaze::LCP cp   ( lcp( 15UL, ref ) );
+      blaze::LCP arrow( arrowhead( cp.size(), other ) );
+
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Cold start" );
+      checkColors( pgs, 2UL, "Cold start" );
+
+      cp.x_ = ref;
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Warm start from the reference solution" );
+
+      if( pgs.getLastIterations() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Sweeps performed for the reference solution\n"
+             << " Details:\n"
+             << "   Iterations = " << pgs.getLastIterations() << "\n"
+             << "   Precision = " << pgs.getLastPrecision() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      cp.A_ *= 2;
+      cp.b_ *= 2;
+      cp.x_.reset();
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Changed values of the system matrix" );
+      checkColors( pgs, 2UL, "Changed values of the system matrix" );
+
+      pgs.solve( arrow );
+      checkSolution( arrow.x_, other, "Changed sparsity pattern" );
+      checkColors( pgs, 3UL, "Changed sparsity pattern" );
+
+      cp.x_.reset();
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Restored sparsity pattern" );
+      checkColors( pgs, 2UL, "Restored sparsity pattern" );
+
+      pgs.invalidate();
+
+      cp.x_.reset();
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Discarded coloring" );
+      checkColors( pgs, 2UL, "Discarded coloring" );
+   }
+
+   {
+      blaze::PGS pgs;
+      configure( pgs, blaze::PGS::colored );
+      pgs.setBlockUpdate( true );
+      pgs.setWarmStart( true );
+
+      VT ref;
+      blaze::ContactLCP cp( contacts( 40UL, ref ) );
+
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Contact LCP" );
+
+      cp.A_ *= 2;
+      cp.b_ *= 2;
+      cp.x_.reset();
+      pgs.solve( cp );
+      checkSolution( cp.x_, ref, "Contact LCP with changed values of the system matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the shifted five-point Laplacian on a square grid.
+//
+// \param k The number of grid points per dimension.
+// \return The strictly diagonally dominant system matrix of size \f$ k^2 \times k^2 \f$.
+*/
+PGSTest::MT PGSTest::laplacian( size_t k )
+{
+   const size_t n( k*k );
+   MT A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=0UL; j<k; ++j ) {
+         const size_t row( i*k+j );
+         if( i > 0UL )   A.append( row, row-k, -1 );
+         if( j > 0UL )   A.append( row, row-1UL, -1 );
+         A.append( row, row, 8 );
+         if( j+1UL < k ) A.append( row, row+1UL, -1 );
+         if( i+1UL < k ) A.append( row, row+k, -1 );
+         A.finalize( row );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an LCP with known solution on a square grid.
+//
+// \param k The number of grid points per dimension.
+// \param ref The reference solution of the LCP.
+// \return The LCP with zero initial guess.
+//
+// Every third unknown of the reference solution is zero with a positive residual, all other
+// unknowns are positive with zero residual.
+*/
+blaze::LCP PGSTest::lcp( size_t k, VT& ref )
+{
+   const size_t n( k*k );
+
+   VT w( n );
+   ref.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i % 3UL == 0UL ) {
+         ref[i] = 0;
+         w[i]   = 1 + 0.5 * std::cos( blaze::real( i ) );
+      }
+      else {
+         ref[i] = 1 + 0.5 * std::sin( blaze::real( i ) );
+         w[i]   = 0;
+      }
+   }
+
+   blaze::LCP cp;
+   cp.A_ = laplacian( k );
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an LCP for an arrowhead matrix with a known solution.
+//
+// \param n The size of the LCP.
+// \param ref The reference solution of the LCP.
+// \return The LCP for an \f$ n \times n \f$ arrowhead matrix.
+//
+// The system matrix couples the first node to all other nodes and each further node to its
+// predecessor, which results in three colors for the greedy coloring. Every third unknown of
+// the reference solution is zero.
+*/
+blaze::LCP PGSTest::arrowhead( size_t n, VT& ref )
+{
+   blaze::LCP cp;
+   cp.A_.resize( n, n );
+   for( size_t i=0UL; i<n; ++i ) {
+      cp.A_(i,i) = ( i == 0UL )?( blaze::real( 2*n ) ):( 10 );
+      if( i > 0UL ) {
+         cp.A_(0,i) = cp.A_(i,0) = -0.5;
+         if( i > 1UL ) cp.A_(i,i-1UL) = cp.A_(i-1UL,i) = -1;
+      }
+   }
+
+   VT w( n );
+   ref.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ref[i] = ( i % 3UL == 2UL )?( 0 ):( 1 + blaze::real( i ) / n );
+      w[i]   = ( i % 3UL == 2UL )?( 2 ):( 0 );
+   }
+
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a contact LCP with known solution.
+//
+// \param N The number of contacts.
+// \param ref The reference solution of the contact LCP.
+// \return The contact LCP with zero initial guess.
+//
+// The 3x3 diagonal blocks of the contacts are fully populated and neighboring contacts are
+// coupled. Every fourth contact of the reference solution is separating (zero unknowns with a
+// positive normal residual), all other contacts are sticking (zero residual and tangential
+// unknowns strictly inside both the friction box and the friction cone).
+*/
+blaze::ContactLCP PGSTest::contacts( size_t N, VT& ref )
+{
+   const size_t n( 3UL*N );
+   const blaze::real block[3][3] = { { 4.0, 0.5, 0.3 }, { 0.5, 3.0, 0.2 }, { 0.3, 0.2, 3.0 } };
+
+   blaze::ContactLCP cp;
+   cp.A_.resize( n, n );
+   cp.A_.reserve( 15UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t c( i / 3UL ), k( i % 3UL );
+      if( c > 0UL ) {
+         for( size_t l=0UL; l<3UL; ++l )
+            cp.A_.append( i, 3UL*(c-1UL)+l, -0.2 );
+      }
+      for( size_t l=0UL; l<3UL; ++l )
+         cp.A_.append( i, 3UL*c+l, block[k][l] );
+      if( c+1UL < N ) {
+         for( size_t l=0UL; l<3UL; ++l )
+            cp.A_.append( i, 3UL*(c+1UL)+l, -0.2 );
+      }
+      cp.A_.finalize( i );
+   }
+
+   VT w( n, 0 );
+   ref.resize( n );
+
+   for( size_t c=0UL; c<N; ++c ) {
+      const size_t j( 3UL*c );
+      if( c % 4UL == 3UL ) {
+         ref[j] = ref[j+1UL] = ref[j+2UL] = 0;
+         w[j] = 1 + 0.1 * blaze::real( c % 5UL );
+      }
+      else {
+         ref[j    ] = 1 + 0.3 * std::sin( blaze::real( c ) );
+         ref[j+1UL] = 0.1 * std::cos( blaze::real( c ) );
+         ref[j+2UL] = 0.05 * std::sin( blaze::real( 2UL*c ) );
+      }
+   }
+
+   cp.b_ = w - cp.A_ * ref;
+   cp.x_.resize( n );
+   cp.x_.reset();
+   cp.cof_.resize( N );
+   cp.cof_ = 0.5;
+
+   return cp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configures the given PGS solver for the tests.
+//
+// \param pgs The solver to be configured.
+// \param mode The sweep mode of the solver.
+// \return void
+*/
+void PGSTest::configure( blaze::PGS& pgs, blaze::PGS::SweepMode mode )
+{
+   pgs.setSweepMode( mode );
+   pgs.setThreshold( 1E-13 );
+   pgs.setMaxIterations( 100000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given sweep mode.
+//
+// \param mode The sweep mode.
+// \return The name of the sweep mode.
+*/
+const char* PGSTest::name( blaze::PGS::SweepMode mode )
+{
+   switch( mode ) {
+      case blaze::PGS::colored: return "colored";
+      case blaze::PGS::jacobi : return "Jacobi";
+      default                 : return "Gauss-Seidel";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the product of a row of the system matrix with the given vector.
+//
+// \param A The system matrix.
+// \param x The vector of unknowns.
+// \param i The index of the row.
+// \return The scalar product of the \a i-th row of \a A and \a x.
+*/
+blaze::real PGSTest::product( const MT& A, const VT& x, size_t i )
+{
+   blaze::real tmp( 0 );
+   for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+      tmp += element->value() * x[element->index()];
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the computed solution against the reference solution.
+//
+// \param x The computed solution.
+// \param ref The reference solution.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void PGSTest::checkSolution( const VT& x, const VT& ref, const std::string& label ) const
+{
+   blaze::real error( 0 );
+
+   if( x.size() == ref.size() ) {
+      for( size_t i=0UL; i<x.size(); ++i )
+         error = blaze::max( error, std::fabs( x[i] - ref[i] ) );
+   }
+
+   if( x.size() != ref.size() || error > 1E-9 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   Solution process = " << label << "\n"
+          << "   Size of the problem = " << ref.size() << "\n"
+          << "   Size of the solution = " << x.size() << "\n"
+          << "   Error = " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the computed iterate for bitwise equality with the expected iterate.
+//
+// \param x The computed iterate.
+// \param ref The expected iterate.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void PGSTest::checkIterates( const VT& x, const VT& ref, const std::string& label ) const
+{
+   for( size_t i=0UL; i<ref.size(); ++i ) {
+      if( i >= x.size() || x[i] != ref[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterate differs from the sequential sweep\n"
+             << " Details:\n"
+             << "   Solution process = " << label << "\n"
+             << "   Index = " << i << "\n"
+             << "   Size of the iterate = " << x.size() << "\n";
+         if( i < x.size() ) {
+            oss << std::setprecision( 20 )
+                << "   Value = " << x[i] << "\n"
+                << "   Expected value = " << ref[i] << "\n";
+         }
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of colors of the last colored sweep.
+//
+// \param pgs The solver to be checked.
+// \param colors The expected number of colors.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void PGSTest::checkColors( const blaze::PGS& pgs, size_t colors, const std::string& label ) const
+{
+   if( pgs.getNumColors() != colors ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of colors\n"
+          << " Details:\n"
+          << "   Solution process = " << label << "\n"
+          << "   Number of colors = " << pgs.getNumColors() << "\n"
+          << "   Expected number of colors = " << colors << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the recorded statistics of the last solution process.
+//
+// \param pgs The solver to be checked.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void PGSTest::checkStatistics( const blaze::PGS& pgs, const std::string& label ) const
+{
+   const std::vector<blaze::real>& residuals( pgs.getResidualHistory() );
+   const std::vector<double>& times( pgs.getIterationTimes() );
+   const size_t iterations( pgs.getLastIterations() );
+
+   double total( 0.0 );
+   bool negative( pgs.getSetupTime() < 0.0 || pgs.getResidualTime() < 0.0 || pgs.getUpdateTime() < 0.0 );
+
+   for( size_t i=0UL; i<times.size(); ++i ) {
+      total += times[i];
+      if( times[i] < 0.0 ) negative = true;
+   }
+
+   if( iterations == 0UL || residuals.size() != iterations || times.size() != iterations ||
+       residuals.back() != pgs.getLastPrecision() || residuals.back() >= pgs.getThreshold() ||
+       negative || pgs.getResidualTime() + pgs.getUpdateTime() > 1.000001*total + 1E-9 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid statistics\n"
+          << " Details:\n"
+          << "   Solution process = " << label << "\n"
+          << "   Iterations = " << iterations << "\n"
+          << "   Size of the residual history = " << residuals.size() << "\n"
+          << "   Number of iteration times = " << times.size() << "\n"
+          << "   Final residual = " << ( residuals.empty() ? blaze::real(0) : residuals.back() ) << "\n"
+          << "   Precision = " << pgs.getLastPrecision() << "\n"
+          << "   Total iteration time = " << total << "\n"
+          << "   Setup time = " << pgs.getSetupTime() << "\n"
+          << "   Residual time = " << pgs.getResidualTime() << "\n"
+          << "   Update time = " << pgs.getUpdateTime() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PGS solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_PGS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PGS solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
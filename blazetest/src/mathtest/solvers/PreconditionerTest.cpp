@@ -0,0 +1,872 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/PreconditionerTest.cpp
+//  \brief Source file for the incomplete LU preconditioner test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Functions.h>
+#include <blaze/math/solvers/ILU0Preconditioner.h>
+#include <blaze/math/solvers/ILUTPreconditioner.h>
+#include <blaze/math/triangular/LevelSchedule.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/solvers/PreconditionerTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the incomplete LU preconditioner test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+PreconditionerTest::PreconditionerTest()
+{
+   testILU0();
+   testILUT();
+   testLevelSchedule();
+   testParallel();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ILU(0) preconditioner.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the ILU(0) factors of a tridiagonal matrix, for which the incomplete
+// factorization is exact, and of a non-symmetric five-point matrix, for which the product of
+// the factors has to match the system matrix on its sparsity pattern. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testILU0()
+{
+   test_ = "ILU(0) preconditioner";
+
+   {
+      const MT A( tridiagonal( 200UL ) );
+      const blaze::ILU0Preconditioner ilu( A );
+
+      checkFactors( ilu, A, true, "Tridiagonal matrix" );
+      checkApply( ilu, "Tridiagonal matrix" );
+   }
+
+   {
+      const MT A( convectionDiffusion( 12UL ) );
+      const blaze::ILU0Preconditioner ilu( A );
+
+      checkFactors( ilu, A, false, "Five-point matrix" );
+      checkApply( ilu, "Five-point matrix" );
+
+      if( ilu.lower().nonZeros() + ilu.upper().nonZeros() != A.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fill-in detected\n"
+             << " Details:\n"
+             << "   Non-zeros of the system matrix = " << A.nonZeros() << "\n"
+             << "   Non-zeros of L = " << ilu.lower().nonZeros() << "\n"
+             << "   Non-zeros of U = " << ilu.upper().nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::ILU0Preconditioner dense;
+      dense.compute( blaze::DynamicMatrix<blaze::real,blaze::columnMajor>( A ) );
+
+      if( dense.lower() != ilu.lower() || dense.upper() != ilu.upper() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factors depend on the type of the system matrix\n"
+             << " Details:\n"
+             << "   Type of the system matrix = column-major dense matrix\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ILUT preconditioner.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that ILUT without dropping computes the exact LU factorization, also
+// in case the fill limit is exactly large enough for the fill-in, and that the factors of the
+// dual dropping strategy respect both the drop tolerance and the fill limit. Additionally, it
+// checks the default and modified settings. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testILUT()
+{
+   test_ = "ILUT preconditioner";
+
+   {
+      const MT A( convectionDiffusion( 10UL ) );
+      const blaze::ILUTPreconditioner ilut( A, 0, A.rows() );
+
+      checkFactors( ilut, A, true, "Five-point matrix without dropping" );
+      checkApply( ilut, "Five-point matrix without dropping" );
+   }
+
+   {
+      const MT A( tridiagonal( 100UL ) );
+      const blaze::ILUTPreconditioner ilut( A, 0, 1UL );
+
+      checkFactors( ilut, A, true, "Tridiagonal matrix with fill limit 1" );
+      checkApply( ilut, "Tridiagonal matrix with fill limit 1" );
+   }
+
+   {
+      const MT A( convectionDiffusion( 12UL ) );
+      const blaze::real tau( 0.05 );
+      const size_t fill( 2UL );
+
+      blaze::ILUTPreconditioner ilut( tau, fill );
+      ilut.compute( A );
+
+      checkApply( ilut, "Five-point matrix with dual dropping" );
+
+      const MT& L( ilut.lower() );
+      const MT& U( ilut.upper() );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         blaze::real norm( 0 );
+         for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+            norm += element->value() * element->value();
+
+         const blaze::real tol( tau * std::sqrt( norm ) );
+
+         bool invalid( L.nonZeros( i ) > fill || U.nonZeros( i ) > fill+1UL ||
+                       U.begin(i) == U.end(i) || U.begin(i)->index() != i );
+
+         for( MT::ConstIterator element=L.begin(i); element!=L.end(i); ++element ) {
+            if( element->index() >= i || std::fabs( element->value() ) < tol )
+               invalid = true;
+         }
+
+         for( MT::ConstIterator element=U.begin(i)+1; element<U.end(i); ++element ) {
+            if( element->index() <= i || std::fabs( element->value() ) < tol )
+               invalid = true;
+         }
+
+         if( invalid ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid dual dropping\n"
+                << " Details:\n"
+                << "   Row = " << i << "\n"
+                << "   Drop tolerance = " << tol << "\n"
+                << "   Fill limit = " << fill << "\n"
+                << "   Non-zeros of L = " << L.nonZeros( i ) << "\n"
+                << "   Non-zeros of U = " << U.nonZeros( i ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      const blaze::ILUTPreconditioner exact( A, 0, A.rows() );
+      const size_t nonzeros( exact.lower().nonZeros() + exact.upper().nonZeros() );
+
+      if( L.nonZeros() + U.nonZeros() >= nonzeros ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: No elements dropped\n"
+             << " Details:\n"
+             << "   Non-zeros of the exact factors = " << nonzeros << "\n"
+             << "   Non-zeros of L = " << L.nonZeros() << "\n"
+             << "   Non-zeros of U = " << U.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::ILUTPreconditioner ilut;
+
+      if( ilut.getDropTolerance() != blaze::real( 1E-4 ) || ilut.getFillLimit() != 10UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid default settings\n"
+             << " Details:\n"
+             << "   Drop tolerance = " << ilut.getDropTolerance() << "\n"
+             << "   Fill limit = " << ilut.getFillLimit() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ilut.setDropTolerance( 0.25 );
+      ilut.setFillLimit( 4UL );
+
+      if( ilut.getDropTolerance() != blaze::real( 0.25 ) || ilut.getFillLimit() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid settings\n"
+             << " Details:\n"
+             << "   Drop tolerance = " << ilut.getDropTolerance() << "\n"
+             << "   Fill limit = " << ilut.getFillLimit() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the level schedules of the triangular substitutions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number and the widths of the levels for triangular matrices with
+// known dependency structure, including the factors of a five-point matrix, whose levels are
+// the anti-diagonals of the grid. Additionally, it checks the substitution with an implicit
+// unit diagonal and the reuse of a schedule after a change of the values of the matrix. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testLevelSchedule()
+{
+   test_ = "Level schedule";
+
+   {
+      const blaze::LevelSchedule schedule;
+
+      if( schedule.size() != 0UL || schedule.levels() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid default schedule\n"
+             << " Details:\n"
+             << "   Size = " << schedule.size() << "\n"
+             << "   Number of levels = " << schedule.levels() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      MT D( 10UL, 10UL );
+      MT B( 10UL, 10UL );
+
+      for( size_t i=0UL; i<10UL; ++i ) {
+         D(i,i) = 2;
+         B(i,i) = 2;
+         if( i > 0UL ) B(i,i-1UL) = -1;
+      }
+
+      blaze::LevelSchedule diagonal;
+      diagonal.computeUpper( D );
+
+      blaze::LevelSchedule bidiagonal;
+      bidiagonal.computeLower( B );
+
+      if( diagonal.size() != 10UL || diagonal.levels() != 1UL || diagonal.width( 0UL ) != 10UL ||
+          !diagonal.isUpper() || bidiagonal.size() != 10UL || bidiagonal.levels() != 10UL ||
+          bidiagonal.width( 9UL ) != 1UL || bidiagonal.isUpper() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid levels\n"
+             << " Details:\n"
+             << "   Levels of the diagonal matrix = " << diagonal.levels() << "\n"
+             << "   Levels of the bidiagonal matrix = " << bidiagonal.levels() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const size_t k( 8UL );
+      const blaze::ILU0Preconditioner ilu( convectionDiffusion( k ) );
+
+      blaze::LevelSchedule lower, upper;
+      lower.computeLower( ilu.lower() );
+      upper.computeUpper( ilu.upper() );
+
+      bool invalid( lower.levels() != 2UL*k-1UL || upper.levels() != 2UL*k-1UL );
+
+      for( size_t l=0UL; !invalid && l<2UL*k-1UL; ++l ) {
+         const size_t width( blaze::min( l+1UL, 2UL*k-1UL-l ) );
+         if( lower.width( l ) != width || upper.width( l ) != width )
+            invalid = true;
+      }
+
+      if( invalid ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid levels of the five-point factors\n"
+             << " Details:\n"
+             << "   Grid size = " << k << "x" << k << "\n"
+             << "   Levels of the lower factor = " << lower.levels() << "\n"
+             << "   Levels of the upper factor = " << upper.levels() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      MT L( dependencies( 60UL, 6UL ) );
+
+      blaze::LevelSchedule schedule;
+      schedule.computeLower( L );
+
+      if( schedule.levels() != 10UL || schedule.width( 4UL ) != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid levels\n"
+             << " Details:\n"
+             << "   Number of levels = " << schedule.levels() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const VT ref( reference( 60UL ) );
+
+      for( size_t run=0UL; run<3UL; ++run )
+      {
+         const bool unit( run == 1UL );
+
+         VT z( L * ref );
+         if( unit ) {
+            for( size_t i=0UL; i<60UL; ++i )
+               z[i] -= ( L(i,i) - 1 ) * ref[i];
+         }
+
+         schedule.solve( L, z, unit );
+
+         blaze::real error( 0 );
+         for( size_t i=0UL; i<60UL; ++i )
+            error = blaze::max( error, std::fabs( z[i] - ref[i] ) );
+
+         if( error > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid substitution\n"
+                << " Details:\n"
+                << "   Unit diagonal = " << unit << "\n"
+                << "   Modified values = " << ( run == 2UL ) << "\n"
+                << "   Error = " << error << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( run == 1UL ) {
+            for( size_t i=0UL; i<60UL; ++i )
+               for( MT::Iterator element=L.begin(i); element!=L.end(i); ++element )
+                  element->value() *= ( element->index() == i )?( 3 ):( -0.5 );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel level-scheduled substitutions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves lower and upper triangular systems whose levels exceed the SMP threshold
+// of the triangular substitution and applies an ILU(0) preconditioner with such factors
+// repeatedly with one to four threads. Since the computation of each unknown does not depend
+// on the order of the rows, the results have to be identical for all numbers of threads. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testParallel()
+{
+   test_ = "Parallel level-scheduled substitution";
+
+   const size_t width( blaze::max( blaze::SMP_TRSV_THRESHOLD, 64UL ) );
+   const size_t n( 4UL*width );
+
+   const MT L( dependencies( n, width ) );
+   const MT U( blaze::trans( L ) );
+   const MT A( L + U );
+
+   blaze::LevelSchedule lower, upper;
+   lower.computeLower( L );
+   upper.computeUpper( U );
+
+   const blaze::ILU0Preconditioner ilu( A );
+   const VT ref( reference( n ) );
+   const VT r( A * ref );
+
+   VT lowerSerial, upperSerial, iluSerial;
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      for( size_t run=0UL; run<10UL; ++run )
+      {
+         VT zl( L * ref );
+         lower.solve( L, zl );
+
+         VT zu( U * ref );
+         upper.solve( U, zu );
+
+         blaze::real error( 0 );
+         for( size_t i=0UL; i<n; ++i )
+            error = blaze::max( error, blaze::max( std::fabs( zl[i] - ref[i] ),
+                                                   std::fabs( zu[i] - ref[i] ) ) );
+
+         if( error > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid substitution\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   Run = " << run << "\n"
+                << "   Error = " << error << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         checkApply( ilu, "ILU(0) factors, " + label.str() );
+
+         VT z;
+         ilu.apply( r, z );
+
+         if( threads == 1UL && run == 0UL ) {
+            lowerSerial = zl;
+            upperSerial = zu;
+            iluSerial   = z;
+         }
+         else if( zl != lowerSerial || zu != upperSerial || z != iluSerial ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Result depends on the number of threads\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   Run = " << run << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the incomplete LU preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that non-square matrices, missing diagonal elements, zero pivots and
+// negative drop tolerances are rejected. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void PreconditionerTest::testErrors()
+{
+   test_ = "Incomplete LU error handling";
+
+   MT singular( 3UL, 3UL );
+   singular(0,0) = 1;
+   singular(0,1) = 1;
+   singular(1,0) = 1;
+   singular(1,1) = 1;
+   singular(2,2) = 1;
+
+   MT missing( tridiagonal( 5UL ) );
+   missing.erase( 2UL, 2UL );
+
+   try {
+      blaze::ILU0Preconditioner ilu( MT( 3UL, 4UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-square matrix accepted by ILU(0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::ILU0Preconditioner ilu( missing );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Missing diagonal element accepted by ILU(0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::ILU0Preconditioner ilu( singular );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Zero pivot accepted by ILU(0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::ILUTPreconditioner ilut( MT( 3UL, 4UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-square matrix accepted by ILUT\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::ILUTPreconditioner ilut( singular, 0, 3UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Zero pivot accepted by ILUT\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   blaze::ILUTPreconditioner ilut;
+
+   try {
+      ilut.setDropTolerance( -1E-3 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Negative drop tolerance accepted by ILUT\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   if( ilut.getDropTolerance() != blaze::real( 1E-4 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Drop tolerance modified by an invalid setting\n"
+          << " Details:\n"
+          << "   Drop tolerance = " << ilut.getDropTolerance() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a non-symmetric, diagonally dominant tridiagonal matrix.
+//
+// \param n The size of the matrix.
+// \return The tridiagonal matrix.
+*/
+PreconditionerTest::MT PreconditionerTest::tridiagonal( size_t n )
+{
+   MT A( n, n );
+   A.reserve( 3UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i > 0UL )   A.append( i, i-1UL, -1 - 0.3 * std::cos( blaze::real( i ) ) );
+      A.append( i, i, 4 + std::sin( blaze::real( i ) ) );
+      if( i+1UL < n ) A.append( i, i+1UL, -1 + 0.2 * std::sin( blaze::real( i ) ) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the non-symmetric five-point matrix of a convection-diffusion problem.
+//
+// \param k The number of grid points per dimension.
+// \return The diagonally dominant system matrix of size \f$ k^2 \times k^2 \f$.
+*/
+PreconditionerTest::MT PreconditionerTest::convectionDiffusion( size_t k )
+{
+   const size_t n( k*k );
+   MT A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=0UL; j<k; ++j ) {
+         const size_t row( i*k+j );
+         if( i > 0UL )   A.append( row, row-k, -1.2 );
+         if( j > 0UL )   A.append( row, row-1UL, -1.3 );
+         A.append( row, row, 4.5 );
+         if( j+1UL < k ) A.append( row, row+1UL, -0.7 );
+         if( i+1UL < k ) A.append( row, row+k, -0.8 );
+         A.finalize( row );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lower triangular matrix with levels of the given width.
+//
+// \param n The size of the matrix (a multiple of \a width).
+// \param width The number of rows per level.
+// \return The row-major lower triangular matrix.
+//
+// Each row of the block \a b of \a width consecutive rows depends on the row at the same
+// position and on one of the last 64 rows of block \a b-1, and on a scattered row of all
+// preceding blocks. Thus the matrix has \a n/width levels of \a width rows each, with
+// dependencies on rows that are processed shortly before by other threads.
+*/
+PreconditionerTest::MT PreconditionerTest::dependencies( size_t n, size_t width )
+{
+   MT L( n, n );
+   L.reserve( 4UL*n );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t block( i / width );
+
+      if( block > 0UL )
+      {
+         const size_t previous( ( block-1UL )*width );
+         const size_t j1( i - width );
+         const size_t j2( previous + width - 1UL - ( i*7919UL ) % blaze::min( width, 64UL ) );
+         const size_t j3( ( i*31UL ) % previous );
+
+         if( block > 1UL && j3 < blaze::min( j1, j2 ) ) L.append( i, j3, -0.1 );
+         L.append( i, blaze::min( j1, j2 ), -0.3 );
+         if( j1 != j2 ) L.append( i, blaze::max( j1, j2 ), -0.2 );
+      }
+
+      L.append( i, i, 2 + std::sin( blaze::real( i ) ) );
+      L.finalize( i );
+   }
+
+   return L;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a reference vector of the given size.
+//
+// \param n The size of the vector.
+// \return The reference vector.
+*/
+PreconditionerTest::VT PreconditionerTest::reference( size_t n )
+{
+   VT x( n );
+   for( size_t i=0UL; i<n; ++i )
+      x[i] = 1 + std::sin( blaze::real( i ) );
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the dense product of the given incomplete LU factors.
+//
+// \param L The strictly lower part of the unit lower triangular factor.
+// \param U The upper triangular factor.
+// \return The product \f$ L U \f$ including the unit diagonal of \f$ L \f$.
+*/
+PreconditionerTest::DT PreconditionerTest::product( const MT& L, const MT& U )
+{
+   DT M( U );
+   M += L * U;
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the factors of the given preconditioner against the system matrix.
+//
+// \param pc The preconditioner.
+// \param A The system matrix.
+// \param exact \a true in case the factorization is exact, \a false for ILU(0) factors.
+// \param label The label of the factorization.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the lower factor is strictly lower triangular and that each row
+// of the upper factor starts with its diagonal element. For an exact factorization the product
+// of the factors has to match the system matrix, for ILU(0) factors only on the sparsity
+// pattern of the system matrix.
+*/
+template< typename PT >  // Type of the preconditioner
+void PreconditionerTest::checkFactors( const PT& pc, const MT& A, bool exact,
+                                       const std::string& label ) const
+{
+   const MT& L( pc.lower() );
+   const MT& U( pc.upper() );
+
+   bool triangular( pc.size() == A.rows() && L.rows() == A.rows() && U.rows() == A.rows() );
+
+   for( size_t i=0UL; triangular && i<A.rows(); ++i ) {
+      if( L.begin(i) != L.end(i) && ( L.end(i)-1 )->index() >= i )
+         triangular = false;
+      if( U.begin(i) == U.end(i) || U.begin(i)->index() != i )
+         triangular = false;
+   }
+
+   if( !triangular ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid triangular factors\n"
+          << " Details:\n"
+          << "   Factorization = " << label << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const DT M( product( L, U ) );
+   const DT D( A );
+
+   blaze::real error( 0 );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( exact || !blaze::isDefault( D(i,j) ) )
+            error = blaze::max( error, std::fabs( M(i,j) - D(i,j) ) );
+      }
+   }
+
+   if( error > 1E-12 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Product of the factors differs from the system matrix\n"
+          << " Details:\n"
+          << "   Factorization = " << label << "\n"
+          << "   Exact factorization = " << exact << "\n"
+          << "   Error = " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the application of the given preconditioner.
+//
+// \param pc The preconditioner.
+// \param label The label of the application.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function applies the preconditioner to a reference vector \a r and checks the residual
+// of the result \a z with respect to the factors, i.e. \f$ \|L U z - r\|_\infty \f$.
+*/
+template< typename PT >  // Type of the preconditioner
+void PreconditionerTest::checkApply( const PT& pc, const std::string& label ) const
+{
+   const VT r( reference( pc.size() ) );
+
+   VT z;
+   pc.apply( r, z );
+
+   const VT y( pc.upper() * z );
+   const VT w( y + pc.lower() * y );
+
+   blaze::real residual( 0 );
+   for( size_t i=0UL; i<r.size(); ++i )
+      residual = blaze::max( residual, std::fabs( w[i] - r[i] ) );
+
+   if( z.size() != r.size() || residual > 1E-12 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid application of the preconditioner\n"
+          << " Details:\n"
+          << "   Application = " << label << "\n"
+          << "   Size of the result = " << z.size() << "\n"
+          << "   Residual = " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running incomplete LU preconditioner test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_PRECONDITIONER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during incomplete LU preconditioner test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
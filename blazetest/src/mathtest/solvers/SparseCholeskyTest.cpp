@@ -0,0 +1,753 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/SparseCholeskyTest.cpp
+//  \brief Source file for the sparse Cholesky solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/Functions.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/solvers/SparseCholeskyTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the sparse Cholesky solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SparseCholeskyTest::SparseCholeskyTest()
+{
+   testFactorization();
+   testMultipleRHS();
+   testRefactorization();
+   testParallel();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the factorization of symmetric positive definite matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function factorizes a single element matrix, one-, two- and three-dimensional Laplacians
+// and a matrix with an irregular sparsity pattern, checks the structure of the factorizations
+// and solves for a single right-hand side. Additionally, it checks that the factorization does
+// not depend on the storage order of the symmetric matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseCholeskyTest::testFactorization()
+{
+   test_ = "Sparse Cholesky factorization";
+
+   std::vector<MT> matrices;
+   std::vector<std::string> labels;
+
+   matrices.push_back( laplacian( 1UL, 1UL, 2 ) );
+   labels.push_back( "Single element" );
+
+   matrices.push_back( laplacian( 100UL, 1UL, 0.01 ) );
+   labels.push_back( "1D Laplacian" );
+
+   matrices.push_back( laplacian( 30UL, 2UL, 0.01 ) );
+   labels.push_back( "2D Laplacian" );
+
+   matrices.push_back( laplacian( 10UL, 3UL, 0.01 ) );
+   labels.push_back( "3D Laplacian" );
+
+   matrices.push_back( irregular( 300UL ) );
+   labels.push_back( "Irregular pattern" );
+
+   for( size_t p=0UL; p<matrices.size(); ++p )
+   {
+      const MT& A( matrices[p] );
+      const size_t n( A.rows() );
+
+      const blaze::SparseCholesky cholesky( ( ST( A ) ) );
+      checkFactorization( cholesky, A, labels[p] );
+
+      const DT ref( reference( n, 1UL ) );
+      const VT b( A * blaze::column( ref, 0UL ) );
+
+      VT x;
+      cholesky.solve( b, x );
+      checkSolution( A, x, ref, labels[p] );
+
+      VT y( b );
+      cholesky.solve( y );
+
+      const blaze::SparseCholesky columnMajor(
+         ( blaze::SymmetricMatrix< blaze::CompressedMatrix<blaze::real,blaze::columnMajor> >( A ) ) );
+
+      VT z;
+      columnMajor.solve( b, z );
+
+      blaze::SparseCholesky direct;
+      direct.compute( A );
+
+      VT w;
+      direct.solve( b, w );
+
+      if( y != x || z != x || w != x ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inconsistent solutions\n"
+             << " Details:\n"
+             << "   Matrix = " << labels[p] << "\n"
+             << "   In-place solution differs = " << ( y != x ) << "\n"
+             << "   Column-major solution differs = " << ( z != x ) << "\n"
+             << "   Solution for the compressed matrix differs = " << ( w != x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution for multiple right-hand sides.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves for several numbers of right-hand sides at once and compares each
+// column of the solution with the solution for the corresponding single right-hand side.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseCholeskyTest::testMultipleRHS()
+{
+   test_ = "Sparse Cholesky solution for multiple right-hand sides";
+
+   const MT A( laplacian( 25UL, 2UL, 0.1 ) );
+   const size_t n( A.rows() );
+
+   const blaze::SparseCholesky cholesky( ( ST( A ) ) );
+
+   const size_t counts[] = { 1UL, 3UL, 16UL, 40UL };
+
+   for( size_t c=0UL; c<sizeof( counts )/sizeof( size_t ); ++c )
+   {
+      const size_t m( counts[c] );
+
+      std::ostringstream label;
+      label << m << " right-hand side(s)";
+
+      const DT ref( reference( n, m ) );
+      const DT B( A * ref );
+
+      DT X( B );
+      cholesky.solve( X );
+      checkSolution( A, X, ref, label.str() );
+
+      for( size_t j=0UL; j<m; ++j )
+      {
+         VT x;
+         cholesky.solve( VT( blaze::column( B, j ) ), x );
+
+         blaze::real difference( 0 );
+         for( size_t i=0UL; i<n; ++i )
+            difference = blaze::max( difference, std::fabs( x[i] - X(i,j) ) );
+
+         if( difference > 1E-13 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solution differs from the solution for a single right-hand side\n"
+                << " Details:\n"
+                << "   Number of right-hand sides = " << m << "\n"
+                << "   Column = " << j << "\n"
+                << "   Difference = " << difference << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   DT empty( n, 0UL );
+   cholesky.solve( empty );
+
+   if( empty.rows() != n || empty.columns() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution for zero right-hand sides\n"
+          << " Details:\n"
+          << "   Rows = " << empty.rows() << "\n"
+          << "   Columns = " << empty.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the numeric refactorization.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function refactorizes matrices with modified values and with a reduced sparsity pattern
+// based on a single symbolic analysis and compares the solutions with the solutions of a
+// complete factorization. Additionally, it checks that a sparsity pattern exceeding the
+// analyzed pattern and a matrix that is not positive definite are rejected without preventing
+// subsequent refactorizations. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void SparseCholeskyTest::testRefactorization()
+{
+   test_ = "Sparse Cholesky refactorization";
+
+   const MT A( laplacian( 20UL, 2UL, 0.5 ) );
+   const size_t n( A.rows() );
+   const DT ref( reference( n, 4UL ) );
+
+   blaze::SparseCholesky cholesky;
+   cholesky.analyze( ST( A ) );
+
+   const size_t supernodes( cholesky.supernodes() );
+   const size_t nonZeros  ( cholesky.nonZeros() );
+
+   for( size_t run=0UL; run<4UL; ++run )
+   {
+      std::ostringstream label;
+      label << "Refactorization " << run;
+
+      MT M( A );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( MT::Iterator element=M.begin(i); element!=M.end(i); ++element ) {
+            const size_t j( element->index() );
+            if( j == i )
+               element->value() = 5 + std::sin( blaze::real( i+run ) );
+            else
+               element->value() = -0.5 - 0.4 * std::cos( blaze::real( i+j+run ) );
+         }
+      }
+
+      if( run == 3UL ) {
+         for( size_t i=0UL; i+1UL<n; i+=3UL ) {
+            M.erase( i, i+1UL );
+            M.erase( i+1UL, i );
+         }
+      }
+
+      if( run == 2UL ) {
+         try {
+            cholesky.factorize( ST( -M ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Negative definite matrix accepted\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+
+      cholesky.factorize( ST( M ) );
+
+      if( cholesky.supernodes() != supernodes || cholesky.nonZeros() != nonZeros ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symbolic analysis modified by the refactorization\n"
+             << " Details:\n"
+             << "   Refactorization = " << run << "\n"
+             << "   Supernodes = " << cholesky.supernodes() << " (" << supernodes << ")\n"
+             << "   Non-zeros = " << cholesky.nonZeros() << " (" << nonZeros << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      DT X( M * ref );
+      cholesky.solve( X );
+      checkSolution( M, X, ref, label.str() );
+
+      if( run < 3UL ) {
+         const blaze::SparseCholesky fresh( ( ST( M ) ) );
+
+         DT Y( M * ref );
+         fresh.solve( Y );
+
+         if( X != Y ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Refactorization differs from a complete factorization\n"
+                << " Details:\n"
+                << "   Refactorization = " << run << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   MT D( 50UL, 50UL );
+   MT T( laplacian( 50UL, 1UL, 0.5 ) );
+   for( size_t i=0UL; i<50UL; ++i )
+      D(i,i) = 1 + blaze::real( i );
+
+   blaze::SparseCholesky diagonal( ( ST( D ) ) );
+
+   try {
+      diagonal.factorize( ST( T ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Sparsity pattern exceeding the analyzed pattern accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   D *= 2;
+   diagonal.factorize( ST( D ) );
+
+   const DT ref2( reference( 50UL, 2UL ) );
+   DT X( D * ref2 );
+   diagonal.solve( X );
+   checkSolution( D, X, ref2, "Diagonal matrix after a rejected pattern" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel factorization and solution.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function factorizes a two-dimensional Laplacian whose leaf levels exceed the SMP
+// threshold of the factorization with one to four threads and solves for a single and for
+// multiple right-hand sides. Since the supernodes of a level are independent of each other,
+// the solutions have to be identical for all numbers of threads. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void SparseCholeskyTest::testParallel()
+{
+   test_ = "Parallel sparse Cholesky factorization";
+
+   const MT A( laplacian( 120UL, 2UL, 0.01 ) );
+   const ST S( A );
+   const size_t n( A.rows() );
+
+   const DT ref( reference( n, 8UL ) );
+   const DT B( A * ref );
+   const VT b( blaze::column( B, 0UL ) );
+
+   DT Xserial;
+   VT xserial;
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      const blaze::SparseCholesky cholesky( S );
+
+      DT X( B );
+      cholesky.solve( X );
+      checkSolution( A, X, ref, "Multiple right-hand sides, " + label.str() );
+
+      VT x;
+      cholesky.solve( b, x );
+      checkSolution( A, x, ref, "Single right-hand side, " + label.str() );
+
+      if( threads == 1UL ) {
+         Xserial = X;
+         xserial = x;
+      }
+      else if( X != Xserial || x != xserial ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution depends on the number of threads\n"
+             << " Details:\n"
+             << "   Number of threads = " << threads << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the sparse Cholesky solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that non-square and indefinite matrices and right-hand sides of invalid
+// size are rejected. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseCholeskyTest::testErrors()
+{
+   test_ = "Sparse Cholesky error handling";
+
+   blaze::SparseCholesky cholesky;
+
+   try {
+      cholesky.analyze( MT( 3UL, 4UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-square matrix accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   MT I( 2UL, 2UL );
+   I(0,0) = 1;
+   I(0,1) = 2;
+   I(1,0) = 2;
+   I(1,1) = 1;
+
+   try {
+      cholesky.compute( ST( I ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Indefinite matrix accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   const MT A( laplacian( 4UL, 2UL, 0.1 ) );
+   cholesky.compute( ST( A ) );
+
+   try {
+      cholesky.factorize( ST( laplacian( 5UL, 2UL, 0.1 ) ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix of invalid size accepted for the refactorization\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   cholesky.factorize( ST( A ) );
+
+   try {
+      VT b( 15UL, 1 );
+      cholesky.solve( b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Right-hand side vector of invalid size accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      DT B( 17UL, 2UL, 1 );
+      cholesky.solve( B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Right-hand side matrix of invalid size accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the Laplacian on a one-, two- or three-dimensional grid with a diagonal shift.
+//
+// \param k The number of grid points per dimension.
+// \param d The number of dimensions.
+// \param shift The diagonal shift.
+// \return The symmetric positive definite system matrix of size \f$ k^d \times k^d \f$.
+*/
+SparseCholeskyTest::MT SparseCholeskyTest::laplacian( size_t k, size_t d, blaze::real shift )
+{
+   size_t strides[3] = { 1UL, k, k*k };
+   const size_t n( strides[d-1UL]*k );
+
+   MT A( n, n );
+   A.reserve( ( 2UL*d+1UL )*n );
+
+   for( size_t row=0UL; row<n; ++row )
+   {
+      for( size_t l=d; l>0UL; --l ) {
+         if( ( row / strides[l-1UL] ) % k > 0UL )
+            A.append( row, row-strides[l-1UL], -1 );
+      }
+
+      A.append( row, row, blaze::real( 2UL*d ) + shift );
+
+      for( size_t l=0UL; l<d; ++l ) {
+         if( ( row / strides[l] ) % k + 1UL < k )
+            A.append( row, row+strides[l], -1 );
+      }
+
+      A.finalize( row );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a symmetric positive definite matrix with an irregular sparsity pattern.
+//
+// \param n The size of the matrix.
+// \return The diagonally dominant system matrix.
+//
+// Each row is coupled to two scattered rows, whose couplings are mirrored to keep the matrix
+// symmetric. The diagonal elements dominate the sum of the magnitudes of all couplings.
+*/
+SparseCholeskyTest::MT SparseCholeskyTest::irregular( size_t n )
+{
+   MT A( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t j1( ( i*37UL + 11UL ) % n );
+      const size_t j2( ( i*i + 7UL ) % n );
+      if( j1 != i ) A(i,j1) = A(j1,i) = -0.5 - 0.3 * std::cos( blaze::real( i ) );
+      if( j2 != i ) A(i,j2) = A(j2,i) = -0.2 - 0.1 * std::sin( blaze::real( i ) );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      blaze::real sum( 0 );
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+         sum += std::fabs( element->value() );
+      A(i,i) = 1 + sum;
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a reference solution with the given number of columns.
+//
+// \param n The number of rows.
+// \param m The number of columns (i.e. right-hand sides).
+// \return The reference solution.
+*/
+SparseCholeskyTest::DT SparseCholeskyTest::reference( size_t n, size_t m )
+{
+   DT X( n, m );
+   for( size_t i=0UL; i<n; ++i )
+      for( size_t j=0UL; j<m; ++j )
+         X(i,j) = 1 + std::sin( blaze::real( i ) + 0.7 * blaze::real( j ) );
+   return X;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the structure of the given factorization.
+//
+// \param cholesky The factorization.
+// \param A The factorized matrix.
+// \param label The label of the factorized matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the permutation is a valid permutation of all rows, that the
+// numbers of supernodes and levels are consistent and that the number of stored elements of
+// the factor lies between the number of elements of the lower part of the matrix and the
+// number of elements of a dense lower triangular matrix.
+*/
+void SparseCholeskyTest::checkFactorization( const blaze::SparseCholesky& cholesky, const MT& A,
+                                             const std::string& label ) const
+{
+   const size_t n( A.rows() );
+   const blaze::PermutationVector& perm( cholesky.permutation() );
+
+   std::vector<bool> used( n, false );
+   bool permutation( perm.size() == n );
+
+   for( size_t i=0UL; permutation && i<n; ++i ) {
+      if( perm[i] >= n || used[perm[i]] ) permutation = false;
+      else used[perm[i]] = true;
+   }
+
+   size_t lower( 0UL );
+   for( size_t i=0UL; i<n; ++i )
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+         if( element->index() <= i ) ++lower;
+
+   if( !permutation || cholesky.size() != n || cholesky.supernodes() == 0UL ||
+       cholesky.supernodes() > n || cholesky.levels() == 0UL ||
+       cholesky.levels() > cholesky.supernodes() || cholesky.nonZeros() < lower ||
+       cholesky.nonZeros() > n*(n+1UL)/2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid factorization\n"
+          << " Details:\n"
+          << "   Matrix = " << label << "\n"
+          << "   Valid permutation = " << permutation << "\n"
+          << "   Size = " << cholesky.size() << " (" << n << ")\n"
+          << "   Supernodes = " << cholesky.supernodes() << "\n"
+          << "   Levels = " << cholesky.levels() << "\n"
+          << "   Non-zeros of the factor = " << cholesky.nonZeros() << "\n"
+          << "   Non-zeros of the lower part of the matrix = " << lower << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a solution for multiple right-hand sides against the reference solution.
+//
+// \param A The system matrix.
+// \param X The computed solution.
+// \param ref The reference solution.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void SparseCholeskyTest::checkSolution( const MT& A, const DT& X, const DT& ref,
+                                        const std::string& label ) const
+{
+   const DT R( A * X - A * ref );
+
+   blaze::real error( 0 ), residual( 0 );
+
+   if( X.rows() == ref.rows() && X.columns() == ref.columns() ) {
+      for( size_t i=0UL; i<X.rows(); ++i ) {
+         for( size_t j=0UL; j<X.columns(); ++j ) {
+            error    = blaze::max( error, std::fabs( X(i,j) - ref(i,j) ) );
+            residual = blaze::max( residual, std::fabs( R(i,j) ) );
+         }
+      }
+   }
+
+   if( X.rows() != ref.rows() || X.columns() != ref.columns() || error > 1E-9 || residual > 1E-11 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   Solution process = " << label << "\n"
+          << "   Size of the system = " << A.rows() << "\n"
+          << "   Size of the solution = " << X.rows() << "x" << X.columns() << "\n"
+          << "   Error = " << error << "\n"
+          << "   Residual = " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a solution for a single right-hand side against the reference solution.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param ref The reference solution in the first column.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void SparseCholeskyTest::checkSolution( const MT& A, const VT& x, const DT& ref,
+                                        const std::string& label ) const
+{
+   DT X( x.size(), 1UL );
+   blaze::column( X, 0UL ) = x;
+
+   checkSolution( A, X, DT( blaze::submatrix( ref, 0UL, 0UL, ref.rows(), 1UL ) ), label );
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse Cholesky solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_SPARSECHOLESKY_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse Cholesky solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,721 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/TriangularSolveTest.cpp
+//  \brief Source file for the triangular solve test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/Functions.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/solvers/TriangularSolveTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the triangular solve test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+TriangularSolveTest::TriangularSolveTest()
+{
+   testDense();
+   testSparse();
+   testScheduled();
+   testParallel();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the triangular solves with dense triangular matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves dense lower and upper triangular systems of both storage orders with
+// one and with multiple right-hand sides. The sizes of the systems cover a single element, a
+// single diagonal block and several diagonal blocks including a partial block. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TriangularSolveTest::testDense()
+{
+   test_ = "Dense triangular solves";
+
+   const size_t block( blaze::TRIANGULAR_BLOCK_SIZE );
+   const size_t sizes[] = { 1UL, block, 2UL*block+22UL };
+
+   for( size_t s=0UL; s<sizeof( sizes )/sizeof( size_t ); ++s )
+   {
+      const DMT M( denseLower( sizes[s] ) );
+
+      std::ostringstream size;
+      size << ", n = " << sizes[s];
+
+      {
+         const blaze::LowerMatrix<DMT> L( M );
+         checkTrsv( L, "Row-major lower matrix" + size.str() );
+         checkTrsm<blaze::rowMajor>( L, "Row-major lower matrix" + size.str() );
+         checkTrsm<blaze::columnMajor>( L, "Row-major lower matrix" + size.str() );
+      }
+
+      {
+         const blaze::LowerMatrix<TDMT> L( M );
+         checkTrsv( L, "Column-major lower matrix" + size.str() );
+         checkTrsm<blaze::rowMajor>( L, "Column-major lower matrix" + size.str() );
+         checkTrsm<blaze::columnMajor>( L, "Column-major lower matrix" + size.str() );
+      }
+
+      {
+         const blaze::UpperMatrix<DMT> U( blaze::trans( M ) );
+         checkTrsv( U, "Row-major upper matrix" + size.str() );
+         checkTrsm<blaze::rowMajor>( U, "Row-major upper matrix" + size.str() );
+         checkTrsm<blaze::columnMajor>( U, "Row-major upper matrix" + size.str() );
+      }
+
+      {
+         const blaze::UpperMatrix<TDMT> U( blaze::trans( M ) );
+         checkTrsv( U, "Column-major upper matrix" + size.str() );
+         checkTrsm<blaze::rowMajor>( U, "Column-major upper matrix" + size.str() );
+         checkTrsm<blaze::columnMajor>( U, "Column-major upper matrix" + size.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sequential triangular solves with sparse triangular matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves sparse lower and upper triangular systems of both storage orders with
+// one and with multiple right-hand sides of both storage orders by sequential substitution.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TriangularSolveTest::testSparse()
+{
+   test_ = "Sparse triangular solves";
+
+   const SMT M( sparseLower( 600UL, 40UL ) );
+
+   {
+      const blaze::LowerMatrix<SMT> L( M );
+      checkTrsv( L, "Row-major lower matrix" );
+      checkTrsm<blaze::rowMajor>( L, "Row-major lower matrix" );
+      checkTrsm<blaze::columnMajor>( L, "Row-major lower matrix" );
+   }
+
+   {
+      const blaze::LowerMatrix<TSMT> L( M );
+      checkTrsv( L, "Column-major lower matrix" );
+      checkTrsm<blaze::rowMajor>( L, "Column-major lower matrix" );
+      checkTrsm<blaze::columnMajor>( L, "Column-major lower matrix" );
+   }
+
+   {
+      const blaze::UpperMatrix<SMT> U( blaze::trans( M ) );
+      checkTrsv( U, "Row-major upper matrix" );
+      checkTrsm<blaze::rowMajor>( U, "Row-major upper matrix" );
+      checkTrsm<blaze::columnMajor>( U, "Row-major upper matrix" );
+   }
+
+   {
+      const blaze::UpperMatrix<TSMT> U( blaze::trans( M ) );
+      checkTrsv( U, "Column-major upper matrix" );
+      checkTrsm<blaze::rowMajor>( U, "Column-major upper matrix" );
+      checkTrsm<blaze::columnMajor>( U, "Column-major upper matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the level-scheduled triangular solves.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves row-major sparse lower and upper triangular systems with one and with
+// multiple right-hand sides by means of level schedules, which are reused after a change of
+// the values of the matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void TriangularSolveTest::testScheduled()
+{
+   test_ = "Level-scheduled triangular solves";
+
+   const SMT M( sparseLower( 600UL, 40UL ) );
+
+   blaze::LowerMatrix<SMT> L( M );
+   blaze::UpperMatrix<SMT> U( blaze::trans( M ) );
+
+   const blaze::LevelSchedule lower( L );
+   const blaze::LevelSchedule upper( U );
+
+   if( lower.isUpper() || !upper.isUpper() || lower.levels() != 15UL || upper.levels() != 15UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid level schedules\n"
+          << " Details:\n"
+          << "   Levels of the lower schedule = " << lower.levels() << "\n"
+          << "   Levels of the upper schedule = " << upper.levels() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t run=0UL; run<2UL; ++run )
+   {
+      const std::string label( ( run == 0UL )?( "" ):( ", modified values" ) );
+
+      checkTrsv( L, lower, "Lower matrix" + label );
+      checkTrsm<blaze::rowMajor>( L, lower, "Lower matrix" + label );
+      checkTrsm<blaze::columnMajor>( L, lower, "Lower matrix" + label );
+
+      checkTrsv( U, upper, "Upper matrix" + label );
+      checkTrsm<blaze::rowMajor>( U, upper, "Upper matrix" + label );
+      checkTrsm<blaze::columnMajor>( U, upper, "Upper matrix" + label );
+
+      for( size_t i=0UL; i<M.rows(); ++i ) {
+         L(i,i) = 3 + std::cos( blaze::real( i ) );
+         U(i,i) = 1 + 0.5 * std::cos( blaze::real( i ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel triangular solves.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly solves sparse triangular systems whose levels exceed the SMP
+// threshold of the triangular solves with one to four threads. Since the computation of each
+// unknown is independent of the order of the rows, the results of the level-scheduled solves
+// have to be identical to the results of the sequential solves. Additionally, dense triangular
+// systems exceeding the SMP thresholds of the dense multiplications are solved. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TriangularSolveTest::testParallel()
+{
+   test_ = "Parallel triangular solves";
+
+   const size_t width( blaze::max( blaze::SMP_TRSV_THRESHOLD, 64UL ) );
+   const size_t n( 4UL*width );
+
+   const SMT M( sparseLower( n, width ) );
+   const blaze::LowerMatrix<SMT> L( M );
+   const blaze::UpperMatrix<SMT> U( blaze::trans( M ) );
+
+   const blaze::LevelSchedule lower( L );
+   const blaze::LevelSchedule upper( U );
+
+   const DMT R( reference( n, 3UL ) );
+   const VT  r( blaze::column( R, 0UL ) );
+
+   VT xl( L * r ), xu( U * r );
+   blaze::trsv( L, xl );
+   blaze::trsv( U, xu );
+
+   DMT Xl( L * R ), Xu( U * R );
+   blaze::trsm( L, Xl );
+   blaze::trsm( U, Xu );
+
+   const DMT D( denseLower( 700UL ) );
+   const blaze::LowerMatrix<DMT> DL( D );
+   const blaze::UpperMatrix<TDMT> DU( blaze::trans( D ) );
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      std::ostringstream label;
+      label << threads << " thread(s)";
+
+      for( size_t run=0UL; run<5UL; ++run )
+      {
+         VT yl( L * r ), yu( U * r );
+         blaze::trsv( L, yl, lower );
+         blaze::trsv( U, yu, upper );
+
+         DMT Yl( L * R ), Yu( U * R );
+         blaze::trsm( L, Yl, lower );
+         blaze::trsm( U, Yu, upper );
+
+         if( yl != xl || yu != xu || Yl != Xl || Yu != Xu ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Level-scheduled solution differs from the sequential solution\n"
+                << " Details:\n"
+                << "   Number of threads = " << threads << "\n"
+                << "   Run = " << run << "\n"
+                << "   Lower trsv error = " << maxNorm( VT( yl - xl ) ) << "\n"
+                << "   Upper trsv error = " << maxNorm( VT( yu - xu ) ) << "\n"
+                << "   Lower trsm error = " << maxNorm( DMT( Yl - Xl ) ) << "\n"
+                << "   Upper trsm error = " << maxNorm( DMT( Yu - Xu ) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkTrsv( DL, "Dense lower matrix, " + label.str() );
+      checkTrsm<blaze::columnMajor>( DL, "Dense lower matrix, " + label.str() );
+      checkTrsv( DU, "Dense upper matrix, " + label.str() );
+      checkTrsm<blaze::rowMajor>( DU, "Dense upper matrix, " + label.str() );
+   }
+
+   checkTrsv( L, lower, "Sparse lower matrix" );
+   checkTrsv( U, upper, "Sparse upper matrix" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the triangular solves.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that right-hand sides of invalid size and level schedules of the wrong
+// kind or size are rejected. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void TriangularSolveTest::testErrors()
+{
+   test_ = "Triangular solve error handling";
+
+   const blaze::LowerMatrix<DMT> DL( denseLower( 5UL ) );
+   const blaze::LowerMatrix<SMT> SL( sparseLower( 6UL, 2UL ) );
+   const blaze::UpperMatrix<SMT> SU( blaze::trans( sparseLower( 6UL, 2UL ) ) );
+
+   const blaze::LevelSchedule lower( SL );
+   const blaze::LevelSchedule upper( SU );
+   const blaze::LevelSchedule small( blaze::LowerMatrix<SMT>( sparseLower( 4UL, 2UL ) ) );
+
+   VT b( 4UL, 1 );
+   DMT B( 4UL, 2UL, 1 );
+   VT c( 6UL, 1 );
+
+   try {
+      blaze::trsv( DL, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Vector of invalid size accepted for a dense matrix\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::trsm( DL, B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix of invalid size accepted for a dense matrix\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::trsv( SU, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Vector of invalid size accepted for a sparse matrix\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::trsm( SL, B, lower );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix of invalid size accepted for a level-scheduled solve\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::trsv( SL, c, upper );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Upper level schedule accepted for a lower matrix\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::trsv( SU, c, lower );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Lower level schedule accepted for an upper matrix\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::trsv( SL, c, small );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Level schedule of invalid size accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a dense lower triangular matrix.
+//
+// \param n The size of the matrix.
+// \return The lower triangular matrix with dominant diagonal.
+*/
+TriangularSolveTest::DMT TriangularSolveTest::denseLower( size_t n )
+{
+   DMT M( n, n, 0 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j )
+         M(i,j) = 0.5 * std::cos( blaze::real( i*j+1UL ) ) / blaze::real( n );
+      M(i,i) = 2 + std::sin( blaze::real( i ) );
+   }
+
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a sparse lower triangular matrix with levels of the given width.
+//
+// \param n The size of the matrix (a multiple of \a width).
+// \param width The number of rows per level.
+// \return The row-major lower triangular matrix.
+//
+// Each row of the block \a b of \a width consecutive rows depends on the row at the same
+// position and on one of the last 64 rows of block \a b-1, and on a scattered row of all
+// preceding blocks. Thus the matrix has \a n/width levels of \a width rows each.
+*/
+TriangularSolveTest::SMT TriangularSolveTest::sparseLower( size_t n, size_t width )
+{
+   SMT M( n, n );
+   M.reserve( 4UL*n );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t block( i / width );
+
+      if( block > 0UL )
+      {
+         const size_t previous( ( block-1UL )*width );
+         const size_t j1( i - width );
+         const size_t j2( previous + width - 1UL - ( i*7919UL ) % blaze::min( width, 64UL ) );
+         const size_t j3( ( i*31UL ) % previous );
+
+         if( block > 1UL && j3 < blaze::min( j1, j2 ) ) M.append( i, j3, -0.1 );
+         M.append( i, blaze::min( j1, j2 ), -0.3 );
+         if( j1 != j2 ) M.append( i, blaze::max( j1, j2 ), -0.2 );
+      }
+
+      M.append( i, i, 2 + std::sin( blaze::real( i ) ) );
+      M.finalize( i );
+   }
+
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a reference solution with the given number of columns.
+//
+// \param n The number of rows.
+// \param m The number of columns (i.e. right-hand sides).
+// \return The reference solution.
+*/
+TriangularSolveTest::DMT TriangularSolveTest::reference( size_t n, size_t m )
+{
+   DMT X( n, m );
+   for( size_t i=0UL; i<n; ++i )
+      for( size_t j=0UL; j<m; ++j )
+         X(i,j) = 1 + std::sin( blaze::real( i ) + 0.7 * blaze::real( j ) );
+   return X;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum norm of the given vector.
+//
+// \param v The vector.
+// \return The maximum absolute value of all elements.
+*/
+blaze::real TriangularSolveTest::maxNorm( const VT& v )
+{
+   blaze::real norm( 0 );
+   for( size_t i=0UL; i<v.size(); ++i )
+      norm = blaze::max( norm, std::fabs( v[i] ) );
+   return norm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum norm of the given matrix.
+//
+// \param M The matrix.
+// \return The maximum absolute value of all elements.
+*/
+template< bool SO >  // Storage order of the matrix
+blaze::real TriangularSolveTest::maxNorm( const blaze::DynamicMatrix<ET,SO>& M )
+{
+   blaze::real norm( 0 );
+   for( size_t i=0UL; i<M.rows(); ++i )
+      for( size_t j=0UL; j<M.columns(); ++j )
+         norm = blaze::max( norm, std::fabs( M(i,j) ) );
+   return norm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the sequential trsv() function for the given triangular matrix.
+//
+// \param A The triangular matrix.
+// \param label The label of the triangular matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename AT >  // Type of the triangular matrix
+void TriangularSolveTest::checkTrsv( const AT& A, const std::string& label ) const
+{
+   const VT ref( blaze::column( reference( A.rows(), 1UL ), 0UL ) );
+   const VT b( A * ref );
+
+   VT x( b );
+   blaze::trsv( A, x );
+
+   checkSolution( A, x, b, ref, "trsv, " + label );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the level-scheduled trsv() function for the given triangular matrix.
+//
+// \param A The row-major sparse triangular matrix.
+// \param schedule The level schedule of \a A.
+// \param label The label of the triangular matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename AT >  // Type of the triangular matrix
+void TriangularSolveTest::checkTrsv( const AT& A, const blaze::LevelSchedule& schedule,
+                                     const std::string& label ) const
+{
+   const VT ref( blaze::column( reference( A.rows(), 1UL ), 0UL ) );
+   const VT b( A * ref );
+
+   VT x( b );
+   blaze::trsv( A, x, schedule );
+
+   checkSolution( A, x, b, ref, "Level-scheduled trsv, " + label );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the sequential trsm() function for the given triangular matrix.
+//
+// \param A The triangular matrix.
+// \param label The label of the triangular matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The right-hand side matrix with five columns has the storage order \a SO.
+*/
+template< bool SO          // Storage order of the right-hand side matrix
+        , typename AT >    // Type of the triangular matrix
+void TriangularSolveTest::checkTrsm( const AT& A, const std::string& label ) const
+{
+   typedef blaze::DynamicMatrix<ET,SO>  XT;
+
+   const XT ref( reference( A.rows(), 5UL ) );
+   const XT B( A * ref );
+
+   XT X( B );
+   blaze::trsm( A, X );
+
+   checkSolution( A, X, B, ref, ( SO ? "trsm (column-major), " : "trsm (row-major), " ) + label );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the level-scheduled trsm() function for the given triangular matrix.
+//
+// \param A The row-major sparse triangular matrix.
+// \param schedule The level schedule of \a A.
+// \param label The label of the triangular matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The right-hand side matrix with five columns has the storage order \a SO.
+*/
+template< bool SO          // Storage order of the right-hand side matrix
+        , typename AT >    // Type of the triangular matrix
+void TriangularSolveTest::checkTrsm( const AT& A, const blaze::LevelSchedule& schedule,
+                                     const std::string& label ) const
+{
+   typedef blaze::DynamicMatrix<ET,SO>  XT;
+
+   const XT ref( reference( A.rows(), 5UL ) );
+   const XT B( A * ref );
+
+   XT X( B );
+   blaze::trsm( A, X, schedule );
+
+   checkSolution( A, X, B, ref, std::string( SO ? "Level-scheduled trsm (column-major), "
+                                                : "Level-scheduled trsm (row-major), " ) + label );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a computed solution against its residual and the reference solution.
+//
+// \param A The triangular matrix.
+// \param X The computed solution.
+// \param B The right-hand side.
+// \param ref The reference solution.
+// \param label The label of the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename AT    // Type of the triangular matrix
+        , typename XT >  // Type of the solution
+void TriangularSolveTest::checkSolution( const AT& A, const XT& X, const XT& B, const XT& ref,
+                                         const std::string& label ) const
+{
+   const blaze::real error   ( maxNorm( XT( X - ref ) ) );
+   const blaze::real residual( maxNorm( XT( A * X - B ) ) );
+
+   if( error > 1E-12 || residual > 1E-12 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   Solution process = " << label << "\n"
+          << "   Size of the system = " << A.rows() << "\n"
+          << "   Error = " << error << "\n"
+          << "   Residual = " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running triangular solve test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_TRIANGULARSOLVE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during triangular solve test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
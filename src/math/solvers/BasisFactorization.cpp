@@ -0,0 +1,959 @@
+//=================================================================================================
+/*!
+//  \file src/math/solvers/BasisFactorization.cpp
+//  \brief Source file for the sparse LU factorization of a simplex basis
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <blaze/math/solvers/BasisFactorization.h>
+#include <blaze/util/Assert.h>
+
+
+namespace blaze {
+
+namespace {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS AND CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The relative threshold of the pivot elements.
+//
+// A pivot candidate has to be at least this fraction of the element of largest magnitude of its
+// column within the active submatrix.
+*/
+const real pivotThreshold = real( 0.1 );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The number of rows and columns searched for a Markowitz pivot.
+*/
+const size_t searchLimit = 4UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The inverse of the relative number of non-zero elements of a hypersparse right-hand side.
+//
+// Solves with right-hand sides with at most \f$ n / 10 \f$ non-zero elements are restricted to
+// the pattern of the solution by means of depth-first searches.
+*/
+const size_t hypersparseRatio = 10UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserts an item into the doubly linked list of the given count.
+//
+// \param head The heads of the lists.
+// \param next The successors within the lists.
+// \param prev The predecessors within the lists.
+// \param item The item to be inserted.
+// \param count The count of the item.
+// \return void
+*/
+inline void link( std::vector<size_t>& head, std::vector<size_t>& next,
+                  std::vector<size_t>& prev, size_t item, size_t count )
+{
+   const size_t none( next.size() );
+
+   next[item] = head[count];
+   prev[item] = none;
+   if( head[count] != none )
+      prev[head[count]] = item;
+   head[count] = item;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes an item from the doubly linked list of the given count.
+//
+// \param head The heads of the lists.
+// \param next The successors within the lists.
+// \param prev The predecessors within the lists.
+// \param item The item to be removed.
+// \param count The count of the item.
+// \return void
+*/
+inline void unlink( std::vector<size_t>& head, std::vector<size_t>& next,
+                    std::vector<size_t>& prev, size_t item, size_t count )
+{
+   const size_t none( next.size() );
+
+   if( prev[item] != none )
+      next[prev[item]] = next[item];
+   else
+      head[count] = next[item];
+
+   if( next[item] != none )
+      prev[next[item]] = prev[item];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the transpose of a compressed sparse matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \param Ap The offsets of the matrix.
+// \param Ai The indices of the matrix.
+// \param Ax The values of the matrix.
+// \param Tp The resulting offsets of the transpose.
+// \param Ti The resulting indices of the transpose.
+// \param Tx The resulting values of the transpose.
+// \return void
+*/
+void transpose( size_t n, const std::vector<size_t>& Ap, const std::vector<size_t>& Ai,
+                const std::vector<real>& Ax, std::vector<size_t>& Tp,
+                std::vector<size_t>& Ti, std::vector<real>& Tx )
+{
+   Tp.assign( n+1UL, 0UL );
+   Ti.resize( Ai.size() );
+   Tx.resize( Ax.size() );
+
+   for( size_t p=0UL; p<Ai.size(); ++p )
+      ++Tp[Ai[p]+1UL];
+   for( size_t i=0UL; i<n; ++i )
+      Tp[i+1UL] += Tp[i];
+
+   std::vector<size_t> next( Tp.begin(), Tp.end()-1 );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t p=Ap[j]; p<Ap[j+1UL]; ++p ) {
+         const size_t q( next[Ai[p]]++ );
+         Ti[q] = j;
+         Tx[q] = Ax[p];
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the BasisFactorization class.
+*/
+BasisFactorization::BasisFactorization()
+   : n_         ( 0 )  // The size of the basis
+   , Lp_        ()     // The column offsets of the strictly lower factor
+   , Li_        ()     // The row indices of the strictly lower factor
+   , Lx_        ()     // The values of the strictly lower factor
+   , Ltp_       ()     // The row offsets of the strictly lower factor
+   , Lti_       ()     // The column indices of the strictly lower factor
+   , Ltx_       ()     // The row-wise values of the strictly lower factor
+   , Up_        ()     // The column offsets of the strictly upper factor
+   , Ui_        ()     // The row indices of the strictly upper factor
+   , Ux_        ()     // The values of the strictly upper factor
+   , Utp_       ()     // The row offsets of the strictly upper factor
+   , Uti_       ()     // The column indices of the strictly upper factor
+   , Utx_       ()     // The row-wise values of the strictly upper factor
+   , Ud_        ()     // The diagonal of the upper factor
+   , pinv_      ()     // The row permutation
+   , prow_      ()     // The inverse row permutation
+   , order_     ()     // The column permutation
+   , qinv_      ()     // The inverse column permutation
+   , etaP_      ()     // The offsets of the eta vectors
+   , etaR_      ()     // The pivot positions of the eta vectors
+   , etaD_      ()     // The pivot values of the eta vectors
+   , etaI_      ()     // The off-pivot indices of the eta vectors
+   , etaX_      ()     // The off-pivot values of the eta vectors
+   , colIndices_()     // The row indices of the active submatrix
+   , colValues_ ()     // The values of the active submatrix
+   , rowIndices_()     // The column indices of the active submatrix
+   , colMax_    ()     // Cached column maxima of the active submatrix
+   , colHead_   ()     // Heads of the column lists by number of non-zero elements
+   , colNext_   ()     // Successors within the column lists
+   , colPrev_   ()     // Predecessors within the column lists
+   , rowHead_   ()     // Heads of the row lists by number of non-zero elements
+   , rowNext_   ()     // Successors within the row lists
+   , rowPrev_   ()     // Predecessors within the row lists
+   , stack_     ()     // Stack and output of the depth-first search
+   , pstack_    ()     // Position stack of the depth-first search
+   , pattern_   ()     // Start nodes of the depth-first search
+   , marker_    ()     // Visit markers of the depth-first search
+   , stamp_     ( 0 )  // The current visit stamp
+   , work_      ()     // Dense work vector of the solves
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the sparse LU factorization of the given basis matrix.
+//
+// \param B The column-major basis matrix.
+// \return \a true if the factorization succeeded, \a false if the basis is singular.
+//
+// This function computes the factorization \f$ P B Q = L U \f$ by Gaussian elimination on the
+// active submatrix, which is stored both column-wise (with values) and row-wise (pattern only).
+// The rows and columns of the active submatrix are kept in lists by their number of non-zero
+// elements, which allows to select the threshold Markowitz pivot of each elimination step by
+// inspecting a few short rows and columns only (see selectPivot()). The pivot column yields a
+// column of \f$ L \f$, the pivot row a row of \f$ U \f$, and the rank-one update of the remaining
+// active submatrix introduces the fill-in. All previous updates are discarded.
+*/
+bool BasisFactorization::factor( const CompressedMatrix<real,true>& B )
+{
+   BLAZE_USER_ASSERT( B.rows() == B.columns(), "Non-square basis matrix detected" );
+
+   const size_t n( B.columns() );
+   const size_t none( n );
+
+   n_ = n;
+
+   // Initializing the active submatrix
+   colIndices_.resize( n );
+   colValues_.resize( n );
+   rowIndices_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i )
+      rowIndices_[i].clear();
+
+   for( size_t j=0UL; j<n; ++j ) {
+      colIndices_[j].clear();
+      colValues_[j].clear();
+      for( CompressedMatrix<real,true>::ConstIterator element=B.begin(j); element!=B.end(j); ++element ) {
+         if( element->value() == real(0) ) continue;
+         colIndices_[j].push_back( element->index() );
+         colValues_[j].push_back( element->value() );
+         rowIndices_[element->index()].push_back( j );
+      }
+   }
+
+   colMax_.assign( n, real(-1) );
+   colHead_.assign( n+1UL, none );
+   colNext_.assign( n, none );
+   colPrev_.assign( n, none );
+   rowHead_.assign( n+1UL, none );
+   rowNext_.assign( n, none );
+   rowPrev_.assign( n, none );
+
+   for( size_t j=0UL; j<n; ++j )
+      link( colHead_, colNext_, colPrev_, j, colIndices_[j].size() );
+   for( size_t i=0UL; i<n; ++i )
+      link( rowHead_, rowNext_, rowPrev_, i, rowIndices_[i].size() );
+
+   pinv_.assign( n, none );
+   prow_.assign( n, none );
+   order_.assign( n, none );
+   qinv_.assign( n, none );
+   Ud_.resize( n );
+
+   Lp_.assign( n+1UL, 0UL );
+   Li_.clear(); Lx_.clear();
+   Utp_.assign( n+1UL, 0UL );
+   Uti_.clear(); Utx_.clear();
+
+   etaP_.assign( 1UL, 0UL );
+   etaR_.clear(); etaD_.clear();
+   etaI_.clear(); etaX_.clear();
+
+   stack_.resize( 2UL*n );
+   pstack_.resize( n );
+   pattern_.reserve( n );
+   marker_.assign( n, 0UL );
+   stamp_ = 0UL;
+   work_.resize( n, false );
+   work_ = real( 0 );
+
+   std::vector<size_t>& pos( pstack_ );  // Positions within the current column of the update
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t p, q;
+
+      if( !selectPivot( p, q ) ) {
+         Ud_.clear();
+         return false;
+      }
+
+      unlink( colHead_, colNext_, colPrev_, q, colIndices_[q].size() );
+      unlink( rowHead_, rowNext_, rowPrev_, p, rowIndices_[p].size() );
+
+      pinv_[p] = k;
+      prow_[k] = p;
+      order_[k] = q;
+      qinv_[q] = k;
+
+      // Extracting the column of the lower factor and removing the pivot column from its rows
+      std::vector<size_t>& cidx( colIndices_[q] );
+      std::vector<real>&   cval( colValues_[q] );
+
+      real pivot( 0 );
+      for( size_t t=0UL; t<cidx.size(); ++t ) {
+         if( cidx[t] == p ) pivot = cval[t];
+      }
+
+      BLAZE_INTERNAL_ASSERT( pivot != real(0), "Zero pivot detected" );
+
+      Ud_[k] = pivot;
+      Lp_[k] = Li_.size();
+
+      for( size_t t=0UL; t<cidx.size(); ++t )
+      {
+         const size_t i( cidx[t] );
+         if( i == p ) continue;
+
+         Li_.push_back( i );
+         Lx_.push_back( cval[t] / pivot );
+
+         std::vector<size_t>& ridx( rowIndices_[i] );
+         unlink( rowHead_, rowNext_, rowPrev_, i, ridx.size() );
+         *std::find( ridx.begin(), ridx.end(), q ) = ridx.back();
+         ridx.pop_back();
+      }
+
+      cidx.clear();
+      cval.clear();
+
+      // Extracting the row of the upper factor and removing the pivot row from its columns
+      Utp_[k] = Uti_.size();
+
+      for( size_t t=0UL; t<rowIndices_[p].size(); ++t )
+      {
+         const size_t j( rowIndices_[p][t] );
+         if( j == q ) continue;
+
+         std::vector<size_t>& idx( colIndices_[j] );
+         std::vector<real>&   val( colValues_[j] );
+         unlink( colHead_, colNext_, colPrev_, j, idx.size() );
+
+         const size_t u( std::find( idx.begin(), idx.end(), p ) - idx.begin() );
+         Uti_.push_back( j );
+         Utx_.push_back( val[u] );
+         idx[u] = idx.back(); idx.pop_back();
+         val[u] = val.back(); val.pop_back();
+         colMax_[j] = real(-1);
+      }
+
+      rowIndices_[p].clear();
+
+      // Rank-one update of the active submatrix
+      const size_t lbegin( Lp_[k] );
+      const size_t lend  ( Li_.size() );
+
+      for( size_t u=Utp_[k]; u<Uti_.size(); ++u )
+      {
+         const size_t j ( Uti_[u] );
+         const real   uj( Utx_[u] );
+
+         std::vector<size_t>& idx( colIndices_[j] );
+         std::vector<real>&   val( colValues_[j] );
+
+         ++stamp_;
+         for( size_t t=0UL; t<idx.size(); ++t ) {
+            marker_[idx[t]] = stamp_;
+            pos[idx[t]] = t;
+         }
+
+         for( size_t l=lbegin; l<lend; ++l ) {
+            const size_t i( Li_[l] );
+            if( marker_[i] == stamp_ ) {
+               val[pos[i]] -= Lx_[l] * uj;
+            }
+            else {
+               idx.push_back( i );
+               val.push_back( -Lx_[l] * uj );
+               rowIndices_[i].push_back( j );
+            }
+         }
+
+         link( colHead_, colNext_, colPrev_, j, idx.size() );
+      }
+
+      for( size_t l=lbegin; l<lend; ++l )
+         link( rowHead_, rowNext_, rowPrev_, Li_[l], rowIndices_[Li_[l]].size() );
+   }
+
+   Lp_[n] = Li_.size();
+   Utp_[n] = Uti_.size();
+
+   // Converting the indices of the factors to pivot positions
+   for( size_t p=0UL; p<Li_.size(); ++p )
+      Li_[p] = pinv_[Li_[p]];
+   for( size_t p=0UL; p<Uti_.size(); ++p )
+      Uti_[p] = qinv_[Uti_[p]];
+
+   // Setting up the row-wise lower and the column-wise upper factor
+   transpose( n, Lp_, Li_, Lx_, Ltp_, Lti_, Ltx_ );
+   transpose( n, Utp_, Uti_, Utx_, Up_, Ui_, Ux_ );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replaces a single column of the basis.
+//
+// \param r The position of the replaced basis column.
+// \param alpha The solution \f$ B^{-1} a \f$ for the new basis column \f$ a \f$ (see ftran()).
+// \return void
+//
+// This function appends the eta matrix of the column exchange to the factorization. The new
+// basis column is not required explicitly since its representation with respect to the current
+// basis is given by \a alpha.
+*/
+void BasisFactorization::update( size_t r, const VecN& alpha )
+{
+   BLAZE_USER_ASSERT( r < n_, "Invalid basis position" );
+   BLAZE_USER_ASSERT( alpha.size() == n_, "Invalid vector size" );
+   BLAZE_USER_ASSERT( alpha[r] != real(0), "Singular column exchange detected" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      if( i != r && alpha[i] != real(0) ) {
+         etaI_.push_back( i );
+         etaX_.push_back( alpha[i] );
+      }
+   }
+
+   etaR_.push_back( r );
+   etaD_.push_back( alpha[r] );
+   etaP_.push_back( etaI_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replaces a single column of the basis.
+//
+// \param r The position of the replaced basis column.
+// \param alpha The solution \f$ B^{-1} a \f$ for the new basis column \f$ a \f$ (see ftran()).
+// \param indices The indices of all non-zero elements of \a alpha.
+// \return void
+//
+// In contrast to the update() function without indices, the cost of this function is
+// proportional to the number of non-zero elements of \a alpha.
+*/
+void BasisFactorization::update( size_t r, const VecN& alpha, const std::vector<size_t>& indices )
+{
+   BLAZE_USER_ASSERT( r < n_, "Invalid basis position" );
+   BLAZE_USER_ASSERT( alpha.size() == n_, "Invalid vector size" );
+   BLAZE_USER_ASSERT( alpha[r] != real(0), "Singular column exchange detected" );
+
+   for( size_t p=0UL; p<indices.size(); ++p ) {
+      const size_t i( indices[p] );
+      if( i != r && alpha[i] != real(0) ) {
+         etaI_.push_back( i );
+         etaX_.push_back( alpha[i] );
+      }
+   }
+
+   etaR_.push_back( r );
+   etaD_.push_back( alpha[r] );
+   etaP_.push_back( etaI_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves \f$ B y = x \f$ with the current basis (forward transformation).
+//
+// \param x The right-hand side on input, the solution \f$ y = B^{-1} x \f$ on output.
+// \return void
+*/
+void BasisFactorization::ftran( VecN& x ) const
+{
+   BLAZE_USER_ASSERT( x.size() == n_, "Invalid vector size" );
+
+   // Applying the row permutation
+   for( size_t i=0UL; i<n_; ++i )
+      work_[pinv_[i]] = x[i];
+
+   // Forward substitution with the unit lower factor
+   for( size_t k=0UL; k<n_; ++k ) {
+      const real wk( work_[k] );
+      if( wk == real(0) ) continue;
+      for( size_t p=Lp_[k]; p<Lp_[k+1UL]; ++p )
+         work_[Li_[p]] -= Lx_[p] * wk;
+   }
+
+   // Backward substitution with the upper factor
+   for( size_t k=n_; k-->0UL; ) {
+      if( work_[k] == real(0) ) continue;
+      const real wk( work_[k] /= Ud_[k] );
+      for( size_t p=Up_[k]; p<Up_[k+1UL]; ++p )
+         work_[Ui_[p]] -= Ux_[p] * wk;
+   }
+
+   // Applying the column permutation
+   for( size_t k=0UL; k<n_; ++k ) {
+      x[order_[k]] = work_[k];
+      work_[k] = real(0);
+   }
+
+   // Applying the eta matrices in order of their creation
+   for( size_t e=0UL; e<etaR_.size(); ++e ) {
+      const size_t r( etaR_[e] );
+      const real xr( x[r] /= etaD_[e] );
+      if( xr == real(0) ) continue;
+      for( size_t p=etaP_[e]; p<etaP_[e+1UL]; ++p )
+         x[etaI_[p]] -= etaX_[p] * xr;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves \f$ B y = x \f$ for a sparse right-hand side (forward transformation).
+//
+// \param x The right-hand side on input, the solution \f$ y = B^{-1} x \f$ on output.
+// \param indices The indices of the non-zero elements of \a x on input and of \a y on output.
+// \return void
+//
+// On input, \a indices has to contain the indices of all non-zero elements of \a x without
+// duplicates. On output, it contains the indices of all elements of the solution that might be
+// non-zero, i.e. all other elements of \a x are guaranteed to be zero. For hypersparse right-hand
+// sides the triangular solves are restricted to the nonzero pattern of the solution, otherwise
+// the dense ftran() function is used and the indices are recomputed.
+*/
+void BasisFactorization::ftran( VecN& x, std::vector<size_t>& indices ) const
+{
+   BLAZE_USER_ASSERT( x.size() == n_, "Invalid vector size" );
+
+   const size_t n( n_ );
+
+   if( indices.size()*hypersparseRatio > n ) {
+      ftran( x );
+      indices.clear();
+      for( size_t i=0UL; i<n; ++i ) {
+         if( x[i] != real(0) ) indices.push_back( i );
+      }
+      return;
+   }
+
+   // Applying the row permutation
+   pattern_.clear();
+   for( size_t p=0UL; p<indices.size(); ++p ) {
+      const size_t i( indices[p] );
+      work_[pinv_[i]] = x[i];
+      x[i] = real(0);
+      pattern_.push_back( pinv_[i] );
+   }
+
+   // Forward substitution with the unit lower factor
+   size_t top( reach( Lp_, Li_, pattern_.size() ) );
+
+   for( size_t s=top; s<n; ++s ) {
+      const size_t k( stack_[s] );
+      const real wk( work_[k] );
+      if( wk == real(0) ) continue;
+      for( size_t p=Lp_[k]; p<Lp_[k+1UL]; ++p )
+         work_[Li_[p]] -= Lx_[p] * wk;
+   }
+
+   // Backward substitution with the upper factor
+   pattern_.assign( stack_.begin()+top, stack_.begin()+n );
+   top = reach( Up_, Ui_, pattern_.size() );
+
+   for( size_t s=top; s<n; ++s ) {
+      const size_t k( stack_[s] );
+      if( work_[k] == real(0) ) continue;
+      const real wk( work_[k] /= Ud_[k] );
+      for( size_t p=Up_[k]; p<Up_[k+1UL]; ++p )
+         work_[Ui_[p]] -= Ux_[p] * wk;
+   }
+
+   // Applying the column permutation
+   indices.clear();
+   for( size_t s=top; s<n; ++s ) {
+      const size_t k( stack_[s] );
+      x[order_[k]] = work_[k];
+      work_[k] = real(0);
+      indices.push_back( order_[k] );
+   }
+
+   if( etaR_.empty() )
+      return;
+
+   // Applying the eta matrices in order of their creation
+   ++stamp_;
+   for( size_t p=0UL; p<indices.size(); ++p )
+      marker_[indices[p]] = stamp_;
+
+   for( size_t e=0UL; e<etaR_.size(); ++e ) {
+      const size_t r( etaR_[e] );
+      if( x[r] == real(0) ) continue;
+      const real xr( x[r] /= etaD_[e] );
+      for( size_t p=etaP_[e]; p<etaP_[e+1UL]; ++p ) {
+         const size_t i( etaI_[p] );
+         if( marker_[i] != stamp_ ) {
+            marker_[i] = stamp_;
+            indices.push_back( i );
+         }
+         x[i] -= etaX_[p] * xr;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves \f$ B^T y = x \f$ with the current basis (backward transformation).
+//
+// \param x The right-hand side on input, the solution \f$ y = B^{-T} x \f$ on output.
+// \return void
+//
+// The \a i-th row of \f$ B^{-1} \f$ is given by the backward transformation of the \a i-th unit
+// vector.
+*/
+void BasisFactorization::btran( VecN& x ) const
+{
+   BLAZE_USER_ASSERT( x.size() == n_, "Invalid vector size" );
+
+   // Applying the transposed eta matrices in reverse order
+   for( size_t e=etaR_.size(); e-->0UL; ) {
+      const size_t r( etaR_[e] );
+      real tmp( x[r] );
+      for( size_t p=etaP_[e]; p<etaP_[e+1UL]; ++p )
+         tmp -= etaX_[p] * x[etaI_[p]];
+      x[r] = tmp / etaD_[e];
+   }
+
+   // Applying the inverse column permutation
+   for( size_t k=0UL; k<n_; ++k )
+      work_[k] = x[order_[k]];
+
+   // Forward substitution with the transposed upper factor
+   for( size_t k=0UL; k<n_; ++k ) {
+      if( work_[k] == real(0) ) continue;
+      const real wk( work_[k] /= Ud_[k] );
+      for( size_t p=Utp_[k]; p<Utp_[k+1UL]; ++p )
+         work_[Uti_[p]] -= Utx_[p] * wk;
+   }
+
+   // Backward substitution with the transposed unit lower factor
+   for( size_t k=n_; k-->0UL; ) {
+      const real wk( work_[k] );
+      if( wk == real(0) ) continue;
+      for( size_t p=Ltp_[k]; p<Ltp_[k+1UL]; ++p )
+         work_[Lti_[p]] -= Ltx_[p] * wk;
+   }
+
+   // Applying the inverse row permutation
+   for( size_t k=0UL; k<n_; ++k ) {
+      x[prow_[k]] = work_[k];
+      work_[k] = real(0);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves \f$ B^T y = x \f$ for a sparse right-hand side (backward transformation).
+//
+// \param x The right-hand side on input, the solution \f$ y = B^{-T} x \f$ on output.
+// \param indices The indices of the non-zero elements of \a x on input and of \a y on output.
+// \return void
+//
+// On input, \a indices has to contain the indices of all non-zero elements of \a x without
+// duplicates. On output, it contains the indices of all elements of the solution that might be
+// non-zero. For hypersparse right-hand sides the triangular solves are restricted to the nonzero
+// pattern of the solution, otherwise the dense btran() function is used and the indices are
+// recomputed.
+*/
+void BasisFactorization::btran( VecN& x, std::vector<size_t>& indices ) const
+{
+   BLAZE_USER_ASSERT( x.size() == n_, "Invalid vector size" );
+
+   const size_t n( n_ );
+
+   if( indices.size()*hypersparseRatio > n ) {
+      btran( x );
+      indices.clear();
+      for( size_t i=0UL; i<n; ++i ) {
+         if( x[i] != real(0) ) indices.push_back( i );
+      }
+      return;
+   }
+
+   // Applying the transposed eta matrices in reverse order
+   if( !etaR_.empty() )
+   {
+      ++stamp_;
+      for( size_t p=0UL; p<indices.size(); ++p )
+         marker_[indices[p]] = stamp_;
+
+      for( size_t e=etaR_.size(); e-->0UL; ) {
+         const size_t r( etaR_[e] );
+         real tmp( x[r] );
+         for( size_t p=etaP_[e]; p<etaP_[e+1UL]; ++p )
+            tmp -= etaX_[p] * x[etaI_[p]];
+         x[r] = tmp / etaD_[e];
+         if( x[r] != real(0) && marker_[r] != stamp_ ) {
+            marker_[r] = stamp_;
+            indices.push_back( r );
+         }
+      }
+   }
+
+   // Applying the inverse column permutation
+   pattern_.clear();
+   for( size_t p=0UL; p<indices.size(); ++p ) {
+      const size_t i( indices[p] );
+      work_[qinv_[i]] = x[i];
+      x[i] = real(0);
+      pattern_.push_back( qinv_[i] );
+   }
+
+   // Forward substitution with the transposed upper factor
+   size_t top( reach( Utp_, Uti_, pattern_.size() ) );
+
+   for( size_t s=top; s<n; ++s ) {
+      const size_t k( stack_[s] );
+      if( work_[k] == real(0) ) continue;
+      const real wk( work_[k] /= Ud_[k] );
+      for( size_t p=Utp_[k]; p<Utp_[k+1UL]; ++p )
+         work_[Uti_[p]] -= Utx_[p] * wk;
+   }
+
+   // Backward substitution with the transposed unit lower factor
+   pattern_.assign( stack_.begin()+top, stack_.begin()+n );
+   top = reach( Ltp_, Lti_, pattern_.size() );
+
+   for( size_t s=top; s<n; ++s ) {
+      const size_t k( stack_[s] );
+      const real wk( work_[k] );
+      if( wk == real(0) ) continue;
+      for( size_t p=Ltp_[k]; p<Ltp_[k+1UL]; ++p )
+         work_[Lti_[p]] -= Ltx_[p] * wk;
+   }
+
+   // Applying the inverse row permutation
+   indices.clear();
+   for( size_t s=top; s<n; ++s ) {
+      const size_t k( stack_[s] );
+      x[prow_[k]] = work_[k];
+      work_[k] = real(0);
+      indices.push_back( prow_[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the pivot of the next elimination step of the factorization.
+//
+// \param row The resulting pivot row.
+// \param col The resulting pivot column.
+// \return \a true if a pivot was found, \a false if the active submatrix is singular.
+//
+// This function selects the element of the active submatrix with minimal Markowitz count
+// \f$ (r-1)(c-1) \f$ among all elements that satisfy the threshold criterion. Rows and columns
+// are inspected by ascending number of non-zero elements. The search stops as soon as a pivot
+// has been found and either a limited number of rows and columns have been inspected or none of
+// the remaining elements can have a smaller Markowitz count. Ties are resolved in favor of the
+// element of largest magnitude.
+*/
+bool BasisFactorization::selectPivot( size_t& row, size_t& col )
+{
+   const size_t n( n_ );
+   const size_t none( n );
+
+   row = none;
+   col = none;
+
+   // An empty active column renders the basis singular
+   if( colHead_[0] != none )
+      return false;
+
+   size_t bestCost( 0UL );
+   real   bestValue( 0 );
+   size_t searched( 0UL );
+
+   for( size_t c=1UL; c<=n; ++c )
+   {
+      // Inspecting the columns with c non-zero elements
+      for( size_t j=colHead_[c]; j!=none; j=colNext_[j] )
+      {
+         const real cmax( columnMaximum( j ) );
+         const std::vector<size_t>& idx( colIndices_[j] );
+         const std::vector<real>&   val( colValues_[j] );
+
+         for( size_t t=0UL; t<idx.size(); ++t ) {
+            const real a( std::fabs( val[t] ) );
+            if( a == real(0) || a < pivotThreshold*cmax ) continue;
+            const size_t cost( ( c-1UL )*( rowIndices_[idx[t]].size()-1UL ) );
+            if( row == none || cost < bestCost || ( cost == bestCost && a > bestValue ) ) {
+               row = idx[t];
+               col = j;
+               bestCost = cost;
+               bestValue = a;
+            }
+         }
+
+         if( row != none && ( ++searched >= searchLimit || bestCost <= ( c-1UL )*( c-1UL ) ) )
+            return true;
+      }
+
+      // Inspecting the rows with c non-zero elements
+      for( size_t i=rowHead_[c]; i!=none; i=rowNext_[i] )
+      {
+         const std::vector<size_t>& ridx( rowIndices_[i] );
+
+         for( size_t t=0UL; t<ridx.size(); ++t ) {
+            const size_t j( ridx[t] );
+            const std::vector<size_t>& idx( colIndices_[j] );
+            const real a( std::fabs( colValues_[j][std::find( idx.begin(), idx.end(), i ) - idx.begin()] ) );
+            if( a == real(0) || a < pivotThreshold*columnMaximum( j ) ) continue;
+            const size_t cost( ( c-1UL )*( idx.size()-1UL ) );
+            if( row == none || cost < bestCost || ( cost == bestCost && a > bestValue ) ) {
+               row = i;
+               col = j;
+               bestCost = cost;
+               bestValue = a;
+            }
+         }
+
+         if( row != none && ( ++searched >= searchLimit || bestCost <= ( c-1UL )*c ) )
+            return true;
+      }
+
+      if( row != none && bestCost <= c*c )
+         return true;
+   }
+
+   return row != none;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the element of largest magnitude of a column of the active submatrix.
+//
+// \param j The index of the column.
+// \return The largest absolute value of the column.
+//
+// The column maxima are cached until the column is modified by an elimination step.
+*/
+real BasisFactorization::columnMaximum( size_t j )
+{
+   if( colMax_[j] < real(0) ) {
+      real cmax( 0 );
+      for( size_t t=0UL; t<colValues_[j].size(); ++t )
+         cmax = std::max( cmax, std::fabs( colValues_[j][t] ) );
+      colMax_[j] = cmax;
+   }
+
+   return colMax_[j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the nonzero pattern of the solution of a sparse triangular system.
+//
+// \param Ap The offsets of the triangular factor.
+// \param Ai The pivot positions of the triangular factor.
+// \param nz The number of start nodes (see the pattern_ member).
+// \return The start of the topologically ordered pattern within the stack.
+//
+// This function performs a non-recursive depth-first search in the graph of the given factor
+// starting from the first \a nz positions stored in the pattern_ member. The reached positions
+// are stored in topological order in the upper part of the stack, i.e. each position precedes
+// all positions it is connected to.
+*/
+size_t BasisFactorization::reach( const std::vector<size_t>& Ap, const std::vector<size_t>& Ai,
+                                  size_t nz ) const
+{
+   const size_t n( n_ );
+   size_t top( n );
+
+   ++stamp_;
+
+   for( size_t s=0UL; s<nz; ++s )
+   {
+      if( marker_[pattern_[s]] == stamp_ )
+         continue;
+
+      size_t head( 0UL );
+      stack_[n] = pattern_[s];  // The lower part of the stack is used as output
+
+      while( true )
+      {
+         const size_t j( stack_[n+head] );
+
+         if( marker_[j] != stamp_ ) {
+            marker_[j] = stamp_;
+            pstack_[head] = Ap[j];
+         }
+
+         bool done( true );
+
+         for( size_t p=pstack_[head]; p<Ap[j+1UL]; ++p ) {
+            const size_t i( Ai[p] );
+            if( marker_[i] == stamp_ ) continue;
+            pstack_[head] = p+1UL;
+            ++head;
+            stack_[n+head] = i;
+            done = false;
+            break;
+         }
+
+         if( done ) {
+            stack_[--top] = j;
+            if( head == 0UL ) break;
+            --head;
+         }
+      }
+   }
+
+   return top;
+}
+//*************************************************************************************************
+
+} // namespace blaze
@@ -37,14 +37,8 @@
 // Includes
 //*************************************************************************************************
 
-#include <cmath>
-#include <stdexcept>
-#include <blaze/math/Functions.h>
 #include <blaze/math/solvers/CG.h>
-#include <blaze/util/Assert.h>
-#include <blaze/util/ColorMacros.h>
-#include <blaze/util/logging/DebugSection.h>
-#include <blaze/util/Types.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
 
 
 namespace blaze {
@@ -59,9 +53,14 @@ namespace blaze {
 /*!\brief The default constructor for the conjugate gradient solver.
 */
 CG::CG()
-   : r_()  // TODO
-   , d_()  // TODO
-   , h_()  // TODO
+   : r_()                       // The residual
+   , d_()                       // The search direction
+   , h_()                       // The product of the system matrix and the search direction
+   , z_()                       // The preconditioned residual
+   , norms_()                   // Auxiliary vector for the per-block maximum norms
+   , dots_()                    // Auxiliary vector for the per-block dot products
+   , parallel_( false )         // Flag for the parallel execution of the vector operations
+   , checkSymmetry_( false )    // Flag for the symmetry check of the system matrix
 {}
 //*************************************************************************************************
 
@@ -75,98 +74,23 @@ CG::CG()
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Solves the linear system of equations \f$ A \cdot x + b = 0 \f$.
 //
-// \param A TODO
-// \param b TODO
-// \param x TODO
-// \return void
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns.
+// \return \a true if the solution is sufficiently accurate, \a false if not.
 // \exception std::invalid_argument System matrix is not square.
 // \exception std::invalid_argument System matrix is not symmetric.
 // \exception std::invalid_argument Invalid right-hand side vector size.
 //
-// TODO: description
-// TODO: Problem formulation: \f$ A \cdot x + b = 0 \f$ !!
+// This function solves the given linear system without preconditioning. The symmetry of the
+// system matrix is only checked in case the symmetry check has been enabled via the
+// setSymmetryCheck() function.
 */
 bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
 {
-   const size_t n( b.size() );
-   bool converged( false );
-   real alpha, beta, delta;
-
-   if( A.rows() != A.columns() )
-      throw std::invalid_argument( "System matrix is not square" );
-
-   if( !isSymmetric( A ) )
-      throw std::invalid_argument( "System matrix is not symmetric" );
-
-   if( A.rows() != b.size() )
-      throw std::invalid_argument( "Invalid right-hand side vector size" );
-
-   // Allocating helper data
-   r_.resize( n, false );
-   d_.resize( n, false );
-   h_.resize( n, false );
-
-   // Preparing the vector of unknowns
-   x.resize( n, false );
-   x.reset();
-
-   // Computing the initial residual
-   r_ = A * x + b;
-
-   // Initial convergence test
-   lastPrecision_ = 0;
-   for( size_t i=0; i<n; ++i ) {
-      lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
-   }
-
-   if( lastPrecision_ < threshold_ )
-      converged = true;
-
-   delta = trans(r_) * r_;
-
-   d_ = -r_;
-
-   // Performing the CG iterations
-   size_t it( 0 );
-
-   for( ; !converged && it<maxIterations_; ++it )
-   {
-      h_ = A * d_;
-
-      alpha = delta / ( trans(d_) * h_ );
-
-      x  += alpha * d_;
-      r_ += alpha * h_;
-
-      lastPrecision_ = 0;
-      for( size_t i=0; i<n; ++i ) {
-         lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
-      }
-
-      if( lastPrecision_ < threshold_ ) {
-         converged = true;
-         break;
-      }
-
-      beta = trans(r_) * r_;
-
-      d_ = ( beta / delta ) * d_ - r_;
-
-      delta = beta;
-   }
-
-   BLAZE_LOG_DEBUG_SECTION( log ) {
-      if( converged )
-         log << "      Solved the linear system in " << it << " CG iterations.";
-      else
-         log << BLAZE_YELLOW << "      WARNING: Did not solve the linear system within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
-   }
-
-   lastIterations_ = it;
-
-   return converged;
+   return solve( A, b, x, IdentityPreconditioner() );
 }
 //*************************************************************************************************
 
@@ -52,10 +52,20 @@ namespace blaze {
 /*!\brief The default constructor for the CPG class.
 */
 CPG::CPG()
-   : r_()         // TODO
-   , w_()         // TODO
-   , p_()         // TODO
-   , activity_()  // TODO
+   : r_        ()         // The negative residual
+   , w_        ()         // The projected gradient
+   , p_        ()         // The descent direction
+   , q_        ()         // The product of the system matrix and the descent direction
+   , z_        ()         // The projected gradient of the current iteration
+   , delta_    ()         // The deviations of the unknowns from the linear step
+   , activity_ ()         // The activity of the unknowns
+   , noms_     ()         // The per-block partial sums
+   , rmax_     ()         // The per-block maximum norms of the residual
+   , clamped_  ()         // The indices of the clamped unknowns per block
+   , counts_   ()         // The number of clamped unknowns per block
+   , blocks_   ( 1 )      // The number of blocks of the vector operations
+   , blockSize_( 0 )      // The number of unknowns per block
+   , parallel_ ( false )  // Flag for the parallel execution of the vector operations
 {}
 //*************************************************************************************************
 
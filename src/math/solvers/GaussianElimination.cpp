@@ -100,6 +100,9 @@ bool GaussianElimination::solve( const CMatMxN& A, const VecN& b, VecN& x )
 
    const size_t n( b.size() );
 
+   resetStatistics();
+   const double start( timestamp() );
+
    // Allocating helper data
    A_ =  A;
    b_ = -b;
@@ -177,6 +180,9 @@ bool GaussianElimination::solve( const CMatMxN& A, const VecN& b, VecN& x )
       }
    }
 
+   recordUpdate( start );
+   recordIteration( start, lastPrecision_ );
+
    BLAZE_LOG_DEBUG_SECTION( log ) {
       if( lastPrecision_ < threshold_ )
          log << "      Solved the linear system using Gaussian elimination.";
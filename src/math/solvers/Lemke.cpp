@@ -32,7 +32,6 @@
 */
 //*************************************************************************************************
 
-
 //*************************************************************************************************
 // Includes
 //*************************************************************************************************
@@ -42,6 +41,7 @@
 #include <boost/format.hpp>
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/Infinity.h>
 #include <blaze/math/solvers/Lemke.h>
 #include <blaze/util/Assert.h>
@@ -62,11 +62,28 @@ namespace blaze {
 /*!\brief Default constructor for the Lemke class.
 */
 Lemke::Lemke()
-   : Solver()      // Initialization of the base class
-   , basics_()     // TODO
-   , nonbasics_()  // TODO
-   , M_()          // TODO
-   , Q_()          // TODO
+   : Solver()                   // Initialization of the base class
+   , representation_( revised ) // The representation of the pivoting tableau
+   , refactorLimit_ ( 4 )       // The refactorization threshold
+   , dense_         ( false )   // Flag for pivoting on the dense tableau
+   , basics_        ()          // The basic variables
+   , nonbasics_     ()          // The nonbasic variables
+   , M_             ()          // Column-major copy of the LCP matrix
+   , B_             ()          // The basis matrix for refactorizations
+   , basis_         ()          // The factorization of the current basis
+   , d_             ()          // The cover vector
+   , q_             ()          // The right-hand side vector of the LCP
+   , xB_            ()          // The values of the basic variables
+   , alpha_         ()          // The column of the driving variable
+   , alphaIndices_  ()          // The indices of the non-zero elements of alpha_
+   , unit_          ()          // Column of the inverse basis for lexicographic tests
+   , unitIndices_   ()          // The indices of the non-zero elements of unit_
+   , scale_         ()          // The scaling factors of the rows in the ratio test
+   , ties_          ()          // The candidate rows of the ratio test
+   , marker_        ()          // Markers of the remaining candidate rows
+   , stamp_         ( 0 )       // The current marker stamp
+   , Q_             ()          // The dense tableau B^{-1} [q, I]
+   , T_             ()          // The dense tableau of the nonbasic variables
 {}
 //*************************************************************************************************
 
@@ -92,12 +109,20 @@ bool Lemke::solve( LCP& lcp )
    bool converged( false );
    VecN coverVector( lcp.size(), 1 );
 
+   resetStatistics();
+
    size_t it( 0 );
    for( ; !converged && it<maxIterations_; ++it )
    {
+      const double begin( timestamp() );
+
       bool solved( solve( lcp, coverVector ) );
+      recordUpdate( begin );
 
+      const double start( timestamp() );
       lastPrecision_ = lcp.residual();
+      recordResidual( start );
+      recordIteration( begin, lastPrecision_ );
 
       if( lastPrecision_ < threshold_ )
       {
@@ -152,37 +177,13 @@ bool Lemke::solve( LCP& lcp, const VecN& d )
 {
    const size_t n( lcp.size() );
 
-   const CMatMxN& A( lcp.A_ );
-   const VecN&    b( lcp.b_ );
-
    basics_.resize( n, false );
    nonbasics_.resize( n+1, false );
-   M_.resize( n, n+1, false );
-   Q_.resize( n, n+1, false );
-
-   // Merging q into Q' = [q; Q]
-   for( size_t i=0; i<n; ++i )
-   {
-      Q_(i,0) = b[i];
-
-      // Constructing a lexicographically positive identity matrix Q
-      for( size_t j=1; j<Q_.columns(); ++j ) {
-         if( j == i+1 )
-            Q_(i,j) = 1;
-         else
-            Q_(i,j) = 0;
-      }
-   }
 
-   // Preparing the augmented LCP with M' = [d; M]
-   M_ = real( 0 );
-   for( size_t i=0; i<n; ++i ) {
-      M_(i,0) = d[i];
-
-      for( CMatMxN::ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
-         M_(i,element->index()+1) = element->value();
-      }
-   }
+   // Preparing the augmented LCP w = q + d z0 + M z
+   M_ = lcp.A_;
+   d_ = d;
+   q_ = lcp.b_;
 
    // Annotating the tableau
    nonbasics_[0] = 0;
@@ -191,45 +192,47 @@ bool Lemke::solve( LCP& lcp, const VecN& d )
       nonbasics_[i] =  static_cast<ptrdiff_t>(i);
    }
 
-   // Printing the annotated tableau
-   //BLAZE_LOG_DEBUG_SECTION( log ) {
-   //   printTableau( log );
-   //}
-
-   // Determination of the lexicographically smallest blocking variable for the initial pivot step
-   size_t r = inf;
+   // Setting up the initial basis of all w variables
+   dense_ = ( representation_ == dense );
 
-   for( size_t i=0; i<n; ++i ) {
-      if( Q_(i,0) < -accuracy ) {  // < 0
-         r = i;
-         break;
-      }
+   if( dense_ ) {
+      setupTableau();
+   }
+   else {
+      alpha_.resize( n, false );
+      alpha_ = real( 0 );
+      alphaIndices_.clear();
+      unit_.resize( n, false );
+      unit_ = real( 0 );
+      scale_.resize( n, false );
+      marker_.assign( n, 0UL );
+      stamp_ = 0UL;
+
+      if( !refactorize() )
+         return false;
    }
 
+   // Determination of the lexicographically smallest blocking variable for the initial pivot step
+   size_t r( selectInitialBlocking() );
+
    // We are finished if q >= 0 since z = 0 solves the LCP
    if( r == inf ) {
       lcp.x_ = real( 0 );
       return true;
    }
 
-   for( size_t i=r+1; i<n; ++i ) {
-      if( Q_(i,0) > -accuracy ) {  // >= 0
-         BLAZE_INTERNAL_ASSERT( d[i] > -accuracy, "Negative value found" );  // >= 0
-         continue;
-      }
-
-      BLAZE_INTERNAL_ASSERT( d[i] > real( 0 ), "Non-positive value found" );
-      if( isLexicographicallyGreater( i, real(-1)/d[i], r, real(-1)/d[r]) )
-         r = i;
-   }
-
    size_t s = 0;
    size_t pivot_steps = 0;
 
+   // Computing the column of the artificial variable
+   if( !dense_ )
+      computeColumn( s );
+
    while( true )
    {
       // Perform pivot step
-      pivot( r, s );
+      if( !pivot( r, s ) )
+         return false;
 
       // Printing the annotated tableau
       //BLAZE_LOG_DEBUG_SECTION( log ) {
@@ -238,12 +241,7 @@ bool Lemke::solve( LCP& lcp, const VecN& d )
 
       // Finish if z0 blocked the driving variable
       if( nonbasics_[s] == 0 ) {
-         lcp.x_ = real( 0 );
-         for( size_t i=0; i<n; ++i ) {
-            if( basics_[i] > 0 )
-               lcp.x_[basics_[i]-1] = Q_(i,0);
-         }
-
+         extractSolution( lcp.x_ );
          return true;
       }
 
@@ -266,34 +264,19 @@ bool Lemke::solve( LCP& lcp, const VecN& d )
             log << "         z" <<  nonbasics_[s] << " is new driving variable in column " << s;
       }
 
+      // Computing the column of the driving variable
+      if( !dense_ )
+         computeColumn( s );
+
       // Determination of the lexicographically smallest blocking variable
-      r = inf;
-      for( size_t i=0; i<n; ++i ) {
-         if( M_(i,s) < -accuracy ) {  // < 0
-            r = i;
-            break;
-         }
-      }
+      r = selectBlocking( s );
 
       if( r == inf ) {
          // Driving variable is unblocked
-         lcp.x_ = real( 0 );
-         for( size_t i=0; i<n; ++i ) {
-            if( basics_[i] > 0 )
-               lcp.x_[basics_[i]-1] = Q_(i,0);
-         }
-
+         extractSolution( lcp.x_ );
          return false;
       }
 
-      for( size_t i=r+1; i<n; ++i ) {
-         if( M_(i,s) > -accuracy )  // >= 0
-            continue;
-
-         if( isLexicographicallyLess( i, real( -1 )/M_(i,s), r, real( -1 )/M_(r,s) ) )
-            r = i;
-      }
-
       ++pivot_steps;
 
       if( pivot_steps > 10*n ) {
@@ -356,15 +339,13 @@ bool Lemke::isComponentwisePositive( const VecN& v ) const
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Lexicographic comparison of two scaled rows of the dense tableau \f$ B^{-1} [q, I] \f$.
 //
-// \param i1 TODO
-// \param f1 TODO
-// \param i2 TODO
-// \param f2 TODO
-// \return TODO
-//
-// TODO
+// \param i1 The first row.
+// \param f1 The scaling factor of the first row.
+// \param i2 The second row.
+// \param f2 The scaling factor of the second row.
+// \return \a true if the first scaled row is lexicographically less, \a false if not.
 */
 bool Lemke::isLexicographicallyLess( size_t i1, real f1, size_t i2, real f2 ) const
 {
@@ -382,19 +363,17 @@ bool Lemke::isLexicographicallyLess( size_t i1, real f1, size_t i2, real f2 ) co
 
 
 //*************************************************************************************************
-/*!\brief TODO
-//
-// \param i1 TODO
-// \param f1 TODO
-// \param i2 TODO
-// \param f2 TODO
-// \return TODO
+/*!\brief Lexicographic comparison of two scaled rows of the dense tableau \f$ B^{-1} [q, I] \f$.
 //
-// TODO
+// \param i1 The first row.
+// \param f1 The scaling factor of the first row.
+// \param i2 The second row.
+// \param f2 The scaling factor of the second row.
+// \return \a true if the first scaled row is lexicographically greater, \a false if not.
 */
 bool Lemke::isLexicographicallyGreater( size_t i1, real f1, size_t i2, real f2 ) const
 {
-   for( size_t j = 0; j < Q_.columns(); ++j )
+   for( size_t j=0; j<Q_.columns(); ++j )
    {
       if( Q_(i1,j) * f1 > Q_(i2,j) * f2 + real(accuracy) )
          return true;
@@ -408,20 +387,243 @@ bool Lemke::isLexicographicallyGreater( size_t i1, real f1, size_t i2, real f2 )
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Determines the blocking variable of the initial pivot step.
 //
-// \param block TODO
-// \param drive TODO
-// \return void
+// \return The basis position of the blocking variable, \a inf if \f$ q \geq 0 \f$.
 //
-// TODO
+// The blocking variable of the artificial variable is the lexicographically greatest row of the
+// tableau \f$ B^{-1} [q, I] \f$ scaled by \f$ -1/d_i \f$ among all rows with \f$ q_i < 0 \f$.
 */
-void Lemke::pivot( size_t block, size_t drive )
+size_t Lemke::selectInitialBlocking()
 {
-   using boost::format;
+   const size_t n( basics_.size() );
+
+   if( dense_ )
+   {
+      size_t r = inf;
+
+      for( size_t i=0; i<n; ++i ) {
+         if( Q_(i,0) < -accuracy ) {  // < 0
+            r = i;
+            break;
+         }
+      }
+
+      if( r == inf )
+         return inf;
+
+      for( size_t i=r+1; i<n; ++i ) {
+         if( Q_(i,0) > -accuracy ) {  // >= 0
+            BLAZE_INTERNAL_ASSERT( d_[i] > -accuracy, "Negative value found" );  // >= 0
+            continue;
+         }
+
+         BLAZE_INTERNAL_ASSERT( d_[i] > real( 0 ), "Non-positive value found" );
+         if( isLexicographicallyGreater( i, real(-1)/d_[i], r, real(-1)/d_[r]) )
+            r = i;
+      }
+
+      return r;
+   }
+
+   // The lexicographically greatest row scaled by -1/d_i is the smallest row scaled by 1/d_i
+   ties_.clear();
+
+   for( size_t i=0; i<n; ++i ) {
+      if( xB_[i] > -accuracy ) {  // >= 0
+         BLAZE_INTERNAL_ASSERT( d_[i] > -accuracy, "Negative value found" );  // >= 0
+         continue;
+      }
+
+      BLAZE_INTERNAL_ASSERT( d_[i] > real( 0 ), "Non-positive value found" );
+      ties_.push_back( i );
+      scale_[i] = real( 1 ) / d_[i];
+   }
+
+   if( ties_.empty() )
+      return inf;
+
+   return lexicographicMinimum();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the blocking variable of the given driving variable.
+//
+// \param drive The nonbasic position of the driving variable.
+// \return The basis position of the blocking variable, \a inf if the driving variable is unblocked.
+//
+// The blocking variable is the lexicographically smallest row of the tableau \f$ B^{-1} [q, I] \f$
+// scaled by \f$ 1/\alpha_i \f$ among all rows with \f$ \alpha_i > 0 \f$, where \f$ \alpha \f$
+// denotes the negative tableau column of the driving variable. In revised form, the column is
+// expected in \a alpha_ (see computeColumn()).
+*/
+size_t Lemke::selectBlocking( size_t drive )
+{
+   const size_t n( basics_.size() );
+   const size_t s( drive );
+
+   if( dense_ )
+   {
+      size_t r = inf;
+
+      for( size_t i=0; i<n; ++i ) {
+         if( T_(i,s) < -accuracy ) {  // < 0
+            r = i;
+            break;
+         }
+      }
+
+      if( r == inf )
+         return inf;
+
+      for( size_t i=r+1; i<n; ++i ) {
+         if( T_(i,s) > -accuracy )  // >= 0
+            continue;
+
+         if( isLexicographicallyLess( i, real( -1 )/T_(i,s), r, real( -1 )/T_(r,s) ) )
+            r = i;
+      }
+
+      return r;
+   }
+
+   ties_.clear();
+
+   for( size_t p=0; p<alphaIndices_.size(); ++p ) {
+      const size_t i( alphaIndices_[p] );
+      if( alpha_[i] > accuracy ) {  // > 0
+         ties_.push_back( i );
+         scale_[i] = real( 1 ) / alpha_[i];
+      }
+   }
+
+   if( ties_.empty() )
+      return inf;
+
+   return lexicographicMinimum();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Lexicographic minimum of the scaled rows of the tableau \f$ B^{-1} [q, I] \f$.
+//
+// \return The basis position of the lexicographically smallest scaled row.
+//
+// This function determines the lexicographically smallest row among the candidate rows stored
+// in \a ties_, where each row \a i is scaled by the positive factor \a scale_[i]. Instead of
+// comparing pairs of rows of the inverse basis, the candidates are reduced column by column:
+// The first column is given by the values of the basic variables. As long as more than one
+// candidate attains the minimum of a column, the next column of the inverse basis is computed
+// by a hypersparse forward transformation of a unit vector. Since all candidates outside the
+// pattern of this column have a zero element, the cost of each reduction is proportional to
+// the number of non-zero elements of the column instead of the number of candidates.
+*/
+size_t Lemke::lexicographicMinimum()
+{
+   const size_t n( basics_.size() );
+
+   // Reduction by the values of the basic variables
+   real vmin( inf );
+   for( size_t p=0; p<ties_.size(); ++p ) {
+      const size_t i( ties_[p] );
+      vmin = std::min( vmin, xB_[i] * scale_[i] );
+   }
+
+   ++stamp_;
+   size_t count( 0 );
+
+   for( size_t p=0; p<ties_.size(); ++p ) {
+      const size_t i( ties_[p] );
+      if( xB_[i] * scale_[i] <= vmin + real(accuracy) ) {
+         ties_[count++] = i;
+         marker_[i] = stamp_;
+      }
+   }
+
+   ties_.resize( count );
+
+   // Reduction by the columns of the inverse basis
+   for( size_t j=0; count>1UL && j<n; ++j )
+   {
+      unit_[j] = real( 1 );
+      unitIndices_.assign( 1UL, j );
+      basis_.ftran( unit_, unitIndices_ );
+
+      size_t hits( 0 );
+      vmin = inf;
+
+      for( size_t p=0; p<unitIndices_.size(); ++p ) {
+         const size_t i( unitIndices_[p] );
+         if( marker_[i] == stamp_ ) {
+            ++hits;
+            vmin = std::min( vmin, unit_[i] * scale_[i] );
+         }
+      }
+
+      if( hits < count )
+         vmin = std::min( vmin, real( 0 ) );
+
+      if( vmin < -accuracy ) {
+         // Only candidates within the pattern of the column attain the minimum
+         const size_t previous( stamp_++ );
+         ties_.clear();
+         for( size_t p=0; p<unitIndices_.size(); ++p ) {
+            const size_t i( unitIndices_[p] );
+            if( marker_[i] == previous && unit_[i] * scale_[i] <= vmin + real(accuracy) ) {
+               ties_.push_back( i );
+               marker_[i] = stamp_;
+            }
+         }
+         count = ties_.size();
+      }
+      else {
+         // Removing the candidates above the minimum (the candidate list is compacted lazily)
+         for( size_t p=0; p<unitIndices_.size(); ++p ) {
+            const size_t i( unitIndices_[p] );
+            if( marker_[i] == stamp_ && unit_[i] * scale_[i] > vmin + real(accuracy) ) {
+               marker_[i] = 0UL;
+               --count;
+            }
+         }
+      }
+
+      for( size_t p=0; p<unitIndices_.size(); ++p )
+         unit_[unitIndices_[p]] = real( 0 );
+   }
+
+   BLAZE_INTERNAL_ASSERT( count > 0UL, "No blocking variable found" );
+
+   for( size_t p=0; p<ties_.size(); ++p ) {
+      if( marker_[ties_[p]] == stamp_ )
+         return ties_[p];
+   }
 
-   size_t r( block );
-   size_t s( drive );
+   return inf;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a pivot step.
+//
+// \param block The basis position of the blocking variable.
+// \param drive The nonbasic position of the driving variable.
+// \return \a true if the pivot step succeeded, \a false if the refactorization failed.
+//
+// This function exchanges the blocking and the driving variable. On the dense tableau, the
+// pivot step updates both tableaux in \f$ O(n^2) \f$. In revised form, it requires the column
+// of the driving variable with respect to the current basis, which is expected in \a alpha_.
+// The values of the basic variables are updated and the column exchange is appended to the
+// factorization of the basis. As soon as the eta file exceeds the refactorization threshold,
+// the basis is refactorized.
+*/
+bool Lemke::pivot( size_t block, size_t drive )
+{
+   const size_t r( block );
+   const size_t s( drive );
 
    BLAZE_INTERNAL_ASSERT( r < basics_.size() && s <= basics_.size(), "Invalid preconditions for pivot step" );
 
@@ -433,39 +635,263 @@ void Lemke::pivot( size_t block, size_t drive )
           << ( nonbasics_[s] < 0 ? -nonbasics_[s] : nonbasics_[s] ) << ">\n";
    }
 
-   real invPivot = real( 1 ) / M_(r,s);
-
-   for( size_t i=0; i<M_.rows(); ++i )
+   if( dense_ )
    {
-      if( i == r ) continue;
+      const real invPivot = real( 1 ) / T_(r,s);
+
+      for( size_t i=0; i<T_.rows(); ++i )
+      {
+         if( i == r || T_(i,s) == real( 0 ) ) continue;
+
+         for( size_t j=0; j<Q_.columns(); ++j ) {
+            Q_(i,j) -= Q_(r,j) * T_(i,s) * invPivot;
+         }
+
+         for( size_t j=0; j<T_.columns(); ++j )
+         {
+            if( j == s ) continue;
+            T_(i,j) -= T_(i,s) * ( T_(r,j) * invPivot );
+         }
+
+         T_(i,s) *= invPivot;
+      }
 
       for( size_t j=0; j<Q_.columns(); ++j ) {
-         Q_(i,j) -= Q_(r,j) * M_(i,s) * invPivot;
+         Q_(r,j) = -Q_(r,j) * invPivot;
       }
 
-      for( size_t j=0; j<M_.columns(); ++j )
+      for( size_t j=0; j<T_.columns(); ++j )
       {
-         if( j == s ) continue;
-         M_(i,j) -= M_(i,s) * ( M_(r,j) * invPivot );
+         if( j == s )
+            T_(r,j) = invPivot;
+         else
+            T_(r,j) = -T_(r,j) * invPivot;
       }
 
-      M_(i,s) *= invPivot;
-   }
+      // Swap the blocking and driving variables
+      std::swap( basics_[r], nonbasics_[s] );
 
-   for( size_t j=0; j<Q_.columns(); ++j ) {
-      Q_(r,j) = -Q_(r,j) * invPivot;
+      return true;
    }
 
-   for( size_t j=0; j<M_.columns(); ++j )
-   {
-      if( j == s )
-         M_(r,j) = invPivot;
-      else
-         M_(r,j) = -M_(r,j) * invPivot;
+   // Updating the values of the basic variables
+   const real xr( xB_[r] /= alpha_[r] );
+
+   for( size_t p=0; p<alphaIndices_.size(); ++p ) {
+      const size_t i( alphaIndices_[p] );
+      if( i != r )
+         xB_[i] -= alpha_[i] * xr;
    }
 
    // Swap the blocking and driving variables
+   basis_.update( r, alpha_, alphaIndices_ );
    std::swap( basics_[r], nonbasics_[s] );
+
+   if( basis_.etaNonZeros() > refactorLimit_ * basis_.factorNonZeros() )
+      return refactorize();
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Refactorizes the current basis.
+//
+// \return \a true if the refactorization succeeded, \a false if the basis is singular.
+//
+// This function assembles the columns of the current basic variables, computes their sparse LU
+// factorization and recomputes the values of the basic variables from scratch.
+*/
+bool Lemke::refactorize()
+{
+   const size_t n( basics_.size() );
+
+   size_t nonzeros( 0 );
+   for( size_t k=0; k<n; ++k ) {
+      const ptrdiff_t v( basics_[k] );
+      nonzeros += ( v < 0 )?( 1UL ):( v == 0 )?( n ):( M_.nonZeros( v-1 ) );
+   }
+
+   B_.reset();
+   B_.resize( n, n, false );
+   B_.reserve( nonzeros );
+
+   for( size_t k=0; k<n; ++k )
+   {
+      const ptrdiff_t v( basics_[k] );
+
+      if( v < 0 ) {
+         B_.append( -v-1, k, real( 1 ) );
+      }
+      else if( v == 0 ) {
+         for( size_t i=0; i<n; ++i )
+            B_.append( i, k, -d_[i], true );
+      }
+      else {
+         for( CompressedMatrix<real,true>::ConstIterator element=M_.begin(v-1); element!=M_.end(v-1); ++element )
+            B_.append( element->index(), k, -element->value(), true );
+      }
+
+      B_.finalize( k );
+   }
+
+   if( !basis_.factor( B_ ) ) {
+      BLAZE_LOG_DEBUG_SECTION( log ) {
+         log << BLAZE_YELLOW << "      WARNING: Singular basis detected." << BLAZE_OLDCOLOR;
+      }
+      return false;
+   }
+
+   xB_ = q_;
+   basis_.ftran( xB_ );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the column of the given driving variable with respect to the current basis.
+//
+// \param drive The nonbasic position of the driving variable.
+// \return void
+//
+// This function computes \f$ \alpha = B^{-1} a \f$ for the column \a a of the driving variable
+// by a hypersparse forward transformation and stores the result in \a alpha_.
+*/
+void Lemke::computeColumn( size_t drive )
+{
+   for( size_t p=0; p<alphaIndices_.size(); ++p )
+      alpha_[alphaIndices_[p]] = real( 0 );
+   alphaIndices_.clear();
+
+   column( nonbasics_[drive], alpha_, alphaIndices_ );
+   basis_.ftran( alpha_, alphaIndices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the column of the given variable in the constraint \f$ w - d z_0 - M z = q \f$.
+//
+// \param variable The variable (negative for w, positive for z, 0 for the artificial variable).
+// \param c The resulting column (has to be zero on input).
+// \param indices The resulting indices of the non-zero elements of the column.
+// \return void
+*/
+void Lemke::column( ptrdiff_t variable, VecN& c, std::vector<size_t>& indices ) const
+{
+   if( variable < 0 ) {
+      c[-variable-1] = real( 1 );
+      indices.push_back( -variable-1 );
+   }
+   else if( variable == 0 ) {
+      for( size_t i=0; i<d_.size(); ++i ) {
+         if( d_[i] == real( 0 ) ) continue;
+         c[i] = -d_[i];
+         indices.push_back( i );
+      }
+   }
+   else {
+      for( CompressedMatrix<real,true>::ConstIterator element=M_.begin(variable-1); element!=M_.end(variable-1); ++element ) {
+         c[element->index()] = -element->value();
+         indices.push_back( element->index() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets up the dense tableaux of the initial basis of all w variables.
+//
+// \return void
+*/
+void Lemke::setupTableau()
+{
+   const size_t n( basics_.size() );
+
+   Q_.resize( n, n+1, false );
+   T_.resize( n, n+1, false );
+
+   // Merging q into Q' = [q; Q] with a lexicographically positive identity matrix Q
+   Q_ = real( 0 );
+   for( size_t i=0; i<n; ++i ) {
+      Q_(i,0) = q_[i];
+      Q_(i,i+1) = real( 1 );
+   }
+
+   // Preparing the augmented LCP with M' = [d; M]
+   T_ = real( 0 );
+   for( size_t i=0; i<n; ++i )
+      T_(i,0) = d_[i];
+
+   for( size_t j=0; j<n; ++j ) {
+      for( CompressedMatrix<real,true>::ConstIterator element=M_.begin(j); element!=M_.end(j); ++element )
+         T_(element->index(),j+1) = element->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembles the dense tableaux from the factorization of the current basis.
+//
+// \param Q The resulting tableau \f$ B^{-1} [q, I] \f$.
+// \param T The resulting tableau \f$ -B^{-1} N \f$ of the nonbasic variables.
+// \return void
+//
+// Note that this requires \f$ 2n+1 \f$ solves with the basis.
+*/
+void Lemke::assembleTableau( MatMxN& Q, MatMxN& T ) const
+{
+   const size_t n( basics_.size() );
+
+   Q.resize( n, n+1, false );
+   T.resize( n, n+1, false );
+
+   VecN tmp( n, real( 0 ) );
+   std::vector<size_t> indices;
+
+   for( size_t j=0; j<=n; ++j )
+   {
+      if( j == 0 ) {
+         tmp = xB_;
+      }
+      else {
+         tmp = real( 0 );
+         tmp[j-1] = real( 1 );
+         basis_.ftran( tmp );
+      }
+      for( size_t i=0; i<n; ++i )
+         Q(i,j) = tmp[i];
+
+      tmp = real( 0 );
+      indices.clear();
+      column( nonbasics_[j], tmp, indices );
+      basis_.ftran( tmp );
+      for( size_t i=0; i<n; ++i )
+         T(i,j) = -tmp[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracts the values of the z variables from the current basis.
+//
+// \param x The resulting solution vector.
+// \return void
+*/
+void Lemke::extractSolution( VecN& x ) const
+{
+   x = real( 0 );
+
+   for( size_t i=0; i<basics_.size(); ++i ) {
+      if( basics_[i] > 0 )
+         x[basics_[i]-1] = ( dense_ )?( Q_(i,0) ):( xB_[i] );
+   }
 }
 //*************************************************************************************************
 
@@ -475,7 +901,8 @@ void Lemke::pivot( size_t block, size_t drive )
 //
 // \return TODO
 //
-// TODO
+// In revised form, the dense tableaux are assembled from the factorization of the current basis.
+// Note that this requires \f$ O(n^2) \f$ memory and \f$ 2n+1 \f$ solves with the basis.
 */
 void Lemke::printTableau( std::ostream& os ) const
 {
@@ -483,16 +910,27 @@ void Lemke::printTableau( std::ostream& os ) const
 
    const size_t n( basics_.size() );
 
+   // Assembling the tableau Q = B^{-1} [q, I] and M = -B^{-1} N
+   MatMxN Q, M;
+
+   if( dense_ ) {
+      Q = Q_;
+      M = T_;
+   }
+   else {
+      assembleTableau( Q, M );
+   }
+
    // Printing the header
    os << "      ";
-   for( size_t j=0; j<Q_.columns(); ++j ) {
+   for( size_t j=0; j<Q.columns(); ++j ) {
       if( j == 0 )
          os << format( " %-7d " ) % 1;
       else
          os << format( " x%-6d " ) % j;
    }
    os << "  ";
-   for( size_t j=0; j<M_.columns(); ++j ) {
+   for( size_t j=0; j<M.columns(); ++j ) {
       if( nonbasics_[j] < 0 )
          os << format( " w%-6d " ) % -nonbasics_[j];
       else
@@ -502,11 +940,11 @@ void Lemke::printTableau( std::ostream& os ) const
 
    // Printing the table border
    os << "     +-";
-   for( size_t j=0; j<Q_.columns(); ++j ) {
+   for( size_t j=0; j<Q.columns(); ++j ) {
       os << "---------";
    }
    os << "+-";
-   for( size_t j=0; j<M_.columns(); ++j ) {
+   for( size_t j=0; j<M.columns(); ++j ) {
       os << "---------";
    }
    os << "+\n";
@@ -517,23 +955,23 @@ void Lemke::printTableau( std::ostream& os ) const
       else
          os << format( " z%-2d | " ) % basics_[i];
 
-      for( size_t j=0; j<Q_.columns(); ++j ) {
-         os << format( "%-8.2d " ) % Q_(i, j);
+      for( size_t j=0; j<Q.columns(); ++j ) {
+         os << format( "%-8.2d " ) % Q(i, j);
       }
       os << "| ";
 
-      for( size_t j=0; j<M_.columns(); ++j ) {
-         os << format( "%-8.2d " ) % M_(i, j);
+      for( size_t j=0; j<M.columns(); ++j ) {
+         os << format( "%-8.2d " ) % M(i, j);
       }
       os << "|\n";
    }
 
    os << "     +-";
-   for( size_t j=0; j<Q_.columns(); ++j ) {
+   for( size_t j=0; j<Q.columns(); ++j ) {
       os << "---------";
    }
    os << "+-";
-   for( size_t j=0; j<M_.columns(); ++j ) {
+   for( size_t j=0; j<M.columns(); ++j ) {
       os << "---------";
    }
    os << "+\n\n";
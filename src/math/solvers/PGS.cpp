@@ -52,7 +52,19 @@ namespace blaze {
 /*!\brief The default constructor for the PGS class.
 */
 PGS::PGS()
-   : diagonal_()  // Vector for the diagonal entries of the LCP matrix
+   : mode_        ( gaussSeidel )  // The sweep mode of the solver
+   , omega_       ( 0.5 )          // The relaxation parameter of the Jacobi sweep
+   , diagonal_    ()               // Vector for the diagonal entries of the LCP matrix
+   , residual_    ()               // The residual of the Jacobi sweep
+   , rmax_        ()               // The maximum changes of the unknowns per block
+   , colorOffsets_()               // The offsets of the colors within the node vector
+   , colorNodes_  ()               // The nodes of the problem sorted by color
+   , block_       ( false )        // Flag for block updates of contact LCPs
+   , blockInverses_()              // The inverse 3x3 diagonal blocks of the contacts
+   , patternOffsets_ ()            // The row offsets of the sparsity pattern of the cached coloring
+   , patternIndices_ ()            // The column indices of the sparsity pattern of the cached coloring
+   , patternNodeSize_( 0UL )       // The node size of the cached coloring
+   , colorsCached_( false )        // Flag for a valid cached coloring
 {}
 //*************************************************************************************************
 
@@ -0,0 +1,1051 @@
+//=================================================================================================
+/*!
+//  \file src/math/solvers/SparseCholesky.cpp
+//  \brief Source file for the supernodal sparse Cholesky factorization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/reordering/MinimumDegree.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/solvers/SparseCholesky.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Null.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+namespace {
+
+//*************************************************************************************************
+/*!\brief The number of columns of the blocks of the dense factorization and substitutions.
+*/
+const size_t blockSize = 64UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The number of columns of the blocks of the symmetric updates.
+*/
+const size_t updateBlockSize = 128UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Return values of the factorization of a single supernode.
+*/
+enum { success = 0, notPositiveDefinite = 1, invalidPattern = 2 };
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of a supernode.
+//
+// \param columns The number of columns of the supernode.
+// \param rows The number of rows of the supernode.
+// \return The number of elements of the lower trapezoidal part of the supernode.
+*/
+inline size_t trapezoid( size_t columns, size_t rows )
+{
+   return columns*rows - ( columns*( columns-1UL ) ) / 2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decides whether a supernode and its parent are merged into a single supernode.
+//
+// \param columns The number of columns of the merged supernode.
+// \param zeros The number of explicitly stored zeros of the merged supernode.
+// \param total The number of stored elements of the merged supernode.
+// \return \a true in case the supernodes should be merged, \a false if not.
+//
+// Small supernodes are always merged, larger supernodes are only merged in case the fraction
+// of explicitly stored zeros remains small.
+*/
+inline bool amalgamate( size_t columns, size_t zeros, size_t total )
+{
+   const double fraction( static_cast<double>( zeros ) / static_cast<double>( total ) );
+
+   return ( columns <=  4UL ) ||
+          ( columns <= 16UL && fraction < 0.8  ) ||
+          ( columns <= 48UL && fraction < 0.1  ) ||
+          ( fraction < 0.05 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment of a dense matrix expression to a dense submatrix.
+//
+// \param lhs The target dense submatrix.
+// \param rhs The dense matrix expression to be subtracted.
+// \return void
+//
+// Within an active parallel section (i.e. during the parallel processing of a level of the
+// supernodal elimination tree) the expression is evaluated serially, otherwise the dense
+// matrix kernels are free to parallelize the evaluation.
+*/
+template< typename VT    // Type of the dense submatrix
+        , typename MT >  // Type of the dense matrix expression
+inline void subtract( VT lhs, const MT& rhs )
+{
+   if( isParallelSectionActive() )
+      lhs -= serial( rhs );
+   else
+      lhs -= rhs;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment of a dense matrix expression to a dense submatrix.
+//
+// \param lhs The target dense submatrix.
+// \param rhs The dense matrix expression to be added.
+// \return void
+//
+// Within an active parallel section the expression is evaluated serially, otherwise the dense
+// matrix kernels are free to parallelize the evaluation.
+*/
+template< typename VT    // Type of the dense submatrix
+        , typename MT >  // Type of the dense matrix expression
+inline void add( VT lhs, const MT& rhs )
+{
+   if( isParallelSectionActive() )
+      lhs += serial( rhs );
+   else
+      lhs += rhs;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the lower part of a symmetric update \f$ C = C - A B \f$ of a supernode.
+//
+// \param C The updated dense columns.
+// \param offset The row and column of the first updated element of \a C.
+// \param A The dense \f$ m \times k \f$ factor.
+// \param B The dense \f$ k \times n \f$ transposed factor.
+// \return void
+//
+// The update is restricted to the lower trapezoidal part of the \f$ m \times n \f$ block of
+// \a C starting at the given offset and is computed by dense matrix multiplications of
+// column blocks. Since both the offset and the block size are multiples of the SIMD width,
+// all operands are aligned.
+*/
+inline void updateLower( DynamicMatrix<real,true>& C, size_t offset,
+                         const DynamicMatrix<real,true>& A, const DynamicMatrix<real,true>& B )
+{
+   const size_t m( A.rows() );
+   const size_t k( A.columns() );
+   const size_t n( B.columns() );
+
+   for( size_t jb=0UL; jb<n; jb+=updateBlockSize ) {
+      const size_t jend( min( jb+updateBlockSize, n ) );
+      subtract( submatrix<aligned>( C, offset+jb, offset+jb, m-jb, jend-jb ),
+                submatrix<aligned>( A, jb, 0UL, m-jb, k ) * submatrix<aligned>( B, 0UL, jb, k, jend-jb ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution of a supernode operation for the supernodes of a single level.
+//
+// The supernodes of a level are sorted by decreasing cost. Each block processes every
+// \a stride_-th supernode, which balances the work among the blocks.
+*/
+template< typename OP >  // Type of the supernode operation
+struct SparseCholesky::LevelKernel
+{
+   inline void operator()( size_t first, size_t last ) const {
+      for( size_t b=first; b<last; ++b ) {
+         for( size_t k=begin_+b; k<end_; k+=stride_ ) {
+            (*op_)( schedule_[k] );
+         }
+      }
+   }
+
+   size_t        begin_;     //!< The first position of the level.
+   size_t        end_;       //!< The position one past the last supernode of the level.
+   size_t        stride_;    //!< The number of blocks.
+   const size_t* schedule_;  //!< The supernodes of all levels.
+   const OP*     op_;        //!< The supernode operation.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric factorization of a single supernode.
+*/
+struct SparseCholesky::FactorKernel
+{
+   inline void operator()( size_t s ) const {
+      status_[s] = solver_->factorizeSupernode( s, *A_, *updates_ );
+   }
+
+   SparseCholesky*         solver_;   //!< The factorization.
+   const CMatMxN*          A_;        //!< The permuted system matrix.
+   std::vector<Supernode>* updates_;  //!< The update matrices of all supernodes.
+   int*                    status_;   //!< The status of the factorization of each supernode.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward substitution with a single supernode.
+*/
+struct SparseCholesky::ForwardKernel
+{
+   inline void operator()( size_t s ) const {
+      solver_->forwardSupernode( s, *W_, *updates_ );
+   }
+
+   const SparseCholesky* solver_;   //!< The factorization.
+   MatMxN*               W_;        //!< The permuted right-hand sides.
+   std::vector<MatMxN>*  updates_;  //!< The update vectors of all supernodes.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backward substitution with a single supernode.
+*/
+struct SparseCholesky::BackwardKernel
+{
+   inline void operator()( size_t s ) const {
+      solver_->backwardSupernode( s, *W_ );
+   }
+
+   const SparseCholesky* solver_;  //!< The factorization.
+   MatMxN*               W_;       //!< The permuted right-hand sides.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the SparseCholesky class.
+*/
+SparseCholesky::SparseCholesky()
+   : n_        ( 0UL )       // The size of the factorized matrix
+   , nonZeros_ ( 0UL )       // The number of stored elements of the factor
+   , perm_     ()            // The fill reducing permutation
+   , columns_  ( 1UL, 0UL )  // The first column of each supernode
+   , rowPtr_   ()            // The offsets of the row indices of each supernode
+   , rows_     ()            // The row indices of all supernodes
+   , childPtr_ ()            // The offsets of the children of each supernode
+   , children_ ()            // The child supernodes of all supernodes
+   , levelPtr_ ( 1UL, 0UL )  // The offsets of the supernodes of each level
+   , schedule_ ()            // The supernodes sorted by level
+   , levelWork_()            // The number of stored elements of each level
+   , factors_  ()            // The dense columns of all supernodes
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FACTORIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the symbolic analysis of the given row-major sparse symmetric matrix.
+//
+// \param A The row-major symmetric matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// The symbolic analysis consists of the following steps:
+//  -# The approximate minimum degree ordering of \a A and the elimination tree of the reordered
+//     matrix are computed. The ordering is combined with a postordering of the elimination tree,
+//     which keeps the fill-in unchanged but numbers the columns of each subtree contiguously.
+//  -# The number of non-zero elements of each column of the factor is counted by traversing
+//     the row subtrees of the elimination tree.
+//  -# Chains of columns with nested patterns form the fundamental supernodes, which are merged
+//     with their parent supernode in case the number of explicitly stored zeros remains small.
+//  -# The row indices of each supernode are computed as the union of the elements of \a A in
+//     the columns of the supernode and the row indices of its children.
+//  -# The supernodes are grouped into levels, such that all children of a supernode are part
+//     of lower levels.
+*/
+void SparseCholesky::analyze( const CMatMxN& A )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( A.rows() );
+   const size_t npos( n );
+
+   // Computing the elimination tree of the AMD ordered matrix
+   const PermutationVector amd( approximateMinimumDegree( A ) );
+
+   std::vector<size_t> parent( n, npos ), ancestor( n, npos );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( ConstIterator element=A.begin( amd[k] ); element!=A.end( amd[k] ); ++element ) {
+         size_t i( amd.inverse( element->index() ) );
+         while( i < k && ancestor[i] != npos && ancestor[i] != k ) {
+            const size_t next( ancestor[i] );
+            ancestor[i] = k;
+            i = next;
+         }
+         if( i < k && ancestor[i] == npos ) {
+            ancestor[i] = k;
+            parent[i] = k;
+         }
+      }
+   }
+
+   // Postordering the elimination tree
+   std::vector<size_t> head( n, npos ), sibling( n, npos ), order, stack;
+   order.reserve( n );
+
+   for( size_t k=n; k>0UL; --k ) {
+      if( parent[k-1UL] == npos ) continue;
+      sibling[k-1UL] = head[parent[k-1UL]];
+      head[parent[k-1UL]] = k-1UL;
+   }
+
+   for( size_t k=0UL; k<n; ++k ) {
+      if( parent[k] != npos ) continue;
+      stack.push_back( k );
+      while( !stack.empty() ) {
+         const size_t v( stack.back() );
+         if( head[v] != npos ) {
+            stack.push_back( head[v] );
+            head[v] = sibling[head[v]];
+         }
+         else {
+            stack.pop_back();
+            order.push_back( v );
+         }
+      }
+   }
+
+   std::vector<size_t>& post( ancestor );
+   for( size_t k=0UL; k<n; ++k ) {
+      post[order[k]] = k;
+   }
+
+   for( size_t k=0UL; k<n; ++k ) {
+      head[k] = ( parent[order[k]] != npos )?( post[parent[order[k]]] ):( npos );
+      order[k] = amd[order[k]];
+   }
+
+   parent.swap( head );
+   PermutationVector( order.begin(), order.end() ).swap( perm_ );
+
+   // Counting the non-zero elements of each column of the factor
+   std::vector<size_t> counts( n, 1UL ), children( n, 0UL );
+   std::vector<size_t>& marker( head );
+   std::fill( marker.begin(), marker.end(), npos );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      marker[i] = i;
+      for( ConstIterator element=A.begin( perm_[i] ); element!=A.end( perm_[i] ); ++element ) {
+         for( size_t j=perm_.inverse( element->index() ); j<i && marker[j]!=i; j=parent[j] ) {
+            marker[j] = i;
+            ++counts[j];
+         }
+      }
+      if( parent[i] != npos ) ++children[parent[i]];
+   }
+
+   // Computing the fundamental supernodes and merging them with their parents
+   std::vector<size_t> columns, elements;
+
+   for( size_t j=0UL; j<n; )
+   {
+      size_t last( j+1UL ), total( counts[j] );
+      while( last < n && parent[last-1UL] == last && children[last] == 1UL &&
+             counts[last-1UL] == counts[last]+1UL ) {
+         total += counts[last];
+         ++last;
+      }
+
+      size_t first( j ), height( counts[j] );
+
+      while( !columns.empty() )
+      {
+         const size_t child( columns.size()-1UL );
+         const size_t p( parent[first-1UL] );
+
+         if( p == npos || p >= last )
+            break;
+
+         const size_t merged( last - columns[child] );
+         const size_t rows  ( first - columns[child] + height );
+         const size_t stored( trapezoid( merged, rows ) );
+
+         if( !amalgamate( merged, stored - total - elements[child], stored ) )
+            break;
+
+         first   = columns[child];
+         height  = rows;
+         total  += elements[child];
+         columns.pop_back();
+         elements.pop_back();
+      }
+
+      columns.push_back( first );
+      elements.push_back( total );
+      j = last;
+   }
+
+   const size_t N( columns.size() );
+   columns.push_back( n );
+   columns_.swap( columns );
+
+   // Computing the supernodal elimination tree
+   std::vector<size_t>& super( counts );
+   for( size_t s=0UL; s<N; ++s ) {
+      std::fill( super.begin()+columns_[s], super.begin()+columns_[s+1UL], s );
+   }
+
+   std::vector<size_t> sparent( N, N );
+   childPtr_.assign( N+1UL, 0UL );
+
+   for( size_t s=0UL; s<N; ++s ) {
+      const size_t p( parent[columns_[s+1UL]-1UL] );
+      if( p == npos ) continue;
+      sparent[s] = super[p];
+      ++childPtr_[sparent[s]+1UL];
+   }
+
+   for( size_t s=0UL; s<N; ++s ) {
+      childPtr_[s+1UL] += childPtr_[s];
+   }
+
+   children_.resize( childPtr_[N] );
+   std::vector<size_t>& pos( children );
+   std::copy( childPtr_.begin(), childPtr_.end()-1L, pos.begin() );
+
+   for( size_t s=0UL; s<N; ++s ) {
+      if( sparent[s] != N ) children_[pos[sparent[s]]++] = s;
+   }
+
+   // Computing the row indices of the supernodes
+   rowPtr_.assign( 1UL, 0UL );
+   rows_.clear();
+   nonZeros_ = 0UL;
+   std::fill( marker.begin(), marker.end(), npos );
+
+   std::vector<size_t> below;
+
+   for( size_t s=0UL; s<N; ++s )
+   {
+      const size_t first( columns_[s] );
+      const size_t last ( columns_[s+1UL] );
+
+      below.clear();
+
+      for( size_t j=first; j<last; ++j ) {
+         rows_.push_back( j );
+         for( ConstIterator element=A.begin( perm_[j] ); element!=A.end( perm_[j] ); ++element ) {
+            const size_t i( perm_.inverse( element->index() ) );
+            if( i < last || marker[i] == s ) continue;
+            marker[i] = s;
+            below.push_back( i );
+         }
+      }
+
+      for( size_t k=childPtr_[s]; k<childPtr_[s+1UL]; ++k ) {
+         const size_t c( children_[k] );
+         for( size_t l=rowPtr_[c]+columns_[c+1UL]-columns_[c]; l<rowPtr_[c+1UL]; ++l ) {
+            const size_t i( rows_[l] );
+            if( i < last || marker[i] == s ) continue;
+            marker[i] = s;
+            below.push_back( i );
+         }
+      }
+
+      std::sort( below.begin(), below.end() );
+      rows_.insert( rows_.end(), below.begin(), below.end() );
+      rowPtr_.push_back( rows_.size() );
+
+      nonZeros_ += trapezoid( last-first, rowPtr_[s+1UL]-rowPtr_[s] );
+   }
+
+   // Grouping the supernodes by their level within the supernodal elimination tree
+   std::vector<size_t>& level( sparent );
+   size_t height( 0UL );
+
+   for( size_t s=0UL; s<N; ++s ) {
+      level[s] = 0UL;
+      for( size_t k=childPtr_[s]; k<childPtr_[s+1UL]; ++k ) {
+         level[s] = max( level[s], level[children_[k]]+1UL );
+      }
+      height = max( height, level[s]+1UL );
+   }
+
+   std::vector< std::pair<size_t,size_t> > costs( N );
+   for( size_t s=0UL; s<N; ++s ) {
+      const size_t stored( trapezoid( columns_[s+1UL]-columns_[s], rowPtr_[s+1UL]-rowPtr_[s] ) );
+      costs[s] = std::make_pair( level[s]*( nonZeros_+1UL ) + ( nonZeros_-stored ), s );
+   }
+   std::sort( costs.begin(), costs.end() );
+
+   schedule_.resize( N );
+   levelPtr_.assign( height+1UL, 0UL );
+   levelWork_.assign( height, 0UL );
+
+   for( size_t k=0UL; k<N; ++k ) {
+      const size_t s( costs[k].second );
+      schedule_[k] = s;
+      ++levelPtr_[level[s]+1UL];
+      levelWork_[level[s]] += trapezoid( columns_[s+1UL]-columns_[s], rowPtr_[s+1UL]-rowPtr_[s] );
+   }
+
+   for( size_t l=0UL; l<height; ++l ) {
+      levelPtr_[l+1UL] += levelPtr_[l];
+   }
+
+   n_ = n;
+   factors_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the numeric factorization of the given row-major sparse symmetric matrix.
+//
+// \param A The row-major symmetric positive definite matrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+// \exception std::invalid_argument Invalid sparsity pattern.
+// \exception std::invalid_argument Cholesky factorization failed.
+//
+// This function computes the numeric factorization based on the previous symbolic analysis.
+// The sparsity pattern of \a A must be contained in the pattern the analysis was computed for.
+// The supernodes are factorized level by level, starting with the leaves of the supernodal
+// elimination tree. The supernodes of a single level are factorized in parallel in case the
+// number of stored elements of the level is larger or equal to the \a SMP_CHOLESKY_THRESHOLD.
+// In case the given matrix is not positive definite, a \a std::invalid_argument exception is
+// thrown.
+*/
+void SparseCholesky::factorize( const CMatMxN& A )
+{
+   if( A.rows() != n_ || A.columns() != n_ )
+      throw std::invalid_argument( "Invalid matrix size" );
+
+   const size_t N( supernodes() );
+
+   std::vector<Supernode> updates( N );
+   std::vector<int> status( N, success );
+
+   factors_.resize( N );
+
+   FactorKernel kernel;
+   kernel.solver_  = this;
+   kernel.A_       = &A;
+   kernel.updates_ = &updates;
+   kernel.status_  = ( N > 0UL )?( &status[0] ):( NULL );
+
+   execute( kernel, false, 1UL );
+
+   for( size_t s=0UL; s<N; ++s )
+   {
+      if( status[s] == invalidPattern ) {
+         factors_.clear();
+         throw std::invalid_argument( "Invalid sparsity pattern" );
+      }
+      else if( status[s] == notPositiveDefinite ) {
+         factors_.clear();
+         throw std::invalid_argument( "Cholesky factorization failed" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the factorized linear system for the given right-hand side (\f$ b = A^{-1} b \f$).
+//
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+void SparseCholesky::solve( VecN& b ) const
+{
+   if( b.size() != n_ )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   MatMxN B( n_, 1UL );
+   column( B, 0UL ) = b;
+   solve( B );
+   b = column( B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the factorized linear system for multiple right-hand sides (\f$ B = A^{-1} B \f$).
+//
+// \param B The right-hand sides in the columns of the matrix, which are overwritten by the solutions.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix size.
+//
+// The forward substitution traverses the supernodal elimination tree from the leaves to the
+// root, the backward substitution from the root to the leaves. Within a supernode, all
+// right-hand sides are processed at once by dense matrix multiplications. The supernodes of a
+// single level are processed in parallel in case the number of stored elements of the level
+// times the number of right-hand sides is larger or equal to the \a SMP_CHOLESKY_THRESHOLD.
+*/
+void SparseCholesky::solve( MatMxN& B ) const
+{
+   BLAZE_USER_ASSERT( factors_.size() == supernodes(), "Missing numeric factorization" );
+
+   if( B.rows() != n_ )
+      throw std::invalid_argument( "Invalid right-hand side matrix size" );
+
+   MatMxN W( n_, B.columns() );
+   for( size_t i=0UL; i<n_; ++i ) {
+      row( W, i ) = row( B, perm_[i] );
+   }
+
+   std::vector<MatMxN> updates( supernodes() );
+
+   ForwardKernel forward;
+   forward.solver_  = this;
+   forward.W_       = &W;
+   forward.updates_ = &updates;
+
+   execute( forward, false, B.columns() );
+
+   BackwardKernel backward;
+   backward.solver_ = this;
+   backward.W_      = &W;
+
+   execute( backward, true, B.columns() );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      row( B, perm_[i] ) = row( W, i );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Executes the given supernode operation for all supernodes level by level.
+//
+// \param op The supernode operation.
+// \param reverse \a true to traverse the levels from the root to the leaves.
+// \param rhs The number of right-hand sides processed by the operation.
+// \return void
+*/
+template< typename OP >  // Type of the supernode operation
+void SparseCholesky::execute( const OP& op, bool reverse, size_t rhs ) const
+{
+   const size_t L( levels() );
+
+   for( size_t k=0UL; k<L; ++k )
+   {
+      const size_t l( reverse ? L-k-1UL : k );
+      const size_t begin( levelPtr_[l] );
+      const size_t end  ( levelPtr_[l+1UL] );
+
+      if( end - begin < 2UL || levelWork_[l]*rhs < SMP_CHOLESKY_THRESHOLD || getNumThreads() < 2UL ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         for( size_t i=begin; i<end; ++i )
+            op( schedule_[i] );
+         continue;
+      }
+
+      LevelKernel<OP> kernel;
+      kernel.begin_    = begin;
+      kernel.end_      = end;
+      kernel.stride_   = min( getNumThreads(), end - begin );
+      kernel.schedule_ = &schedule_[0];
+      kernel.op_       = &op;
+
+      smpFor( 0UL, kernel.stride_, kernel );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the positions of the row indices of a child within its parent supernode.
+//
+// \param s The parent supernode.
+// \param c The child supernode.
+// \param indices The positions of the row indices of the child below its columns.
+// \return void
+*/
+void SparseCholesky::relativeIndices( size_t s, size_t c, std::vector<size_t>& indices ) const
+{
+   const size_t first( rowPtr_[c] + columns_[c+1UL] - columns_[c] );
+
+   indices.resize( rowPtr_[c+1UL] - first );
+
+   size_t pos( rowPtr_[s] );
+   for( size_t k=0UL; k<indices.size(); ++k ) {
+      while( rows_[pos] != rows_[first+k] ) ++pos;
+      BLAZE_INTERNAL_ASSERT( pos < rowPtr_[s+1UL], "Invalid supernodal structure detected" );
+      indices[k] = pos - rowPtr_[s];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the numeric factorization of a single supernode.
+//
+// \param s The supernode to be factorized.
+// \param A The row-major system matrix.
+// \param updates The update matrices of all supernodes.
+// \return The status of the factorization.
+//
+// The elements of \a A and the update matrices of the children are assembled into the dense
+// columns \f$ [L_{11}; L_{21}] \f$ of the supernode and into its update matrix. The diagonal
+// block is factorized by a blocked right-looking Cholesky factorization, which updates the
+// remaining columns of the supernode by dense matrix multiplications. Finally the lower part of
+// the update matrix \f$ U = U - L_{21} L_{21}^T \f$ for the parent supernode is computed. The
+// operands of all updates are copied into contiguous matrices first, which enables the aligned
+// and vectorized matrix multiplication kernels. The update matrices of the children are
+// released after their assembly.
+*/
+int SparseCholesky::factorizeSupernode( size_t s, const CMatMxN& A, std::vector<Supernode>& updates )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   const size_t first( columns_[s] );
+   const size_t nc( columns_[s+1UL] - first );
+   const size_t h ( rowPtr_[s+1UL] - rowPtr_[s] );
+   const size_t m ( h - nc );
+   const size_t* rows( &rows_[rowPtr_[s]] );
+
+   Supernode& F( factors_[s] );
+   F.resize( h, nc, false );
+   reset( F );
+
+   Supernode& U( updates[s] );
+   U.resize( m, m, false );
+   reset( U );
+
+   int status( success );
+
+   // Assembling the elements of the system matrix
+   for( size_t j=0UL; j<nc; ++j ) {
+      for( ConstIterator element=A.begin( perm_[first+j] ); element!=A.end( perm_[first+j] ); ++element ) {
+         const size_t i( perm_.inverse( element->index() ) );
+         if( i < first+j ) continue;
+         const size_t* pos( std::lower_bound( rows+j, rows+h, i ) );
+         if( pos == rows+h || *pos != i ) {
+            status = invalidPattern;
+            continue;
+         }
+         F( pos-rows, j ) += element->value();
+      }
+   }
+
+   // Assembling the update matrices of the children
+   std::vector<size_t> indices;
+
+   for( size_t k=childPtr_[s]; k<childPtr_[s+1UL]; ++k )
+   {
+      const size_t c( children_[k] );
+      relativeIndices( s, c, indices );
+
+      const Supernode& C( updates[c] );
+
+      for( size_t jj=0UL; jj<indices.size(); ++jj ) {
+         const size_t j( indices[jj] );
+         if( j < nc ) {
+            for( size_t ii=jj; ii<indices.size(); ++ii )
+               F( indices[ii], j ) += C( ii, jj );
+         }
+         else {
+            for( size_t ii=jj; ii<indices.size(); ++ii )
+               U( indices[ii]-nc, j-nc ) += C( ii, jj );
+         }
+      }
+
+      Supernode().swap( updates[c] );
+   }
+
+   if( status != success )
+      return status;
+
+   // Blocked Cholesky factorization of the columns of the supernode
+   for( size_t kb=0UL; kb<nc; kb+=blockSize )
+   {
+      const size_t kend( min( kb+blockSize, nc ) );
+
+      for( size_t j=kb; j<kend; ++j )
+      {
+         real* lj( F.data( j ) );
+
+         if( !( lj[j] > real(0) ) )
+            return notPositiveDefinite;
+
+         lj[j] = std::sqrt( lj[j] );
+         const real inv( real(1) / lj[j] );
+
+         for( size_t i=j+1UL; i<h; ++i )
+            lj[i] *= inv;
+
+         for( size_t k=j+1UL; k<kend; ++k ) {
+            real* lk( F.data( k ) );
+            const real factor( lj[k] );
+            for( size_t i=k; i<h; ++i )
+               lk[i] -= lj[i] * factor;
+         }
+      }
+
+      if( kend < nc ) {
+         const Supernode panel( serial( submatrix( F, kend, kb, h-kend, kend-kb ) ) );
+         const Supernode transposed( serial( trans( submatrix( panel, 0UL, 0UL, nc-kend, kend-kb ) ) ) );
+         updateLower( F, kend, panel, transposed );
+      }
+   }
+
+   // Computing the update matrix for the parent supernode
+   if( m > 0UL ) {
+      const Supernode L21( serial( submatrix( F, nc, 0UL, m, nc ) ) );
+      const Supernode transposed( serial( trans( L21 ) ) );
+      updateLower( U, 0UL, L21, transposed );
+   }
+
+   return success;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the forward substitution with a single supernode.
+//
+// \param s The supernode.
+// \param W The permuted right-hand sides.
+// \param updates The update vectors of all supernodes.
+// \return void
+//
+// The update vectors of the children are subtracted from the unknowns of the supernode or
+// accumulated in the update vector of the supernode. After the substitution with the diagonal
+// block, the contributions \f$ L_{21} x_1 \f$ are added to the update vector, which is passed
+// to the parent supernode.
+*/
+void SparseCholesky::forwardSupernode( size_t s, MatMxN& W, std::vector<MatMxN>& updates ) const
+{
+   const size_t first( columns_[s] );
+   const size_t nc( columns_[s+1UL] - first );
+   const size_t m ( rowPtr_[s+1UL] - rowPtr_[s] - nc );
+   const size_t k ( W.columns() );
+
+   const Supernode& F( factors_[s] );
+
+   MatMxN& U( updates[s] );
+   U.resize( m, k, false );
+   reset( U );
+
+   // Gathering the update vectors of the children
+   std::vector<size_t> indices;
+
+   for( size_t l=childPtr_[s]; l<childPtr_[s+1UL]; ++l )
+   {
+      const size_t c( children_[l] );
+      relativeIndices( s, c, indices );
+
+      const MatMxN& C( updates[c] );
+
+      for( size_t ii=0UL; ii<indices.size(); ++ii ) {
+         const size_t i( indices[ii] );
+         if( i < nc ) {
+            for( size_t r=0UL; r<k; ++r )
+               W( first+i, r ) -= C( ii, r );
+         }
+         else {
+            for( size_t r=0UL; r<k; ++r )
+               U( i-nc, r ) += C( ii, r );
+         }
+      }
+
+      MatMxN().swap( updates[c] );
+   }
+
+   // Blocked forward substitution with the diagonal block
+   for( size_t kb=0UL; kb<nc; kb+=blockSize )
+   {
+      const size_t kend( min( kb+blockSize, nc ) );
+
+      for( size_t j=kb; j<kend; ++j ) {
+         const real inv( real(1) / F( j, j ) );
+         for( size_t r=0UL; r<k; ++r )
+            W( first+j, r ) *= inv;
+         for( size_t i=j+1UL; i<kend; ++i ) {
+            const real factor( F( i, j ) );
+            for( size_t r=0UL; r<k; ++r )
+               W( first+i, r ) -= factor * W( first+j, r );
+         }
+      }
+
+      if( kend < nc ) {
+         const MatMxN X( serial( submatrix( W, first+kb, 0UL, kend-kb, k ) ) );
+         subtract( submatrix( W, first+kend, 0UL, nc-kend, k ),
+                   submatrix( F, kend, kb, nc-kend, kend-kb ) * X );
+      }
+   }
+
+   if( m > 0UL ) {
+      add( submatrix( U, 0UL, 0UL, m, k ),
+           submatrix( F, nc, 0UL, m, nc ) * submatrix( W, first, 0UL, nc, k ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the backward substitution with a single supernode.
+//
+// \param s The supernode.
+// \param W The permuted right-hand sides.
+// \return void
+//
+// The already computed unknowns of the rows below the diagonal block are gathered and their
+// contributions \f$ L_{21}^T x_2 \f$ are subtracted by a single dense matrix multiplication,
+// followed by the blocked backward substitution with the transposed diagonal block.
+*/
+void SparseCholesky::backwardSupernode( size_t s, MatMxN& W ) const
+{
+   const size_t first( columns_[s] );
+   const size_t nc( columns_[s+1UL] - first );
+   const size_t m ( rowPtr_[s+1UL] - rowPtr_[s] - nc );
+   const size_t k ( W.columns() );
+   const size_t* rows( &rows_[rowPtr_[s]] );
+
+   const Supernode& F( factors_[s] );
+
+   // Subtracting the contributions of the unknowns below the diagonal block
+   if( m > 0UL ) {
+      MatMxN X( m, k );
+      for( size_t i=0UL; i<m; ++i ) {
+         row( X, i ) = serial( row( W, rows[nc+i] ) );
+      }
+      subtract( submatrix( W, first, 0UL, nc, k ), trans( submatrix( F, nc, 0UL, m, nc ) ) * X );
+   }
+
+   // Blocked backward substitution with the transposed diagonal block
+   for( size_t kb=( ( nc-1UL ) / blockSize ) * blockSize; ; kb-=blockSize )
+   {
+      const size_t kend( min( kb+blockSize, nc ) );
+
+      if( kend < nc ) {
+         const MatMxN X( serial( submatrix( W, first+kend, 0UL, nc-kend, k ) ) );
+         subtract( submatrix( W, first+kb, 0UL, kend-kb, k ),
+                   trans( submatrix( F, kend, kb, nc-kend, kend-kb ) ) * X );
+      }
+
+      for( size_t j=kend; j>kb; --j ) {
+         for( size_t i=j; i<kend; ++i ) {
+            const real factor( F( i, j-1UL ) );
+            for( size_t r=0UL; r<k; ++r )
+               W( first+j-1UL, r ) -= factor * W( first+i, r );
+         }
+         const real inv( real(1) / F( j-1UL, j-1UL ) );
+         for( size_t r=0UL; r<k; ++r )
+            W( first+j-1UL, r ) *= inv;
+      }
+
+      if( kb == 0UL ) break;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze